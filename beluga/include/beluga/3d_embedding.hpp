@@ -15,20 +15,64 @@
 #ifndef BELUGA_3D_EMBEDDING_HPP
 #define BELUGA_3D_EMBEDDING_HPP
 
+#include <cmath>
+#include <vector>
+
+#include <sophus/common.hpp>
 #include <sophus/se2.hpp>
 #include <sophus/se3.hpp>
 
 namespace beluga {
 
 /// Transforms a SE3 transform into a SE2 transform, by flattening the Z axis.
+/**
+ * The planar unit complex number is assembled directly from the heading column of the
+ * quaternion rotation, skipping the angle extraction and trigonometric re-evaluation a
+ * conversion through the yaw angle would do. Poses pointing straight along the Z axis
+ * have no planar heading and flatten to the identity rotation.
+ */
 inline Sophus::SE2d To2d(const Sophus::SE3d& tf) {
-  return Sophus::SE2d{tf.angleZ(), tf.translation().head<2>()};
+  const auto& quaternion = tf.so3().unit_quaternion();
+  // First column of the rotation matrix, projected onto the XY plane.
+  const double heading_x =
+      1.0 - 2.0 * (quaternion.y() * quaternion.y() + quaternion.z() * quaternion.z());
+  const double heading_y = 2.0 * (quaternion.x() * quaternion.y() + quaternion.w() * quaternion.z());
+  const double squared_norm = heading_x * heading_x + heading_y * heading_y;
+  if (squared_norm < Sophus::Constants<double>::epsilon()) {
+    return Sophus::SE2d{Sophus::SO2d{}, tf.translation().head<2>()};
+  }
+  return Sophus::SE2d{Sophus::SO2d{heading_x, heading_y}, tf.translation().head<2>()};
 }
 
 /// Embed a SE2 transform into 3D space with zero Z translation and only rotation about the Z axis.
+/**
+ * The yaw-only quaternion is assembled from the half-angle identities on the stored unit
+ * complex number, so the conversion involves one square root instead of the angle
+ * extraction, trigonometric re-evaluation, and generic quaternion normalization of an
+ * axis-angle construction. It is unit by construction and written in place.
+ */
 inline Sophus::SE3d To3d(const Sophus::SE2d& tf) {
-  return Sophus::SE3d{
-      Sophus::SO3d::rotZ(tf.so2().log()), Eigen::Vector3d{tf.translation().x(), tf.translation().y(), 0.0}};
+  const double cos_theta = tf.so2().unit_complex().x();
+  const double sin_theta = tf.so2().unit_complex().y();
+  // Branching on the sign of the cosine keeps the square root free of cancellation on
+  // both sides, so the assembly stays accurate up to theta == pi.
+  double w;
+  double z;
+  if (cos_theta >= 0.0) {
+    w = std::sqrt((1.0 + cos_theta) / 2.0);
+    z = sin_theta / (2.0 * w);
+  } else {
+    z = std::copysign(std::sqrt((1.0 - cos_theta) / 2.0), sin_theta);
+    w = sin_theta / (2.0 * z);
+  }
+  Sophus::SE3d embedded;
+  double* coefficients = embedded.so3().data();  // (x, y, z, w), unit by construction
+  coefficients[0] = 0.0;
+  coefficients[1] = 0.0;
+  coefficients[2] = z;
+  coefficients[3] = w;
+  embedded.translation() = Eigen::Vector3d{tf.translation().x(), tf.translation().y(), 0.0};
+  return embedded;
 }
 
 /// Workaround for algorithms that need to handle 2D and 3D poses.
@@ -36,6 +80,42 @@ inline Sophus::SE3d To3d(const Sophus::SE3d& pose) {
   return pose;
 }
 
+/// Batch-converts a range of SE2 poses into their 3D embeddings.
+/**
+ * Equivalent to applying To3d() element-wise, refilling `out` without shrinking its
+ * capacity so callers converting at particle-count frequency pay no allocation once the
+ * vector has grown to the steady-state size.
+ *
+ * \param poses Range of SE2 poses to embed.
+ * \param out Output vector of embedded poses; cleared and refilled.
+ */
+template <class Range>
+void To3d(const Range& poses, std::vector<Sophus::SE3d>& out) {
+  out.clear();
+  out.reserve(poses.size());
+  for (const auto& pose : poses) {
+    out.push_back(To3d(pose));
+  }
+}
+
+/// Batch-converts a range of SE3 poses into their planar projections.
+/**
+ * Equivalent to applying To2d() element-wise, refilling `out` without shrinking its
+ * capacity so callers converting at particle-count frequency pay no allocation once the
+ * vector has grown to the steady-state size.
+ *
+ * \param poses Range of SE3 poses to flatten.
+ * \param out Output vector of flattened poses; cleared and refilled.
+ */
+template <class Range>
+void To2d(const Range& poses, std::vector<Sophus::SE2d>& out) {
+  out.clear();
+  out.reserve(poses.size());
+  for (const auto& pose : poses) {
+    out.push_back(To2d(pose));
+  }
+}
+
 }  // namespace beluga
 
 #endif
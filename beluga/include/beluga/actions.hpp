@@ -16,9 +16,15 @@
 #define BELUGA_ACTIONS_HPP
 
 #include <beluga/actions/assign.hpp>
+#include <beluga/actions/expand.hpp>
 #include <beluga/actions/normalize.hpp>
 #include <beluga/actions/propagate.hpp>
+#include <beluga/actions/propagate_reweight_normalized.hpp>
+#include <beluga/actions/prune.hpp>
+#include <beluga/actions/resample.hpp>
 #include <beluga/actions/reweight.hpp>
+#include <beluga/actions/reweight_normalized.hpp>
+#include <beluga/actions/reweight_truncated.hpp>
 
 /**
  * \file
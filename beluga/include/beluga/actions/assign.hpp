@@ -15,6 +15,10 @@
 #ifndef BELUGA_ACTIONS_ASSIGN_HPP
 #define BELUGA_ACTIONS_ASSIGN_HPP
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 #include <range/v3/action/action.hpp>
 #include <range/v3/functional/bind_back.hpp>
 #include <range/v3/range/conversion.hpp>
@@ -45,6 +49,27 @@ inline constexpr bool is_range_closure_v = is_range_closure<T>::value;
 
 namespace detail {
 
+/// \cond detail
+
+template <class Range, class View, class = void>
+struct enables_capacity_preserving_assign : std::false_type {};
+
+template <class Range, class View>
+struct enables_capacity_preserving_assign<
+    Range,
+    View,
+    std::void_t<
+        decltype(std::declval<const Range&>().capacity()),
+        decltype(std::declval<Range&>().reserve(std::declval<std::size_t>())),
+        decltype(std::declval<Range&>().assign(
+            ranges::begin(std::declval<View&>()),
+            ranges::end(std::declval<View&>())))>> : std::true_type {};
+
+template <class Range, class View>
+inline constexpr bool enables_capacity_preserving_assign_v = enables_capacity_preserving_assign<Range, View>::value;
+
+/// \endcond
+
 /// Implementation detail for an assign range adaptor object.
 struct assign_fn {
   /// Overload that implements the assign algorithm.
@@ -58,7 +83,18 @@ struct assign_fn {
     if constexpr (!std::is_same_v<Range, std::decay_t<decltype(view)>>) {
       // If the result of invoking the closure is not the range itself,
       // then we need to convert the view and assign it to the input range.
-      range = std::move(view) | ranges::to<Range>;
+      if constexpr (enables_capacity_preserving_assign_v<Range, std::decay_t<decltype(view)>>) {
+        // The view may read lazily from the input range, so materialize into a replacement
+        // container rather than assigning in place. Carrying the current capacity over
+        // means the copy allocates at most once, and populations that oscillate in size
+        // (e.g. under KLD resampling) never grow back element by element.
+        Range replacement;
+        replacement.reserve(range.capacity());
+        replacement.assign(ranges::begin(view), ranges::end(view));
+        range = std::move(replacement);
+      } else {
+        range = std::move(view) | ranges::to<Range>;
+      }
     }
     return range;
   }
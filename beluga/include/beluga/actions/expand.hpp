@@ -0,0 +1,118 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_EXPAND_HPP
+#define BELUGA_ACTIONS_EXPAND_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/view/common.hpp>
+
+#include <beluga/primitives.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the expand range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// Implementation detail for an expand range adaptor object.
+struct expand_fn {
+  /// Overload that implements the expand algorithm.
+  /**
+   * Each particle carrying a multiplicity of `m` is replaced by `m` plain copies of
+   * itself, appended at the end of the range, and every multiplicity is reset to one.
+   * The range is resized up front and the copies are written in place, so the
+   * expansion performs a single allocation at most. Relative particle ordering of the
+   * appended copies is not preserved.
+   *
+   * Multiplicities must be at least one for every particle; compressed producers
+   * (e.g. `beluga::actions::resample`) never emit empty rows.
+   *
+   * \tparam Range A [random access range](https://en.cppreference.com/w/cpp/ranges/random_access_range)
+   * of particles carrying a `beluga::Multiplicity` column. Must be a container providing
+   * a `resize()` member function (e.g. beluga::TupleVector, std::vector).
+   * \param range An existing range of particles to apply this action to.
+   */
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range& range) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    static_assert(beluga::has_single_element<beluga::Multiplicity, ranges::range_value_t<Range>>::value);
+
+    const auto count = static_cast<std::size_t>(ranges::size(range));
+
+    std::size_t expanded_count = 0U;
+    for (const auto multiplicity : range | beluga::views::multiplicities) {
+      assert(static_cast<std::size_t>(multiplicity) > 0U);
+      expanded_count += static_cast<std::size_t>(multiplicity);
+    }
+
+    if (expanded_count == count) {
+      return range;  // Every multiplicity is already one.
+    }
+
+    range.resize(expanded_count);
+
+    // Append m - 1 copies of each duplicated row past the original prefix, then
+    // reset every multiplicity; the copies inherit their source multiplicity, so
+    // the reset must cover the whole expanded range.
+    auto first = ranges::begin(range);
+    using difference_type = ranges::range_difference_t<Range>;
+    auto multiplicities = range | beluga::views::multiplicities;
+    const auto multiplicity_first = multiplicities.begin();
+    std::size_t write = count;
+    for (std::size_t at = 0U; at < count; ++at) {
+      const auto multiplicity =
+          static_cast<std::size_t>(multiplicity_first[static_cast<difference_type>(at)]);
+      for (std::size_t copy = 1U; copy < multiplicity; ++copy) {
+        *(first + static_cast<difference_type>(write)) = *(first + static_cast<difference_type>(at));
+        ++write;
+      }
+    }
+    assert(write == expanded_count);
+
+    for (std::size_t at = 0U; at < expanded_count; ++at) {
+      multiplicity_first[static_cast<difference_type>(at)] = beluga::Multiplicity{1U};
+    }
+
+    return range;
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// expands a compressed particle range into plain per-particle rows.
+/**
+ * Compressed particle ranges represent duplicated particles as unique rows with a
+ * multiplicity count (see `beluga::actions::resample`). The `expand` action
+ * materializes the duplicates again, meant to run right before a stage that
+ * re-diversifies them — typically `beluga::actions::propagate` with a noisy motion
+ * model, so each copy receives independent noise.
+ */
+inline constexpr ranges::actions::action_closure<detail::expand_fn> expand;
+
+}  // namespace beluga::actions
+
+#endif
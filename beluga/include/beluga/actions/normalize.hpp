@@ -16,13 +16,17 @@
 #define BELUGA_ACTIONS_NORMALIZE_HPP
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <execution>
+#include <limits>
 #include <optional>
 
 #include <range/v3/action/action.hpp>
 #include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/view/common.hpp>
 
+#include <beluga/algorithm/effective_sample_size.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
 #include <beluga/views/particles.hpp>
 
@@ -50,10 +54,33 @@ struct normalize_closure {
 
   constexpr normalize_closure(ExecutionPolicy policy, double factor) : policy_{std::move(policy)}, factor_{factor} {}
 
+  constexpr explicit normalize_closure(WeightStatistics* statistics) noexcept
+      : policy_{std::execution::seq}, statistics_{statistics} {}
+
+  constexpr normalize_closure(ExecutionPolicy policy, WeightStatistics* statistics)
+      : policy_{std::move(policy)}, statistics_{statistics} {}
+
+  constexpr normalize_closure(double factor, WeightStatistics* statistics) noexcept
+      : policy_{std::execution::seq}, factor_{factor}, statistics_{statistics} {}
+
+  constexpr normalize_closure(ExecutionPolicy policy, double factor, WeightStatistics* statistics)
+      : policy_{std::move(policy)}, factor_{factor}, statistics_{statistics} {}
+
   template <class Range>
   constexpr auto operator()(Range& range) const -> Range& {
     static_assert(ranges::forward_range<Range>);
 
+    if constexpr (beluga::is_log_weight_particle_range_v<Range>) {
+      return normalize_log_weights(range);
+    } else {
+      return normalize_weights(range);
+    }
+  }
+
+ private:
+  /// Normalize a range of linear-domain weights (or of particles bearing them).
+  template <class Range>
+  constexpr auto normalize_weights(Range& range) const -> Range& {
     auto weights = std::invoke([&range]() {
       if constexpr (beluga::is_particle_range_v<Range>) {
         return range | beluga::views::weights | ranges::views::common;
@@ -63,6 +90,23 @@ struct normalize_closure {
     });
 
     const double factor = std::invoke([this, weights]() {
+      if (statistics_ != nullptr) {
+        // Accumulate the total and squared total in the same sweep, so
+        // consumers can read the effective sample size without another pass.
+        double sum = 0.0;
+        double sum_of_squares = 0.0;
+        std::size_t count = 0;
+        for (const double weight : weights) {
+          sum += weight;
+          sum_of_squares += weight * weight;
+          ++count;
+        }
+        statistics_->total_weight = sum;
+        statistics_->squared_total_weight = sum_of_squares;
+        statistics_->sample_count = count;
+        return factor_.value_or(sum);
+      }
+
       if (factor_.has_value()) {
         return factor_.value();
       }
@@ -70,6 +114,12 @@ struct normalize_closure {
       return ranges::accumulate(weights, 0.0);  // The default normalization factor is the total sum of weights.
     });
 
+    if (statistics_ != nullptr && factor != 0.0) {
+      // Keep the statistics consistent with the weights as stored after scaling.
+      statistics_->total_weight /= factor;
+      statistics_->squared_total_weight /= factor * factor;
+    }
+
     if (std::abs(factor - 1.0) < std::numeric_limits<double>::epsilon()) {
       return range;  // No change.
     }
@@ -79,14 +129,55 @@ struct normalize_closure {
         weights.begin(),  //
         weights.end(),    //
         weights.begin(),  //
-        [factor](const auto w) { return w / factor; });
+        [factor](const auto w) {
+          // Scale in double precision and narrow back to the stored weight precision.
+          return static_cast<beluga::underlying_numeric_t<decltype(w)>>(w / factor);
+        });
+
+    return range;
+  }
+
+  /// Normalize a range of particles bearing log-domain weights.
+  /**
+   * The normalization factor is computed with the numerically stable log-sum-exp
+   * trick and subtracted from each log-weight, so that the linear-domain weights
+   * implicitly sum to one. A custom factor, if given, is interpreted in the log
+   * domain and subtracted as-is.
+   */
+  template <class Range>
+  constexpr auto normalize_log_weights(Range& range) const -> Range& {
+    auto weights = range | beluga::views::log_weights | ranges::views::common;
+
+    const double factor = std::invoke([this, weights]() {
+      if (factor_.has_value()) {
+        return factor_.value();
+      }
+
+      const double max = ranges::accumulate(
+          weights, std::numeric_limits<double>::lowest(),
+          [](double lhs, double rhs) { return std::max(lhs, rhs); });
+      const double sum = ranges::accumulate(
+          weights, 0.0, [max](double accumulated, double w) { return accumulated + std::exp(w - max); });
+      return max + std::log(sum);
+    });
+
+    if (std::abs(factor) < std::numeric_limits<double>::epsilon()) {
+      return range;  // No change.
+    }
+
+    std::transform(
+        policy_,          //
+        weights.begin(),  //
+        weights.end(),    //
+        weights.begin(),  //
+        [factor](const auto w) { return w - factor; });
 
     return range;
   }
 
- private:
   ExecutionPolicy policy_{};
   std::optional<double> factor_;
+  WeightStatistics* statistics_{nullptr};
 };
 
 struct normalize_fn {
@@ -131,6 +222,29 @@ struct normalize_fn {
   constexpr auto operator()(double factor) const { return ranges::actions::action_closure{normalize_closure{factor}}; }
 
   constexpr auto operator()() const { return ranges::actions::action_closure{normalize_closure{}}; }
+
+  template <
+      class ExecutionPolicy,
+      class Range,
+      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy&& policy, Range& range, WeightStatistics* statistics) const -> Range& {
+    return normalize_closure{std::forward<ExecutionPolicy>(policy), statistics}(range);
+  }
+
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range& range, WeightStatistics* statistics) const -> Range& {
+    return normalize_closure{statistics}(range);
+  }
+
+  template <class ExecutionPolicy, std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy&& policy, WeightStatistics* statistics) const {
+    return ranges::actions::action_closure{normalize_closure{std::forward<ExecutionPolicy>(policy), statistics}};
+  }
+
+  constexpr auto operator()(WeightStatistics* statistics) const {
+    return ranges::actions::action_closure{normalize_closure{statistics}};
+  }
 };
 
 /// \endcond
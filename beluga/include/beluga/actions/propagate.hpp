@@ -19,7 +19,9 @@
 #include <execution>
 #include <type_traits>
 
+#include <beluga/type_traits/executor_traits.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/tracepoints.hpp>
 #include <beluga/views/particles.hpp>
 
 #include <range/v3/action/action.hpp>
@@ -35,6 +37,22 @@ namespace beluga::actions {
 
 namespace detail {
 
+/// \cond detail
+
+template <class Fn, class States, class Generator, class = void>
+struct is_batch_sampling_function : std::false_type {};
+
+template <class Fn, class States, class Generator>
+struct is_batch_sampling_function<
+    Fn,
+    States,
+    Generator,
+    std::enable_if_t<
+        std::is_void_v<decltype(std::declval<Fn&>()(std::declval<States&>(), std::declval<Generator&>()))>>>
+    : std::true_type {};
+
+/// \endcond
+
 /// Implementation detail for a propagate range adaptor object.
 struct propagate_base_fn {
   /// Overload that implements the propagate algorithm.
@@ -43,7 +61,8 @@ struct propagate_base_fn {
    * \tparam Range An [input range](https://en.cppreference.com/w/cpp/ranges/input_range) of particles.
    * \tparam StateSamplingFunction A callable that samples a posterior state given a prior state. Callables satisfying
    * \ref StateSamplingFunctionPage are also supported. This will be bound to the default random number generator for
-   * ranges.
+   * ranges. Callables that instead take the whole state range and a generator, returning void, are invoked once to
+   * propagate all particles in a single batch.
    * \param policy The execution policy to use.
    * \param range An existing range of particles to apply this action to.
    * \param fn A state sampling function instance.
@@ -56,25 +75,90 @@ struct propagate_base_fn {
       std::enable_if_t<ranges::range<Range>, int> = 0>
   constexpr auto operator()(ExecutionPolicy&& policy, Range& range, StateSamplingFunction fn) const -> Range& {
     static_assert(beluga::is_particle_range_v<Range>);
+    BELUGA_TRACEPOINT(propagate_begin);
+    auto states = range | beluga::views::states | ranges::views::common;
+
+    using States = decltype(states);
+    using State = ranges::range_value_t<States>;
+    using Generator = decltype(ranges::detail::get_random_engine());
+
+    // Sampling functions that take the whole state range propagate all particles in
+    // one call, typically with SoA math over the batch; iteration and vectorization
+    // are then up to the model, so the execution policy does not apply.
+    if constexpr (is_batch_sampling_function<StateSamplingFunction, States, Generator>::value) {
+      fn(states, ranges::detail::get_random_engine());
+    } else {
+      constexpr bool kNeedsEngine = std::is_invocable_v<StateSamplingFunction, State, Generator>;
+
+      auto unary_fn = [&]() {
+        if constexpr (kNeedsEngine) {
+          return [fn = std::move(fn)](const State& state) { return fn(state, ranges::detail::get_random_engine()); };
+        } else {
+          return std::move(fn);
+        }
+      }();
+
+      // Sampling functions bound to the shared per-thread random engine mutate its
+      // state on every call, which is not safe to interleave within a thread. Demote
+      // unsequenced policies to their sequenced-within-a-thread equivalent for them.
+      auto effective_policy = [&policy]() {
+        using Policy = std::decay_t<ExecutionPolicy>;
+        if constexpr (kNeedsEngine && std::is_same_v<Policy, std::execution::unsequenced_policy>) {
+          return std::execution::seq;
+        } else if constexpr (kNeedsEngine && std::is_same_v<Policy, std::execution::parallel_unsequenced_policy>) {
+          return std::execution::par;
+        } else {
+          return policy;
+        }
+      }();
+
+      std::transform(
+          effective_policy,    // rvalue policies are not supported in some STL implementations
+          std::begin(states),  //
+          std::end(states),    //
+          std::begin(states),  //
+          std::move(unary_fn));
+    }
+    BELUGA_TRACEPOINT(propagate_end);
+    return range;
+  }
+
+  /// Overload that uses a bulk executor instead of an execution policy.
+  /**
+   * \tparam Executor A type satisfying \ref beluga::is_bulk_executor.
+   *
+   * Sampling functions bound to the shared random engine are safe here since
+   * each worker thread in the pool draws from its own thread-local engine.
+   */
+  template <
+      class Executor,
+      class Range,
+      class StateSamplingFunction,
+      std::enable_if_t<beluga::is_bulk_executor_v<std::decay_t<Executor>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Executor executor, Range& range, StateSamplingFunction fn) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    BELUGA_TRACEPOINT(propagate_begin);
     auto states = range | beluga::views::states | ranges::views::common;
 
-    auto unary_fn = [&]() {
-      using States = decltype(states);
-      using State = ranges::range_value_t<States>;
-      using Generator = decltype(ranges::detail::get_random_engine());
-      if constexpr (std::is_invocable_v<StateSamplingFunction, State, Generator>) {
-        return [fn = std::move(fn)](const State& state) { return fn(state, ranges::detail::get_random_engine()); };
-      } else {
-        return std::move(fn);
-      }
-    }();
-
-    std::transform(
-        policy,              // rvalue policies are not supported in some STL implementations
-        std::begin(states),  //
-        std::end(states),    //
-        std::begin(states),  //
-        std::move(unary_fn));
+    using States = decltype(states);
+    using State = ranges::range_value_t<States>;
+    using Generator = decltype(ranges::detail::get_random_engine());
+
+    if constexpr (is_batch_sampling_function<StateSamplingFunction, States, Generator>::value) {
+      fn(states, ranges::detail::get_random_engine());
+    } else {
+      auto unary_fn = [&]() {
+        if constexpr (std::is_invocable_v<StateSamplingFunction, State, Generator>) {
+          return [fn = std::move(fn)](const State& state) { return fn(state, ranges::detail::get_random_engine()); };
+        } else {
+          return std::move(fn);
+        }
+      }();
+
+      executor.bulk_execute(states, [&unary_fn](auto&& state) { state = unary_fn(state); });
+    }
+    BELUGA_TRACEPOINT(propagate_end);
     return range;
   }
 
@@ -84,7 +168,9 @@ struct propagate_base_fn {
       class StateSamplingFunction,
       class ExecutionPolicy,
       std::enable_if_t<ranges::range<Range>, int> = 0,
-      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
   constexpr auto operator()(Range&& range, StateSamplingFunction fn, ExecutionPolicy policy) const -> Range& {
     return (*this)(std::move(policy), std::forward<Range>(range), std::move(fn));
   }
@@ -93,7 +179,9 @@ struct propagate_base_fn {
   template <
       class ExecutionPolicy,        //
       class StateSamplingFunction,  //
-      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
   constexpr auto operator()(ExecutionPolicy policy, StateSamplingFunction fn) const {
     return ranges::make_action_closure(ranges::bind_back(propagate_base_fn{}, std::move(fn), std::move(policy)));
   }
@@ -0,0 +1,355 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_PROPAGATE_REWEIGHT_NORMALIZED_HPP
+#define BELUGA_ACTIONS_PROPAGATE_REWEIGHT_NORMALIZED_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <limits>
+#include <type_traits>
+
+#include <beluga/actions/propagate.hpp>
+#include <beluga/actions/reweight.hpp>
+#include <beluga/actions/reweight_normalized.hpp>
+#include <beluga/type_traits/executor_traits.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/view/common.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the propagate_reweight_normalized range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// Implementation detail for a propagate_reweight_normalized range adaptor object.
+struct propagate_reweight_normalized_base_fn {
+  /// Overload that implements the fused propagate + reweight + normalize algorithm.
+  /**
+   * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+   * \tparam Range An [input range](https://en.cppreference.com/w/cpp/ranges/input_range) of particles.
+   * \tparam StateSamplingFunction A callable that samples a posterior state given a prior state,
+   * as accepted by `beluga::actions::propagate`.
+   * \tparam Model A callable that can compute the importance weight given a particle state.
+   * \param policy The execution policy to use.
+   * \param range An existing range of particles to apply this action to.
+   * \param fn A state sampling function instance.
+   * \param model A callable instance to compute the weights given the particle states.
+   * \param statistics Optional weight statistics accumulated in the same sweep, so
+   * consumers can read the effective sample size without another pass over the weights.
+   *
+   * Equivalent to `beluga::actions::propagate` followed by
+   * `beluga::actions::reweight_normalized`, but under the sequenced policy both stages
+   * run in a single sweep over the particle columns: each particle is reweighted right
+   * after it is propagated, while its new state is still in registers, instead of
+   * writing the whole state column out in one pass and streaming it back in the next.
+   *
+   * Parallel and unsequenced policies cannot accumulate the weight totals from within
+   * the propagation sweep without synchronization, and sampling functions that take the
+   * whole state range (or batch weighting backends that take the whole states and
+   * weights ranges) own their iteration; in those cases the stages run composed,
+   * exactly as if the constituent actions had been piped.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      class StateSamplingFunction,
+      class Model,
+      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      ExecutionPolicy&& policy,
+      Range& range,
+      StateSamplingFunction fn,
+      Model model,
+      WeightStatistics* statistics = nullptr) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    auto states = range | beluga::views::states | ranges::views::common;
+
+    using States = decltype(states);
+    using State = ranges::range_value_t<States>;
+    using Generator = decltype(ranges::detail::get_random_engine());
+
+    constexpr bool kSequenced = std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>;
+    constexpr bool kBatchSampling = is_batch_sampling_function<StateSamplingFunction, States, Generator>::value;
+    using Weights = decltype(range | beluga::views::weights | ranges::views::common);
+    constexpr bool kBatchWeighting = is_batch_weighting_function<Model, States, Weights>::value;
+
+    if constexpr (!kSequenced || kBatchSampling || kBatchWeighting) {
+      propagate_base_fn{}(std::forward<ExecutionPolicy>(policy), range, std::move(fn));
+      return reweight_normalized_base_fn{}(std::forward<ExecutionPolicy>(policy), range, std::move(model), statistics);
+    } else {
+      constexpr bool kNeedsEngine = std::is_invocable_v<StateSamplingFunction, State, Generator>;
+
+      auto unary_fn = [&]() {
+        if constexpr (kNeedsEngine) {
+          return [fn = std::move(fn)](const State& state) { return fn(state, ranges::detail::get_random_engine()); };
+        } else {
+          return std::move(fn);
+        }
+      }();
+
+      auto weights = range | beluga::views::weights | ranges::views::common;
+
+      double total = 0.0;
+      double total_of_squares = 0.0;
+      std::size_t count = 0;
+      auto weight_it = std::begin(weights);
+      for (auto&& state : states) {
+        const State next = unary_fn(state);
+        state = next;
+        const double weight = *weight_it * model(next);
+        *weight_it = static_cast<beluga::underlying_numeric_t<decltype(*weight_it)>>(weight);
+        total += weight;
+        total_of_squares += weight * weight;
+        ++count;
+        ++weight_it;
+      }
+
+      if (statistics != nullptr) {
+        statistics->sample_count = count;
+      }
+
+      if (std::abs(total - 1.0) < std::numeric_limits<double>::epsilon()) {
+        if (statistics != nullptr) {
+          statistics->total_weight = total;
+          statistics->squared_total_weight = total_of_squares;
+        }
+        return range;  // No change.
+      }
+
+      if (statistics != nullptr && total != 0.0) {
+        // Keep the statistics consistent with the weights as stored after scaling.
+        statistics->total_weight = 1.0;
+        statistics->squared_total_weight = total_of_squares / (total * total);
+      }
+
+      std::transform(
+          policy,               //
+          std::begin(weights),  //
+          std::end(weights),    //
+          std::begin(weights),  //
+          [total](const auto w) { return static_cast<beluga::underlying_numeric_t<decltype(w)>>(w / total); });
+
+      return range;
+    }
+  }
+
+  /// Overload that uses a bulk executor instead of an execution policy.
+  /**
+   * \tparam Executor A type satisfying \ref beluga::is_bulk_executor.
+   *
+   * Each chunk handed to the executor propagates and reweights its particles in one
+   * fused pass; the reduction over the weight totals runs on the caller thread.
+   * Sampling functions bound to the shared random engine are safe here since each
+   * worker thread in the pool draws from its own thread-local engine.
+   */
+  template <
+      class Executor,
+      class Range,
+      class StateSamplingFunction,
+      class Model,
+      std::enable_if_t<beluga::is_bulk_executor_v<std::decay_t<Executor>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      Executor executor,
+      Range& range,
+      StateSamplingFunction fn,
+      Model model,
+      WeightStatistics* statistics = nullptr) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    auto states = range | beluga::views::states | ranges::views::common;
+
+    using States = decltype(states);
+    using State = ranges::range_value_t<States>;
+    using Generator = decltype(ranges::detail::get_random_engine());
+
+    using Weights = decltype(range | beluga::views::weights | ranges::views::common);
+    if constexpr (
+        is_batch_sampling_function<StateSamplingFunction, States, Generator>::value ||
+        is_batch_weighting_function<Model, States, Weights>::value) {
+      propagate_base_fn{}(executor, range, std::move(fn));
+      return reweight_normalized_base_fn{}(executor, range, std::move(model), statistics);
+    } else {
+      auto unary_fn = [&]() {
+        if constexpr (std::is_invocable_v<StateSamplingFunction, State, Generator>) {
+          return [fn = std::move(fn)](const State& state) { return fn(state, ranges::detail::get_random_engine()); };
+        } else {
+          return std::move(fn);
+        }
+      }();
+
+      executor.bulk_execute(range, [&unary_fn, &model](auto&& particle) {
+        auto&& state = beluga::state(particle);
+        const State next = unary_fn(state);
+        state = next;
+        auto&& weight = beluga::weight(particle);
+        weight = static_cast<beluga::underlying_numeric_t<decltype(weight)>>(weight * model(next));
+      });
+
+      auto weights = range | beluga::views::weights | ranges::views::common;
+      double total = 0.0;
+      double total_of_squares = 0.0;
+      std::size_t count = 0;
+      for (const double weight : weights) {
+        total += weight;
+        total_of_squares += weight * weight;
+        ++count;
+      }
+
+      if (statistics != nullptr) {
+        statistics->sample_count = count;
+      }
+
+      if (std::abs(total - 1.0) < std::numeric_limits<double>::epsilon()) {
+        if (statistics != nullptr) {
+          statistics->total_weight = total;
+          statistics->squared_total_weight = total_of_squares;
+        }
+        return range;  // No change.
+      }
+
+      if (statistics != nullptr && total != 0.0) {
+        // Keep the statistics consistent with the weights as stored after scaling.
+        statistics->total_weight = 1.0;
+        statistics->squared_total_weight = total_of_squares / (total * total);
+      }
+
+      executor.bulk_execute(weights, [total](auto&& weight) {
+        weight = static_cast<beluga::underlying_numeric_t<decltype(weight)>>(weight / total);
+      });
+      return range;
+    }
+  }
+
+  /// Overload that re-orders arguments from a view closure.
+  template <
+      class Range,
+      class StateSamplingFunction,
+      class Model,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
+  constexpr auto operator()(Range&& range, StateSamplingFunction fn, Model model, ExecutionPolicy policy) const
+      -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(fn), std::move(model));
+  }
+
+  /// Overload that re-orders arguments from a view closure, with weight statistics.
+  template <
+      class Range,
+      class StateSamplingFunction,
+      class Model,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
+  constexpr auto operator()(
+      Range&& range,
+      StateSamplingFunction fn,
+      Model model,
+      WeightStatistics* statistics,
+      ExecutionPolicy policy) const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(fn), std::move(model), statistics);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <
+      class ExecutionPolicy,
+      class StateSamplingFunction,
+      class Model,
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, StateSamplingFunction fn, Model model) const {
+    return ranges::make_action_closure(ranges::bind_back(
+        propagate_reweight_normalized_base_fn{}, std::move(fn), std::move(model), std::move(policy)));
+  }
+
+  /// Overload that returns a view closure to compose with other views, with weight statistics.
+  template <
+      class ExecutionPolicy,
+      class StateSamplingFunction,
+      class Model,
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, StateSamplingFunction fn, Model model, WeightStatistics* statistics)
+      const {
+    return ranges::make_action_closure(ranges::bind_back(
+        propagate_reweight_normalized_base_fn{}, std::move(fn), std::move(model), statistics, std::move(policy)));
+  }
+};
+
+/// Implementation detail for a propagate_reweight_normalized range adaptor object with a default execution policy.
+struct propagate_reweight_normalized_fn : public propagate_reweight_normalized_base_fn {
+  using propagate_reweight_normalized_base_fn::operator();
+
+  /// Overload that defines a default execution policy.
+  template <class Range, class StateSamplingFunction, class Model, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, StateSamplingFunction fn, Model model) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(fn), std::move(model));
+  }
+
+  /// Overload that defines a default execution policy, with weight statistics.
+  template <class Range, class StateSamplingFunction, class Model, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, StateSamplingFunction fn, Model model, WeightStatistics* statistics) const
+      -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(fn), std::move(model), statistics);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <class StateSamplingFunction, class Model>
+  constexpr auto operator()(StateSamplingFunction fn, Model model) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(propagate_reweight_normalized_fn{}, std::move(fn), std::move(model)));
+  }
+
+  /// Overload that returns a view closure to compose with other views, with weight statistics.
+  template <class StateSamplingFunction, class Model>
+  constexpr auto operator()(StateSamplingFunction fn, Model model, WeightStatistics* statistics) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(propagate_reweight_normalized_fn{}, std::move(fn), std::move(model), statistics));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// can propagate, reweight and normalize a particle range in a single fused sweep.
+/**
+ * Fused equivalent of `beluga::actions::propagate` piped into
+ * `beluga::actions::reweight_normalized`: each particle is reweighted right after it is
+ * propagated, so the state column is streamed through memory once per update instead of
+ * once per stage. Configurations the fused sweep cannot serve (parallel standard
+ * policies, batch sampling functions) fall back to running the stages composed, so the
+ * action is always a drop-in replacement for the pipeline it fuses.
+ */
+inline constexpr detail::propagate_reweight_normalized_fn propagate_reweight_normalized;
+
+}  // namespace beluga::actions
+
+#endif
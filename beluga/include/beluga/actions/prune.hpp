@@ -0,0 +1,179 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_PRUNE_HPP
+#define BELUGA_ACTIONS_PRUNE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <utility>
+
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/common.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the prune range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// Implementation detail for a prune range adaptor object.
+struct prune_base_fn {
+  /// Overload that implements the prune algorithm.
+  /**
+   * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+   * \tparam Range A [random access range](https://en.cppreference.com/w/cpp/ranges/random_access_range) of particles.
+   * Must be a container providing a `resize()` member function (e.g. beluga::TupleVector, std::vector).
+   * \param policy The execution policy to use for the final renormalization sweep.
+   * \param range An existing range of particles to apply this action to.
+   * \param epsilon Normalized weight threshold below which particles are removed, in [0, 1).
+   *
+   * Particles whose normalized weight falls below `epsilon` are removed by moving the
+   * last particle into their slot and shrinking the range, so the compaction is done
+   * in place without allocating and without disturbing the pairing of particle
+   * columns. The surviving weights are renormalized so the pruned mass does not bias
+   * the weight scale. Relative ordering of the surviving particles is not preserved.
+   *
+   * Pruning is skipped entirely when it would remove every particle (a degenerate
+   * `epsilon`), so the range never comes out empty.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy&& policy, Range& range, double epsilon) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    static_assert(ranges::sized_range<Range>);
+
+    const auto size = ranges::size(range);
+    if (size == 0UL) {
+      return range;
+    }
+
+    auto weights = range | beluga::views::weights | ranges::views::common;
+
+    double total = 0.0;
+    double max = 0.0;
+    for (const double weight : weights) {
+      total += weight;
+      max = std::max(max, weight);
+    }
+    if (total <= 0.0) {
+      return range;
+    }
+
+    const double threshold = epsilon * total;
+    if (max < threshold) {
+      return range;  // Degenerate threshold, pruning would empty the particle set.
+    }
+
+    // Swap-with-last compaction over whole particle rows. The row moved into a
+    // freed slot is re-examined before the cursor advances, so it can itself be
+    // pruned in the same sweep.
+    const auto first = ranges::begin(range);
+    const auto weight_first = std::begin(weights);
+    double kept_total = total;
+    std::size_t count = size;
+    std::size_t cursor = 0;
+    while (cursor < count) {
+      const double weight = weight_first[static_cast<std::ptrdiff_t>(cursor)];
+      if (weight < threshold) {
+        kept_total -= weight;
+        --count;
+        first[static_cast<std::ptrdiff_t>(cursor)] = first[static_cast<std::ptrdiff_t>(count)];
+      } else {
+        ++cursor;
+      }
+    }
+
+    if (count == size) {
+      return range;  // No change.
+    }
+
+    range.resize(count);
+
+    // Renormalize the survivors so the weights keep summing to the same unit mass
+    // the caller maintained before pruning.
+    auto kept_weights = range | beluga::views::weights | ranges::views::common;
+    std::transform(
+        policy,                //
+        kept_weights.begin(),  //
+        kept_weights.end(),    //
+        kept_weights.begin(),  //
+        [kept_total, total](const auto w) {
+          return static_cast<beluga::underlying_numeric_t<decltype(w)>>(w * (total / kept_total));
+        });
+
+    return range;
+  }
+
+  /// Overload that re-orders arguments from a view closure.
+  template <
+      class Range,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(Range&& range, double epsilon, ExecutionPolicy policy) const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), epsilon);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <class ExecutionPolicy, std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, double epsilon) const {
+    return ranges::make_action_closure(ranges::bind_back(prune_base_fn{}, epsilon, std::move(policy)));
+  }
+};
+
+/// Implementation detail for a prune range adaptor object with a default execution policy.
+struct prune_fn : public prune_base_fn {
+  using prune_base_fn::operator();
+
+  /// Overload that defines a default execution policy.
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, double epsilon) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), epsilon);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  constexpr auto operator()(double epsilon) const {
+    return ranges::make_action_closure(ranges::bind_back(prune_fn{}, epsilon));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// can remove near-zero-weight particles from a particle range, compacting it in place.
+/**
+ * Long tails of near-zero-weight particles survive in between resamples and still pay
+ * full motion and sensor model cost on every update. The `prune` action removes
+ * particles whose normalized weight falls below a configurable threshold with
+ * swap-with-last compaction of the particle columns, renormalizing the survivors,
+ * so subsequent updates only pay for particles that contribute to the estimate.
+ */
+inline constexpr detail::prune_fn prune;
+
+}  // namespace beluga::actions
+
+#endif
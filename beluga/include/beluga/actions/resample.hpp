@@ -0,0 +1,280 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_RESAMPLE_HPP
+#define BELUGA_ACTIONS_RESAMPLE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/algorithm/fill.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/view/common.hpp>
+
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/tracepoints.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the resample range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// \cond detail
+
+template <class Range, class = void>
+struct has_apply_ancestry : std::false_type {};
+
+template <class Range>
+struct has_apply_ancestry<
+    Range,
+    std::void_t<decltype(std::declval<Range&>().apply_ancestry(
+        std::declval<const std::vector<std::size_t>&>()))>> : std::true_type {};
+
+template <class Range>
+inline constexpr bool has_apply_ancestry_v = has_apply_ancestry<Range>::value;
+
+template <class Range, class = void>
+struct has_weight_fill_column_impl : std::false_type {};
+
+template <class Range>
+struct has_weight_fill_column_impl<
+    Range,
+    std::void_t<decltype(std::declval<Range&>()
+                             .template fill_column<tuple_index_v<beluga::Weight, ranges::range_value_t<Range>>>(
+                                 std::declval<beluga::Weight>()))>> : std::true_type {};
+
+// The single-element check must come first: `tuple_index_v` is ill-formed (not just
+// a substitution failure) for particle types without a unique weight column, and
+// `std::conjunction` short-circuits its instantiation.
+template <class Range>
+inline constexpr bool has_weight_fill_column_v = std::conjunction_v<
+    beluga::has_single_element<beluga::Weight, ranges::range_value_t<Range>>,
+    has_weight_fill_column_impl<Range>>;
+
+/// \endcond
+
+/// Implementation detail for a resample range adaptor object.
+struct resample_fn {
+  /// Overload that implements the in-place systematic resample algorithm.
+  /**
+   * The ancestor index of each slot is computed first with a systematic low-variance
+   * sweep over the cumulative weight profile, and then applied as a
+   * permutation-with-duplication over the particle range. Since systematic ancestor
+   * arrays are sorted, the permutation can be applied in place, touching only the
+   * slots whose ancestor is not themselves; for converged populations where most
+   * particles survive in their own slot, this moves a small fraction of the memory
+   * that materializing a sampled view would. Weights are reset to one afterwards,
+   * as after any resample the posterior is represented by particle multiplicity;
+   * containers with a lazy weight column fill (such as `beluga::TupleVector`) only
+   * record the reset instead of rewriting the column.
+   *
+   * Unlike the `beluga::views::sample | beluga::actions::assign` pipeline, this
+   * action keeps the population size constant, so it does not compose with
+   * adaptive limiters such as `beluga::views::take_while_kld`.
+   *
+   * Ranges whose particles carry a `beluga::Multiplicity` column get the compressed
+   * representation instead of materialized duplicates: survivors are compacted
+   * forward, their draw counts are recorded in the multiplicity column, and the
+   * range shrinks to the number of unique survivors (the range must provide a
+   * `resize()` member function). Incoming multiplicities scale both the weight
+   * profile and the number of draws, so the represented population size is
+   * conserved across consecutive compressed resamples. Duplicates are expanded on
+   * demand with `beluga::actions::expand`, e.g. ahead of a diversifying propagate.
+   *
+   * \tparam Range A [random access](https://en.cppreference.com/w/cpp/ranges/random_access_range)
+   *  range of particles.
+   * \tparam URNG A random number generator that satisfies the
+   *  [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
+   *  requirements.
+   * \param range An existing range of particles to apply this action to.
+   * \param engine The random number generator object.
+   */
+  template <class Range, class URNG, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range& range, URNG& engine) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    BELUGA_TRACEPOINT(resample_begin);
+
+    auto weights = range | beluga::views::weights | ranges::views::common;
+    const auto count = static_cast<std::size_t>(ranges::size(range));
+    if (count == 0U) {
+      BELUGA_TRACEPOINT(resample_end);
+      return range;
+    }
+
+    constexpr bool kHasMultiplicity =
+        beluga::has_single_element<beluga::Multiplicity, ranges::range_value_t<Range>>::value;
+
+    // Each row stands for as many identical particles as its multiplicity, so the
+    // weight profile and the number of draws both account for it; plain ranges have
+    // an implicit multiplicity of one everywhere.
+    const auto weight_first = weights.begin();
+    const auto effective_weight = [&range, weight_first](std::size_t at) {
+      const double weight = weight_first[static_cast<std::ptrdiff_t>(at)];
+      if constexpr (kHasMultiplicity) {
+        auto multiplicities = range | beluga::views::multiplicities;
+        return weight *
+               static_cast<double>(static_cast<std::size_t>(multiplicities.begin()[static_cast<std::ptrdiff_t>(at)]));
+      } else {
+        return weight;
+      }
+    };
+
+    std::size_t draws = count;
+    if constexpr (kHasMultiplicity) {
+      draws = 0U;
+      for (const auto multiplicity : range | beluga::views::multiplicities) {
+        draws += static_cast<std::size_t>(multiplicity);
+      }
+    }
+
+    double total_weight = 0.0;
+    for (std::size_t at = 0U; at < count; ++at) {
+      total_weight += effective_weight(at);
+    }
+    assert(total_weight > 0.0);
+
+    // Systematic sweep: the k-th draw targets position (k + u) * W / N in the
+    // cumulative weight profile, so the resulting ancestor array is sorted.
+    auto ancestors = std::vector<std::size_t>(draws);
+    const double step = total_weight / static_cast<double>(draws);
+    const double offset = std::uniform_real_distribution<double>{0.0, 1.0}(engine);
+    double cumulative = effective_weight(0U);
+    std::size_t index = 0U;
+    for (std::size_t draw = 0U; draw < draws; ++draw) {
+      const double position = (static_cast<double>(draw) + offset) * step;
+      while (cumulative < position && index + 1U < count) {
+        ++index;
+        cumulative += effective_weight(index);
+      }
+      ancestors[draw] = index;
+    }
+
+    if constexpr (kHasMultiplicity) {
+      // The sorted ancestor array already carries the duplication structure, so instead
+      // of materializing duplicates the survivors are compacted forward and their draw
+      // counts recorded in the multiplicity column. The i-th distinct ancestor index is
+      // never smaller than i, so the forward compaction only reads rows it has not
+      // written yet. Consumers expand duplicates on demand with beluga::actions::expand.
+      auto first = ranges::begin(range);
+      using difference_type = ranges::range_difference_t<Range>;
+      std::size_t unique_count = 0U;
+      std::size_t draw = 0U;
+      while (draw < draws) {
+        const std::size_t ancestor = ancestors[draw];
+        std::size_t run = 1U;
+        while (draw + run < draws && ancestors[draw + run] == ancestor) {
+          ++run;
+        }
+        if (unique_count != ancestor) {
+          *(first + static_cast<difference_type>(unique_count)) = *(first + static_cast<difference_type>(ancestor));
+        }
+        auto multiplicities = range | beluga::views::multiplicities;
+        multiplicities.begin()[static_cast<difference_type>(unique_count)] = beluga::Multiplicity{run};
+        ++unique_count;
+        draw += run;
+      }
+      range.resize(unique_count);
+      reset_weights(range);
+    } else {
+      if constexpr (has_apply_ancestry_v<Range>) {
+        // Containers that know their own storage layout (e.g. TupleContainer) reorder
+        // column by column, covering cold columns that iteration does not expose.
+        range.apply_ancestry(ancestors);
+      } else {
+        apply_ancestry(range, ancestors);
+      }
+      reset_weights(range);
+    }
+
+    BELUGA_TRACEPOINT(resample_end);
+    return range;
+  }
+
+  /// Overload that uses a default random engine.
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range& range) const -> Range& {
+    return (*this)(range, ranges::detail::get_random_engine());
+  }
+
+ private:
+  /// Resets every weight in the range to one.
+  /**
+   * Containers that expose a lazy constant fill over their weight column (see
+   * `beluga::TupleContainer::fill_column`) only record the reset, turning the
+   * O(N) weight column rewrite after every resample into O(1); other ranges get
+   * the eager fill.
+   */
+  template <class Range>
+  static constexpr void reset_weights(Range& range) {
+    if constexpr (has_weight_fill_column_v<Range>) {
+      range.template fill_column<tuple_index_v<beluga::Weight, ranges::range_value_t<Range>>>(beluga::Weight{1.0});
+    } else {
+      ranges::fill(range | beluga::views::weights, 1.0);
+    }
+  }
+
+  /// Applies a sorted ancestor index array in place through the range iterator.
+  /**
+   * Slots whose ancestor lies to the right read sources that the forward sweep has
+   * not written yet; slots whose ancestor lies to the left read sources that the
+   * backward sweep has not written yet. Monotonicity of the ancestor array keeps
+   * both sets of sources disjoint from every written slot.
+   */
+  template <class Range>
+  static constexpr void apply_ancestry(Range& range, const std::vector<std::size_t>& ancestors) {
+    auto first = ranges::begin(range);
+    using difference_type = ranges::range_difference_t<Range>;
+    const std::size_t count = ancestors.size();
+    for (std::size_t index = 0U; index < count; ++index) {
+      const std::size_t ancestor = ancestors[index];
+      if (ancestor > index) {
+        *(first + static_cast<difference_type>(index)) = *(first + static_cast<difference_type>(ancestor));
+      }
+    }
+    for (std::size_t index = count; index-- > 0U;) {
+      const std::size_t ancestor = ancestors[index];
+      if (ancestor < index) {
+        *(first + static_cast<difference_type>(index)) = *(first + static_cast<difference_type>(ancestor));
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// resamples a particle range in place with systematic resampling.
+/**
+ * This action replaces the particle population with one drawn from the current weight
+ * distribution, without materializing a sampled view: ancestor indices are computed
+ * first, then applied as an in-place permutation-with-duplication that only moves
+ * particles whose slots actually change. Weights are reset to one, lazily when the
+ * container supports it.
+ */
+inline constexpr ranges::actions::action_closure<detail::resample_fn> resample;
+
+}  // namespace beluga::actions
+
+#endif
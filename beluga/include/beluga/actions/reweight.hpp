@@ -16,9 +16,14 @@
 #define BELUGA_ACTIONS_REWEIGHT_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <execution>
+#include <vector>
 
+#include <beluga/algorithm/effective_sample_size.hpp>
+#include <beluga/type_traits/executor_traits.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/tracepoints.hpp>
 #include <beluga/views/particles.hpp>
 
 #include <range/v3/action/action.hpp>
@@ -34,19 +39,43 @@ namespace beluga::actions {
 
 namespace detail {
 
+/// \cond detail
+
+template <class Model, class States, class Weights, class = void>
+struct is_batch_weighting_function : std::false_type {};
+
+template <class Model, class States, class Weights>
+struct is_batch_weighting_function<
+    Model,
+    States,
+    Weights,
+    std::enable_if_t<
+        std::is_void_v<decltype(std::declval<Model&>()(std::declval<States&>(), std::declval<Weights&>()))>>>
+    : std::true_type {};
+
+/// \endcond
+
 /// Implementation detail for a reweight range adaptor object.
 struct reweight_base_fn {
   /// Overload that implements the reweight algorithm.
   /**
    * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
    * \tparam Range An [input range](https://en.cppreference.com/w/cpp/ranges/input_range) of particles.
-   * \tparam Model A callable that can compute the importance weight given a particle state.
+   * \tparam Model A callable that can compute the importance weight given a particle state. Backends
+   * that instead take the whole states and weights ranges, returning void, reweight all particles in
+   * a single call.
    * \param policy The execution policy to use.
    * \param range An existing range of particles to apply this action to.
    * \param model A callable instance to compute the weights given the particle states.
    *
    * For each particle, we multiply the current weight by the new importance weight to accumulate information from
    * sensor updates.
+   *
+   * Batch backends own their iteration: they can stream state batches out of the SoA
+   * columns to wherever the likelihood kernel runs — a vectorized sweep, or a device
+   * that holds the map uploaded once per map update — and write the accumulated
+   * weights back, overlapping transfers with evaluation internally. The execution
+   * policy does not apply to them.
    */
   template <
       class ExecutionPolicy,
@@ -56,15 +85,104 @@ struct reweight_base_fn {
       std::enable_if_t<ranges::range<Range>, int> = 0>
   constexpr auto operator()(ExecutionPolicy&& policy, Range& range, Model model) const -> Range& {
     static_assert(beluga::is_particle_range_v<Range>);
+    BELUGA_TRACEPOINT(reweight_begin);
     auto states = range | beluga::views::states | ranges::views::common;
     auto weights = range | beluga::views::weights | ranges::views::common;
-    std::transform(
-        policy,               //
-        std::begin(states),   //
-        std::end(states),     //
-        std::begin(weights),  //
-        std::begin(weights),  //
-        [model = std::move(model)](const auto& s, auto w) { return w * model(s); });
+    if constexpr (is_batch_weighting_function<Model, decltype(states), decltype(weights)>::value) {
+      model(states, weights);
+    } else {
+      std::transform(
+          policy,               //
+          std::begin(states),   //
+          std::end(states),     //
+          std::begin(weights),  //
+          std::begin(weights),  //
+          [model = std::move(model)](const auto& s, auto w) { return w * model(s); });
+    }
+    BELUGA_TRACEPOINT(reweight_end);
+    return range;
+  }
+
+  /// Overload that uses a bulk executor instead of an execution policy.
+  /**
+   * \tparam Executor A type satisfying \ref beluga::is_bulk_executor.
+   * \param statistics Optional weight statistics accumulated in the same sweep.
+   *
+   * When `statistics` is given, each chunk of the partition accumulates its weight sum and
+   * squared sum in a dedicated cache-line-padded slot, so the whole reweight plus reduction
+   * costs a single synchronization. Normalization is not performed; consumers can apply the
+   * published total lazily through the factor parameter of `beluga::actions::normalize`, or
+   * skip the scaling sweep entirely and work with the unnormalized total.
+   *
+   * Batch weighting backends bypass the executor entirely, since they own their
+   * iteration; requested statistics are then reduced on the caller thread.
+   */
+  template <
+      class Executor,
+      class Range,
+      class Model,
+      std::enable_if_t<beluga::is_bulk_executor_v<std::decay_t<Executor>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Executor executor, Range& range, Model model, WeightStatistics* statistics = nullptr)
+      const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    BELUGA_TRACEPOINT(reweight_begin);
+    using States = decltype(range | beluga::views::states | ranges::views::common);
+    using Weights = decltype(range | beluga::views::weights | ranges::views::common);
+    if constexpr (is_batch_weighting_function<Model, States, Weights>::value) {
+      auto states = range | beluga::views::states | ranges::views::common;
+      auto weights = range | beluga::views::weights | ranges::views::common;
+      model(states, weights);
+      if (statistics != nullptr) {
+        statistics->total_weight = 0.0;
+        statistics->squared_total_weight = 0.0;
+        statistics->sample_count = 0;
+        for (const double weight : weights) {
+          statistics->total_weight += weight;
+          statistics->squared_total_weight += weight * weight;
+          ++statistics->sample_count;
+        }
+      }
+    } else if (statistics == nullptr) {
+      executor.bulk_execute(range, [&model](auto&& particle) {
+        beluga::weight(particle) = beluga::weight(particle) * model(beluga::state(particle));
+      });
+    } else {
+      // One padded slot per thread keeps neighbouring accumulators on separate
+      // cache lines, so chunks never contend while summing. Under work-stealing
+      // scheduling a slot combines every chunk its thread claims.
+      struct alignas(64) ChunkAccumulator {
+        double total = 0.0;
+        double total_of_squares = 0.0;
+        std::size_t count = 0;
+      };
+      auto accumulators = std::vector<ChunkAccumulator>(executor.thread_count());
+      executor.bulk_execute_chunks(range, [&model, &accumulators](auto first, auto last, std::size_t index) {
+        double total = 0.0;
+        double total_of_squares = 0.0;
+        std::size_t count = 0;
+        for (; first != last; ++first) {
+          auto&& particle = *first;
+          const double weight = beluga::weight(particle) * model(beluga::state(particle));
+          beluga::weight(particle) = weight;
+          total += weight;
+          total_of_squares += weight * weight;
+          ++count;
+        }
+        accumulators[index].total += total;
+        accumulators[index].total_of_squares += total_of_squares;
+        accumulators[index].count += count;
+      });
+      statistics->total_weight = 0.0;
+      statistics->squared_total_weight = 0.0;
+      statistics->sample_count = 0;
+      for (const auto& accumulator : accumulators) {
+        statistics->total_weight += accumulator.total;
+        statistics->squared_total_weight += accumulator.total_of_squares;
+        statistics->sample_count += accumulator.count;
+      }
+    }
+    BELUGA_TRACEPOINT(reweight_end);
     return range;
   }
 
@@ -74,16 +192,42 @@ struct reweight_base_fn {
       class Model,
       class ExecutionPolicy,
       std::enable_if_t<ranges::range<Range>, int> = 0,
-      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
   constexpr auto operator()(Range&& range, Model model, ExecutionPolicy policy) const -> Range& {
     return (*this)(std::move(policy), std::forward<Range>(range), std::move(model));
   }
 
+  /// Overload that re-orders arguments from a view closure, with weight statistics.
+  template <
+      class Range,
+      class Model,
+      class Executor,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<beluga::is_bulk_executor_v<Executor>, int> = 0>
+  constexpr auto operator()(Range&& range, Model model, WeightStatistics* statistics, Executor executor) const
+      -> Range& {
+    return (*this)(std::move(executor), std::forward<Range>(range), std::move(model), statistics);
+  }
+
   /// Overload that returns a view closure to compose with other views.
-  template <class ExecutionPolicy, class Model, std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  template <
+      class ExecutionPolicy,
+      class Model,
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
   constexpr auto operator()(ExecutionPolicy policy, Model model) const {
     return ranges::make_action_closure(ranges::bind_back(reweight_base_fn{}, std::move(model), std::move(policy)));
   }
+
+  /// Overload that returns a view closure to compose with other views, with weight statistics.
+  template <class Executor, class Model, std::enable_if_t<beluga::is_bulk_executor_v<Executor>, int> = 0>
+  constexpr auto operator()(Executor executor, Model model, WeightStatistics* statistics) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(reweight_base_fn{}, std::move(model), statistics, std::move(executor)));
+  }
 };
 
 /// Implementation detail for a reweight range adaptor object with a default execution policy.
@@ -111,6 +255,12 @@ struct reweight_fn : public reweight_base_fn {
  * This action updates particle weights by importance weight multiplication.
  * These importance weights are computed by a given measurement likelihood
  * function (or sensor model) for current particle states.
+ *
+ * Besides per-state likelihood functions, the action accepts batch weighting
+ * backends: callables taking the whole states and weights ranges and returning
+ * void. Such a backend owns its iteration, which is the dispatch seam for
+ * offloading the likelihood kernel wholesale — e.g. to a device that keeps the
+ * map resident and streams particle state batches through it.
  */
 inline constexpr detail::reweight_fn reweight;
 
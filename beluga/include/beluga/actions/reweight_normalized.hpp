@@ -0,0 +1,309 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_REWEIGHT_NORMALIZED_HPP
+#define BELUGA_ACTIONS_REWEIGHT_NORMALIZED_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <limits>
+#include <numeric>
+
+#include <beluga/actions/reweight.hpp>
+#include <beluga/algorithm/effective_sample_size.hpp>
+#include <beluga/type_traits/executor_traits.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/range/operations.hpp>
+#include <range/v3/view/common.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the reweight_normalized range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// Implementation detail for a reweight_normalized range adaptor object.
+struct reweight_normalized_base_fn {
+  /// Overload that implements the fused reweight + normalize algorithm.
+  /**
+   * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+   * \tparam Range An [input range](https://en.cppreference.com/w/cpp/ranges/input_range) of particles.
+   * \tparam Model A callable that can compute the importance weight given a particle state.
+   * \param policy The execution policy to use.
+   * \param range An existing range of particles to apply this action to.
+   * \param model A callable instance to compute the weights given the particle states.
+   *
+   * \param statistics Optional weight statistics accumulated in the same sweep, so
+   * consumers can read the effective sample size without another pass over the weights.
+   *
+   * Equivalent to `beluga::actions::reweight` followed by `beluga::actions::normalize`,
+   * but the importance weights and their running sum are computed in the same sweep,
+   * saving one full memory-bound pass over the weight column per update.
+   *
+   * Batch weighting backends, as accepted by `beluga::actions::reweight`, are handed
+   * the whole states and weights ranges in a single call and own their iteration;
+   * the weight totals are then reduced in a separate pass.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      class Model,
+      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy&& policy, Range& range, Model model, WeightStatistics* statistics = nullptr)
+      const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    auto states = range | beluga::views::states | ranges::views::common;
+    auto weights = range | beluga::views::weights | ranges::views::common;
+
+    double total = 0.0;
+    double total_of_squares = 0.0;
+    std::size_t count = 0;
+    if constexpr (is_batch_weighting_function<Model, decltype(states), decltype(weights)>::value) {
+      model(states, weights);
+      total = std::transform_reduce(
+          policy, std::begin(weights), std::end(weights), 0.0, std::plus<>{},
+          [](const auto w) { return static_cast<double>(w); });
+      if (statistics != nullptr) {
+        total_of_squares = std::transform_reduce(
+            policy, std::begin(weights), std::end(weights), 0.0, std::plus<>{},
+            [](const auto w) { return static_cast<double>(w) * static_cast<double>(w); });
+        count = static_cast<std::size_t>(ranges::distance(weights));
+      }
+    } else if constexpr (std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>) {
+      // Single fused sweep: compute importance weights and accumulate their sums.
+      auto weight_it = std::begin(weights);
+      for (auto&& state : states) {
+        const double weight = *weight_it * model(state);
+        *weight_it = static_cast<beluga::underlying_numeric_t<decltype(*weight_it)>>(weight);
+        total += weight;
+        total_of_squares += weight * weight;
+        ++count;
+        ++weight_it;
+      }
+    } else {
+      // Parallel and unsequenced policies cannot accumulate from within the
+      // transform without synchronization, so reweight and reduce run as
+      // separate sweeps under the requested policy.
+      std::transform(
+          policy,               //
+          std::begin(states),   //
+          std::end(states),     //
+          std::begin(weights),  //
+          std::begin(weights),  //
+          [&model](const auto& s, auto w) {
+            return static_cast<beluga::underlying_numeric_t<decltype(w)>>(w * model(s));
+          });
+      total = std::transform_reduce(
+          policy, std::begin(weights), std::end(weights), 0.0, std::plus<>{},
+          [](const auto w) { return static_cast<double>(w); });
+      if (statistics != nullptr) {
+        total_of_squares = std::transform_reduce(
+            policy, std::begin(weights), std::end(weights), 0.0, std::plus<>{},
+            [](const auto w) { return static_cast<double>(w) * static_cast<double>(w); });
+        count = static_cast<std::size_t>(ranges::distance(weights));
+      }
+    }
+
+    if (statistics != nullptr) {
+      statistics->sample_count = count;
+    }
+
+    if (std::abs(total - 1.0) < std::numeric_limits<double>::epsilon()) {
+      if (statistics != nullptr) {
+        statistics->total_weight = total;
+        statistics->squared_total_weight = total_of_squares;
+      }
+      return range;  // No change.
+    }
+
+    if (statistics != nullptr && total != 0.0) {
+      // Keep the statistics consistent with the weights as stored after scaling.
+      statistics->total_weight = 1.0;
+      statistics->squared_total_weight = total_of_squares / (total * total);
+    }
+
+    std::transform(
+        policy,               //
+        std::begin(weights),  //
+        std::end(weights),    //
+        std::begin(weights),  //
+        [total](const auto w) { return static_cast<beluga::underlying_numeric_t<decltype(w)>>(w / total); });
+
+    return range;
+  }
+
+  /// Overload that uses a bulk executor instead of an execution policy.
+  /**
+   * \tparam Executor A type satisfying \ref beluga::is_bulk_executor.
+   *
+   * The reweight and scaling sweeps are partitioned across the executor;
+   * the reduction in between runs on the caller thread.
+   */
+  template <
+      class Executor,
+      class Range,
+      class Model,
+      std::enable_if_t<beluga::is_bulk_executor_v<std::decay_t<Executor>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Executor executor, Range& range, Model model, WeightStatistics* statistics = nullptr) const
+      -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    using States = decltype(range | beluga::views::states | ranges::views::common);
+    auto weights = range | beluga::views::weights | ranges::views::common;
+    if constexpr (is_batch_weighting_function<Model, States, decltype(weights)>::value) {
+      auto states = range | beluga::views::states | ranges::views::common;
+      model(states, weights);
+    } else {
+      executor.bulk_execute(range, [&model](auto&& particle) {
+        auto&& weight = beluga::weight(particle);
+        weight = static_cast<beluga::underlying_numeric_t<decltype(weight)>>(weight * model(beluga::state(particle)));
+      });
+    }
+
+    double total = 0.0;
+    double total_of_squares = 0.0;
+    std::size_t count = 0;
+    for (const double weight : weights) {
+      total += weight;
+      total_of_squares += weight * weight;
+      ++count;
+    }
+
+    if (statistics != nullptr) {
+      statistics->sample_count = count;
+    }
+
+    if (std::abs(total - 1.0) < std::numeric_limits<double>::epsilon()) {
+      if (statistics != nullptr) {
+        statistics->total_weight = total;
+        statistics->squared_total_weight = total_of_squares;
+      }
+      return range;  // No change.
+    }
+
+    if (statistics != nullptr && total != 0.0) {
+      // Keep the statistics consistent with the weights as stored after scaling.
+      statistics->total_weight = 1.0;
+      statistics->squared_total_weight = total_of_squares / (total * total);
+    }
+
+    executor.bulk_execute(weights, [total](auto&& weight) {
+      weight = static_cast<beluga::underlying_numeric_t<decltype(weight)>>(weight / total);
+    });
+    return range;
+  }
+
+  /// Overload that re-orders arguments from a view closure.
+  template <
+      class Range,
+      class Model,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
+  constexpr auto operator()(Range&& range, Model model, ExecutionPolicy policy) const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(model));
+  }
+
+  /// Overload that re-orders arguments from a view closure, with weight statistics.
+  template <
+      class Range,
+      class Model,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
+  constexpr auto operator()(Range&& range, Model model, WeightStatistics* statistics, ExecutionPolicy policy) const
+      -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(model), statistics);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <
+      class ExecutionPolicy,
+      class Model,
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, Model model) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(reweight_normalized_base_fn{}, std::move(model), std::move(policy)));
+  }
+
+  /// Overload that returns a view closure to compose with other views, with weight statistics.
+  template <
+      class ExecutionPolicy,
+      class Model,
+      std::enable_if_t<
+          std::is_execution_policy_v<ExecutionPolicy> || beluga::is_bulk_executor_v<ExecutionPolicy>,
+          int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, Model model, WeightStatistics* statistics) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(reweight_normalized_base_fn{}, std::move(model), statistics, std::move(policy)));
+  }
+};
+
+/// Implementation detail for a reweight_normalized range adaptor object with a default execution policy.
+struct reweight_normalized_fn : public reweight_normalized_base_fn {
+  using reweight_normalized_base_fn::operator();
+
+  /// Overload that defines a default execution policy.
+  template <class Range, class Model, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, Model model) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(model));
+  }
+
+  /// Overload that defines a default execution policy, with weight statistics.
+  template <class Range, class Model, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, Model model, WeightStatistics* statistics) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(model), statistics);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <class Model>
+  constexpr auto operator()(Model model) const {
+    return ranges::make_action_closure(ranges::bind_back(reweight_normalized_fn{}, std::move(model)));
+  }
+
+  /// Overload that returns a view closure to compose with other views, with weight statistics.
+  template <class Model>
+  constexpr auto operator()(Model model, WeightStatistics* statistics) const {
+    return ranges::make_action_closure(ranges::bind_back(reweight_normalized_fn{}, std::move(model), statistics));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// can update and normalize the weights in a particle range using a sensor model.
+/**
+ * Fused equivalent of `beluga::actions::reweight` piped into `beluga::actions::normalize`:
+ * importance weights are multiplied in and their total accumulated in one sweep, and the
+ * normalization factor is applied in the write-back sweep.
+ */
+inline constexpr detail::reweight_normalized_fn reweight_normalized;
+
+}  // namespace beluga::actions
+
+#endif
@@ -0,0 +1,189 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_REWEIGHT_TRUNCATED_HPP
+#define BELUGA_ACTIONS_REWEIGHT_TRUNCATED_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+#include <beluga/actions/reweight.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/view/common.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the reweight_truncated range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// Implementation detail for a reweight_truncated range adaptor object.
+struct reweight_truncated_base_fn {
+  /// Overload that implements the two-tier reweight algorithm.
+  /**
+   * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+   * \tparam Range A [random access range](https://en.cppreference.com/w/cpp/ranges/random_access_range) of particles.
+   * \tparam ProxyModel A cheap callable that approximates the importance weight given a particle state.
+   * \tparam Model A callable that can compute the importance weight given a particle state.
+   * \param policy The execution policy to use for the proxy sweep.
+   * \param range An existing range of particles to apply this action to.
+   * \param proxy_model A cheap approximation of `model`, evaluated for every particle.
+   * \param model The expensive model, evaluated only for the top fraction of particles by proxy likelihood.
+   * \param fraction Fraction of the particle set to evaluate with the expensive model, in (0, 1].
+   *
+   * The proxy likelihood is computed for every particle and used to select the top
+   * fraction, which is then reweighted with the expensive model. The remaining
+   * particles are reweighted with their proxy likelihood rescaled by the ratio of
+   * expensive to proxy likelihood mass over the evaluated subset, so the tail keeps
+   * the proxy's relative ordering on the expensive model's likelihood scale and the
+   * total importance mass stays consistent between the two tiers.
+   *
+   * This is a bounded approximation: it assumes most posterior mass concentrates in
+   * the evaluated subset, which holds for a converged filter but not during global
+   * localization. A fraction of one is equivalent to `beluga::actions::reweight`.
+   *
+   * Unlike `beluga::actions::reweight`, there is no bulk executor overload: the
+   * selection stage is sequential and the subset evaluation is index-scattered.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      class ProxyModel,
+      class Model,
+      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      ExecutionPolicy&& policy,
+      Range& range,
+      ProxyModel proxy_model,
+      Model model,
+      double fraction) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    auto states = range | beluga::views::states | ranges::views::common;
+    auto weights = range | beluga::views::weights | ranges::views::common;
+    const auto size = static_cast<std::size_t>(ranges::distance(states));
+
+    const auto count = std::min(
+        size, std::max<std::size_t>(1UL, static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(size)))));
+    if (count == size) {
+      return beluga::actions::reweight(std::forward<ExecutionPolicy>(policy), range, std::move(model));
+    }
+
+    // First tier: proxy likelihoods for every particle.
+    auto proxy = std::vector<double>(size);
+    std::transform(policy, std::begin(states), std::end(states), proxy.begin(), [&proxy_model](const auto& s) {
+      return static_cast<double>(proxy_model(s));
+    });
+
+    // Select the top subset by proxy likelihood without a full sort.
+    auto order = std::vector<std::size_t>(size);
+    std::iota(order.begin(), order.end(), 0UL);
+    std::nth_element(
+        order.begin(), order.begin() + static_cast<std::ptrdiff_t>(count - 1), order.end(),
+        [&proxy](std::size_t lhs, std::size_t rhs) { return proxy[lhs] > proxy[rhs]; });
+
+    // Second tier: expensive model over the selected subset, accumulating the
+    // likelihood mass of both models to calibrate the proxy scale.
+    const auto state_begin = std::begin(states);
+    const auto weight_begin = std::begin(weights);
+    double evaluated_mass = 0.0;
+    double proxy_mass = 0.0;
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto index = static_cast<std::ptrdiff_t>(order[i]);
+      const double likelihood = static_cast<double>(model(state_begin[index]));
+      weight_begin[index] = weight_begin[index] * likelihood;
+      evaluated_mass += likelihood;
+      proxy_mass += proxy[order[i]];
+    }
+
+    // Correction for the tail: proxy likelihoods rescaled to the expensive model's
+    // likelihood scale as measured over the evaluated subset.
+    const double calibration = proxy_mass > 0.0 ? evaluated_mass / proxy_mass : 1.0;
+    for (std::size_t i = count; i < size; ++i) {
+      const auto index = static_cast<std::ptrdiff_t>(order[i]);
+      weight_begin[index] = weight_begin[index] * (proxy[order[i]] * calibration);
+    }
+    return range;
+  }
+
+  /// Overload that re-orders arguments from a view closure.
+  template <
+      class Range,
+      class ProxyModel,
+      class Model,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(Range&& range, ProxyModel proxy_model, Model model, double fraction, ExecutionPolicy policy)
+      const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(proxy_model), std::move(model), fraction);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <
+      class ExecutionPolicy,
+      class ProxyModel,
+      class Model,
+      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, ProxyModel proxy_model, Model model, double fraction) const {
+    return ranges::make_action_closure(ranges::bind_back(
+        reweight_truncated_base_fn{}, std::move(proxy_model), std::move(model), fraction, std::move(policy)));
+  }
+};
+
+/// Implementation detail for a reweight_truncated range adaptor object with a default execution policy.
+struct reweight_truncated_fn : public reweight_truncated_base_fn {
+  using reweight_truncated_base_fn::operator();
+
+  /// Overload that defines a default execution policy.
+  template <class Range, class ProxyModel, class Model, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, ProxyModel proxy_model, Model model, double fraction) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(proxy_model), std::move(model), fraction);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <class ProxyModel, class Model, std::enable_if_t<!ranges::range<ProxyModel>, int> = 0>
+  constexpr auto operator()(ProxyModel proxy_model, Model model, double fraction) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(reweight_truncated_fn{}, std::move(proxy_model), std::move(model), fraction));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// can update the weights in a particle range using a cheap proxy model to gate an expensive one.
+/**
+ * This action evaluates a cheap proxy likelihood for every particle and runs the
+ * expensive sensor model only on the top fraction of particles by proxy likelihood,
+ * applying a calibrated proxy-based correction to the rest. Meant for converged
+ * steady-state operation with expensive models (e.g. NDT or beam models), where most
+ * posterior mass concentrates in a small subset of the particles.
+ */
+inline constexpr detail::reweight_truncated_fn reweight_truncated;
+
+}  // namespace beluga::actions
+
+#endif
@@ -15,8 +15,28 @@
 #ifndef BELUGA_ALGORITHM_AMCL_CORE_HPP
 #define BELUGA_ALGORITHM_AMCL_CORE_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <execution>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
+#include <random>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -24,12 +44,60 @@
 #include <beluga/beluga.hpp>
 
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/utility/random.hpp>
 #include <range/v3/view/any_view.hpp>
 #include <range/v3/view/take_exactly.hpp>
 #include "beluga/policies/on_motion.hpp"
+#include "beluga/utility/memory_hints.hpp"
 
 namespace beluga {
 
+namespace detail {
+
+/// \cond detail
+
+template <class Distribution, class State, class = void>
+struct has_batched_sampling : std::false_type {};
+
+template <class Distribution, class State>
+struct has_batched_sampling<
+    Distribution,
+    State,
+    std::void_t<decltype(std::declval<Distribution&>().sample_n(
+        std::declval<std::mt19937&>(),
+        std::declval<std::back_insert_iterator<std::vector<State>>>(),
+        std::size_t{}))>> : std::true_type {};
+
+template <class SensorModel>
+struct is_fused_sensor_model : std::false_type {};
+
+template <class... SensorModels>
+struct is_fused_sensor_model<std::tuple<SensorModels...>> : std::true_type {};
+
+/// Traits mapping a sensor model to the filter-facing types it induces.
+template <class SensorModel>
+struct amcl_sensor_model_traits {
+  using state_type = typename SensorModel::state_type;
+  using measurement_type = typename SensorModel::measurement_type;
+  using map_type = typename SensorModel::map_type;
+};
+
+/// Specialization for a tuple of fused sensor models: one measurement and one map per model.
+template <class FirstSensorModel, class... RestSensorModels>
+struct amcl_sensor_model_traits<std::tuple<FirstSensorModel, RestSensorModels...>> {
+  static_assert(
+      (std::is_same_v<typename FirstSensorModel::state_type, typename RestSensorModels::state_type> && ...),
+      "Fused sensor models must share the same state type");
+  using state_type = typename FirstSensorModel::state_type;
+  using measurement_type =
+      std::tuple<typename FirstSensorModel::measurement_type, typename RestSensorModels::measurement_type...>;
+  using map_type = std::tuple<typename FirstSensorModel::map_type, typename RestSensorModels::map_type...>;
+};
+
+/// \endcond
+
+}  // namespace detail
+
 /// Struct containing parameters for the Adaptive Monte Carlo Localization (AMCL) implementation.
 struct AmclParams {
   /// Min distance in meters between updates.
@@ -52,12 +120,90 @@ struct AmclParams {
   double kld_epsilon = 0.05;
   /// Used as part of the kld sampling mechanism.
   double kld_z = 3.0;
+  /// Wall time budget for a single filter update, in seconds. When positive, the filter
+  /// modulates the effective maximum number of particles handed to the KLD limiter so the
+  /// measured update time tracks the budget, shrinking the population under compute load
+  /// and growing it back up to `max_particles` when there is headroom. Non-positive
+  /// values disable the controller.
+  double update_latency_budget = 0.0;
+  /// Normalized weight threshold below which particles are pruned ahead of an update.
+  /// Near-zero-weight particles that survive in between resamples still pay full motion
+  /// and sensor model cost on every update; pruning compacts them away before those
+  /// stages run. Right after a resample the weights are uniform, so pruning only takes
+  /// effect on the iterations in between resamples. Non-positive values disable pruning.
+  double prune_epsilon = 0.0;
+  /// Whether to run measurement preprocessing concurrently with motion propagation.
+  /// Conditioning the sensor model on the measurement (scan materialization, detection
+  /// batching) only touches the measurement, while propagation only touches the particle
+  /// states, so the two stages are independent and can overlap; the update joins them
+  /// before the reweight sweep. Note this keeps propagate and reweight as separate
+  /// passes, so it trades the fused single-sweep backend for the overlap; worthwhile
+  /// when measurement preprocessing is comparable in cost to propagation.
+  bool overlap_measurement_preprocessing = false;
+};
+
+/// Per-update statistics handed to the \ref Amcl instrumentation hook.
+struct AmclUpdateInstrumentation {
+  /// Wall time spent propagating particles through the motion model.
+  std::chrono::steady_clock::duration propagate_duration{};
+  /// Wall time spent reweighting particles against the measurement.
+  std::chrono::steady_clock::duration reweight_duration{};
+  /// Wall time spent resampling; zero when the resample policy skipped resampling.
+  std::chrono::steady_clock::duration resample_duration{};
+  /// Number of particles after the update.
+  std::size_t particle_count = 0;
+  /// Effective sample size accumulated during the reweight sweep.
+  double effective_sample_size = 0.0;
+  /// Probability of inserting a random particle during resampling, as computed by the recovery estimator.
+  double random_state_probability = 0.0;
+  /// Smoothed long-term average weight tracked by the recovery estimator.
+  double recovery_slow_average = 0.0;
+  /// Smoothed short-term average weight tracked by the recovery estimator.
+  double recovery_fast_average = 0.0;
+  /// Minor (soft) page faults taken by the process over the update.
+  /**
+   * A nonzero count on the first updates after a map load means map pages were
+   * faulted in on the hot path; see beluga::MemoryHints::prefault.
+   */
+  std::int64_t minor_page_faults = 0;
+  /// Major (hard) page faults taken by the process over the update.
+  /**
+   * Nonzero counts in steady state mean map or particle pages were evicted and
+   * re-read from the backing store; see beluga::MemoryHints::lock_in_memory.
+   */
+  std::int64_t major_page_faults = 0;
+  /// Whether the resample stage ran.
+  bool resampled = false;
+};
+
+/// Tag type disabling \ref Amcl instrumentation. All stage bookkeeping compiles out.
+struct NoInstrumentation {};
+
+/// Path statistics accumulated from high-rate odometry samples between filter updates.
+/**
+ * Fed through \ref Amcl::accumulate_control. Unlike the endpoint delta seen by the
+ * control window, these track the path actually traveled, so motion that cancels out
+ * between updates (e.g. a robot wiggling in place) is not invisible to update gating
+ * or to noise-aware consumers.
+ */
+struct AmclControlAccumulation {
+  /// Total translation path length over the accumulated samples, in meters.
+  double distance_traveled = 0.0;
+  /// Total unsigned rotation over the accumulated samples, in radians.
+  double angle_turned = 0.0;
+  /// Number of accumulated odometry samples.
+  std::size_t sample_count = 0;
 };
 
 /// Implementation of the Adaptive Monte Carlo Localization (AMCL) algorithm.
 /**
  * \tparam MotionModel Class representing a motion model. Must satisfy \ref MotionModelPage.
  * \tparam SensorModel Class representing a sensor model. Must satisfy \ref SensorModelPage.
+ * May also be a `std::tuple` of sensor models sharing a state type (e.g. one model per
+ * lidar on a multi-lidar robot); `update()` then takes a tuple with one measurement per
+ * model and fuses them in a single reweight sweep, multiplying per-model likelihoods
+ * into the combined particle weight, and `update_map()` takes a tuple with one map per
+ * model.
  * \tparam RandomStateGenerator A callable able to produce random states, optionally based on the current particles
  * state.
  * Class 'T' is a valid RandomStateGenerator if given 't' a possibly const instance of 'T' any of the following
@@ -66,31 +212,56 @@ struct AmclParams {
  *   representing a random state.
  * - t can be called with `const beluga::TupleVector<ParticleType>&> returning a callable
  *   that can be called without arguments and return an instance of 'SensorModel::state_type'.
- * \tparam WeightT Type to represent a weight of a particle.
+ * \tparam WeightT Type to represent a weight of a particle. Defaults to \ref beluga::Weight;
+ * combined with a single-precision state type (e.g. `Sophus::SE2f`), \ref beluga::WeightF
+ * halves the particle footprint, doubling the particles per cache line in every
+ * memory-bound sweep. Weight totals are still accumulated in double precision.
  * \tparam ParticleType Full particle type, containing state, weight and possibly
  * other information .
- * \tparam ExecutionPolicy Execution policy for particles processing.
+ * \tparam ExecutionPolicy Execution policy for particles processing. Either a standard
+ * execution policy or a bulk executor satisfying \ref beluga::is_bulk_executor, such as
+ * \ref beluga::ThreadPoolExecutor.
+ * \tparam UpdatePolicy Policy type gating filter updates based on the control action.
+ * Defaults to a type-erased policy; a concrete `beluga::policy` composition avoids the
+ * indirect call on every update.
+ * \tparam ResamplePolicy Policy type gating particle resampling. Defaults to a
+ * type-erased policy; a concrete `beluga::policy` composition avoids the indirect call
+ * on every update.
+ * \tparam Instrumentation Callable invoked after every performed update with a
+ * \ref AmclUpdateInstrumentation instance carrying per-stage durations and counters.
+ * Defaults to \ref NoInstrumentation, in which case all stage bookkeeping compiles out.
+ * Configure the hook instance through `instrumentation()`.
  */
 template <
     class MotionModel,
     class SensorModel,
     class RandomStateGenerator,
     typename WeightT = beluga::Weight,
-    class ParticleType = std::tuple<typename SensorModel::state_type, WeightT>,
-    class ExecutionPolicy = std::execution::sequenced_policy>
+    class ParticleType = std::tuple<typename detail::amcl_sensor_model_traits<SensorModel>::state_type, WeightT>,
+    class ExecutionPolicy = std::execution::sequenced_policy,
+    class UpdatePolicy = beluga::any_policy<typename detail::amcl_sensor_model_traits<SensorModel>::state_type>,
+    class ResamplePolicy = beluga::any_policy<beluga::TupleVector<ParticleType>>,
+    class Instrumentation = NoInstrumentation>
 class Amcl {
   static_assert(
       std::is_same_v<ExecutionPolicy, std::execution::parallel_policy> or
-      std::is_same_v<ExecutionPolicy, std::execution::sequenced_policy>);
+      std::is_same_v<ExecutionPolicy, std::execution::sequenced_policy> or
+      std::is_same_v<ExecutionPolicy, std::execution::parallel_unsequenced_policy> or
+      std::is_same_v<ExecutionPolicy, std::execution::unsequenced_policy> or
+      beluga::is_bulk_executor_v<ExecutionPolicy>);
+
+  static constexpr bool kFusedSensorModels = detail::is_fused_sensor_model<SensorModel>::value;
 
   using particle_type = ParticleType;
-  using measurement_type = typename SensorModel::measurement_type;
-  using state_type = typename SensorModel::state_type;
-  using map_type = typename SensorModel::map_type;
+  using measurement_type = typename detail::amcl_sensor_model_traits<SensorModel>::measurement_type;
+  using state_type = typename detail::amcl_sensor_model_traits<SensorModel>::state_type;
+  using map_type = typename detail::amcl_sensor_model_traits<SensorModel>::map_type;
   using spatial_hasher_type = spatial_hash<state_type>;
   using random_state_generator_type = RandomStateGenerator;
   using estimation_type = std::invoke_result_t<beluga::detail::estimate_fn, std::vector<state_type>>;
 
+  static constexpr bool kInstrumented = !std::is_same_v<Instrumentation, NoInstrumentation>;
+
  public:
   /// Construct a AMCL instance.
   /**
@@ -115,24 +286,92 @@ class Amcl {
         execution_policy_{std::move(execution_policy)},
         spatial_hasher_{std::move(spatial_hasher)},
         random_probability_estimator_{params_.alpha_slow, params_.alpha_fast},
-        update_policy_{beluga::policies::on_motion<state_type>(params_.update_min_d, params_.update_min_a)},
+        update_policy_{beluga::policies::on_motion<state_type>(
+            static_cast<typename state_type::Scalar>(params_.update_min_d),
+            static_cast<typename state_type::Scalar>(params_.update_min_a))},
         resample_policy_{beluga::policies::every_n(params_.resample_interval)},
         random_state_generator_(std::move(random_state_generator)) {
     if (params_.selective_resampling) {
-      resample_policy_ = resample_policy_ && beluga::policies::on_effective_size_drop;
+      // Read the effective sample size accumulated during the reweight sweep
+      // instead of recomputing it with another full pass over the weights.
+      resample_policy_ = resample_policy_ && beluga::make_policy([statistics = weight_statistics_](const auto& range) {
+        const auto size = static_cast<double>(ranges::size(range));
+        constexpr double kThreshold = beluga::policies::detail::on_effective_size_drop_policy::kDefaultThreshold;
+        return statistics->effective_sample_size() < size * kThreshold;
+      });
     }
   }
 
+  /// Construct an AMCL instance with caller-provided update and resample policies.
+  /**
+   * Overload for statically composed policies: when `UpdatePolicy` and `ResamplePolicy`
+   * are concrete `beluga::policy` compositions instead of the type-erased defaults, the
+   * per-update predicate calls can be fully inlined. Class template argument deduction
+   * will pick up the concrete policy types from the arguments.
+   *
+   * \param motion_model Motion model instance.
+   * \param sensor_model Sensor model Instance.
+   * \param random_state_generator A callable able to produce random states, optionally based on the current particles
+   * state.
+   * \param spatial_hasher A spatial hasher instance capable of computing a hash out of a particle state.
+   * \param update_policy Policy gating filter updates, evaluated with the control action.
+   * \param resample_policy Policy gating particle resampling, evaluated with the particle set.
+   * Note `AmclParams::selective_resampling` is ignored by this overload; compose the
+   * equivalent predicate into `resample_policy` instead.
+   * \param params Parameters for AMCL implementation.
+   * \param execution_policy Policy to use when processing particles.
+   */
+  Amcl(
+      MotionModel motion_model,
+      SensorModel sensor_model,
+      RandomStateGenerator random_state_generator,
+      spatial_hasher_type spatial_hasher,
+      UpdatePolicy update_policy,
+      ResamplePolicy resample_policy,
+      const AmclParams& params = AmclParams{},
+      ExecutionPolicy execution_policy = std::execution::seq)
+      : params_{params},
+        motion_model_{std::move(motion_model)},
+        sensor_model_{std::move(sensor_model)},
+        execution_policy_{std::move(execution_policy)},
+        spatial_hasher_{std::move(spatial_hasher)},
+        random_probability_estimator_{params_.alpha_slow, params_.alpha_fast},
+        update_policy_{std::move(update_policy)},
+        resample_policy_{std::move(resample_policy)},
+        random_state_generator_(std::move(random_state_generator)) {}
+
   /// Returns a reference to the current set of particles.
   [[nodiscard]] const auto& particles() const { return particles_; }
 
+  /// Returns the weight statistics accumulated during the last reweight sweep.
+  [[nodiscard]] const beluga::WeightStatistics& weight_statistics() const { return *weight_statistics_; }
+
   /// Initialize particles using a custom distribution.
+  /**
+   * Distributions that provide a batched `sample_n()` member (such as
+   * beluga::MultivariateNormalDistribution) generate the whole particle set in one
+   * batch instead of one sample at a time.
+   */
   template <class Distribution>
   void initialize(Distribution distribution) {
-    particles_ = beluga::views::sample(std::move(distribution)) |                    //
-                 ranges::views::transform(beluga::make_from_state<particle_type>) |  //
-                 ranges::views::take_exactly(params_.max_particles) |                //
-                 ranges::to<beluga::TupleVector>;
+    if constexpr (detail::has_batched_sampling<Distribution, state_type>::value) {
+      auto states = std::vector<state_type>{};
+      states.reserve(params_.max_particles);
+      distribution.sample_n(ranges::detail::get_random_engine(), std::back_inserter(states), params_.max_particles);
+      particles_ = states |                                                            //
+                   ranges::views::transform(beluga::make_from_state<particle_type>) |  //
+                   ranges::to<beluga::TupleVector>;
+    } else {
+      particles_ = beluga::views::sample(std::move(distribution)) |                    //
+                   ranges::views::transform(beluga::make_from_state<particle_type>) |  //
+                   ranges::views::take_exactly(params_.max_particles) |                //
+                   ranges::to<beluga::TupleVector>;
+    }
+    particles_.reserve(params_.max_particles);
+    scratch_particles_.reserve(params_.max_particles);
+    arena_buffer_.resize(params_.max_particles * kArenaBytesPerParticle);
+    effective_max_particles_ = params_.max_particles;
+    estimate_.reset();
     force_update_ = true;
   }
 
@@ -146,8 +385,39 @@ class Amcl {
     initialize(beluga::MultivariateNormalDistribution{pose, covariance});
   }
 
-  /// Update the map used for localization.
-  void update_map(map_type map) { sensor_model_.update_map(std::move(map)); }
+  /// Accumulates a high-rate odometry sample between filter updates.
+  /**
+   * Cheap enough to call at full odometry rate: one relative-pose composition and two
+   * norms, with no particle work. The control window already integrates motion exactly
+   * through absolute endpoint poses; what intermediate samples add is the traveled-path
+   * statistics, which the next `update()` uses as an additional gating trigger against
+   * `AmclParams::update_min_d` / `update_min_a` (so in-place wiggling is not mistaken
+   * for standing still) and which remain readable through `control_accumulation()`
+   * until consumed by a performed update.
+   *
+   * \param control_action Odometry sample, in the same frame as the `update()` control actions.
+   */
+  void accumulate_control(const state_type& control_action) {
+    if (last_accumulated_control_.has_value()) {
+      const auto [distance, angle] = motion_magnitudes(*last_accumulated_control_, control_action);
+      control_accumulation_.distance_traveled += distance;
+      control_accumulation_.angle_turned += angle;
+    }
+    last_accumulated_control_ = control_action;
+    ++control_accumulation_.sample_count;
+  }
+
+  /// Returns the path statistics accumulated since the last performed update.
+  [[nodiscard]] const AmclControlAccumulation& control_accumulation() const { return control_accumulation_; }
+
+  /// Update the map used for localization. Takes one map per model when sensor models are fused.
+  void update_map(map_type map) {
+    if constexpr (kFusedSensorModels) {
+      update_maps(std::move(map), std::make_index_sequence<std::tuple_size_v<SensorModel>>());
+    } else {
+      sensor_model_.update_map(std::move(map));
+    }
+  }
 
   /// Update particles based on motion and sensor information.
   /**
@@ -157,53 +427,548 @@ class Amcl {
    * the particles, and the particle weights are adjusted accordingly. Also, according to the configured resampling
    * policy, the particles are resampled to maintain diversity and prevent degeneracy.
    *
+   * The pose and covariance estimate is not computed here; call `estimate()` when it is needed.
+   *
    * \param control_action Control action.
    * \param measurement Measurement data.
-   * \return An optional pair containing the estimated pose and covariance after the update,
-   *         or std::nullopt if no update was performed.
+   * \return true if the particle set was updated, false if the update was skipped.
+   */
+  auto update(state_type control_action, measurement_type measurement) -> bool {
+    return update_impl(std::move(control_action), std::move(measurement));
+  }
+
+  /// Variant of update() taking a measurement preprocessed ahead of time by the sensor model.
+  /**
+   * Available when the sensor model can be conditioned on the preprocessed form directly,
+   * e.g. the shared handle returned by LikelihoodFieldModelBase::preprocess_measurement.
+   * Several filters consuming the same measurement stream — an A/B comparison of
+   * likelihood models, or a beluga::AmclEnsemble of them — can then preprocess each scan
+   * once and pass the shared result around, instead of repeating the per-scan setup in
+   * every model.
+   *
+   * \param control_action Control action.
+   * \param measurement Preprocessed measurement data.
+   * \return true if the particle set was updated, false if the update was skipped.
    */
-  auto update(state_type control_action, measurement_type measurement) -> std::optional<estimation_type> {
+  template <
+      class Measurement,
+      std::enable_if_t<
+          std::is_invocable_v<SensorModel&, Measurement> &&
+              !std::is_same_v<std::remove_cv_t<std::remove_reference_t<Measurement>>, measurement_type>,
+          int> = 0>
+  auto update(state_type control_action, Measurement measurement) -> bool {
+    return update_impl(std::move(control_action), std::move(measurement));
+  }
+
+ private:
+  /// Implementation shared by the update() overloads.
+  template <class Measurement>
+  auto update_impl(state_type control_action, Measurement measurement) -> bool {
     if (particles_.empty()) {
-      return std::nullopt;
+      return false;
     }
 
-    if (!update_policy_(control_action) && !force_update_) {
-      return std::nullopt;
+    const bool accumulated_motion_trigger = control_accumulation_.distance_traveled > params_.update_min_d ||
+                                            control_accumulation_.angle_turned > params_.update_min_a;
+    if (!update_policy_(control_action) && !accumulated_motion_trigger && !force_update_) {
+      return false;
     }
 
-    particles_ |= beluga::actions::propagate(
-                      execution_policy_, motion_model_(control_action_window_ << std::move(control_action))) |  //
-                  beluga::actions::reweight(execution_policy_, sensor_model_(std::move(measurement))) |         //
-                  beluga::actions::normalize(execution_policy_);
+    const bool latency_control_enabled = params_.update_latency_budget > 0.0;
+    const auto update_start_time =
+        latency_control_enabled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+    [[maybe_unused]] AmclUpdateInstrumentation stats;
+    [[maybe_unused]] std::chrono::steady_clock::time_point stage_start_time;
+    [[maybe_unused]] PageFaultCounts fault_counts_at_start;
+    if constexpr (kInstrumented) {
+      fault_counts_at_start = current_page_fault_counts();
+    }
+
+    if (params_.prune_epsilon > 0.0) {
+      // Drop the near-zero-weight tail before the motion and sensor stages run, so
+      // this update only pays for particles that still contribute to the estimate.
+      particles_ |= beluga::actions::prune(execution_policy_, params_.prune_epsilon);
+    }
+
+    // Small task graph: measurement preprocessing only touches the measurement and
+    // propagation only touches the particle states, so when enabled the former runs
+    // on a helper thread while the particles move, joining before the reweight sweep
+    // needs the conditioned weighting function.
+    auto deferred_weighting_function = std::future<decltype(this->make_weighting_function(std::move(measurement)))>{};
+    if (params_.overlap_measurement_preprocessing) {
+      deferred_weighting_function = std::async(std::launch::async, [this, &measurement]() {
+        return make_weighting_function(std::move(measurement));
+      });
+    }
+
+    if constexpr (kInstrumented) {
+      stage_start_time = std::chrono::steady_clock::now();
+      particles_ |= beluga::actions::propagate(
+          execution_policy_, motion_model_(control_action_window_ << std::move(control_action)));
+      const auto propagate_stop_time = std::chrono::steady_clock::now();
+      stats.propagate_duration = propagate_stop_time - stage_start_time;
+      particles_ |= beluga::actions::reweight_normalized(
+          execution_policy_,
+          deferred_weighting_function.valid() ? deferred_weighting_function.get()
+                                              : make_weighting_function(std::move(measurement)),
+          weight_statistics_.get());
+      stats.reweight_duration = std::chrono::steady_clock::now() - propagate_stop_time;
+    } else if (deferred_weighting_function.valid()) {
+      // Propagate as its own stage so it overlaps the in-flight preprocessing.
+      particles_ |= beluga::actions::propagate(
+          execution_policy_, motion_model_(control_action_window_ << std::move(control_action)));
+      particles_ |= beluga::actions::reweight_normalized(
+          execution_policy_, deferred_weighting_function.get(), weight_statistics_.get());
+    } else {
+      // The fused backend runs both stages in one sweep over the particle columns
+      // where the configuration allows it; the instrumented path above keeps them
+      // separate so per-stage durations remain meaningful.
+      particles_ |= beluga::actions::propagate_reweight_normalized(
+          execution_policy_, motion_model_(control_action_window_ << std::move(control_action)),
+          make_weighting_function(std::move(measurement)), weight_statistics_.get());
+    }
 
-    const double random_state_probability = random_probability_estimator_(particles_);
+    // The statistics accumulated during the reweight sweep already carry the mean
+    // weight, so the estimator update costs no extra pass over the weight column.
+    const double random_state_probability = random_probability_estimator_(*weight_statistics_);
 
     if (resample_policy_(particles_)) {
+      if constexpr (kInstrumented) {
+        stage_start_time = std::chrono::steady_clock::now();
+        stats.resampled = true;
+      }
       auto random_state = ranges::compose(beluga::make_from_state<particle_type>, get_random_state_generator());
 
       if (random_state_probability > 0.0) {
         random_probability_estimator_.reset();
       }
 
-      particles_ |= beluga::views::sample |
-                    beluga::views::random_intersperse(std::move(random_state), random_state_probability) |
-                    beluga::views::take_while_kld(
-                        spatial_hasher_,        //
-                        params_.min_particles,  //
-                        params_.max_particles,  //
-                        params_.kld_epsilon,    //
-                        params_.kld_z) |
-                    beluga::actions::assign;
+      // Resample into a pre-reserved scratch buffer and swap it in, so steady-state
+      // updates don't allocate a new particle set on every resample. KLD bucket
+      // tracking temporaries are served from a pre-reserved arena, reset here on
+      // every resample.
+      std::pmr::monotonic_buffer_resource arena{arena_buffer_.data(), arena_buffer_.size()};
+      // The weight distribution is caller-owned and rebuilt in place from the current
+      // weights, so the sampling setup reuses its table storage on every resample.
+      resample_distribution_.assign(beluga::views::weights(particles_));
+      auto& engine = ranges::detail::get_random_engine();
+      scratch_particles_.assign_range(
+          beluga::views::sample(beluga::views::states(particles_), std::ref(resample_distribution_), engine) |
+          ranges::views::transform(beluga::make_from_state<particle_type>) |
+          beluga::views::random_intersperse(std::move(random_state), random_state_probability) |
+          beluga::views::take_while_kld(
+              spatial_hasher_,           //
+              params_.min_particles,     //
+              effective_max_particles_,  //
+              params_.kld_epsilon,       //
+              params_.kld_z,             //
+              &arena));
+      std::swap(particles_, scratch_particles_);
+
+      if constexpr (kInstrumented) {
+        stats.resample_duration = std::chrono::steady_clock::now() - stage_start_time;
+      }
+    }
+
+    if constexpr (kInstrumented) {
+      stats.particle_count = particles_.size();
+      stats.effective_sample_size = weight_statistics_->effective_sample_size();
+      stats.random_state_probability = random_state_probability;
+      std::tie(stats.recovery_slow_average, stats.recovery_fast_average) =
+          random_probability_estimator_.filter_outputs();
+      const auto fault_counts = current_page_fault_counts();
+      stats.minor_page_faults = fault_counts.minor - fault_counts_at_start.minor;
+      stats.major_page_faults = fault_counts.major - fault_counts_at_start.major;
+      instrumentation_(stats);
+    }
+
+    if (latency_control_enabled) {
+      const std::chrono::duration<double> update_duration = std::chrono::steady_clock::now() - update_start_time;
+      adapt_effective_max_particles(update_duration.count());
     }
 
     force_update_ = false;
-    return beluga::estimate(beluga::views::states(particles_), beluga::views::weights(particles_));
+    estimate_.reset();
+    control_accumulation_ = AmclControlAccumulation{};
+    return true;
+  }
+
+ public:
+  /// Returns the current pose and covariance estimate.
+  /**
+   * The estimate is computed lazily from the current particle set and cached until the next
+   * successful update, so callers that consume poses at a lower rate than they run the filter
+   * don't pay for estimates they never read.
+   *
+   * The filter must hold particles, i.e. `initialize()` must have been called.
+   */
+  [[nodiscard]] const estimation_type& estimate() const {
+    assert(!particles_.empty());
+    if (!estimate_.has_value()) {
+      estimate_ = beluga::estimate(
+          execution_policy_, beluga::views::states(particles_), beluga::views::weights(particles_));
+    }
+    return *estimate_;
+  }
+
+  /// Propagates particles through the motion model without reweighting or resampling.
+  /**
+   * Lightweight path for consumers that need fresh poses at odometry rate between full
+   * sensor updates. Particles move through the motion model, and any cached estimate is
+   * dead-reckoned by the incremental motion instead of being recomputed from the
+   * particles, so a following `estimate()` call costs nothing. The covariance is carried
+   * over unchanged, which slightly understates the dead-reckoning uncertainty.
+   *
+   * The update policy is not consulted or advanced; interleaving this with `update()`
+   * calls composes correctly since both paths derive motion from the same control action
+   * window.
+   *
+   * \param control_action Control action.
+   * \return true if particles were propagated, false if the filter holds no particles.
+   */
+  bool propagate_only(state_type control_action) {
+    if (particles_.empty()) {
+      return false;
+    }
+
+    particles_ |= beluga::actions::propagate(
+        execution_policy_, motion_model_(control_action_window_ << std::move(control_action)));
+
+    if (estimate_.has_value()) {
+      const auto& [pose, previous_pose] = control_action_window_;
+      estimate_->first = estimate_->first * (previous_pose.inverse() * pose);
+    }
+    return true;
+  }
+
+  /// Schedules a filter update on an internal worker thread.
+  /**
+   * Behaves like `update()` but returns immediately, so a sensor callback is not blocked
+   * for the duration of the update. Updates are executed one at a time in submission
+   * order; the returned future yields what `update()` would have returned. Note that the
+   * resampled particle set of one measurement is the input to the propagation of the
+   * next, so stages of different measurements cannot overlap — the win here is freeing
+   * the caller's thread, with intra-update parallelism provided by the execution policy.
+   *
+   * Concurrent access is not synchronized: do not call other methods on this instance
+   * (or move it) while a scheduled update has not completed.
+   */
+  [[nodiscard]] std::future<bool> update_async(state_type control_action, measurement_type measurement) {
+    if (!pipeline_) {
+      pipeline_ = std::make_unique<AsyncPipeline>();
+      pipeline_->worker = std::thread{[pipeline = pipeline_.get()] {
+        for (;;) {
+          std::packaged_task<bool()> task;
+          {
+            std::unique_lock<std::mutex> lock{pipeline->mutex};
+            pipeline->condition.wait(lock, [pipeline] { return pipeline->stopping || !pipeline->queue.empty(); });
+            if (pipeline->queue.empty()) {
+              return;
+            }
+            task = std::move(pipeline->queue.front());
+            pipeline->queue.pop_front();
+          }
+          task();
+        }
+      }};
+    }
+    std::packaged_task<bool()> task{
+        [this, control_action = std::move(control_action), measurement = std::move(measurement)]() mutable {
+          return update(std::move(control_action), std::move(measurement));
+        }};
+    auto future = task.get_future();
+    {
+      const std::lock_guard<std::mutex> lock{pipeline_->mutex};
+      pipeline_->queue.push_back(std::move(task));
+    }
+    pipeline_->condition.notify_one();
+    return future;
+  }
+
+  /// Runs a pre-decoded batch of (control, measurement) pairs through the filter back-to-back.
+  /**
+   * Batch driver for offline log replay: entries are consumed by move with no decoding,
+   * transport, or scheduling in between updates, so throughput is bounded by the filter
+   * itself rather than by the replay harness. Skipped entries cost one update policy
+   * evaluation each, exactly as they would online.
+   *
+   * \param log Control and measurement pairs, in log order.
+   * \return The number of entries whose update was performed rather than skipped.
+   */
+  std::size_t update_batch(std::vector<std::pair<state_type, measurement_type>> log) {
+    std::size_t updates_performed = 0;
+    for (auto& [control_action, measurement] : log) {
+      if (update(std::move(control_action), std::move(measurement))) {
+        ++updates_performed;
+      }
+    }
+    return updates_performed;
   }
 
   /// Force a manual update of the particles on the next iteration of the filter.
   void force_update() { force_update_ = true; }
 
+  /// Returns a reference to the instrumentation hook instance for configuration.
+  [[nodiscard]] Instrumentation& instrumentation() { return instrumentation_; }
+
+  /// Serializes the filter state into a compact binary blob.
+  /**
+   * The blob captures the particle set, the recovery probability estimator state, and the
+   * control action window, so a restarted process can resume filtering via `restore()`
+   * without a convergence gap. The SoA layout of the particle container makes this a
+   * handful of column sweeps: trivially copyable columns are copied wholesale, and pose
+   * columns are serialized per parameter scalar. The blob layout is an implementation
+   * detail; it is only meant to be read back by the same binary.
+   */
+  [[nodiscard]] auto snapshot() const -> std::vector<std::byte> {
+    std::vector<std::byte> blob;
+    const auto num_particles = static_cast<std::uint64_t>(particles_.size());
+    append_bytes(blob, &num_particles, 1);
+    snapshot_particle_columns(blob, std::make_index_sequence<std::tuple_size_v<particle_type>>());
+    const auto [slow_output, fast_output] = random_probability_estimator_.filter_outputs();
+    append_bytes(blob, &slow_output, 1);
+    append_bytes(blob, &fast_output, 1);
+    const auto window_size = static_cast<std::uint64_t>(control_action_window_.size());
+    append_bytes(blob, &window_size, 1);
+    auto it = control_action_window_.cbegin();
+    for (std::uint64_t i = 0; i < window_size; ++i, ++it) {
+      const state_type& control_action = *it;
+      append_pose_bytes(blob, &control_action, 1);
+    }
+    return blob;
+  }
+
+  /// Restores the filter state from a blob produced by `snapshot()`.
+  /**
+   * On success the particle set, the recovery probability estimator state, and the control
+   * action window are replaced with the snapshotted ones, and the next update is forced so
+   * the filter resumes immediately.
+   *
+   * \param blob Binary blob produced by `snapshot()` on an identically configured filter.
+   * \return true on success, false if the blob is truncated or inconsistent, in which case
+   *         the filter state is left untouched.
+   */
+  bool restore(const std::vector<std::byte>& blob) {
+    std::size_t offset = 0;
+    std::uint64_t num_particles = 0;
+    if (!extract_bytes(blob, offset, &num_particles, 1) || num_particles > params_.max_particles) {
+      return false;
+    }
+    beluga::TupleVector<particle_type> particles;
+    particles.resize(static_cast<std::size_t>(num_particles));
+    if (!restore_particle_columns(
+            blob, offset, particles, std::make_index_sequence<std::tuple_size_v<particle_type>>())) {
+      return false;
+    }
+    double slow_output = 0.0;
+    double fast_output = 0.0;
+    std::uint64_t window_size = 0;
+    if (!extract_bytes(blob, offset, &slow_output, 1) ||  //
+        !extract_bytes(blob, offset, &fast_output, 1) ||  //
+        !extract_bytes(blob, offset, &window_size, 1) ||  //
+        window_size > control_action_window_.max_size()) {
+      return false;
+    }
+    beluga::RollingWindow<state_type, 2> control_action_window;
+    std::array<state_type, 2> window_buffer;
+    for (std::uint64_t i = 0; i < window_size; ++i) {
+      if (!extract_pose_bytes(blob, offset, &window_buffer[static_cast<std::size_t>(i)], 1)) {
+        return false;
+      }
+    }
+    if (offset != blob.size()) {
+      return false;
+    }
+    // The rolling window is accessed by the front, so refill it back to front.
+    for (std::uint64_t i = window_size; i > 0; --i) {
+      control_action_window << window_buffer[static_cast<std::size_t>(i - 1)];
+    }
+
+    particles_ = std::move(particles);
+    particles_.reserve(params_.max_particles);
+    scratch_particles_.reserve(params_.max_particles);
+    arena_buffer_.resize(params_.max_particles * kArenaBytesPerParticle);
+    random_probability_estimator_.reset(slow_output, fast_output);
+    control_action_window_ = control_action_window;
+    effective_max_particles_ = params_.max_particles;
+    estimate_.reset();
+    force_update_ = true;
+    return true;
+  }
+
  private:
+  /// Generous upper bound for the KLD bucket set nodes and bucket array,
+  /// so steady-state resamples never fall back to the global allocator.
+  static constexpr std::size_t kArenaBytesPerParticle = 64U;
+
+  /// Worker thread state backing `update_async()`. Queued updates are drained before the
+  /// worker exits, so no returned future is ever broken.
+  struct AsyncPipeline {
+    ~AsyncPipeline() {
+      {
+        const std::lock_guard<std::mutex> lock{mutex};
+        stopping = true;
+      }
+      condition.notify_one();
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::packaged_task<bool()>> queue;
+    bool stopping = false;
+    std::thread worker;
+  };
+
+  /// Appends `count` trivially copyable values to a binary blob.
+  template <class T>
+  static void append_bytes(std::vector<std::byte>& blob, const T* data, std::size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const auto* begin = reinterpret_cast<const std::byte*>(data);
+    blob.insert(blob.end(), begin, begin + count * sizeof(T));
+  }
+
+  /// Extracts `count` trivially copyable values from a binary blob, advancing `offset`.
+  /// Returns false if the blob does not hold enough bytes.
+  template <class T>
+  static bool extract_bytes(const std::vector<std::byte>& blob, std::size_t& offset, T* data, std::size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const std::size_t num_bytes = count * sizeof(T);
+    if (blob.size() - offset < num_bytes) {
+      return false;
+    }
+    std::memcpy(data, blob.data() + offset, num_bytes);
+    offset += num_bytes;
+    return true;
+  }
+
+  /// Appends `count` poses to a binary blob, one parameter block at a time.
+  /**
+   * Pose types are not trivially copyable under Eigen, so they cannot go through
+   * `append_bytes()` whole; their parameter scalars (unit complex or unit quaternion
+   * followed by the translation) are contiguous doubles and serialize instead.
+   */
+  template <class PoseType>
+  static void append_pose_bytes(std::vector<std::byte>& blob, const PoseType* data, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      append_bytes(blob, data[i].data(), static_cast<std::size_t>(PoseType::num_parameters));
+    }
+  }
+
+  /// Extracts `count` poses from a binary blob, advancing `offset`.
+  /// Returns false if the blob does not hold enough bytes.
+  template <class PoseType>
+  static bool
+  extract_pose_bytes(const std::vector<std::byte>& blob, std::size_t& offset, PoseType* data, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      if (!extract_bytes(blob, offset, data[i].data(), static_cast<std::size_t>(PoseType::num_parameters))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Appends each particle container column to a binary blob.
+  /**
+   * Trivially copyable columns (e.g. weights) go in one contiguous copy; the state
+   * column is serialized per pose through `append_pose_bytes()`.
+   */
+  template <std::size_t... Ids>
+  void snapshot_particle_columns(std::vector<std::byte>& blob, std::index_sequence<Ids...>) const {
+    const auto append_column = [&blob](const auto* data, std::size_t count) {
+      using T = std::decay_t<decltype(*data)>;
+      if constexpr (std::is_trivially_copyable_v<T>) {
+        append_bytes(blob, data, count);
+      } else {
+        append_pose_bytes(blob, data, count);
+      }
+    };
+    (append_column(particles_.template data<Ids>(), particles_.size()), ...);
+  }
+
+  /// Extracts each particle container column from a binary blob, mirroring
+  /// `snapshot_particle_columns()`.
+  template <std::size_t... Ids>
+  static bool restore_particle_columns(
+      const std::vector<std::byte>& blob,
+      std::size_t& offset,
+      beluga::TupleVector<particle_type>& particles,
+      std::index_sequence<Ids...>) {
+    const auto extract_column = [&blob, &offset](auto* data, std::size_t count) {
+      using T = std::decay_t<decltype(*data)>;
+      if constexpr (std::is_trivially_copyable_v<T>) {
+        return extract_bytes(blob, offset, data, count);
+      } else {
+        return extract_pose_bytes(blob, offset, data, count);
+      }
+    };
+    return (extract_column(particles.template data<Ids>(), particles.size()) && ...);
+  }
+
+  /// Adjusts the effective maximum number of particles based on the measured update wall time.
+  /**
+   * Applies a damped proportional correction towards the configured latency budget: updates that
+   * run over the budget shrink the population handed to the KLD limiter, updates with headroom
+   * grow it back. The correction per update is bounded to avoid oscillating on noisy timings,
+   * and the result always stays within the configured `[min_particles, max_particles]` range.
+   */
+  void adapt_effective_max_particles(double update_duration) {
+    constexpr double kGain = 0.5;
+    const double ratio = params_.update_latency_budget / update_duration;
+    const double correction = std::clamp(1.0 + kGain * (ratio - 1.0), 0.5, 1.5);
+    const auto target = static_cast<std::size_t>(static_cast<double>(effective_max_particles_) * correction);
+    effective_max_particles_ = std::clamp(target, params_.min_particles, params_.max_particles);
+  }
+
+  /// Returns the translation and unsigned rotation magnitudes of the motion between two poses.
+  [[nodiscard]] static std::pair<double, double> motion_magnitudes(const state_type& prev, const state_type& current) {
+    const auto delta = prev.inverse() * current;
+    const auto distance = static_cast<double>(delta.translation().norm());
+    if constexpr (state_type::DoF == 3) {  // SE2
+      return {distance, std::abs(static_cast<double>(delta.so2().log()))};
+    } else {  // SE3
+      const Eigen::AngleAxis<typename state_type::Scalar> angle_axis{delta.so3().unit_quaternion()};
+      return {distance, std::abs(static_cast<double>(angle_axis.angle()))};
+    }
+  }
+
+  /// Builds the state weighting function for a measurement.
+  /**
+   * For a single sensor model this is just the model conditioned on the measurement. For
+   * fused sensor models, each model is conditioned on its own measurement and the
+   * per-model likelihoods multiply into the combined weight, so all sensors are fused in
+   * one sweep over the particles instead of one reweight pass per sensor.
+   */
+  template <class Measurement>
+  [[nodiscard]] auto make_weighting_function(Measurement&& measurement) {
+    if constexpr (kFusedSensorModels) {
+      return make_fused_weighting_function(
+          std::forward<Measurement>(measurement), std::make_index_sequence<std::tuple_size_v<SensorModel>>());
+    } else {
+      return sensor_model_(std::forward<Measurement>(measurement));
+    }
+  }
+
+  /// Conditions each fused sensor model on its measurement and combines the resulting functions.
+  template <std::size_t... Ids>
+  [[nodiscard]] auto make_fused_weighting_function(measurement_type&& measurement, std::index_sequence<Ids...>) {
+    return [weighting_functions = std::make_tuple(std::get<Ids>(sensor_model_)(
+                std::move(std::get<Ids>(measurement)))...)](const state_type& state) {
+      return std::apply(
+          [&state](const auto&... functions) { return (static_cast<double>(functions(state)) * ...); },
+          weighting_functions);
+    };
+  }
+
+  /// Updates each fused sensor model with its map.
+  template <std::size_t... Ids>
+  void update_maps(map_type&& maps, std::index_sequence<Ids...>) {
+    (std::get<Ids>(sensor_model_).update_map(std::move(std::get<Ids>(maps))), ...);
+  }
+
   /// Gets a callable that will produce a random state.
   [[nodiscard]] decltype(auto) get_random_state_generator() const {
     if constexpr (std::is_invocable_v<random_state_generator_type>) {
@@ -213,6 +978,22 @@ class Amcl {
     }
   }
   beluga::TupleVector<particle_type> particles_;
+  /// Pre-reserved buffer the resample pipeline writes into; swapped with `particles_` after each resample.
+  beluga::TupleVector<particle_type> scratch_particles_;
+  /// Pre-reserved storage backing the per-resample monotonic arena for pipeline temporaries.
+  std::vector<std::byte> arena_buffer_;
+  /// Reusable weight distribution for the resample stage; its alias table is rebuilt in
+  /// place from the current weights on every resample, reusing its storage across updates.
+  beluga::DiscreteAliasDistribution<std::ptrdiff_t> resample_distribution_;
+  /// Estimate cache backing `estimate()`; invalidated on every successful update.
+  mutable std::optional<estimation_type> estimate_;
+  /// Maximum number of particles currently handed to the KLD limiter; modulated by the
+  /// latency controller when `AmclParams::update_latency_budget` is set.
+  std::size_t effective_max_particles_{0};
+  /// Hook invoked after every performed update when instrumentation is enabled.
+  Instrumentation instrumentation_;
+  /// Lazily started worker thread state for `update_async()`.
+  std::unique_ptr<AsyncPipeline> pipeline_;
 
   AmclParams params_;
 
@@ -221,17 +1002,80 @@ class Amcl {
   ExecutionPolicy execution_policy_;
 
   spatial_hasher_type spatial_hasher_;
+  /// Weight statistics accumulated during the reweight sweep; shared with the resample policy.
+  std::shared_ptr<beluga::WeightStatistics> weight_statistics_ = std::make_shared<beluga::WeightStatistics>();
   beluga::ThrunRecoveryProbabilityEstimator random_probability_estimator_;
-  beluga::any_policy<state_type> update_policy_;
-  beluga::any_policy<decltype(particles_)> resample_policy_;
+  UpdatePolicy update_policy_;
+  ResamplePolicy resample_policy_;
 
   random_state_generator_type random_state_generator_;
 
   beluga::RollingWindow<state_type, 2> control_action_window_;
 
+  /// Path statistics fed through `accumulate_control()`; reset by every performed update.
+  AmclControlAccumulation control_accumulation_;
+  /// Last odometry sample fed through `accumulate_control()`, kept across updates for continuity.
+  std::optional<state_type> last_accumulated_control_;
+
   bool force_update_{true};
 };
 
+/// Replays independent pre-decoded logs through per-replay filters in parallel.
+/**
+ * Offline regression-evaluation driver: each replay index gets its own filter instance
+ * from `filter_factory` and its log is run through `Amcl::update_batch` on one of the
+ * worker threads. Workers pull replay indices from a shared counter, so all cores stay
+ * busy even when log lengths vary widely. The thread-local random engine the sampling
+ * views draw from is reseeded from `seed` and the replay index before each replay, so
+ * RNG streams are isolated and every replay is reproducible regardless of which worker
+ * picks it up.
+ *
+ * \tparam FilterFactory Callable taking a replay index and returning an initialized \ref Amcl instance.
+ * \tparam Log Sequence of (control, measurement) pairs accepted by `Amcl::update_batch`.
+ * \tparam ResultCallback Callable invoked with the replay index and the finished filter
+ * once its log is exhausted. Invoked concurrently from worker threads, so it must either
+ * be thread-safe or only write to per-replay slots (e.g. a pre-sized vector indexed by
+ * replay).
+ * \param filter_factory Factory producing one filter per replay.
+ * \param logs One pre-decoded log per replay; consumed by move.
+ * \param result_callback Consumer of finished replays.
+ * \param num_workers Number of worker threads; zero means one per hardware thread.
+ * \param seed Base seed for the per-replay RNG streams.
+ */
+template <class FilterFactory, class Log, class ResultCallback>
+void replay_in_parallel(
+    FilterFactory&& filter_factory,
+    std::vector<Log> logs,
+    ResultCallback&& result_callback,
+    std::size_t num_workers = 0,
+    std::uint_fast32_t seed = 12345U) {
+  if (num_workers == 0) {
+    num_workers = std::max(std::size_t{1}, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+  }
+  num_workers = std::min(num_workers, logs.size());
+  std::atomic<std::size_t> next_replay{0};
+  const auto worker = [&filter_factory, &logs, &result_callback, &next_replay, seed] {
+    for (;;) {
+      const std::size_t index = next_replay.fetch_add(1);
+      if (index >= logs.size()) {
+        return;
+      }
+      ranges::detail::get_random_engine().seed(static_cast<std::uint_fast32_t>(seed + index));
+      auto filter = filter_factory(index);
+      filter.update_batch(std::move(logs[index]));
+      result_callback(index, filter);
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  for (std::size_t i = 0; i < num_workers; ++i) {
+    workers.emplace_back(worker);
+  }
+  for (auto& thread : workers) {
+    thread.join();
+  }
+}
+
 }  // namespace beluga
 
 #endif  // BELUGA_ALGORITHM_AMCL_CORE_HPP
@@ -0,0 +1,145 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_AMCL_ENSEMBLE_HPP
+#define BELUGA_ALGORITHM_AMCL_ENSEMBLE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \brief Implementation of a multi-hypothesis ensemble of particle filters.
+ */
+
+namespace beluga {
+
+/// Multi-hypothesis ensemble running independent particle filters in parallel.
+/**
+ * Runs K independent member filters over the same measurements and exposes the estimate of
+ * the hypothesis that best explains the data. K small filters parallelize better than one
+ * large one and converge faster in symmetric environments, since each member can commit to
+ * a different mode of the posterior.
+ *
+ * Member filters are constructed through a caller-provided factory, so map-heavy sensor
+ * models can be built from shared immutable storage (e.g. the likelihood field or NDT cell
+ * map) instead of holding one copy per member.
+ *
+ * Hypotheses are ranked by the average unnormalized particle weight accumulated during the
+ * reweight sweep, which is proportional to the measurement likelihood under each
+ * hypothesis.
+ *
+ * \tparam Filter Member filter type, typically an instantiation of \ref Amcl.
+ */
+template <class Filter>
+class AmclEnsemble {
+ public:
+  /// Construct an ensemble of `count` member filters.
+  /**
+   * \param count Number of member filters to run.
+   * \param factory Callable invoked once per member to construct it.
+   */
+  template <class Factory>
+  AmclEnsemble(std::size_t count, Factory&& factory) {
+    assert(count > 0);
+    filters_.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      filters_.push_back(factory());
+    }
+  }
+
+  /// Returns a reference to the member filters.
+  [[nodiscard]] const auto& filters() const { return filters_; }
+
+  /// Initialize all member filters, forwarding to their `initialize()` overloads.
+  /**
+   * Each member draws its own samples, so members start from independent particle sets
+   * even when initialized from the same distribution.
+   */
+  template <class... Args>
+  void initialize(Args&&... args) {
+    for (auto& filter : filters_) {
+      filter.initialize(args...);
+    }
+  }
+
+  /// Update all member filters in parallel with the same control action and measurement.
+  /**
+   * Members are processed with a parallel execution policy, so independent updates are
+   * distributed across cores by the underlying scheduler.
+   *
+   * \param control_action Control action.
+   * \param measurement Measurement data; copied once per member.
+   * \return true if at least one member filter performed an update.
+   */
+  template <class StateT, class MeasurementT>
+  bool update(const StateT& control_action, const MeasurementT& measurement) {
+    std::vector<char> updated(filters_.size(), 0);
+    std::transform(
+        std::execution::par, filters_.begin(), filters_.end(), updated.begin(),
+        [&](Filter& filter) { return static_cast<char>(filter.update(control_action, MeasurementT{measurement})); });
+    return std::any_of(updated.begin(), updated.end(), [](char value) { return value != 0; });
+  }
+
+  /// Force a manual update of all member filters on their next iteration.
+  void force_update() {
+    for (auto& filter : filters_) {
+      filter.force_update();
+    }
+  }
+
+  /// Returns the index of the member filter that best explains the measurements.
+  /**
+   * Ranks hypotheses by the average unnormalized particle weight accumulated during the
+   * last reweight sweep.
+   */
+  [[nodiscard]] std::size_t best_hypothesis() const {
+    std::size_t best_index = 0;
+    double best_score = score(filters_[0]);
+    for (std::size_t i = 1; i < filters_.size(); ++i) {
+      const double candidate_score = score(filters_[i]);
+      if (candidate_score > best_score) {
+        best_score = candidate_score;
+        best_index = i;
+      }
+    }
+    return best_index;
+  }
+
+  /// Returns the pose and covariance estimate of the best hypothesis.
+  /**
+   * The member filters must hold particles, i.e. `initialize()` must have been called.
+   */
+  [[nodiscard]] decltype(auto) estimate() const { return filters_[best_hypothesis()].estimate(); }
+
+ private:
+  /// Measurement likelihood score of a member filter.
+  [[nodiscard]] static double score(const Filter& filter) {
+    const std::size_t size = filter.particles().size();
+    if (size == 0) {
+      return 0.0;
+    }
+    return filter.weight_statistics().total_weight / static_cast<double>(size);
+  }
+
+  std::vector<Filter> filters_;
+};
+
+}  // namespace beluga
+
+#endif
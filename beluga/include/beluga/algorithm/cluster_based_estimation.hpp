@@ -16,7 +16,12 @@
 #define BELUGA_ALGORITHM_CLUSTER_BASED_ESTIMATION_HPP
 
 // standard library
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <functional>
+#include <limits>
+#include <numeric>
 #include <optional>
 #include <queue>
 #include <unordered_map>
@@ -32,6 +37,7 @@
 #include <range/v3/view/common.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/map.hpp>
+#include <range/v3/view/slice.hpp>
 #include <range/v3/view/zip.hpp>
 #include <sophus/se2.hpp>
 #include <sophus/types.hpp>
@@ -39,6 +45,8 @@
 // project
 #include <beluga/algorithm/estimation.hpp>
 #include <beluga/algorithm/spatial_hash.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
 
 #if RANGE_V3_MAJOR == 0 && RANGE_V3_MINOR < 12
 #include <range/v3/view/group_by.hpp>
@@ -245,6 +253,265 @@ static void assign_clusters(ClusterMap<State>& map, NeighborsFunction&& neighbor
   }
 }
 
+/// Contiguous storage for the sparse data about the particles grouped in cells.
+/**
+ * Equivalent to ClusterMap, but with each field kept in a separate array sorted by
+ * cell hash, so that cells can be located with a binary search and traversed without
+ * pointer chasing.
+ */
+template <class State>
+struct ClusterCellArray {
+  /// Sentinel value for cells that have not been assigned to a cluster yet.
+  static constexpr std::size_t kUnassigned = std::numeric_limits<std::size_t>::max();
+
+  std::vector<std::size_t> hashes;         ///< unique cell hashes, in ascending order
+  std::vector<State> states;               ///< state of a particle that is within each cell
+  std::vector<double> weights;             ///< average weight of each cell
+  std::vector<std::size_t> num_particles;  ///< number of particles in each cell
+  std::vector<std::size_t> cluster_ids;    ///< cluster id of each cell
+
+  /// Clear the array contents, preserving the allocated capacity.
+  void clear() {
+    hashes.clear();
+    states.clear();
+    weights.clear();
+    num_particles.clear();
+    cluster_ids.clear();
+  }
+};
+
+/// Reusable scratch buffers for the clusterization algorithm.
+/**
+ * Owning these buffers across calls (instead of allocating them from scratch on every
+ * call) keeps the steady-state clusterization path free of heap allocations: buffers
+ * only ever grow, they are never released.
+ */
+struct ClusterizerScratch {
+  std::vector<std::pair<std::size_t, std::size_t>> hashed_indices;  ///< (hash, particle index) pairs being sorted
+  std::vector<std::pair<std::size_t, std::size_t>> sort_scratch;    ///< radix sort swap buffer
+  std::vector<double> percentile_values;                            ///< working copy for the percentile threshold
+  std::vector<std::size_t> order;                                   ///< cell indices in descending weight order
+  std::vector<std::size_t> parent;                                  ///< union-find parent array
+  std::vector<bool> claimed;                                        ///< cells already mapped to a cluster
+};
+
+/// Sort (hash, particle index) pairs in ascending hash order.
+/**
+ * Least-significant-digit radix sort over the hash bytes. Passes where all keys share
+ * the same digit are skipped, so the cost adapts to the number of bits the spatial
+ * hash function actually populates.
+ *
+ * \param items The pairs to be sorted in place.
+ * \param scratch Swap buffer reused across passes; grown as needed.
+ */
+inline void radix_sort_by_hash(
+    std::vector<std::pair<std::size_t, std::size_t>>& items,
+    std::vector<std::pair<std::size_t, std::size_t>>& scratch) {
+  if (items.empty()) {
+    return;
+  }
+  constexpr std::size_t kRadixBits = 8;
+  constexpr std::size_t kBucketCount = std::size_t{1} << kRadixBits;
+  scratch.resize(items.size());
+  for (std::size_t shift = 0; shift < sizeof(std::size_t) * 8; shift += kRadixBits) {
+    std::array<std::size_t, kBucketCount> counts{};
+    for (const auto& [hash, index] : items) {
+      ++counts[(hash >> shift) & (kBucketCount - 1)];
+    }
+    if (counts[(items.front().first >> shift) & (kBucketCount - 1)] == items.size()) {
+      continue;  // all keys share this digit
+    }
+    std::size_t offset = 0;
+    for (auto& count : counts) {
+      offset += std::exchange(count, offset);
+    }
+    for (const auto& item : items) {
+      scratch[counts[(item.first >> shift) & (kBucketCount - 1)]++] = item;
+    }
+    std::swap(items, scratch);
+  }
+}
+
+/// \overload That allocates its own scratch buffer.
+inline void radix_sort_by_hash(std::vector<std::pair<std::size_t, std::size_t>>& items) {
+  std::vector<std::pair<std::size_t, std::size_t>> scratch;
+  radix_sort_by_hash(items, scratch);
+}
+
+/// Create a cluster cell array from a range of particles and their corresponding spatial hashes.
+/**
+ * Array-based equivalent of `make_cluster_map`. The particle hashes are sorted once and
+ * deduplicated into contiguous per-cell arrays; all the relevant fields are populated
+ * except for the cluster IDs, which have to be computed with a separate call to
+ * `assign_clusters`.
+ *
+ * \tparam States The range type for particle states.
+ * \tparam Weights The range type for particle weights.
+ * \param states A range of particle states.
+ * \param weights A range of particle weights.
+ * \param hashes The spatial hashes of the particles.
+ * \param cells The cell array to be repopulated.
+ * \param scratch Scratch buffers reused across calls.
+ */
+template <class States, class Weights, class State>
+static void populate_cluster_cell_array(
+    States&& states,
+    Weights&& weights,
+    const std::vector<std::size_t>& hashes,
+    ClusterCellArray<State>& cells,
+    ClusterizerScratch& scratch) {
+  cells.clear();
+
+  auto& hashed_indices = scratch.hashed_indices;
+  hashed_indices.clear();
+  hashed_indices.reserve(hashes.size());
+  for (std::size_t index = 0; index < hashes.size(); ++index) {
+    hashed_indices.emplace_back(hashes[index], index);
+  }
+  radix_sort_by_hash(hashed_indices, scratch.sort_scratch);
+
+  cells.hashes.reserve(hashed_indices.size());
+  for (const auto& [hash, index] : hashed_indices) {
+    if (cells.hashes.empty() || cells.hashes.back() != hash) {
+      cells.hashes.push_back(hash);
+    }
+  }
+
+  cells.states.resize(cells.hashes.size());
+  cells.weights.assign(cells.hashes.size(), 0.0);
+  cells.num_particles.assign(cells.hashes.size(), 0);
+
+  // Calculate the accumulated cell weight and save a single representative state for each cell.
+  for (const auto& [state, weight, hash] : ranges::views::zip(states, weights, hashes)) {
+    const auto it = std::lower_bound(cells.hashes.begin(), cells.hashes.end(), hash);
+    const auto index = static_cast<std::size_t>(std::distance(cells.hashes.begin(), it));
+    if (cells.num_particles[index] == 0) {
+      cells.states[index] = state;
+    }
+    cells.weights[index] += weight;
+    ++cells.num_particles[index];
+  }
+}
+
+/// \overload That allocates its own cell array and scratch buffers.
+template <class States, class Weights>
+[[nodiscard]] static auto
+make_cluster_cell_array(States&& states, Weights&& weights, const std::vector<std::size_t>& hashes) {
+  using State = ranges::range_value_t<States>;
+  ClusterCellArray<State> cells;
+  ClusterizerScratch scratch;
+  populate_cluster_cell_array(states, weights, hashes, cells, scratch);
+  return cells;
+}
+
+/// Normalize weights and cap them to a given percentile.
+/**
+ * Array-based equivalent of the ClusterMap overload; see its documentation for the rationale.
+ *
+ * \tparam State The state type of the cells in the array.
+ * \param cells A reference to the cell array.
+ * \param percentile The percentile threshold for capping the weights.
+ * \param scratch Scratch buffers reused across calls.
+ */
+template <class State>
+static void normalize_and_cap_weights(ClusterCellArray<State>& cells, double percentile, ClusterizerScratch& scratch) {
+  for (std::size_t index = 0; index < cells.weights.size(); ++index) {
+    assert(cells.num_particles[index] > 0);
+    cells.weights[index] /= static_cast<double>(cells.num_particles[index]);
+  }
+
+  // Same as calculate_percentile_threshold, but reusing the scratch buffer for the working copy.
+  auto& values = scratch.percentile_values;
+  values.assign(cells.weights.begin(), cells.weights.end());
+  const auto n = static_cast<std::ptrdiff_t>(static_cast<double>(values.size()) * percentile);
+  std::nth_element(values.begin(), values.begin() + n, values.end());
+  const double max_weight = values[static_cast<std::size_t>(n)];
+
+  for (auto& weight : cells.weights) {
+    weight = std::min(weight, max_weight);
+  }
+}
+
+/// Assign cluster ids to an existing cluster cell array.
+/**
+ * Array-based equivalent of the ClusterMap overload. Cells are visited in order of
+ * descending weight and union each unclaimed lower-weight neighbor into their set,
+ * which is equivalent to the priority queue traversal of the map-based overload: by
+ * the time a cell is visited, every cell that could have claimed it has already had
+ * the chance to do so. Neighbor lookups are binary searches over the sorted hash
+ * array and cluster membership is tracked with a union-find parent array, so no
+ * per-cell heap allocations are involved.
+ *
+ * \tparam State The state type of the cells in the array.
+ * \tparam NeighborsFunction A callable object that, given a state, returns a range of neighboring cell hashes.
+ * \param cells A reference to the cell array.
+ * \param neighbors_function A function that returns neighboring cell hashes for a given state.
+ * \param scratch Scratch buffers reused across calls.
+ */
+template <class State, class NeighborsFunction>
+static void
+assign_clusters(ClusterCellArray<State>& cells, NeighborsFunction&& neighbors_function, ClusterizerScratch& scratch) {
+  const std::size_t num_cells = cells.hashes.size();
+  cells.cluster_ids.assign(num_cells, ClusterCellArray<State>::kUnassigned);
+
+  auto& order = scratch.order;
+  order.resize(num_cells);
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::sort(order.begin(), order.end(), [&cells](std::size_t lhs, std::size_t rhs) {
+    return cells.weights[lhs] > cells.weights[rhs];
+  });
+
+  auto& parent = scratch.parent;
+  parent.resize(num_cells);
+  std::iota(parent.begin(), parent.end(), std::size_t{0});
+  const auto find_root = [&parent](std::size_t index) {
+    while (parent[index] != index) {
+      parent[index] = parent[parent[index]];  // halve the path as we walk it
+      index = parent[index];
+    }
+    return index;
+  };
+
+  // Process cells in order of descending weight; unclaimed cells become local peaks
+  // and claimed cells keep growing the cluster of the peak that claimed them.
+  auto& claimed = scratch.claimed;
+  claimed.assign(num_cells, false);
+  for (const std::size_t index : order) {
+    claimed[index] = true;
+    const std::size_t root = find_root(index);
+    for (const std::size_t neighbor_hash : neighbors_function(cells.states[index])) {
+      const auto it = std::lower_bound(cells.hashes.begin(), cells.hashes.end(), neighbor_hash);
+      if (it == cells.hashes.end() || *it != neighbor_hash) {
+        continue;  // not within the array
+      }
+      const auto neighbor = static_cast<std::size_t>(std::distance(cells.hashes.begin(), it));
+      if (cells.weights[neighbor] > cells.weights[index]) {
+        continue;  // has higher weight than the current cell
+      }
+      if (!claimed[neighbor]) {
+        claimed[neighbor] = true;
+        parent[neighbor] = root;  // unclaimed cells are always their own root
+      } else if (cells.weights[neighbor] == cells.weights[index]) {
+        // Adjacent cells with exactly the same weight are almost always part of a plateau
+        // created by the percentile cap; fuse their clusters, which is the very reason the
+        // cap exists.
+        parent[find_root(neighbor)] = root;
+      }
+    }
+  }
+
+  // Compress each union-find tree into a dense cluster id, numbering peaks in
+  // descending weight order to mirror the map-based overload.
+  std::size_t next_cluster_id = 0;
+  for (const std::size_t index : order) {
+    const std::size_t root = find_root(index);
+    if (cells.cluster_ids[root] == ClusterCellArray<State>::kUnassigned) {
+      cells.cluster_ids[root] = next_cluster_id++;
+    }
+    cells.cluster_ids[index] = cells.cluster_ids[root];
+  }
+}
+
 }  // namespace clusterizer_detail
 
 /// Parameters used to construct a ParticleClusterizer instance.
@@ -284,28 +551,55 @@ class ParticleClusterizer {
 
   /// Clusters the given particles based on their states and weights.
   /**
+   * Writes the per-particle cluster IDs into an existing vector, reusing the internal
+   * buffers of this instance. Repeated calls on a warmed-up instance do not allocate.
+   *
    * \tparam States Range type of the states.
    * \tparam Weights Range type of the weights.
    * \param states Range containing the states of the particles.
    * \param weights Range containing the weights of the particles.
-   * \return A vector of cluster IDs corresponding to the input particles.
+   * \param clusters Output vector of cluster IDs corresponding to the input particles.
    */
   template <class States, class Weights>
-  [[nodiscard]] auto operator()(States&& states, Weights&& weights) {
-    auto hashes = states | ranges::views::transform(spatial_hash_function_) | ranges::to<std::vector>;
+  void cluster_into(States&& states, Weights&& weights, std::vector<std::size_t>& clusters) {
+    hashes_.clear();
+    for (const auto& state : states) {
+      hashes_.push_back(spatial_hash_function_(state));
+    }
 
-    auto map = clusterizer_detail::make_cluster_map(states, weights, hashes);
-    clusterizer_detail::normalize_and_cap_weights(map, parameters_.weight_cap_percentile);
-    clusterizer_detail::assign_clusters(map, [this](const auto& state) { return neighbors(state); });
+    clusterizer_detail::populate_cluster_cell_array(states, weights, hashes_, cells_, scratch_);
+    clusterizer_detail::normalize_and_cap_weights(cells_, parameters_.weight_cap_percentile, scratch_);
+    clusterizer_detail::assign_clusters(cells_, [this](const auto& state) { return neighbors(state); }, scratch_);
 
-    return hashes |  //
-           ranges::views::transform([&map](std::size_t hash) { return map[hash].cluster_id.value(); }) |
-           ranges::to<std::vector>;
+    clusters.clear();
+    for (const std::size_t hash : hashes_) {
+      const auto it = std::lower_bound(cells_.hashes.begin(), cells_.hashes.end(), hash);
+      clusters.push_back(cells_.cluster_ids[static_cast<std::size_t>(std::distance(cells_.hashes.begin(), it))]);
+    }
+  }
+
+  /// Clusters the given particles based on their states and weights.
+  /**
+   * \tparam States Range type of the states.
+   * \tparam Weights Range type of the weights.
+   * \param states Range containing the states of the particles.
+   * \param weights Range containing the weights of the particles.
+   * \return A vector of cluster IDs corresponding to the input particles.
+   */
+  template <class States, class Weights>
+  [[nodiscard]] auto operator()(States&& states, Weights&& weights) {
+    std::vector<std::size_t> clusters;
+    cluster_into(states, weights, clusters);
+    return clusters;
   }
 
  private:
   ParticleClusterizerParam parameters_;  ///< Parameters for the particle clusterizer.
 
+  std::vector<std::size_t> hashes_;                             ///< Reused per-particle hash buffer.
+  clusterizer_detail::ClusterCellArray<Sophus::SE2d> cells_;    ///< Reused per-cell storage.
+  clusterizer_detail::ClusterizerScratch scratch_;              ///< Reused clusterization scratch buffers.
+
   beluga::spatial_hash<Sophus::SE2d> spatial_hash_function_{
       parameters_.linear_hash_resolution,  // x
       parameters_.linear_hash_resolution,  // y
@@ -398,12 +692,104 @@ template <class States, class Weights, class Clusters>
          ranges::to<std::vector>;
 }
 
+/// Stateful cluster-based estimator that reuses its storage across calls.
+/**
+ * Computes the same estimate as beluga::cluster_based_estimate, but all intermediate
+ * buffers are owned by the estimator and only ever grow, they are never released, so
+ * repeated calls do not allocate in steady state. Like
+ * beluga::ThrunRecoveryProbabilityEstimator, an instance is meant to be constructed
+ * once and then invoked once per filter update.
+ */
+class ClusterBasedEstimator {
+ public:
+  /// State type of a particle.
+  using state_type = Sophus::SE2d;
+
+  /// Constructor.
+  /**
+   * \param parameters Parameters for the particle clusterizer (optional).
+   */
+  explicit ClusterBasedEstimator(const ParticleClusterizerParam& parameters = {}) : clusterizer_{parameters} {}
+
+  /// Computes a cluster-based estimate from a particle range.
+  /**
+   * \tparam Particles A sized random access range containing particles.
+   * \param particles The particle set.
+   * \return A pair consisting of the state mean and covariance of the cluster with the highest total weight.
+   */
+  template <class Particles>
+  [[nodiscard]] auto operator()(Particles&& particles) {
+    static_assert(beluga::is_particle_range_v<Particles>);
+    return (*this)(beluga::views::states(particles), beluga::views::weights(particles));
+  }
+
+  /// \overload That takes separate state and weight ranges.
+  template <class States, class Weights>
+  [[nodiscard]] auto operator()(States&& states, Weights&& weights) {
+    clusterizer_.cluster_into(states, weights, clusters_);
+
+    // Sort particle indices by cluster id so that each cluster forms a contiguous run.
+    indices_.resize(clusters_.size());
+    std::iota(indices_.begin(), indices_.end(), std::size_t{0});
+    std::sort(indices_.begin(), indices_.end(), [this](std::size_t lhs, std::size_t rhs) {
+      return clusters_[lhs] < clusters_[rhs];
+    });
+
+    const auto states_first = ranges::begin(states);
+    const auto weights_first = ranges::begin(weights);
+
+    // Estimate each cluster over its contiguous run of indices and keep the estimate of the
+    // cluster with the highest total weight. If there's only one sample in the cluster we
+    // can't estimate the covariance, so such clusters are skipped.
+    bool found = false;
+    double best_weight = 0.0;
+    std::pair<Sophus::SE2d, Sophus::Matrix3d> best;
+    for (std::size_t i = 0; i < indices_.size();) {
+      std::size_t j = i + 1;
+      while (j < indices_.size() && clusters_[indices_[j]] == clusters_[indices_[i]]) {
+        ++j;
+      }
+      if (j - i > 1) {
+        auto run = ranges::views::slice(indices_, static_cast<std::ptrdiff_t>(i), static_cast<std::ptrdiff_t>(j));
+        auto run_states = run | ranges::views::transform([&states_first](std::size_t index) {
+                            return states_first[static_cast<std::ptrdiff_t>(index)];
+                          });
+        auto run_weights = run | ranges::views::transform([&weights_first](std::size_t index) -> double {
+                             return weights_first[static_cast<std::ptrdiff_t>(index)];
+                           });
+        const double total_weight = ranges::accumulate(run_weights, 0.0);
+        if (!found || total_weight > best_weight) {
+          found = true;
+          best_weight = total_weight;
+          best = beluga::estimate(run_states, run_weights);
+        }
+      }
+      i = j;
+    }
+
+    if (!found) {
+      // hmmm... maybe the particles are too fragmented? calculate the overall mean and covariance.
+      return beluga::estimate(states, weights);
+    }
+
+    return best;
+  }
+
+ private:
+  ParticleClusterizer clusterizer_;    ///< Stateful particle clusterizer.
+  std::vector<std::size_t> clusters_;  ///< Reused per-particle cluster id buffer.
+  std::vector<std::size_t> indices_;   ///< Reused particle indices, sorted by cluster id.
+};
+
 /// Computes a cluster-based estimate from a particle set.
 /**
  * Particles are grouped into clusters around local maxima. The state mean and covariance
  * of the cluster with the highest total weight is returned. If no clusters are found,
  * the overall mean and covariance of the particles are calculated and returned.
  *
+ * Prefer a long-lived beluga::ClusterBasedEstimator instance when calling repeatedly,
+ * since this function allocates its working storage on every call.
+ *
  * \tparam States Range type of the states.
  * \tparam Weights Range type of the weights.
  * \param states Range containing the states of the particles.
@@ -416,19 +802,8 @@ template <class States, class Weights>
     States&& states,    //
     Weights&& weights,  //
     ParticleClusterizerParam parameters = {}) {
-  const auto clusters = ParticleClusterizer{parameters}(states, weights);
-
-  auto per_cluster_estimates = estimate_clusters(states, weights, clusters);
-
-  if (per_cluster_estimates.empty()) {
-    // hmmm... maybe the particles are too fragmented? calculate the overall mean and covariance.
-    return beluga::estimate(states, weights);
-  }
-
-  const auto [_, mean, covariance] =
-      *ranges::max_element(per_cluster_estimates, std::less{}, [](const auto& e) { return e.weight; });
-
-  return std::make_pair(mean, covariance);
+  ClusterBasedEstimator estimator{parameters};
+  return estimator(std::forward<States>(states), std::forward<Weights>(weights));
 }
 
 }  // namespace beluga
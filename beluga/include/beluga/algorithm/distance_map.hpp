@@ -15,7 +15,15 @@
 #ifndef BELUGA_ALGORITHM_DISTANCE_MAP_HPP
 #define BELUGA_ALGORITHM_DISTANCE_MAP_HPP
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <limits>
+#include <memory>
+#include <numeric>
 #include <queue>
+#include <type_traits>
 #include <vector>
 
 #include <range/v3/range/access.hpp>
@@ -49,22 +57,31 @@ namespace beluga {
  *  neighbors_function(i) returns the cell indexes of neighbor cells in the
  *  obstacle map.
  * \param max_distance_value The maximum distance anywhere in the map. Values over this will be truncated to this value.
+ * \param allocator Allocator for the returned map and internal scratch storage. The
+ *  default allocates untracked; pass a \ref TrackingAllocator to attribute the memory
+ *  to a subsystem.
  * \return A map where each cell value is the distance to the nearest object.
  */
-template <class Range, class DistanceFunction, class NeighborsFunction>
+template <
+    class Range,
+    class DistanceFunction,
+    class NeighborsFunction,
+    class Allocator = std::allocator<std::invoke_result_t<DistanceFunction, std::size_t, std::size_t>>>
 auto nearest_obstacle_distance_map(
     Range&& obstacle_mask,
     DistanceFunction&& distance_function,
     NeighborsFunction&& neighbors_function,
-    std::invoke_result_t<DistanceFunction, std::size_t, std::size_t> max_distance_value) {
+    std::invoke_result_t<DistanceFunction, std::size_t, std::size_t> max_distance_value,
+    Allocator allocator = {}) {
   struct IndexPair {
     std::size_t nearest_obstacle_index;
     std::size_t index;
   };
 
   using DistanceType = std::invoke_result_t<DistanceFunction, std::size_t, std::size_t>;
-  auto distance_map = std::vector<DistanceType>(ranges::size(obstacle_mask), max_distance_value);
-  auto visited = std::vector<bool>(ranges::size(obstacle_mask), false);
+  using BoolAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<bool>;
+  auto distance_map = std::vector<DistanceType, Allocator>(ranges::size(obstacle_mask), max_distance_value, allocator);
+  auto visited = std::vector<bool, BoolAllocator>(ranges::size(obstacle_mask), false, BoolAllocator{allocator});
 
   auto compare = [&distance_map](const IndexPair& first, const IndexPair& second) {
     return distance_map[first.index] > distance_map[second.index];
@@ -97,6 +114,176 @@ auto nearest_obstacle_distance_map(
   return distance_map;
 }
 
+namespace detail {
+
+/// One-dimensional squared Euclidean distance transform over a single scanline.
+/**
+ * Implements the lower-envelope-of-parabolas algorithm from Felzenszwalb & Huttenlocher,
+ * "Distance Transforms of Sampled Functions" (2012), in O(n).
+ *
+ * \param source Input costs, one per scanline cell. Only the first `size` entries are read.
+ * \param output Transformed costs, `output[q] = min_p (source[p] + (q - p)^2)`.
+ * \param vertices Scratch buffer for parabola vertices, at least `size` entries.
+ * \param boundaries Scratch buffer for parabola intersections, at least `size + 1` entries.
+ * \param size Scanline length.
+ */
+template <class DistanceType>
+void squared_distance_transform_1d(
+    const std::vector<DistanceType>& source,
+    std::vector<DistanceType>& output,
+    std::vector<std::size_t>& vertices,
+    std::vector<DistanceType>& boundaries,
+    std::size_t size) {
+  constexpr auto kInfinity = std::numeric_limits<DistanceType>::infinity();
+  std::size_t k = 0;
+  vertices[0] = 0;
+  boundaries[0] = -kInfinity;
+  boundaries[1] = kInfinity;
+  for (std::size_t q = 1; q < size; ++q) {
+    const auto qd = static_cast<DistanceType>(q);
+    DistanceType intersection;
+    for (;;) {
+      const auto pd = static_cast<DistanceType>(vertices[k]);
+      intersection = ((source[q] + qd * qd) - (source[vertices[k]] + pd * pd)) / (2 * (qd - pd));
+      if (intersection <= boundaries[k]) {
+        --k;  // The new parabola hides the current one; drop it from the envelope.
+      } else {
+        break;
+      }
+    }
+    ++k;
+    vertices[k] = q;
+    boundaries[k] = intersection;
+    boundaries[k + 1] = kInfinity;
+  }
+  k = 0;
+  for (std::size_t q = 0; q < size; ++q) {
+    const auto qd = static_cast<DistanceType>(q);
+    while (boundaries[k + 1] < qd) {
+      ++k;
+    }
+    const auto pd = static_cast<DistanceType>(vertices[k]);
+    output[q] = (qd - pd) * (qd - pd) + source[vertices[k]];
+  }
+}
+
+}  // namespace detail
+
+/// Returns a map where the value of each cell is the squared distance to the nearest obstacle.
+/**
+ * Separable two-pass exact Euclidean distance transform (Felzenszwalb & Huttenlocher),
+ * using O(N) sequential row and column scans instead of the O(N log N) heap-based
+ * propagation of beluga::nearest_obstacle_distance_map. Restricted to regular 2D grids
+ * with row-major cell layout.
+ *
+ * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+ * \tparam Range A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range).
+ *  Its value type must be bool.
+ * \tparam DistanceType A floating point type for the resulting distances.
+ * \param policy The execution policy to use; scanlines within each pass are
+ *  independent and run concurrently under a parallel policy.
+ * \param obstacle_mask A mask that represents obstacles in an environment,
+ *  in row-major order. If the value of a cell is True, the cell has an obstacle.
+ * \param width Grid width. Must evenly divide the mask size.
+ * \param squared_resolution Squared world distance between two adjacent cells.
+ * \param max_distance_value The maximum squared distance anywhere in the map.
+ *  Values over this will be truncated to this value.
+ * \param allocator Allocator for the returned map. The default allocates untracked;
+ *  pass a \ref TrackingAllocator to attribute the memory to a subsystem.
+ * \return A map where each cell value is the squared distance to the nearest obstacle.
+ */
+template <
+    class ExecutionPolicy,
+    class Range,
+    class DistanceType,
+    class Allocator = std::allocator<DistanceType>,
+    std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0>
+auto nearest_obstacle_distance_map_2d(
+    ExecutionPolicy&& policy,
+    Range&& obstacle_mask,
+    std::size_t width,
+    DistanceType squared_resolution,
+    DistanceType max_distance_value,
+    Allocator allocator = {}) {
+  static_assert(std::is_floating_point_v<DistanceType>);
+  const std::size_t size = ranges::size(obstacle_mask);
+  assert(width > 0);
+  assert(size % width == 0);
+  const std::size_t height = size / width;
+
+  // Large finite placeholder for cells with no obstacle in sight, so the
+  // envelope arithmetic never mixes infinities; truncated away at the end.
+  constexpr auto kUnknown = static_cast<DistanceType>(1e20);
+
+  auto field = std::vector<DistanceType, Allocator>(size, allocator);
+  for (auto [index, is_obstacle] : ranges::views::enumerate(obstacle_mask)) {
+    field[index] = is_obstacle ? DistanceType{0} : kUnknown;
+  }
+
+  // The transform is separable, so scanlines within a pass are independent
+  // and can run concurrently without any boundary merging.
+  const auto transform_scanline = [&field](std::size_t start, std::size_t stride, std::size_t count) {
+    // Scanline scratch is thread-local so concurrent scanlines neither
+    // allocate per call nor share state.
+    static thread_local std::vector<DistanceType> source;
+    static thread_local std::vector<DistanceType> transformed;
+    static thread_local std::vector<std::size_t> vertices;
+    static thread_local std::vector<DistanceType> boundaries;
+    if (source.size() < count) {
+      source.resize(count);
+      transformed.resize(count);
+      vertices.resize(count);
+      boundaries.resize(count + 1);
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      source[i] = field[start + i * stride];
+    }
+    detail::squared_distance_transform_1d(source, transformed, vertices, boundaries, count);
+    for (std::size_t i = 0; i < count; ++i) {
+      field[start + i * stride] = transformed[i];
+    }
+  };
+
+  auto indices = std::vector<std::size_t>(std::max(width, height));
+  std::iota(indices.begin(), indices.end(), std::size_t{0});
+
+  // Column pass, in cell units.
+  std::for_each(
+      policy, indices.begin(), indices.begin() + static_cast<std::ptrdiff_t>(width),
+      [&transform_scanline, width, height](std::size_t x) { transform_scanline(x, width, height); });
+
+  // Row pass, in cell units.
+  std::for_each(
+      policy, indices.begin(), indices.begin() + static_cast<std::ptrdiff_t>(height),
+      [&transform_scanline, width](std::size_t y) { transform_scanline(y * width, 1, width); });
+
+  // Scale cell distances to world units and truncate.
+  std::transform(
+      policy, field.begin(), field.end(), field.begin(),
+      [squared_resolution, max_distance_value](DistanceType value) {
+        return std::min(value * squared_resolution, max_distance_value);
+      });
+
+  return field;
+}
+
+/// Overload that defaults to sequential execution.
+template <
+    class Range,
+    class DistanceType,
+    class Allocator = std::allocator<DistanceType>,
+    std::enable_if_t<ranges::range<Range>, int> = 0>
+auto nearest_obstacle_distance_map_2d(
+    Range&& obstacle_mask,
+    std::size_t width,
+    DistanceType squared_resolution,
+    DistanceType max_distance_value,
+    Allocator allocator = {}) {
+  return nearest_obstacle_distance_map_2d(
+      std::execution::seq, std::forward<Range>(obstacle_mask), width, squared_resolution, max_distance_value,
+      std::move(allocator));
+}
+
 }  // namespace beluga
 
 #endif
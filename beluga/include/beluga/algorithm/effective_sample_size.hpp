@@ -15,6 +15,8 @@
 #ifndef BELUGA_ALGORITHM_EFFECTIVE_SAMPLE_SIZE_HPP
 #define BELUGA_ALGORITHM_EFFECTIVE_SAMPLE_SIZE_HPP
 
+#include <cstddef>
+
 #include <beluga/type_traits/particle_traits.hpp>
 #include <beluga/views/particles.hpp>
 
@@ -27,6 +29,45 @@
 
 namespace beluga {
 
+/// Aggregated weight statistics optionally accumulated by weight-processing actions.
+/**
+ * Actions that already sweep the weight column (e.g. `beluga::actions::normalize` and
+ * `beluga::actions::reweight_normalized`) can fill one of these in the same pass, so
+ * consumers like the `beluga::policies::on_effective_size_drop` policy can read a
+ * precomputed effective sample size instead of triggering another full pass.
+ */
+struct WeightStatistics {
+  /// Sum of the weights.
+  double total_weight = 0.0;
+  /// Sum of the squared weights.
+  double squared_total_weight = 0.0;
+  /// Number of weights accumulated.
+  std::size_t sample_count = 0;
+
+  /// Effective sample size implied by the accumulated sums.
+  /**
+   * Computed as \f$(\sum w)^2 / \sum w^2\f$, which is invariant under weight scaling.
+   */
+  [[nodiscard]] double effective_sample_size() const {
+    if (squared_total_weight <= 0.0) {
+      return 0.0;
+    }
+    return (total_weight * total_weight) / squared_total_weight;
+  }
+
+  /// Mean weight implied by the accumulated sums.
+  /**
+   * Consumers like the \ref ThrunRecoveryProbabilityEstimator can read it
+   * instead of averaging the weight column in a pass of their own.
+   */
+  [[nodiscard]] double average_weight() const {
+    if (sample_count == 0) {
+      return 0.0;
+    }
+    return total_weight / static_cast<double>(sample_count);
+  }
+};
+
 /// Calculate the ESS of a given a range of weights.
 /**
  * The effective sample size (ESS) is a figure of merit for importance sampling methods' output. It characterizes
@@ -24,8 +24,16 @@
 #include <sophus/so3.hpp>
 #include <sophus/types.hpp>
 
+#include <cassert>
+#include <cmath>
+#include <execution>
+#include <functional>
+#include <limits>
 #include <numeric>
 #include <type_traits>
+#include <utility>
+
+#include <beluga/utility/tracepoints.hpp>
 
 /**
  * \file
@@ -404,6 +412,189 @@ namespace detail {
 
 /// \cond detail
 
+/// Mergeable weighted first and second moment accumulator for fixed-size Eigen column vectors.
+/**
+ * Single elements and partial accumulations merge through `operator+` using the
+ * weighted variant of Chan et al.'s parallel update, so accumulators can be
+ * tree-reduced; merging elements one at a time degenerates to the weighted
+ * Welford recurrence.
+ */
+template <class Vector>
+struct VectorMoments {
+  /// Scalar type of the accumulated vectors.
+  using Scalar = typename Vector::Scalar;
+  /// Compile-time dimension of the accumulated vectors.
+  static constexpr int kDim = Vector::RowsAtCompileTime;
+
+  /// Running weighted mean.
+  Vector mean = Vector::Zero();
+  /// Running scatter matrix around the mean (covariance times the weight sum).
+  Eigen::Matrix<Scalar, kDim, kDim> scatter = Eigen::Matrix<Scalar, kDim, kDim>::Zero();
+  /// Sum of weights.
+  Scalar weight_sum{0};
+  /// Sum of squared weights.
+  Scalar squared_weight_sum{0};
+
+  /// Constructs an empty accumulator.
+  VectorMoments() = default;
+
+  /// Constructs an accumulator holding a single weighted value.
+  VectorMoments(const Vector& value, Scalar weight) {
+    if (weight > Scalar{0}) {
+      mean = value;
+      weight_sum = weight;
+      squared_weight_sum = weight * weight;
+    }
+  }
+
+  /// Merges two accumulators.
+  friend VectorMoments operator+(VectorMoments lhs, const VectorMoments& rhs) {
+    if (rhs.weight_sum == Scalar{0}) {
+      return lhs;
+    }
+    if (lhs.weight_sum == Scalar{0}) {
+      return rhs;
+    }
+    const Scalar total = lhs.weight_sum + rhs.weight_sum;
+    const Vector delta = rhs.mean - lhs.mean;
+    lhs.scatter += rhs.scatter + (lhs.weight_sum * rhs.weight_sum / total) * delta * delta.transpose();
+    lhs.mean += (rhs.weight_sum / total) * delta;
+    lhs.weight_sum = total;
+    lhs.squared_weight_sum += rhs.squared_weight_sum;
+    return lhs;
+  }
+};
+
+/// Mergeable weighted moment accumulator for SE2 elements.
+/**
+ * Tracks the running weighted mean of all four SE2 coefficients together with
+ * the scatter of the translation part, which is all beluga::estimate needs: the
+ * orientation dispersion comes from the norm of the averaged complex instead of
+ * a scatter matrix. Merging follows the same scheme as beluga::detail::VectorMoments.
+ */
+template <class Scalar>
+struct SE2Moments {
+  /// Running weighted mean of the SE2 coefficients (complex first, then translation).
+  Sophus::Vector4<Scalar> mean_vector = Sophus::Vector4<Scalar>::Zero();
+  /// Running scatter matrix of the translation part around its mean.
+  Sophus::Matrix2<Scalar> translation_scatter = Sophus::Matrix2<Scalar>::Zero();
+  /// Sum of weights.
+  Scalar weight_sum{0};
+  /// Sum of squared weights.
+  Scalar squared_weight_sum{0};
+
+  /// Constructs an empty accumulator.
+  SE2Moments() = default;
+
+  /// Constructs an accumulator holding a single weighted value.
+  SE2Moments(const Sophus::SE2<Scalar>& value, Scalar weight) {
+    if (weight > Scalar{0}) {
+      mean_vector = Eigen::Map<const Sophus::Vector4<Scalar>>{value.data()};
+      weight_sum = weight;
+      squared_weight_sum = weight * weight;
+    }
+  }
+
+  /// Merges two accumulators.
+  friend SE2Moments operator+(SE2Moments lhs, const SE2Moments& rhs) {
+    if (rhs.weight_sum == Scalar{0}) {
+      return lhs;
+    }
+    if (lhs.weight_sum == Scalar{0}) {
+      return rhs;
+    }
+    const Scalar total = lhs.weight_sum + rhs.weight_sum;
+    const Sophus::Vector2<Scalar> delta = rhs.mean_vector.template tail<2>() - lhs.mean_vector.template tail<2>();
+    lhs.translation_scatter +=
+        rhs.translation_scatter + (lhs.weight_sum * rhs.weight_sum / total) * delta * delta.transpose();
+    lhs.mean_vector += (rhs.weight_sum / total) * (rhs.mean_vector - lhs.mean_vector);
+    lhs.weight_sum = total;
+    lhs.squared_weight_sum += rhs.squared_weight_sum;
+    return lhs;
+  }
+};
+
+/// Mergeable weighted mean accumulator for SE3 elements.
+/**
+ * Accumulates the weighted quaternion outer product sum used for quaternion
+ * averaging (see beluga::detail::mean_fn) and the weighted translation sum.
+ * Unlike beluga::detail::VectorMoments it tracks first moments only: the SE3
+ * covariance lives in the tangent space around the mean, so it requires a
+ * second pass once the mean is known.
+ */
+template <class Scalar>
+struct SE3MeanMoments {
+  /// Sum of the outer products of the weighted quaternion coefficients.
+  Eigen::Matrix<Scalar, 4, 4> quaternion_outer_product_sum = Eigen::Matrix<Scalar, 4, 4>::Zero();
+  /// Weighted sum of the translation parts.
+  Sophus::Vector3<Scalar> weighted_translation_sum = Sophus::Vector3<Scalar>::Zero();
+  /// Sum of weights.
+  Scalar weight_sum{0};
+  /// Sum of squared weights.
+  Scalar squared_weight_sum{0};
+
+  /// Constructs an empty accumulator.
+  SE3MeanMoments() = default;
+
+  /// Constructs an accumulator holding a single weighted value.
+  SE3MeanMoments(const Sophus::SE3<Scalar>& value, Scalar weight) {
+    if (weight > Scalar{0}) {
+      const Sophus::Vector4<Scalar> weighted_coefficients = weight * value.unit_quaternion().coeffs();
+      quaternion_outer_product_sum = weighted_coefficients * weighted_coefficients.transpose();
+      weighted_translation_sum = weight * value.translation();
+      weight_sum = weight;
+      squared_weight_sum = weight * weight;
+    }
+  }
+
+  /// Merges two accumulators.
+  friend SE3MeanMoments operator+(SE3MeanMoments lhs, const SE3MeanMoments& rhs) {
+    lhs.quaternion_outer_product_sum += rhs.quaternion_outer_product_sum;
+    lhs.weighted_translation_sum += rhs.weighted_translation_sum;
+    lhs.weight_sum += rhs.weight_sum;
+    lhs.squared_weight_sum += rhs.squared_weight_sum;
+    return lhs;
+  }
+};
+
+/// Computes the SE2 estimate (mean and covariance) from accumulated moments.
+template <class Scalar>
+auto se2_estimate_from_moments(const SE2Moments<Scalar>& moments)
+    -> std::pair<Sophus::SE2<Scalar>, Sophus::Matrix3<Scalar>> {
+  assert(moments.weight_sum > Scalar{0});
+
+  // Notice that after averaging the complex representation of the orientation the resulting complex is not on the
+  // unit circle. This is expected and the value will be renormalized after having used the non-normal result to
+  // estimate the orientation autocovariance.
+  auto mean = Sophus::SE2<Scalar>{Eigen::Map<const Sophus::SE2<Scalar>>{moments.mean_vector.data()}};
+  auto covariance = Sophus::Matrix3<Scalar>::Zero().eval();
+
+  // Compute the covariance of the translation part, applying the correction
+  // factor to yield an unbiased estimator.
+  const auto squared_normalized_weight_sum =
+      moments.squared_weight_sum / (moments.weight_sum * moments.weight_sum);
+  assert(squared_normalized_weight_sum < 1.0);
+  covariance.template topLeftCorner<2, 2>() =
+      moments.translation_scatter / moments.weight_sum / (1.0 - squared_normalized_weight_sum);
+
+  // Compute the orientation variance and re-normalize the rotation component (after using the non-normal result).
+  if (mean.so2().unit_complex().norm() < std::numeric_limits<double>::epsilon()) {
+    // Handle the case where both averages are too close to zero.
+    // Return zero yaw and infinite variance.
+    covariance.coeffRef(2, 2) = std::numeric_limits<double>::infinity();
+    mean.so2() = Sophus::SO2<Scalar>{0.0};
+    // TODO(nahuel): Consider breaking the existing API and return
+    // an optional to handle degenerate cases just like Sophus does.
+  } else {
+    // See circular standard deviation in
+    // https://en.wikipedia.org/wiki/Directional_statistics#Dispersion.
+    covariance.coeffRef(2, 2) = -2.0 * std::log(mean.so2().unit_complex().norm());
+    mean.so2().normalize();
+  }
+
+  return std::make_pair(mean, covariance);
+}
+
 struct estimate_fn {
   template <
       class Values,
@@ -417,12 +608,14 @@ struct estimate_fn {
     static_assert(ranges::forward_range<Values>);   // must allow multi-pass
     static_assert(ranges::forward_range<Weights>);  // must allow multi-pass
 
+    BELUGA_TRACEPOINT(estimate_begin);
     auto normalized_weights = weights | ranges::views::transform([sum = ranges::accumulate(weights, 0.0)](auto weight) {
                                 return weight / sum;
                               });
 
     const auto mean = beluga::mean(values, normalized_weights);
     const auto variance = beluga::covariance(values, normalized_weights, mean);
+    BELUGA_TRACEPOINT(estimate_end);
     return std::make_pair(mean, variance);
   }
 
@@ -433,44 +626,160 @@ struct estimate_fn {
       class Scalar = typename Value::Scalar,
       class = std::enable_if_t<std::is_base_of_v<Sophus::SE2Base<Value>, Value>>>
   auto operator()(Values&& values, Weights&& weights) const -> std::pair<Sophus::SE2<Scalar>, Sophus::Matrix3<Scalar>> {
-    static_assert(ranges::forward_range<Values>);   // must allow multi-pass
-    static_assert(ranges::forward_range<Weights>);  // must allow multi-pass
+    // Accumulate first and second moments together in a single pass over the states, merging each
+    // element into a running moment accumulator (a weighted Welford recurrence). This matches the
+    // two-pass mean-then-covariance formulation up to floating point rounding while halving the
+    // traversals, and needs no upfront weight normalization since the running mean normalizes as
+    // it goes.
+    BELUGA_TRACEPOINT(estimate_begin);
+    auto it = ranges::begin(values);
+    const auto last = ranges::end(values);
+    auto weights_it = ranges::begin(weights);
 
-    auto normalized_weights = weights | ranges::views::transform([sum = ranges::accumulate(weights, 0.0)](auto weight) {
-                                return weight / sum;
-                              });
+    assert(it != last);
+    assert(weights_it != ranges::end(weights));
 
-    // Compute the average of all the coefficients of the SE2 group elements and construct a new SE2 element. Notice
-    // that after averaging the complex representation of the orientation the resulting complex is not on the unit
-    // circle. This is expected and the value will be renormalized after having used the non-normal result to estimate
-    // the orientation autocovariance.
-    const Sophus::Vector4<Scalar> mean_vector = beluga::mean(values, normalized_weights, [](const auto& value) {
-      return Eigen::Map<const Sophus::Vector4<Scalar>>{value.data()};
-    });
-
-    auto mean = Sophus::SE2<Scalar>{Eigen::Map<const Sophus::SE2<Scalar>>{mean_vector.data()}};
-    auto covariance = Sophus::Matrix3<Scalar>::Zero().eval();
-
-    // Compute the covariance of the translation part.
-    covariance.template topLeftCorner<2, 2>() = beluga::covariance(
-        values, normalized_weights, mean.translation(), [](const auto& value) { return value.translation(); });
-
-    // Compute the orientation variance and re-normalize the rotation component (after using the non-normal result).
-    if (mean.so2().unit_complex().norm() < std::numeric_limits<double>::epsilon()) {
-      // Handle the case where both averages are too close to zero.
-      // Return zero yaw and infinite variance.
-      covariance.coeffRef(2, 2) = std::numeric_limits<double>::infinity();
-      mean.so2() = Sophus::SO2<Scalar>{0.0};
-      // TODO(nahuel): Consider breaking the existing API and return
-      // an optional to handle degenerate cases just like Sophus does.
-    } else {
-      // See circular standard deviation in
-      // https://en.wikipedia.org/wiki/Directional_statistics#Dispersion.
-      covariance.coeffRef(2, 2) = -2.0 * std::log(mean.so2().unit_complex().norm());
-      mean.so2().normalize();
+    auto moments = SE2Moments<Scalar>{};
+    for (; it != last; ++weights_it, ++it) {
+      moments = moments + SE2Moments<Scalar>{*it, static_cast<Scalar>(*weights_it)};
     }
 
-    return std::make_pair(mean, covariance);
+    assert(weights_it == ranges::end(weights));
+    auto estimate = se2_estimate_from_moments(moments);
+    BELUGA_TRACEPOINT(estimate_end);
+    return estimate;
+  }
+
+  /// Overload for SE2 elements that reduces moments in parallel under an execution policy.
+  template <
+      class ExecutionPolicy,
+      class Values,
+      class Weights,
+      class Value = std::decay_t<ranges::range_value_t<Values>>,
+      class Scalar = typename Value::Scalar,
+      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<std::is_base_of_v<Sophus::SE2Base<Value>, Value>, int> = 0>
+  auto operator()(ExecutionPolicy&& policy, Values&& values, Weights&& weights) const
+      -> std::pair<Sophus::SE2<Scalar>, Sophus::Matrix3<Scalar>> {
+    BELUGA_TRACEPOINT(estimate_begin);
+    auto values_view = ranges::views::all(values) | ranges::views::common;
+    auto weights_view = ranges::views::all(weights) | ranges::views::common;
+    using Moments = SE2Moments<Scalar>;
+    // Per-thread partial moment accumulators are tree-reduced; merging is associative
+    // and commutative, so any reduction order yields the same estimate up to floating
+    // point rounding.
+    const auto moments = std::transform_reduce(
+        policy, ranges::begin(values_view), ranges::end(values_view), ranges::begin(weights_view), Moments{},
+        std::plus<>{}, [](const auto& value, auto weight) { return Moments{value, static_cast<Scalar>(weight)}; });
+    auto estimate = se2_estimate_from_moments(moments);
+    BELUGA_TRACEPOINT(estimate_end);
+    return estimate;
+  }
+
+  /// Overload for SE3 elements that reduces moments in parallel under an execution policy.
+  /**
+   * The SE3 covariance lives in the tangent space around the mean, so this overload runs two
+   * parallel reductions: one for the mean moments and one for the tangent space scatter.
+   */
+  template <
+      class ExecutionPolicy,
+      class Values,
+      class Weights,
+      class Value = std::decay_t<ranges::range_value_t<Values>>,
+      class Scalar = typename Value::Scalar,
+      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<std::is_base_of_v<Sophus::SE3Base<Value>, Value>, int> = 0>
+  auto operator()(ExecutionPolicy&& policy, Values&& values, Weights&& weights) const
+      -> std::pair<Sophus::SE3<Scalar>, typename Sophus::SE3<Scalar>::Adjoint> {
+    BELUGA_TRACEPOINT(estimate_begin);
+    auto values_view = ranges::views::all(values) | ranges::views::common;
+    auto weights_view = ranges::views::all(weights) | ranges::views::common;
+
+    using MeanMoments = SE3MeanMoments<Scalar>;
+    const auto mean_moments = std::transform_reduce(
+        policy, ranges::begin(values_view), ranges::end(values_view), ranges::begin(weights_view), MeanMoments{},
+        std::plus<>{},
+        [](const auto& value, auto weight) { return MeanMoments{value, static_cast<Scalar>(weight)}; });
+    assert(mean_moments.weight_sum > Scalar{0});
+
+    const auto solver =
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix<Scalar, 4, 4>>{mean_moments.quaternion_outer_product_sum};
+    assert(solver.info() == Eigen::Success);
+
+    // Eigen's internal coefficient order is different from the constructor one.
+    // Eigenvalues are sorted in increasing order, so eigenvalue number 3 is the max.
+    Eigen::Quaternion<Scalar> quaternion;
+    quaternion.coeffs() << solver.eigenvectors().col(3).real();
+    const auto mean = Sophus::SE3<Scalar>{
+        Sophus::SO3<Scalar>{quaternion}, mean_moments.weighted_translation_sum / mean_moments.weight_sum};
+
+    using Adjoint = typename Sophus::SE3<Scalar>::Adjoint;
+    const auto inverse_mean = mean.inverse();
+    const auto scatter = std::transform_reduce(
+        policy, ranges::begin(values_view), ranges::end(values_view), ranges::begin(weights_view),
+        Adjoint::Zero().eval(), std::plus<>{}, [&inverse_mean](const auto& value, auto weight) {
+          const auto centered = (inverse_mean * value).log();
+          return (static_cast<Scalar>(weight) * centered * centered.transpose()).eval();
+        });
+
+    const auto squared_normalized_weight_sum =
+        mean_moments.squared_weight_sum / (mean_moments.weight_sum * mean_moments.weight_sum);
+    assert(squared_normalized_weight_sum < 1.0);
+    // Apply the correction factor to yield an unbiased estimator.
+    auto covariance = (scatter / mean_moments.weight_sum / (1.0 - squared_normalized_weight_sum)).eval();
+    BELUGA_TRACEPOINT(estimate_end);
+    return std::make_pair(mean, std::move(covariance));
+  }
+
+  /// Overload for Eigen vectors that reduces moments in parallel under an execution policy.
+  template <
+      class ExecutionPolicy,
+      class Values,
+      class Weights,
+      class Value = std::decay_t<ranges::range_value_t<Values>>,
+      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<std::is_base_of_v<Eigen::MatrixBase<Value>, Value>, int> = 0>
+  auto operator()(ExecutionPolicy&& policy, Values&& values, Weights&& weights) const {
+    using Scalar = typename Value::Scalar;
+    auto values_view = ranges::views::all(values) | ranges::views::common;
+    auto weights_view = ranges::views::all(weights) | ranges::views::common;
+    using Moments = VectorMoments<typename Value::PlainMatrix>;
+    const auto moments = std::transform_reduce(
+        policy, ranges::begin(values_view), ranges::end(values_view), ranges::begin(weights_view), Moments{},
+        std::plus<>{}, [](const auto& value, auto weight) { return Moments{value, static_cast<Scalar>(weight)}; });
+    assert(moments.weight_sum > Scalar{0});
+    const auto squared_normalized_weight_sum =
+        moments.squared_weight_sum / (moments.weight_sum * moments.weight_sum);
+    assert(squared_normalized_weight_sum < 1.0);
+    // Apply the correction factor to yield an unbiased estimator.
+    auto covariance = (moments.scatter / moments.weight_sum / (1.0 - squared_normalized_weight_sum)).eval();
+    return std::make_pair(moments.mean, std::move(covariance));
+  }
+
+  /// Overload for floating-point values that reduces moments in parallel under an execution policy.
+  template <
+      class ExecutionPolicy,
+      class Values,
+      class Weights,
+      class Value = std::decay_t<ranges::range_value_t<Values>>,
+      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<std::is_floating_point_v<Value>, int> = 0>
+  auto operator()(ExecutionPolicy&& policy, Values&& values, Weights&& weights) const -> std::pair<Value, Value> {
+    auto values_view = ranges::views::all(values) | ranges::views::common;
+    auto weights_view = ranges::views::all(weights) | ranges::views::common;
+    using Moments = VectorMoments<Sophus::Vector<Value, 1>>;
+    const auto moments = std::transform_reduce(
+        policy, ranges::begin(values_view), ranges::end(values_view), ranges::begin(weights_view), Moments{},
+        std::plus<>{}, [](const auto& value, auto weight) {
+          return Moments{Sophus::Vector<Value, 1>{value}, static_cast<Value>(weight)};
+        });
+    assert(moments.weight_sum > Value{0});
+    const auto squared_normalized_weight_sum =
+        moments.squared_weight_sum / (moments.weight_sum * moments.weight_sum);
+    assert(squared_normalized_weight_sum < 1.0);
+    // Apply the correction factor to yield an unbiased estimator.
+    const auto variance = moments.scatter(0, 0) / moments.weight_sum / (1.0 - squared_normalized_weight_sum);
+    return std::make_pair(moments.mean(0), variance);
   }
 
   template <
@@ -502,9 +811,14 @@ struct estimate_fn {
  * It supports floating-point numbers, vectors, and Lie group elements like SE2 and SE3.
  *
  * The function does not assume that the input weights are normalized. It normalizes the weights while iterating,
- * which might have a performance impact. Specifically, the function has to iterate over the weights multiple times
- * (e.g., once to compute the mean, and again to compute the covariance). The normalization factor is computed once, but
- * division for normalizing the weights is performed each time a weight is accessed.
+ * which might have a performance impact. Specifically, the function might have to iterate over the weights multiple
+ * times (e.g., once to compute the mean, and again to compute the covariance). The SE2 overload instead fuses both
+ * moments into a single pass over the states and weights.
+ *
+ * Overloads taking an [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t)
+ * as the first argument tree-reduce per-thread partial moment accumulators and merge them, parallelizing the
+ * estimation over large particle sets. They produce the same estimate as the sequential overloads up to
+ * floating point reduction order.
  */
 inline constexpr detail::estimate_fn estimate;
 
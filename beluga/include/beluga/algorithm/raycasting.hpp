@@ -16,14 +16,23 @@
 #define BELUGA_ALGORITHM_RAYCASTING_HPP
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <optional>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 
+#include <beluga/algorithm/raycasting/amanatides_woo.hpp>
 #include <beluga/algorithm/raycasting/bresenham.hpp>
 
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/primitives.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/take_while.hpp>
 
+#include <sophus/common.hpp>
 #include <sophus/se2.hpp>
 #include <sophus/so2.hpp>
 
@@ -34,6 +43,92 @@
 
 namespace beluga {
 
+namespace detail {
+
+/// Detects grids that provide a hierarchical free block index.
+/**
+ * See beluga::PackedOccupancyGrid2::free_block_log2_size_at() for the expected semantics.
+ */
+template <class Grid, class = void>
+struct has_free_block_index : std::false_type {};
+
+/// Specialization for grids providing `free_block_log2_size_at(int, int)`.
+template <class Grid>
+struct has_free_block_index<
+    Grid,
+    std::void_t<decltype(std::declval<const Grid&>().free_block_log2_size_at(int{}, int{}))>> : std::true_type {};
+
+/// Convenience template variable for beluga::detail::has_free_block_index.
+template <class Grid>
+inline constexpr bool has_free_block_index_v = has_free_block_index<Grid>::value;
+
+}  // namespace detail
+
+/// Memoization cache for 2D ray casting results.
+/**
+ * Caches cast distances keyed by source grid cell and quantized absolute
+ * bearing. Particles concentrated in a few cells cast nearly identical
+ * rays, so sharing results across them trades a bounded bearing
+ * quantization error for skipping most grid traversals altogether.
+ *
+ * Cached results are only meaningful while the grid, the maximum range,
+ * and the miss fallback value stay the same, so callers are expected to
+ * reset() the cache whenever any of them changes (typically once per
+ * scan).
+ */
+class RaycastCache {
+ public:
+  /// Constructs a cache with the default bearing quantization.
+  RaycastCache() = default;
+
+  /// Clears all cached results and updates the bearing quantization.
+  /**
+   * \param bearing_bins Number of discrete bins the full turn is divided into.
+   */
+  void reset(int bearing_bins = kDefaultBearingBins) {
+    results_.clear();
+    bearing_bins_ = bearing_bins;
+  }
+
+  /// Retrieves the cached cast distance for a ray, if any.
+  /**
+   * \param source_cell_index Grid cell index of the ray source.
+   * \param bearing Ray direction in the grid local frame.
+   */
+  [[nodiscard]] std::optional<double> lookup(std::size_t source_cell_index, const Sophus::SO2d& bearing) const {
+    const auto it = results_.find(key_for(source_cell_index, bearing));
+    return it != results_.end() ? std::make_optional(it->second) : std::nullopt;
+  }
+
+  /// Stores the cast distance for a ray.
+  /**
+   * \param source_cell_index Grid cell index of the ray source.
+   * \param bearing Ray direction in the grid local frame.
+   * \param distance Cast distance to be cached.
+   */
+  void store(std::size_t source_cell_index, const Sophus::SO2d& bearing, double distance) {
+    results_.emplace(key_for(source_cell_index, bearing), distance);
+  }
+
+ private:
+  static constexpr int kDefaultBearingBins = 4096;
+
+  [[nodiscard]] std::uint64_t key_for(std::size_t source_cell_index, const Sophus::SO2d& bearing) const {
+    const double angle = bearing.log();  // in [-pi, pi]
+    auto bin = static_cast<std::int64_t>(
+        std::lround((angle + Sophus::Constants<double>::pi()) / (2. * Sophus::Constants<double>::pi()) *
+                    static_cast<double>(bearing_bins_)));
+    if (bin >= bearing_bins_) {
+      bin -= bearing_bins_;  // -pi and pi quantize to the same bin
+    }
+    return static_cast<std::uint64_t>(source_cell_index) * static_cast<std::uint64_t>(bearing_bins_) +
+           static_cast<std::uint64_t>(bin);
+  }
+
+  int bearing_bins_{kDefaultBearingBins};
+  std::unordered_map<std::uint64_t, double> results_;
+};
+
 /// Castable 2D ray.
 /**
  * \tparam OccupancyGrid A 2D occupancy grid
@@ -91,21 +186,113 @@ class Ray2d {
   /**
    * Distances are measured from cell centroid to cell centroid.
    *
+   * For grids exposing a hierarchical free block index (see
+   * beluga::PackedOccupancyGrid2::free_block_log2_size_at()), traced cells
+   * lying in large free regions are skipped in bulk instead of being tested
+   * one at a time, without changing the traced line or the cast result.
+   *
    * \param bearing Direction for ray casting.
    * \return Distance in meters to first non free cell hit by the ray, if any.
    */
   [[nodiscard]] std::optional<double> cast(const Sophus::SO2d& bearing) const {
-    for (const auto& cell : trace(bearing)) {
+    const auto ray = trace(bearing);
+    const auto last = ranges::end(ray);
+    for (auto it = ranges::begin(ray); it != last; ++it) {
+      const auto& cell = *it;
       if (!grid_.free_at(cell)) {
         const auto source_position = grid_.coordinates_at(source_cell_);
         const auto cell_position = grid_.coordinates_at(cell);
         const auto distance = (cell_position - source_position).norm();
         return std::make_optional(std::min(distance, max_range_));
       }
+      if constexpr (detail::has_free_block_index_v<OccupancyGrid>) {
+        const int level = grid_.free_block_log2_size_at(cell.x(), cell.y());
+        if (level > 0) {
+          // Every cell in the enclosing aligned block is free and each trace
+          // step moves at most one cell per axis, monotonically towards the
+          // far end, so cells up to the nearest block edge along the travel
+          // direction need no further testing.
+          const auto direction = (source_pose_in_local_frame_.so2() * bearing).unit_complex();
+          const int block_size = 1 << level;
+          const int block_x = cell.x() & ~(block_size - 1);
+          const int block_y = cell.y() & ~(block_size - 1);
+          const int remaining_x = direction.x() > 0.   ? block_x + block_size - 1 - cell.x()
+                                  : direction.x() < 0. ? cell.x() - block_x
+                                                       : std::numeric_limits<int>::max();
+          const int remaining_y = direction.y() > 0.   ? block_y + block_size - 1 - cell.y()
+                                  : direction.y() < 0. ? cell.y() - block_y
+                                                       : std::numeric_limits<int>::max();
+          for (int skip = std::min(remaining_x, remaining_y); skip > 0 && it != last; --skip) {
+            ++it;
+          }
+          if (it == last) {
+            break;
+          }
+        }
+      }
     }
     return std::nullopt;
   }
 
+  /// Casts a packet of rays, one per bearing.
+  /**
+   * Equivalent to calling cast() once per bearing, but amortizing the
+   * per-source setup (source cell, pose transforms) over the whole packet
+   * and writing results to a caller-provided buffer in struct-of-arrays
+   * form, so per-particle batch casting neither allocates nor chases
+   * optionals in its inner loop.
+   *
+   * \tparam Bearings A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range)
+   *  with `Sophus::SO2d` value type.
+   * \param bearings Directions for ray casting.
+   * \param ranges Output distances in meters, one per bearing, in matching
+   *  order. Resized to fit; any previous content is discarded.
+   * \param miss_value Distance reported for rays that hit no obstacle.
+   */
+  template <class Bearings>
+  void cast_many(const Bearings& bearings, std::vector<double>& ranges, double miss_value) const {
+    ranges.clear();
+    ranges.reserve(ranges::size(bearings));
+    for (const auto& bearing : bearings) {
+      ranges.push_back(cast(bearing).value_or(miss_value));
+    }
+  }
+
+  /// Casts a packet of rays, one per bearing, memoizing results through a cache.
+  /**
+   * Same as cast_many() but consulting (and filling) the given
+   * beluga::RaycastCache first, so rays already cast from the same source
+   * cell along the same quantized bearing are answered without traversing
+   * the grid. Results may differ from uncached casts by the cache bearing
+   * quantization error.
+   *
+   * \tparam Bearings A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range)
+   *  with `Sophus::SO2d` value type.
+   * \param bearings Directions for ray casting.
+   * \param ranges Output distances in meters, one per bearing, in matching
+   *  order. Resized to fit; any previous content is discarded.
+   * \param miss_value Distance reported for rays that hit no obstacle.
+   * \param cache Cache of past results, valid for the current grid,
+   *  maximum range, and miss value.
+   */
+  template <class Bearings>
+  void cast_many(const Bearings& bearings, std::vector<double>& ranges, double miss_value, RaycastCache& cache) const {
+    ranges.clear();
+    ranges.reserve(ranges::size(bearings));
+    const auto source_cell_index = grid_.index_at(source_cell_);
+    const auto& rotation = source_pose_in_local_frame_.so2();
+    for (const auto& bearing : bearings) {
+      const auto absolute_bearing = rotation * bearing;
+      if (const auto cached = cache.lookup(source_cell_index, absolute_bearing); cached.has_value()) {
+        ranges.push_back(*cached);
+        continue;
+      }
+      const double distance = cast(bearing).value_or(miss_value);
+      cache.store(source_cell_index, absolute_bearing, distance);
+      ranges.push_back(distance);
+    }
+  }
+
  private:
   const OccupancyGrid& grid_;
   const Algorithm algorithm_;
@@ -15,9 +15,11 @@
 #ifndef BELUGA_ALGORITHM_SPATIAL_HASH_HPP
 #define BELUGA_ALGORITHM_SPATIAL_HASH_HPP
 
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <ratio>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -93,6 +95,79 @@ constexpr std::size_t hash_impl(
   return (detail::floor_and_fibo_hash<kBits, Ids>(std::get<Ids>(value) / resolution[Ids]) ^ ...);
 }
 
+/// Returns the quantized cell coordinate of a value, biased to be non-negative.
+/**
+ * \tparam N Number of bits to be used for the cell coordinate, centered around zero.
+ * \param value Input value to be quantized.
+ * \return The biased cell coordinate, masked to the N least significant bits.
+ */
+template <std::size_t N>
+constexpr std::size_t floor_and_bias(double value) {
+  static_assert(0 < N && N < std::numeric_limits<std::size_t>::digits);
+  using signed_type = std::make_signed_t<std::size_t>;
+  constexpr auto kBias = signed_type{1} << (N - 1);
+  constexpr auto kMask = (std::size_t{1} << N) - std::size_t{1};
+  return static_cast<std::size_t>(static_cast<signed_type>(std::floor(value)) + kBias) & kMask;
+}
+
+/// Spreads the N least significant bits of a cell coordinate for Morton interleaving.
+/**
+ * \tparam N Number of bits to be spread.
+ * \tparam Stride Number of dimensions being interleaved; consecutive bits of the
+ * input end up Stride positions apart.
+ * \tparam Offset Number of bits the result is shifted by (the dimension index).
+ * \param value The biased cell coordinate to be spread.
+ * \return The spread bits.
+ */
+template <std::size_t N, std::size_t Stride, std::size_t Offset>
+constexpr std::size_t spread_bits(std::size_t value) {
+  std::size_t result = 0;
+  for (std::size_t bit = 0; bit < N; ++bit) {
+    result |= ((value >> bit) & std::size_t{1}) << (bit * Stride + Offset);
+  }
+  return result;
+}
+
+/// Hashes a tuple or array of scalar types by interleaving the quantized cell coordinates.
+/**
+ * \tparam BitsPerDimension Number of bits of cell coordinate kept per dimension.
+ * \tparam T Tuple or array of scalar types.
+ * \tparam ...Ids Indexes of the array/tuple to be used to calculate the hash.
+ * \param value The array/tuple to be hashed.
+ * \param resolution The resolution to be used.
+ * \param index_sequence Unused, only to allow unpacking `...Ids`.
+ * \return The calculated hash.
+ */
+template <std::size_t BitsPerDimension, class T, std::size_t... Ids>
+constexpr std::size_t morton_hash_impl(
+    const T& value,
+    const std::array<double, sizeof...(Ids)>& resolution,
+    [[maybe_unused]] std::index_sequence<Ids...> index_sequence) {
+  return (
+      detail::spread_bits<BitsPerDimension, sizeof...(Ids), Ids>(
+          detail::floor_and_bias<BitsPerDimension>(std::get<Ids>(value) / resolution[Ids])) |
+      ...);
+}
+
+/// Reciprocal of a `std::ratio`, as a `double`.
+template <class Ratio>
+inline constexpr double ratio_reciprocal_v = static_cast<double>(Ratio::den) / static_cast<double>(Ratio::num);
+
+/// Hashes a tuple or array of scalar types with compile-time per-axis resolutions.
+/**
+ * \tparam ResolutionRatios One `std::ratio` resolution per hashed dimension.
+ * \tparam T Tuple or array of scalar types.
+ * \tparam ...Ids Indexes of the array/tuple to be used to calculate the hash.
+ * \param value The array/tuple to be hashed.
+ * \param index_sequence Unused, only to allow unpacking `...Ids`.
+ * \return The calculated hash.
+ */
+template <class... ResolutionRatios, class T, std::size_t... Ids>
+constexpr std::size_t static_hash_impl(const T& value, [[maybe_unused]] std::index_sequence<Ids...> index_sequence) {
+  constexpr auto kBits = std::numeric_limits<std::size_t>::digits / sizeof...(Ids);
+  return (detail::floor_and_fibo_hash<kBits, Ids>(std::get<Ids>(value) * ratio_reciprocal_v<ResolutionRatios>) ^ ...);
+}
+
 }  // namespace detail
 
 /// Callable class, allowing to calculate the hash of a particle state.
@@ -154,10 +229,11 @@ class spatial_hash<Tuple<Types...>, std::enable_if_t<(std::is_arithmetic_v<Types
 };
 
 /**
- * Specialization for Sophus::SE2d. Will calculate the spatial hash based on the translation and rotation.
+ * Specialization for Sophus::SE2 types of any scalar (e.g. Sophus::SE2d, Sophus::SE2f). Will calculate
+ * the spatial hash based on the translation and rotation.
  */
-template <>
-class spatial_hash<Sophus::SE2d, void> {
+template <class Scalar>
+class spatial_hash<Sophus::SE2<Scalar>, void> {
  public:
   /// Constructs a spatial hasher given per-coordinate resolutions.
   /**
@@ -187,9 +263,11 @@ class spatial_hash<Sophus::SE2d, void> {
    * \param state The state to be hashed.
    * \return The calculated hash.
    */
-  std::size_t operator()(const Sophus::SE2d& state) const {
+  std::size_t operator()(const Sophus::SE2<Scalar>& state) const {
     const auto& position = state.translation();
-    return underlying_hasher_(std::make_tuple(position.x(), position.y(), state.so2().log()));
+    return underlying_hasher_(std::make_tuple(
+        static_cast<double>(position.x()), static_cast<double>(position.y()),
+        static_cast<double>(state.so2().log())));
   }
 
  private:
@@ -273,6 +351,288 @@ class spatial_hash<Sophus::SE3d, void> {
   spatial_hash<std::tuple<double, double, double, double, double, double>> underlying_hasher_{{1., 1., 1., 1., 1., 1.}};
 };
 
+/// Callable class hashing a particle state with compile-time clustering resolutions.
+/**
+ * Compile-time counterpart of beluga::spatial_hash: per-axis resolutions are given as
+ * `std::ratio` template parameters instead of runtime values, so each quantization
+ * compiles down to a multiplication by a constant reciprocal with no per-call divides
+ * and no stored state. Worth it in paths that hash once per generated particle, such
+ * as KLD resampling and cluster-based estimation. Prefer resolutions that are powers
+ * of two, for which the constant reciprocal is exact and the result matches the
+ * runtime hasher bit for bit.
+ *
+ * \tparam T The state type to be hashed.
+ * \tparam ResolutionRatios One `std::ratio` clustering resolution per hashed dimension.
+ */
+template <class T, class... ResolutionRatios>
+struct static_spatial_hash {};
+
+/// Specialization for arrays.
+template <class T, std::size_t N, class... ResolutionRatios>
+class static_spatial_hash<std::array<T, N>, ResolutionRatios...> {
+  static_assert(std::is_arithmetic_v<T>);
+  static_assert(sizeof...(ResolutionRatios) == N, "one resolution ratio per array element is required");
+
+ public:
+  /// Calculates the array hash, with the resolutions in each axis given as template parameters.
+  /**
+   * \param array Array to be hashed.
+   * \return The calculated hash.
+   */
+  constexpr std::size_t operator()(const std::array<T, N>& array) const {
+    return detail::static_hash_impl<ResolutionRatios...>(array, std::make_index_sequence<N>());
+  }
+};
+
+/// Specialization for tuples.
+template <template <class...> class Tuple, class... Types, class... ResolutionRatios>
+class static_spatial_hash<Tuple<Types...>, ResolutionRatios...> {
+  static_assert((std::is_arithmetic_v<Types> && ...));
+  static_assert(sizeof...(ResolutionRatios) == sizeof...(Types), "one resolution ratio per tuple element is required");
+
+ public:
+  /// Calculates the tuple hash, with the resolutions in each axis given as template parameters.
+  /**
+   * \param tuple Tuple to be hashed.
+   * \return The calculated hash.
+   */
+  constexpr std::size_t operator()(const Tuple<Types...>& tuple) const {
+    return detail::static_hash_impl<ResolutionRatios...>(tuple, std::make_index_sequence<sizeof...(Types)>());
+  }
+};
+
+/**
+ * Specialization for Sophus::SE2d. Will calculate the spatial hash based on the translation and rotation.
+ *
+ * \tparam XRatio Clustering resolution for the X axis, in meters.
+ * \tparam YRatio Clustering resolution for the Y axis, in meters.
+ * \tparam ThetaRatio Clustering resolution for the Theta axis, in radians.
+ */
+template <class XRatio, class YRatio, class ThetaRatio>
+class static_spatial_hash<Sophus::SE2d, XRatio, YRatio, ThetaRatio> {
+ public:
+  /// Calculates the state hash, using the resolutions given as template parameters.
+  /**
+   * \param state The state to be hashed.
+   * \return The calculated hash.
+   */
+  std::size_t operator()(const Sophus::SE2d& state) const {
+    const auto& position = state.translation();
+    return underlying_hasher_(std::make_tuple(position.x(), position.y(), state.so2().log()));
+  }
+
+ private:
+  static_spatial_hash<std::tuple<double, double, double>, XRatio, YRatio, ThetaRatio> underlying_hasher_;
+};
+
+/**
+ * Specialization for Sophus::SE3d. It will calculate the spatial hash based on translation and rotation expressed in
+ * RPY angles. This is rotations with respect to a fixed frame (extrinsic rotation), in XYZ order.
+ *
+ * \tparam XRatio Clustering resolution for the X axis, in meters.
+ * \tparam YRatio Clustering resolution for the Y axis, in meters.
+ * \tparam ZRatio Clustering resolution for the Z axis, in meters.
+ * \tparam RollRatio Clustering resolution for roll, in radians.
+ * \tparam PitchRatio Clustering resolution for pitch, in radians.
+ * \tparam YawRatio Clustering resolution for yaw, in radians.
+ */
+template <class XRatio, class YRatio, class ZRatio, class RollRatio, class PitchRatio, class YawRatio>
+class static_spatial_hash<Sophus::SE3d, XRatio, YRatio, ZRatio, RollRatio, PitchRatio, YawRatio> {
+ public:
+  /// Calculates the state hash, using the resolutions given as template parameters.
+  /**
+   * \param state The state to be hashed.
+   * \return The calculated hash.
+   */
+  std::size_t operator()(const Sophus::SE3d& state) const {
+    const auto& position = state.translation();
+    // Eigen's eulerAngles uses intrinsic rotations, but XYZ extrinsic rotation is the same as ZYX intrinsic rotation.
+    // This gives (extrinsic) yaw, pitch, roll in that order.
+    const Eigen::Vector3d euler_angles = state.so3().matrix().eulerAngles(2, 1, 0);
+    return underlying_hasher_(std::make_tuple(
+        position.x(), position.y(), position.z(), euler_angles.z(), euler_angles.y(), euler_angles.x()));
+  }
+
+ private:
+  static_spatial_hash<std::tuple<double, double, double, double, double, double>, XRatio, YRatio, ZRatio, RollRatio,
+                      PitchRatio, YawRatio>
+      underlying_hasher_;
+};
+
+/// Callable class, allowing to calculate the Morton (Z-order) hash of a particle state.
+/**
+ * In contrast to beluga::spatial_hash, which scatters each dimension with a Fibonacci
+ * hash, this hasher interleaves the bits of the quantized per-dimension cell
+ * coordinates. States in spatially adjacent cells thus produce numerically close
+ * hashes, which improves cache locality in consumers that sort or bucket by hash.
+ * The trade-off is a bounded domain: each cell coordinate is truncated to the
+ * per-dimension bit budget, so states further than `2^(BitsPerDimension - 1)` cells
+ * away from the origin in any dimension alias with closer cells.
+ *
+ * \tparam T The state type to be hashed.
+ * \tparam BitsPerDimension Number of bits of cell coordinate kept per dimension.
+ * By default (0), the hash width is split evenly among the dimensions.
+ */
+template <class T, std::size_t BitsPerDimension = 0, typename Enable = void>
+struct morton_spatial_hash {};
+
+/// Specialization for arrays.
+template <class T, std::size_t N, std::size_t BitsPerDimension>
+class morton_spatial_hash<std::array<T, N>, BitsPerDimension, std::enable_if_t<std::is_arithmetic_v<T>, void>> {
+ public:
+  /// Number of bits of cell coordinate kept per dimension.
+  static constexpr std::size_t kBitsPerDimension =
+      BitsPerDimension != 0 ? BitsPerDimension : std::numeric_limits<std::size_t>::digits / N;
+  static_assert(kBitsPerDimension > 0, "the per-dimension bit budget must be positive");
+  static_assert(
+      kBitsPerDimension * N <= std::numeric_limits<std::size_t>::digits,
+      "the per-dimension bit budget exceeds the hash width");
+
+  /// Type that represents the resolution in each axis.
+  using resolution_in_each_axis_t = std::array<double, N>;
+
+  /// Constructs a spatial hasher from an `std::array` of doubles.
+  /**
+   *  \param resolution std::array of doubles containing resolution for each index of the array to be hashed, with
+   * matching indices. I.e: array[0] will be hashed with resolution[0].
+   */
+  explicit morton_spatial_hash(const resolution_in_each_axis_t& resolution) : resolution_{resolution} {}
+
+  /// Calculates the array hash, with the resolutions in each axis, given at construction time.
+  /**
+   * \param array Array to be hashed.
+   * \return The calculated hash.
+   */
+  constexpr std::size_t operator()(const std::array<T, N>& array) const {
+    return detail::morton_hash_impl<kBitsPerDimension>(array, resolution_, std::make_index_sequence<N>());
+  }
+
+ private:
+  resolution_in_each_axis_t resolution_;
+};
+
+/// Specialization for tuples.
+template <template <class...> class Tuple, class... Types, std::size_t BitsPerDimension>
+class morton_spatial_hash<
+    Tuple<Types...>,
+    BitsPerDimension,
+    std::enable_if_t<(std::is_arithmetic_v<Types> && ...), void>> {
+ public:
+  /// Number of bits of cell coordinate kept per dimension.
+  static constexpr std::size_t kBitsPerDimension =
+      BitsPerDimension != 0 ? BitsPerDimension : std::numeric_limits<std::size_t>::digits / sizeof...(Types);
+  static_assert(kBitsPerDimension > 0, "the per-dimension bit budget must be positive");
+  static_assert(
+      kBitsPerDimension * sizeof...(Types) <= std::numeric_limits<std::size_t>::digits,
+      "the per-dimension bit budget exceeds the hash width");
+
+  /// Type that represents the resolution in each axis.
+  using resolution_in_each_axis_t = std::array<double, sizeof...(Types)>;
+
+  /// Constructs a spatial hasher from an `std::array` of doubles.
+  /**
+   *  \param resolution std::array of doubles containing resolution for each index of the tuple to be hashed, with
+   * matching indices. I.e: std::get<0>(tuple) will be hashed with resolution[0].
+   */
+  explicit morton_spatial_hash(const resolution_in_each_axis_t& resolution) : resolution_{resolution} {}
+
+  /// Calculates the tuple hash, with the resolutions in each axis, given at construction time.
+  /**
+   * \param tuple Tuple to be hashed.
+   * \return The calculated hash.
+   */
+  constexpr std::size_t operator()(const Tuple<Types...>& tuple) const {
+    return detail::morton_hash_impl<kBitsPerDimension>(
+        tuple, resolution_, std::make_index_sequence<sizeof...(Types)>());
+  }
+
+ private:
+  resolution_in_each_axis_t resolution_;
+};
+
+/**
+ * Specialization for Sophus::SE2d. Will calculate the Morton hash based on the translation and rotation.
+ */
+template <std::size_t BitsPerDimension>
+class morton_spatial_hash<Sophus::SE2d, BitsPerDimension, void> {
+ public:
+  /// Constructs a spatial hasher given per-coordinate resolutions.
+  /**
+   * \param x_clustering_resolution Clustering resolution for the X axis, in meters.
+   * \param y_clustering_resolution Clustering resolution for the Y axis, in meters.
+   * \param theta_clustering_resolution Clustering resolution for the Theta axis, in radians.
+   */
+  explicit morton_spatial_hash(
+      double x_clustering_resolution,
+      double y_clustering_resolution,
+      double theta_clustering_resolution)
+      : underlying_hasher_{{x_clustering_resolution, y_clustering_resolution, theta_clustering_resolution}} {}
+
+  /// Constructs a spatial hasher given per-group resolutions.
+  /**
+   * \param linear_clustering_resolution Clustering resolution for translational coordinates, in meters.
+   * \param angular_clustering_resolution Clustering resolution for rotational coordinates, in radians.
+   */
+  explicit morton_spatial_hash(double linear_clustering_resolution, double angular_clustering_resolution)
+      : morton_spatial_hash(linear_clustering_resolution, linear_clustering_resolution, angular_clustering_resolution) {
+  }
+
+  /// Default constructor
+  morton_spatial_hash() = default;
+
+  /// Calculates the state hash, using the resolutions for x, y and rotation given at construction time.
+  /**
+   * \param state The state to be hashed.
+   * \return The calculated hash.
+   */
+  std::size_t operator()(const Sophus::SE2d& state) const {
+    const auto& position = state.translation();
+    return underlying_hasher_(std::make_tuple(position.x(), position.y(), state.so2().log()));
+  }
+
+ private:
+  morton_spatial_hash<std::tuple<double, double, double>, BitsPerDimension> underlying_hasher_{{1., 1., 1.}};
+};
+
+/**
+ * Specialization for Sophus::SE3d. It will calculate the Morton hash based on translation and rotation expressed in
+ * RPY angles. This is rotations with respect to a fixed frame (extrinsic rotation), in XYZ order.
+ */
+template <std::size_t BitsPerDimension>
+class morton_spatial_hash<Sophus::SE3d, BitsPerDimension, void> {
+ public:
+  /// Constructs a spatial hasher given per-group resolutions.
+  /**
+   * \param linear_clustering_resolution Clustering resolution for translational coordinates, in meters.
+   * \param angular_clustering_resolution Clustering resolution for rotational components, in radians.
+   */
+  explicit morton_spatial_hash(double linear_clustering_resolution, double angular_clustering_resolution)
+      : underlying_hasher_{
+            {linear_clustering_resolution, linear_clustering_resolution, linear_clustering_resolution,
+             angular_clustering_resolution, angular_clustering_resolution, angular_clustering_resolution}} {}
+
+  /// Default constructor
+  morton_spatial_hash() = default;
+
+  /// Calculates the state hash, using the resolutions for x, y, z and rotation given at construction time.
+  /**
+   * \param state The state to be hashed.
+   * \return The calculated hash.
+   */
+  std::size_t operator()(const Sophus::SE3d& state) const {
+    const auto& position = state.translation();
+    // Eigen's eulerAngles uses intrinsic rotations, but XYZ extrinsic rotation is the same as ZYX intrinsic rotation.
+    // This gives (extrinsic) yaw, pitch, roll in that order.
+    const Eigen::Vector3d euler_angles = state.so3().matrix().eulerAngles(2, 1, 0);
+    return underlying_hasher_(std::make_tuple(
+        position.x(), position.y(), position.z(), euler_angles.z(), euler_angles.y(), euler_angles.x()));
+  }
+
+ private:
+  morton_spatial_hash<std::tuple<double, double, double, double, double, double>, BitsPerDimension> underlying_hasher_{
+      {1., 1., 1., 1., 1., 1.}};
+};
+
 }  // namespace beluga
 
 #endif
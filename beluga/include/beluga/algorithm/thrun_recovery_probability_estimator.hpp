@@ -16,7 +16,9 @@
 #define BELUGA_ALGORITHM_THRUN_RECOVERY_PROBABILITY_ESTIMATOR_HPP
 
 #include <algorithm>
+#include <utility>
 
+#include <beluga/algorithm/effective_sample_size.hpp>
 #include <beluga/algorithm/exponential_filter.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
 #include <beluga/views/particles.hpp>
@@ -60,6 +62,21 @@ class ThrunRecoveryProbabilityEstimator {
     fast_filter_.reset();
   }
 
+  /// Restore the internal state of the estimator from previously saved filter outputs.
+  /**
+   * \param slow_output Output of the long-term average filter.
+   * \param fast_output Output of the short-term average filter.
+   */
+  constexpr void reset(double slow_output, double fast_output) noexcept {
+    slow_filter_.reset(slow_output);
+    fast_filter_.reset(fast_output);
+  }
+
+  /// Returns the long-term and short-term average filter outputs, in that order.
+  [[nodiscard]] constexpr std::pair<double, double> filter_outputs() const noexcept {
+    return {slow_filter_.output(), fast_filter_.output()};
+  }
+
   /// Update the estimation based on a particle range.
   /**
    * \param range A range containing particles.
@@ -77,7 +94,30 @@ class ThrunRecoveryProbabilityEstimator {
     }
 
     const double total_weight = ranges::accumulate(beluga::views::weights(range), 0.0);
-    const double average_weight = total_weight / static_cast<double>(size);
+    return update(total_weight / static_cast<double>(size));
+  }
+
+  /// Update the estimation from precomputed weight statistics.
+  /**
+   * Zero-pass alternative to the range overload for pipelines that already
+   * accumulate `beluga::WeightStatistics` during the reweight sweep, so
+   * recovery probability estimation does not revisit the weight column.
+   *
+   * \param statistics Weight statistics accumulated over a particle range.
+   * \return The estimated random state probability to be used by the particle filter.
+   */
+  constexpr double operator()(const WeightStatistics& statistics) {
+    if (statistics.sample_count == 0) {
+      reset();
+      return 0.0;
+    }
+
+    return update(statistics.average_weight());
+  }
+
+ private:
+  /// Feed an average weight to both filters and compute the recovery probability.
+  constexpr double update(double average_weight) {
     const double fast_average = fast_filter_(average_weight);
     const double slow_average = slow_filter_(average_weight);
 
@@ -88,7 +128,6 @@ class ThrunRecoveryProbabilityEstimator {
     return std::clamp(1.0 - fast_average / slow_average, 0.0, 1.0);
   }
 
- private:
   ExponentialFilter slow_filter_;  ///< Exponential filter for the long-term average.
   ExponentialFilter fast_filter_;  ///< Exponential filter for the short-term average.
 };
@@ -0,0 +1,145 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_TOP_K_HPP
+#define BELUGA_ALGORITHM_TOP_K_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a top-k selection algorithm over particle weights.
+ */
+
+namespace beluga {
+
+namespace detail {
+
+/// Selects the indices of the k largest values of a random access range.
+/**
+ * \param values Range of values to select over. Only read, never reordered.
+ * \param k Number of indices to select.
+ * \param select Callable running the selection step, with the signature of `std::nth_element`
+ *  minus the comparator (e.g. with an execution policy bound).
+ * \param order Callable ordering the selected prefix, with the signature of `std::sort`
+ *  minus the comparator.
+ * \return Indices of the k largest values, largest first.
+ */
+template <class Range, class Select, class Order>
+std::vector<std::size_t> top_k_impl(Range&& values, std::size_t k, Select select, Order order) {
+  const auto first = ranges::begin(values);
+  const auto size = static_cast<std::size_t>(ranges::size(values));
+  k = std::min(k, size);
+  auto indices = std::vector<std::size_t>(size);
+  std::iota(indices.begin(), indices.end(), std::size_t{0});
+  const auto by_descending_value = [first](std::size_t lhs, std::size_t rhs) {
+    return first[static_cast<std::ptrdiff_t>(lhs)] > first[static_cast<std::ptrdiff_t>(rhs)];
+  };
+  const auto kth = indices.begin() + static_cast<std::ptrdiff_t>(k);
+  if (k < size) {
+    select(indices.begin(), kth, indices.end(), by_descending_value);
+  }
+  order(indices.begin(), kth, by_descending_value);
+  indices.resize(k);
+  return indices;
+}
+
+}  // namespace detail
+
+/// Returns the indices of the k best-weighted particles, best first.
+/**
+ * Runs `std::nth_element` selection over the weight column, so the cost is linear in the
+ * set size plus \f$k \log k\f$ for ordering the answer — against \f$n \log n\f$ for
+ * sorting a full copy of the set, which this API exists to avoid. The particle range is
+ * only read, never copied or reordered; consumers index the returned positions into the
+ * range itself or into its state and weight columns (e.g. through `beluga::views::states`).
+ *
+ * \tparam Range A [random access range](https://en.cppreference.com/w/cpp/ranges/random_access_range)
+ *  of particles.
+ * \param range The range of particles.
+ * \param k Number of particles to select. Capped to the range size.
+ * \return Indices of the k best-weighted particles, in descending weight order.
+ */
+template <class Range, std::enable_if_t<is_particle_range_v<Range>, int> = 0>
+[[nodiscard]] std::vector<std::size_t> top_k(Range&& range, std::size_t k) {
+  return detail::top_k_impl(
+      range | beluga::views::weights, k,
+      [](auto first, auto kth, auto last, auto compare) { std::nth_element(first, kth, last, compare); },
+      [](auto first, auto last, auto compare) { std::sort(first, last, compare); });
+}
+
+/// Overload for plain weight ranges.
+template <class Range, std::enable_if_t<ranges::range<Range> && !is_particle_range_v<Range>, int> = 0>
+[[nodiscard]] std::vector<std::size_t> top_k(Range&& range, std::size_t k) {
+  return detail::top_k_impl(
+      std::forward<Range>(range), k,
+      [](auto first, auto kth, auto last, auto compare) { std::nth_element(first, kth, last, compare); },
+      [](auto first, auto last, auto compare) { std::sort(first, last, compare); });
+}
+
+/// Overload with an execution policy for the selection steps.
+/**
+ * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+ * \tparam Range A [random access range](https://en.cppreference.com/w/cpp/ranges/random_access_range)
+ *  of particles.
+ * \param policy The execution policy to use.
+ * \param range The range of particles.
+ * \param k Number of particles to select. Capped to the range size.
+ * \return Indices of the k best-weighted particles, in descending weight order.
+ */
+template <
+    class ExecutionPolicy,
+    class Range,
+    std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+    std::enable_if_t<is_particle_range_v<Range>, int> = 0>
+[[nodiscard]] std::vector<std::size_t> top_k(ExecutionPolicy&& policy, Range&& range, std::size_t k) {
+  return detail::top_k_impl(
+      range | beluga::views::weights, k,
+      [&policy](auto first, auto kth, auto last, auto compare) {
+        std::nth_element(policy, first, kth, last, compare);
+      },
+      [&policy](auto first, auto last, auto compare) { std::sort(policy, first, last, compare); });
+}
+
+/// Overload with an execution policy for plain weight ranges.
+template <
+    class ExecutionPolicy,
+    class Range,
+    std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+    std::enable_if_t<ranges::range<Range> && !is_particle_range_v<Range>, int> = 0>
+[[nodiscard]] std::vector<std::size_t> top_k(ExecutionPolicy&& policy, Range&& range, std::size_t k) {
+  return detail::top_k_impl(
+      std::forward<Range>(range), k,
+      [&policy](auto first, auto kth, auto last, auto compare) {
+        std::nth_element(policy, first, kth, last, compare);
+      },
+      [&policy](auto first, auto last, auto compare) { std::sort(policy, first, last, compare); });
+}
+
+}  // namespace beluga
+
+#endif
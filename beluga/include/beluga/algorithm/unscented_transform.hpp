@@ -19,20 +19,19 @@
 #include <Eigen/Core>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <functional>
 #include <numeric>
 #include <optional>
 #include <range/v3/numeric.hpp>
 #include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/range/concepts.hpp>
-#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/any_view.hpp>
 #include <range/v3/view/common.hpp>
-#include <range/v3/view/transform.hpp>
 #include <range/v3/view/zip.hpp>
 #include <type_traits>
 #include <utility>
-#include <vector>
 #include "beluga/eigen_compatibility.hpp"
 namespace beluga {
 
@@ -40,9 +39,9 @@ namespace detail {
 
 /// Templated functor to compute weighted mean for arbitrary. Assumes weights and vector's scalar types match.
 struct default_weighted_mean_fn {
-  /// Operator() overload for eigen types.
-  template <typename T, typename Scalar = typename T::Scalar>
-  T operator()(const std::vector<T>& samples, const std::vector<Scalar>& weights) const {
+  /// Operator() overload for containers of eigen types.
+  template <typename Samples, typename Weights, typename T = typename Samples::value_type>
+  T operator()(const Samples& samples, const Weights& weights) const {
     return std::transform_reduce(
         samples.begin(), samples.end(), weights.begin(), T::Zero().eval(), std::plus<>{}, std::multiplies<>{});
   }
@@ -104,11 +103,12 @@ auto unscented_transform(
   const double k = kappa.value_or(std::max(kNin - 3, 0));
   assert(k >= 0);
   const Scalar w0 = static_cast<Scalar>(k) / static_cast<Scalar>(kNin + k);
-  std::vector<Eigen::Vector<Scalar, kNin>> sigma_points;
-  std::vector<Scalar> weights;
-  sigma_points.reserve(2 * kNin + 1);
-  weights.resize(2 * kNin + 1);
-  sigma_points.emplace_back(mean);
+  // The input dimension is known at compile time, so sigma points and weights can live
+  // on the stack; this function runs in per-update paths where heap traffic adds up.
+  constexpr std::size_t kNumSigmaPoints = 2 * static_cast<std::size_t>(kNin) + 1;
+  std::array<Eigen::Vector<Scalar, kNin>, kNumSigmaPoints> sigma_points;
+  std::array<Scalar, kNumSigmaPoints> weights;
+  sigma_points[0] = mean;
   weights[0] = w0;
   const Scalar wn = 1. / (2. * (kNin + k));
 
@@ -120,16 +120,17 @@ auto unscented_transform(
   const Eigen::Matrix<Scalar, kNin, kNin> scaled_l_matrix = std::sqrt(kNin + k) * l_matrix;
 
   for (int i = 0; i < kNin; ++i) {
-    sigma_points.emplace_back(mean + scaled_l_matrix.col(i));
-    sigma_points.emplace_back(mean - scaled_l_matrix.col(i));
+    sigma_points[static_cast<std::size_t>(2 * i + 1)] = mean + scaled_l_matrix.col(i);
+    sigma_points[static_cast<std::size_t>(2 * i + 2)] = mean - scaled_l_matrix.col(i);
   }
   std::fill(weights.begin() + 1, weights.end(), wn);
 
-  const auto transformed_sigma_points = sigma_points | ranges::views::transform(transfer_fn) | ranges::to<std::vector>;
-
   constexpr int kNout = decltype(transfer_fn(mean))::RowsAtCompileTime;
   static_assert(decltype(transfer_fn(mean))::ColsAtCompileTime == 1, "Output mean should be a column vector");
 
+  std::array<Eigen::Vector<Scalar, kNout>, kNumSigmaPoints> transformed_sigma_points;
+  std::transform(sigma_points.begin(), sigma_points.end(), transformed_sigma_points.begin(), transfer_fn);
+
   const Eigen::Vector<Scalar, kNout> out_mean = mean_fn(transformed_sigma_points, weights);
 
   const Eigen::Matrix<Scalar, kNout, kNout> out_cov = std::transform_reduce(
@@ -0,0 +1,414 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_CONTAINERS_DECOMPOSED_SE2_VECTOR_HPP
+#define BELUGA_CONTAINERS_DECOMPOSED_SE2_VECTOR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <beluga/containers/tuple_vector.hpp>
+#include <beluga/primitives.hpp>
+#include <beluga/views/zip.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/view/span.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/zip_with.hpp>
+#include <sophus/se2.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a particle container with decomposed SE2 state storage.
+ */
+
+namespace beluga {
+
+namespace detail {
+
+/// Writable reference-like handle to an SE2 state stored as decomposed scalar columns.
+/**
+ * Converts to a `Sophus::SE2` value on read and writes through to the underlying
+ * columns on assignment, so generic code sees regular SE2 states while the storage
+ * stays in structure-of-arrays form.
+ *
+ * \tparam ScalarT Referenced scalar type, possibly const-qualified.
+ */
+template <class ScalarT>
+class Se2Proxy {
+ public:
+  /// Non-const scalar type of the referenced state.
+  using scalar_type = std::remove_const_t<ScalarT>;
+
+  /// Constructs a proxy over the given column elements.
+  constexpr Se2Proxy(ScalarT& x, ScalarT& y, ScalarT& cos_theta, ScalarT& sin_theta) noexcept
+      : x_{&x}, y_{&y}, cos_theta_{&cos_theta}, sin_theta_{&sin_theta} {}
+
+  /// Copy constructor, rebinding to the same column elements.
+  constexpr Se2Proxy(const Se2Proxy&) noexcept = default;
+
+  /// Materializes the referenced state as an SE2 value.
+  constexpr operator Sophus::SE2<scalar_type>() const {  // NOLINT(google-explicit-constructor)
+    return Sophus::SE2<scalar_type>{
+        Sophus::SO2<scalar_type>{*cos_theta_, *sin_theta_},
+        Eigen::Matrix<scalar_type, 2, 1>{*x_, *y_}};
+  }
+
+  /// Writes an SE2 value through to the underlying columns.
+  constexpr const Se2Proxy& operator=(const Sophus::SE2<scalar_type>& state) const {
+    *x_ = state.translation().x();
+    *y_ = state.translation().y();
+    *cos_theta_ = state.so2().unit_complex().x();
+    *sin_theta_ = state.so2().unit_complex().y();
+    return *this;
+  }
+
+  /// Copies the referenced values (not the bindings) of another proxy.
+  constexpr const Se2Proxy& operator=(const Se2Proxy& other) const {
+    *x_ = *other.x_;
+    *y_ = *other.y_;
+    *cos_theta_ = *other.cos_theta_;
+    *sin_theta_ = *other.sin_theta_;
+    return *this;
+  }
+
+ private:
+  ScalarT* x_;
+  ScalarT* y_;
+  ScalarT* cos_theta_;
+  ScalarT* sin_theta_;
+};
+
+/// Utility type adapting zipped scalar column iterators into SE2 proxies.
+/**
+ * Mirrors the role of `as_common_tuple_indirect_fn` in beluga::views::zip: the reference
+ * type of the resulting view is a writable \ref Se2Proxy and the value type is a plain
+ * `Sophus::SE2` instance.
+ */
+struct as_se2_proxy_indirect_fn {
+  /// Reference overload.
+  template <class XIt, class YIt, class CosIt, class SinIt>
+  constexpr auto operator()(const XIt& x, const YIt& y, const CosIt& cos_theta, const SinIt& sin_theta) const {
+    using scalar_type = std::remove_reference_t<ranges::iter_reference_t<XIt>>;
+    return Se2Proxy<scalar_type>{*x, *y, *cos_theta, *sin_theta};
+  }
+
+  /// Move overload.
+  template <class XIt, class YIt, class CosIt, class SinIt>
+  constexpr auto
+  operator()(ranges::move_tag, const XIt& x, const YIt& y, const CosIt& cos_theta, const SinIt& sin_theta) const {
+    using scalar_type = std::remove_const_t<std::remove_reference_t<ranges::iter_reference_t<XIt>>>;
+    return Sophus::SE2<scalar_type>{
+        Sophus::SO2<scalar_type>{*cos_theta, *sin_theta}, Eigen::Matrix<scalar_type, 2, 1>{*x, *y}};
+  }
+
+  /// Copy overload.
+  /**
+   * This is needed for `ranges::range_value_t` to return `Sophus::SE2` when this object
+   * is passed to a `zip_with_view`.
+   */
+  template <class XIt, class YIt, class CosIt, class SinIt>
+  constexpr auto operator()(ranges::copy_tag, XIt, YIt, CosIt, SinIt) const
+      -> Sophus::SE2<std::remove_const_t<std::remove_reference_t<ranges::iter_reference_t<XIt>>>> {
+    assert(false);  // NOLINT(misc-static-assert)
+    return {};
+  }
+};
+
+}  // namespace detail
+
+/// Particle container decomposing SE2 states into four scalar columns.
+/**
+ * Drop-in structure-of-arrays alternative to `beluga::TupleVector` for SE2 particles:
+ * instead of one column of interleaved SE2 objects, states are stored as four scalar
+ * columns (x, y, cosθ, sinθ) next to the weight column. Batch kernels operate directly
+ * on the scalar columns through \ref x, \ref y, \ref cos_theta and \ref sin_theta, with
+ * unit-stride access per lane and no per-state object decoding, which is the layout
+ * vectorized sweeps over the particle set ultimately want.
+ *
+ * Generic code keeps working unchanged: `column<0>()` returns a random-access view whose
+ * references are writable \ref detail::Se2Proxy handles converting to and assignable
+ * from `Sophus::SE2` values, so `beluga::views::states` and the particle-range actions
+ * (propagate, reweight, normalize) see regular SE2 states. `column<1>()` returns the
+ * contiguous weight column span, preserving the `beluga::views::weights` fast path.
+ *
+ * \tparam Scalar Scalar type of the decomposed state columns.
+ * \tparam WeightT Weight type of the particles (e.g. beluga::Weight or beluga::WeightF).
+ */
+template <class Scalar = double, class WeightT = beluga::Weight>
+class DecomposedSe2Vector {
+ public:
+  /// Value type of the container.
+  using value_type = std::tuple<Sophus::SE2<Scalar>, WeightT>;
+
+  /// Reference type of the container.
+  using reference_type = ranges::common_tuple<detail::Se2Proxy<Scalar>, WeightT&>;
+
+  /// Size type of the container.
+  using size_type = std::size_t;
+
+  /// Difference type of the container.
+  using difference_type = std::ptrdiff_t;
+
+  /// Allocator type.
+  /**
+   * This alias needs to exist to satisfy `ranges::to` container concept checks.
+   * It is not actually used, and there is no meaninful type we can specify here.
+   */
+  using allocator_type = void;
+
+  /// Default constructor, all columns start empty.
+  constexpr DecomposedSe2Vector() = default;
+
+  /// Constructs a container of size count, with identity states and default weights.
+  /**
+   * \param count Size of the container.
+   */
+  explicit constexpr DecomposedSe2Vector(size_type count) { resize(count); }
+
+  /// Constructs a container from iterators.
+  template <typename I, typename S>
+  constexpr DecomposedSe2Vector(I first, S last) {
+    assign(first, last);
+  }
+
+  /// Constructs a container from an initializer_list.
+  constexpr DecomposedSe2Vector(std::initializer_list<value_type> init) { assign(init.begin(), init.end()); }
+
+  /// Returns true if the container is empty.
+  [[nodiscard]] constexpr bool empty() const noexcept { return x_.empty(); }
+
+  /// Returns the size of the container.
+  [[nodiscard]] constexpr size_type size() const noexcept { return x_.size(); }
+
+  /// Returns the capacity of the container.
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return x_.capacity(); }
+
+  /// Clears the container.
+  constexpr void clear() noexcept {
+    x_.clear();
+    y_.clear();
+    cos_theta_.clear();
+    sin_theta_.clear();
+    weights_.clear();
+  }
+
+  /// Replaces elements in the container with copies of those in the range [first, last).
+  /**
+   * The behavior is undefined if either argument is an iterator into *this.
+   */
+  template <typename I, typename S>
+  constexpr void assign(I first, S last) {
+    auto range = ranges::make_subrange(first, last);
+    static_assert(ranges::input_range<decltype(range)>);
+    if constexpr (ranges::sized_range<decltype(range)>) {
+      resize(ranges::size(range));
+      ranges::copy(range, begin());
+    } else {
+      // Same capacity-first strategy as TupleContainer::assign: copy in place as far
+      // as capacity allows before falling back to back insertion, which is punished
+      // by having multiple underlying containers.
+      resize(capacity());
+      auto limited_range = range | ranges::views::take(size());
+      auto [last_in, last_out] = ranges::copy(limited_range, begin());
+      const auto copied_size = static_cast<size_type>(ranges::distance(begin(), last_out));
+      if (size() == copied_size) {
+        ranges::copy(last_in.base(), last, ranges::back_inserter(*this));
+      } else {
+        resize(copied_size);
+      }
+    }
+  }
+
+  /// Replaces elements in the container with a copy of each element in range.
+  template <typename R>
+  constexpr void assign_range(R&& range) {
+    assign(ranges::begin(range), ranges::end(range));
+  }
+
+  /// Reserves the specified capacity in all columns.
+  /**
+   * \param new_cap New capacity of the container.
+   */
+  constexpr void reserve(size_type new_cap) {
+    x_.reserve(new_cap);
+    y_.reserve(new_cap);
+    cos_theta_.reserve(new_cap);
+    sin_theta_.reserve(new_cap);
+    weights_.reserve(new_cap);
+  }
+
+  /// Requests the removal of unused capacity in all columns.
+  constexpr void shrink_to_fit() {
+    x_.shrink_to_fit();
+    y_.shrink_to_fit();
+    cos_theta_.shrink_to_fit();
+    sin_theta_.shrink_to_fit();
+    weights_.shrink_to_fit();
+  }
+
+  /// Resizes the container.
+  /**
+   * If the specified size is less than the current size, the first `count` elements of
+   * the container will be kept. Otherwise, the container is extended with identity
+   * states and default-initialized weights, matching what a `TupleVector` of
+   * default-initialized SE2 states would hold.
+   *
+   * \param count New size of the container.
+   */
+  constexpr void resize(size_type count) {
+    x_.resize(count);
+    y_.resize(count);
+    cos_theta_.resize(count, Scalar{1});  // Identity rotation; (0, 0) is not a valid unit complex.
+    sin_theta_.resize(count);
+    weights_.resize(count);
+  }
+
+  /// Reorders the container in place according to a sorted ancestor index array.
+  /**
+   * @copydoc TupleContainer::apply_ancestry
+   */
+  constexpr void apply_ancestry(const std::vector<size_type>& ancestors) {
+    assert(ancestors.size() == size());
+    apply_ancestry_impl(x_, ancestors);
+    apply_ancestry_impl(y_, ancestors);
+    apply_ancestry_impl(cos_theta_, ancestors);
+    apply_ancestry_impl(sin_theta_, ancestors);
+    apply_ancestry_impl(weights_, ancestors);
+  }
+
+  /// Adds a particle at the end of the container, decomposing its state.
+  /**
+   * \param value The particle to be appended.
+   */
+  constexpr void push_back(const value_type& value) {
+    const auto& [state, weight] = value;
+    x_.push_back(state.translation().x());
+    y_.push_back(state.translation().y());
+    cos_theta_.push_back(state.so2().unit_complex().x());
+    sin_theta_.push_back(state.so2().unit_complex().y());
+    weights_.push_back(weight);
+  }
+
+  /// \overload
+  constexpr void push_back(value_type&& value) { push_back(value); }
+
+  /// Returns a contiguous span over the x coordinates of the stored states.
+  [[nodiscard]] constexpr auto x() noexcept { return make_column_span(x_); }
+
+  /// \overload
+  [[nodiscard]] constexpr auto x() const noexcept { return make_column_span(x_); }
+
+  /// Returns a contiguous span over the y coordinates of the stored states.
+  [[nodiscard]] constexpr auto y() noexcept { return make_column_span(y_); }
+
+  /// \overload
+  [[nodiscard]] constexpr auto y() const noexcept { return make_column_span(y_); }
+
+  /// Returns a contiguous span over the rotation cosines of the stored states.
+  [[nodiscard]] constexpr auto cos_theta() noexcept { return make_column_span(cos_theta_); }
+
+  /// \overload
+  [[nodiscard]] constexpr auto cos_theta() const noexcept { return make_column_span(cos_theta_); }
+
+  /// Returns a contiguous span over the rotation sines of the stored states.
+  [[nodiscard]] constexpr auto sin_theta() noexcept { return make_column_span(sin_theta_); }
+
+  /// \overload
+  [[nodiscard]] constexpr auto sin_theta() const noexcept { return make_column_span(sin_theta_); }
+
+  /// Returns a view (for states) or span (for weights) over the `I`-th column.
+  /**
+   * The state column is served as a random-access view of writable
+   * \ref detail::Se2Proxy references recomposing SE2 states on the fly; the weight
+   * column is served as a span over contiguous storage, like any `TupleVector` column.
+   */
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto column() noexcept {
+    static_assert(I < 2);
+    if constexpr (I == 0) {
+      return states_view(x_, y_, cos_theta_, sin_theta_);
+    } else {
+      return make_column_span(weights_);
+    }
+  }
+
+  /// \overload
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto column() const noexcept {
+    static_assert(I < 2);
+    if constexpr (I == 0) {
+      return states_view(x_, y_, cos_theta_, sin_theta_);
+    } else {
+      return make_column_span(weights_);
+    }
+  }
+
+  /// Returns an iterator to the first particle of the container.
+  [[nodiscard]] constexpr auto begin() const { return all().begin(); }
+
+  /// Returns an iterator past the last particle of the container.
+  [[nodiscard]] constexpr auto end() const { return all().end(); }
+
+  /// \overload
+  [[nodiscard]] constexpr auto begin() { return all().begin(); }
+
+  /// \overload
+  [[nodiscard]] constexpr auto end() { return all().end(); }
+
+ private:
+  Vector<Scalar> x_;
+  Vector<Scalar> y_;
+  Vector<Scalar> cos_theta_;
+  Vector<Scalar> sin_theta_;
+  Vector<WeightT> weights_;
+
+  template <class Column>
+  [[nodiscard]] static constexpr auto make_column_span(Column& column) noexcept {
+    return ranges::make_span(column.data(), static_cast<difference_type>(column.size()));
+  }
+
+  template <class... Columns>
+  [[nodiscard]] static constexpr auto states_view(Columns&... columns) noexcept {
+    return ranges::views::iter_zip_with(detail::as_se2_proxy_indirect_fn{}, make_column_span(columns)...);
+  }
+
+  template <class Column>
+  static constexpr void apply_ancestry_impl(Column& column, const std::vector<size_type>& ancestors) {
+    const size_type count = ancestors.size();
+    for (size_type index = 0; index < count; ++index) {
+      const size_type ancestor = ancestors[index];
+      if (ancestor > index) {
+        column[index] = column[ancestor];
+      }
+    }
+    for (size_type index = count; index-- > 0;) {
+      const size_type ancestor = ancestors[index];
+      if (ancestor < index) {
+        column[index] = column[ancestor];
+      }
+    }
+  }
+
+  [[nodiscard]] constexpr auto all() { return beluga::views::zip(column<0>(), column<1>()); }
+
+  [[nodiscard]] constexpr auto all() const { return beluga::views::zip(column<0>(), column<1>()); }
+};
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,194 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_CONTAINERS_FIXED_TUPLE_ARRAY_HPP
+#define BELUGA_CONTAINERS_FIXED_TUPLE_ARRAY_HPP
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include <beluga/containers/tuple_vector.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a fixed-capacity tuple of containers.
+ */
+
+namespace beluga {
+
+/// A fixed-capacity sequence with inline storage and a runtime size.
+/**
+ * Drop-in stand-in for `std::vector` as a \ref TupleContainer column on targets
+ * where heap use is forbidden after initialization: storage is an inline
+ * `std::array`, so no member function ever allocates. Elements past the
+ * effective size stay default-constructed in place, which keeps size changes
+ * trivial at the cost of requiring `T` to be default constructible.
+ *
+ * \tparam T Element type. Must be default constructible and copy assignable.
+ * \tparam N Storage capacity of the sequence.
+ */
+template <class T, std::size_t N>
+class FixedCapacityVector {
+ public:
+  /// Value type of the sequence.
+  using value_type = T;
+  /// Size type of the sequence.
+  using size_type = std::size_t;
+  /// Size difference type of the sequence.
+  using difference_type = std::ptrdiff_t;
+  /// Value reference type of the sequence.
+  using reference = value_type&;
+  /// Constant value reference type of the sequence.
+  using const_reference = const value_type&;
+  /// Value pointer type of the sequence.
+  using pointer = value_type*;
+  /// Constant value pointer type of the sequence.
+  using const_pointer = const value_type*;
+  /// Iterator type of the sequence.
+  using iterator = pointer;
+  /// Constant iterator type of the sequence.
+  using const_iterator = const_pointer;
+
+  /// Allocator type of the sequence (required in range-v3 10.0).
+  using allocator_type = void;
+
+  /// Default constructor. The sequence will be empty.
+  constexpr FixedCapacityVector() = default;
+
+  /// Constructs a sequence of size count, all values are default initialized.
+  /**
+   * \param count Size of the sequence.
+   * \throws std::length_error If `count` exceeds the storage capacity.
+   */
+  explicit constexpr FixedCapacityVector(size_type count) : size_{check_capacity(count)} {}
+
+  /// Returns true if the sequence is empty.
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0U; }
+
+  /// Returns the size of the sequence.
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+
+  /// Returns the capacity of the sequence (same as its maximum size).
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return N; }
+
+  /// Clears the sequence. Elements are not destroyed, just no longer reachable.
+  constexpr void clear() noexcept { size_ = 0U; }
+
+  /// Checks that the requested capacity does not exceed the inline storage.
+  /**
+   * No storage is ever allocated; this exists for interface compatibility with
+   * `std::vector` and fails loudly where a vector would grow.
+   *
+   * \throws std::length_error If `new_cap` exceeds the storage capacity.
+   */
+  constexpr void reserve(size_type new_cap) const { check_capacity(new_cap); }
+
+  /// Resizes the sequence.
+  /**
+   * Growing exposes default-initialized values; shrinking keeps the first `count` elements.
+   *
+   * \param count New size of the sequence.
+   * \throws std::length_error If `count` exceeds the storage capacity.
+   */
+  constexpr void resize(size_type count) {
+    check_capacity(count);
+    for (size_type index = size_; index < count; ++index) {
+      storage_[index] = value_type{};
+    }
+    size_ = count;
+  }
+
+  /// Adds an element at the end of the sequence.
+  /**
+   * \param value The element to be appended.
+   * \throws std::length_error If the sequence is already at full capacity.
+   */
+  constexpr void push_back(const value_type& value) {
+    check_capacity(size_ + 1U);
+    storage_[size_++] = value;
+  }
+
+  /// \overload
+  constexpr void push_back(value_type&& value) {
+    check_capacity(size_ + 1U);
+    storage_[size_++] = std::move(value);
+  }
+
+  /// Returns a pointer to the inline storage.
+  [[nodiscard]] constexpr pointer data() noexcept { return storage_.data(); }
+
+  /// \overload
+  [[nodiscard]] constexpr const_pointer data() const noexcept { return storage_.data(); }
+
+  /// Returns an iterator to the first element of the sequence.
+  [[nodiscard]] constexpr iterator begin() noexcept { return storage_.data(); }
+
+  /// \overload
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return storage_.data(); }
+
+  /// Returns an iterator past the last element of the sequence.
+  [[nodiscard]] constexpr iterator end() noexcept { return storage_.data() + size_; }
+
+  /// \overload
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return storage_.data() + size_; }
+
+ private:
+  static constexpr size_type check_capacity(size_type count) {
+    if (count > N) {
+      throw std::length_error{"Fixed capacity vector reached its maximum size"};
+    }
+    return count;
+  }
+
+  std::array<T, N> storage_{};
+  size_type size_ = 0U;
+};
+
+namespace detail {
+
+/// \cond
+
+template <std::size_t N>
+struct fixed_capacity_vector_with {
+  template <class T>
+  using type = FixedCapacityVector<T, N>;
+};
+
+/// \endcond
+
+}  // namespace detail
+
+/// Shorthand for a tuple of fixed-capacity inline sequences.
+/**
+ * Counterpart of \ref TupleVector for deployments where dynamic allocation is
+ * forbidden after initialization: columns live in inline `std::array` storage
+ * and share a runtime size, so the whole particle pipeline (propagate, reweight,
+ * normalize, resample) runs without touching the heap. Exceeding the capacity
+ * throws `std::length_error`, so resampling stages must be bounded to at most
+ * `N` particles (e.g. with `ranges::views::take_exactly`).
+ *
+ * \tparam T Tuple type, e.g. the particle type.
+ * \tparam N Storage capacity of each column.
+ */
+template <class T, std::size_t N>
+class FixedTupleArray : public TupleContainer<detail::fixed_capacity_vector_with<N>::template type, T> {
+  /// Inherited constructors.
+  using TupleContainer<detail::fixed_capacity_vector_with<N>::template type, T>::TupleContainer;
+};
+
+}  // namespace beluga
+
+#endif
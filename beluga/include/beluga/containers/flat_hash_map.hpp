@@ -0,0 +1,398 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_CONTAINERS_FLAT_HASH_MAP_HPP
+#define BELUGA_CONTAINERS_FLAT_HASH_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \brief Implementation of a flat open-addressing hash map.
+ */
+
+namespace beluga {
+
+/// A flat open-addressing hash map with robin-hood probing.
+/**
+ * Unlike `std::unordered_map`, entries live inline in a single flat slot
+ * array, so a lookup costs one hash and a short linear probe over
+ * contiguous memory instead of a pointer chase per node. Robin-hood
+ * displacement keeps probe sequences short and tightly bounded, and
+ * backward-shift deletion avoids tombstones.
+ *
+ * It implements the subset of the standard library associative container
+ * API that `beluga::SparseValueGrid` relies on, so it can be dropped in as
+ * a map storage option wherever lookup throughput matters more than
+ * iterator or reference stability: any mutation can rehash and invalidate
+ * both.
+ *
+ * \tparam Key Key type. Must be default constructible and move assignable.
+ * \tparam T Mapped type. Must be default constructible and move assignable.
+ * \tparam Hash Hash function object type for `Key` values.
+ * \tparam KeyEqual Equality function object type for `Key` values.
+ */
+template <class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class FlatHashMap {
+ public:
+  /// Key type of the map.
+  using key_type = Key;
+  /// Mapped type of the map.
+  using mapped_type = T;
+  /// Value type of the map entries.
+  using value_type = std::pair<Key, T>;
+  /// Size type of the map.
+  using size_type = std::size_t;
+  /// Hash function object type.
+  using hasher = Hash;
+  /// Equality function object type.
+  using key_equal = KeyEqual;
+
+ private:
+  /// A slot in the flat array, empty or holding one entry.
+  struct Slot {
+    /// Distance from the entry home slot plus one, or 0 if the slot is empty.
+    std::uint32_t probe_length{0};
+    /// Stored entry, meaningful only if the slot is not empty.
+    value_type entry{};
+  };
+
+ public:
+  /// Forward iterator over map entries, skipping empty slots.
+  /**
+   * \tparam IsConst Whether the iterator provides const access.
+   */
+  template <bool IsConst>
+  class Iterator {
+   public:
+    /// Iterator category tag.
+    using iterator_category = std::forward_iterator_tag;
+    /// Iterator difference type.
+    using difference_type = std::ptrdiff_t;
+    /// Iterated value type.
+    using value_type = FlatHashMap::value_type;
+    /// Pointer to iterated value type.
+    using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+    /// Reference to iterated value type.
+    using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+    /// Default constructor.
+    Iterator() = default;
+
+    /// Converting constructor from mutable to const iterator.
+    template <bool B = IsConst, std::enable_if_t<B, int> = 0>
+    Iterator(const Iterator<false>& other)  // NOLINT(google-explicit-constructor)
+        : slot_(other.slot_), last_(other.last_) {}
+
+    /// Dereference operator overload.
+    reference operator*() const { return slot_->entry; }
+
+    /// Arrow operator overload.
+    pointer operator->() const { return &slot_->entry; }
+
+    /// Prefix operator overload.
+    Iterator& operator++() {
+      ++slot_;
+      skip_empty();
+      return *this;
+    }
+
+    /// Post-fix operator overload.
+    Iterator operator++(int) {
+      Iterator other = *this;
+      this->operator++();
+      return other;
+    }
+
+    /// Equality operator overload.
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.slot_ == rhs.slot_; }
+
+    /// Inequality operator overload.
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
+
+   private:
+    friend class FlatHashMap;
+    template <bool>
+    friend class Iterator;
+
+    using slot_pointer = std::conditional_t<IsConst, const Slot*, Slot*>;
+
+    Iterator(slot_pointer slot, slot_pointer last) : slot_(slot), last_(last) { skip_empty(); }
+
+    void skip_empty() {
+      while (slot_ != last_ && slot_->probe_length == 0) {
+        ++slot_;
+      }
+    }
+
+    slot_pointer slot_{nullptr};
+    slot_pointer last_{nullptr};
+  };
+
+  /// Mutable iterator type.
+  using iterator = Iterator<false>;
+  /// Const iterator type.
+  using const_iterator = Iterator<true>;
+
+  /// Constructs an empty map, allocating no slots.
+  FlatHashMap() = default;
+
+  /// Constructs a map from a list of entries.
+  /**
+   * \param init Entries to insert. Later duplicates of a key are ignored.
+   */
+  FlatHashMap(std::initializer_list<value_type> init) {
+    reserve(init.size());
+    for (const auto& value : init) {
+      insert(value);
+    }
+  }
+
+  /// Returns the number of entries in the map.
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+
+  /// Returns true if the map is empty.
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  /// Removes all entries from the map, keeping the allocated slots.
+  void clear() noexcept {
+    for (auto& slot : slots_) {
+      if (slot.probe_length != 0) {
+        slot.probe_length = 0;
+        slot.entry = value_type{};
+      }
+    }
+    size_ = 0;
+  }
+
+  /// Ensures the map can hold a number of entries without rehashing.
+  /**
+   * \param count Expected number of entries.
+   */
+  void reserve(size_type count) {
+    size_type slot_count = kMinSlotCount;
+    while (count * 8 > slot_count * 7) {
+      slot_count *= 2;
+    }
+    if (slot_count > slots_.size()) {
+      rehash_to(slot_count);
+    }
+  }
+
+  /// Returns an iterator to the first entry.
+  [[nodiscard]] iterator begin() noexcept { return iterator{slots_.data(), slots_.data() + slots_.size()}; }
+
+  /// Returns a const iterator to the first entry.
+  [[nodiscard]] const_iterator begin() const noexcept {
+    return const_iterator{slots_.data(), slots_.data() + slots_.size()};
+  }
+
+  /// Returns a past-the-end iterator.
+  [[nodiscard]] iterator end() noexcept {
+    return iterator{slots_.data() + slots_.size(), slots_.data() + slots_.size()};
+  }
+
+  /// Returns a const past-the-end iterator.
+  [[nodiscard]] const_iterator end() const noexcept {
+    return const_iterator{slots_.data() + slots_.size(), slots_.data() + slots_.size()};
+  }
+
+  /// Finds the entry for a key.
+  /**
+   * \param key The key to look for.
+   * \return An iterator to the matching entry, or `end()` if not present.
+   */
+  [[nodiscard]] iterator find(const key_type& key) {
+    const size_type index = locate(key);
+    return index != kNpos ? iterator{slots_.data() + index, slots_.data() + slots_.size()} : end();
+  }
+
+  /// Finds the entry for a key.
+  /**
+   * \param key The key to look for.
+   * \return A const iterator to the matching entry, or `end()` if not present.
+   */
+  [[nodiscard]] const_iterator find(const key_type& key) const {
+    const size_type index = locate(key);
+    return index != kNpos ? const_iterator{slots_.data() + index, slots_.data() + slots_.size()} : end();
+  }
+
+  /// Returns the mapped value for a key.
+  /**
+   * \param key The key to look for.
+   * \throws std::out_of_range if the key is not present.
+   */
+  [[nodiscard]] mapped_type& at(const key_type& key) {
+    const size_type index = locate(key);
+    if (index == kNpos) {
+      throw std::out_of_range{"beluga::FlatHashMap::at: key not found"};
+    }
+    return slots_[index].entry.second;
+  }
+
+  /// Returns the mapped value for a key.
+  /**
+   * \param key The key to look for.
+   * \throws std::out_of_range if the key is not present.
+   */
+  [[nodiscard]] const mapped_type& at(const key_type& key) const {
+    const size_type index = locate(key);
+    if (index == kNpos) {
+      throw std::out_of_range{"beluga::FlatHashMap::at: key not found"};
+    }
+    return slots_[index].entry.second;
+  }
+
+  /// Returns the mapped value for a key, default constructing it if not present.
+  /**
+   * \param key The key to look for.
+   */
+  mapped_type& operator[](const key_type& key) {
+    const auto [index, _] = insert_entry(value_type{key, mapped_type{}});
+    return slots_[index].entry.second;
+  }
+
+  /// Inserts an entry into the map.
+  /**
+   * \param value The entry to insert.
+   * \return An iterator to the inserted (or pre-existing) entry, and whether insertion took place.
+   */
+  std::pair<iterator, bool> insert(value_type value) {
+    const auto [index, inserted] = insert_entry(std::move(value));
+    return {iterator{slots_.data() + index, slots_.data() + slots_.size()}, inserted};
+  }
+
+  /// Removes the entry for a key, if present.
+  /**
+   * Uses backward-shift deletion, so no tombstones are left behind.
+   *
+   * \param key The key to remove.
+   * \return The number of removed entries (0 or 1).
+   */
+  size_type erase(const key_type& key) {
+    size_type index = locate(key);
+    if (index == kNpos) {
+      return 0;
+    }
+    const size_type mask = slots_.size() - 1;
+    size_type next = (index + 1) & mask;
+    while (slots_[next].probe_length > 1) {
+      slots_[index].entry = std::move(slots_[next].entry);
+      slots_[index].probe_length = slots_[next].probe_length - 1;
+      index = next;
+      next = (next + 1) & mask;
+    }
+    slots_[index].probe_length = 0;
+    slots_[index].entry = value_type{};
+    --size_;
+    return 1;
+  }
+
+ private:
+  static constexpr size_type kMinSlotCount = 16U;
+  static constexpr size_type kNpos = static_cast<size_type>(-1);
+
+  /// Spreads hash entropy over all bits before power-of-two masking.
+  [[nodiscard]] size_type slot_index_for(const key_type& key, size_type mask) const {
+    return (hasher_(key) * size_type{0x9E3779B97F4A7C15}) & mask;
+  }
+
+  /// Finds the slot index holding a key, or kNpos if not present.
+  [[nodiscard]] size_type locate(const key_type& key) const {
+    if (slots_.empty()) {
+      return kNpos;
+    }
+    const size_type mask = slots_.size() - 1;
+    size_type index = slot_index_for(key, mask);
+    std::uint32_t probe_length = 1;
+    while (true) {
+      const Slot& slot = slots_[index];
+      // The robin-hood invariant bounds the probe: a key never sits further
+      // from home than any entry already in its way, so an empty or
+      // shorter-probed slot proves absence.
+      if (slot.probe_length < probe_length) {
+        return kNpos;
+      }
+      if (key_equal_(slot.entry.first, key)) {
+        return index;
+      }
+      index = (index + 1) & mask;
+      ++probe_length;
+    }
+  }
+
+  /// Inserts an entry, returning its slot index and whether insertion took place.
+  std::pair<size_type, bool> insert_entry(value_type value) {
+    if (slots_.empty() || (size_ + 1) * 8 > slots_.size() * 7) {
+      rehash_to(std::max(2 * slots_.size(), kMinSlotCount));
+    }
+    const size_type mask = slots_.size() - 1;
+    size_type index = slot_index_for(value.first, mask);
+    std::uint32_t probe_length = 1;
+    size_type target = kNpos;
+    while (true) {
+      Slot& slot = slots_[index];
+      if (slot.probe_length == 0) {
+        slot.entry = std::move(value);
+        slot.probe_length = probe_length;
+        ++size_;
+        return {target != kNpos ? target : index, true};
+      }
+      if (target == kNpos && key_equal_(slot.entry.first, value.first)) {
+        return {index, false};
+      }
+      if (slot.probe_length < probe_length) {
+        // Steal from the rich: displace the closer-to-home entry and keep
+        // probing with it, keeping probe sequences uniformly short.
+        std::swap(slot.entry, value);
+        std::swap(slot.probe_length, probe_length);
+        if (target == kNpos) {
+          target = index;
+        }
+      }
+      index = (index + 1) & mask;
+      ++probe_length;
+    }
+  }
+
+  /// Rehashes all entries into a slot array of the given size (a power of two).
+  void rehash_to(size_type slot_count) {
+    auto old_slots = std::move(slots_);
+    slots_ = std::vector<Slot>(slot_count);
+    size_ = 0;
+    for (auto& slot : old_slots) {
+      if (slot.probe_length != 0) {
+        insert_entry(std::move(slot.entry));
+      }
+    }
+  }
+
+  std::vector<Slot> slots_;
+  size_type size_{0};
+  hasher hasher_{};
+  key_equal key_equal_{};
+};
+
+}  // namespace beluga
+
+#endif
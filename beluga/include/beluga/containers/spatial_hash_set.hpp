@@ -0,0 +1,149 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_CONTAINERS_SPATIAL_HASH_SET_HPP
+#define BELUGA_CONTAINERS_SPATIAL_HASH_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * \file
+ * \brief Implementation of a flat open-addressing set of spatial hashes.
+ */
+
+namespace beluga {
+
+/// A flat open-addressing set of pre-hashed keys, tailored for KLD bucket counting.
+/**
+ * Unlike `std::unordered_set`, insertions never allocate per node: keys live in a single
+ * flat slot array probed linearly, and `clear()` is O(1) thanks to a generation counter,
+ * so one instance can be reused across resamples without touching the allocator.
+ *
+ * Keys are expected to be well-mixed already (e.g. outputs of `beluga::spatial_hash`);
+ * a Fibonacci multiplicative step is applied on top to pick the initial slot.
+ */
+class SpatialHashSet {
+ public:
+  /// Key type of the set.
+  using key_type = std::size_t;
+
+  /// Size type of the set.
+  using size_type = std::size_t;
+
+  /// Construct a set with a given capacity hint.
+  /**
+   * \param capacity_hint Expected number of distinct keys; the slot array is sized
+   *  to hold that many keys below the maximum load factor without rehashing.
+   * \param resource Memory resource the slot array draws from.
+   */
+  explicit SpatialHashSet(
+      size_type capacity_hint = kDefaultCapacityHint,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+      : slots_{resource} {
+    size_type slot_count = kMinSlotCount;
+    while (slot_count < 2 * capacity_hint) {
+      slot_count *= 2;
+    }
+    slots_.resize(slot_count);
+  }
+
+  /// Returns the number of keys in the set.
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+
+  /// Returns true if the set is empty.
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  /// Removes all keys from the set in O(1) by bumping the generation counter.
+  void clear() noexcept {
+    ++generation_;
+    size_ = 0;
+  }
+
+  /// Inserts a key into the set.
+  /**
+   * \param key The key to insert.
+   * \return true if the key was not present, false otherwise.
+   */
+  bool insert(key_type key) {
+    if (2 * (size_ + 1) > slots_.size()) {
+      grow();
+    }
+    const size_type mask = slots_.size() - 1;
+    size_type index = (key * kFibonacciMultiplier) & mask;
+    while (slots_[index].generation == generation_) {
+      if (slots_[index].key == key) {
+        return false;
+      }
+      index = (index + 1) & mask;
+    }
+    slots_[index] = Slot{key, generation_};
+    ++size_;
+    return true;
+  }
+
+  /// Returns true if the key is in the set.
+  [[nodiscard]] bool contains(key_type key) const {
+    const size_type mask = slots_.size() - 1;
+    size_type index = (key * kFibonacciMultiplier) & mask;
+    while (slots_[index].generation == generation_) {
+      if (slots_[index].key == key) {
+        return true;
+      }
+      index = (index + 1) & mask;
+    }
+    return false;
+  }
+
+ private:
+  /// A slot holding a key, live if its generation matches the set generation.
+  struct Slot {
+    /// Stored key, meaningful only for live slots.
+    key_type key{0};
+    /// Generation the slot was last written in; stale generations read as empty.
+    std::uint64_t generation{0};
+  };
+
+  static constexpr size_type kDefaultCapacityHint = 1024U;
+  static constexpr size_type kMinSlotCount = 16U;
+  static constexpr key_type kFibonacciMultiplier = 0x9E3779B97F4A7C15ULL;
+
+  /// Doubles the slot array and reinserts all live keys.
+  void grow() {
+    auto old_slots = std::move(slots_);
+    slots_ = std::pmr::vector<Slot>{old_slots.get_allocator().resource()};
+    slots_.resize(2 * old_slots.size());
+    const size_type mask = slots_.size() - 1;
+    for (const Slot& slot : old_slots) {
+      if (slot.generation != generation_) {
+        continue;
+      }
+      size_type index = (slot.key * kFibonacciMultiplier) & mask;
+      while (slots_[index].generation == generation_) {
+        index = (index + 1) & mask;
+      }
+      slots_[index] = slot;
+    }
+  }
+
+  std::pmr::vector<Slot> slots_;
+  std::uint64_t generation_{1};
+  size_type size_{0};
+};
+
+}  // namespace beluga
+
+#endif
@@ -15,14 +15,22 @@
 #ifndef BELUGA_CONTAINERS_TUPLE_VECTOR_HPP
 #define BELUGA_CONTAINERS_TUPLE_VECTOR_HPP
 
+#include <algorithm>
+#include <cassert>
+#include <optional>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include <beluga/type_traits.hpp>
+#include <beluga/utility/aligned_allocator.hpp>
+#include <beluga/utility/memory_hints.hpp>
+#include <beluga/utility/memory_tracker.hpp>
 #include <beluga/views/zip.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/iterator/insert_iterators.hpp>
 #include <range/v3/view/const.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/take.hpp>
 
 /**
@@ -33,7 +41,7 @@
 namespace beluga {
 
 /// Primary template for a tuple of containers.
-template <template <class> class InternalContainer, class T>
+template <template <class> class InternalContainer, class T, class ColdT = std::tuple<>>
 class TupleContainer;
 
 /// An implementation of a tuple of containers, with an interface that looks like a container of tuples.
@@ -43,11 +51,24 @@ class TupleContainer;
  * It provides the convenience of the second, but when iterating over only one of the elements of the tuple in the
  * container it has better performance (because of cache locality).
  *
+ * Auxiliary per-particle data (cluster ids, hit counts) can be attached as _cold_ columns, specified
+ * in a separate tuple. Cold columns track the size and capacity of the container but are not part of
+ * `value_type` and are not visited by iteration, so hot sweeps (propagate, reweight) never touch them
+ * and the bandwidth advantage of the column layout is preserved. Growth extends cold columns with
+ * value-initialized elements; `assign()` truncates or extends them to the new size, keeping existing
+ * values positional. Access them through \ref cold_column and \ref cold_data.
+ *
+ * Hot columns can be set to a constant in O(1) with \ref fill_column, which only records the value;
+ * the column storage is rewritten on the next access to it, so blanket rewrites such as the weight
+ * reset after a resample cost nothing until something actually touches the column. See \ref
+ * fill_column for the concurrency implications.
+ *
  * \tparam InternalContainer Container type, e.g. std::vector.
  * \tparam ...Types Elements types of the tuple.
+ * \tparam ...ColdTypes Element types of the cold columns, if any.
  */
-template <template <class> class InternalContainer, class... Types>
-class TupleContainer<InternalContainer, std::tuple<Types...>> {
+template <template <class> class InternalContainer, class... Types, class... ColdTypes>
+class TupleContainer<InternalContainer, std::tuple<Types...>, std::tuple<ColdTypes...>> {
  public:
   /// Value type of the container.
   using value_type = std::tuple<Types...>;
@@ -76,7 +97,8 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
   /**
    * \param count Size of the container.
    */
-  explicit constexpr TupleContainer(size_type count) : sequences_{((void)sizeof(Types), count)...} {}
+  explicit constexpr TupleContainer(size_type count)
+      : sequences_{((void)sizeof(Types), count)...}, cold_sequences_{((void)sizeof(ColdTypes), count)...} {}
 
   /// Constructs a container from iterators.
   template <typename I, typename S>
@@ -98,7 +120,36 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
 
   /// Clears the container.
   constexpr void clear() noexcept {
+    discard_pending_fills();
     std::apply([](auto&&... containers) { (containers.clear(), ...); }, sequences_);
+    std::apply([](auto&&... containers) { (containers.clear(), ...); }, cold_sequences_);
+  }
+
+  /// Lazily fills the `I`-th column with copies of a value.
+  /**
+   * Cost is O(1): only the value is recorded, and the column storage is rewritten on the
+   * next access to the column, through const and non-const accessors alike. A recorded
+   * fill is indistinguishable from an eager one to every consumer, but costs nothing
+   * when the column is overwritten or the container resized before being read.
+   *
+   * Since materialization may write from const accessors, the first access to a column
+   * with a pending fill requires the same external synchronization as a mutation.
+   *
+   * \param value The value every element of the column will compare equal to.
+   */
+  template <std::size_t I>
+  constexpr void fill_column(std::tuple_element_t<I, value_type> value) {
+    std::get<I>(pending_fills_) = std::move(value);
+  }
+
+  /// Returns the pending constant fill of the `I`-th column, if any.
+  /**
+   * Bulk column writers can consume the recorded value through this instead of forcing
+   * materialization just to overwrite the result.
+   */
+  template <std::size_t I>
+  [[nodiscard]] constexpr const std::optional<std::tuple_element_t<I, value_type>>& pending_fill() const noexcept {
+    return std::get<I>(pending_fills_);
   }
 
   /// Replaces elements in the container with copies of those in the range [first, last).
@@ -107,6 +158,7 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
    */
   template <typename I, typename S>
   constexpr void assign(I first, S last) {
+    discard_pending_fills();  // every element is overwritten below
     auto range = ranges::make_subrange(first, last);
     static_assert(ranges::input_range<decltype(range)>);
     if constexpr (ranges::sized_range<decltype(range)>) {
@@ -140,10 +192,34 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
     }
   }
 
+  /// Replaces the contents with a copy of another container of the same type.
+  /**
+   * Fast path for container-to-container assignment: columns are copied directly through
+   * the underlying containers instead of element by element through zip proxy iterators,
+   * which for trivially copyable column types lowers to one bulk copy per column. Unlike
+   * the iterator pair overload, cold columns are copied from `other` rather than kept,
+   * so snapshots carry auxiliary per-particle data along with the hot columns.
+   *
+   * \param other The container to copy from.
+   */
+  constexpr void assign(const TupleContainer& other) {
+    sequences_ = other.sequences_;
+    cold_sequences_ = other.cold_sequences_;
+    pending_fills_ = other.pending_fills_;
+  }
+
   /// Replaces elements in the container with a copy of each element in range.
+  /**
+   * Ranges that are containers of this exact type are detected and assigned column by
+   * column instead of through the element-wise iterator pair overload.
+   */
   template <typename R>
   constexpr void assign_range(R&& range) {
-    assign(ranges::begin(range), ranges::end(range));
+    if constexpr (std::is_base_of_v<TupleContainer, std::decay_t<R>>) {
+      assign(range);
+    } else {
+      assign(ranges::begin(range), ranges::end(range));
+    }
   }
 
   /// Reserves the specified capacity.
@@ -155,6 +231,45 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
    */
   constexpr void reserve(size_type new_cap) {
     std::apply([new_cap](auto&&... containers) { (containers.reserve(new_cap), ...); }, sequences_);
+    std::apply([new_cap](auto&&... containers) { (containers.reserve(new_cap), ...); }, cold_sequences_);
+  }
+
+  /// Requests the removal of unused capacity in all containers of the tuple.
+  /**
+   * Capacity is otherwise retained by `clear()` and by shrinking `resize()` calls, so populations
+   * that oscillate in size (e.g. between the minimum and maximum number of particles under
+   * KLD resampling) never reallocate. Call this to explicitly release memory when a smaller
+   * population is expected to last.
+   */
+  constexpr void shrink_to_fit() {
+    std::apply([](auto&&... containers) { (containers.shrink_to_fit(), ...); }, sequences_);
+    std::apply([](auto&&... containers) { (containers.shrink_to_fit(), ...); }, cold_sequences_);
+  }
+
+  /// Applies allocation placement hints to the storage of every column, hot and cold.
+  /**
+   * Call after sizing the container to its working capacity (e.g. `reserve()` with the
+   * maximum number of particles), since reallocation discards page-level hints. Hints
+   * are best-effort and never modify column contents. See beluga::MemoryHints.
+   *
+   * \param hints Hints to apply.
+   * \return True if every requested hint was applied to every column.
+   */
+  bool apply_memory_hints(const MemoryHints& hints) noexcept {
+    if (!hints.any()) {
+      return false;
+    }
+    bool applied = true;
+    // Hint the full reserved extent, not just the occupied prefix, so hints survive
+    // later growth within capacity.
+    const auto apply_to_column = [&hints](auto& container) {
+      const std::size_t extent = container.capacity() * sizeof(*container.data());
+      return beluga::apply_memory_hints(container.data(), extent, hints);
+    };
+    std::apply([&](auto&... containers) { ((applied = apply_to_column(containers) && applied), ...); }, sequences_);
+    std::apply(
+        [&](auto&... containers) { ((applied = apply_to_column(containers) && applied), ...); }, cold_sequences_);
+    return applied;
   }
 
   /// Resizes the container.
@@ -166,20 +281,102 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
    * \param count New size of the container.
    */
   constexpr void resize(size_type count) {
+    materialize_pending_fills();  // growth must extend with default initialized values
     std::apply([count](auto&&... containers) { (containers.resize(count), ...); }, sequences_);
+    std::apply([count](auto&&... containers) { (containers.resize(count), ...); }, cold_sequences_);
+  }
+
+  /// Reorders the container in place according to a sorted ancestor index array.
+  /**
+   * `ancestors` must hold one entry per element and be monotonically non-decreasing;
+   * entry `k` designates the element that must end up in slot `k`, duplicated as needed.
+   * This is the ancestry layout produced by systematic resampling, and its monotonicity
+   * is what makes the permutation-with-duplication safe to apply in place, column by
+   * column: slots whose ancestor is themselves are not touched at all. Cold columns
+   * are reordered alongside the hot ones.
+   *
+   * \param ancestors Sorted ancestor index of each slot.
+   */
+  constexpr void apply_ancestry(const std::vector<size_type>& ancestors) {
+    assert(ancestors.size() == size());
+    materialize_pending_fills();
+    std::apply([&ancestors](auto&&... containers) { (apply_ancestry_impl(containers, ancestors), ...); }, sequences_);
+    std::apply(
+        [&ancestors](auto&&... containers) { (apply_ancestry_impl(containers, ancestors), ...); }, cold_sequences_);
   }
 
   /// Adds an element at the end of the container.
   /**
+   * Cold columns, if any, are extended with a value-initialized element.
+   *
    * \param value The element to be appended.
    */
   constexpr void push_back(const value_type& value) {
+    materialize_pending_fills();
     push_back_impl(value, std::make_index_sequence<sizeof...(Types)>());
+    std::apply([](auto&&... containers) { (containers.emplace_back(), ...); }, cold_sequences_);
   }
 
   /// \overload
   constexpr void push_back(value_type&& value) {
+    materialize_pending_fills();
     push_back_impl(std::move(value), std::make_index_sequence<sizeof...(Types)>());
+    std::apply([](auto&&... containers) { (containers.emplace_back(), ...); }, cold_sequences_);
+  }
+
+  /// Returns a pointer to the underlying array of the `I`-th column.
+  /**
+   * Useful to run flat pointer-based kernels over a single element of the tuple
+   * (e.g. the weights), bypassing the proxy references that `begin()` iteration
+   * goes through and that compilers often fail to vectorize.
+   */
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto* data() {
+    materialize_pending_fill<I>();
+    return std::get<I>(sequences_).data();
+  }
+
+  /// \overload
+  template <std::size_t I>
+  [[nodiscard]] constexpr const auto* data() const {
+    materialize_pending_fill<I>();
+    return std::get<I>(sequences_).data();
+  }
+
+  /// Returns a contiguous span over the underlying array of the `I`-th column.
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto column() {
+    return ranges::make_span(data<I>(), static_cast<std::ptrdiff_t>(size()));
+  }
+
+  /// \overload
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto column() const {
+    return ranges::make_span(data<I>(), static_cast<std::ptrdiff_t>(size()));
+  }
+
+  /// Returns a pointer to the underlying array of the `I`-th cold column.
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto* cold_data() noexcept {
+    return std::get<I>(cold_sequences_).data();
+  }
+
+  /// \overload
+  template <std::size_t I>
+  [[nodiscard]] constexpr const auto* cold_data() const noexcept {
+    return std::get<I>(cold_sequences_).data();
+  }
+
+  /// Returns a contiguous span over the underlying array of the `I`-th cold column.
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto cold_column() noexcept {
+    return ranges::make_span(cold_data<I>(), static_cast<std::ptrdiff_t>(size()));
+  }
+
+  /// \overload
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto cold_column() const noexcept {
+    return ranges::make_span(cold_data<I>(), static_cast<std::ptrdiff_t>(size()));
   }
 
   /// Returns an iterator to the first element of the container.
@@ -195,40 +392,116 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
   [[nodiscard]] constexpr auto end() { return all().end(); }
 
  private:
-  std::tuple<InternalContainer<Types>...> sequences_;
+  // Mutable so pending fills can be materialized from const accessors: a recorded
+  // fill already determines the logical contents of the column, writing them out
+  // does not change the observable state.
+  mutable std::tuple<InternalContainer<Types>...> sequences_;
+  std::tuple<InternalContainer<ColdTypes>...> cold_sequences_;
+  mutable std::tuple<std::optional<Types>...> pending_fills_;
+
+  template <std::size_t I>
+  constexpr void materialize_pending_fill() const {
+    auto& pending = std::get<I>(pending_fills_);
+    if (pending.has_value()) {
+      auto& container = std::get<I>(sequences_);
+      std::fill(container.begin(), container.end(), *pending);
+      pending.reset();
+    }
+  }
+
+  template <std::size_t... Ids>
+  constexpr void materialize_pending_fills_impl(std::index_sequence<Ids...>) const {
+    (materialize_pending_fill<Ids>(), ...);
+  }
+
+  constexpr void materialize_pending_fills() const {
+    materialize_pending_fills_impl(std::make_index_sequence<sizeof...(Types)>());
+  }
+
+  constexpr void discard_pending_fills() noexcept {
+    std::apply([](auto&... pending) { (pending.reset(), ...); }, pending_fills_);
+  }
 
   template <typename T, std::size_t... Ids>
   constexpr void push_back_impl(T value, std::index_sequence<Ids...>) {
     (std::get<Ids>(sequences_).push_back(std::get<Ids>(value)), ...);
   }
 
+  template <class Container>
+  static constexpr void apply_ancestry_impl(Container& container, const std::vector<size_type>& ancestors) {
+    const size_type count = ancestors.size();
+    // Slots whose ancestor lies to the right read sources that a forward sweep has not
+    // written yet; slots whose ancestor lies to the left read sources that a backward
+    // sweep has not written yet. Monotonicity guarantees the two sets of sources are
+    // disjoint from every written slot, so both sweeps copy pristine values.
+    for (size_type index = 0; index < count; ++index) {
+      const size_type ancestor = ancestors[index];
+      if (ancestor > index) {
+        container[index] = container[ancestor];
+      }
+    }
+    for (size_type index = count; index-- > 0;) {
+      const size_type ancestor = ancestors[index];
+      if (ancestor < index) {
+        container[index] = container[ancestor];
+      }
+    }
+  }
+
   [[nodiscard]] constexpr auto all() const {
+    materialize_pending_fills();
     return std::apply([](auto&... containers) { return beluga::views::zip(containers...); }, sequences_);
   }
 
   [[nodiscard]] constexpr auto all() {
+    materialize_pending_fills();
     return std::apply([](auto&... containers) { return beluga::views::zip(containers...); }, sequences_);
   }
 };
 
-/// Shorthand for a vector with the default allocator.
-template <class T>
-using Vector = std::vector<T, std::allocator<T>>;
+/// Shorthand for a vector with a SIMD-friendly over-aligned allocator.
+/**
+ * The allocator can be overridden, but the default guarantees that each column
+ * of a `TupleVector` starts at a 64-byte boundary, so vectorized kernels over
+ * states and weights can use aligned loads without peel loops.
+ */
+template <class T, class Allocator = AlignedAllocator<T, 64>>
+using Vector = std::vector<T, Allocator>;
 
 /// Shorthand for a tuple of vectors with the default allocator.
 /**
  * This is needed so we can define deduction guides for this type.
  */
-template <class T>
-class TupleVector : public TupleContainer<Vector, T> {
+template <class T, class ColdT = std::tuple<>>
+class TupleVector : public TupleContainer<Vector, T, ColdT> {
   /// Inherited constructors.
-  using TupleContainer<Vector, T>::TupleContainer;
+  using TupleContainer<Vector, T, ColdT>::TupleContainer;
 };
 
 /// Deduction guide to construct from iterators.
 template <class I, class S, typename = std::enable_if_t<ranges::input_iterator<I> && ranges::input_iterator<S>>>
 TupleVector(I, S) -> TupleVector<decay_tuple_like_t<ranges::iter_value_t<I>>>;
 
+/// Shorthand for a vector that reports its allocations to the \ref MemoryTracker.
+/**
+ * Storage characteristics (including the 64-byte column alignment) match those
+ * of \ref Vector; only the accounting differs.
+ */
+template <class T>
+using TrackedVector =
+    std::vector<T, TrackingAllocator<T, MemorySubsystem::kParticles, AlignedAllocator<T, 64>>>;
+
+/// A \ref TupleVector whose columns are attributed to the particles memory subsystem.
+/**
+ * Drop-in replacement for \ref TupleVector that makes particle set storage show up
+ * in \ref MemoryTracker::stats under \ref MemorySubsystem::kParticles.
+ */
+template <class T, class ColdT = std::tuple<>>
+class TrackedTupleVector : public TupleContainer<TrackedVector, T, ColdT> {
+  /// Inherited constructors.
+  using TupleContainer<TrackedVector, T, ColdT>::TupleContainer;
+};
+
 }  // namespace beluga
 
 #endif
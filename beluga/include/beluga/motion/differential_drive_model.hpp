@@ -15,10 +15,12 @@
 #ifndef BELUGA_MOTION_DIFFERENTIAL_DRIVE_MODEL_HPP
 #define BELUGA_MOTION_DIFFERENTIAL_DRIVE_MODEL_HPP
 
-#include <random>
+#include <cmath>
+#include <iterator>
 #include <sophus/se3.hpp>
 #include <tuple>
 
+#include <beluga/random/ziggurat_normal_distribution.hpp>
 #include <beluga/type_traits/tuple_traits.hpp>
 
 #include <beluga/3d_embedding.hpp>
@@ -119,6 +121,56 @@ class DifferentialDriveModel {
   using control_type_2d = std::tuple<Sophus::SE2d, Sophus::SE2d>;
   using control_type_3d = std::tuple<Sophus::SE3d, Sophus::SE3d>;
 
+  /// Parameter type for the per-sample noise distributions.
+  using DistributionParam = typename ZigguratNormalDistribution<double>::param_type;
+
+  /// Sampling function for the 2D model, usable per state or over a whole state range.
+  struct SamplingFunction2d {
+    DistributionParam first_rotation_params;   /*!< First rotation noise parameters. */
+    DistributionParam translation_params;      /*!< Translation noise parameters. */
+    DistributionParam second_rotation_params;  /*!< Second rotation noise parameters. */
+
+    /// Samples a posterior state given a single prior state.
+    template <class Generator>
+    [[nodiscard]] Sophus::SE2d operator()(const Sophus::SE2d& state, Generator& gen) const {
+      static thread_local auto distribution = ZigguratNormalDistribution<double>{};
+      const auto first_rotation = Sophus::SO2d{distribution(gen, first_rotation_params)};
+      const auto translation = Eigen::Vector2d{distribution(gen, translation_params), 0.0};
+      const auto second_rotation = Sophus::SO2d{distribution(gen, second_rotation_params)};
+      return state * Sophus::SE2d{first_rotation, Eigen::Vector2d{0.0, 0.0}} *
+             Sophus::SE2d{second_rotation, translation};
+    }
+
+    /// Propagates a whole range of states in place.
+    /**
+     * Batch overload picked up by beluga::actions::propagate. Equivalent to applying
+     * the single-state overload to every element, but the group products are expanded
+     * into scalar math so the loop body builds no intermediate SE2 objects.
+     */
+    template <class Range, class Generator, class = decltype(std::begin(std::declval<Range&>()))>
+    void operator()(Range& states, Generator& gen) const {
+      static thread_local auto distribution = ZigguratNormalDistribution<double>{};
+      for (auto&& state : states) {
+        const double first_rotation = distribution(gen, first_rotation_params);
+        const double translation = distribution(gen, translation_params);
+        const double second_rotation = distribution(gen, second_rotation_params);
+        const Eigen::Vector2d heading = state.so2().unit_complex();
+        // state * SE2{first, 0} * SE2{second, (translation, 0)}, expanded.
+        const double cos_first = std::cos(first_rotation);
+        const double sin_first = std::sin(first_rotation);
+        const double cos_both = std::cos(first_rotation + second_rotation);
+        const double sin_both = std::sin(first_rotation + second_rotation);
+        const Eigen::Vector2d direction{
+            heading.x() * cos_first - heading.y() * sin_first,  //
+            heading.x() * sin_first + heading.y() * cos_first};
+        const Sophus::SO2d orientation{
+            heading.x() * cos_both - heading.y() * sin_both,  //
+            heading.x() * sin_both + heading.y() * cos_both};
+        state = Sophus::SE2d{orientation, state.translation() + translation * direction};
+      }
+    }
+  };
+
   [[nodiscard]] auto sampling_fn_3d(const Sophus::SE3d& pose, const Sophus::SE3d& previous_pose) const {
     const auto current_pose_2d = To2d(pose);
     const auto previous_pose_pose_2d = To2d(previous_pose);
@@ -138,29 +190,23 @@ class DifferentialDriveModel {
         distance > params_.distance_threshold ? heading_rotation * previous_orientation.inverse() : Sophus::SO2d{};
     const auto second_rotation = current_orientation * previous_orientation.inverse() * first_rotation.inverse();
 
-    using DistributionParam = typename std::normal_distribution<double>::param_type;
+    const double first_rotation_var = rotation_variance(first_rotation);
+    const double second_rotation_var = rotation_variance(second_rotation);
+
     const auto first_rotation_params = DistributionParam{
         first_rotation.log(), std::sqrt(
-                                  params_.rotation_noise_from_rotation * rotation_variance(first_rotation) +
+                                  params_.rotation_noise_from_rotation * first_rotation_var +
                                   params_.rotation_noise_from_translation * distance_variance)};
     const auto translation_params = DistributionParam{
         distance, std::sqrt(
                       params_.translation_noise_from_translation * distance_variance +
-                      params_.translation_noise_from_rotation *
-                          (rotation_variance(first_rotation) + rotation_variance(second_rotation)))};
+                      params_.translation_noise_from_rotation * (first_rotation_var + second_rotation_var))};
     const auto second_rotation_params = DistributionParam{
         second_rotation.log(), std::sqrt(
-                                   params_.rotation_noise_from_rotation * rotation_variance(second_rotation) +
+                                   params_.rotation_noise_from_rotation * second_rotation_var +
                                    params_.rotation_noise_from_translation * distance_variance)};
 
-    return [=](const auto& state, auto& gen) {
-      static thread_local auto distribution = std::normal_distribution<double>{};
-      const auto first_rotation = Sophus::SO2d{distribution(gen, first_rotation_params)};
-      const auto translation = Eigen::Vector2d{distribution(gen, translation_params), 0.0};
-      const auto second_rotation = Sophus::SO2d{distribution(gen, second_rotation_params)};
-      return state * Sophus::SE2d{first_rotation, Eigen::Vector2d{0.0, 0.0}} *
-             Sophus::SE2d{second_rotation, translation};
-    };
+    return SamplingFunction2d{first_rotation_params, translation_params, second_rotation_params};
   }
   param_type params_;
 
@@ -16,10 +16,10 @@
 #define BELUGA_MOTION_OMNIDIRECTIONAL_DRIVE_MODEL_HPP
 
 #include <optional>
-#include <random>
 #include <tuple>
 #include <type_traits>
 
+#include <beluga/random/ziggurat_normal_distribution.hpp>
 #include <beluga/type_traits/tuple_traits.hpp>
 
 #include <sophus/se2.hpp>
@@ -114,34 +114,40 @@ class OmnidirectionalDriveModel {
     const auto first_rotation =
         distance > params_.distance_threshold ? heading_rotation * previous_orientation.inverse() : Sophus::SO2d{};
 
-    using DistributionParam = typename std::normal_distribution<double>::param_type;
+    // Everything that only depends on the control action is computed here, so the
+    // returned closure does per-particle noise draws and group products only.
+    const double rotation_var = rotation_variance(rotation);
+
+    using DistributionParam = typename ZigguratNormalDistribution<double>::param_type;
     const auto rotation_params = DistributionParam{
         rotation.log(), std::sqrt(
-                            params_.rotation_noise_from_rotation * rotation_variance(rotation) +
+                            params_.rotation_noise_from_rotation * rotation_var +
                             params_.rotation_noise_from_translation * distance_variance)};
 
     const auto translation_params = DistributionParam{
         distance, std::sqrt(
                       params_.translation_noise_from_translation * distance_variance +
-                      params_.translation_noise_from_rotation * rotation_variance(rotation))};
+                      params_.translation_noise_from_rotation * rotation_var)};
 
     const auto strafe_params = DistributionParam{
         0.0, std::sqrt(
                  params_.strafe_noise_from_translation * distance_variance +
-                 params_.translation_noise_from_rotation * rotation_variance(rotation))};
+                 params_.translation_noise_from_rotation * rotation_var)};
+
+    const auto first_rotation_inverse = first_rotation.inverse();
+    const auto first_rotation_transform = Sophus::SE2d{first_rotation, Eigen::Vector2d{0.0, 0.0}};
 
     return [=](const state_type& state, auto& gen) {
-      static thread_local auto distribution = std::normal_distribution<double>{};
+      static thread_local auto distribution = ZigguratNormalDistribution<double>{};
       // This is an implementation based on the same set of parameters that is used in
       // nav2's omni_motion_model. To simplify the implementation, the following
       // variable substitutions were performed:
       // - first_rotation = delta_bearing - previous_orientation
       // - second_rotation = delta_rot_hat - first_rotation
-      const auto second_rotation = Sophus::SO2d{distribution(gen, rotation_params)} * first_rotation.inverse();
+      const auto second_rotation = Sophus::SO2d{distribution(gen, rotation_params)} * first_rotation_inverse;
       const auto translation =
           Eigen::Vector2d{distribution(gen, translation_params), -distribution(gen, strafe_params)};
-      return state * Sophus::SE2d{first_rotation, Eigen::Vector2d{0.0, 0.0}} *
-             Sophus::SE2d{second_rotation, translation};
+      return state * first_rotation_transform * Sophus::SE2d{second_rotation, translation};
     };
   }
 
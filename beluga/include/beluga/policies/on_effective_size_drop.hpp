@@ -34,6 +34,10 @@ struct on_effective_size_drop_policy {
   /// Default percentage threshold.
   static constexpr double kDefaultThreshold = 0.5;
 
+  /// Computing the ESS takes a full pass over the particle weights, so composition
+  /// operators evaluate any constant-cost operand first (see \ref policy_base).
+  static constexpr evaluation_cost kEvaluationCost = evaluation_cost::kLinear;
+
   /// Overload that implements the condition.
   /**
    * \tparam Range The type of the range containing particles.
@@ -50,7 +54,9 @@ struct on_effective_size_drop_policy {
 
   /// Overload that binds a specified threshold.
   constexpr auto operator()(double threshold) const {
-    return beluga::make_policy(ranges::bind_back(on_effective_size_drop_policy{}, threshold));
+    // The bind expression hides the member constant, so re-annotate the cost.
+    return beluga::make_policy(beluga::with_evaluation_cost<evaluation_cost::kLinear>(
+        ranges::bind_back(on_effective_size_drop_policy{}, threshold)));
   }
 };
 
@@ -15,7 +15,9 @@
 #ifndef BELUGA_POLICIES_POLICY_HPP
 #define BELUGA_POLICIES_POLICY_HPP
 
+#include <algorithm>
 #include <type_traits>
+#include <utility>
 
 namespace beluga {
 
@@ -23,10 +25,37 @@ namespace beluga {
 template <class PolicyFn>
 struct policy;
 
+/// Relative evaluation cost categories for policy predicates.
+/**
+ * Used by the policy composition operators to decide evaluation order: see
+ * \ref policy_base::operator&& for the ordering guarantee. Policy functions
+ * declare their category through a `kEvaluationCost` static member constant
+ * (see \ref with_evaluation_cost); functions without one — including the
+ * type-erased \ref any_policy — are assumed to be constant cost.
+ */
+enum class evaluation_cost : int {
+  kConstant = 0,  ///< Constant-time checks, e.g. interval counters or pose deltas.
+  kLinear = 1,    ///< Full passes over the particle set, e.g. effective sample size.
+};
+
 namespace detail {
 
 /// \cond
 
+template <class Fn, class = void>
+struct policy_evaluation_cost : std::integral_constant<evaluation_cost, evaluation_cost::kConstant> {};
+
+template <class Fn>
+struct policy_evaluation_cost<Fn, std::void_t<decltype(Fn::kEvaluationCost)>>
+    : std::integral_constant<evaluation_cost, Fn::kEvaluationCost> {};
+
+template <evaluation_cost Cost, class Fn>
+struct annotated_policy_fn : public Fn {
+  static constexpr evaluation_cost kEvaluationCost = Cost;
+  annotated_policy_fn() = default;
+  constexpr explicit annotated_policy_fn(Fn fn) : Fn(std::move(fn)) {}
+};
+
 struct make_policy_fn {
   template <class Fn>
   constexpr policy<Fn> operator()(Fn&& fn) const {
@@ -38,47 +67,91 @@ struct make_policy_fn {
 
 }  // namespace detail
 
+/// Evaluation cost category declared by a policy function, defaulting to constant cost.
+template <class Fn>
+inline constexpr evaluation_cost policy_evaluation_cost_v = detail::policy_evaluation_cost<Fn>::value;
+
+/// Annotates a policy function with its evaluation cost category.
+/**
+ * \tparam Cost The evaluation cost category to declare.
+ * \param fn The policy function to annotate.
+ * \return An equivalent policy function carrying a `kEvaluationCost` member constant.
+ */
+template <evaluation_cost Cost, class Fn>
+constexpr auto with_evaluation_cost(Fn fn) {
+  return detail::annotated_policy_fn<Cost, Fn>{std::move(fn)};
+}
+
 /// Make policy function objects.
 inline constexpr detail::make_policy_fn make_policy;
 
 /// Implementation detail for a policy base object.
 struct policy_base {
   /// Short-circuited logical AND operation.
+  /**
+   * The operand with the lower declared evaluation cost (see \ref evaluation_cost) is
+   * evaluated first regardless of the written order, so cheap predicates always gate
+   * expensive ones and the expensive side is skipped whenever the cheap side already
+   * decides the outcome. Operands of equal cost keep their written order. Stateful
+   * policies must not rely on being evaluated when composed with a cheaper operand;
+   * use `operator&` if both sides must be evaluated unconditionally.
+   */
   template <class Left, class Right>
   friend constexpr auto operator&&(policy<Left> left, policy<Right> right) {
-    return make_policy([=](const auto&... args) mutable -> bool { return left(args...) && right(args...); });
+    constexpr auto kCost = std::max(policy_evaluation_cost_v<Left>, policy_evaluation_cost_v<Right>);
+    if constexpr (policy_evaluation_cost_v<Right> < policy_evaluation_cost_v<Left>) {
+      return make_policy(with_evaluation_cost<kCost>(
+          [=](const auto&... args) mutable -> bool { return right(args...) && left(args...); }));
+    } else {
+      return make_policy(with_evaluation_cost<kCost>(
+          [=](const auto&... args) mutable -> bool { return left(args...) && right(args...); }));
+    }
   }
 
   /// Non-short-circuited logical AND operation.
   template <class Left, class Right>
   friend constexpr auto operator&(policy<Left> left, policy<Right> right) {
-    return make_policy([=](const auto&... args) mutable -> bool {
+    constexpr auto kCost = std::max(policy_evaluation_cost_v<Left>, policy_evaluation_cost_v<Right>);
+    return make_policy(with_evaluation_cost<kCost>([=](const auto&... args) mutable -> bool {
       const bool first = left(args...);
       const bool second = right(args...);
       return first && second;
-    });
+    }));
   }
 
   /// Short-circuited logical OR operation.
+  /**
+   * Operands are ordered by declared evaluation cost exactly as in `operator&&`:
+   * the cheaper side is evaluated first and a true result skips the expensive side.
+   */
   template <class Left, class Right>
   friend constexpr auto operator||(policy<Left> left, policy<Right> right) {
-    return make_policy([=](const auto&... args) mutable -> bool { return left(args...) || right(args...); });
+    constexpr auto kCost = std::max(policy_evaluation_cost_v<Left>, policy_evaluation_cost_v<Right>);
+    if constexpr (policy_evaluation_cost_v<Right> < policy_evaluation_cost_v<Left>) {
+      return make_policy(with_evaluation_cost<kCost>(
+          [=](const auto&... args) mutable -> bool { return right(args...) || left(args...); }));
+    } else {
+      return make_policy(with_evaluation_cost<kCost>(
+          [=](const auto&... args) mutable -> bool { return left(args...) || right(args...); }));
+    }
   }
 
   /// Non-short-circuited logical OR operation.
   template <class Left, class Right>
   friend constexpr auto operator|(policy<Left> left, policy<Right> right) {
-    return make_policy([=](const auto&... args) mutable -> bool {
+    constexpr auto kCost = std::max(policy_evaluation_cost_v<Left>, policy_evaluation_cost_v<Right>);
+    return make_policy(with_evaluation_cost<kCost>([=](const auto&... args) mutable -> bool {
       const bool first = left(args...);
       const bool second = right(args...);
       return first || second;
-    });
+    }));
   }
 
   /// Logical NOT operation.
   template <class Fn>
   friend constexpr auto operator!(policy<Fn> fn) {
-    return make_policy([=](const auto&... args) mutable -> bool { return !fn(args...); });
+    return make_policy(with_evaluation_cost<policy_evaluation_cost_v<Fn>>(
+        [=](const auto&... args) mutable -> bool { return !fn(args...); }));
   }
 };
 
@@ -95,6 +168,10 @@ struct policy_base {
  * If the second condition applies, the resulting policy will have to be called with
  * the arguments of the one that does take arguments.
  *
+ * The short-circuiting composition operators order their operands by declared
+ * evaluation cost (see \ref evaluation_cost), guaranteeing that cheap predicates
+ * always gate expensive ones no matter how the composition is written.
+ *
  * A policy should be cheaply copyable and its arguments will always be passed
  * by const-reference.
  */
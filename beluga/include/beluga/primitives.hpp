@@ -55,9 +55,39 @@ namespace beluga {
 /// Weight type, as a strongly typed `double`.
 using Weight = Numeric<double, struct WeightTag>;
 
+/// Single-precision weight type, as a strongly typed `float`.
+/**
+ * Drop-in replacement for `beluga::Weight` in particle types that trade weight storage
+ * precision for memory bandwidth: halving the weight lanes packs twice as many particles
+ * per cache line and doubles the effective SIMD width of every weight sweep. The
+ * weight-processing stages (e.g. `beluga::actions::normalize`) still accumulate totals
+ * in double precision, so only the stored weights narrow to `float`.
+ */
+using WeightF = Numeric<float, struct WeightTag>;
+
+/// Log-domain weight type, as a strongly typed `double`.
+/**
+ * Particles can store their weight in log-space to let sensor models accumulate
+ * log-likelihoods with additions instead of multiplications, avoiding the underflow
+ * that per-beam products hit with many-beam scans. Log-aware counterparts of the
+ * weight-processing stages (e.g. `beluga::actions::normalize`, `beluga::views::sample`)
+ * handle these ranges through the `beluga::log_weight` customization point.
+ */
+using LogWeight = Numeric<double, struct LogWeightTag>;
+
 /// Cluster type, as a strongly typed `std::size_t`.
 using Cluster = Numeric<std::size_t, struct ClusterTag>;
 
+/// Multiplicity type, as a strongly typed `std::size_t`.
+/**
+ * Particle types can carry a multiplicity column to represent duplicated particles
+ * compactly: after a resample, a particle with multiplicity `m` stands for `m`
+ * identical copies. Multiplicity-aware stages (e.g. `beluga::actions::resample`,
+ * `beluga::actions::expand`) handle these ranges through the `beluga::multiplicity`
+ * customization point; a multiplicity of one always means a plain particle.
+ */
+using Multiplicity = Numeric<std::size_t, struct MultiplicityTag>;
+
 namespace state_detail {
 
 /// \cond state_detail
@@ -256,6 +286,22 @@ struct weight_fn {
   constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(element<beluga::Weight>(std::forward<T>(t)))) {
     return element<beluga::Weight>(std::forward<T>(t));
   }
+
+  /// Overload for tuple-like types bearing single-precision weights.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_weight<T>>,              //
+              std::negation<has_member_weight<T>>,                       //
+              std::negation<has_non_member_weight<T>>,                   //
+              is_tuple_like<T>,                                          //
+              std::negation<has_single_element<beluga::Weight, std::decay_t<T>>>,  //
+              has_single_element<beluga::WeightF, std::decay_t<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(element<beluga::WeightF>(std::forward<T>(t)))) {
+    return element<beluga::WeightF>(std::forward<T>(t));
+  }
 };
 
 }  // namespace weight_detail
@@ -263,6 +309,209 @@ struct weight_fn {
 /// Customization point object for accessing the `weight` of a particle.
 inline constexpr weight_detail::weight_fn weight;
 
+namespace log_weight_detail {
+
+/// \cond log_weight_detail
+
+template <class T, class = void>
+struct has_member_variable_log_weight : std::false_type {};
+
+template <class T>
+struct has_member_variable_log_weight<T, std::void_t<decltype(std::declval<T>().log_weight)>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_member_variable_log_weight_v = has_member_variable_log_weight<T>::value;
+
+template <class T, class = void>
+struct has_member_log_weight : std::false_type {};
+
+template <class T>
+struct has_member_log_weight<T, std::void_t<decltype(std::declval<T>().log_weight())>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_member_log_weight_v = has_member_log_weight<T>::value;
+
+template <class T, class = void>
+struct has_non_member_log_weight : std::false_type {};
+
+template <class T>
+struct has_non_member_log_weight<T, std::void_t<decltype(log_weight(std::declval<T>()))>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_non_member_log_weight_v = has_non_member_log_weight<T>::value;
+
+/// \endcond
+
+/// Customization point object type for accessing the `log_weight` of a particle.
+/**
+ * See https://en.cppreference.com/w/cpp/ranges/cpo.
+ */
+struct log_weight_fn {
+  /// Overload for when the particle type defines a member variable.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              has_member_variable_log_weight<T>,        //
+              std::negation<has_member_log_weight<T>>,  //
+              std::negation<has_non_member_log_weight<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept {
+    return beluga::forward_like<T>(t.log_weight);
+  }
+
+  /// Overload for when the particle type defines a member method.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_log_weight<T>>,  //
+              has_member_log_weight<T>,                          //
+              std::negation<has_non_member_log_weight<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(std::forward<T>(t).log_weight())) {
+    return std::forward<T>(t).log_weight();
+  }
+
+  /// Overload for when there is an external function that takes this particle type.
+  /**
+   * The non-member function must be in T's namespace so it can be found by ADL.
+   */
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_log_weight<T>>,  //
+              std::negation<has_member_log_weight<T>>,           //
+              has_non_member_log_weight<T>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(log_weight(std::forward<T>(t)))) {
+    return log_weight(std::forward<T>(t));
+  }
+
+  /// Overload for tuple-like types.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_log_weight<T>>,  //
+              std::negation<has_member_log_weight<T>>,           //
+              std::negation<has_non_member_log_weight<T>>,       //
+              is_tuple_like<T>,                                  //
+              has_single_element<beluga::LogWeight, std::decay_t<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(element<beluga::LogWeight>(std::forward<T>(t)))) {
+    return element<beluga::LogWeight>(std::forward<T>(t));
+  }
+};
+
+}  // namespace log_weight_detail
+
+/// Customization point object for accessing the `log_weight` of a particle.
+inline constexpr log_weight_detail::log_weight_fn log_weight;
+
+namespace multiplicity_detail {
+
+/// \cond multiplicity_detail
+
+template <class T, class = void>
+struct has_member_variable_multiplicity : std::false_type {};
+
+template <class T>
+struct has_member_variable_multiplicity<T, std::void_t<decltype(std::declval<T>().multiplicity)>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_member_variable_multiplicity_v = has_member_variable_multiplicity<T>::value;
+
+template <class T, class = void>
+struct has_member_multiplicity : std::false_type {};
+
+template <class T>
+struct has_member_multiplicity<T, std::void_t<decltype(std::declval<T>().multiplicity())>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_member_multiplicity_v = has_member_multiplicity<T>::value;
+
+template <class T, class = void>
+struct has_non_member_multiplicity : std::false_type {};
+
+template <class T>
+struct has_non_member_multiplicity<T, std::void_t<decltype(multiplicity(std::declval<T>()))>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_non_member_multiplicity_v = has_non_member_multiplicity<T>::value;
+
+/// \endcond
+
+/// Customization point object type for accessing the `multiplicity` of a particle.
+/**
+ * See https://en.cppreference.com/w/cpp/ranges/cpo.
+ */
+struct multiplicity_fn {
+  /// Overload for when the particle type defines a member variable.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              has_member_variable_multiplicity<T>,        //
+              std::negation<has_member_multiplicity<T>>,  //
+              std::negation<has_non_member_multiplicity<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept {
+    return beluga::forward_like<T>(t.multiplicity);
+  }
+
+  /// Overload for when the particle type defines a member method.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_multiplicity<T>>,  //
+              has_member_multiplicity<T>,                          //
+              std::negation<has_non_member_multiplicity<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(std::forward<T>(t).multiplicity())) {
+    return std::forward<T>(t).multiplicity();
+  }
+
+  /// Overload for when there is an external function that takes this particle type.
+  /**
+   * The non-member function must be in T's namespace so it can be found by ADL.
+   */
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_multiplicity<T>>,  //
+              std::negation<has_member_multiplicity<T>>,           //
+              has_non_member_multiplicity<T>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(multiplicity(std::forward<T>(t)))) {
+    return multiplicity(std::forward<T>(t));
+  }
+
+  /// Overload for tuple-like types.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_multiplicity<T>>,  //
+              std::negation<has_member_multiplicity<T>>,           //
+              std::negation<has_non_member_multiplicity<T>>,       //
+              is_tuple_like<T>,                                    //
+              has_single_element<beluga::Multiplicity, std::decay_t<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const
+      noexcept(noexcept(element<beluga::Multiplicity>(std::forward<T>(t)))) {
+    return element<beluga::Multiplicity>(std::forward<T>(t));
+  }
+};
+
+}  // namespace multiplicity_detail
+
+/// Customization point object for accessing the `multiplicity` of a particle.
+inline constexpr multiplicity_detail::multiplicity_fn multiplicity;
+
 }  // namespace beluga
 
 #endif
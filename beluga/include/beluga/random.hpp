@@ -20,8 +20,12 @@
  * \brief Includes all Beluga random distributions.
  */
 
+#include <beluga/random/discrete_alias_distribution.hpp>
+#include <beluga/random/map_constrained_normal_distribution.hpp>
 #include <beluga/random/multivariate_normal_distribution.hpp>
 #include <beluga/random/multivariate_uniform_distribution.hpp>
+#include <beluga/random/xoshiro256pp.hpp>
+#include <beluga/random/ziggurat_normal_distribution.hpp>
 
 /**
  * \page RandomStateDistributionPage Beluga named requirements: RandomStateDistribution
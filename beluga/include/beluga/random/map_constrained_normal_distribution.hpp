@@ -0,0 +1,165 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_RANDOM_MAP_CONSTRAINED_NORMAL_DISTRIBUTION_HPP
+#define BELUGA_RANDOM_MAP_CONSTRAINED_NORMAL_DISTRIBUTION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <sophus/se2.hpp>
+
+#include <Eigen/Core>
+
+#include <beluga/random/multivariate_normal_distribution.hpp>
+#include <beluga/sensor/data/occupancy_grid.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a multivariate normal distribution constrained to occupancy grid free space.
+ */
+
+namespace beluga {
+
+/// Multivariate normal distribution in SE(2) constrained to the free space of an occupancy grid.
+/**
+ * Composes beluga::MultivariateNormalDistribution with an occupancy grid free-cell test so
+ * that every sampled pose lands on free space. Samples whose translation falls on occupied
+ * or unknown cells are rejected and redrawn up to a fixed budget; if the budget is exhausted,
+ * the translation is drawn uniformly from the free cells inside the 3-sigma ellipse region,
+ * which is precomputed at construction. Per-sample work is therefore bounded regardless of
+ * how much of the ellipse overlaps obstacles.
+ *
+ * The free-cell test uses a mask precomputed over the axis-aligned bounds of the 3-sigma
+ * region, so sampling does not access the grid. Translations beyond 3 sigma are treated as
+ * non-free, which truncates the distribution tails accordingly.
+ */
+class MapConstrainedNormalDistribution {
+ public:
+  /// Constructs a map constrained normal distribution.
+  /**
+   * \tparam Derived Concrete occupancy grid type.
+   * \param mean The mean pose of the underlying normal distribution.
+   * \param covariance The covariance of the underlying normal distribution.
+   * \param grid The occupancy grid defining the free space to sample from.
+   *
+   * \throw std::runtime_error If the provided covariance is invalid.
+   */
+  template <class Derived>
+  MapConstrainedNormalDistribution(
+      const Sophus::SE2d& mean,
+      const Sophus::Matrix3d& covariance,
+      const BaseOccupancyGrid2<Derived>& grid)
+      : distribution_{mean, covariance} {
+    const auto& self = static_cast<const Derived&>(grid);
+    inverse_resolution_ = 1.0 / self.resolution();
+    global_to_local_ = self.origin().inverse();
+
+    // The axis-aligned bounds of the 3-sigma translation ellipse in the global frame.
+    const double half_width = kSigmaRange * std::sqrt(covariance(0, 0));
+    const double half_height = kSigmaRange * std::sqrt(covariance(1, 1));
+    const Eigen::Vector2d center = mean.translation();
+
+    // Take the local-frame bounding box over the region corners, since the grid may be rotated.
+    Eigen::Vector2d lower = global_to_local_ * center;
+    Eigen::Vector2d upper = lower;
+    for (const double corner_x : {center.x() - half_width, center.x() + half_width}) {
+      for (const double corner_y : {center.y() - half_height, center.y() + half_height}) {
+        const Eigen::Vector2d corner = global_to_local_ * Eigen::Vector2d{corner_x, corner_y};
+        lower = lower.cwiseMin(corner);
+        upper = upper.cwiseMax(corner);
+      }
+    }
+
+    const auto width = static_cast<int>(self.width());
+    const auto height = static_cast<int>(self.height());
+    begin_x_ = std::clamp(static_cast<int>(std::floor(lower.x() * inverse_resolution_)), 0, width);
+    begin_y_ = std::clamp(static_cast<int>(std::floor(lower.y() * inverse_resolution_)), 0, height);
+    const int end_x = std::clamp(static_cast<int>(std::floor(upper.x() * inverse_resolution_)) + 1, 0, width);
+    const int end_y = std::clamp(static_cast<int>(std::floor(upper.y() * inverse_resolution_)) + 1, 0, height);
+    window_width_ = end_x - begin_x_;
+    window_height_ = end_y - begin_y_;
+
+    free_mask_.resize(static_cast<std::size_t>(window_width_) * static_cast<std::size_t>(window_height_));
+    for (int yi = 0; yi < window_height_; ++yi) {
+      for (int xi = 0; xi < window_width_; ++xi) {
+        const bool free = self.free_at(begin_x_ + xi, begin_y_ + yi);
+        free_mask_[static_cast<std::size_t>(yi * window_width_ + xi)] = free;
+        if (free) {
+          const auto index = self.index_at(begin_x_ + xi, begin_y_ + yi);
+          free_positions_.push_back(self.coordinates_at(index, BaseOccupancyGrid2<Derived>::Frame::kGlobal));
+        }
+      }
+    }
+    if (!free_positions_.empty()) {
+      fallback_distribution_ = std::uniform_int_distribution<std::size_t>{0, free_positions_.size() - 1};
+    }
+  }
+
+  /// Generates a random pose on free space.
+  /**
+   * \tparam URNG The type of the random number generator.
+   * \param engine The random number generator engine.
+   * \return A random Sophus::SE2d pose.
+   */
+  template <class URNG>
+  [[nodiscard]] Sophus::SE2d operator()(URNG& engine) {
+    for (std::size_t attempt = 0; attempt < kMaxAttempts; ++attempt) {
+      auto sample = distribution_(engine);
+      if (is_free(sample.translation())) {
+        return sample;
+      }
+    }
+    auto sample = distribution_(engine);
+    if (free_positions_.empty()) {
+      return sample;  // no free space within range, the constraint cannot be satisfied
+    }
+    return Sophus::SE2d{sample.so2(), free_positions_[fallback_distribution_(engine)]};
+  }
+
+ private:
+  /// Number of standard deviations covered by the precomputed free mask.
+  static constexpr double kSigmaRange = 3.0;
+  /// Number of draws from the normal distribution before falling back to a uniform free cell.
+  static constexpr std::size_t kMaxAttempts = 10;
+
+  /// Checks whether the given global-frame translation falls on a free cell.
+  [[nodiscard]] bool is_free(const Eigen::Vector2d& position) const {
+    const Eigen::Vector2d local = global_to_local_ * position;
+    const int xi = static_cast<int>(std::floor(local.x() * inverse_resolution_)) - begin_x_;
+    const int yi = static_cast<int>(std::floor(local.y() * inverse_resolution_)) - begin_y_;
+    if (xi < 0 || xi >= window_width_ || yi < 0 || yi >= window_height_) {
+      return false;
+    }
+    return free_mask_[static_cast<std::size_t>(yi * window_width_ + xi)];
+  }
+
+  MultivariateNormalDistribution<Sophus::SE2d> distribution_;
+  Sophus::SE2d global_to_local_;
+  double inverse_resolution_{1.0};
+  int begin_x_{0};                                                    ///< Window lower bound, in grid cells.
+  int begin_y_{0};                                                    ///< Window lower bound, in grid cells.
+  int window_width_{0};                                               ///< Window width, in grid cells.
+  int window_height_{0};                                              ///< Window height, in grid cells.
+  std::vector<bool> free_mask_;                                       ///< Free-cell mask over the window.
+  std::vector<Eigen::Vector2d> free_positions_;                       ///< Free cell centroids within the window.
+  std::uniform_int_distribution<std::size_t> fallback_distribution_;  ///< Uniform distribution over free cells.
+};
+
+}  // namespace beluga
+
+#endif
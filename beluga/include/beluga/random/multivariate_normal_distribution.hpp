@@ -15,10 +15,11 @@
 #ifndef BELUGA_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_HPP
 #define BELUGA_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_HPP
 
-#include <random>
+#include <cstddef>
 #include <utility>
 
 #include <beluga/random/multivariate_distribution_traits.hpp>
+#include <beluga/random/ziggurat_normal_distribution.hpp>
 
 /**
  * \file
@@ -85,14 +86,16 @@ class MultivariateNormalDistributionParam {
 
   /// Generates a new random object from the distribution.
   /**
+   * \tparam NormalDistribution A distribution of standard normal variates, such as
+   * `std::normal_distribution` or beluga::ZigguratNormalDistribution.
    * \tparam Generator The generator type that must meet the requirements of
    * [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator).
    * \param distribution A reference to a standard normal distribution instance.
    * \param generator An uniform random bit generator object.
    * \return The generated random object.
    */
-  template <class Generator>
-  [[nodiscard]] auto operator()(std::normal_distribution<scalar_type>& distribution, Generator& generator) const {
+  template <class NormalDistribution, class Generator>
+  [[nodiscard]] auto operator()(NormalDistribution& distribution, Generator& generator) const {
     const auto delta = vector_type{}.unaryExpr([&distribution, &generator](auto) { return distribution(generator); });
     if constexpr (vector_type::ColsAtCompileTime == 1) {
       return mean_ + transform_ * delta;
@@ -101,6 +104,48 @@ class MultivariateNormalDistributionParam {
     }
   }
 
+  /// Generates a batch of random objects from the distribution.
+  /**
+   * All standard normal variates for the batch are drawn up front and correlated through
+   * a single matrix-matrix product, which vectorizes much better than one matrix-vector
+   * product per sample. The generator is consumed in a different order than repeated calls
+   * to `operator()`, so the resulting sequences are statistically equivalent but not
+   * bit-identical.
+   *
+   * \tparam NormalDistribution A distribution of standard normal variates, such as
+   * `std::normal_distribution` or beluga::ZigguratNormalDistribution.
+   * \tparam Generator The generator type that must meet the requirements of
+   * [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator).
+   * \tparam UnaryFunction A callable type that can be invoked with each generated vector.
+   * \param distribution A reference to a standard normal distribution instance.
+   * \param generator An uniform random bit generator object.
+   * \param count Number of random objects to generate.
+   * \param function Callable invoked once per generated random object.
+   */
+  template <class NormalDistribution, class Generator, class UnaryFunction>
+  void sample_n(NormalDistribution& distribution, Generator& generator, std::size_t count, UnaryFunction function)
+      const {
+    const auto size = static_cast<Eigen::Index>(count);
+    const auto variate = [&distribution, &generator]() { return distribution(generator); };
+    if constexpr (vector_type::ColsAtCompileTime == 1) {
+      using batch_type = Eigen::Matrix<scalar_type, vector_type::RowsAtCompileTime, Eigen::Dynamic>;
+      // The nullary expression must be materialized before the product below, or the product
+      // would re-invoke the generator functor on every coefficient access.
+      const batch_type deltas = batch_type::NullaryExpr(mean_.size(), size, variate);
+      const batch_type correlated = transform_ * deltas;
+      for (Eigen::Index i = 0; i < size; ++i) {
+        function(vector_type{mean_ + correlated.col(i)});
+      }
+    } else {
+      using batch_type = Eigen::Matrix<scalar_type, Eigen::Dynamic, vector_type::ColsAtCompileTime>;
+      const batch_type deltas = batch_type::NullaryExpr(size, mean_.size(), variate);
+      const batch_type correlated = deltas * transform_;
+      for (Eigen::Index i = 0; i < size; ++i) {
+        function(vector_type{mean_ + correlated.row(i)});
+      }
+    }
+  }
+
  private:
   vector_type mean_{vector_type::Zero()};
   matrix_type transform_{make_transform(vector_type::Ones().asDiagonal())};
@@ -262,6 +307,28 @@ class MultivariateNormalDistribution {
     return multivariate_distribution_traits<T>::from_vector(params(distribution_, generator));
   }
 
+  /// Generates a batch of random objects in the distribution.
+  /**
+   * The whole batch is correlated through a single matrix-matrix product instead of one
+   * matrix-vector product per sample. See MultivariateNormalDistributionParam::sample_n()
+   * for details on how this affects the generated sequence.
+   *
+   * \tparam Generator The generator type that must meet the requirements of
+   * [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator).
+   * \tparam OutputIt An output iterator type with `result_type` as its value type.
+   * \param generator An uniform random bit generator object.
+   * \param out Output iterator where the generated random objects will be written.
+   * \param count Number of random objects to generate.
+   * \return Output iterator one past the last generated random object.
+   */
+  template <class Generator, class OutputIt>
+  OutputIt sample_n(Generator& generator, OutputIt out, std::size_t count) {
+    params_.sample_n(distribution_, generator, count, [&out](const vector_type& sample) {
+      *out++ = multivariate_distribution_traits<T>::from_vector(sample);
+    });
+    return out;
+  }
+
   /// Compares this object with other distribution object.
   /**
    * Two distribution objects are equal when parameter values and internal state are the same.
@@ -286,7 +353,7 @@ class MultivariateNormalDistribution {
 
  private:
   param_type params_;
-  std::normal_distribution<scalar_type> distribution_;
+  ZigguratNormalDistribution<scalar_type> distribution_;
 };
 
 /// Deduction guide to deduce the correct result type.
@@ -15,7 +15,13 @@
 #ifndef BELUGA_RANDOM_MULTIVARIATE_UNIFORM_DISTRIBUTION_HPP
 #define BELUGA_RANDOM_MULTIVARIATE_UNIFORM_DISTRIBUTION_HPP
 
+#include <iterator>
+#include <memory>
 #include <random>
+#include <vector>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/iterator/operations.hpp>
 
 #include <sophus/se2.hpp>
 #include <sophus/se3.hpp>
@@ -122,6 +128,11 @@ MultivariateUniformDistribution(const Eigen::AlignedBox3d&)
  * The range of the distribution is limited to the free space available in the occupancy grid.
  * The rotation is sampled uniformly and the translation will match the exact grid coordinates
  * of one of the free cells.
+ *
+ * The free-state table is computed once per grid and shared immutably between copies of
+ * the distribution, so handing a copy to another consumer (e.g. a worker thread sampling
+ * global relocalization candidates) costs a reference count bump instead of another full
+ * grid scan and a duplicate of the table. Copies sample independently.
  */
 template <class OccupancyGrid>
 class MultivariateUniformDistribution<Sophus::SE2d, OccupancyGrid> {
@@ -131,9 +142,9 @@ class MultivariateUniformDistribution<Sophus::SE2d, OccupancyGrid> {
    * \tparam OccupancyGrid A type of the occupancy grid.
    * \param grid The occupancy grid from which free states will be computed.
    */
-  constexpr explicit MultivariateUniformDistribution(const OccupancyGrid& grid)
-      : free_states_{compute_free_states(grid)}, distribution_{0, free_states_.size() - 1} {
-    assert(!free_states_.empty());
+  explicit MultivariateUniformDistribution(const OccupancyGrid& grid)
+      : free_states_{compute_free_states(grid)}, distribution_{0, free_states_->size() - 1} {
+    assert(!free_states_->empty());
   }
 
   /// Generates a random 2D pose.
@@ -148,15 +159,22 @@ class MultivariateUniformDistribution<Sophus::SE2d, OccupancyGrid> {
    */
   template <class URNG>
   [[nodiscard]] Sophus::SE2d operator()(URNG& engine) {
-    return {Sophus::SO2d::sampleUniform(engine), free_states_[distribution_(engine)]};
+    return {Sophus::SO2d::sampleUniform(engine), (*free_states_)[distribution_(engine)]};
   }
 
  private:
-  std::vector<Eigen::Vector2d> free_states_;                 ///< Vector containing free states.
+  /// Immutable free-state table, shared between copies of the distribution.
+  std::shared_ptr<const std::vector<Eigen::Vector2d>> free_states_;
   std::uniform_int_distribution<std::size_t> distribution_;  ///< Uniform distribution for indices.
 
-  static std::vector<Eigen::Vector2d> compute_free_states(const OccupancyGrid& grid) {
-    return grid.coordinates_for(grid.free_cells(), OccupancyGrid::Frame::kGlobal) | ranges::to<std::vector>;
+  static std::shared_ptr<const std::vector<Eigen::Vector2d>> compute_free_states(const OccupancyGrid& grid) {
+    // Count first so a single allocation holds the result; for large maps the
+    // repeated growth-and-copy cycles otherwise dominate the rebuild cost.
+    auto free_states = std::vector<Eigen::Vector2d>{};
+    free_states.reserve(static_cast<std::size_t>(ranges::distance(grid.free_cells())));
+    ranges::copy(
+        grid.coordinates_for(grid.free_cells(), OccupancyGrid::Frame::kGlobal), std::back_inserter(free_states));
+    return std::make_shared<const std::vector<Eigen::Vector2d>>(std::move(free_states));
   }
 };
 
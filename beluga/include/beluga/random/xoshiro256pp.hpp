@@ -0,0 +1,175 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_RANDOM_XOSHIRO256PP_HPP
+#define BELUGA_RANDOM_XOSHIRO256PP_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/**
+ * \file
+ * \brief Implementation of the xoshiro256++ pseudo-random number engine.
+ */
+
+namespace beluga {
+
+/// A xoshiro256++ pseudo-random number engine with support for independent streams.
+/**
+ * Satisfies the [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
+ * requirements, so it can drive any standard distribution as well as `beluga::views::sample`
+ * and `beluga::MultivariateNormalDistribution`.
+ *
+ * Unlike `std::mt19937`, the state is 256 bits and the engine supports `jump()` /
+ * `long_jump()` operations that advance it by 2^128 / 2^192 steps in constant time.
+ * `stream(n)` derives the n-th of up to 2^64 non-overlapping substreams from a common
+ * seed, which makes it possible to partition sampling work across threads while keeping
+ * results bit-identical for a given seed and partition, regardless of scheduling.
+ *
+ * See https://prng.di.unimi.it/ for the reference implementation this is based on.
+ */
+class Xoshiro256PlusPlus {
+ public:
+  /// The unsigned integer type generated by the engine.
+  using result_type = std::uint64_t;
+
+  /// Default seed for the engine.
+  static constexpr result_type default_seed = 0x02B5A7D52FA70428ULL;
+
+  /// Construct an engine seeded from a single value.
+  /**
+   * The 256-bit state is expanded from the seed with splitmix64, as recommended
+   * by the xoshiro authors to avoid correlated low-entropy states.
+   *
+   * \param value The seed value.
+   */
+  constexpr explicit Xoshiro256PlusPlus(result_type value = default_seed) noexcept { seed(value); }
+
+  /// Reseed the engine.
+  /**
+   * \param value The seed value.
+   */
+  constexpr void seed(result_type value = default_seed) noexcept {
+    result_type seed_state = value;
+    for (auto& word : state_) {
+      word = splitmix64(seed_state);
+    }
+  }
+
+  /// Generate the next value in the sequence.
+  constexpr result_type operator()() noexcept {
+    const result_type result = rotl(state_[0] + state_[3], 23) + state_[0];
+    const result_type temp = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= temp;
+    state_[3] = rotl(state_[3], 45);
+    return result;
+  }
+
+  /// Returns the minimum value potentially generated by the engine.
+  [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+
+  /// Returns the maximum value potentially generated by the engine.
+  [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+  /// Advance the engine by 2^128 steps in constant time.
+  /**
+   * Generates 2^64 non-overlapping subsequences when applied repeatedly.
+   */
+  constexpr void jump() noexcept {
+    constexpr std::array<result_type, 4> kJump = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+    apply_jump_polynomial(kJump);
+  }
+
+  /// Advance the engine by 2^192 steps in constant time.
+  /**
+   * Generates 2^32 non-overlapping blocks of 2^64 `jump()` subsequences each.
+   */
+  constexpr void long_jump() noexcept {
+    constexpr std::array<result_type, 4> kLongJump = {
+        0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL};
+    apply_jump_polynomial(kLongJump);
+  }
+
+  /// Derive the n-th independent substream of this engine.
+  /**
+   * Streams derived from engines with equal state are guaranteed to not overlap
+   * for at least 2^128 draws each, so one substream per worker index yields
+   * deterministic parallel sampling.
+   *
+   * \param n The substream index.
+   * \return A new engine positioned at the start of the n-th substream.
+   */
+  [[nodiscard]] constexpr Xoshiro256PlusPlus stream(std::uint64_t n) const noexcept {
+    Xoshiro256PlusPlus engine = *this;
+    for (std::uint64_t i = 0; i < n; ++i) {
+      engine.jump();
+    }
+    return engine;
+  }
+
+  /// Compare two engines for equality.
+  friend constexpr bool operator==(const Xoshiro256PlusPlus& lhs, const Xoshiro256PlusPlus& rhs) noexcept {
+    return lhs.state_[0] == rhs.state_[0] && lhs.state_[1] == rhs.state_[1] &&  //
+           lhs.state_[2] == rhs.state_[2] && lhs.state_[3] == rhs.state_[3];
+  }
+
+  /// Compare two engines for inequality.
+  friend constexpr bool operator!=(const Xoshiro256PlusPlus& lhs, const Xoshiro256PlusPlus& rhs) noexcept {
+    return !(lhs == rhs);
+  }
+
+ private:
+  /// Rotate `value` left by `count` bits.
+  [[nodiscard]] static constexpr result_type rotl(result_type value, int count) noexcept {
+    return (value << count) | (value >> (64 - count));
+  }
+
+  /// One step of the splitmix64 generator, used for state expansion from a seed.
+  [[nodiscard]] static constexpr result_type splitmix64(result_type& state) noexcept {
+    state += 0x9E3779B97F4A7C15ULL;
+    result_type z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  /// Apply a jump polynomial to the engine state.
+  constexpr void apply_jump_polynomial(const std::array<result_type, 4>& polynomial) noexcept {
+    std::array<result_type, 4> accumulator{};
+    for (const result_type word : polynomial) {
+      for (int bit = 0; bit < 64; ++bit) {
+        if ((word & (result_type{1} << bit)) != 0) {
+          accumulator[0] ^= state_[0];
+          accumulator[1] ^= state_[1];
+          accumulator[2] ^= state_[2];
+          accumulator[3] ^= state_[3];
+        }
+        (*this)();
+      }
+    }
+    state_ = accumulator;
+  }
+
+  std::array<result_type, 4> state_{};
+};
+
+}  // namespace beluga
+
+#endif
@@ -64,6 +64,7 @@
 #include <beluga/sensor/landmark_sensor_model.hpp>
 #include <beluga/sensor/likelihood_field_model.hpp>
 #include <beluga/sensor/likelihood_field_prob_model.hpp>
+#include <beluga/sensor/map_registry.hpp>
 
 #ifdef BELUGA_HAS_HDF5
 #include <beluga/sensor/ndt_sensor_model.hpp>
@@ -17,11 +17,13 @@
 
 #include <algorithm>
 #include <cmath>
-#include <numeric>
+#include <cstddef>
+#include <cstdint>
 #include <random>
 #include <vector>
 
 #include <beluga/algorithm/raycasting.hpp>
+#include <beluga/sensor/data/packed_occupancy_grid.hpp>
 
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/all.hpp>
@@ -55,6 +57,44 @@ struct BeamModelParam {
   double lambda_short{0.1};
   /// Maximum beam range. This is the expected value in case of a miss.
   double beam_max_range{60};
+  /// Whether to memoize raycast results across particles for the duration of one scan.
+  /**
+   * Particles concentrated in a few grid cells cast nearly identical rays, so
+   * most casts are answered from the cache after the filter converges. Bearings
+   * are quantized into `raycast_cache_bearing_bins` bins, introducing a bounded
+   * approximation error in the computed ranges.
+   */
+  bool use_raycast_cache{false};
+  /// Number of discrete bearing bins used by the raycast cache.
+  int raycast_cache_bearing_bins{4096};
+  /// Whether to evaluate the beam likelihood mixture with the branchless SoA kernel.
+  /**
+   * Scan-constant terms — the random/max tail and the short-return decay — are
+   * precomputed once per measurement instead of once per beam per particle, and the
+   * per-particle passes run over contiguous arrays with selects instead of
+   * data-dependent branches, so compilers can vectorize everything but the
+   * transcendental calls (and those too where a vector math library is available).
+   */
+  bool use_vectorized_mixture_evaluation{false};
+  /// Whether to evaluate the beam likelihood mixture from a precomputed lookup table.
+  /**
+   * Tabulates the full hit/short/max/random mixture over discretized
+   * (expected, measured) range pairs at construction time — the approach classic
+   * AMCL uses — so the per-beam per-particle cost drops to one table load, with no
+   * transcendental math left in the hot loop. Ranges are quantized to
+   * `mixture_lookup_table_bins` bins over [0, beam_max_range], introducing a
+   * bounded approximation error in the evaluated densities. The table depends only
+   * on these parameters, so map updates do not invalidate it. Takes precedence
+   * over `use_vectorized_mixture_evaluation`.
+   */
+  bool use_mixture_lookup_table{false};
+  /// Number of discretization bins per range axis of the mixture lookup table.
+  /**
+   * The table holds the square of this many single-precision entries (4 MiB at the
+   * default), and the bin width is `beam_max_range` divided by this count. More bins
+   * mean finer densities but a bigger table competing for cache with everything else.
+   */
+  std::size_t mixture_lookup_table_bins{1024};
 };
 
 /// Beam sensor model for range finders.
@@ -93,59 +133,122 @@ class BeamSensorModel {
    * \param grid Occupancy grid representing the static map that the sensor model
    *  uses to raytrace lidar beams and compute importance weights for particle states.
    */
-  explicit BeamSensorModel(const param_type& params, OccupancyGrid grid) : params_{params}, grid_{std::move(grid)} {}
+  explicit BeamSensorModel(const param_type& params, const OccupancyGrid& grid) : params_{params}, grid_{grid} {
+    if (params_.use_mixture_lookup_table) {
+      build_mixture_lookup_table();
+    }
+  }
 
   /// Returns a state weighting function conditioned on 2D lidar hits.
   /**
    * \param points 2D lidar hit points in the reference frame of particle states.
+   * \param max_range_beam_count Number of max-range returns excluded from `points`.
+   *  Whether a beam is a max-range miss is a per-scan fact, so instead of carrying
+   *  such beams through the per-particle raycasting loop, each one contributes the
+   *  scan-constant mixture density `z_max`, folded into every weight in closed form.
+   *  This drops the (state-dependent) hit component a max-range return would add,
+   *  which is negligible unless the expected range is itself near the maximum.
    * \return a state weighting function satisfying \ref StateWeightingFunctionPage
    *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
    */
-  [[nodiscard]] auto operator()(measurement_type&& points) const {
-    return [this, points = std::move(points)](const state_type& state) -> weight_type {
+  [[nodiscard]] auto operator()(measurement_type&& points, std::size_t max_range_beam_count = 0) const {
+    // TODO(Ramiro): We're converting from range + bearing to cartesian points in the ROS node, but we want range
+    // + bearing here. We might want to make that conversion in the likelihood model instead, and let the
+    // measurement type be range, bearing instead of x, y.
+
+    // Measured ranges and bearings are shared by all particles, so compute
+    // them once per scan instead of once per particle.
+    auto measured_ranges = std::vector<double>{};
+    auto bearings = std::vector<Sophus::SO2d>{};
+    measured_ranges.reserve(points.size());
+    bearings.reserve(points.size());
+    for (const auto& point : points) {
+      const double z = std::sqrt(point.first * point.first + point.second * point.second);
+      // dirty hack to prevent SO2d from calculating the hypot again to normalize the vector.
+      auto beam_bearing = Sophus::SO2d{};
+      beam_bearing.data()[0] = point.first / z;
+      beam_bearing.data()[1] = point.second / z;
+      measured_ranges.push_back(z);
+      bearings.push_back(beam_bearing);
+    }
+
+    // Scan-constant mixture terms: the random/max tail depends only on the measured
+    // range, and so does the short-return decay (up to its per-particle normalizer),
+    // so both are hoisted out of the per-particle evaluation.
+    // Measured ranges are also shared by all particles, so their table bins are
+    // quantized once per scan when the lookup table is enabled.
+    auto measured_bins = std::vector<std::size_t>{};
+    if (params_.use_mixture_lookup_table) {
+      measured_bins.reserve(measured_ranges.size());
+      for (const double z : measured_ranges) {
+        measured_bins.push_back(mixture_table_bin(z));
+      }
+    }
+
+    auto tail_terms = std::vector<double>{};
+    auto short_factors = std::vector<double>{};
+    if (params_.use_vectorized_mixture_evaluation && !params_.use_mixture_lookup_table) {
+      tail_terms.reserve(measured_ranges.size());
+      short_factors.reserve(measured_ranges.size());
+      for (const double z : measured_ranges) {
+        tail_terms.push_back(z < params_.beam_max_range ? params_.z_rand / params_.beam_max_range : params_.z_max);
+        short_factors.push_back(params_.z_short * params_.lambda_short * std::exp(-params_.lambda_short * z));
+      }
+    }
+
+    // Max-range misses contribute the same density to every particle, so their
+    // combined weight contribution is computed once per scan.
+    const double max_range_constant =
+        static_cast<double>(max_range_beam_count) * params_.z_max * params_.z_max * params_.z_max;
+
+    const std::uint64_t scan_epoch = ++scan_count_;
+    return [this, scan_epoch, max_range_constant, measured_ranges = std::move(measured_ranges),
+            bearings = std::move(bearings), measured_bins = std::move(measured_bins),
+            tail_terms = std::move(tail_terms),
+            short_factors = std::move(short_factors)](const state_type& state) -> weight_type {
       const auto beam = Ray2d{grid_, state, params_.beam_max_range};
-      const double n = 1. / (std::sqrt(2. * M_PI) * params_.sigma_hit);
-      return std::transform_reduce(
-          points.cbegin(), points.cend(), 0.0, std::plus{}, [this, &beam, n](const auto& point) {
-            // TODO(Ramiro): We're converting from range + bearing to cartesian points in the ROS node, but we want
-            // range
-            // + bearing here. We might want to make that conversion in the likelihood model instead, and let the
-            // measurement type be range, bearing instead of x, y.
-
-            // Compute the range according to the measurement.
-            const double z = std::sqrt(point.first * point.first + point.second * point.second);
-
-            // dirty hack to prevent SO2d from calculating the hypot again to normalize the vector.
-            auto beam_bearing = Sophus::SO2d{};
-            beam_bearing.data()[0] = point.first / z;
-            beam_bearing.data()[1] = point.second / z;
-
-            // Compute range according to the map (raycasting).
-            const double z_mean = beam.cast(beam_bearing).value_or(params_.beam_max_range);
-            // 1: Correct range with local measurement noise.
-            const double eta_hit =
-                2. / (std::erf((params_.beam_max_range - z_mean) / (std::sqrt(2.) * params_.sigma_hit)) -
-                      std::erf(-z_mean / (std::sqrt(2.) * params_.sigma_hit)));
-            const double d = (z - z_mean) / params_.sigma_hit;
-            double pz = params_.z_hit * eta_hit * n * std::exp(-(d * d) / 2.);
-
-            // 2: Unexpected objects.
-            if (z < z_mean) {
-              const double eta_short = 1. / (1. - std::exp(-params_.lambda_short * z_mean));
-              pz += params_.z_short * params_.lambda_short * eta_short * std::exp(-params_.lambda_short * z);
-            }
-
-            // 3 and 4: Max range return or random return.
-            if (z < params_.beam_max_range) {
-              pz += params_.z_rand / params_.beam_max_range;
-            } else {
-              pz += params_.z_max;
-            }
-
-            // TODO(glpuga): Investigate why AMCL and QuickMCL both use this formula for the weight.
-            // See https://github.com/Ekumen-OS/beluga/issues/153
-            return pz * pz * pz;
-          });
+
+      // Compute ranges according to the map (raycasting) for the whole
+      // packet of beams, reusing one buffer per thread across particles.
+      static thread_local std::vector<double> map_ranges;
+      if (params_.use_raycast_cache) {
+        // One cache per thread, shared by all particles that thread weighs
+        // and invalidated as soon as a new scan comes in.
+        static thread_local RaycastCache cache;
+        static thread_local std::uint64_t cache_epoch = 0;
+        if (cache_epoch != scan_epoch) {
+          cache.reset(params_.raycast_cache_bearing_bins);
+          cache_epoch = scan_epoch;
+        }
+        beam.cast_many(bearings, map_ranges, params_.beam_max_range, cache);
+      } else {
+        beam.cast_many(bearings, map_ranges, params_.beam_max_range);
+      }
+
+      if (params_.use_mixture_lookup_table) {
+        // One table load per beam replaces the full mixture evaluation.
+        const std::size_t bins = params_.mixture_lookup_table_bins;
+        double total = max_range_constant;
+        for (std::size_t index = 0; index < map_ranges.size(); ++index) {
+          const auto pz =
+              static_cast<double>(mixture_table_[mixture_table_bin(map_ranges[index]) * bins + measured_bins[index]]);
+          total += pz * pz * pz;
+        }
+        return total;
+      }
+
+      if (params_.use_vectorized_mixture_evaluation) {
+        return max_range_constant + vectorized_mixture(measured_ranges, map_ranges, tail_terms, short_factors);
+      }
+
+      double total = max_range_constant;
+      for (std::size_t index = 0; index < map_ranges.size(); ++index) {
+        const double pz = mixture_density(measured_ranges[index], map_ranges[index]);
+        // TODO(glpuga): Investigate why AMCL and QuickMCL both use this formula for the weight.
+        // See https://github.com/Ekumen-OS/beluga/issues/153
+        total += pz * pz * pz;
+      }
+      return total;
     };
   }
 
@@ -153,11 +256,123 @@ class BeamSensorModel {
   /**
    * \param map New occupancy grid representing the static map.
    */
-  void update_map(map_type&& map) { grid_ = std::move(map); }
+  void update_map(map_type&& map) { grid_ = PackedOccupancyGrid2{map}; }
 
  private:
+  /// Evaluates the four-component beam mixture density for one range pair.
+  /**
+   * \param z Measured beam range.
+   * \param z_mean Expected beam range obtained by raycasting.
+   * \return The mixture density p(z | z_mean).
+   */
+  [[nodiscard]] double mixture_density(double z, double z_mean) const {
+    const double n = 1. / (std::sqrt(2. * M_PI) * params_.sigma_hit);
+    // 1: Correct range with local measurement noise.
+    const double eta_hit = 2. / (std::erf((params_.beam_max_range - z_mean) / (std::sqrt(2.) * params_.sigma_hit)) -
+                                 std::erf(-z_mean / (std::sqrt(2.) * params_.sigma_hit)));
+    const double d = (z - z_mean) / params_.sigma_hit;
+    double pz = params_.z_hit * eta_hit * n * std::exp(-(d * d) / 2.);
+
+    // 2: Unexpected objects.
+    if (z < z_mean) {
+      const double eta_short = 1. / (1. - std::exp(-params_.lambda_short * z_mean));
+      pz += params_.z_short * params_.lambda_short * eta_short * std::exp(-params_.lambda_short * z);
+    }
+
+    // 3 and 4: Max range return or random return.
+    if (z < params_.beam_max_range) {
+      pz += params_.z_rand / params_.beam_max_range;
+    } else {
+      pz += params_.z_max;
+    }
+    return pz;
+  }
+
+  /// Tabulates the beam mixture over discretized (expected, measured) range pairs.
+  /**
+   * Row index is the quantized expected range and column index the quantized measured
+   * range, so the per-particle lookup walks one row segment per raycast result. Bin
+   * centers are used as sample points, which bounds the quantization error by the
+   * mixture variation across half a bin.
+   */
+  void build_mixture_lookup_table() {
+    const std::size_t bins = params_.mixture_lookup_table_bins;
+    const double bin_size = params_.beam_max_range / static_cast<double>(bins);
+    mixture_table_inv_bin_size_ = 1. / bin_size;
+    mixture_table_.resize(bins * bins);
+    for (std::size_t mean_bin = 0; mean_bin < bins; ++mean_bin) {
+      const double z_mean = (static_cast<double>(mean_bin) + 0.5) * bin_size;
+      for (std::size_t measured_bin = 0; measured_bin < bins; ++measured_bin) {
+        const double z = (static_cast<double>(measured_bin) + 0.5) * bin_size;
+        mixture_table_[mean_bin * bins + measured_bin] = static_cast<float>(mixture_density(z, z_mean));
+      }
+    }
+  }
+
+  /// Quantizes a range into a mixture lookup table bin index.
+  [[nodiscard]] std::size_t mixture_table_bin(double z) const {
+    const auto bin = static_cast<std::size_t>(std::max(z, 0.) * mixture_table_inv_bin_size_);
+    return std::min(bin, params_.mixture_lookup_table_bins - 1);
+  }
+
+  /// Evaluates the hit/short/max/random mixture for a whole beam packet with SoA passes.
+  /**
+   * \param measured_ranges Measured beam ranges, shared by all particles of the scan.
+   * \param map_ranges Raycast beam ranges for the particle under evaluation.
+   * \param tail_terms Precomputed random/max tail term per beam.
+   * \param short_factors Precomputed short-return decay per beam, missing only the normalizer.
+   * \return The accumulated particle weight.
+   */
+  [[nodiscard]] double vectorized_mixture(
+      const std::vector<double>& measured_ranges,
+      const std::vector<double>& map_ranges,
+      const std::vector<double>& tail_terms,
+      const std::vector<double>& short_factors) const {
+    // Scratch buffers are thread-local so particle evaluations stay allocation-free.
+    static thread_local std::vector<double> hit_terms;
+    static thread_local std::vector<double> short_denominators;
+    const std::size_t size = map_ranges.size();
+    hit_terms.resize(size);
+    short_denominators.resize(size);
+
+    const double sqrt2_sigma = std::sqrt(2.) * params_.sigma_hit;
+    const double n = 1. / (std::sqrt(2. * M_PI) * params_.sigma_hit);
+
+    // Pass 1: hit terms and short-return normalizers, transcendental-bound.
+    for (std::size_t index = 0; index < size; ++index) {
+      const double z_mean = map_ranges[index];
+      const double d = (measured_ranges[index] - z_mean) / params_.sigma_hit;
+      const double eta_hit =
+          2. / (std::erf((params_.beam_max_range - z_mean) / sqrt2_sigma) - std::erf(-z_mean / sqrt2_sigma));
+      hit_terms[index] = params_.z_hit * eta_hit * n * std::exp(-(d * d) / 2.);
+      short_denominators[index] = 1. - std::exp(-params_.lambda_short * z_mean);
+    }
+
+    // Pass 2: branchless mixture accumulation. The short term is blended in with a
+    // select, so no data-dependent branch remains; a zero denominator only ever
+    // occurs on the not-taken side of the select.
+    double total = 0.;
+    for (std::size_t index = 0; index < size; ++index) {
+      const double short_term = short_factors[index] / short_denominators[index];
+      const double pz =
+          hit_terms[index] + tail_terms[index] + (measured_ranges[index] < map_ranges[index] ? short_term : 0.);
+      total += pz * pz * pz;
+    }
+    return total;
+  }
+
   param_type params_;
-  OccupancyGrid grid_;
+  // Built once per map update; rays only ever query free space, so they can
+  // work off the bit-packed free mask and touch an 8x smaller working set
+  // than the source grid storage would impose.
+  PackedOccupancyGrid2 grid_;
+  // Monotonic scan counter used to invalidate per-thread raycast caches.
+  // operator() is only ever called from the filter update thread.
+  mutable std::uint64_t scan_count_{0};
+  // Precomputed mixture densities over discretized (expected, measured) range pairs.
+  // Empty unless the lookup table is enabled; parameter-only, so map updates keep it.
+  std::vector<float> mixture_table_;
+  double mixture_table_inv_bin_size_{0.};
 };
 
 }  // namespace beluga
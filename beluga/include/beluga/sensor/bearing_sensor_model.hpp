@@ -24,6 +24,7 @@
 
 // standard library
 #include <cmath>
+#include <optional>
 #include <random>
 #include <utility>
 #include <vector>
@@ -42,6 +43,14 @@ namespace beluga {
 struct BearingModelParam {
   double sigma_bearing{1.0};          ///< Standard deviation of the bearing error.
   Sophus::SE3d sensor_pose_in_robot;  ///< Pose of the sensor in the robot reference frame.
+  /// Whether to evaluate detections in batch with vectorized residual math.
+  /**
+   * When enabled, beluga::BearingSensorModel normalizes the detection bearings into a
+   * contiguous matrix once per measurement and evaluates all bearing residuals per
+   * particle with vectorized math and a single exponential; only the closest-bearing
+   * lookups remain scalar.
+   */
+  bool use_batched_evaluation = false;
 };
 
 /// Generic bearing sensor model, for both 2D and 3D state types.
@@ -85,9 +94,18 @@ class BearingSensorModel {
    * \param detections Landmark bearing detections in the reference frame of particle states.
    * \return a state weighting function satisfying \ref StateWeightingFunctionPage
    *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   *
+   * If `BearingModelParam::use_batched_evaluation` is set, the returned function
+   * normalizes the detection bearings once for all states and evaluates the bearing
+   * residuals with vectorized math, instead of per-detection scalar arithmetic.
    */
   [[nodiscard]] auto operator()(measurement_type&& detections) const {
-    return [this, detections = std::move(detections)](const state_type& state) -> weight_type {
+    auto batch = std::optional<BatchedDetections>{};
+    if (params_.use_batched_evaluation) {
+      batch = materialize_detections(detections);
+    }
+    return [this, detections = std::move(detections),
+            batch = std::move(batch)](const state_type& state) -> weight_type {
       Sophus::SE3d robot_pose_in_world;
 
       if constexpr (std::is_same_v<state_type, Sophus::SE3d>) {
@@ -106,10 +124,18 @@ class BearingSensorModel {
       // precalculate the sensor pose in the world frame
       const auto sensor_pose_in_world = robot_pose_in_world * params_.sensor_pose_in_robot;
 
-      const auto detection_weight = [this, &sensor_pose_in_world](const auto& detection) {
+      // transform the landmarks into the sensor frame once, amortizing the setup
+      // across all the detections resolved from this particle state
+      const auto bearing_query = landmark_map_.make_bearing_query(sensor_pose_in_world);
+
+      if (batch.has_value()) {
+        return batched_weight(*batch, bearing_query);
+      }
+
+      const auto detection_weight = [this, &bearing_query](const auto& detection) {
         // find the landmark the most closely matches the sample bearing vector
-        const auto opt_landmark_bearing_in_sensor = landmark_map_.find_closest_bearing_landmark(
-            detection.detection_bearing_in_sensor, detection.category, sensor_pose_in_world);
+        const auto opt_landmark_bearing_in_sensor =
+            bearing_query.find_closest_bearing_landmark(detection.detection_bearing_in_sensor, detection.category);
 
         // if we did not find a matching landmark, return 0.0
         if (!opt_landmark_bearing_in_sensor) {
@@ -146,6 +172,69 @@ class BearingSensorModel {
  private:
   param_type params_;
   LandmarkMap landmark_map_;
+
+  /// Detections materialized as contiguous columns for the batched evaluation path.
+  struct BatchedDetections {
+    Eigen::Matrix3Xd bearings_in_sensor;       ///< Unit bearing vector of each detection.
+    std::vector<LandmarkCategory> categories;  ///< Category of each detection.
+  };
+
+  /// Normalizes the detections into contiguous columns, amortized across all particles.
+  [[nodiscard]] static BatchedDetections materialize_detections(const measurement_type& detections) {
+    auto batch = BatchedDetections{};
+    const auto count = static_cast<Eigen::Index>(detections.size());
+    batch.bearings_in_sensor.resize(3, count);
+    batch.categories.reserve(detections.size());
+    for (Eigen::Index index = 0; index < count; ++index) {
+      const auto& detection = detections[static_cast<std::size_t>(index)];
+      batch.bearings_in_sensor.col(index) = detection.detection_bearing_in_sensor.normalized();
+      batch.categories.push_back(detection.category);
+    }
+    return batch;
+  }
+
+  /// Evaluates every detection against the query with batched residual math.
+  template <class BearingQuery>
+  [[nodiscard]] weight_type batched_weight(const BatchedDetections& batch, const BearingQuery& bearing_query) const {
+    const Eigen::Index count = batch.bearings_in_sensor.cols();
+
+    // The closest-bearing lookups are inherently scalar; their results are gathered
+    // into columns so the residual math below stays vectorized. The scratch buffer
+    // is thread-local to keep particle evaluations allocation-free. Lookups are
+    // insensitive to the detection bearing norm, so the normalized columns resolve
+    // to the same landmarks the raw detections would.
+    static thread_local Eigen::Matrix3Xd landmark_bearings;
+    landmark_bearings.resize(3, count);
+    for (Eigen::Index index = 0; index < count; ++index) {
+      const auto opt_landmark_bearing_in_sensor = bearing_query.find_closest_bearing_landmark(
+          batch.bearings_in_sensor.col(index), batch.categories[static_cast<std::size_t>(index)]);
+      if (!opt_landmark_bearing_in_sensor) {
+        // an unmatched detection zeroes the product of detection weights
+        return 0.0;
+      }
+      landmark_bearings.col(index) = *opt_landmark_bearing_in_sensor;
+    }
+
+    // Aperture angles between detection and landmark bearings, all at once: the dot
+    // and cross products reduce over rows, leaving one atan2 per detection.
+    const auto detection_bearings = batch.bearings_in_sensor.array();
+    const auto cos_apertures = (detection_bearings * landmark_bearings.array()).colwise().sum();
+    const auto cross_x = detection_bearings.row(1) * landmark_bearings.row(2).array() -
+                         detection_bearings.row(2) * landmark_bearings.row(1).array();
+    const auto cross_y = detection_bearings.row(2) * landmark_bearings.row(0).array() -
+                         detection_bearings.row(0) * landmark_bearings.row(2).array();
+    const auto cross_z = detection_bearings.row(0) * landmark_bearings.row(1).array() -
+                         detection_bearings.row(1) * landmark_bearings.row(0).array();
+    const auto sin_apertures = (cross_x.square() + cross_y.square() + cross_z.square()).sqrt();
+    const Eigen::ArrayXd bearing_errors =
+        sin_apertures.binaryExpr(cos_apertures, [](double y, double x) { return std::atan2(y, x); }).transpose();
+
+    // The per-detection weights form a product of exponentials, so a single
+    // exponential of the accumulated error terms evaluates all of them at once.
+    const double bearing_exponent =
+        bearing_errors.square().sum() / (2. * params_.sigma_bearing * params_.sigma_bearing);
+    return std::exp(-bearing_exponent);
+  }
 };
 
 /// Sensor model based on discrete landmarks bearing detection for 2D state types.
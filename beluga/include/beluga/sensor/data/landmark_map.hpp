@@ -16,13 +16,19 @@
 #define BELUGA_SENSOR_DATA_LANDMARK_MAP_HPP
 
 // external
-#include <range/v3/view/filter.hpp>
 #include <range/v3/view/tail.hpp>
 #include <sophus/se3.hpp>
 
 // standard library
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -48,7 +54,9 @@ class LandmarkMap {
   /// @param boundaries Limits of the map.
   /// @param landmarks List of landmarks that can be expected to be detected.
   explicit LandmarkMap(const LandmarkMapBoundaries& boundaries, landmarks_set_position_data landmarks)
-      : landmarks_(std::move(landmarks)), map_boundaries_(std::move(boundaries)) {}
+      : landmarks_(std::move(landmarks)), map_boundaries_(std::move(boundaries)) {
+    build_position_index();
+  }
 
   /// @brief Constructor with implicit map boundaries (computed from landmarks).
   /// @details Note that computing map boundaries from landmarks will effectively
@@ -68,6 +76,7 @@ class LandmarkMap {
         map_boundaries_.max() = map_boundaries_.max().cwiseMax(position);
       }
     }
+    build_position_index();
   }
 
   /// @brief Returns the map boundaries.
@@ -82,34 +91,106 @@ class LandmarkMap {
       const LandmarkPosition3& detection_position_in_world,
       const LandmarkCategory& detection_category) const {
     // only consider those that have the same id
-    auto same_category_landmarks_view =
-        landmarks_ | ranges::views::filter([detection_category = detection_category](const auto& l) {
-          return detection_category == l.category;
-        });
-
-    // find the landmark that minimizes the distance to the detection position
-    // This is O(n). A spatial data structure should be used instead.
-    auto min = std::min_element(
-        same_category_landmarks_view.begin(), same_category_landmarks_view.end(),
-        [&detection_position_in_world](const auto& a, const auto& b) {
-          const auto& landmark_a_position_in_world = a.detection_position_in_robot;
-          const auto& landmark_b_position_in_world = b.detection_position_in_robot;
-
-          const auto landmark_b_squared_in_world_squared =
-              (landmark_a_position_in_world - detection_position_in_world).squaredNorm();
-          const auto landmark_b_distance_in_world_squared =
-              (landmark_b_position_in_world - detection_position_in_world).squaredNorm();
-          return landmark_b_squared_in_world_squared < landmark_b_distance_in_world_squared;
-        });
-
-    if (min == same_category_landmarks_view.end()) {
+    const auto index_it = position_index_.find(detection_category);
+    if (index_it == position_index_.end()) {
       return std::nullopt;
     }
+    const auto& buckets = index_it->second;
+
+    // Expanding-shell search over the grid-bucket index: shells of cells around the
+    // query are scanned in increasing Chebyshev radius, and the search stops as soon
+    // as no closer landmark can exist in the shells left to scan. Queries touch a
+    // handful of buckets instead of every landmark of the category.
+    const Eigen::Vector3i center = cell_near(detection_position_in_world);
+    const auto max_radius = max_search_radius(center);
+
+    auto best_squared_distance = std::numeric_limits<double>::infinity();
+    const LandmarkPositionDetection* best = nullptr;
+    for (int radius = 0; radius <= max_radius; ++radius) {
+      // Any landmark in an unscanned shell is at least (radius - 1) cells away.
+      if (best != nullptr && square(static_cast<double>(radius - 1) * cell_size_) >= best_squared_distance) {
+        break;
+      }
+      for_each_indexed_cell_in_shell(center, radius, [&](const Eigen::Vector3i& cell) {
+        const auto bucket_it = buckets.find(cell);
+        if (bucket_it == buckets.end()) {
+          return;
+        }
+        for (const std::size_t landmark_index : bucket_it->second) {
+          const auto& landmark = landmarks_[landmark_index];
+          const auto squared_distance =
+              (landmark.detection_position_in_robot - detection_position_in_world).squaredNorm();
+          if (squared_distance < best_squared_distance) {
+            best_squared_distance = squared_distance;
+            best = &landmark;
+          }
+        }
+      });
+    }
+
+    if (best == nullptr) {
+      return std::nullopt;
+    }
+
+    return best->detection_position_in_robot;
+  }
+
+  /// Reusable bearing query context for a fixed sensor pose.
+  /**
+   * Created through \ref LandmarkMap::make_bearing_query, it transforms and normalizes
+   * every landmark into the sensor frame exactly once, so resolving a detection reduces
+   * to a dot-product scan over cached unit vectors. Use it to amortize the transform
+   * setup across all detections taken from the same sensor pose.
+   */
+  class BearingQuery {
+   public:
+    /// @brief Finds the landmark that minimizes the bearing error to a given detection and returns its data.
+    /// @param detection_bearing_in_sensor The detection data.
+    /// @param detection_category The category of the detection.
+    /// @return The landmark data. nullopt if no landmark was found.
+    [[nodiscard]] std::optional<LandmarkBearing3> find_closest_bearing_landmark(
+        const LandmarkBearing3& detection_bearing_in_sensor,
+        const LandmarkCategory& detection_category) const {
+      const auto bearings_it = bearings_by_category_.find(detection_category);
+      if (bearings_it == bearings_by_category_.end()) {
+        return std::nullopt;
+      }
+      // find the landmark that minimizes the bearing error by maximizing the dot product
+      // against the detection bearing vector (candidate bearings are unit vectors, so the
+      // detection bearing norm scales every dot product equally and can be left alone)
+      const auto& candidate_bearings = bearings_it->second;
+      const auto max = std::max_element(
+          candidate_bearings.begin(), candidate_bearings.end(),
+          [&detection_bearing_in_sensor](const auto& a, const auto& b) {
+            return a.dot(detection_bearing_in_sensor) < b.dot(detection_bearing_in_sensor);
+          });
+      return *max;
+    }
+
+   private:
+    friend class LandmarkMap;
 
-    return min->detection_position_in_robot;
+    /// Normalized bearing vectors to every landmark, in the sensor frame, grouped by category.
+    std::unordered_map<LandmarkCategory, std::vector<LandmarkBearing3>> bearings_by_category_;
+  };
+
+  /// @brief Creates a bearing query context for the given sensor pose.
+  /// @param sensor_pose_in_world The pose of the sensor in the world frame.
+  /// @return A \ref BearingQuery that can resolve any number of detections from that pose.
+  [[nodiscard]] BearingQuery make_bearing_query(const world_pose_type& sensor_pose_in_world) const {
+    auto query = BearingQuery{};
+    const auto world_in_sensor_transform = sensor_pose_in_world.inverse();
+    for (const auto& landmark : landmarks_) {
+      query.bearings_by_category_[landmark.category].push_back(
+          (world_in_sensor_transform * landmark.detection_position_in_robot).normalized());
+    }
+    return query;
   }
 
   /// @brief Finds the landmark that minimizes the bearing error to a given detection and returns its data.
+  /// @details Convenience overload for one-shot queries. Callers resolving several
+  /// detections from the same sensor pose should use \ref make_bearing_query instead,
+  /// which transforms the landmarks into the sensor frame only once.
   /// @param detection_bearing_in_sensor The detection data.
   /// @param detection_category The category of the detection.
   /// @param sensor_pose_in_world The pose of the sensor in the world frame.
@@ -118,51 +199,125 @@ class LandmarkMap {
       const LandmarkBearing3& detection_bearing_in_sensor,
       const LandmarkCategory& detection_category,
       const world_pose_type& sensor_pose_in_world) const {
-    // only consider those that have the same detection id (category)
-    auto same_category_landmarks_view =
-        landmarks_ | ranges::views::filter([detection_category = detection_category](const auto& l) {
-          return detection_category == l.category;
-        });
-
-    // find the landmark that minimizes the bearing error
     const auto world_in_sensor_transform = sensor_pose_in_world.inverse();
 
-    // This whole search thing is very expensive, with objects getting created, normalized and
-    // destroyed multiple times and the same transformations being calculated over and over again.
-    // This will only work as a proof-of-concept, but it needs to be optimized for large numbers of
-    // landmarks.
-    const auto minimization_function = [&detection_bearing_in_sensor, &world_in_sensor_transform](
-                                           const auto& a, const auto& b) {
-      const auto& landmark_a_position_in_world = a.detection_position_in_robot;
-      const auto& landmark_b_position_in_world = b.detection_position_in_robot;
+    auto best_dot_product = -std::numeric_limits<double>::infinity();
+    auto best_bearing = std::optional<LandmarkBearing3>{};
+    for (const auto& landmark : landmarks_) {
+      if (landmark.category != detection_category) {
+        continue;
+      }
+      // convert the landmark location relative to the sensor frame, once per candidate
+      const auto bearing = (world_in_sensor_transform * landmark.detection_position_in_robot).normalized();
+      const auto dot_product = bearing.dot(detection_bearing_in_sensor);
+      if (dot_product > best_dot_product) {
+        best_dot_product = dot_product;
+        best_bearing = bearing;
+      }
+    }
+    return best_bearing;
+  }
+
+ private:
+  /// Hashes an integer grid cell. Uses the `hash_combine` scheme of the Boost library.
+  struct CellHash {
+    /// Hash operator.
+    std::size_t operator()(const Eigen::Vector3i& cell) const {
+      std::size_t seed = 0;
+      for (int i = 0; i < 3; ++i) {
+        seed ^= std::hash<int>{}(cell[i]) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      }
+      return seed;
+    }
+  };
 
-      // convert the landmark locations relative to the sensor frame
-      const auto landmark_a_bearing_in_sensor = (world_in_sensor_transform * landmark_a_position_in_world).normalized();
-      const auto landmark_b_bearing_in_sensor = (world_in_sensor_transform * landmark_b_position_in_world).normalized();
+  /// Map from grid cell to the indices of the landmarks that fall in it.
+  using cell_bucket_map = std::unordered_map<Eigen::Vector3i, std::vector<std::size_t>, CellHash>;
 
-      // find the landmark that minimizes the bearing error by maximizing the dot product against the
-      // detection bearing vector
-      const auto dot_product_a = landmark_a_bearing_in_sensor.dot(detection_bearing_in_sensor);
-      const auto dot_product_b = landmark_b_bearing_in_sensor.dot(detection_bearing_in_sensor);
+  /// Returns the grid cell containing the given position.
+  [[nodiscard]] Eigen::Vector3i cell_near(const LandmarkPosition3& position) const {
+    return Eigen::Vector3i{
+        static_cast<int>(std::floor(position.x() / cell_size_)),  //
+        static_cast<int>(std::floor(position.y() / cell_size_)),  //
+        static_cast<int>(std::floor(position.z() / cell_size_))};
+  }
 
-      return dot_product_a > dot_product_b;
-    };
+  /// Returns the squared value of the argument.
+  [[nodiscard]] static constexpr double square(double value) { return value * value; }
 
-    auto min = std::min_element(
-        same_category_landmarks_view.begin(), same_category_landmarks_view.end(), minimization_function);
+  /// Returns the shell radius at which a search from the given cell has covered every indexed cell.
+  [[nodiscard]] int max_search_radius(const Eigen::Vector3i& center) const {
+    int radius = 0;
+    for (int i = 0; i < 3; ++i) {
+      radius = std::max({radius, std::abs(index_min_cell_[i] - center[i]), std::abs(index_max_cell_[i] - center[i])});
+    }
+    return radius;
+  }
 
-    if (min == same_category_landmarks_view.end()) {
-      return std::nullopt;
+  /// Invokes a function over every indexed cell at exactly the given Chebyshev radius from the center.
+  /**
+   * Cells outside the bounding box of the indexed cells are skipped without being
+   * visited, so shells that barely overlap the map cost next to nothing.
+   */
+  template <class Function>
+  void for_each_indexed_cell_in_shell(const Eigen::Vector3i& center, int radius, Function function) const {
+    const int x_begin = std::max(-radius, index_min_cell_.x() - center.x());
+    const int x_end = std::min(radius, index_max_cell_.x() - center.x());
+    const int y_begin = std::max(-radius, index_min_cell_.y() - center.y());
+    const int y_end = std::min(radius, index_max_cell_.y() - center.y());
+    const int z_begin = std::max(-radius, index_min_cell_.z() - center.z());
+    const int z_end = std::min(radius, index_max_cell_.z() - center.z());
+    for (int x = x_begin; x <= x_end; ++x) {
+      for (int y = y_begin; y <= y_end; ++y) {
+        if (std::max(std::abs(x), std::abs(y)) == radius) {
+          // A lateral face of the shell: every z belongs to it.
+          for (int z = z_begin; z <= z_end; ++z) {
+            function(Eigen::Vector3i{center.x() + x, center.y() + y, center.z() + z});
+          }
+        } else {
+          // Interior column: only the top and bottom faces belong to the shell.
+          if (-radius >= z_begin) {
+            function(Eigen::Vector3i{center.x() + x, center.y() + y, center.z() - radius});
+          }
+          if (radius <= z_end && radius != 0) {
+            function(Eigen::Vector3i{center.x() + x, center.y() + y, center.z() + radius});
+          }
+        }
+      }
     }
+  }
 
-    // find the normalized bearing vector to the landmark, relative to the sensor frame
-    const auto landmark_position_in_sensor = world_in_sensor_transform * min->detection_position_in_robot;
-    return landmark_position_in_sensor.normalized();
+  /// Builds the per-category grid-bucket index over landmark positions.
+  /**
+   * The cell size targets one landmark per bucket on average, so nearest queries
+   * typically resolve within the first couple of shells.
+   */
+  void build_position_index() {
+    const auto extent = map_boundaries_.diagonal().norm();
+    const auto count = static_cast<double>(landmarks_.size()) + 1.0;
+    // Degenerate (empty or single-cell) maps get a unit cell; any size works for them.
+    cell_size_ = extent > 0.0 ? extent / std::cbrt(count) : 1.0;
+    position_index_.clear();
+    for (std::size_t landmark_index = 0; landmark_index < landmarks_.size(); ++landmark_index) {
+      const auto& landmark = landmarks_[landmark_index];
+      const auto cell = cell_near(landmark.detection_position_in_robot);
+      if (landmark_index == 0) {
+        index_min_cell_ = cell;
+        index_max_cell_ = cell;
+      } else {
+        index_min_cell_ = index_min_cell_.cwiseMin(cell);
+        index_max_cell_ = index_max_cell_.cwiseMax(cell);
+      }
+      position_index_[landmark.category][cell].push_back(landmark_index);
+    }
   }
 
- private:
   landmarks_set_position_data landmarks_;
   LandmarkMapBoundaries map_boundaries_;
+  std::unordered_map<LandmarkCategory, cell_bucket_map> position_index_;
+  Eigen::Vector3i index_min_cell_ = Eigen::Vector3i::Zero();
+  Eigen::Vector3i index_max_cell_ = Eigen::Vector3i::Zero();
+  double cell_size_ = 1.0;
 };
 
 }  // namespace beluga
@@ -41,6 +41,9 @@ namespace beluga {
  * \ref DenseGrid2Page and given `g` a possibly const instance of `G`:
  * - `g.data()` returns a possibly const reference to an indexable,
  *   random access linear data structure containing grid cell data values;
+ *   data structures with a flat layout should advertise it, as defined
+ *   by the beluga::has_contiguous_layout trait, so that iteration over
+ *   grid rows can lower to bulk memory operations;
  * - given possibly const grid cell index `i` of `std::size_t` type,
  *   `g.data_at(i)` optionally returns cell data, if cell is included;
  * - given possibly const grid cell index `i` of `std::size_t` type,
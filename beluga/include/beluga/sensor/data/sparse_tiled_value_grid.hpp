@@ -0,0 +1,191 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_SPARSE_TILED_VALUE_GRID_HPP
+#define BELUGA_SENSOR_DATA_SPARSE_TILED_VALUE_GRID_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+/**
+ * \file
+ * \brief Implementation of a generic value grid storing tiled pages only where values differ from a background.
+ */
+
+namespace beluga {
+
+/// Generic 2D value grid with sparsely allocated tiled storage.
+/**
+ * Stores cells in square tiles like beluga::TiledValueGrid2, but only materializes the
+ * tiles where at least one cell differs from a uniform background value; lookups into
+ * unallocated tiles return the background. Large mostly featureless grids — e.g. the
+ * likelihood field of an outdoor map where the vast majority of cells hold the ambient
+ * background likelihood — then cost memory proportional to their feature content rather
+ * than their extent, while keeping constant-time lookups through a per-tile page table.
+ *
+ * \tparam T Any copyable and equality comparable type.
+ * \tparam TileSize Cell count per tile side. The default packs an 8x8 tile of
+ *  4-byte cells in 4 consecutive cache lines.
+ */
+template <typename T, std::size_t TileSize = 8U>
+class SparseTiledValueGrid2 {
+ public:
+  /// Constructs the grid from row-major data.
+  /**
+   * \param data Grid data in row-major layout.
+   * \param width Grid width. Must evenly divide `data` size.
+   * \param resolution Grid resolution.
+   * \param background Value assumed for every cell of the tiles left unallocated.
+   */
+  explicit SparseTiledValueGrid2(
+      const std::vector<T>& data,
+      std::size_t width,
+      double resolution = 1.,
+      T background = T{})
+      : background_{background},
+        width_{width},
+        height_{width > 0U ? data.size() / width : 0U},
+        resolution_{resolution},
+        tiles_per_row_{(width_ + TileSize - 1U) / TileSize} {
+    assert(width == 0U || data.size() % width == 0);
+    const std::size_t tiles_per_column = (height_ + TileSize - 1U) / TileSize;
+    page_table_.assign(tiles_per_row_ * tiles_per_column, kNoPage);
+    for (std::size_t tile_y = 0U; tile_y < tiles_per_column; ++tile_y) {
+      for (std::size_t tile_x = 0U; tile_x < tiles_per_row_; ++tile_x) {
+        bool uniform = true;
+        for (std::size_t y = tile_y * TileSize; uniform && y < std::min((tile_y + 1U) * TileSize, height_); ++y) {
+          for (std::size_t x = tile_x * TileSize; x < std::min((tile_x + 1U) * TileSize, width_); ++x) {
+            if (!(data[y * width_ + x] == background_)) {
+              uniform = false;
+              break;
+            }
+          }
+        }
+        if (uniform) {
+          continue;
+        }
+        const auto page = static_cast<std::uint32_t>(pages_.size() / (TileSize * TileSize));
+        page_table_[tile_y * tiles_per_row_ + tile_x] = page;
+        pages_.resize(pages_.size() + TileSize * TileSize, background_);
+        for (std::size_t y = tile_y * TileSize; y < std::min((tile_y + 1U) * TileSize, height_); ++y) {
+          for (std::size_t x = tile_x * TileSize; x < std::min((tile_x + 1U) * TileSize, width_); ++x) {
+            pages_[page * TileSize * TileSize + (y % TileSize) * TileSize + (x % TileSize)] = data[y * width_ + x];
+          }
+        }
+      }
+    }
+  }
+
+  /// Gets grid width.
+  [[nodiscard]] std::size_t width() const { return width_; }
+
+  /// Gets grid height.
+  [[nodiscard]] std::size_t height() const { return height_; }
+
+  /// Gets grid resolution.
+  [[nodiscard]] double resolution() const { return resolution_; }
+
+  /// Gets grid size (ie. number of addressable grid cells).
+  [[nodiscard]] std::size_t size() const { return width_ * height_; }
+
+  /// Gets the value assumed for cells of unallocated tiles.
+  [[nodiscard]] const T& background() const { return background_; }
+
+  /// Gets the number of materialized tiles.
+  [[nodiscard]] std::size_t allocated_tiles() const { return pages_.size() / (TileSize * TileSize); }
+
+  /// Gets the total number of tiles the grid spans, allocated or not.
+  [[nodiscard]] std::size_t tile_count() const { return page_table_.size(); }
+
+  /// Gets the backing storage of the materialized tiles.
+  [[nodiscard]] const std::vector<T>& pages() const { return pages_; }
+
+  /// Gets cell data, if included.
+  /**
+   * \param xi Grid cell x-axis coordinate.
+   * \param yi Grid cell y-axis coordinate.
+   * \return Cell data if included, `std::nullopt` otherwise.
+   */
+  [[nodiscard]] std::optional<T> data_at(int xi, int yi) const {
+    if (xi < 0 || yi < 0 || static_cast<std::size_t>(xi) >= width_ || static_cast<std::size_t>(yi) >= height_) {
+      return std::nullopt;
+    }
+    return value_at(xi, yi);
+  }
+
+  /// Gets cell data at the cell containing the given coordinates, if included.
+  /**
+   * \param x Plane x-axis coordinate.
+   * \param y Plane y-axis coordinate.
+   * \return Cell data if included, `std::nullopt` otherwise.
+   */
+  [[nodiscard]] std::optional<T> data_near(double x, double y) const {
+    return data_at(
+        static_cast<int>(std::floor(x / resolution_)),  //
+        static_cast<int>(std::floor(y / resolution_)));
+  }
+
+  /// Gets cell data without bounds checking.
+  /**
+   * \param xi Grid cell x-axis coordinate. Must be within the grid.
+   * \param yi Grid cell y-axis coordinate. Must be within the grid.
+   */
+  [[nodiscard]] T value_at(int xi, int yi) const {
+    const auto x = static_cast<std::size_t>(xi);
+    const auto y = static_cast<std::size_t>(yi);
+    const std::uint32_t page = page_table_[(y / TileSize) * tiles_per_row_ + (x / TileSize)];
+    if (page == kNoPage) {
+      return background_;
+    }
+    return pages_[page * TileSize * TileSize + (y % TileSize) * TileSize + (x % TileSize)];
+  }
+
+  /// Prefetches the cache line backing the given cell, if its tile is allocated.
+  /**
+   * \param xi Grid cell x-axis coordinate. Must be within the grid.
+   * \param yi Grid cell y-axis coordinate. Must be within the grid.
+   */
+  void prefetch_at([[maybe_unused]] int xi, [[maybe_unused]] int yi) const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    const auto x = static_cast<std::size_t>(xi);
+    const auto y = static_cast<std::size_t>(yi);
+    const std::uint32_t page = page_table_[(y / TileSize) * tiles_per_row_ + (x / TileSize)];
+    if (page != kNoPage) {
+      __builtin_prefetch(pages_.data() + page * TileSize * TileSize + (y % TileSize) * TileSize + (x % TileSize));
+    }
+#endif
+  }
+
+ private:
+  /// Page table sentinel for tiles left unallocated.
+  static constexpr std::uint32_t kNoPage = std::numeric_limits<std::uint32_t>::max();
+
+  std::vector<T> pages_;
+  std::vector<std::uint32_t> page_table_;
+  T background_;
+  std::size_t width_;
+  std::size_t height_;
+  double resolution_;
+  std::size_t tiles_per_row_;
+};
+
+}  // namespace beluga
+
+#endif
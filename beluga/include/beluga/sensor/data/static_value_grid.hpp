@@ -0,0 +1,109 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_STATIC_VALUE_GRID_HPP
+#define BELUGA_SENSOR_DATA_STATIC_VALUE_GRID_HPP
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <beluga/sensor/data/linear_grid.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a value grid with compile-time extents.
+ */
+
+namespace beluga {
+
+/// Generic 2D linear value grid with static extents.
+/**
+ * Drop-in alternative to `ValueGrid2` for deployments where the map tiling is
+ * fixed and known at build time. With the extents baked into the type, index
+ * arithmetic operates on compile-time constants: for power-of-two widths
+ * `index_at` compiles down to a shift and a bitwise or, and the division and
+ * modulo in `coordinates_at` reduce to shift and mask. Bounds checks against
+ * `width()` and `height()` compare against immediates.
+ *
+ * \tparam T Any copyable type.
+ * \tparam W Grid width, in cells. Must be greater than zero.
+ * \tparam H Grid height, in cells. Must be greater than zero.
+ */
+template <typename T, std::size_t W, std::size_t H>
+class StaticValueGrid2 : public BaseLinearGrid2<StaticValueGrid2<T, W, H>> {
+ public:
+  static_assert(W > 0 && H > 0, "Grid extents must be greater than zero");
+
+  /// Whether `index_at` uses shift-or indexing instead of a multiply-add.
+  static constexpr bool kHasPowerOfTwoWidth = (W & (W - 1)) == 0;
+
+  /// Constructs the grid.
+  /**
+   * \param data Grid data. Its size must match the static extents.
+   * \param resolution Grid resolution.
+   */
+  explicit StaticValueGrid2(std::vector<T> data, double resolution = 1.)
+      : data_(std::move(data)), resolution_(resolution) {
+    assert(data_.size() == W * H);
+  }
+
+  /// Gets grid width.
+  [[nodiscard]] static constexpr std::size_t width() { return W; }
+
+  /// Gets grid height.
+  [[nodiscard]] static constexpr std::size_t height() { return H; }
+
+  /// Gets grid size (ie. number of grid cells).
+  [[nodiscard]] static constexpr std::size_t size() { return W * H; }
+
+  /// Gets grid resolution.
+  [[nodiscard]] double resolution() const { return resolution_; }
+
+  /// Gets grid data.
+  [[nodiscard]] const std::vector<T>& data() const { return data_; }
+
+  using BaseLinearGrid2<StaticValueGrid2<T, W, H>>::index_at;
+
+  /// Computes index for given grid cell coordinates.
+  /**
+   * \param xi Grid cell x-axis coordinate.
+   * \param yi Grid cell y-axis coordinate.
+   */
+  [[nodiscard]] constexpr std::size_t index_at(int xi, int yi) const {
+    if constexpr (kHasPowerOfTwoWidth) {
+      return (static_cast<std::size_t>(yi) << kWidthShift) | static_cast<std::size_t>(xi);
+    } else {
+      return static_cast<std::size_t>(yi) * W + static_cast<std::size_t>(xi);
+    }
+  }
+
+ private:
+  // Base-2 logarithm of the width, only meaningful for power-of-two widths.
+  static constexpr std::size_t kWidthShift = []() {
+    std::size_t shift = 0U;
+    while ((std::size_t{1} << shift) < W) {
+      ++shift;
+    }
+    return shift;
+  }();
+
+  std::vector<T> data_;
+  double resolution_;
+};
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,143 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_TILED_VALUE_GRID_HPP
+#define BELUGA_SENSOR_DATA_TILED_VALUE_GRID_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include <beluga/sensor/data/linear_grid.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a generic value grid with cache-blocked tiled storage.
+ */
+
+namespace beluga {
+
+/// Generic 2D linear value grid with tiled storage.
+/**
+ * Stores cells in square tiles laid out contiguously, instead of the row-major
+ * layout of beluga::ValueGrid2. Spatially clustered 2D probes (e.g. likelihood
+ * lookups for the points of a lidar scan) then land in the same or adjacent
+ * cache lines rather than strided rows apart. The grid is padded up to whole
+ * tiles with value-initialized cells; padding cells are stored but not
+ * addressable through the cell-coordinate interface.
+ *
+ * \tparam T Any copyable type.
+ * \tparam TileSize Cell count per tile side. The default packs an 8x8 tile of
+ *  4-byte cells in 4 consecutive cache lines.
+ */
+template <typename T, std::size_t TileSize = 8U>
+class TiledValueGrid2 : public BaseLinearGrid2<TiledValueGrid2<T, TileSize>> {
+ public:
+  /// Constructs the grid from row-major data.
+  /**
+   * \param data Grid data in row-major layout.
+   * \param width Grid width. Must evenly divide `data` size.
+   * \param resolution Grid resolution.
+   */
+  explicit TiledValueGrid2(const std::vector<T>& data, std::size_t width, double resolution = 1.)
+      : width_(width),
+        height_(width > 0U ? data.size() / width : 0U),
+        resolution_(resolution),
+        tiles_per_row_((width_ + TileSize - 1U) / TileSize) {
+    assert(width == 0U || data.size() % width == 0);
+    const std::size_t tiles_per_column = (height_ + TileSize - 1U) / TileSize;
+    data_.resize(tiles_per_row_ * tiles_per_column * TileSize * TileSize);
+    for (std::size_t yi = 0U; yi < height_; ++yi) {
+      for (std::size_t xi = 0U; xi < width_; ++xi) {
+        data_[index_at(static_cast<int>(xi), static_cast<int>(yi))] = data[yi * width_ + xi];
+      }
+    }
+  }
+
+  using BaseLinearGrid2<TiledValueGrid2<T, TileSize>>::index_at;
+
+  /// Computes index for given grid cell coordinates.
+  /**
+   * \param xi Grid cell x-axis coordinate.
+   * \param yi Grid cell y-axis coordinate.
+   */
+  [[nodiscard]] std::size_t index_at(int xi, int yi) const {
+    const auto x = static_cast<std::size_t>(xi);
+    const auto y = static_cast<std::size_t>(yi);
+    const std::size_t tile = (y / TileSize) * tiles_per_row_ + (x / TileSize);
+    return tile * TileSize * TileSize + (y % TileSize) * TileSize + (x % TileSize);
+  }
+
+  using BaseLinearGrid2<TiledValueGrid2<T, TileSize>>::coordinates_at;
+
+  /// Compute plane coordinates given a grid cell index.
+  /**
+   * \param index Grid cell index.
+   * \return Plane coordinates of the cell centroid.
+   */
+  [[nodiscard]] Eigen::Vector2d coordinates_at(std::size_t index) const {
+    return this->coordinates_at(cell_at(index));
+  }
+
+  using BaseDenseGrid2<TiledValueGrid2<T, TileSize>>::neighborhood4;
+
+  /// Computes 4-connected neighborhood for cell.
+  /**
+   * \param index Grid cell index.
+   * \return range of neighbor cells' indices.
+   */
+  [[nodiscard]] auto neighborhood4(std::size_t index) const {
+    auto result = std::vector<std::size_t>{};
+    const auto cell = cell_at(index);
+    for (const auto& neighbor : this->neighborhood4(cell.x(), cell.y())) {
+      result.push_back(index_at(neighbor.x(), neighbor.y()));
+    }
+    return result;
+  }
+
+  /// Gets grid width.
+  [[nodiscard]] std::size_t width() const { return width_; }
+
+  /// Gets grid height.
+  [[nodiscard]] std::size_t height() const { return height_; }
+
+  /// Gets grid resolution.
+  [[nodiscard]] double resolution() const { return resolution_; }
+
+  /// Gets grid size (ie. number of stored grid cells, padding included).
+  [[nodiscard]] std::size_t size() const { return data_.size(); }
+
+  /// Gets grid data, in tiled layout.
+  [[nodiscard]] const std::vector<T>& data() const { return data_; }
+
+ private:
+  /// Returns the grid cell coordinates corresponding to the given index.
+  [[nodiscard]] Eigen::Vector2i cell_at(std::size_t index) const {
+    const std::size_t tile = index / (TileSize * TileSize);
+    const std::size_t offset = index % (TileSize * TileSize);
+    return Eigen::Vector2i{
+        static_cast<int>((tile % tiles_per_row_) * TileSize + offset % TileSize),
+        static_cast<int>((tile / tiles_per_row_) * TileSize + offset / TileSize)};
+  }
+
+  std::vector<T> data_;
+  std::size_t width_;
+  std::size_t height_;
+  double resolution_;
+  std::size_t tiles_per_row_;
+};
+
+}  // namespace beluga
+
+#endif
@@ -15,7 +15,9 @@
 #ifndef BELUGA_SENSOR_DATA_VALUE_GRID_HPP
 #define BELUGA_SENSOR_DATA_VALUE_GRID_HPP
 
+#include <cassert>
 #include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -68,6 +70,87 @@ class ValueGrid2 : public BaseLinearGrid2<ValueGrid2<T>> {
   double resolution_;
 };
 
+/// Generic 2D linear value grid over externally mapped storage.
+/**
+ * Non-owning counterpart of beluga::ValueGrid2: cell data lives outside the grid —
+ * typically in a memory mapped file or a shared memory segment — and is viewed in
+ * place, with an opaque handle keeping the backing storage alive for the lifetime
+ * of the grid.
+ *
+ * \tparam T Any copyable type.
+ */
+template <typename T>
+class MappedValueGrid2 : public BaseLinearGrid2<MappedValueGrid2<T>> {
+ public:
+  /// Non-owning indexable view over contiguous cell values.
+  class DataView {
+   public:
+    /// Tag advertising the flat layout of the view (see beluga::has_contiguous_layout).
+    using contiguous_layout_tag = void;
+
+    /// Constructs a view over `size` values starting at `data`.
+    constexpr DataView(const T* data, std::size_t size) : data_(data), size_(size) {}
+    /// Returns the value at `index`.
+    constexpr const T& operator[](std::size_t index) const { return data_[index]; }
+    /// Returns the number of values in the view.
+    [[nodiscard]] constexpr std::size_t size() const { return size_; }
+    /// Returns a pointer to the first value.
+    [[nodiscard]] constexpr const T* data() const { return data_; }
+    /// Returns an iterator to the first value.
+    [[nodiscard]] constexpr const T* begin() const { return data_; }
+    /// Returns an iterator past the last value.
+    [[nodiscard]] constexpr const T* end() const { return data_ + size_; }
+
+   private:
+    const T* data_;
+    std::size_t size_;
+  };
+
+  /// Constructs the grid view.
+  /**
+   * \param data Pointer to the first of `size` cell values.
+   * \param size Number of cell values. Must be evenly divided by `width`.
+   * \param width Grid width.
+   * \param resolution Grid resolution.
+   * \param keepalive Handle keeping the backing storage alive for the lifetime of the grid.
+   */
+  explicit MappedValueGrid2(
+      const T* data,
+      std::size_t size,
+      std::size_t width,
+      double resolution = 1.,
+      std::shared_ptr<const void> keepalive = nullptr)
+      : data_(data, size),
+        width_(width),
+        height_(size / width),
+        resolution_(resolution),
+        keepalive_(std::move(keepalive)) {
+    assert(size % width == 0);
+  }
+
+  /// Gets grid width.
+  [[nodiscard]] std::size_t width() const { return width_; }
+
+  /// Gets grid height.
+  [[nodiscard]] std::size_t height() const { return height_; }
+
+  /// Gets grid resolution.
+  [[nodiscard]] double resolution() const { return resolution_; }
+
+  /// Gets grid size (ie. number of grid cells).
+  [[nodiscard]] std::size_t size() const { return data_.size(); }
+
+  /// Gets grid data.
+  [[nodiscard]] const DataView& data() const { return data_; }
+
+ private:
+  DataView data_;
+  std::size_t width_;
+  std::size_t height_;
+  double resolution_;
+  std::shared_ptr<const void> keepalive_;
+};
+
 }  // namespace beluga
 
 #endif
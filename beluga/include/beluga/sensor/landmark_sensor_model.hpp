@@ -24,6 +24,7 @@
 
 // standard library
 #include <cmath>
+#include <optional>
 #include <random>
 #include <vector>
 
@@ -44,6 +45,14 @@ namespace beluga {
 struct LandmarkModelParam {
   double sigma_range{1.0};    ///< Standard deviation of the range error.
   double sigma_bearing{1.0};  ///< Standard deviation of the bearing error.
+  /// Whether to evaluate detections in batch with vectorized transforms.
+  /**
+   * When enabled, beluga::LandmarkSensorModel materializes the detections into
+   * contiguous matrices once per measurement, changes their reference frames with
+   * one matrix product per particle, and evaluates all residual likelihoods with
+   * vectorized math; only the nearest-landmark lookups remain scalar.
+   */
+  bool use_batched_evaluation = false;
 };
 
 /// Generic landmark model for discrete detection sensors (both 2D and 3D).
@@ -87,9 +96,19 @@ class LandmarkSensorModel {
    * \param detections 2D lidar hit points in the reference frame of filter particles.
    * \return a state weighting function satisfying \ref StateWeightingFunctionPage
    *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   *
+   * If `LandmarkModelParam::use_batched_evaluation` is set, the returned function
+   * transforms all detections with a single matrix product per state and evaluates
+   * the residual likelihoods with vectorized math, instead of per-detection scalar
+   * arithmetic.
    */
   [[nodiscard]] auto operator()(measurement_type&& detections) const {
-    return [this, detections = std::move(detections)](const state_type& state) -> weight_type {
+    auto batch = std::optional<BatchedDetections>{};
+    if (params_.use_batched_evaluation) {
+      batch = materialize_detections(detections);
+    }
+    return [this, detections = std::move(detections),
+            batch = std::move(batch)](const state_type& state) -> weight_type {
       Sophus::SE3d robot_pose_in_world;
 
       if constexpr (std::is_same_v<state_type, Sophus::SE3d>) {
@@ -105,6 +124,10 @@ class LandmarkSensorModel {
             Eigen::Vector3d{state.translation().x(), state.translation().y(), 0.0}};
       }
 
+      if (batch.has_value()) {
+        return batched_weight(*batch, robot_pose_in_world);
+      }
+
       const auto detection_weight = [this, &robot_pose_in_world](const auto& detection) {
         // calculate range and detection_bearing_in_robot to the detection from the robot
         // the detection is already in robot frame
@@ -161,6 +184,90 @@ class LandmarkSensorModel {
  private:
   param_type params_;
   LandmarkMap landmark_map_;
+
+  /// Detections materialized as contiguous columns for the batched evaluation path.
+  struct BatchedDetections {
+    Eigen::Matrix3Xd positions_in_robot;       ///< Detection positions, one column per detection.
+    Eigen::Matrix3Xd bearings_in_robot;        ///< Unit bearing vector of each detection.
+    Eigen::VectorXd ranges_in_robot;           ///< Range of each detection.
+    std::vector<LandmarkCategory> categories;  ///< Category of each detection.
+  };
+
+  /// Materializes the detections into contiguous columns, amortized across all particles.
+  [[nodiscard]] static BatchedDetections materialize_detections(const measurement_type& detections) {
+    auto batch = BatchedDetections{};
+    const auto count = static_cast<Eigen::Index>(detections.size());
+    batch.positions_in_robot.resize(3, count);
+    batch.bearings_in_robot.resize(3, count);
+    batch.ranges_in_robot.resize(count);
+    batch.categories.reserve(detections.size());
+    for (Eigen::Index index = 0; index < count; ++index) {
+      const auto& detection = detections[static_cast<std::size_t>(index)];
+      batch.positions_in_robot.col(index) = detection.detection_position_in_robot;
+      batch.ranges_in_robot(index) = detection.detection_position_in_robot.norm();
+      batch.bearings_in_robot.col(index) = detection.detection_position_in_robot.normalized();
+      batch.categories.push_back(detection.category);
+    }
+    return batch;
+  }
+
+  /// Evaluates every detection against the map with batched frame changes and residuals.
+  [[nodiscard]] weight_type batched_weight(const BatchedDetections& batch, const Sophus::SE3d& robot_pose_in_world)
+      const {
+    const Eigen::Matrix3d rotation = robot_pose_in_world.so3().matrix();
+    const Eigen::Vector3d translation = robot_pose_in_world.translation();
+    const Eigen::Index count = batch.positions_in_robot.cols();
+
+    // One matrix product moves every detection into the world frame to query the map.
+    // Scratch buffers are thread-local to keep particle evaluations allocation-free.
+    static thread_local Eigen::Matrix3Xd detections_in_world;
+    detections_in_world.noalias() = rotation * batch.positions_in_robot;
+    detections_in_world.colwise() += translation;
+
+    // The nearest-landmark lookups are inherently scalar; their results are gathered
+    // into columns so the residual math below stays vectorized.
+    static thread_local Eigen::Matrix3Xd landmarks_in_world;
+    landmarks_in_world.resize(3, count);
+    for (Eigen::Index index = 0; index < count; ++index) {
+      const auto opt_landmark_position_in_world = landmark_map_.find_nearest_landmark(
+          detections_in_world.col(index), batch.categories[static_cast<std::size_t>(index)]);
+      if (!opt_landmark_position_in_world) {
+        // an unmatched detection zeroes the product of detection weights
+        return 0.0;
+      }
+      landmarks_in_world.col(index) = *opt_landmark_position_in_world;
+    }
+
+    // A second product moves every matched landmark back into the robot frame.
+    static thread_local Eigen::Matrix3Xd landmarks_in_robot;
+    landmarks_in_robot.noalias() = rotation.transpose() * (landmarks_in_world.colwise() - translation);
+
+    const Eigen::ArrayXd landmark_ranges = landmarks_in_robot.colwise().norm().transpose();
+    const Eigen::ArrayXd range_errors = batch.ranges_in_robot.array() - landmark_ranges;
+
+    // Aperture angles between detection and landmark bearings, all at once: the dot
+    // and cross products reduce over rows, leaving one atan2 per detection.
+    static thread_local Eigen::Matrix3Xd landmark_bearings;
+    landmark_bearings = landmarks_in_robot.array().rowwise() / landmark_ranges.transpose().array();
+    const auto detection_bearings = batch.bearings_in_robot.array();
+    const auto cos_apertures = (landmark_bearings.array() * detection_bearings).colwise().sum();
+    const auto cross_x = landmark_bearings.row(1).array() * detection_bearings.row(2) -
+                         landmark_bearings.row(2).array() * detection_bearings.row(1);
+    const auto cross_y = landmark_bearings.row(2).array() * detection_bearings.row(0) -
+                         landmark_bearings.row(0).array() * detection_bearings.row(2);
+    const auto cross_z = landmark_bearings.row(0).array() * detection_bearings.row(1) -
+                         landmark_bearings.row(1).array() * detection_bearings.row(0);
+    const auto sin_apertures = (cross_x.square() + cross_y.square() + cross_z.square()).sqrt();
+    const Eigen::ArrayXd bearing_errors =
+        sin_apertures.binaryExpr(cos_apertures, [](double y, double x) { return std::atan2(y, x); }).transpose();
+
+    // The per-detection weights form a product of exponentials, so a single
+    // exponential of the accumulated error terms evaluates all of them at once.
+    const double range_exponent = range_errors.square().sum() / (2. * params_.sigma_range * params_.sigma_range);
+    const double bearing_exponent =
+        bearing_errors.square().sum() / (2. * params_.sigma_bearing * params_.sigma_bearing);
+    return std::exp(-range_exponent - bearing_exponent);
+  }
 };
 
 /// Sensor model based on discrete landmarks for 2D state types.
@@ -16,11 +16,16 @@
 #define BELUGA_SENSOR_LIKELIHOOD_FIELD_MODEL_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <beluga/sensor/likelihood_field_model_base.hpp>
 #include <cmath>
+#include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
+#include <Eigen/Core>
+
 /**
  * \file
  * \brief Implementation of a likelihood field sensor model for range finders.
@@ -51,6 +56,8 @@ class LikelihoodFieldModel : public LikelihoodFieldModelBase<OccupancyGrid> {
   using map_type = OccupancyGrid;
   /// Parameter type that the constructor uses to configure the likelihood field model.
   using param_type = LikelihoodFieldModelParam;
+  /// Measurement type after the shared per-scan preprocessing stage.
+  using preprocessed_measurement_type = typename LikelihoodFieldModelBase<OccupancyGrid>::PreprocessedMeasurement;
 
   /// Constructs a LikelihoodFieldModel instance.
   /**
@@ -59,36 +66,172 @@ class LikelihoodFieldModel : public LikelihoodFieldModelBase<OccupancyGrid> {
   explicit LikelihoodFieldModel(const param_type& params, const map_type& grid)
       : LikelihoodFieldModelBase<OccupancyGrid>(params, grid) {}
 
-  /// Returns a state weighting function conditioned on 2D lidar hits.
+  /// Constructs a LikelihoodFieldModel instance over an externally mapped likelihood field.
   /**
-   * \param points 2D lidar hit points in the reference frame of particle states.
+   * @copydoc LikelihoodFieldModelBase::LikelihoodFieldModelBase(const param_type&, SharedMemoryRegion&&)
+   */
+  explicit LikelihoodFieldModel(const param_type& params, SharedMemoryRegion&& region)
+      : LikelihoodFieldModelBase<OccupancyGrid>(params, std::move(region)) {}
+
+  /// Returns a state weighting function conditioned on a preprocessed scan.
+  /**
+   * \param scan Shared handle to a scan preprocessed through
+   *  LikelihoodFieldModelBase::preprocess_measurement, possibly by another model instance
+   *  tracking the same measurement stream.
    * \return a state weighting function satisfying \ref StateWeightingFunctionPage
    *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   *
+   * If `LikelihoodFieldModelParam::use_batched_evaluation` is set, the returned
+   * function transforms the whole scan with a single affine product per state
+   * instead of point-by-point scalar arithmetic.
+   *
+   * If `LikelihoodFieldModelParam::use_padded_field` is set, the nearest-cell
+   * lookup loops clamp each cell coordinate into the halo-padded field instead
+   * of bounds-checking it, removing the per-point branch from the gather.
+   *
+   * If `LikelihoodFieldModelParam::use_pyramid_evaluation` is set, each state is
+   * first bounded against the coarsest level of the likelihood field pyramid, and
+   * the full-resolution evaluation is skipped for states whose upper bound falls
+   * below a fraction of the best weight evaluated so far in this measurement
+   * update. Pruned states get their (over-approximating) bound as weight, which
+   * is immaterial because they sit below the pruning floor by construction.
    */
-  [[nodiscard]] auto operator()(measurement_type&& points) const {
-    return [this, points = std::move(points)](const state_type& state) -> weight_type {
+  [[nodiscard]] auto operator()(std::shared_ptr<const preprocessed_measurement_type> scan) const {
+    return [this, scan = std::move(scan),
+            best_weight = std::make_shared<std::atomic<double>>(0.0)](const state_type& state) -> weight_type {
+      const auto& points = scan->points;
       const auto transform = this->world_to_likelihood_field_transform_ * state;
+      const auto unknown_space_occupancy_prob = static_cast<float>(1. / this->params_.max_laser_distance);
       const auto x_offset = transform.translation().x();
       const auto y_offset = transform.translation().y();
       const auto cos_theta = transform.so2().unit_complex().x();
       const auto sin_theta = transform.so2().unit_complex().y();
-      const auto unknown_space_occupancy_prob = static_cast<float>(1. / this->params_.max_laser_distance);
-      return std::transform_reduce(
-          points.cbegin(), points.cend(), 1.0, std::plus{},
-          [this, x_offset, y_offset, cos_theta, sin_theta, unknown_space_occupancy_prob](const auto& point) {
-            // Transform the end point of the laser to the grid local coordinate system.
-            // Not using Eigen/Sophus because they make the routine x10 slower.
-            // See `benchmark_likelihood_field_model.cpp` for reference.
-            const auto x = point.first * cos_theta - point.second * sin_theta + x_offset;
-            const auto y = point.first * sin_theta + point.second * cos_theta + y_offset;
+
+      // Degrade to the scalar paths if the scan was preprocessed by a model
+      // configured without batched evaluation.
+      const bool use_batched = this->params_.use_batched_evaluation &&
+                               scan->batched_points.cols() == static_cast<Eigen::Index>(points.size());
+
+      const bool use_pyramid = this->params_.use_pyramid_evaluation && !this->likelihood_field_pyramid().empty();
+      if (use_pyramid) {
+        // Branch and bound: a sweep over the coarsest pyramid level yields an upper
+        // bound on this state's weight; if it falls below the running floor, the
+        // full-resolution evaluation is skipped and the bound stands in for it.
+        double bound = 1.0;
+        for (const auto& point : points) {
+          const auto x = point.first * cos_theta - point.second * sin_theta + x_offset;
+          const auto y = point.first * sin_theta + point.second * cos_theta + y_offset;
+          const auto bz = std::max(
+              static_cast<double>(this->likelihood_upper_bound_near(x, y).value_or(0.0F)),
+              static_cast<double>(unknown_space_occupancy_prob));
+          bound += bz * bz * bz;
+        }
+        const double weight_floor = this->params_.pyramid_prune_ratio * best_weight->load(std::memory_order_relaxed);
+        if (bound < weight_floor) {
+          return bound;
+        }
+      }
+
+      double weight = 1.0;
+      if (use_batched) {
+        // One affine product transforms the whole scan to the grid local coordinate
+        // system; only the grid lookups remain scalar. The scratch buffer is
+        // thread-local to keep particle evaluations allocation-free.
+        static thread_local Eigen::Matrix2Xf transformed;
+        transformed.noalias() = transform.so2().matrix().cast<float>() * scan->batched_points;
+        transformed.colwise() += transform.translation().cast<float>();
+        // The cell index of each lookup is computed from coordinates produced just a
+        // few instructions earlier, defeating the hardware prefetcher; with all the
+        // coordinates materialized up front, the cell a few points ahead can be
+        // software-prefetched so its line is resident by the time it is evaluated.
+        const auto lookahead = static_cast<Eigen::Index>(this->params_.evaluation_prefetch_lookahead);
+        const Eigen::Index count = transformed.cols();
+        if (this->params_.use_padded_field) {
+          // Clamping into the halo-padded field turns the per-point bounds branch
+          // into min/max instructions, leaving a branch-free gather over the field.
+          for (Eigen::Index index = 0; index < count; ++index) {
+            if (lookahead > 0 && index + lookahead < count) {
+              this->prefetch_likelihood_near(transformed(0, index + lookahead), transformed(1, index + lookahead));
+            }
             const auto pz =
-                static_cast<double>(this->likelihood_field_.data_near(x, y).value_or(unknown_space_occupancy_prob));
-            // TODO(glpuga): Investigate why AMCL and QuickMCL both use this formula for the weight.
-            // See https://github.com/Ekumen-OS/beluga/issues/153
-            return pz * pz * pz;
-          });
+                static_cast<double>(this->likelihood_clamped_near(transformed(0, index), transformed(1, index)));
+            weight += pz * pz * pz;
+          }
+        } else {
+          for (Eigen::Index index = 0; index < count; ++index) {
+            if (lookahead > 0 && index + lookahead < count) {
+              this->prefetch_likelihood_near(transformed(0, index + lookahead), transformed(1, index + lookahead));
+            }
+            const auto pz = static_cast<double>(this->likelihood_near(transformed(0, index), transformed(1, index))
+                                                    .value_or(unknown_space_occupancy_prob));
+            weight += pz * pz * pz;
+          }
+        }
+      } else if (this->params_.use_padded_field && !this->params_.use_bilinear_interpolation) {
+        // Same cell conversion as the checked path below, with the bounds check and
+        // optional replaced by the clamped lookup into the halo-padded field.
+        const auto to_cell = this->state_to_cell_transform(state);
+        weight = std::transform_reduce(
+            points.cbegin(), points.cend(), 1.0, std::plus{},
+            [this, to_cell](const auto& point) {
+              const auto [xi, yi] = to_cell(point.first, point.second);
+              const auto pz = static_cast<double>(this->likelihood_clamped_at(xi, yi));
+              return pz * pz * pz;
+            });
+      } else if (!this->params_.use_bilinear_interpolation) {
+        // The resolution scaling is folded into the per-state transform constants, so
+        // each laser end point maps straight to its grid cell with two multiply-adds
+        // and a float-to-int cast per axis — no divides in the hot loop.
+        // Not using Eigen/Sophus because they make the routine x10 slower.
+        // See `benchmark_likelihood_field_model.cpp` for reference.
+        const auto to_cell = this->state_to_cell_transform(state);
+        weight = std::transform_reduce(
+            points.cbegin(), points.cend(), 1.0, std::plus{},
+            [this, to_cell, unknown_space_occupancy_prob](const auto& point) {
+              const auto [xi, yi] = to_cell(point.first, point.second);
+              const auto pz = static_cast<double>(this->likelihood_at(xi, yi).value_or(unknown_space_occupancy_prob));
+              // TODO(glpuga): Investigate why AMCL and QuickMCL both use this formula for the weight.
+              // See https://github.com/Ekumen-OS/beluga/issues/153
+              return pz * pz * pz;
+            });
+      } else {
+        weight = std::transform_reduce(
+            points.cbegin(), points.cend(), 1.0, std::plus{},
+            [this, x_offset, y_offset, cos_theta, sin_theta, unknown_space_occupancy_prob](const auto& point) {
+              // Transform the end point of the laser to the grid local coordinate system.
+              const auto x = point.first * cos_theta - point.second * sin_theta + x_offset;
+              const auto y = point.first * sin_theta + point.second * cos_theta + y_offset;
+              const auto pz =
+                  static_cast<double>(this->likelihood_near(x, y).value_or(unknown_space_occupancy_prob));
+              return pz * pz * pz;
+            });
+      }
+
+      if (use_pyramid) {
+        // Raise the pruning floor as evaluation proceeds. Relaxed atomics suffice:
+        // the floor is a heuristic and stale reads only make pruning conservative.
+        double known_best = best_weight->load(std::memory_order_relaxed);
+        while (weight > known_best &&
+               !best_weight->compare_exchange_weak(known_best, weight, std::memory_order_relaxed)) {
+        }
+      }
+      return weight;
     };
   }
+
+  /// Returns a state weighting function conditioned on 2D lidar hits.
+  /**
+   * \param points 2D lidar hit points in the reference frame of particle states.
+   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
+   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   *
+   * The measurement goes once through LikelihoodFieldModelBase::preprocess_measurement
+   * before conditioning; use that stage directly to share the preprocessed scan with
+   * other model instances.
+   */
+  [[nodiscard]] auto operator()(measurement_type&& points) const {
+    return (*this)(this->preprocess_measurement(std::move(points)));
+  }
 };
 
 }  // namespace beluga
@@ -16,16 +16,36 @@
 #define BELUGA_SENSOR_LIKELIHOOD_FIELD_MODEL_BASE_HPP
 
 #include <algorithm>
+#include <array>
 #include <beluga/actions/overlay.hpp>
 #include <beluga/algorithm/distance_map.hpp>
 #include <beluga/sensor/data/occupancy_grid.hpp>
+#include <beluga/sensor/data/sparse_tiled_value_grid.hpp>
+#include <beluga/sensor/data/tiled_value_grid.hpp>
 #include <beluga/sensor/data/value_grid.hpp>
+#include <beluga/utility/memory_hints.hpp>
+#include <beluga/utility/shared_memory_region.hpp>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <random>
 #include <range/v3/action/transform.hpp>
 #include <sophus/se2.hpp>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
 #include <vector>
 
+#include <Eigen/Core>
+
 /**
  * \file
  * \brief Implementation of a likelihood field common sensor model for range finders.
@@ -57,6 +77,141 @@ struct LikelihoodFieldModelBaseParam {
   double sigma_hit = 0.2;
   /// Whether to model unknown space or assume it free.
   bool model_unknown_space = false;
+  /// Whether to evaluate scan points in batch with vectorized transforms.
+  /**
+   * When enabled, beluga::LikelihoodFieldModel materializes the scan points into
+   * a contiguous matrix once per measurement and transforms them with a single
+   * affine product per particle instead of point-by-point scalar arithmetic.
+   */
+  bool use_batched_evaluation = false;
+  /// Whether to build the likelihood field with parallel scanline passes.
+  /**
+   * The distance transform is separable, so its row and column passes can
+   * run concurrently. Useful when map updates arrive at runtime and field
+   * construction would otherwise stall the filter.
+   */
+  bool use_parallel_field_construction = false;
+  /// Directory where computed likelihood fields are cached on disk.
+  /**
+   * When non-empty, the computed field is serialized in a flat binary layout
+   * keyed by a hash of the occupancy grid and these parameters, and loaded
+   * back on subsequent constructions with the same inputs instead of
+   * recomputing the distance map from scratch. Caching is best-effort: I/O
+   * failures silently fall back to recomputation.
+   */
+  std::string likelihood_field_cache_directory;
+  /// Whether to store the likelihood field as fixed-point uint16 values.
+  /**
+   * Halves the memory footprint of the field, improving cache behavior for the
+   * random-access lookup pattern of particle evaluation on large maps. Values
+   * are dequantized with a scale factor at lookup time, trading a small amount
+   * of precision (the field spans at most 16 bits of dynamic range).
+   */
+  bool use_quantized_storage = false;
+  /// Whether to store the likelihood field in cache-blocked tiles.
+  /**
+   * Re-lays the field into beluga::TiledValueGrid2 storage, where square tiles of
+   * cells sit in consecutive cache lines. The spatially clustered lookups of
+   * particle evaluation then hit far fewer cache lines than with row-major
+   * striding on large maps. Ignored when `use_quantized_storage` is set, since
+   * the fixed-point field already halves the lines touched per row hop.
+   */
+  bool use_tiled_field_storage = false;
+  /// Whether to store the likelihood field as sparsely allocated tiled pages.
+  /**
+   * Re-lays the field into beluga::SparseTiledValueGrid2 storage, materializing tiles
+   * only where the likelihood differs from the featureless background value. Large
+   * mostly empty maps — an outdoor yard is background likelihood almost everywhere —
+   * then cost memory proportional to their feature content instead of their extent,
+   * making maps that no longer fit as a dense field servable at all. The sparse
+   * backend engages only when the measured background fraction reaches
+   * `sparse_field_minimum_sparsity`; denser maps keep the plain row-major field,
+   * which serves them better than page indirection. Ignored when
+   * `use_quantized_storage` or `use_tiled_field_storage` is set.
+   */
+  bool use_sparse_field_storage = false;
+  /// Minimum fraction of background cells for the sparse field backend to engage.
+  double sparse_field_minimum_sparsity = 0.9;
+  /// Whether to interpolate likelihood lookups bilinearly between cells.
+  /**
+   * Instead of snapping each lookup to the nearest cell, blend the 4 cells
+   * surrounding the query point by their distance to it. The smoother response
+   * allows halving the field resolution (4x less field memory and better cache
+   * residency) at comparable localization accuracy. Composes with any of the
+   * storage options above.
+   */
+  bool use_bilinear_interpolation = false;
+  /// Whether to pad the likelihood field with a halo of out-of-field substitute cells.
+  /**
+   * Surrounds the field with a halo of cells holding the value the models substitute
+   * for out-of-field lookups. The nearest-cell evaluation loops of
+   * beluga::LikelihoodFieldModel then clamp each cell coordinate into the padded
+   * extents instead of bounds-checking it: out-of-field points land on halo cells and
+   * read the same substitute the checked accessor would have returned, so weights
+   * match the unpadded model bit for bit, while the clamp compiles down to min/max
+   * instructions, removing the per-point compare-and-branch that blocks vectorization
+   * of the lookup gather. Applied to the full-precision field before quantization or
+   * tiling, so it composes with either storage option.
+   */
+  bool use_padded_field = false;
+  /// Whether to build a coarse-to-fine likelihood field pyramid for bounded evaluation.
+  /**
+   * Each pyramid level halves the field resolution and stores the maximum likelihood
+   * over the cells it covers, so a lookup at any level yields an upper bound on the
+   * fine-grid likelihood. beluga::LikelihoodFieldModel uses the coarsest level to
+   * prune particles whose weight upper bound already falls below the running weight
+   * floor, in the spirit of correlative scan matching \cite thrun2005probabilistic .
+   * Pays off with very large particle sets (e.g. global localization), where most
+   * particles are hopeless and never reach the full-resolution evaluation.
+   */
+  bool use_pyramid_evaluation = false;
+  /// Number of 2x downsampled levels in the likelihood field pyramid.
+  /**
+   * More levels make the coarsest bound cheaper to evaluate but looser; fewer levels
+   * make it tighter but touch more memory per lookup.
+   */
+  std::size_t pyramid_levels = 3;
+  /// Fraction of the best weight seen so far used as the pruning floor.
+  /**
+   * A particle whose coarse upper bound is below this fraction of the best weight
+   * evaluated so far in the same measurement update skips the fine evaluation.
+   */
+  double pyramid_prune_ratio = 0.05;
+  /// Whether to patch the likelihood field incrementally on map updates.
+  /**
+   * Keeps a copy of the previous grid masks and, when an incoming map preserves the
+   * grid geometry and origin, re-runs the distance transform only over the bounding
+   * box of the changed cells plus a max-obstacle-distance halo, patching that region
+   * of the existing field. SLAM map updates that touch a small fraction of the cells
+   * then cost a small patch instead of a full rebuild. Geometry or origin changes
+   * fall back to the full rebuild, and the option is ignored when quantized, tiled or
+   * sparse storage is enabled, since those release the full-precision field that
+   * patching relies on, or when `use_padded_field` is set, since the padded field no
+   * longer matches the grid geometry.
+   */
+  bool use_incremental_map_updates = false;
+  /// Number of scan points to look ahead when prefetching likelihood field cells.
+  /**
+   * Applies to the batched evaluation path of beluga::LikelihoodFieldModel. The
+   * field lookups there are data-dependent random accesses whose cell indices are
+   * computed only a few instructions before the load, so the hardware prefetcher
+   * cannot help; issuing a software prefetch for the cell this many points ahead
+   * hides the memory latency when the field exceeds the last-level cache. Zero
+   * disables prefetching; 8 to 16 points is a reasonable range, large enough to
+   * cover the load latency and small enough not to evict lines before use.
+   */
+  std::size_t evaluation_prefetch_lookahead = 0;
+  /// Allocation placement hints applied to the likelihood field storage.
+  /**
+   * Applied to whichever field representation is active (full precision, quantized or
+   * tiled) after construction and after every map update. On large maps the field
+   * exceeds the TLB reach of 4 KiB pages, and on multi-socket hosts its pages land on
+   * whatever node first touched them; huge page backing and NUMA interleaving address
+   * both. Prefaulting and locking the field keep first-update latency and worst-case
+   * latency under memory pressure deterministic. Best-effort: unsupported hints
+   * degrade to no-ops. See beluga::MemoryHints.
+   */
+  beluga::MemoryHints memory_hints;
 };
 
 /// Likelihood field common sensor model for range finders.
@@ -91,31 +246,890 @@ class LikelihoodFieldModelBase {
    */
   explicit LikelihoodFieldModelBase(const param_type& params, const map_type& grid)
       : params_{params},
-        likelihood_field_{make_likelihood_field(params, grid)},
-        world_to_likelihood_field_transform_{grid.origin().inverse()} {}
+        likelihood_field_{std::make_shared<const ValueGrid2<float>>(make_or_load_likelihood_field(params, grid))},
+        world_to_likelihood_field_transform_{grid.origin().inverse()} {
+    if (params_.use_padded_field) {
+      pad_likelihood_field();
+    }
+    if (params_.use_pyramid_evaluation) {
+      // Built before quantization, which releases the full-precision field.
+      likelihood_field_pyramid_ = std::make_shared<const std::vector<ValueGrid2<float>>>(
+          make_likelihood_field_pyramid(*likelihood_field_, params_.pyramid_levels));
+    }
+    if (params_.use_quantized_storage) {
+      quantize_likelihood_field();
+    } else if (params_.use_tiled_field_storage) {
+      tile_likelihood_field();
+    } else if (params_.use_sparse_field_storage) {
+      sparsify_likelihood_field();
+    }
+    if (incremental_updates_enabled()) {
+      cache_grid_masks(grid);
+    }
+    apply_field_memory_hints();
+  }
+
+  /// Constructs a LikelihoodFieldModelBase over an externally mapped likelihood field.
+  /**
+   * Attaches to a segment published through share_likelihood_field() by another process
+   * on the same host, viewing the field in place instead of computing and holding a
+   * private copy. Field construction and storage options in `params` (quantized, tiled,
+   * padded or pyramid storage, incremental map updates, disk caching) target a locally
+   * computed field and are ignored; lookup options (bilinear interpolation, batched evaluation,
+   * prefetching) apply as usual.
+   *
+   * \param params Parameters to configure this instance.
+   *  See beluga::LikelihoodFieldModelBase for details.
+   * \param region Shared memory region mapping the segment to attach to.
+   * \throw std::invalid_argument If the segment does not hold a likelihood field.
+   */
+  explicit LikelihoodFieldModelBase(const param_type& params, SharedMemoryRegion&& region)
+      : params_{params}, likelihood_field_{std::make_shared<const ValueGrid2<float>>(std::vector<float>{}, 1)} {
+    params_.use_quantized_storage = false;
+    params_.use_tiled_field_storage = false;
+    params_.use_sparse_field_storage = false;
+    params_.use_padded_field = false;
+    params_.use_pyramid_evaluation = false;
+    params_.use_incremental_map_updates = false;
+    params_.likelihood_field_cache_directory.clear();
+
+    const auto* header = static_cast<const LikelihoodFieldSegmentHeader*>(region.data());
+    if (region.size() < sizeof(LikelihoodFieldSegmentHeader) || header->magic != LikelihoodFieldSegmentHeader::kMagic ||
+        header->version != LikelihoodFieldSegmentHeader::kVersion || header->width == 0U ||
+        header->count % header->width != 0U ||
+        region.size() != sizeof(LikelihoodFieldSegmentHeader) + header->count * sizeof(float)) {
+      std::stringstream ss;
+      ss << "Shared memory segment " << region.name() << " does not hold a likelihood field";
+      throw std::invalid_argument(ss.str());
+    }
+    world_to_likelihood_field_transform_ =
+        Sophus::SE2d{Sophus::SO2d{header->origin_theta}, Eigen::Vector2d{header->origin_x, header->origin_y}}
+            .inverse();
+    const auto* values = reinterpret_cast<const float*>(
+        static_cast<const char*>(region.data()) + sizeof(LikelihoodFieldSegmentHeader));
+    const auto width = static_cast<std::size_t>(header->width);
+    const auto count = static_cast<std::size_t>(header->count);
+    const double resolution = header->resolution;
+    mapped_likelihood_field_ = std::make_shared<const MappedValueGrid2<float>>(
+        values, count, width, resolution, std::make_shared<const SharedMemoryRegion>(std::move(region)));
+  }
+
+  /// Publishes the likelihood field into a named shared memory segment.
+  /**
+   * Other processes on the same host can then construct model instances over the
+   * published field (see the shared memory constructor), all reading one copy of it
+   * instead of each computing and holding their own. Requires the full-precision
+   * field, so it is incompatible with quantized or tiled storage, which release it.
+   *
+   * \param name Segment name, starting with a slash (e.g. "/beluga_likelihood_field").
+   * \return The region owning the segment. Keep it alive for as long as other processes
+   *  should be able to attach; models already attached remain valid after it is
+   *  destroyed, but new processes can no longer attach.
+   * \throw std::invalid_argument If the segment cannot be created.
+   */
+  [[nodiscard]] SharedMemoryRegion share_likelihood_field(const std::string& name) const {
+    assert(!params_.use_quantized_storage);
+    assert(!params_.use_tiled_field_storage);
+    assert(sparse_likelihood_field_ == nullptr);
+    const auto& field = *likelihood_field_;
+    auto region =
+        SharedMemoryRegion::create(name, sizeof(LikelihoodFieldSegmentHeader) + field.size() * sizeof(float));
+    LikelihoodFieldSegmentHeader header;
+    header.width = static_cast<std::uint64_t>(field.width());
+    header.count = static_cast<std::uint64_t>(field.size());
+    header.resolution = field.resolution();
+    const auto origin = likelihood_field_origin();
+    header.origin_x = origin.translation().x();
+    header.origin_y = origin.translation().y();
+    header.origin_theta = origin.so2().log();
+    std::memcpy(region.data(), &header, sizeof(header));
+    std::memcpy(
+        static_cast<char*>(region.data()) + sizeof(header), field.data().data(), field.size() * sizeof(float));
+    return region;
+  }
 
   /// Returns the likelihood field, constructed from the provided map.
-  [[nodiscard]] const auto& likelihood_field() const { return likelihood_field_; }
+  [[nodiscard]] const auto& likelihood_field() const { return *likelihood_field_; }
 
   /// Returns the origin of the likelihood field in world coordinates.
   [[nodiscard]] auto likelihood_field_origin() const { return world_to_likelihood_field_transform_.inverse(); }
 
   /// Update the sensor model with a new occupancy grid map.
   /**
-   * This method re-computes the underlying likelihood field.
+   * This method re-computes the underlying likelihood field. When
+   * `LikelihoodFieldModelBaseParam::use_incremental_map_updates` is set and the new
+   * grid preserves the geometry and origin of the previous one, only the region
+   * affected by the changed cells is re-computed and patched into the field.
    *
    * \param grid New occupancy grid representing the static map.
    */
   void update_map(const map_type& grid) {
-    likelihood_field_ = make_likelihood_field(params_, grid);
+    if (incremental_updates_enabled() && try_incremental_field_update(grid)) {
+      return;
+    }
+    // Detach from any externally mapped field; the model owns its field from here on.
+    mapped_likelihood_field_.reset();
+    sparse_likelihood_field_.reset();
+    likelihood_field_ = std::make_shared<const ValueGrid2<float>>(make_or_load_likelihood_field(params_, grid));
     world_to_likelihood_field_transform_ = grid.origin().inverse();
+    if (params_.use_padded_field) {
+      pad_likelihood_field();
+    }
+    if (params_.use_pyramid_evaluation) {
+      // Built before quantization, which releases the full-precision field.
+      likelihood_field_pyramid_ = std::make_shared<const std::vector<ValueGrid2<float>>>(
+          make_likelihood_field_pyramid(*likelihood_field_, params_.pyramid_levels));
+    }
+    if (params_.use_quantized_storage) {
+      quantize_likelihood_field();
+    } else if (params_.use_tiled_field_storage) {
+      tile_likelihood_field();
+    } else if (params_.use_sparse_field_storage) {
+      sparsify_likelihood_field();
+    }
+    if (incremental_updates_enabled()) {
+      cache_grid_masks(grid);
+    }
+    apply_field_memory_hints();
+  }
+
+  /// Returns the likelihood field pyramid levels, finest first and coarsest last.
+  /**
+   * Empty unless `LikelihoodFieldModelBaseParam::use_pyramid_evaluation` is set.
+   */
+  [[nodiscard]] const auto& likelihood_field_pyramid() const { return *likelihood_field_pyramid_; }
+
+  /// Adopts the field representations computed by another model instance.
+  /**
+   * All field representations are immutable and held through shared handles, so model
+   * instances tracking the same map (e.g. members of a filter ensemble, or an A/B shadow
+   * filter) can propagate a map update by having one instance recompute through
+   * update_map() and the rest adopt the result, sharing a single copy of the field
+   * instead of each recomputing and holding a duplicate. Both instances are expected to
+   * be configured with identical parameters.
+   *
+   * \param other Model instance to share the field representations of.
+   */
+  void adopt_field_from(const LikelihoodFieldModelBase& other) {
+    likelihood_field_ = other.likelihood_field_;
+    mapped_likelihood_field_ = other.mapped_likelihood_field_;
+    world_to_likelihood_field_transform_ = other.world_to_likelihood_field_transform_;
+    quantized_likelihood_field_ = other.quantized_likelihood_field_;
+    quantization_scale_ = other.quantization_scale_;
+    tiled_likelihood_field_ = other.tiled_likelihood_field_;
+    sparse_likelihood_field_ = other.sparse_likelihood_field_;
+    likelihood_field_pyramid_ = other.likelihood_field_pyramid_;
+    cached_obstacle_mask_ = other.cached_obstacle_mask_;
+    cached_unknown_mask_ = other.cached_unknown_mask_;
+  }
+
+  /// Scan data preprocessed once per measurement and shared across particle evaluations.
+  struct PreprocessedMeasurement {
+    /// 2D lidar hit points in the reference frame of particle states.
+    std::vector<std::pair<double, double>> points;
+    /// Scan points materialized as a contiguous matrix. Empty unless batched evaluation is enabled.
+    Eigen::Matrix2Xf batched_points;
+  };
+
+  /// Runs the per-measurement setup once so several evaluations can share the result.
+  /**
+   * The likelihood models defer their per-scan setup (point materialization and, when
+   * `LikelihoodFieldModelBaseParam::use_batched_evaluation` is set, the contiguous scan
+   * matrix) to this stage. Conditioning several model instances on the same returned
+   * handle — e.g. when comparing likelihood models over one measurement stream — runs
+   * that setup a single time instead of once per model.
+   *
+   * \param points 2D lidar hit points in the reference frame of particle states.
+   * \return a shared handle to the preprocessed scan.
+   */
+  [[nodiscard]] std::shared_ptr<const PreprocessedMeasurement> preprocess_measurement(
+      std::vector<std::pair<double, double>>&& points) const {
+    auto scan = std::make_shared<PreprocessedMeasurement>();
+    if (params_.use_batched_evaluation) {
+      // Materialize the scan once per measurement so each particle evaluation
+      // reduces to a single 2xN affine product over contiguous storage.
+      scan->batched_points.resize(2, static_cast<Eigen::Index>(points.size()));
+      for (std::size_t index = 0U; index < points.size(); ++index) {
+        scan->batched_points(0, static_cast<Eigen::Index>(index)) = static_cast<float>(points[index].first);
+        scan->batched_points(1, static_cast<Eigen::Index>(index)) = static_cast<float>(points[index].second);
+      }
+    }
+    scan->points = std::move(points);
+    return scan;
   }
 
  protected:
   param_type params_;                                /*!< Parameters configuring the likelihood field model. */
-  ValueGrid2<float> likelihood_field_;               /*!< Likelihood field computed from the occupancy grid map. */
+  /// Likelihood field computed from the occupancy grid map. Empty when quantized or tiled storage is in use.
+  /**
+   * Held through a shared pointer to immutable storage so model copies (e.g. one per
+   * member of a filter ensemble) share a single field; map updates replace the pointer
+   * locally instead of mutating the shared data.
+   */
+  std::shared_ptr<const ValueGrid2<float>> likelihood_field_;
   Sophus::SE2d world_to_likelihood_field_transform_; /*!< Transformation from world coordinates to the likelihood field
                                                         coordinate system. */
+  /// Fixed-point likelihood field, populated when quantized storage is in use. Shared like the full-precision field.
+  std::shared_ptr<const ValueGrid2<std::uint16_t>> quantized_likelihood_field_ =
+      std::make_shared<const ValueGrid2<std::uint16_t>>(std::vector<std::uint16_t>{}, 1);
+  float quantization_scale_{1.0F};                   /*!< Scale factor to dequantize fixed-point likelihood values. */
+  /// Cache-blocked likelihood field, populated when tiled storage is in use. Shared like the full-precision field.
+  std::shared_ptr<const TiledValueGrid2<float>> tiled_likelihood_field_ =
+      std::make_shared<const TiledValueGrid2<float>>(std::vector<float>{}, 1);
+  /// Sparsely tiled likelihood field, populated when the sparse backend engages. Shared like the full-precision field.
+  std::shared_ptr<const SparseTiledValueGrid2<float>> sparse_likelihood_field_;
+  /// Externally mapped likelihood field, populated when attached to a shared memory segment.
+  std::shared_ptr<const MappedValueGrid2<float>> mapped_likelihood_field_;
+  /// Max-likelihood upper bound pyramid, populated when pyramid evaluation is in use. Shared like the field.
+  std::shared_ptr<const std::vector<ValueGrid2<float>>> likelihood_field_pyramid_ =
+      std::make_shared<const std::vector<ValueGrid2<float>>>();
+  /// Obstacle mask of the last map, kept to diff incoming maps when incremental updates are enabled.
+  std::vector<bool> cached_obstacle_mask_;
+  /// Unknown-space mask of the last map, kept alongside the obstacle mask when unknown space is modeled.
+  std::vector<bool> cached_unknown_mask_;
+
+  /// Returns the likelihood at or interpolated around the given coordinates, if any.
+  /**
+   * Dispatches to the full-precision, fixed-point or tiled field depending on the
+   * configured storage, dequantizing in the fixed-point case, and blends the 4
+   * surrounding cells when bilinear interpolation is enabled.
+   */
+  [[nodiscard]] std::optional<float> likelihood_near(double x, double y) const {
+    if (params_.use_bilinear_interpolation) {
+      return likelihood_interpolated_near(x, y);
+    }
+    if (mapped_likelihood_field_) {
+      return mapped_likelihood_field_->data_near(x, y);
+    }
+    if (params_.use_quantized_storage) {
+      const auto value = quantized_likelihood_field_->data_near(x, y);
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      return static_cast<float>(*value) * quantization_scale_;
+    }
+    if (params_.use_tiled_field_storage) {
+      return tiled_likelihood_field_->data_near(x, y);
+    }
+    if (sparse_likelihood_field_) {
+      return sparse_likelihood_field_->data_near(x, y);
+    }
+    return likelihood_field_->data_near(x, y);
+  }
+
+  /// Prefetches the cache line backing the cell containing the given coordinates.
+  /**
+   * Advisory companion to \ref likelihood_near for lookahead schemes: issue it for a
+   * point a few iterations ahead of the one being evaluated so the line is resident
+   * by the time the actual lookup runs. Dispatches to the exact backing index of the
+   * configured storage. Out-of-field coordinates and platforms without a prefetch
+   * intrinsic degrade to no-ops.
+   */
+  void prefetch_likelihood_near([[maybe_unused]] double x, [[maybe_unused]] double y) const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    const double resolution = field_resolution();
+    const auto xi = static_cast<int>(std::floor(x / resolution));
+    const auto yi = static_cast<int>(std::floor(y / resolution));
+    if (xi < 0 || yi < 0 || xi >= static_cast<int>(field_width()) || yi >= static_cast<int>(field_height())) {
+      return;
+    }
+    if (mapped_likelihood_field_) {
+      __builtin_prefetch(mapped_likelihood_field_->data().data() + mapped_likelihood_field_->index_at(xi, yi));
+    } else if (params_.use_quantized_storage) {
+      __builtin_prefetch(quantized_likelihood_field_->data().data() + quantized_likelihood_field_->index_at(xi, yi));
+    } else if (params_.use_tiled_field_storage) {
+      __builtin_prefetch(tiled_likelihood_field_->data().data() + tiled_likelihood_field_->index_at(xi, yi));
+    } else if (sparse_likelihood_field_) {
+      sparse_likelihood_field_->prefetch_at(xi, yi);
+    } else {
+      __builtin_prefetch(likelihood_field_->data().data() + likelihood_field_->index_at(xi, yi));
+    }
+#endif
+  }
+
+  /// Returns the likelihood at the given cell coordinates, if included, for the configured storage.
+  [[nodiscard]] std::optional<float> likelihood_at(int xi, int yi) const {
+    if (mapped_likelihood_field_) {
+      return mapped_likelihood_field_->data_at(xi, yi);
+    }
+    if (params_.use_quantized_storage) {
+      const auto value = quantized_likelihood_field_->data_at(xi, yi);
+      if (!value.has_value()) {
+        return std::nullopt;
+      }
+      return static_cast<float>(*value) * quantization_scale_;
+    }
+    if (params_.use_tiled_field_storage) {
+      return tiled_likelihood_field_->data_at(xi, yi);
+    }
+    if (sparse_likelihood_field_) {
+      return sparse_likelihood_field_->data_at(xi, yi);
+    }
+    return likelihood_field_->data_at(xi, yi);
+  }
+
+  /// Returns the likelihood at the given cell coordinates, clamped into the padded field.
+  /**
+   * Requires `LikelihoodFieldModelBaseParam::use_padded_field`. Out-of-field coordinates
+   * clamp onto halo cells holding the out-of-field substitute value, so the result
+   * matches the checked accessor plus substitution bit for bit, while the clamp compiles
+   * down to min/max instructions instead of a compare-and-branch per lookup.
+   */
+  [[nodiscard]] float likelihood_clamped_at(int xi, int yi) const {
+    xi = std::clamp(xi, 0, static_cast<int>(field_width()) - 1);
+    yi = std::clamp(yi, 0, static_cast<int>(field_height()) - 1);
+    if (params_.use_quantized_storage) {
+      const auto& field = *quantized_likelihood_field_;
+      return static_cast<float>(field.data()[field.index_at(xi, yi)]) * quantization_scale_;
+    }
+    if (params_.use_tiled_field_storage) {
+      return tiled_likelihood_field_->data()[tiled_likelihood_field_->index_at(xi, yi)];
+    }
+    if (sparse_likelihood_field_) {
+      return sparse_likelihood_field_->value_at(xi, yi);
+    }
+    return likelihood_field_->data()[likelihood_field_->index_at(xi, yi)];
+  }
+
+  /// Returns the likelihood at the cell containing the given coordinates, clamped into the padded field.
+  /**
+   * Companion to \ref likelihood_clamped_at for lookups in field-local metric coordinates.
+   */
+  [[nodiscard]] float likelihood_clamped_near(double x, double y) const {
+    const double resolution = field_resolution();
+    return likelihood_clamped_at(
+        static_cast<int>(std::floor(x / resolution)), static_cast<int>(std::floor(y / resolution)));
+  }
+
+  /// Per-state constants converting points in the state frame directly to cell coordinates.
+  /**
+   * Folds the resolution scaling into the composed state-to-field transform, so the
+   * point-to-cell conversion in the evaluation hot loop costs two multiply-adds and a
+   * float-to-int cast per axis — no divides and no intermediate world coordinates.
+   */
+  struct StateToCellTransform {
+    double scaled_cos;  ///< Rotation cosine, pre-scaled by the inverse field resolution.
+    double scaled_sin;  ///< Rotation sine, pre-scaled by the inverse field resolution.
+    double x_offset;    ///< Translation along the x-axis, in cells.
+    double y_offset;    ///< Translation along the y-axis, in cells.
+
+    /// Converts a point in the state frame to likelihood field cell coordinates.
+    [[nodiscard]] std::pair<int, int> operator()(double px, double py) const {
+      return {
+          static_cast<int>(std::floor(px * scaled_cos - py * scaled_sin + x_offset)),
+          static_cast<int>(std::floor(px * scaled_sin + py * scaled_cos + y_offset))};
+    }
+  };
+
+  /// Builds the point-to-cell conversion constants for the given state.
+  [[nodiscard]] StateToCellTransform state_to_cell_transform(const Sophus::SE2d& state) const {
+    const auto transform = world_to_likelihood_field_transform_ * state;
+    const double inv_resolution = 1.0 / field_resolution();
+    return {
+        transform.so2().unit_complex().x() * inv_resolution,  //
+        transform.so2().unit_complex().y() * inv_resolution,  //
+        transform.translation().x() * inv_resolution,         //
+        transform.translation().y() * inv_resolution};
+  }
+
+  /// Returns the likelihood interpolated bilinearly between the 4 cells around the given coordinates, if any.
+  /**
+   * Cell values are taken at cell centroids; taps falling outside the field are
+   * clamped to its border. Lookups outside the field return `std::nullopt`, same
+   * as the nearest-cell lookup.
+   */
+  [[nodiscard]] std::optional<float> likelihood_interpolated_near(double x, double y) const {
+    const double resolution = field_resolution();
+    const auto width = static_cast<int>(field_width());
+    const auto height = static_cast<int>(field_height());
+    const auto nearest_xi = static_cast<int>(std::floor(x / resolution));
+    const auto nearest_yi = static_cast<int>(std::floor(y / resolution));
+    if (nearest_xi < 0 || nearest_yi < 0 || nearest_xi >= width || nearest_yi >= height) {
+      return std::nullopt;
+    }
+    const double gx = x / resolution - 0.5;
+    const double gy = y / resolution - 0.5;
+    const auto xi = static_cast<int>(std::floor(gx));
+    const auto yi = static_cast<int>(std::floor(gy));
+    const double fx = gx - std::floor(gx);
+    const double fy = gy - std::floor(gy);
+    const auto tap = [this, width, height](int txi, int tyi) {
+      return static_cast<double>(*likelihood_at(std::clamp(txi, 0, width - 1), std::clamp(tyi, 0, height - 1)));
+    };
+    const double value = (1.0 - fy) * ((1.0 - fx) * tap(xi, yi) + fx * tap(xi + 1, yi)) +  //
+                         fy * ((1.0 - fx) * tap(xi, yi + 1) + fx * tap(xi + 1, yi + 1));
+    return static_cast<float>(value);
+  }
+
+  /// Returns the width of whichever likelihood field representation is active.
+  [[nodiscard]] std::size_t field_width() const {
+    if (mapped_likelihood_field_) {
+      return mapped_likelihood_field_->width();
+    }
+    if (params_.use_quantized_storage) {
+      return quantized_likelihood_field_->width();
+    }
+    if (params_.use_tiled_field_storage) {
+      return tiled_likelihood_field_->width();
+    }
+    if (sparse_likelihood_field_) {
+      return sparse_likelihood_field_->width();
+    }
+    return likelihood_field_->width();
+  }
+
+  /// Returns the height of whichever likelihood field representation is active.
+  [[nodiscard]] std::size_t field_height() const {
+    if (mapped_likelihood_field_) {
+      return mapped_likelihood_field_->height();
+    }
+    if (params_.use_quantized_storage) {
+      return quantized_likelihood_field_->height();
+    }
+    if (params_.use_tiled_field_storage) {
+      return tiled_likelihood_field_->height();
+    }
+    if (sparse_likelihood_field_) {
+      return sparse_likelihood_field_->height();
+    }
+    return likelihood_field_->height();
+  }
+
+  /// Returns the resolution of whichever likelihood field representation is active.
+  [[nodiscard]] double field_resolution() const {
+    if (mapped_likelihood_field_) {
+      return mapped_likelihood_field_->resolution();
+    }
+    if (params_.use_quantized_storage) {
+      return quantized_likelihood_field_->resolution();
+    }
+    if (params_.use_tiled_field_storage) {
+      return tiled_likelihood_field_->resolution();
+    }
+    if (sparse_likelihood_field_) {
+      return sparse_likelihood_field_->resolution();
+    }
+    return likelihood_field_->resolution();
+  }
+
+  /// Returns an upper bound on the likelihood near the given coordinates, if any.
+  /**
+   * Looks up the coarsest pyramid level, whose cells store the maximum likelihood
+   * of the full-resolution cells they cover. The pyramid must not be empty.
+   */
+  [[nodiscard]] std::optional<float> likelihood_upper_bound_near(double x, double y) const {
+    return likelihood_field_pyramid_->back().data_near(x, y);
+  }
+
+  /// Builds 2x max-downsampled levels from the full-resolution likelihood field.
+  /**
+   * \param field Full-resolution likelihood field.
+   * \param levels Maximum number of levels to build; fewer are built if the field runs out of cells.
+   * \return Pyramid levels, finest first. Each level stores, per cell, the maximum
+   *  likelihood over the 2x2 block of the previous level it covers, at twice its resolution.
+   */
+  static std::vector<ValueGrid2<float>> make_likelihood_field_pyramid(
+      const ValueGrid2<float>& field,
+      std::size_t levels) {
+    auto pyramid = std::vector<ValueGrid2<float>>{};
+    pyramid.reserve(levels);
+    const ValueGrid2<float>* source = &field;
+    for (std::size_t level = 0U; level < levels; ++level) {
+      const std::size_t width = source->width();
+      const std::size_t height = source->height();
+      if (width < 2U || height < 2U) {
+        break;
+      }
+      const std::size_t coarse_width = (width + 1U) / 2U;
+      const std::size_t coarse_height = (height + 1U) / 2U;
+      auto values = std::vector<float>(coarse_width * coarse_height, 0.0F);
+      const auto& data = source->data();
+      for (std::size_t y = 0U; y < height; ++y) {
+        for (std::size_t x = 0U; x < width; ++x) {
+          auto& cell = values[(y / 2U) * coarse_width + (x / 2U)];
+          cell = std::max(cell, data[y * width + x]);
+        }
+      }
+      pyramid.emplace_back(std::move(values), coarse_width, source->resolution() * 2.0);
+      source = &pyramid.back();
+    }
+    return pyramid;
+  }
+
+  /// Re-encode the likelihood field as fixed-point uint16 values, halving its footprint.
+  void quantize_likelihood_field() {
+    const auto& values = likelihood_field_->data();
+    const float max_value = values.empty() ? 0.0F : *std::max_element(values.begin(), values.end());
+    constexpr auto kMaxEncoded = std::numeric_limits<std::uint16_t>::max();
+    quantization_scale_ = max_value > 0.0F ? max_value / static_cast<float>(kMaxEncoded) : 1.0F;
+    auto quantized = std::vector<std::uint16_t>{};
+    quantized.reserve(values.size());
+    for (const float value : values) {
+      quantized.push_back(static_cast<std::uint16_t>(std::lround(value / quantization_scale_)));
+    }
+    quantized_likelihood_field_ = std::make_shared<const ValueGrid2<std::uint16_t>>(
+        std::move(quantized), likelihood_field_->width(), likelihood_field_->resolution());
+    // Release the full-precision field.
+    likelihood_field_ = std::make_shared<const ValueGrid2<float>>(std::vector<float>{}, 1);
+  }
+
+  /// Re-lay the likelihood field into sparsely allocated tiled pages, when sparsity warrants it.
+  /**
+   * The background is the minimum field value — the ambient likelihood every cell far
+   * from any obstacle settles to. When the fraction of background cells reaches
+   * `LikelihoodFieldModelBaseParam::sparse_field_minimum_sparsity`, the field is re-laid
+   * into beluga::SparseTiledValueGrid2 storage and the row-major copy released; denser
+   * fields keep the row-major storage, whose contiguity serves them better than page
+   * indirection.
+   */
+  void sparsify_likelihood_field() {
+    const auto& values = likelihood_field_->data();
+    if (values.empty()) {
+      return;
+    }
+    const float background = *std::min_element(values.begin(), values.end());
+    const auto background_cells = std::count(values.begin(), values.end(), background);
+    const double sparsity = static_cast<double>(background_cells) / static_cast<double>(values.size());
+    if (sparsity < params_.sparse_field_minimum_sparsity) {
+      return;
+    }
+    sparse_likelihood_field_ = std::make_shared<const SparseTiledValueGrid2<float>>(
+        values, likelihood_field_->width(), likelihood_field_->resolution(), background);
+    // Release the row-major field.
+    likelihood_field_ = std::make_shared<const ValueGrid2<float>>(std::vector<float>{}, 1);
+  }
+
+  /// Re-lay the likelihood field into cache-blocked tiled storage.
+  void tile_likelihood_field() {
+    tiled_likelihood_field_ = std::make_shared<const TiledValueGrid2<float>>(
+        likelihood_field_->data(), likelihood_field_->width(), likelihood_field_->resolution());
+    // Release the row-major field.
+    likelihood_field_ = std::make_shared<const ValueGrid2<float>>(std::vector<float>{}, 1);
+  }
+
+  /// Surrounds the likelihood field with a one-cell halo of out-of-field substitute cells.
+  /**
+   * A single ring suffices: lookups through \ref likelihood_clamped_at land on it for
+   * any out-of-field point, however far out, and read the same substitute value the
+   * checked accessors fall back to. The field origin shifts by one cell so world
+   * coordinates keep mapping to the same cells.
+   */
+  void pad_likelihood_field() {
+    const auto& field = *likelihood_field_;
+    const double resolution = field.resolution();
+    const std::size_t padded_width = field.width() + 2U;
+    const auto substitute = static_cast<float>(1. / params_.max_laser_distance);
+    auto values = std::vector<float>(padded_width * (field.height() + 2U), substitute);
+    for (std::size_t y = 0U; y < field.height(); ++y) {
+      std::copy_n(
+          field.data().begin() + static_cast<std::ptrdiff_t>(y * field.width()), field.width(),
+          values.begin() + static_cast<std::ptrdiff_t>((y + 1U) * padded_width + 1U));
+    }
+    likelihood_field_ = std::make_shared<const ValueGrid2<float>>(std::move(values), padded_width, resolution);
+    world_to_likelihood_field_transform_ =
+        Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{resolution, resolution}} * world_to_likelihood_field_transform_;
+  }
+
+  /// Applies the configured allocation hints to the active likelihood field storage.
+  void apply_field_memory_hints() const {
+    if (!params_.memory_hints.any()) {
+      return;
+    }
+    if (params_.use_quantized_storage) {
+      beluga::apply_memory_hints(quantized_likelihood_field_->data(), params_.memory_hints);
+    } else if (params_.use_tiled_field_storage) {
+      beluga::apply_memory_hints(tiled_likelihood_field_->data(), params_.memory_hints);
+    } else if (sparse_likelihood_field_) {
+      beluga::apply_memory_hints(sparse_likelihood_field_->pages(), params_.memory_hints);
+    } else {
+      beluga::apply_memory_hints(likelihood_field_->data(), params_.memory_hints);
+    }
+  }
+
+  /// Returns whether incremental field updates are both requested and applicable to the configured storage.
+  [[nodiscard]] bool incremental_updates_enabled() const {
+    return params_.use_incremental_map_updates && !params_.use_quantized_storage &&
+           !params_.use_tiled_field_storage && !params_.use_sparse_field_storage && !params_.use_padded_field;
+  }
+
+  /// Materializes a boolean mask range into a vector for later diffing.
+  template <class MaskRange>
+  static std::vector<bool> materialize_mask(MaskRange&& mask) {
+    auto values = std::vector<bool>{};
+    for (const bool value : mask) {
+      values.push_back(value);
+    }
+    return values;
+  }
+
+  /// Stores the grid masks to diff the next map update against.
+  void cache_grid_masks(const map_type& grid) {
+    cached_obstacle_mask_ = materialize_mask(grid.obstacle_mask());
+    if (params_.model_unknown_space) {
+      cached_unknown_mask_ = materialize_mask(grid.unknown_mask());
+    }
+  }
+
+  /// Patches the likelihood field in place of a full rebuild, when the grid change allows it.
+  /**
+   * Diffs the new grid against the masks cached from the previous one and re-runs the
+   * distance transform only over the bounding box of the changed cells plus a
+   * max-obstacle-distance halo. Cells within one halo of the box are the only ones whose
+   * nearest obstacle can change, and their distances depend on obstacles at most one
+   * further halo away, so the transform runs on a window extending two halos past the
+   * box while only the inner halo is patched. The patched cells match a full rebuild
+   * bit for bit.
+   *
+   * \param grid New occupancy grid representing the static map.
+   * \return true if the field was patched (or the grids turned out identical), false
+   *  when the grid geometry or origin changed and a full rebuild is required.
+   */
+  [[nodiscard]] bool try_incremental_field_update(const map_type& grid) {
+    if (cached_obstacle_mask_.empty()) {
+      return false;
+    }
+    const std::size_t width = grid.width();
+    const std::size_t height = grid.height();
+    if (width != likelihood_field_->width() || height != likelihood_field_->height() ||
+        grid.resolution() != likelihood_field_->resolution()) {
+      return false;
+    }
+    const auto transform = grid.origin().inverse();
+    if (!(transform.matrix().array() == world_to_likelihood_field_transform_.matrix().array()).all()) {
+      return false;
+    }
+
+    auto obstacle_mask = materialize_mask(grid.obstacle_mask());
+    if (obstacle_mask.size() != cached_obstacle_mask_.size()) {
+      return false;
+    }
+    auto unknown_mask = std::vector<bool>{};
+    if (params_.model_unknown_space) {
+      unknown_mask = materialize_mask(grid.unknown_mask());
+    }
+
+    // Bounding box of the changed cells, in cell coordinates.
+    std::size_t x_min = width;
+    std::size_t x_max = 0U;
+    std::size_t y_min = height;
+    std::size_t y_max = 0U;
+    for (std::size_t y = 0U, index = 0U; y < height; ++y) {
+      for (std::size_t x = 0U; x < width; ++x, ++index) {
+        const bool changed = obstacle_mask[index] != cached_obstacle_mask_[index] ||
+                             (params_.model_unknown_space && unknown_mask[index] != cached_unknown_mask_[index]);
+        if (changed) {
+          x_min = std::min(x_min, x);
+          x_max = std::max(x_max, x);
+          y_min = std::min(y_min, y);
+          y_max = std::max(y_max, y);
+        }
+      }
+    }
+    if (x_min > x_max) {
+      return true;  // Identical grids; nothing to patch.
+    }
+
+    const auto halo = static_cast<std::size_t>(std::ceil(params_.max_obstacle_distance / grid.resolution()));
+    const std::size_t patch_x_min = x_min > halo ? x_min - halo : 0U;
+    const std::size_t patch_y_min = y_min > halo ? y_min - halo : 0U;
+    const std::size_t patch_x_max = std::min(x_max + halo, width - 1U);
+    const std::size_t patch_y_max = std::min(y_max + halo, height - 1U);
+    const std::size_t window_x_min = patch_x_min > halo ? patch_x_min - halo : 0U;
+    const std::size_t window_y_min = patch_y_min > halo ? patch_y_min - halo : 0U;
+    const std::size_t window_x_max = std::min(patch_x_max + halo, width - 1U);
+    const std::size_t window_y_max = std::min(patch_y_max + halo, height - 1U);
+    const std::size_t window_width = window_x_max - window_x_min + 1U;
+    const std::size_t window_height = window_y_max - window_y_min + 1U;
+
+    auto window_mask = std::vector<bool>(window_width * window_height);
+    for (std::size_t y = 0U; y < window_height; ++y) {
+      for (std::size_t x = 0U; x < window_width; ++x) {
+        window_mask[y * window_width + x] = obstacle_mask[(window_y_min + y) * width + window_x_min + x];
+      }
+    }
+
+    const auto squared_resolution = static_cast<float>(grid.resolution() * grid.resolution());
+    const auto squared_max_distance = static_cast<float>(params_.max_obstacle_distance * params_.max_obstacle_distance);
+    const auto window_distances =
+        params_.use_parallel_field_construction
+            ? nearest_obstacle_distance_map_2d(
+                  std::execution::par, window_mask, window_width, squared_resolution, squared_max_distance)
+            : nearest_obstacle_distance_map_2d(window_mask, window_width, squared_resolution, squared_max_distance);
+
+    const double two_squared_sigma = 2 * params_.sigma_hit * params_.sigma_hit;
+    const double amplitude = params_.z_hit / (params_.sigma_hit * std::sqrt(2 * Sophus::Constants<double>::pi()));
+    const double offset = params_.z_random / params_.max_laser_distance;
+    const auto to_likelihood = [amplitude, two_squared_sigma, offset](double squared_distance) {
+      return amplitude * std::exp(-squared_distance / two_squared_sigma) + offset;
+    };
+
+    auto squared_background_distance = squared_max_distance;
+    if (params_.model_unknown_space) {
+      const auto inverse_max_distance = 1 / params_.max_laser_distance;
+      squared_background_distance = std::min(
+          squared_max_distance,
+          static_cast<float>(-two_squared_sigma * std::log((inverse_max_distance - offset) / amplitude)));
+    }
+
+    auto values = likelihood_field_->data();
+    for (std::size_t y = patch_y_min; y <= patch_y_max; ++y) {
+      for (std::size_t x = patch_x_min; x <= patch_x_max; ++x) {
+        const std::size_t index = y * width + x;
+        auto squared_distance = window_distances[(y - window_y_min) * window_width + (x - window_x_min)];
+        if (params_.model_unknown_space && unknown_mask[index]) {
+          squared_distance = squared_background_distance;
+        }
+        values[index] = static_cast<float>(to_likelihood(squared_distance));
+      }
+    }
+
+    likelihood_field_ = std::make_shared<const ValueGrid2<float>>(std::move(values), width, grid.resolution());
+    if (params_.use_pyramid_evaluation) {
+      likelihood_field_pyramid_ = std::make_shared<const std::vector<ValueGrid2<float>>>(
+          make_likelihood_field_pyramid(*likelihood_field_, params_.pyramid_levels));
+    }
+    cached_obstacle_mask_ = std::move(obstacle_mask);
+    if (params_.model_unknown_space) {
+      cached_unknown_mask_ = std::move(unknown_mask);
+    }
+    return true;
+  }
+
+  /// Creates a likelihood field from an occupancy grid, going through the on-disk cache if enabled.
+  /**
+   * \param params Parameters to configure the likelihood field.
+   * \param grid Occupancy grid representing the static map.
+   * \return Likelihood field computed from the occupancy grid, or loaded from the cache.
+   */
+  static ValueGrid2<float> make_or_load_likelihood_field(const param_type& params, const OccupancyGrid& grid) {
+    if (params.likelihood_field_cache_directory.empty()) {
+      return make_likelihood_field(params, grid);
+    }
+    const auto path = likelihood_field_cache_path(params, grid);
+    if (auto cached = load_likelihood_field(path)) {
+      return std::move(*cached);
+    }
+    auto field = make_likelihood_field(params, grid);
+    save_likelihood_field(path, field);
+    return field;
+  }
+
+  /// Computes the cache file path for a given occupancy grid and parameter set.
+  static std::filesystem::path likelihood_field_cache_path(const param_type& params, const OccupancyGrid& grid) {
+    // FNV-1a over everything the field depends on: grid geometry, cell
+    // occupancy, and the parameters that shape the likelihood values.
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    const auto combine = [&hash](std::uint64_t value) {
+      hash ^= value;
+      hash *= 0x100000001B3ULL;
+    };
+    const auto combine_double = [&combine](double value) {
+      std::uint64_t bits = 0U;
+      std::memcpy(&bits, &value, sizeof(bits));
+      combine(bits);
+    };
+    combine(static_cast<std::uint64_t>(grid.width()));
+    combine(static_cast<std::uint64_t>(grid.height()));
+    combine_double(grid.resolution());
+    for (const bool occupied : grid.obstacle_mask()) {
+      combine(occupied ? 1U : 0U);
+    }
+    if (params.model_unknown_space) {
+      for (const bool unknown : grid.unknown_mask()) {
+        combine(unknown ? 1U : 0U);
+      }
+    }
+    combine_double(params.max_obstacle_distance);
+    combine_double(params.max_laser_distance);
+    combine_double(params.z_hit);
+    combine_double(params.z_random);
+    combine_double(params.sigma_hit);
+    combine(params.model_unknown_space ? 1U : 0U);
+
+    std::ostringstream name;
+    name << "likelihood_field_" << std::hex << std::setfill('0') << std::setw(16) << hash << ".bin";
+    return std::filesystem::path{params.likelihood_field_cache_directory} / name.str();
+  }
+
+  /// Loads a serialized likelihood field, returning nullopt on any mismatch or I/O failure.
+  static std::optional<ValueGrid2<float>> load_likelihood_field(const std::filesystem::path& path) {
+    auto file = std::ifstream{path, std::ios::binary};
+    if (!file) {
+      return std::nullopt;
+    }
+    char magic[sizeof(kLikelihoodFieldCacheMagic)] = {};
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, kLikelihoodFieldCacheMagic, sizeof(magic)) != 0) {
+      return std::nullopt;
+    }
+    std::uint64_t width = 0U;
+    std::uint64_t count = 0U;
+    double resolution = 0.0;
+    file.read(reinterpret_cast<char*>(&width), sizeof(width));
+    file.read(reinterpret_cast<char*>(&resolution), sizeof(resolution));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!file || width == 0U || count % width != 0U) {
+      return std::nullopt;
+    }
+    auto values = std::vector<float>(count);
+    file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(count * sizeof(float)));
+    if (!file) {
+      return std::nullopt;
+    }
+    return ValueGrid2<float>{std::move(values), static_cast<std::size_t>(width), resolution};
+  }
+
+  /// Serializes a likelihood field in a flat binary layout. Best-effort: failures are ignored.
+  static void save_likelihood_field(const std::filesystem::path& path, const ValueGrid2<float>& field) {
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+    auto file = std::ofstream{path, std::ios::binary | std::ios::trunc};
+    if (!file) {
+      return;
+    }
+    file.write(kLikelihoodFieldCacheMagic, sizeof(kLikelihoodFieldCacheMagic));
+    const auto width = static_cast<std::uint64_t>(field.width());
+    const double resolution = field.resolution();
+    const auto count = static_cast<std::uint64_t>(field.size());
+    file.write(reinterpret_cast<const char*>(&width), sizeof(width));
+    file.write(reinterpret_cast<const char*>(&resolution), sizeof(resolution));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(field.data().data()), static_cast<std::streamsize>(count * sizeof(float)));
+  }
+
+  /// Magic bytes identifying serialized likelihood field files.
+  static constexpr char kLikelihoodFieldCacheMagic[4] = {'B', 'L', 'F', '1'};
+
+  /// Header of the shared-memory likelihood field segment layout.
+  /**
+   * The header is followed by `count` packed float likelihood values, stored in host
+   * byte order, so attaching processes can view the field in place without parsing.
+   */
+  struct LikelihoodFieldSegmentHeader {
+    /// Expected value for the `magic` field.
+    static constexpr std::array<char, 4> kMagic = {'B', 'L', 'F', 'S'};
+    /// Expected value for the `version` field.
+    static constexpr std::uint32_t kVersion = 1;
+
+    /// Segment signature, identifying the layout.
+    std::array<char, 4> magic = kMagic;
+    /// Layout version, bumped on changes.
+    std::uint32_t version = kVersion;
+    /// Width of the field grid.
+    std::uint64_t width = 0;
+    /// Number of likelihood values in the field.
+    std::uint64_t count = 0;
+    /// Resolution of the field grid.
+    double resolution = 0.0;
+    /// X translation of the field origin in world coordinates.
+    double origin_x = 0.0;
+    /// Y translation of the field origin in world coordinates.
+    double origin_y = 0.0;
+    /// Rotation of the field origin in world coordinates.
+    double origin_theta = 0.0;
+  };
+
+  static_assert(sizeof(LikelihoodFieldSegmentHeader) == 56, "The likelihood field segment header must be packed.");
 
   /// Creates a likelihood field from an occupancy grid.
   /**
@@ -124,10 +1138,6 @@ class LikelihoodFieldModelBase {
    * \return Likelihood field computed from the occupancy grid.
    */
   static ValueGrid2<float> make_likelihood_field(const param_type& params, const OccupancyGrid& grid) {
-    const auto squared_distance = [&grid](std::size_t first, std::size_t second) {
-      return static_cast<float>((grid.coordinates_at(first) - grid.coordinates_at(second)).squaredNorm());
-    };
-
     /// Pre-computed variables
     const double two_squared_sigma = 2 * params.sigma_hit * params.sigma_hit;
     assert(two_squared_sigma > 0.0);
@@ -141,14 +1151,18 @@ class LikelihoodFieldModelBase {
       return amplitude * std::exp(-squared_distance / two_squared_sigma) + offset;
     };
 
-    const auto neighborhood = [&grid](std::size_t index) { return grid.neighborhood4(index); };
-
     const auto squared_max_distance = static_cast<float>(params.max_obstacle_distance * params.max_obstacle_distance);
 
-    // determine distances to obstacles and calculate likelihood values in-place
-    // to minimize memory usage when dealing with large maps
+    // determine distances to obstacles with the separable two-pass exact Euclidean
+    // distance transform and calculate likelihood values in-place to minimize
+    // memory usage when dealing with large maps
+    const auto squared_resolution = static_cast<float>(grid.resolution() * grid.resolution());
     auto distance_map =
-        nearest_obstacle_distance_map(grid.obstacle_mask(), squared_distance, neighborhood, squared_max_distance);
+        params.use_parallel_field_construction
+            ? nearest_obstacle_distance_map_2d(
+                  std::execution::par, grid.obstacle_mask(), grid.width(), squared_resolution, squared_max_distance)
+            : nearest_obstacle_distance_map_2d(
+                  grid.obstacle_mask(), grid.width(), squared_resolution, squared_max_distance);
 
     if (params.model_unknown_space) {
       const auto inverse_max_distance = 1 / params.max_laser_distance;
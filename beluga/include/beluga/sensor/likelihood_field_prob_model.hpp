@@ -18,7 +18,9 @@
 #include <algorithm>
 #include <beluga/sensor/likelihood_field_model_base.hpp>
 #include <cmath>
+#include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 /**
@@ -51,6 +53,8 @@ class LikelihoodFieldProbModel : public LikelihoodFieldModelBase<OccupancyGrid>
   using map_type = OccupancyGrid;
   /// Parameter type that the constructor uses to configure the likelihood field model.
   using param_type = LikelihoodFieldProbModelParam;
+  /// Measurement type after the shared per-scan preprocessing stage.
+  using preprocessed_measurement_type = typename LikelihoodFieldModelBase<OccupancyGrid>::PreprocessedMeasurement;
 
   /// Constructs a LikelihoodFieldProbModel instance.
   /**
@@ -59,14 +63,24 @@ class LikelihoodFieldProbModel : public LikelihoodFieldModelBase<OccupancyGrid>
   explicit LikelihoodFieldProbModel(const param_type& params, const map_type& grid)
       : LikelihoodFieldModelBase<OccupancyGrid>(params, grid) {}
 
-  /// Returns a state weighting function conditioned on 2D lidar hits.
+  /// Constructs a LikelihoodFieldProbModel instance over an externally mapped likelihood field.
   /**
-   * \param points 2D lidar hit points in the reference frame of particle states.
+   * @copydoc LikelihoodFieldModelBase::LikelihoodFieldModelBase(const param_type&, SharedMemoryRegion&&)
+   */
+  explicit LikelihoodFieldProbModel(const param_type& params, SharedMemoryRegion&& region)
+      : LikelihoodFieldModelBase<OccupancyGrid>(params, std::move(region)) {}
+
+  /// Returns a state weighting function conditioned on a preprocessed scan.
+  /**
+   * \param scan Shared handle to a scan preprocessed through
+   *  LikelihoodFieldModelBase::preprocess_measurement, possibly by another model instance
+   *  tracking the same measurement stream.
    * \return a state weighting function satisfying \ref StateWeightingFunctionPage
    *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
    */
-  [[nodiscard]] auto operator()(measurement_type&& points) const {
-    return [this, points = std::move(points)](const state_type& state) -> weight_type {
+  [[nodiscard]] auto operator()(std::shared_ptr<const preprocessed_measurement_type> scan) const {
+    return [this, scan = std::move(scan)](const state_type& state) -> weight_type {
+      const auto& points = scan->points;
       const auto transform = this->world_to_likelihood_field_transform_ * state;
       const auto x_offset = transform.translation().x();
       const auto y_offset = transform.translation().y();
@@ -83,11 +97,25 @@ class LikelihoodFieldProbModel : public LikelihoodFieldModelBase<OccupancyGrid>
             const auto x = point.first * cos_theta - point.second * sin_theta + x_offset;
             const auto y = point.first * sin_theta + point.second * cos_theta + y_offset;
             const auto pz =
-                static_cast<double>(this->likelihood_field_.data_near(x, y).value_or(unknown_space_occupancy_prob));
+                static_cast<double>(this->likelihood_near(x, y).value_or(unknown_space_occupancy_prob));
             return std::log(pz);
           }));
     };
   }
+
+  /// Returns a state weighting function conditioned on 2D lidar hits.
+  /**
+   * \param points 2D lidar hit points in the reference frame of particle states.
+   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
+   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   *
+   * The measurement goes once through LikelihoodFieldModelBase::preprocess_measurement
+   * before conditioning; use that stage directly to share the preprocessed scan with
+   * other model instances.
+   */
+  [[nodiscard]] auto operator()(measurement_type&& points) const {
+    return (*this)(this->preprocess_measurement(std::move(points)));
+  }
 };
 
 }  // namespace beluga
@@ -0,0 +1,251 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_MAP_REGISTRY_HPP
+#define BELUGA_SENSOR_MAP_REGISTRY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * \file
+ * \brief Implementation of a multi-map registry with lazy activation and bounded residency.
+ */
+
+namespace beluga {
+
+/// Registry of compiled sensor model bundles keyed by map identifier.
+/**
+ * Multi-floor deployments carry one map per floor, and neither extreme scales: compiling
+ * a sensor model on every floor change pays full field construction mid-mission, while
+ * keeping every floor compiled at once is prohibitive in memory. This registry sits in
+ * between. Maps are registered as loaders that compile a sensor model on demand; the
+ * registry keeps a bounded set of compiled bundles resident, evicting the least recently
+ * used one beyond capacity, and can compile the likely next map on a background thread so
+ * a floor transition finds its bundle already resident.
+ *
+ * Activation returns a shared handle to an already compiled bundle, so adopting it is as
+ * cheap as the model allows: beluga::LikelihoodFieldModelBase::adopt_field_from() shares
+ * the precomputed field representations without copying them, and
+ * beluga::NDTSensorModel::update_map() can adopt a shared map handle directly. The active
+ * bundle is never evicted.
+ *
+ * All member functions are thread-safe. Loaders run outside the registry lock, so a
+ * background prefetch never blocks concurrent activations.
+ *
+ * \tparam SensorModel The compiled bundle type, typically a sensor model instance.
+ *  It only needs to be constructible by the registered loaders.
+ * \tparam Key The map identifier type, hashable and equality comparable.
+ */
+template <class SensorModel, class Key = std::string>
+class MapRegistry {
+ public:
+  /// Callable that compiles the sensor model bundle for one map.
+  using loader_type = std::function<SensorModel()>;
+
+  /// Constructs a registry with the given residency bound.
+  /**
+   * \param capacity Maximum number of compiled bundles kept resident, at least 1.
+   */
+  explicit MapRegistry(std::size_t capacity = 2) : capacity_{std::max<std::size_t>(capacity, 1)} {}
+
+  /// Registers a map under the given key without compiling anything.
+  /**
+   * Compilation is deferred until the map is first activated or prefetched.
+   * Re-registering a key replaces its loader and drops any resident bundle.
+   *
+   * \param key Map identifier.
+   * \param loader Callable that compiles the sensor model bundle for this map.
+   */
+  void register_map(Key key, loader_type loader) {
+    const auto lock = std::lock_guard{mutex_};
+    auto& entry = entries_[key];
+    if (entry.pending.valid()) {
+      entry.pending.wait();
+      entry.pending = {};
+    }
+    if (entry.bundle != nullptr) {
+      recency_.remove(key);
+      entry.bundle = nullptr;
+    }
+    entry.loader = std::move(loader);
+  }
+
+  /// Activates the map under the given key, compiling its bundle unless already resident.
+  /**
+   * Resident bundles (kept by the LRU policy or produced by an earlier prefetch) are
+   * returned in constant time; otherwise the call blocks while the loader compiles one.
+   * The returned bundle stays valid for as long as the handle is held, even after the
+   * registry evicts or replaces it.
+   *
+   * \param key Map identifier.
+   * \return A shared handle to the compiled bundle.
+   * \throw std::out_of_range If no map was registered under the key.
+   */
+  [[nodiscard]] std::shared_ptr<const SensorModel> activate(const Key& key) {
+    auto lock = std::unique_lock{mutex_};
+    auto& entry = entry_at(key);
+    if (entry.bundle == nullptr && entry.pending.valid()) {
+      auto pending = std::move(entry.pending);
+      lock.unlock();  // an in-flight prefetch compiles outside the lock
+      auto bundle = pending.get();
+      lock.lock();
+      store_bundle(key, std::move(bundle));
+    } else if (entry.bundle == nullptr) {
+      auto loader = entry.loader;
+      lock.unlock();
+      auto bundle = std::make_shared<const SensorModel>(loader());
+      lock.lock();
+      store_bundle(key, std::move(bundle));
+    } else {
+      touch(key);
+    }
+    active_key_ = key;
+    evict_beyond_capacity();
+    return entries_.at(key).bundle;
+  }
+
+  /// Starts compiling the bundle for the given key on a background thread.
+  /**
+   * Intended for the likely next map (e.g. the floor an elevator is heading to), so its
+   * activation finds the bundle already compiled. Does nothing if the bundle is already
+   * resident or a prefetch for it is already in flight.
+   *
+   * \param key Map identifier.
+   * \throw std::out_of_range If no map was registered under the key.
+   */
+  void prefetch(const Key& key) {
+    const auto lock = std::lock_guard{mutex_};
+    auto& entry = entry_at(key);
+    if (entry.bundle != nullptr || entry.pending.valid()) {
+      return;
+    }
+    entry.pending = std::async(
+        std::launch::async, [loader = entry.loader]() { return std::make_shared<const SensorModel>(loader()); });
+  }
+
+  /// Returns the active bundle, or nullptr if no map has been activated yet.
+  [[nodiscard]] std::shared_ptr<const SensorModel> active() const {
+    const auto lock = std::lock_guard{mutex_};
+    return active_key_.has_value() ? entries_.at(*active_key_).bundle : nullptr;
+  }
+
+  /// Returns whether the bundle for the given key is compiled and resident.
+  /**
+   * In-flight prefetches do not count as resident until collected by activate().
+   *
+   * \param key Map identifier.
+   */
+  [[nodiscard]] bool is_resident(const Key& key) const {
+    const auto lock = std::lock_guard{mutex_};
+    const auto it = entries_.find(key);
+    return it != entries_.end() && it->second.bundle != nullptr;
+  }
+
+  /// Returns the number of compiled bundles currently resident.
+  [[nodiscard]] std::size_t resident_count() const {
+    const auto lock = std::lock_guard{mutex_};
+    return recency_.size();
+  }
+
+  /// Returns the maximum number of compiled bundles kept resident.
+  [[nodiscard]] std::size_t capacity() const { return capacity_; }
+
+  /// Waits for any in-flight prefetches before destruction.
+  ~MapRegistry() {
+    for (auto& [key, entry] : entries_) {
+      if (entry.pending.valid()) {
+        entry.pending.wait();
+      }
+    }
+  }
+
+ private:
+  /// Registered map bookkeeping.
+  struct Entry {
+    /// Callable that compiles the bundle for this map.
+    loader_type loader;
+    /// Compiled bundle, or nullptr while not resident.
+    std::shared_ptr<const SensorModel> bundle;
+    /// In-flight background compilation, if any.
+    std::future<std::shared_ptr<const SensorModel>> pending;
+  };
+
+  /// Returns the entry for the given key, throwing if the key was never registered.
+  [[nodiscard]] Entry& entry_at(const Key& key) {
+    const auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      std::stringstream ss;
+      ss << "No map registered under key " << key;
+      throw std::out_of_range(ss.str());
+    }
+    return it->second;
+  }
+
+  /// Makes a freshly compiled bundle resident and most recently used.
+  /**
+   * A concurrent activation may have compiled the same bundle while the lock was
+   * released; the first one stored wins and later ones are dropped.
+   */
+  void store_bundle(const Key& key, std::shared_ptr<const SensorModel> bundle) {
+    auto& entry = entries_.at(key);
+    entry.pending = {};
+    if (entry.bundle == nullptr) {
+      entry.bundle = std::move(bundle);
+      recency_.push_front(key);
+    } else {
+      touch(key);
+    }
+  }
+
+  /// Marks a resident bundle as most recently used.
+  void touch(const Key& key) {
+    recency_.remove(key);
+    recency_.push_front(key);
+  }
+
+  /// Drops least recently used bundles until the residency bound holds, sparing the active one.
+  void evict_beyond_capacity() {
+    auto it = recency_.end();
+    while (recency_.size() > capacity_ && it != recency_.begin()) {
+      --it;
+      if (active_key_.has_value() && *it == *active_key_) {
+        continue;
+      }
+      entries_.at(*it).bundle = nullptr;
+      it = recency_.erase(it);
+    }
+  }
+
+  std::size_t capacity_;
+  mutable std::mutex mutex_;
+  std::unordered_map<Key, Entry> entries_;
+  std::list<Key> recency_;  ///< Keys of resident bundles, most recently used first.
+  std::optional<Key> active_key_;
+};
+
+}  // namespace beluga
+
+#endif
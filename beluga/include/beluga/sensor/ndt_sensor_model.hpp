@@ -21,10 +21,26 @@
 
 #else
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <sstream>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -40,6 +56,8 @@
 
 #include <beluga/sensor/data/ndt_cell.hpp>
 #include <beluga/sensor/data/sparse_value_grid.hpp>
+#include <beluga/utility/memory_hints.hpp>
+#include <beluga/utility/shared_memory_region.hpp>
 #include "beluga/eigen_compatibility.hpp"
 
 namespace beluga {
@@ -61,6 +79,324 @@ struct CellHasher {
   }
 };
 
+/// Spreads the lower 32 bits of `input` over the even bit positions of the result.
+inline std::uint64_t interleave_with_one_zero(std::uint32_t input) {
+  std::uint64_t word = input;
+  word = (word ^ (word << 16)) & 0x0000FFFF0000FFFFULL;
+  word = (word ^ (word << 8)) & 0x00FF00FF00FF00FFULL;
+  word = (word ^ (word << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  word = (word ^ (word << 2)) & 0x3333333333333333ULL;
+  word = (word ^ (word << 1)) & 0x5555555555555555ULL;
+  return word;
+}
+
+/// Spreads the lower 21 bits of `input` over every third bit position of the result.
+inline std::uint64_t interleave_with_two_zeros(std::uint32_t input) {
+  std::uint64_t word = input & 0x1FFFFFULL;
+  word = (word | (word << 32)) & 0x001F00000000FFFFULL;
+  word = (word | (word << 16)) & 0x001F0000FF0000FFULL;
+  word = (word | (word << 8)) & 0x100F00F00F00F00FULL;
+  word = (word | (word << 4)) & 0x10C30C30C30C30C3ULL;
+  word = (word | (word << 2)) & 0x1249249249249249ULL;
+  return word;
+}
+
+/// Computes the Morton (Z-order) code of an N dimensional integer cell.
+/**
+ * Cells that are close in space get numerically close codes, so sorting
+ * cells by Morton code yields a memory access pattern with good spatial
+ * locality. Negative coordinates are supported by biasing each axis into
+ * the unsigned range (wrapping past +/- 2^20 cells per axis in 3D).
+ */
+template <int N>
+inline std::uint64_t morton_code(const Eigen::Vector<int, N>& cell) {
+  static_assert(N == 2 or N == 3, "Morton codes are only implemented for 2D and 3D cells.");
+  if constexpr (N == 2) {
+    const auto x = static_cast<std::uint32_t>(cell.x()) ^ 0x80000000U;
+    const auto y = static_cast<std::uint32_t>(cell.y()) ^ 0x80000000U;
+    return interleave_with_one_zero(x) | (interleave_with_one_zero(y) << 1);
+  } else {
+    const auto x = (static_cast<std::uint32_t>(cell.x()) + 0x100000U) & 0x1FFFFFU;
+    const auto y = (static_cast<std::uint32_t>(cell.y()) + 0x100000U) & 0x1FFFFFU;
+    const auto z = (static_cast<std::uint32_t>(cell.z()) + 0x100000U) & 0x1FFFFFU;
+    return interleave_with_two_zeros(x) | (interleave_with_two_zeros(y) << 1) |
+           (interleave_with_two_zeros(z) << 2);
+  }
+}
+
+/// Contiguous pool of NDT cell gaussians, indexed through a sparse cell-to-index map.
+/**
+ * Splits a sparse NDT grid into a compact map from cells to 32 bit pool indices plus flat
+ * arrays of cell means and covariances, sorted by Morton code so spatially close cells are
+ * also memory adjacent. Probing the pool only moves a small index through the hash lookup
+ * instead of copying a full gaussian out of the map node, and Morton ordered probe loops
+ * (see NDTSensorModel::likelihood_sum_at()) then read the gaussian payloads almost
+ * sequentially. The arrays never move after construction, so references into them remain
+ * stable for the lifetime of the pool.
+ */
+template <typename SparseGridT>
+class NDTCellIndexPool {
+ public:
+  /// NDT cell type stored by the pooled grid.
+  using ndt_cell_type = typename SparseGridT::mapped_type;
+  /// Cell index type of the pooled grid.
+  using key_type = typename SparseGridT::key_type;
+  /// Number of dimensions of the pooled cells.
+  static constexpr int kNumDim = ndt_cell_type::num_dim;
+  /// Floating point scalar type of the pooled cells.
+  using scalar_type = typename ndt_cell_type::scalar_type;
+
+  /// Constructs a pool holding a flattened copy of the cells in `grid`.
+  explicit NDTCellIndexPool(const SparseGridT& grid) {
+    struct Entry {
+      std::uint64_t morton_key;
+      const typename SparseGridT::map_type::value_type* item;
+    };
+    std::vector<Entry> entries;
+    entries.reserve(grid.size());
+    for (const auto& item : grid.data()) {
+      entries.push_back(Entry{morton_code<kNumDim>(item.first), &item});
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+      return lhs.morton_key < rhs.morton_key;
+    });
+    indices_.reserve(entries.size());
+    means_.reserve(entries.size());
+    covariances_.reserve(entries.size());
+    for (const auto& entry : entries) {
+      indices_[entry.item->first] = static_cast<std::uint32_t>(means_.size());
+      means_.push_back(entry.item->second.mean);
+      covariances_.push_back(entry.item->second.covariance);
+    }
+  }
+
+  /// Constructs a pool viewing externally mapped cell arrays.
+  /**
+   * The gaussian payloads stay in the mapped storage and are read in place — only the
+   * cell-to-index map is built privately — so several processes attached to the same
+   * mapping share one copy of the heavy arrays. The array layout matches the flat
+   * binary map format (see beluga::io::NDTBinaryMapHeader): cell means, covariances
+   * and integer cell indices, each packed contiguously in matching order.
+   *
+   * \param means Pointer to `count` packed cell means.
+   * \param covariances Pointer to `count` packed column-major cell covariances.
+   * \param cells Pointer to `count` packed integer cell indices.
+   * \param count Number of mapped cells.
+   * \param keepalive Handle keeping the mapped storage alive for the lifetime of the pool.
+   */
+  explicit NDTCellIndexPool(
+      const scalar_type* means,
+      const scalar_type* covariances,
+      const std::int32_t* cells,
+      std::size_t count,
+      std::shared_ptr<const void> keepalive)
+      : mapped_means_(means),
+        mapped_covariances_(covariances),
+        mapped_count_(count),
+        keepalive_(std::move(keepalive)) {
+    indices_.reserve(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+      const Eigen::Map<const Eigen::Vector<std::int32_t, kNumDim> > cell(cells + i * kNumDim);
+      indices_[cell.template cast<int>()] = static_cast<std::uint32_t>(i);
+    }
+  }
+
+  /// Returns the number of pooled cells.
+  [[nodiscard]] std::size_t size() const { return mapped_means_ != nullptr ? mapped_count_ : means_.size(); }
+
+  /// Applies allocation placement hints to the flat mean and covariance arrays.
+  /**
+   * \param hints Hints to apply. See beluga::MemoryHints.
+   * \return True if every requested hint was applied to both arrays.
+   */
+  bool apply_memory_hints(const MemoryHints& hints) noexcept {
+    if (mapped_means_ != nullptr) {
+      // Placement of mapped storage belongs to whoever published it, but faulting the
+      // pages in and pinning them are per-process concerns that apply here as well.
+      if (!hints.prefault && !hints.lock_in_memory) {
+        return false;
+      }
+      const std::size_t means_bytes = mapped_count_ * kNumDim * sizeof(scalar_type);
+      const std::size_t covariances_bytes = mapped_count_ * kNumDim * kNumDim * sizeof(scalar_type);
+      bool applied = true;
+      if (hints.prefault) {
+        applied = prefault_pages(mapped_means_, means_bytes) &&
+                  prefault_pages(mapped_covariances_, covariances_bytes) && applied;
+      }
+      if (hints.lock_in_memory) {
+        applied =
+            lock_pages(mapped_means_, means_bytes) && lock_pages(mapped_covariances_, covariances_bytes) && applied;
+      }
+      return applied;
+    }
+    const bool means_hinted = beluga::apply_memory_hints(means_, hints);
+    const bool covariances_hinted = beluga::apply_memory_hints(covariances_, hints);
+    return means_hinted && covariances_hinted;
+  }
+
+  /// Returns the pool index of `cell`, or std::nullopt if it's not present.
+  [[nodiscard]] std::optional<std::uint32_t> index_at(const key_type& cell) const {
+    const auto itr = indices_.find(cell);
+    if (itr == indices_.end()) {
+      return std::nullopt;
+    }
+    return itr->second;
+  }
+
+  /// Returns a view of the mean of the pooled cell at `index`.
+  [[nodiscard]] Eigen::Map<const Eigen::Vector<scalar_type, kNumDim>> mean_at(std::uint32_t index) const {
+    const scalar_type* base =
+        mapped_means_ != nullptr ? mapped_means_ + static_cast<std::size_t>(index) * kNumDim : means_[index].data();
+    return Eigen::Map<const Eigen::Vector<scalar_type, kNumDim>>{base};
+  }
+
+  /// Returns a view of the covariance of the pooled cell at `index`.
+  [[nodiscard]] Eigen::Map<const Eigen::Matrix<scalar_type, kNumDim, kNumDim>> covariance_at(
+      std::uint32_t index) const {
+    const scalar_type* base = mapped_covariances_ != nullptr
+                                  ? mapped_covariances_ + static_cast<std::size_t>(index) * kNumDim * kNumDim
+                                  : covariances_[index].data();
+    return Eigen::Map<const Eigen::Matrix<scalar_type, kNumDim, kNumDim>>{base};
+  }
+
+ private:
+  std::unordered_map<key_type, std::uint32_t, CellHasher<kNumDim>> indices_;
+  std::vector<Eigen::Vector<scalar_type, kNumDim>> means_;
+  std::vector<Eigen::Matrix<scalar_type, kNumDim, kNumDim>> covariances_;
+  /// Mapped mean array, non-null when the pool views external storage.
+  const scalar_type* mapped_means_ = nullptr;
+  /// Mapped covariance array, paired with `mapped_means_`.
+  const scalar_type* mapped_covariances_ = nullptr;
+  /// Number of cells in the mapped arrays.
+  std::size_t mapped_count_ = 0U;
+  /// Handle keeping the mapped storage alive.
+  std::shared_ptr<const void> keepalive_;
+};
+
+/// Batch evaluator for NDT cell likelihood terms, packed in struct-of-arrays form.
+/**
+ * Accumulates (measurement, map cell) pairs, storing the mean error and the inverse of the summed
+ * covariances component-wise in flat arrays. evaluate() then computes all quadratic forms and
+ * exponentials with vectorized Eigen array expressions, which is considerably faster than evaluating
+ * `d1 * exp(-d2 / 2 * e^T * S^-1 * e)` one scalar expression at a time.
+ */
+template <int NDim, typename Scalar = double>
+class NDTLikelihoodBatch {
+ public:
+  static_assert(NDim == 2 or NDim == 3, "NDT likelihood batches are only implemented for 2D and 3D cells.");
+
+  /// Removes all pending terms, keeping allocated storage.
+  void clear() {
+    for (auto& component : errors_) {
+      component.clear();
+    }
+    for (auto& component : inverses_) {
+      component.clear();
+    }
+    targets_.clear();
+  }
+
+  /// Ensures storage for a number of terms without reallocation.
+  void reserve(std::size_t count) {
+    for (auto& component : errors_) {
+      component.reserve(count);
+    }
+    for (auto& component : inverses_) {
+      component.reserve(count);
+    }
+    targets_.reserve(count);
+  }
+
+  /// Adds one likelihood term to the batch.
+  /**
+   * \param cell Map cell the measurement is matched against.
+   * \param measurement Measurement cell, in the same frame as the map cell.
+   * \param target Index of the accumulator this term contributes to.
+   */
+  void push_back(const NDTCell<NDim, Scalar>& cell, const NDTCell<NDim, Scalar>& measurement, std::uint32_t target) {
+    push_back(cell.mean, cell.covariance, measurement, target);
+  }
+
+  /// Overload of push_back() for map cells stored as separate mean and covariance arrays.
+  /**
+   * \param cell_mean Mean of the map cell the measurement is matched against.
+   * \param cell_covariance Covariance of the map cell the measurement is matched against.
+   * \param measurement Measurement cell, in the same frame as the map cell.
+   * \param target Index of the accumulator this term contributes to.
+   */
+  void push_back(
+      const Eigen::Vector<Scalar, NDim>& cell_mean,
+      const Eigen::Matrix<Scalar, NDim, NDim>& cell_covariance,
+      const NDTCell<NDim, Scalar>& measurement,
+      std::uint32_t target) {
+    const Eigen::Vector<Scalar, NDim> error = measurement.mean - cell_mean;
+    const Eigen::Matrix<Scalar, NDim, NDim> inverse = (measurement.covariance + cell_covariance).inverse();
+    for (int i = 0; i < NDim; ++i) {
+      errors_[static_cast<std::size_t>(i)].push_back(error[i]);
+    }
+    std::size_t component = 0;
+    for (int i = 0; i < NDim; ++i) {
+      for (int j = i; j < NDim; ++j) {
+        inverses_[component++].push_back(inverse(i, j));
+      }
+    }
+    targets_.push_back(target);
+  }
+
+  /// Evaluates all pending terms, adding `d1 * exp(-d2 / 2 * e^T * S^-1 * e)` to each term target.
+  /**
+   * \param d1 Scaling parameter d1 in literature, used for scaling likelihoods.
+   * \param d2 Scaling parameter d2 in literature, used for scaling likelihoods.
+   * \param accumulators Output accumulators, indexed by the targets given to push_back().
+   */
+  void evaluate(double d1, double d2, std::vector<double>& accumulators) const {
+    const auto size = static_cast<Eigen::Index>(targets_.size());
+    const auto component = [size](const std::vector<Scalar>& data) {
+      return Eigen::Map<const Eigen::Array<Scalar, Eigen::Dynamic, 1> >(data.data(), size);
+    };
+    Eigen::Array<Scalar, Eigen::Dynamic, 1> quadratic_forms;
+    const auto ex = component(errors_[0]);
+    const auto ey = component(errors_[1]);
+    if constexpr (NDim == 2) {
+      quadratic_forms = component(inverses_[0]) * ex.square() +          //
+                        Scalar{2} * component(inverses_[1]) * ex * ey +  //
+                        component(inverses_[2]) * ey.square();
+    } else {
+      const auto ez = component(errors_[2]);
+      quadratic_forms = component(inverses_[0]) * ex.square() +            //
+                        component(inverses_[3]) * ey.square() +            //
+                        component(inverses_[5]) * ez.square() +            //
+                        Scalar{2} * (component(inverses_[1]) * ex * ey +   //
+                                     component(inverses_[2]) * ex * ez +   //
+                                     component(inverses_[4]) * ey * ez);
+    }
+    const Eigen::Array<Scalar, Eigen::Dynamic, 1> values =
+        static_cast<Scalar>(d1) * (static_cast<Scalar>(-d2 / 2.0) * quadratic_forms).exp();
+    for (Eigen::Index i = 0; i < size; ++i) {
+      accumulators[targets_[static_cast<std::size_t>(i)]] += values[i];
+    }
+  }
+
+ private:
+  static constexpr std::size_t kNumUniqueEntries = static_cast<std::size_t>(NDim * (NDim + 1) / 2);
+
+  std::array<std::vector<Scalar>, NDim> errors_;
+  std::array<std::vector<Scalar>, kNumUniqueEntries> inverses_;
+  std::vector<std::uint32_t> targets_;
+};
+
+/// Detects map types that support capacity reservation, like hash based maps do.
+template <class Map, class = void>
+struct has_reserve : std::false_type {};
+
+/// Specialization for map types providing `reserve(size_type)`.
+template <class Map>
+struct has_reserve<Map, std::void_t<decltype(std::declval<Map&>().reserve(std::size_t{}))>> : std::true_type {};
+
+/// Convenience template variable for beluga::detail::has_reserve.
+template <class Map>
+inline constexpr bool has_reserve_v = has_reserve<Map>::value;
+
 /// Fit a vector of points to an NDT cell, by computing its mean and covariance.
 template <int NDim, typename Scalar = double>
 inline NDTCell<NDim, Scalar> fit_points(const std::vector<Eigen::Vector<Scalar, NDim> >& points) {
@@ -148,6 +484,39 @@ get_default_neighbors_kernel() {
 
 }  // namespace detail
 
+namespace io {
+
+/// Header of the flat binary NDT map format.
+/**
+ * The header is followed by three packed arrays, in order: cell means
+ * (`num_cells` x `num_dim` doubles), cell covariances (`num_cells` x
+ * `num_dim` x `num_dim` doubles, column-major), and cell indices
+ * (`num_cells` x `num_dim` 32 bit integers). All fields are stored in
+ * host byte order and naturally aligned, so a loader can map the file
+ * read-only and view the arrays in place without parsing or copying.
+ */
+struct NDTBinaryMapHeader {
+  /// Expected value for the `magic` field.
+  static constexpr std::array<char, 8> kMagic = {'B', 'E', 'L', 'U', 'G', 'N', 'D', 'T'};
+  /// Expected value for the `version` field.
+  static constexpr std::uint32_t kVersion = 1;
+
+  /// File signature, identifying the format.
+  std::array<char, 8> magic = kMagic;
+  /// Format version, bumped on layout changes.
+  std::uint32_t version = kVersion;
+  /// Number of dimensions of the map cells (2 or 3).
+  std::uint32_t num_dim = 0;
+  /// Number of cells in the map.
+  std::uint64_t num_cells = 0;
+  /// Resolution of the discrete grid.
+  double resolution = 0.0;
+};
+
+static_assert(sizeof(NDTBinaryMapHeader) == 32, "The NDT binary map header must be packed.");
+
+}  // namespace io
+
 /// Parameters used to construct a NDTSensorModel instance.
 template <int NDim>
 struct NDTModelParam {
@@ -161,6 +530,28 @@ struct NDTModelParam {
   /// Neighbor kernel used for likelihood computation.
   std::conditional_t<NDim == 2, std::vector<Eigen::Vector2i>, std::vector<Eigen::Vector3i> > neighbors_kernel =
       detail::get_default_neighbors_kernel<NDim>();
+  /// Allocation placement hints applied to the pooled cell storage when a map is loaded.
+  /**
+   * Large 3D maps make the flattened mean and covariance arrays big enough for page
+   * placement to matter; huge page backing and NUMA interleaving reduce TLB misses and
+   * cross-node traffic during parallel reweighting. Best-effort: unsupported hints
+   * degrade to no-ops. See beluga::MemoryHints.
+   */
+  beluga::MemoryHints memory_hints;
+  /// Whether to build a coarse map level when a map is loaded.
+  /**
+   * The coarse level merges neighboring cell gaussians into one per coarse cell, so
+   * large candidate sets (e.g. global relocalization seeds) can be ranked against a
+   * far smaller map before the survivors are scored at full resolution. See
+   * NDTSensorModel::score_candidates().
+   */
+  bool build_coarse_map = false;
+  /// Per-axis cell merge factor of the coarse map level.
+  /**
+   * A factor of 2 merges 2x2 fine cells per coarse cell in 2D and 2x2x2 in 3D.
+   * Values below 2 are clamped to 2.
+   */
+  int coarse_map_factor = 2;
 };
 
 /// Convenience alias for a 2d parameters struct for the NDT sensor model.
@@ -205,8 +596,75 @@ class NDTSensorModel {
    * particles.
    */
   NDTSensorModel(param_type params, SparseGridT cells_data)
-      : params_{std::move(params)}, cells_data_{std::move(cells_data)} {
+      : NDTSensorModel{std::move(params), std::make_shared<const SparseGridT>(std::move(cells_data))} {}
+
+  /// Constructs a NDTSensorModel instance from a shared map handle.
+  /**
+   * \param params Parameters to configure this instance.
+   *  See beluga::NDTModelParam for details.
+   * \param cells_data Shared handle to an immutable sparse grid representing an NDT map.
+   *  Model instances constructed from the same handle share one map instead of each
+   *  holding a duplicate, which matters for large 3D maps.
+   */
+  NDTSensorModel(param_type params, std::shared_ptr<const SparseGridT> cells_data)
+      : params_{std::move(params)},
+        cells_data_{std::move(cells_data)},
+        cells_pool_{make_cells_pool(*cells_data_, params_)},
+        coarse_cells_data_{make_coarse_map(*cells_data_, params_)} {
     assert(params_.minimum_likelihood >= 0);
+    assert(cells_data_ != nullptr);
+  }
+
+  /// Constructs a NDTSensorModel instance over an externally mapped cell pool.
+  /**
+   * Attaches to a segment published through io::save_to_shared_memory() by another
+   * process on the same host. The gaussian payloads are read in place from the mapped
+   * segment and only the cell-to-index map is built privately, so cooperating
+   * processes share one copy of the heavy arrays instead of each holding a duplicate.
+   * cells_data() exposes an empty grid holding only the map resolution for instances
+   * constructed this way, and no coarse map level is built.
+   *
+   * \param params Parameters to configure this instance. See beluga::NDTModelParam
+   *  for details. Memory placement hints do not apply to mapped storage and are
+   *  ignored, but prefault and lock-in-memory requests are honored per process.
+   * \param region Shared memory region mapping the segment to attach to.
+   * \throw std::invalid_argument If the segment does not hold an NDT map of matching
+   *  dimensionality.
+   */
+  NDTSensorModel(param_type params, SharedMemoryRegion&& region)
+      : params_{std::move(params)},
+        cells_data_{std::make_shared<const SparseGridT>(
+            typename SparseGridT::map_type{},
+            validate_mapped_segment(region).resolution)},
+        cells_pool_{make_mapped_cells_pool(std::move(region), params_)} {
+    static_assert(
+        std::is_same_v<typename ndt_cell_type::scalar_type, double>,
+        "Shared memory NDT maps store double precision gaussians.");
+    assert(params_.minimum_likelihood >= 0);
+  }
+
+  /// Returns the shared handle to the immutable NDT map.
+  /**
+   * Further model instances constructed from this handle share the map with this one.
+   */
+  [[nodiscard]] const std::shared_ptr<const SparseGridT>& cells_data() const { return cells_data_; }
+
+  /// Update the sensor model with a new map.
+  /**
+   * \param map New sparse grid representing an NDT map.
+   */
+  void update_map(map_type&& map) {
+    cells_data_ = std::make_shared<const SparseGridT>(std::move(map));
+    cells_pool_ = make_cells_pool(*cells_data_, params_);
+    coarse_cells_data_ = make_coarse_map(*cells_data_, params_);
+  }
+
+  /// Overload that swaps in an already shared map handle without copying the map.
+  void update_map(std::shared_ptr<const SparseGridT> map) {
+    assert(map != nullptr);
+    cells_data_ = std::move(map);
+    cells_pool_ = make_cells_pool(*cells_data_, params_);
+    coarse_cells_data_ = make_coarse_map(*cells_data_, params_);
   }
 
   /// Returns a state weighting function conditioned on 2D / 3D lidar hits.
@@ -217,30 +675,270 @@ class NDTSensorModel {
    */
   [[nodiscard]] auto operator()(measurement_type&& points) const {
     return [this, cells = detail::to_cells<ndt_cell_type::num_dim, typename ndt_cell_type::scalar_type>(
-                      points, cells_data_.resolution())](const state_type& state) -> weight_type {
-      return std::transform_reduce(
-          cells.cbegin(), cells.cend(), 1.0, std::plus{},
-          [this, state](const ndt_cell_type& ndt_cell) { return likelihood_at(state * ndt_cell); });
+                      points, cells_data_->resolution())](const state_type& state) -> weight_type {
+      static thread_local std::vector<ndt_cell_type> transformed_cells;
+      transformed_cells.clear();
+      transformed_cells.reserve(cells.size());
+      for (const auto& ndt_cell : cells) {
+        transformed_cells.push_back(state * ndt_cell);
+      }
+      return 1.0 + likelihood_sum_at(transformed_cells);
+    };
+  }
+
+  /// Returns the sum of likelihood_at() over a batch of measurements, probing the map in Morton order.
+  /**
+   * Equivalent to adding up likelihood_at() for each measurement, but all map probes for the batch are
+   * first sorted by the Morton code of their target cell, so consecutive lookups land on spatially (and
+   * thus memory) adjacent cells instead of hopping around the map in scan order. Probes go through the
+   * pooled cell storage (see beluga::detail::NDTCellIndexPool), whose Morton ordered gaussian arrays the
+   * sorted loop reads almost sequentially. Matched terms are then evaluated through a vectorized batch
+   * kernel (see beluga::detail::NDTLikelihoodBatch), so results can differ from the scalar path by
+   * floating point rounding.
+   */
+  [[nodiscard]] double likelihood_sum_at(const std::vector<ndt_cell_type>& measurements) const {
+    struct Probe {
+      std::uint64_t morton_key;
+      typename map_type::key_type cell;
+      std::uint32_t measurement_index;
     };
+    static thread_local std::vector<Probe> probes;
+    static thread_local std::vector<double> likelihoods;
+    probes.clear();
+    probes.reserve(measurements.size() * params_.neighbors_kernel.size());
+    for (std::uint32_t index = 0; index < measurements.size(); ++index) {
+      const typename map_type::key_type measurement_cell = cells_data_->cell_near(measurements[index].mean);
+      for (const auto& offset : params_.neighbors_kernel) {
+        const typename map_type::key_type cell = measurement_cell + offset;
+        probes.push_back(Probe{detail::morton_code<ndt_cell_type::num_dim>(cell), cell, index});
+      }
+    }
+    std::sort(probes.begin(), probes.end(), [](const Probe& lhs, const Probe& rhs) {
+      return lhs.morton_key < rhs.morton_key;
+    });
+    static thread_local detail::NDTLikelihoodBatch<ndt_cell_type::num_dim, typename ndt_cell_type::scalar_type> batch;
+    batch.clear();
+    batch.reserve(probes.size());
+    for (const auto& probe : probes) {
+      const auto maybe_index = cells_pool_->index_at(probe.cell);
+      if (maybe_index.has_value()) {
+        batch.push_back(
+            cells_pool_->mean_at(*maybe_index), cells_pool_->covariance_at(*maybe_index),
+            measurements[probe.measurement_index], probe.measurement_index);
+      }
+    }
+    likelihoods.assign(measurements.size(), 0.0);
+    batch.evaluate(params_.d1, params_.d2, likelihoods);
+    return std::transform_reduce(
+        likelihoods.cbegin(), likelihoods.cend(), 0.0, std::plus{},
+        [this](double likelihood) { return std::max(likelihood, params_.minimum_likelihood); });
   }
 
   /// Returns the L2 likelihood scaled by 'd1' and 'd2' set in the parameters for this instance for 'measurement', for
   /// the neighbors kernel cells around the measurement cell, or 'params_.min_likelihood', whichever is higher.
   [[nodiscard]] double likelihood_at(const ndt_cell_type& measurement) const {
     double likelihood = 0;
-    const typename map_type::key_type measurement_cell = cells_data_.cell_near(measurement.mean);
+    const typename map_type::key_type measurement_cell = cells_data_->cell_near(measurement.mean);
     for (const auto& offset : params_.neighbors_kernel) {
-      const auto maybe_ndt = cells_data_.data_at(measurement_cell + offset);
-      if (maybe_ndt.has_value()) {
-        likelihood += maybe_ndt->likelihood_at(measurement, params_.d1, params_.d2);
+      // Probe the pooled storage rather than the sparse grid, so the scalar path
+      // stays consistent with the batch path and works on externally mapped pools.
+      const auto maybe_index = cells_pool_->index_at(measurement_cell + offset);
+      if (maybe_index.has_value()) {
+        const ndt_cell_type cell{cells_pool_->mean_at(*maybe_index), cells_pool_->covariance_at(*maybe_index)};
+        likelihood += cell.likelihood_at(measurement, params_.d1, params_.d2);
       }
     }
     return std::max(likelihood, params_.minimum_likelihood);
   }
 
+  /// Returns whether a coarse map level is available (see NDTModelParam::build_coarse_map).
+  [[nodiscard]] bool has_coarse_map() const { return coarse_cells_data_ != nullptr; }
+
+  /// Returns the likelihood of `measurement` against the coarse map level.
+  /**
+   * Probes only the coarse cell containing the measurement: the merged gaussians are
+   * wide enough to cover what the fine level reaches through its neighbors kernel, so
+   * the coarse score costs one map lookup per measurement. Must not be called unless
+   * has_coarse_map() returns true.
+   */
+  [[nodiscard]] double coarse_likelihood_at(const ndt_cell_type& measurement) const {
+    assert(coarse_cells_data_ != nullptr);
+    const auto cell = coarse_cells_data_->data_near(measurement.mean);
+    if (!cell.has_value()) {
+      return params_.minimum_likelihood;
+    }
+    return std::max(cell->likelihood_at(measurement, params_.d1, params_.d2), params_.minimum_likelihood);
+  }
+
+  /// Scores localization candidates coarse-first, refining only the most promising ones.
+  /**
+   * Intended for global relocalization, where enormous candidate sets make evaluating
+   * every state against the full-resolution map the dominant cost. All candidates are
+   * first ranked with one coarse-level lookup per measurement cell; only the best
+   * `refine_fraction` of them (at least one) are then scored at full resolution.
+   * Without a coarse map level every candidate is scored at full resolution.
+   *
+   * \param points Lidar hit points in the reference frame of candidate states.
+   * \param candidates Candidate states to score.
+   * \param refine_fraction Fraction of candidates surviving the coarse pass, in (0, 1].
+   * \return One weight per candidate: full-resolution weights for the survivors, zero
+   *  for candidates pruned by the coarse pass. Pruned candidates rank below every
+   *  survivor by construction, so zero preserves the ordering that matters.
+   */
+  [[nodiscard]] std::vector<weight_type> score_candidates(
+      const measurement_type& points,
+      const std::vector<state_type>& candidates,
+      double refine_fraction = 0.1) const {
+    auto weights = std::vector<weight_type>(candidates.size(), 0.0);
+    if (candidates.empty()) {
+      return weights;
+    }
+    const auto cells = detail::to_cells<ndt_cell_type::num_dim, typename ndt_cell_type::scalar_type>(
+        points, cells_data_->resolution());
+    std::vector<ndt_cell_type> transformed_cells;
+    transformed_cells.reserve(cells.size());
+    const auto transform_into = [&](const state_type& state) -> const std::vector<ndt_cell_type>& {
+      transformed_cells.clear();
+      for (const auto& ndt_cell : cells) {
+        transformed_cells.push_back(state * ndt_cell);
+      }
+      return transformed_cells;
+    };
+    if (coarse_cells_data_ == nullptr) {
+      for (std::size_t index = 0; index < candidates.size(); ++index) {
+        weights[index] = 1.0 + likelihood_sum_at(transform_into(candidates[index]));
+      }
+      return weights;
+    }
+    std::vector<double> coarse_scores(candidates.size());
+    for (std::size_t index = 0; index < candidates.size(); ++index) {
+      double score = 0.0;
+      for (const auto& ndt_cell : transform_into(candidates[index])) {
+        score += coarse_likelihood_at(ndt_cell);
+      }
+      coarse_scores[index] = score;
+    }
+    const auto survivor_count = std::min(
+        candidates.size(),
+        std::max<std::size_t>(
+            1U, static_cast<std::size_t>(std::lround(refine_fraction * static_cast<double>(candidates.size())))));
+    std::vector<std::size_t> order(candidates.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::nth_element(
+        order.begin(), order.begin() + static_cast<std::ptrdiff_t>(survivor_count - 1U), order.end(),
+        [&coarse_scores](std::size_t lhs, std::size_t rhs) { return coarse_scores[lhs] > coarse_scores[rhs]; });
+    for (std::size_t rank = 0; rank < survivor_count; ++rank) {
+      const auto index = order[rank];
+      weights[index] = 1.0 + likelihood_sum_at(transform_into(candidates[index]));
+    }
+    return weights;
+  }
+
  private:
+  /// Builds the coarse map level for a grid, merging neighboring cell gaussians.
+  /**
+   * Each coarse cell combines the gaussians of the fine cells it covers by moment
+   * matching: the merged mean is the average of the fine means and the merged
+   * covariance adds their spread, so the coarse gaussian covers everything its fine
+   * cells cover. Returns nullptr when the level is disabled or the grid is empty
+   * (including maps attached through shared memory, whose cells are not enumerable).
+   */
+  [[nodiscard]] static std::shared_ptr<const SparseGridT> make_coarse_map(
+      const SparseGridT& grid,
+      const param_type& params) {
+    if (!params.build_coarse_map || grid.size() == 0U) {
+      return nullptr;
+    }
+    constexpr int kNumDim = ndt_cell_type::num_dim;
+    using scalar_type = typename ndt_cell_type::scalar_type;
+    const int factor = std::max(params.coarse_map_factor, 2);
+    const auto floor_div = [factor](int value) {
+      return value >= 0 ? value / factor : -((-value + factor - 1) / factor);
+    };
+    struct MergedMoments {
+      Eigen::Vector<scalar_type, kNumDim> mean_sum = Eigen::Vector<scalar_type, kNumDim>::Zero();
+      Eigen::Matrix<scalar_type, kNumDim, kNumDim> second_moment_sum =
+          Eigen::Matrix<scalar_type, kNumDim, kNumDim>::Zero();
+      std::size_t count = 0;
+    };
+    std::unordered_map<typename SparseGridT::key_type, MergedMoments, detail::CellHasher<kNumDim>> accumulators;
+    for (const auto& [cell, ndt_cell] : grid.data()) {
+      auto& moments = accumulators[cell.unaryExpr(floor_div)];
+      moments.mean_sum += ndt_cell.mean;
+      moments.second_moment_sum += ndt_cell.covariance + ndt_cell.mean * ndt_cell.mean.transpose();
+      ++moments.count;
+    }
+    typename SparseGridT::map_type coarse_map;
+    if constexpr (detail::has_reserve_v<typename SparseGridT::map_type>) {
+      coarse_map.reserve(accumulators.size());
+    }
+    for (const auto& [cell, moments] : accumulators) {
+      const auto count = static_cast<scalar_type>(moments.count);
+      const Eigen::Vector<scalar_type, kNumDim> mean = moments.mean_sum / count;
+      const Eigen::Matrix<scalar_type, kNumDim, kNumDim> covariance =
+          moments.second_moment_sum / count - mean * mean.transpose();
+      coarse_map[cell] = ndt_cell_type{mean, covariance};
+    }
+    return std::make_shared<const SparseGridT>(std::move(coarse_map), grid.resolution() * factor);
+  }
+
+  /// Builds the flattened cell pool for a grid, applying the configured allocation hints.
+  [[nodiscard]] static std::shared_ptr<const detail::NDTCellIndexPool<SparseGridT>> make_cells_pool(
+      const SparseGridT& grid,
+      const param_type& params) {
+    auto pool = std::make_shared<detail::NDTCellIndexPool<SparseGridT>>(grid);
+    pool->apply_memory_hints(params.memory_hints);
+    return pool;
+  }
+
+  /// Validates that `region` holds a shared memory NDT map of matching dimensionality.
+  [[nodiscard]] static const io::NDTBinaryMapHeader& validate_mapped_segment(const SharedMemoryRegion& region) {
+    constexpr int kNumDim = ndt_cell_type::num_dim;
+    const auto* header = static_cast<const io::NDTBinaryMapHeader*>(region.data());
+    bool valid = region.size() >= sizeof(io::NDTBinaryMapHeader) &&
+                 header->magic == io::NDTBinaryMapHeader::kMagic &&
+                 header->version == io::NDTBinaryMapHeader::kVersion && header->num_dim == kNumDim;
+    if (valid) {
+      const std::size_t expected_size =
+          sizeof(io::NDTBinaryMapHeader) +
+          header->num_cells * (kNumDim * sizeof(double) + kNumDim * kNumDim * sizeof(double) +  //
+                               kNumDim * sizeof(std::int32_t));
+      valid = region.size() == expected_size;
+    }
+    if (!valid) {
+      std::stringstream ss;
+      ss << "Shared memory segment " << region.name() << " does not hold an NDT map";
+      throw std::invalid_argument(ss.str());
+    }
+    return *header;
+  }
+
+  /// Builds a cell pool viewing the arrays of a shared memory NDT map segment in place.
+  [[nodiscard]] static std::shared_ptr<const detail::NDTCellIndexPool<SparseGridT>> make_mapped_cells_pool(
+      SharedMemoryRegion&& region,
+      const param_type& params) {
+    constexpr int kNumDim = ndt_cell_type::num_dim;
+    const auto& header = validate_mapped_segment(region);
+    const auto num_cells = static_cast<std::size_t>(header.num_cells);
+    const auto* bytes = static_cast<const char*>(region.data());
+    const auto* means = reinterpret_cast<const double*>(bytes + sizeof(io::NDTBinaryMapHeader));
+    const auto* covariances = means + num_cells * kNumDim;
+    const auto* cells = reinterpret_cast<const std::int32_t*>(covariances + num_cells * kNumDim * kNumDim);
+    auto pool = std::make_shared<detail::NDTCellIndexPool<SparseGridT>>(
+        means, covariances, cells, num_cells, std::make_shared<const SharedMemoryRegion>(std::move(region)));
+    pool->apply_memory_hints(params.memory_hints);
+    return pool;
+  }
+
   const param_type params_;
-  const SparseGridT cells_data_;
+  /// Immutable NDT cell map, shared across model copies (e.g. one per member of a filter
+  /// ensemble) instead of being duplicated per instance.
+  std::shared_ptr<const SparseGridT> cells_data_;
+  /// Flattened pool view of `cells_data_`, rebuilt whenever the map handle changes and
+  /// likewise shared across model copies.
+  std::shared_ptr<const detail::NDTCellIndexPool<SparseGridT>> cells_pool_;
+  /// Coarse map level, or nullptr when disabled; rebuilt whenever the map handle changes.
+  std::shared_ptr<const SparseGridT> coarse_cells_data_;
 };
 
 namespace io {
@@ -253,6 +951,10 @@ namespace io {
 ///   of the cell.
 /// - "covariances": (NUM_CELLS, 2 / 3, 2 / 3) Contains the covariance for each cell.
 ///
+/// The datasets are streamed in fixed-size chunks through hyperslab selections and
+/// inserted into the grid as they arrive, so peak memory stays bounded by one chunk
+/// plus the grid itself instead of three full-size dataset copies.
+///
 ///  \tparam NDTMapRepresentation A specialized SparseValueGrid (see sensor/data/sparse_value_grid.hpp), where
 ///  mapped_type == NDTCell2d / NDTCell3d, that will represent the NDT map as a mapping from 2D / 3D cells to NDTCells.
 template <typename NDTMapRepresentationT>
@@ -265,6 +967,7 @@ NDTMapRepresentationT load_from_hdf5(const std::filesystem::path& path_to_hdf5_f
       std::is_same_v<typename NDTMapRepresentationT::key_type, Eigen::Vector3i>);
 
   constexpr int kNumDim = NDTMapRepresentationT::key_type::RowsAtCompileTime;
+  constexpr auto kDim = static_cast<std::size_t>(kNumDim);
   if (!std::filesystem::exists(path_to_hdf5_file) || std::filesystem::is_directory(path_to_hdf5_file)) {
     std::stringstream ss;
     ss << "Couldn't find a valid HDF5 file at " << path_to_hdf5_file;
@@ -279,37 +982,273 @@ NDTMapRepresentationT load_from_hdf5(const std::filesystem::path& path_to_hdf5_f
 
   std::array<hsize_t, 2> dims_out;
   means_dataset.getSpace().getSimpleExtentDims(dims_out.data(), nullptr);
+  const auto num_cells = dims_out[0];
 
-  // The static cast is necessary because hsize_t and size_t are not the same in all platforms.
-  const std::array<std::size_t, 2> dims{
-      static_cast<std::size_t>(dims_out[0]),
-      static_cast<std::size_t>(dims_out[1]),
-  };
+  double resolution;
+  resolution_dataset.read(&resolution, H5::PredType::NATIVE_DOUBLE);
+
+  typename NDTMapRepresentationT::map_type map{};
 
-  Eigen::Matrix<double, kNumDim, Eigen::Dynamic> means_matrix(dims[1], dims[0]);
-  Eigen::Matrix<int, kNumDim, Eigen::Dynamic> cells_matrix(dims[1], dims[0]);
+  if constexpr (detail::has_reserve_v<typename NDTMapRepresentationT::map_type>) {
+    // The HDF5 cell count is known upfront, avoid rehashing while loading.
+    map.reserve(static_cast<std::size_t>(num_cells));
+  }
 
-  means_dataset.read(means_matrix.data(), H5::PredType::NATIVE_DOUBLE);
-  cells_dataset.read(cells_matrix.data(), H5::PredType::NATIVE_INT);
+  constexpr hsize_t kChunkSize = 4096;
+  std::vector<double> means_buffer(kChunkSize * kDim);
+  std::vector<int> cells_buffer(kChunkSize * kDim);
+  std::vector<double> covariances_buffer(kChunkSize * kDim * kDim);
 
-  std::vector<Eigen::Array<double, kNumDim, kNumDim> > covariances(dims[0]);
-  covariances_dataset.read(covariances.data(), H5::PredType::NATIVE_DOUBLE);
+  H5::DataSpace means_space = means_dataset.getSpace();
+  H5::DataSpace cells_space = cells_dataset.getSpace();
+  H5::DataSpace covariances_space = covariances_dataset.getSpace();
 
-  double resolution;
+  for (hsize_t offset = 0; offset < num_cells; offset += kChunkSize) {
+    const hsize_t count = std::min(kChunkSize, num_cells - offset);
 
-  resolution_dataset.read(&resolution, H5::PredType::NATIVE_DOUBLE);
+    const std::array<hsize_t, 2> plane_start = {offset, 0};
+    const std::array<hsize_t, 2> plane_count = {count, static_cast<hsize_t>(kDim)};
+    const H5::DataSpace plane_memory{2, plane_count.data()};
+    means_space.selectHyperslab(H5S_SELECT_SET, plane_count.data(), plane_start.data());
+    means_dataset.read(means_buffer.data(), H5::PredType::NATIVE_DOUBLE, plane_memory, means_space);
+    cells_space.selectHyperslab(H5S_SELECT_SET, plane_count.data(), plane_start.data());
+    cells_dataset.read(cells_buffer.data(), H5::PredType::NATIVE_INT, plane_memory, cells_space);
 
-  typename NDTMapRepresentationT::map_type map{};
+    const std::array<hsize_t, 3> cube_start = {offset, 0, 0};
+    const std::array<hsize_t, 3> cube_count = {count, static_cast<hsize_t>(kDim), static_cast<hsize_t>(kDim)};
+    const H5::DataSpace cube_memory{3, cube_count.data()};
+    covariances_space.selectHyperslab(H5S_SELECT_SET, cube_count.data(), cube_start.data());
+    covariances_dataset.read(covariances_buffer.data(), H5::PredType::NATIVE_DOUBLE, cube_memory, covariances_space);
 
-  // Note: Ranges::zip_view doesn't seem to work in old Eigen.
-  for (size_t i = 0; i < covariances.size(); ++i) {
-    map[cells_matrix.col(static_cast<Eigen::Index>(i))] =
-        NDTCell<kNumDim, double>{means_matrix.col(static_cast<Eigen::Index>(i)), covariances.at(i)};
+    for (std::size_t i = 0; i < static_cast<std::size_t>(count); ++i) {
+      const Eigen::Map<const Eigen::Vector<double, kNumDim> > mean(means_buffer.data() + i * kDim);
+      // Covariances are symmetric, so reading the row-major dataset through a
+      // column-major map is equivalent to reading its transpose.
+      const Eigen::Map<const Eigen::Matrix<double, kNumDim, kNumDim> > covariance(
+          covariances_buffer.data() + i * kDim * kDim);
+      const Eigen::Map<const Eigen::Vector<int, kNumDim> > cell(cells_buffer.data() + i * kDim);
+      map[cell] = NDTCell<kNumDim, double>{mean, covariance};
+    }
   }
 
   return NDTMapRepresentationT{std::move(map), resolution};
 }
 
+/// Loads an HDF5 NDT map representation in a background thread (see load_from_hdf5()).
+/**
+ * Returns immediately with a future for the fully loaded map, so configuration callbacks
+ * can kick off the load early and overlap it with the rest of their setup, blocking only
+ * when the map is first needed. Errors surface from the future when it is retrieved.
+ *
+ *  \tparam NDTMapRepresentation A specialized SparseValueGrid (see sensor/data/sparse_value_grid.hpp), where
+ *  mapped_type == NDTCell2d / NDTCell3d, that will represent the NDT map as a mapping from 2D / 3D cells to NDTCells.
+ */
+template <typename NDTMapRepresentationT>
+std::future<NDTMapRepresentationT> load_from_hdf5_async(std::filesystem::path path_to_hdf5_file) {
+  return std::async(std::launch::async, [path = std::move(path_to_hdf5_file)]() {
+    return load_from_hdf5<NDTMapRepresentationT>(path);
+  });
+}
+
+/// Saves an NDT map representation to a flat binary file (see beluga::io::NDTBinaryMapHeader).
+/**
+ *  \tparam NDTMapRepresentation A specialized SparseValueGrid (see sensor/data/sparse_value_grid.hpp), where
+ *  mapped_type == NDTCell2d / NDTCell3d, that represents the NDT map as a mapping from 2D / 3D cells to NDTCells.
+ */
+template <typename NDTMapRepresentationT>
+void save_to_binary(const NDTMapRepresentationT& grid, const std::filesystem::path& path) {
+  constexpr int kNumDim = NDTMapRepresentationT::key_type::RowsAtCompileTime;
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    std::stringstream ss;
+    ss << "Couldn't open " << path << " for writing";
+    throw std::invalid_argument(ss.str());
+  }
+
+  NDTBinaryMapHeader header;
+  header.num_dim = kNumDim;
+  header.num_cells = grid.size();
+  header.resolution = grid.resolution();
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  for (const auto& [cell, ndt_cell] : grid.data()) {
+    file.write(reinterpret_cast<const char*>(ndt_cell.mean.data()), kNumDim * sizeof(double));
+  }
+  for (const auto& [cell, ndt_cell] : grid.data()) {
+    file.write(reinterpret_cast<const char*>(ndt_cell.covariance.data()), kNumDim * kNumDim * sizeof(double));
+  }
+  for (const auto& [cell, ndt_cell] : grid.data()) {
+    const Eigen::Vector<std::int32_t, kNumDim> index = cell.template cast<std::int32_t>();
+    file.write(reinterpret_cast<const char*>(index.data()), kNumDim * sizeof(std::int32_t));
+  }
+
+  if (!file) {
+    std::stringstream ss;
+    ss << "Failed writing NDT binary map to " << path;
+    throw std::invalid_argument(ss.str());
+  }
+}
+
+/// Loads an NDT map representation from a flat binary file (see beluga::io::NDTBinaryMapHeader).
+/**
+ * The file is memory mapped read-only and the cell arrays are read in
+ * place, so unlike load_from_hdf5() there is no parsing step and no
+ * intermediate buffers: the only allocation is the sparse grid itself,
+ * reserved upfront from the cell count in the header.
+ *
+ *  \tparam NDTMapRepresentation A specialized SparseValueGrid (see sensor/data/sparse_value_grid.hpp), where
+ *  mapped_type == NDTCell2d / NDTCell3d, that will represent the NDT map as a mapping from 2D / 3D cells to NDTCells.
+ */
+template <typename NDTMapRepresentationT>
+NDTMapRepresentationT load_from_binary(const std::filesystem::path& path) {
+  static_assert(
+      std::is_same_v<typename NDTMapRepresentationT::mapped_type, NDTCell2d> or
+      std::is_same_v<typename NDTMapRepresentationT::mapped_type, NDTCell3d>);
+  constexpr int kNumDim = NDTMapRepresentationT::key_type::RowsAtCompileTime;
+
+  if (!std::filesystem::exists(path) || std::filesystem::is_directory(path)) {
+    std::stringstream ss;
+    ss << "Couldn't find a valid NDT binary map file at " << path;
+    throw std::invalid_argument(ss.str());
+  }
+
+  const auto file_size = std::filesystem::file_size(path);
+  const int descriptor = ::open(path.c_str(), O_RDONLY);
+  if (descriptor < 0) {
+    std::stringstream ss;
+    ss << "Couldn't open NDT binary map file at " << path;
+    throw std::invalid_argument(ss.str());
+  }
+  void* address = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  ::close(descriptor);  // the mapping holds its own reference to the file
+  if (address == MAP_FAILED) {
+    std::stringstream ss;
+    ss << "Couldn't memory map NDT binary map file at " << path;
+    throw std::invalid_argument(ss.str());
+  }
+  const auto guard = std::unique_ptr<void, std::function<void(void*)> >{
+      address, [file_size](void* pointer) { ::munmap(pointer, file_size); }};
+
+  const auto* header = static_cast<const NDTBinaryMapHeader*>(address);
+  const std::size_t expected_size =
+      sizeof(NDTBinaryMapHeader) +
+      header->num_cells * (kNumDim * sizeof(double) + kNumDim * kNumDim * sizeof(double) +  //
+                           kNumDim * sizeof(std::int32_t));
+  if (file_size < sizeof(NDTBinaryMapHeader) || header->magic != NDTBinaryMapHeader::kMagic ||
+      header->version != NDTBinaryMapHeader::kVersion || header->num_dim != kNumDim || file_size != expected_size) {
+    std::stringstream ss;
+    ss << "Malformed NDT binary map file at " << path;
+    throw std::invalid_argument(ss.str());
+  }
+
+  const auto num_cells = static_cast<std::size_t>(header->num_cells);
+  const auto* bytes = static_cast<const char*>(address);
+  const auto* means = reinterpret_cast<const double*>(bytes + sizeof(NDTBinaryMapHeader));
+  const auto* covariances = means + num_cells * kNumDim;
+  const auto* cells = reinterpret_cast<const std::int32_t*>(covariances + num_cells * kNumDim * kNumDim);
+
+  typename NDTMapRepresentationT::map_type map{};
+  if constexpr (detail::has_reserve_v<typename NDTMapRepresentationT::map_type>) {
+    map.reserve(num_cells);
+  }
+  for (std::size_t i = 0; i < num_cells; ++i) {
+    const Eigen::Map<const Eigen::Vector<double, kNumDim> > mean(means + i * kNumDim);
+    const Eigen::Map<const Eigen::Matrix<double, kNumDim, kNumDim> > covariance(covariances + i * kNumDim * kNumDim);
+    const Eigen::Map<const Eigen::Vector<std::int32_t, kNumDim> > cell(cells + i * kNumDim);
+    map[cell.template cast<int>()] = NDTCell<kNumDim, double>{mean, covariance};
+  }
+  return NDTMapRepresentationT{std::move(map), header->resolution};
+}
+
+/// Saves an NDT map representation into a named shared memory segment.
+/**
+ * The segment uses the same layout as the flat binary map format (see
+ * beluga::io::NDTBinaryMapHeader), so attaching processes on the same host can view
+ * the cell arrays in place (see the NDTSensorModel shared memory constructor) instead
+ * of each holding a private copy of the map.
+ *
+ *  \tparam NDTMapRepresentation A specialized SparseValueGrid (see sensor/data/sparse_value_grid.hpp), where
+ *  mapped_type == NDTCell2d / NDTCell3d, that represents the NDT map as a mapping from 2D / 3D cells to NDTCells.
+ *  \param grid NDT map representation to publish.
+ *  \param name Segment name, starting with a slash (e.g. "/beluga_ndt_map").
+ *  \return The region owning the segment. Keep it alive for as long as other processes
+ *  should be able to attach; models already attached remain valid after it is
+ *  destroyed, but new processes can no longer attach.
+ */
+template <typename NDTMapRepresentationT>
+[[nodiscard]] SharedMemoryRegion save_to_shared_memory(const NDTMapRepresentationT& grid, const std::string& name) {
+  constexpr int kNumDim = NDTMapRepresentationT::key_type::RowsAtCompileTime;
+
+  NDTBinaryMapHeader header;
+  header.num_dim = kNumDim;
+  header.num_cells = grid.size();
+  header.resolution = grid.resolution();
+
+  const std::size_t size =
+      sizeof(header) + grid.size() * (kNumDim * sizeof(double) + kNumDim * kNumDim * sizeof(double) +  //
+                                      kNumDim * sizeof(std::int32_t));
+  auto region = SharedMemoryRegion::create(name, size);
+  auto* cursor = static_cast<char*>(region.data());
+  std::memcpy(cursor, &header, sizeof(header));
+  cursor += sizeof(header);
+  for (const auto& [cell, ndt_cell] : grid.data()) {
+    std::memcpy(cursor, ndt_cell.mean.data(), kNumDim * sizeof(double));
+    cursor += kNumDim * sizeof(double);
+  }
+  for (const auto& [cell, ndt_cell] : grid.data()) {
+    std::memcpy(cursor, ndt_cell.covariance.data(), kNumDim * kNumDim * sizeof(double));
+    cursor += kNumDim * kNumDim * sizeof(double);
+  }
+  for (const auto& [cell, ndt_cell] : grid.data()) {
+    const Eigen::Vector<std::int32_t, kNumDim> index = cell.template cast<std::int32_t>();
+    std::memcpy(cursor, index.data(), kNumDim * sizeof(std::int32_t));
+    cursor += kNumDim * sizeof(std::int32_t);
+  }
+  return region;
+}
+
+/// Converts an HDF5 NDT map file (see load_from_hdf5()) to the flat binary format (see load_from_binary()).
+/**
+ *  \tparam NDTMapRepresentation A specialized SparseValueGrid (see sensor/data/sparse_value_grid.hpp), where
+ *  mapped_type == NDTCell2d / NDTCell3d, that represents the NDT map as a mapping from 2D / 3D cells to NDTCells.
+ */
+template <typename NDTMapRepresentationT>
+void convert_hdf5_to_binary(
+    const std::filesystem::path& path_to_hdf5_file,
+    const std::filesystem::path& path_to_binary_file) {
+  save_to_binary(load_from_hdf5<NDTMapRepresentationT>(path_to_hdf5_file), path_to_binary_file);
+}
+
+/// Loads an NDT map representation from a file, dispatching on its extension.
+/**
+ * HDF5 sources (".hdf5", ".h5") go through load_from_hdf5(); anything else is
+ * assumed to be a compiled flat binary map (see load_from_binary()), so nodes
+ * can take either format through a single map path parameter.
+ *
+ *  \tparam NDTMapRepresentation A specialized SparseValueGrid (see sensor/data/sparse_value_grid.hpp), where
+ *  mapped_type == NDTCell2d / NDTCell3d, that will represent the NDT map as a mapping from 2D / 3D cells to NDTCells.
+ */
+template <typename NDTMapRepresentationT>
+NDTMapRepresentationT load_from_file(const std::filesystem::path& path) {
+  const auto extension = path.extension();
+  if (extension == ".hdf5" || extension == ".h5") {
+    return load_from_hdf5<NDTMapRepresentationT>(path);
+  }
+  return load_from_binary<NDTMapRepresentationT>(path);
+}
+
+/// Loads an NDT map representation from a file in a background thread (see load_from_file()).
+/**
+ *  \tparam NDTMapRepresentation A specialized SparseValueGrid (see sensor/data/sparse_value_grid.hpp), where
+ *  mapped_type == NDTCell2d / NDTCell3d, that will represent the NDT map as a mapping from 2D / 3D cells to NDTCells.
+ */
+template <typename NDTMapRepresentationT>
+std::future<NDTMapRepresentationT> load_from_file_async(std::filesystem::path path) {
+  return std::async(
+      std::launch::async, [path = std::move(path)]() { return load_from_file<NDTMapRepresentationT>(path); });
+}
+
 }  // namespace io
 
 }  // namespace beluga
@@ -0,0 +1,287 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_TESTING_SYNTHETIC_ENVIRONMENT_HPP
+#define BELUGA_TESTING_SYNTHETIC_ENVIRONMENT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <beluga/algorithm/raycasting.hpp>
+#include <beluga/sensor/data/occupancy_grid.hpp>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+/**
+ * \file
+ * \brief Deterministic synthetic occupancy grids and simulated scans for benchmarks and system tests.
+ *
+ * Hand-rolled fixture grids are too small to exercise the cache and TLB behavior of
+ * production-size maps. The generators in this file produce reproducible environments
+ * of arbitrary size (same parameters and seed, same grid) so performance work can be
+ * evaluated against representative inputs.
+ */
+
+namespace beluga::testing {
+
+/// A dynamically sized occupancy grid backed by a contiguous cell vector.
+/**
+ * Unlike beluga::testing::StaticOccupancyGrid, dimensions are runtime parameters,
+ * allowing grids far larger than what is reasonable to embed in a test binary.
+ */
+class SyntheticOccupancyGrid : public BaseOccupancyGrid2<SyntheticOccupancyGrid> {
+ public:
+  /// Cell state interpretation, with free and occupied states only.
+  struct ValueTraits {
+    /// \brief Returns whether the given cell value corresponds to a free cell.
+    [[nodiscard]] static bool is_free(bool value) { return !value; }
+    /// \brief Returns whether the given cell value corresponds to an unknown cell.
+    [[nodiscard]] static bool is_unknown(bool) { return false; }
+    /// \brief Returns whether the given cell value corresponds to an occupied cell.
+    [[nodiscard]] static bool is_occupied(bool value) { return value; }
+  };
+
+  /// Constructs a fully free grid of the given dimensions.
+  /**
+   * \param width Grid width in cells.
+   * \param height Grid height in cells.
+   * \param resolution Grid resolution in meters per cell.
+   * \param origin Transform from the grid local frame to the global frame.
+   */
+  SyntheticOccupancyGrid(
+      std::size_t width,
+      std::size_t height,
+      double resolution,
+      const Sophus::SE2d& origin = Sophus::SE2d{})
+      : grid_(width * height, false), width_{width}, height_{height}, resolution_{resolution}, origin_{origin} {}
+
+  /// \brief Returns the transform from the grid local frame to the global frame.
+  [[nodiscard]] const Sophus::SE2d& origin() const { return origin_; }
+
+  /// \brief Returns a mutable reference to the cell data.
+  [[nodiscard]] auto& data() { return grid_; }
+  /// \brief Returns a constant reference to the cell data.
+  [[nodiscard]] const auto& data() const { return grid_; }
+  /// \brief Returns the total number of cells.
+  [[nodiscard]] std::size_t size() const { return grid_.size(); }
+
+  /// \brief Returns the grid width in cells.
+  [[nodiscard]] std::size_t width() const { return width_; }
+  /// \brief Returns the grid height in cells.
+  [[nodiscard]] std::size_t height() const { return height_; }
+  /// \brief Returns the grid resolution in meters per cell.
+  [[nodiscard]] double resolution() const { return resolution_; }
+
+  /// \brief Returns the cell state interpretation instance.
+  [[nodiscard]] auto value_traits() const { return ValueTraits{}; }
+
+  /// Marks an axis-aligned cell rectangle as occupied, clipped to the grid bounds.
+  /**
+   * \param xmin Leftmost column of the rectangle.
+   * \param ymin Bottom row of the rectangle.
+   * \param xmax One past the rightmost column of the rectangle.
+   * \param ymax One past the top row of the rectangle.
+   */
+  void occupy_block(std::size_t xmin, std::size_t ymin, std::size_t xmax, std::size_t ymax) {
+    xmax = std::min(xmax, width_);
+    ymax = std::min(ymax, height_);
+    for (std::size_t yi = ymin; yi < ymax; ++yi) {
+      for (std::size_t xi = xmin; xi < xmax; ++xi) {
+        grid_[yi * width_ + xi] = true;
+      }
+    }
+  }
+
+ private:
+  std::vector<bool> grid_;
+  std::size_t width_;
+  std::size_t height_;
+  double resolution_;
+  Sophus::SE2d origin_;
+};
+
+/// Parameters to construct a synthetic occupancy grid.
+/**
+ * See beluga::testing::generate_corridor_grid(), beluga::testing::generate_warehouse_grid()
+ * and beluga::testing::generate_open_field_grid() for layout-specific semantics.
+ */
+struct SyntheticGridParams {
+  /// Grid width in cells.
+  std::size_t width = 1'000;
+  /// Grid height in cells.
+  std::size_t height = 1'000;
+  /// Grid resolution in meters per cell.
+  double resolution = 0.05;
+  /// Seed for the generator; equal parameters and seed always yield the same grid.
+  std::uint64_t seed = 42;
+  /// Characteristic structure size in cells (corridor width, shelf pitch, obstacle size).
+  std::size_t structure_size = 40;
+  /// Fraction of otherwise free cells turned into scattered obstacles, in [0, 1].
+  double clutter_density = 0.0;
+};
+
+namespace detail {
+
+/// Sprinkles isolated occupied cells over the free space of a synthetic grid.
+inline void scatter_clutter(SyntheticOccupancyGrid& grid, const SyntheticGridParams& params, std::mt19937_64& engine) {
+  if (params.clutter_density <= 0.0) {
+    return;
+  }
+  auto distribution = std::bernoulli_distribution{params.clutter_density};
+  auto& data = grid.data();
+  for (std::size_t index = 0; index < data.size(); ++index) {
+    if (!data[index] && distribution(engine)) {
+      data[index] = true;
+    }
+  }
+}
+
+/// Surrounds a synthetic grid with a one cell thick occupied border.
+inline void close_border(SyntheticOccupancyGrid& grid) {
+  grid.occupy_block(0, 0, grid.width(), 1);
+  grid.occupy_block(0, grid.height() - 1, grid.width(), grid.height());
+  grid.occupy_block(0, 0, 1, grid.height());
+  grid.occupy_block(grid.width() - 1, 0, grid.width(), grid.height());
+}
+
+}  // namespace detail
+
+/// Generates a grid of parallel corridors connected by randomly placed doorways.
+/**
+ * Horizontal corridors of `structure_size` cells alternate with one cell thick walls,
+ * each wall getting a doorway at a seed-determined column. The whole grid is enclosed
+ * by an occupied border.
+ *
+ * \param params Generation parameters, see beluga::testing::SyntheticGridParams.
+ * \return The generated grid.
+ */
+inline SyntheticOccupancyGrid generate_corridor_grid(const SyntheticGridParams& params) {
+  auto grid = SyntheticOccupancyGrid{params.width, params.height, params.resolution};
+  auto engine = std::mt19937_64{params.seed};
+  const std::size_t pitch = params.structure_size + 1;
+  const std::size_t doorway = std::max<std::size_t>(params.structure_size / 2, 1);
+  auto column_distribution = std::uniform_int_distribution<std::size_t>{1, params.width - doorway - 1};
+  for (std::size_t yi = pitch; yi + 1 < params.height; yi += pitch) {
+    grid.occupy_block(0, yi, params.width, yi + 1);
+    const std::size_t gap = column_distribution(engine);
+    auto& data = grid.data();
+    for (std::size_t xi = gap; xi < gap + doorway; ++xi) {
+      data[yi * params.width + xi] = false;
+    }
+  }
+  detail::scatter_clutter(grid, params, engine);
+  detail::close_border(grid);
+  return grid;
+}
+
+/// Generates a warehouse-like grid of regularly spaced rectangular shelf racks.
+/**
+ * Square racks of `structure_size` cells are laid out on a regular pattern separated
+ * by aisles of the same width, with the whole grid enclosed by an occupied border.
+ *
+ * \param params Generation parameters, see beluga::testing::SyntheticGridParams.
+ * \return The generated grid.
+ */
+inline SyntheticOccupancyGrid generate_warehouse_grid(const SyntheticGridParams& params) {
+  auto grid = SyntheticOccupancyGrid{params.width, params.height, params.resolution};
+  auto engine = std::mt19937_64{params.seed};
+  const std::size_t pitch = 2 * params.structure_size;
+  for (std::size_t yi = params.structure_size; yi + params.structure_size < params.height; yi += pitch) {
+    for (std::size_t xi = params.structure_size; xi + params.structure_size < params.width; xi += pitch) {
+      grid.occupy_block(xi, yi, xi + params.structure_size, yi + params.structure_size);
+    }
+  }
+  detail::scatter_clutter(grid, params, engine);
+  detail::close_border(grid);
+  return grid;
+}
+
+/// Generates a mostly empty grid, optionally sprinkled with scattered obstacles.
+/**
+ * All interior cells are free except for seed-determined clutter, making long rays
+ * traverse the largest possible number of cells before hitting the occupied border.
+ *
+ * \param params Generation parameters, see beluga::testing::SyntheticGridParams.
+ * \return The generated grid.
+ */
+inline SyntheticOccupancyGrid generate_open_field_grid(const SyntheticGridParams& params) {
+  auto grid = SyntheticOccupancyGrid{params.width, params.height, params.resolution};
+  auto engine = std::mt19937_64{params.seed};
+  detail::scatter_clutter(grid, params, engine);
+  detail::close_border(grid);
+  return grid;
+}
+
+/// Parameters to simulate a planar laser scan over a synthetic grid.
+struct SyntheticScanParams {
+  /// Number of evenly spaced beams in the scan.
+  std::size_t beam_count = 360;
+  /// Bearing of the first beam, in radians in the sensor frame.
+  double min_angle = -Sophus::Constants<double>::pi();
+  /// Bearing one past the last beam, in radians in the sensor frame.
+  double max_angle = Sophus::Constants<double>::pi();
+  /// Maximum simulated sensor range in meters; beams that hit nothing are dropped.
+  double max_range = 100.0;
+  /// Standard deviation of the additive Gaussian range noise, in meters.
+  double range_noise_std = 0.0;
+  /// Seed for the range noise; irrelevant when `range_noise_std` is zero.
+  std::uint64_t seed = 42;
+};
+
+/// Simulates a planar laser scan by raycasting over an occupancy grid.
+/**
+ * Beams are cast from the given pose at evenly spaced bearings; hits are returned as
+ * cartesian points in the sensor frame, directly usable as a measurement by the
+ * likelihood field family of sensor models. Beams that reach `max_range` without
+ * hitting an occupied cell are dropped, as a real sensor would report them out of range.
+ *
+ * \tparam OccupancyGrid A type that satisfies \ref OccupancyGrid2Page.
+ * \param grid Grid to cast beams through.
+ * \param pose Sensor pose in the grid global frame.
+ * \param params Simulation parameters, see beluga::testing::SyntheticScanParams.
+ * \return Hit points in the sensor frame.
+ */
+template <class OccupancyGrid>
+std::vector<std::pair<double, double>>
+simulate_scan(const OccupancyGrid& grid, const Sophus::SE2d& pose, const SyntheticScanParams& params) {
+  auto points = std::vector<std::pair<double, double>>{};
+  points.reserve(params.beam_count);
+  auto engine = std::mt19937_64{params.seed};
+  auto noise_distribution = std::normal_distribution<double>{0.0, params.range_noise_std};
+  const auto ray = Ray2d{grid, pose, params.max_range};
+  const double step = (params.max_angle - params.min_angle) / static_cast<double>(params.beam_count);
+  for (std::size_t beam = 0; beam < params.beam_count; ++beam) {
+    const double bearing = params.min_angle + static_cast<double>(beam) * step;
+    const auto range = ray.cast(Sophus::SO2d{bearing});
+    if (!range.has_value()) {
+      continue;
+    }
+    double measured_range = *range;
+    if (params.range_noise_std > 0.0) {
+      measured_range = std::max(measured_range + noise_distribution(engine), 0.0);
+    }
+    points.emplace_back(measured_range * std::cos(bearing), measured_range * std::sin(bearing));
+  }
+  return points;
+}
+
+}  // namespace beluga::testing
+
+#endif
@@ -15,6 +15,7 @@
 #ifndef BELUGA_TYPE_TRAITS_HPP
 #define BELUGA_TYPE_TRAITS_HPP
 
+#include <beluga/type_traits/executor_traits.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
 #include <beluga/type_traits/tuple_traits.hpp>
 
@@ -0,0 +1,62 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_TYPE_TRAITS_EXECUTOR_TRAITS_HPP
+#define BELUGA_TYPE_TRAITS_EXECUTOR_TRAITS_HPP
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \brief Implementation of traits for bulk executors.
+ *
+ * A bulk executor is an alternative to standard execution policies for the
+ * particle range actions. Any type with a `bulk_execute(range, fn)` member
+ * function qualifies, where `bulk_execute` invokes `fn` exactly once per
+ * element of `range`, in unspecified order and possibly concurrently, and
+ * returns once all invocations have completed.
+ */
+
+namespace beluga {
+
+namespace detail {
+
+/// Callable used to probe the `bulk_execute` interface of a candidate executor.
+struct bulk_executor_probe_fn {
+  void operator()(int&) const;
+};
+
+}  // namespace detail
+
+/// Meta-function that returns true if T satisfies the bulk executor interface.
+template <class T, class = void>
+struct is_bulk_executor : public std::false_type {};
+
+/// `is_bulk_executor` specialization for types providing a compatible `bulk_execute` member function.
+template <class T>
+struct is_bulk_executor<
+    T,
+    std::void_t<decltype(std::declval<T&>().bulk_execute(
+        std::declval<std::vector<int>&>(),
+        detail::bulk_executor_probe_fn{}))>> : public std::true_type {};
+
+/// Convenience template variable for `is_bulk_executor`.
+template <class T>
+inline constexpr bool is_bulk_executor_v = is_bulk_executor<T>::value;
+
+}  // namespace beluga
+
+#endif
@@ -63,6 +63,15 @@ struct has_weight<T, std::void_t<decltype(beluga::weight(std::declval<T>()))>> :
 template <class T>
 inline constexpr bool has_weight_v = has_weight<T>::value;
 
+template <class T, class = void>
+struct has_log_weight : public std::false_type {};
+
+template <class T>
+struct has_log_weight<T, std::void_t<decltype(beluga::log_weight(std::declval<T>()))>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_log_weight_v = has_log_weight<T>::value;
+
 template <class T, class = void>
 struct is_particle : public std::false_type {};
 
@@ -75,6 +84,19 @@ inline constexpr bool is_particle_v = is_particle<T>::value;
 template <class R>
 inline constexpr bool is_particle_range_v = is_particle_v<ranges::range_value_t<R>>;
 
+template <class T, class = void>
+struct is_log_weight_particle : public std::false_type {};
+
+template <class T>
+struct is_log_weight_particle<T, std::enable_if_t<std::conjunction_v<has_state<T>, has_log_weight<T>>>>
+    : std::true_type {};
+
+template <class T>
+inline constexpr bool is_log_weight_particle_v = is_log_weight_particle<T>::value;
+
+template <class R>
+inline constexpr bool is_log_weight_particle_range_v = is_log_weight_particle_v<ranges::range_value_t<R>>;
+
 /// \endcond
 
 namespace detail {
@@ -90,7 +112,7 @@ struct make_from_state_fn {
    * The new particle will have a weight equal to 1.
    */
   constexpr auto operator()(State value) const {
-    static_assert(is_particle_v<Particle>);
+    static_assert(is_particle_v<Particle> || is_log_weight_particle_v<Particle>);
     auto particle = []() {
       if constexpr (is_tuple_like_v<Particle>) {
         // Support for zipped ranges composed with views that don't
@@ -102,7 +124,11 @@ struct make_from_state_fn {
       }
     }();
     beluga::state(particle) = std::move(value);
-    beluga::weight(particle) = 1.0;
+    if constexpr (is_particle_v<Particle>) {
+      beluga::weight(particle) = 1.0;
+    } else {
+      beluga::log_weight(particle) = 0.0;
+    }
     return particle;
   }
 };
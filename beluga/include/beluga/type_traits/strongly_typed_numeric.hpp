@@ -84,6 +84,33 @@ class Numeric final {
   T value_{0};  // Underlying primitive type.
 };
 
+/// Trait yielding the underlying arithmetic type of a strongly typed numeric.
+/**
+ * Plain arithmetic types map to themselves, so generic code can recover the storage
+ * precision of a value (e.g. to narrow a double-precision accumulation back into a
+ * single-precision weight without implicit conversion warnings) regardless of whether
+ * the value is strongly typed.
+ *
+ * \tparam T A `Numeric` instantiation or a built-in arithmetic type.
+ */
+template <typename T>
+struct underlying_numeric {
+  static_assert(std::is_arithmetic_v<T>);
+  /// The underlying arithmetic type.
+  using type = T;
+};
+
+/// Specialization for `Numeric` types.
+template <typename T, typename PhantomType>
+struct underlying_numeric<Numeric<T, PhantomType>> {
+  /// The underlying arithmetic type.
+  using type = T;
+};
+
+/// Convenience template alias for `underlying_numeric`, after decaying `T`.
+template <typename T>
+using underlying_numeric_t = typename underlying_numeric<std::decay_t<T>>::type;
+
 }  // namespace beluga
 
 namespace std {
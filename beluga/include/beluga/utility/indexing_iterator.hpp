@@ -15,9 +15,14 @@
 #ifndef BELUGA_UTILITY_INDEXING_ITERATOR_HPP
 #define BELUGA_UTILITY_INDEXING_ITERATOR_HPP
 
+#include <array>
 #include <cstdint>
 #include <iterator>
+#include <memory>
 #include <type_traits>
+#include <vector>
+
+#include <range/v3/iterator/concepts.hpp>
 
 /**
  * \file
@@ -26,10 +31,47 @@
 
 namespace beluga {
 
+/// Trait for indexable container types whose subscript operator indexes directly into flat storage.
+/**
+ * A container `C` has a contiguous layout if `std::addressof(c[i]) == c.data() + i` holds for
+ * any valid index `i`. Standard vectors and arrays qualify out of the box, and other container
+ * types can opt in by defining a nested `contiguous_layout_tag` type. Note that exposing a
+ * `data()` member is not enough: beluga::CircularArray has one, but its subscript operator
+ * wraps around the underlying storage.
+ *
+ * \tparam Indexable Container type. It must support subscripting.
+ */
+template <class Indexable, class = void>
+struct has_contiguous_layout : std::false_type {};
+
+/// Specialization for container types that opt in through a nested `contiguous_layout_tag` type.
+template <class Indexable>
+struct has_contiguous_layout<Indexable, std::void_t<typename Indexable::contiguous_layout_tag>> : std::true_type {};
+
+/// Specialization for standard vectors.
+template <class T, class Allocator>
+struct has_contiguous_layout<std::vector<T, Allocator>> : std::true_type {};
+
+/// Specialization for standard vectors of booleans, which are bit-packed and yield proxy references.
+template <class Allocator>
+struct has_contiguous_layout<std::vector<bool, Allocator>> : std::false_type {};
+
+/// Specialization for standard arrays.
+template <class T, std::size_t N>
+struct has_contiguous_layout<std::array<T, N>> : std::true_type {};
+
+/// Convenience template variable for beluga::has_contiguous_layout. It sees through cv-qualifiers.
+template <class Indexable>
+inline constexpr bool has_contiguous_layout_v = has_contiguous_layout<std::remove_cv_t<Indexable>>::value;
+
 /// A random access iterator for any indexable container.
 /**
  * It can provide a pair of iterators for any container type that supports subscripting with an integral-like index.
  *
+ * For containers with a contiguous layout, as defined by the beluga::has_contiguous_layout trait,
+ * the iterator advertises contiguity through its category tag, allowing iterator machinery that
+ * understands `ranges::contiguous_iterator_tag` to lower bulk operations to plain memory copies.
+ *
  * \tparam Indexable Container type, potentially const. It must support subscripting.
  * \tparam Index Container index type. It must be default constructible and integral-like.
  * Defaults to the indexable container size type, if defined.
@@ -46,8 +88,13 @@ class IndexingIterator {
   using pointer = decltype(std::addressof(std::declval<Indexable>()[std::declval<Index>()]));
   /// Signed difference type of the iterator.
   using difference_type = std::make_signed_t<decltype(std::declval<Index>() - std::declval<Index>())>;
-  /// Category of the iterator.
-  using iterator_category = std::random_access_iterator_tag;
+  /// Category of the iterator. Contiguity is advertised when the target container has a flat layout.
+  using iterator_category = std::conditional_t<
+      has_contiguous_layout_v<Indexable>,
+      ranges::contiguous_iterator_tag,
+      std::random_access_iterator_tag>;
+  /// Iterator concept, for C++20 iterator machinery that reads it instead of the category.
+  using iterator_concept = iterator_category;
 
   /// Default constructor. Iterator will point nowhere.
   explicit IndexingIterator() = default;
@@ -149,9 +196,17 @@ class IndexingIterator {
 
   /// Dereferences iterator at its current position and yields a pointer to it.
   /**
-   * Behavior is undefined if the iterator is past the limits of the target container.
+   * For contiguous layouts the pointer is computed from the target container storage,
+   * so it remains well-defined for past-the-end iterators. Otherwise, behavior is
+   * undefined if the iterator is past the limits of the target container.
    */
-  [[nodiscard]] pointer operator->() const noexcept { return std::addressof((*indexable_)[cursor_]); }
+  [[nodiscard]] pointer operator->() const noexcept {
+    if constexpr (has_contiguous_layout_v<Indexable>) {
+      return indexable_->data() + static_cast<difference_type>(cursor_);
+    } else {
+      return std::addressof((*indexable_)[cursor_]);
+    }
+  }
 
   /// Checks if iterator position is strictly before that of another.
   /**
@@ -0,0 +1,299 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_UTILITY_MEMORY_HINTS_HPP
+#define BELUGA_UTILITY_MEMORY_HINTS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * \file
+ * \brief Implementation of best-effort allocation placement hints for large buffers.
+ */
+
+namespace beluga {
+
+/// NUMA placement policy for a large buffer.
+enum class NumaPolicy : std::uint8_t {
+  kDefault,     ///< Leave placement to the operating system (usually first-touch).
+  kInterleave,  ///< Interleave pages round-robin across all allowed NUMA nodes.
+  kBindToNode,  ///< Bind all pages to one NUMA node.
+};
+
+/// Allocation placement hints for a large buffer.
+/**
+ * Long-lived buffers that are scanned by every particle evaluation — the likelihood
+ * `ValueGrid`, the NDT cell pool, `TupleVector` columns — otherwise land wherever the
+ * thread that first touched them ran: on big fields that means TLB pressure from 4 KiB
+ * pages and, on multi-socket hosts, cross-node traffic for parallel reweight sweeps.
+ * These hints are strictly best-effort: they never fail construction, they do not
+ * modify buffer contents, and they degrade to no-ops on platforms without support.
+ */
+struct MemoryHints {
+  /// Whether to request transparent huge page backing via `madvise(MADV_HUGEPAGE)`.
+  bool use_transparent_huge_pages = false;
+  /// NUMA placement policy applied to the buffer pages.
+  NumaPolicy numa_policy = NumaPolicy::kDefault;
+  /// Target node when `numa_policy` is NumaPolicy::kBindToNode. Ignored otherwise.
+  int numa_node = 0;
+  /// Whether to prefault the buffer pages up front.
+  /**
+   * Touches one byte per page, so the first updates after a map load don't pay a
+   * stream of soft page faults across the buffer. Works on read-only file mappings
+   * as well as anonymous memory; pages are only read, never written.
+   */
+  bool prefault = false;
+  /// Whether to lock the buffer pages in memory via `mlock`.
+  /**
+   * Prevents the kernel from evicting the pages under memory pressure, trading
+   * resident memory for deterministic access latency. Subject to the process
+   * `RLIMIT_MEMLOCK` limit; failures leave the buffer unlocked.
+   */
+  bool lock_in_memory = false;
+
+  /// Returns true if any hint is requested.
+  [[nodiscard]] constexpr bool any() const noexcept {
+    return use_transparent_huge_pages || numa_policy != NumaPolicy::kDefault || prefault || lock_in_memory;
+  }
+};
+
+/// Cumulative page fault counters of the calling process.
+/**
+ * Sampled before and after a latency-sensitive section, the difference tells how
+ * many faults the section took — e.g. whether prefaulting the map actually kept
+ * the first filter updates fault-free.
+ */
+struct PageFaultCounts {
+  /// Faults served from memory without I/O (soft faults).
+  std::int64_t minor = 0;
+  /// Faults that required reading from the backing store (hard faults).
+  std::int64_t major = 0;
+};
+
+/// Reads the cumulative page fault counters of the process.
+/**
+ * \return The counters as reported by the kernel, or zeros on platforms without support.
+ */
+inline PageFaultCounts current_page_fault_counts() noexcept {
+#if defined(__linux__)
+  rusage usage{};
+  if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+    return {};
+  }
+  return {static_cast<std::int64_t>(usage.ru_minflt), static_cast<std::int64_t>(usage.ru_majflt)};
+#else
+  return {};
+#endif
+}
+
+namespace detail {
+
+#if defined(__linux__)
+/// Largest NUMA node index representable in the node masks passed to `mbind`.
+inline constexpr std::size_t kMaxNumaNodes = 1024;
+
+/// `mbind` mode and flag constants, defined locally to avoid a libnuma header dependency.
+inline constexpr int kMpolBind = 2;
+inline constexpr int kMpolInterleave = 3;
+inline constexpr unsigned kMpolMfMove = 1U << 1U;
+
+/// Returns the page-aligned interior of a buffer, or a zero length if none exists.
+/**
+ * Both `madvise` and `mbind` operate on whole pages, so hints are restricted to the
+ * pages fully covered by the buffer; partially covered boundary pages may be shared
+ * with unrelated allocations.
+ */
+inline std::pair<void*, std::size_t> page_aligned_interior(void* pointer, std::size_t size_bytes) noexcept {
+  const auto page_size = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+  const auto address = reinterpret_cast<std::uintptr_t>(pointer);
+  const std::uintptr_t first = (address + page_size - 1) / page_size * page_size;
+  const std::uintptr_t last = (address + size_bytes) / page_size * page_size;
+  if (last <= first) {
+    return {nullptr, 0};
+  }
+  return {reinterpret_cast<void*>(first), static_cast<std::size_t>(last - first)};
+}
+#endif
+
+}  // namespace detail
+
+/// Requests transparent huge page backing for the pages fully covered by a buffer.
+/**
+ * \param pointer First byte of the buffer.
+ * \param size_bytes Size of the buffer in bytes.
+ * \return True if the hint was applied, false if the buffer spans no whole page or
+ *  the platform does not support it.
+ */
+inline bool advise_transparent_huge_pages(
+    [[maybe_unused]] void* pointer,
+    [[maybe_unused]] std::size_t size_bytes) noexcept {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  const auto [address, length] = detail::page_aligned_interior(pointer, size_bytes);
+  if (length == 0) {
+    return false;
+  }
+  return ::madvise(address, length, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+/// Applies a NUMA placement policy to the pages fully covered by a buffer.
+/**
+ * Issues the `mbind` system call directly, requesting migration of already populated
+ * pages, so the policy is effective even when applied after the buffer was filled.
+ *
+ * \param pointer First byte of the buffer.
+ * \param size_bytes Size of the buffer in bytes.
+ * \param policy NUMA placement policy to apply.
+ * \param node Target node when `policy` is NumaPolicy::kBindToNode.
+ * \return True if the policy was applied, false if it is NumaPolicy::kDefault, the
+ *  buffer spans no whole page, or the platform or kernel rejects the request.
+ */
+inline bool bind_to_numa_nodes(
+    [[maybe_unused]] void* pointer,
+    [[maybe_unused]] std::size_t size_bytes,
+    NumaPolicy policy,
+    [[maybe_unused]] int node = 0) noexcept {
+  if (policy == NumaPolicy::kDefault) {
+    return false;
+  }
+#if defined(__linux__) && defined(SYS_mbind)
+  const auto [address, length] = detail::page_aligned_interior(pointer, size_bytes);
+  if (length == 0) {
+    return false;
+  }
+  constexpr std::size_t kBitsPerWord = sizeof(unsigned long) * 8;  // NOLINT(google-runtime-int)
+  unsigned long nodemask[detail::kMaxNumaNodes / kBitsPerWord] = {};  // NOLINT(google-runtime-int)
+  int mode = detail::kMpolInterleave;
+  if (policy == NumaPolicy::kBindToNode) {
+    if (node < 0 || static_cast<std::size_t>(node) >= detail::kMaxNumaNodes) {
+      return false;
+    }
+    mode = detail::kMpolBind;
+    nodemask[static_cast<std::size_t>(node) / kBitsPerWord] |= 1UL << (static_cast<std::size_t>(node) % kBitsPerWord);
+  } else {
+    for (auto& word : nodemask) {
+      word = ~0UL;
+    }
+  }
+  return ::syscall(SYS_mbind, address, length, mode, nodemask, detail::kMaxNumaNodes, detail::kMpolMfMove) == 0;
+#else
+  return false;
+#endif
+}
+
+/// Prefaults every page of a buffer by reading one byte per page.
+/**
+ * \param pointer First byte of the buffer.
+ * \param size_bytes Size of the buffer in bytes.
+ * \return True if the buffer was swept, false if it is empty or the platform
+ *  does not expose the page size.
+ */
+inline bool prefault_pages(const void* pointer, std::size_t size_bytes) noexcept {
+#if defined(__linux__)
+  if (size_bytes == 0) {
+    return false;
+  }
+  const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  const auto* bytes = static_cast<const volatile unsigned char*>(pointer);
+  for (std::size_t offset = 0; offset < size_bytes; offset += page_size) {
+    static_cast<void>(bytes[offset]);
+  }
+  static_cast<void>(bytes[size_bytes - 1]);
+  return true;
+#else
+  static_cast<void>(pointer);
+  static_cast<void>(size_bytes);
+  return false;
+#endif
+}
+
+/// Locks the pages of a buffer in memory, preventing eviction.
+/**
+ * \param pointer First byte of the buffer.
+ * \param size_bytes Size of the buffer in bytes.
+ * \return True if the pages were locked, false if the buffer is empty, the process
+ *  `RLIMIT_MEMLOCK` limit is exceeded, or the platform does not support it.
+ */
+inline bool lock_pages(const void* pointer, std::size_t size_bytes) noexcept {
+#if defined(__linux__)
+  if (size_bytes == 0) {
+    return false;
+  }
+  return ::mlock(pointer, size_bytes) == 0;
+#else
+  static_cast<void>(pointer);
+  static_cast<void>(size_bytes);
+  return false;
+#endif
+}
+
+/// Applies all requested hints to a buffer.
+/**
+ * \param pointer First byte of the buffer.
+ * \param size_bytes Size of the buffer in bytes.
+ * \param hints Hints to apply.
+ * \return True if every requested hint was applied.
+ */
+inline bool apply_memory_hints(void* pointer, std::size_t size_bytes, const MemoryHints& hints) noexcept {
+  bool applied = true;
+  if (hints.use_transparent_huge_pages) {
+    applied = advise_transparent_huge_pages(pointer, size_bytes) && applied;
+  }
+  if (hints.numa_policy != NumaPolicy::kDefault) {
+    applied = bind_to_numa_nodes(pointer, size_bytes, hints.numa_policy, hints.numa_node) && applied;
+  }
+  // Placement advice first, residency last, so pages fault in where they will stay.
+  if (hints.prefault) {
+    applied = prefault_pages(pointer, size_bytes) && applied;
+  }
+  if (hints.lock_in_memory) {
+    applied = lock_pages(pointer, size_bytes) && applied;
+  }
+  return applied;
+}
+
+/// Applies all requested hints to the storage of a contiguous container.
+/**
+ * Takes the container by const reference since hints are advisory and never modify
+ * its contents; the underlying system calls merely require a mutable address.
+ *
+ * \param container Contiguous container (e.g. `std::vector`) whose storage to hint.
+ * \param hints Hints to apply.
+ * \return True if every requested hint was applied.
+ */
+template <class Container>
+auto apply_memory_hints(const Container& container, const MemoryHints& hints) noexcept
+    -> decltype(static_cast<const void*>(container.data()), bool{}) {
+  if (!hints.any() || container.size() == 0) {
+    return false;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  void* pointer = const_cast<void*>(static_cast<const void*>(container.data()));
+  return apply_memory_hints(pointer, container.size() * sizeof(*container.data()), hints);
+}
+
+}  // namespace beluga
+
+#endif
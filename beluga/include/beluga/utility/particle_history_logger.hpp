@@ -0,0 +1,319 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_UTILITY_PARTICLE_HISTORY_LOGGER_HPP
+#define BELUGA_UTILITY_PARTICLE_HISTORY_LOGGER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <beluga/containers/tuple_vector.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a columnar on-disk particle-history logger.
+ */
+
+namespace beluga {
+
+/// Parameters used to construct a ParticleHistoryLogger instance.
+struct ParticleHistoryLoggerParams {
+  /// Base path of the log; records are written to `<path>.0` and `<path>.1`.
+  std::filesystem::path path;
+  /// Maximum size of one on-disk segment, in bytes.
+  /**
+   * When the active segment grows past this, the logger rotates to the other segment,
+   * erasing its previous contents, so disk usage stays bounded to roughly twice this
+   * value while the most recent history is always retained.
+   */
+  std::size_t max_segment_bytes = 64UL * 1024UL * 1024UL;
+  /// Maximum number of snapshots waiting for the writer thread.
+  /**
+   * When the queue is full the oldest pending snapshot is dropped, so the filter is
+   * never blocked on disk no matter how slow the backing store is.
+   */
+  std::size_t max_pending_records = 16UL;
+};
+
+/// Appends particle-set snapshots to a bounded on-disk columnar log from a background thread.
+/**
+ * Postmortem analysis of localization failures needs the particle history around the
+ * failure, but serializing pose-array messages at update rate costs more than the filter
+ * itself. This logger instead copies the particle container columns into one record — a
+ * handful of large sequential copies thanks to the SoA layout — and hands it to a
+ * minimum-priority writer thread, so `append()` is cheap enough to leave always-on and
+ * the filter never waits for disk.
+ *
+ * Retention is bounded two ways: on disk by rotating between two segment files capped at
+ * ParticleHistoryLoggerParams::max_segment_bytes each, and in memory by dropping the
+ * oldest pending record when the writer falls behind.
+ *
+ * Each record is a sequence number and particle count followed by each particle column
+ * in declaration order (e.g. states, then weights). Trivially copyable columns are
+ * written as raw bytes; pose columns are written as their parameter scalars, one pose at
+ * a time, since Eigen-backed types are not trivially copyable. The layout is an
+ * implementation detail, only meant to be read back by tooling built from the same
+ * binary.
+ *
+ * \tparam ParticleType Full particle type, as stored by the filter's beluga::TupleVector.
+ */
+template <class ParticleType>
+class ParticleHistoryLogger {
+ public:
+  /// Constructs a logger and starts its writer thread.
+  /**
+   * \param params Parameters to configure this instance.
+   *  See beluga::ParticleHistoryLoggerParams for details.
+   */
+  explicit ParticleHistoryLogger(ParticleHistoryLoggerParams params) : params_{std::move(params)} {
+    stream_.open(segment_path(active_segment_), std::ios::binary | std::ios::trunc);
+    writer_ = std::thread{&ParticleHistoryLogger::writer_loop, this};
+  }
+
+  /// Destructor. Drains pending records and joins the writer thread.
+  ~ParticleHistoryLogger() {
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      stopping_ = true;
+    }
+    condition_.notify_one();
+    if (writer_.joinable()) {
+      writer_.join();
+    }
+  }
+
+  /// Copy construction is disabled; the writer thread captures `this`.
+  ParticleHistoryLogger(const ParticleHistoryLogger&) = delete;
+  /// Copy assignment is disabled; the writer thread captures `this`.
+  ParticleHistoryLogger& operator=(const ParticleHistoryLogger&) = delete;
+  /// Move construction is disabled; the writer thread captures `this`.
+  ParticleHistoryLogger(ParticleHistoryLogger&&) = delete;
+  /// Move assignment is disabled; the writer thread captures `this`.
+  ParticleHistoryLogger& operator=(ParticleHistoryLogger&&) = delete;
+
+  /// Appends a snapshot of the particle set to the log.
+  /**
+   * Serializes the container columns into one contiguous record and enqueues it for the
+   * writer thread; when the queue is full the oldest pending record is dropped instead
+   * of blocking.
+   *
+   * \param particles Particle set to snapshot.
+   */
+  void append(const beluga::TupleVector<ParticleType>& particles) {
+    std::vector<std::byte> record;
+    record.reserve(2 * sizeof(std::uint64_t) + particles.size() * kBytesPerParticle);
+    const auto sequence = static_cast<std::uint64_t>(next_sequence_++);
+    append_bytes(record, &sequence, 1);
+    const auto particle_count = static_cast<std::uint64_t>(particles.size());
+    append_bytes(record, &particle_count, 1);
+    append_columns(record, particles, std::make_index_sequence<std::tuple_size_v<ParticleType>>());
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      if (pending_.size() >= params_.max_pending_records) {
+        pending_.pop_front();
+        ++records_dropped_;
+      }
+      pending_.push_back(std::move(record));
+    }
+    condition_.notify_one();
+  }
+
+  /// Blocks until all pending records have been written and flushed to the backing store.
+  void flush() {
+    std::unique_lock<std::mutex> lock{mutex_};
+    drained_condition_.wait(lock, [this] { return pending_.empty() && !write_in_progress_; });
+    // The writer thread is idle while the queue is observed empty under the lock.
+    stream_.flush();
+  }
+
+  /// Returns the number of records written to disk so far.
+  [[nodiscard]] std::size_t records_written() const {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    return records_written_;
+  }
+
+  /// Returns the number of snapshots dropped because the writer fell behind.
+  [[nodiscard]] std::size_t records_dropped() const {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    return records_dropped_;
+  }
+
+  /// Returns the path of the segment currently being written.
+  [[nodiscard]] std::filesystem::path active_segment_path() const {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    return segment_path(active_segment_);
+  }
+
+ private:
+  /// Serialized size of one element of a particle column.
+  /**
+   * Trivially copyable columns serialize as raw objects; pose columns serialize their
+   * parameter scalars (unit complex or unit quaternion followed by the translation).
+   */
+  template <class T>
+  [[nodiscard]] static constexpr std::size_t serialized_element_size() {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      return sizeof(T);
+    } else {
+      return static_cast<std::size_t>(T::num_parameters) * sizeof(typename T::Scalar);
+    }
+  }
+
+  /// Sums the serialized element sizes over the particle columns.
+  template <std::size_t... Ids>
+  [[nodiscard]] static constexpr std::size_t serialized_particle_size(std::index_sequence<Ids...>) {
+    return (serialized_element_size<std::tuple_element_t<Ids, ParticleType>>() + ...);
+  }
+
+  /// Serialized size of one particle, derived from the per-column element layout.
+  /// Note this is not `sizeof(ParticleType)`, which would count tuple padding.
+  static constexpr std::size_t kBytesPerParticle =
+      serialized_particle_size(std::make_index_sequence<std::tuple_size_v<ParticleType>>());
+
+  /// Appends `count` trivially copyable values to a record.
+  template <class T>
+  static void append_bytes(std::vector<std::byte>& record, const T* data, std::size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const auto* begin = reinterpret_cast<const std::byte*>(data);
+    record.insert(record.end(), begin, begin + count * sizeof(T));
+  }
+
+  /// Appends one particle container column to a record, following the layout
+  /// `serialized_element_size()` accounts for.
+  template <class T>
+  static void append_column(std::vector<std::byte>& record, const T* data, std::size_t count) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      append_bytes(record, data, count);
+    } else {
+      for (std::size_t i = 0; i < count; ++i) {
+        append_bytes(record, data[i].data(), static_cast<std::size_t>(T::num_parameters));
+      }
+    }
+  }
+
+  /// Appends each particle container column to a record in declaration order.
+  template <std::size_t... Ids>
+  static void append_columns(
+      std::vector<std::byte>& record,
+      const beluga::TupleVector<ParticleType>& particles,
+      std::index_sequence<Ids...>) {
+    (append_column(record, particles.template data<Ids>(), particles.size()), ...);
+  }
+
+  /// Returns the path of a log segment.
+  [[nodiscard]] std::filesystem::path segment_path(int segment) const {
+    auto path = params_.path;
+    path += "." + std::to_string(segment);
+    return path;
+  }
+
+  /// Writer thread loop, draining the record queue until asked to stop.
+  void writer_loop() {
+#if defined(__linux__)
+    // History writing must never compete with filter sweeps for CPU; drop this thread
+    // to the lowest scheduling priority (per-thread nice value on Linux).
+    ::setpriority(PRIO_PROCESS, static_cast<id_t>(::syscall(SYS_gettid)), 19);
+#endif
+    for (;;) {
+      std::vector<std::byte> record;
+      {
+        std::unique_lock<std::mutex> lock{mutex_};
+        condition_.wait(lock, [this] { return stopping_ || !pending_.empty(); });
+        if (pending_.empty()) {
+          return;  // stopping, and every queued record has been drained
+        }
+        record = std::move(pending_.front());
+        pending_.pop_front();
+        write_in_progress_ = true;
+      }
+      write_record(record);
+      {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        write_in_progress_ = false;
+        ++records_written_;
+      }
+      drained_condition_.notify_all();
+    }
+  }
+
+  /// Writes one record to the active segment, rotating segments when it is full.
+  void write_record(const std::vector<std::byte>& record) {
+    if (!stream_.is_open()) {
+      return;
+    }
+    if (segment_bytes_ > 0 && segment_bytes_ + record.size() > params_.max_segment_bytes) {
+      stream_.close();
+      {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        active_segment_ = 1 - active_segment_;
+      }
+      stream_.open(segment_path(active_segment_), std::ios::binary | std::ios::trunc);
+      segment_bytes_ = 0;
+    }
+    stream_.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+    segment_bytes_ += record.size();
+  }
+
+  ParticleHistoryLoggerParams params_;
+  /// Stream over the active segment; only touched by the writer thread (and by
+  /// `flush()`, which first waits for the writer to go idle).
+  std::ofstream stream_;
+  /// Bytes written to the active segment so far; writer thread only.
+  std::size_t segment_bytes_ = 0;
+  /// Sequence number stamped on the next record; caller thread only.
+  std::uint64_t next_sequence_ = 0;
+
+  /// Mutex protecting the record queue, the counters, and the stop flag.
+  mutable std::mutex mutex_;
+  /// Condition variable to wake up the writer thread.
+  std::condition_variable condition_;
+  /// Condition variable signaled whenever the writer finishes a record.
+  std::condition_variable drained_condition_;
+  /// Records waiting for the writer thread, oldest first.
+  std::deque<std::vector<std::byte>> pending_;
+  /// Whether the writer thread is between popping a record and finishing its write.
+  bool write_in_progress_ = false;
+  /// Whether the writer thread was asked to stop.
+  bool stopping_ = false;
+  /// Index of the segment currently being written, 0 or 1.
+  int active_segment_ = 0;
+  /// Number of records written to disk.
+  std::size_t records_written_ = 0;
+  /// Number of snapshots dropped because the queue was full.
+  std::size_t records_dropped_ = 0;
+
+  /// Background writer thread.
+  std::thread writer_;
+};
+
+}  // namespace beluga
+
+#endif
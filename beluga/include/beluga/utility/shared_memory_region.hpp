@@ -0,0 +1,174 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_UTILITY_SHARED_MEMORY_REGION_HPP
+#define BELUGA_UTILITY_SHARED_MEMORY_REGION_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+/**
+ * \file
+ * \brief Implementation of a named POSIX shared memory region wrapper.
+ */
+
+namespace beluga {
+
+/// Move-only RAII wrapper over a named POSIX shared memory segment.
+/**
+ * Meant for publishing large read-mostly buffers — precomputed sensor model maps,
+ * typically — once per host, so cooperating processes can map a single copy instead of
+ * each holding a private one. The creating side owns the segment: it maps it read-write
+ * and unlinks the name when destroyed, while opening sides map it read-only and only
+ * unmap when destroyed. Attached mappings thus outlive the segment name, but new
+ * processes can no longer attach once the owner is gone.
+ */
+class SharedMemoryRegion {
+ public:
+  /// Creates a new segment with the given name and size, owned by the returned region.
+  /**
+   * Any stale segment left behind under the same name (e.g. by a crashed process) is
+   * unlinked first.
+   *
+   * \param name Segment name, starting with a slash (e.g. "/beluga_likelihood_field").
+   * \param size Segment size in bytes. Must be positive.
+   * \return A region owning the created segment, mapped read-write.
+   * \throw std::invalid_argument If the segment cannot be created, sized or mapped.
+   */
+  static SharedMemoryRegion create(const std::string& name, std::size_t size) {
+    ::shm_unlink(name.c_str());  // best-effort removal of stale segments
+    const int descriptor = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (descriptor < 0) {
+      std::stringstream ss;
+      ss << "Couldn't create shared memory segment " << name;
+      throw std::invalid_argument(ss.str());
+    }
+    if (::ftruncate(descriptor, static_cast<off_t>(size)) != 0) {
+      ::close(descriptor);
+      ::shm_unlink(name.c_str());
+      std::stringstream ss;
+      ss << "Couldn't size shared memory segment " << name;
+      throw std::invalid_argument(ss.str());
+    }
+    void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    ::close(descriptor);  // the mapping holds its own reference to the segment
+    if (address == MAP_FAILED) {
+      ::shm_unlink(name.c_str());
+      std::stringstream ss;
+      ss << "Couldn't memory map shared memory segment " << name;
+      throw std::invalid_argument(ss.str());
+    }
+    return SharedMemoryRegion{name, address, size, true};
+  }
+
+  /// Opens an existing segment read-only.
+  /**
+   * \param name Name of a segment created by another region, possibly in another process.
+   * \return A non-owning region mapping the segment read-only.
+   * \throw std::invalid_argument If no such segment exists or it cannot be mapped.
+   */
+  static SharedMemoryRegion open(const std::string& name) {
+    const int descriptor = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (descriptor < 0) {
+      std::stringstream ss;
+      ss << "Couldn't open shared memory segment " << name;
+      throw std::invalid_argument(ss.str());
+    }
+    struct ::stat status = {};
+    if (::fstat(descriptor, &status) != 0) {
+      ::close(descriptor);
+      std::stringstream ss;
+      ss << "Couldn't stat shared memory segment " << name;
+      throw std::invalid_argument(ss.str());
+    }
+    const auto size = static_cast<std::size_t>(status.st_size);
+    void* address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+    ::close(descriptor);  // the mapping holds its own reference to the segment
+    if (address == MAP_FAILED) {
+      std::stringstream ss;
+      ss << "Couldn't memory map shared memory segment " << name;
+      throw std::invalid_argument(ss.str());
+    }
+    return SharedMemoryRegion{name, address, size, false};
+  }
+
+  /// Move constructor, leaving `other` empty.
+  SharedMemoryRegion(SharedMemoryRegion&& other) noexcept
+      : name_{std::move(other.name_)},
+        address_{std::exchange(other.address_, nullptr)},
+        size_{std::exchange(other.size_, 0U)},
+        owner_{std::exchange(other.owner_, false)} {}
+
+  /// Move assignment, releasing the current mapping and leaving `other` empty.
+  SharedMemoryRegion& operator=(SharedMemoryRegion&& other) noexcept {
+    if (this != &other) {
+      release();
+      name_ = std::move(other.name_);
+      address_ = std::exchange(other.address_, nullptr);
+      size_ = std::exchange(other.size_, 0U);
+      owner_ = std::exchange(other.owner_, false);
+    }
+    return *this;
+  }
+
+  SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+  SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+  /// Unmaps the segment, unlinking its name as well if this region owns it.
+  ~SharedMemoryRegion() { release(); }
+
+  /// Returns a pointer to the mapped segment, writable only on the owning side.
+  [[nodiscard]] void* data() noexcept { return address_; }
+
+  /// Returns a pointer to the mapped segment.
+  [[nodiscard]] const void* data() const noexcept { return address_; }
+
+  /// Returns the size of the mapped segment, in bytes.
+  [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+  /// Returns the name of the segment.
+  [[nodiscard]] const std::string& name() const noexcept { return name_; }
+
+ private:
+  SharedMemoryRegion(std::string name, void* address, std::size_t size, bool owner)
+      : name_{std::move(name)}, address_{address}, size_{size}, owner_{owner} {}
+
+  void release() noexcept {
+    if (address_ != nullptr) {
+      ::munmap(address_, size_);
+      address_ = nullptr;
+    }
+    if (owner_) {
+      ::shm_unlink(name_.c_str());
+      owner_ = false;
+    }
+  }
+
+  std::string name_;
+  void* address_ = nullptr;
+  std::size_t size_ = 0U;
+  bool owner_ = false;
+};
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,158 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_UTILITY_SIMD_DISPATCH_HPP
+#define BELUGA_UTILITY_SIMD_DISPATCH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \file
+ * \brief Runtime SIMD instruction set detection and kernel dispatch.
+ *
+ * One binary has to serve heterogeneous fleets: AVX-512 benches, AVX2 servers
+ * and NEON robots. Kernels with hand-tuned variants register them in a
+ * \ref beluga::SimdDispatch table keyed by \ref beluga::SimdIsa, with a scalar
+ * fallback that is always present; the table resolves against the instruction
+ * sets the running machine actually supports, so no per-platform artifacts are
+ * needed. Variants compiled with target-specific flags must only be registered
+ * in translation units built for the matching target.
+ */
+
+namespace beluga {
+
+/// Instruction set tiers distinguished by the runtime kernel dispatcher.
+/**
+ * Tiers are ordered from least to most capable within an architecture, and
+ * resolution falls back down the same architecture before reaching the scalar
+ * tier, e.g. an AVX-512 machine runs the AVX2 variant of a kernel that
+ * registered no AVX-512 one.
+ */
+enum class SimdIsa : std::uint8_t {
+  kScalar = 0,  ///< Portable fallback tier; always available.
+  kNeon = 1,    ///< ARM Advanced SIMD.
+  kAvx2 = 2,    ///< x86-64 AVX2 (with FMA on all known parts).
+  kAvx512 = 3,  ///< x86-64 AVX-512 foundation subset.
+};
+
+/// Probes the instruction sets supported by the running machine.
+/**
+ * \return The most capable \ref SimdIsa tier the host supports.
+ *
+ * Prefer \ref detected_simd_isa, which caches the probe.
+ */
+[[nodiscard]] inline SimdIsa detect_simd_isa() noexcept {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  if (__builtin_cpu_supports("avx512f")) {
+    return SimdIsa::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return SimdIsa::kAvx2;
+  }
+  return SimdIsa::kScalar;
+#elif defined(__ARM_NEON)
+  return SimdIsa::kNeon;
+#else
+  return SimdIsa::kScalar;
+#endif
+}
+
+/// Returns the host instruction set tier, probed once per process.
+[[nodiscard]] inline SimdIsa detected_simd_isa() noexcept {
+  static const SimdIsa isa = detect_simd_isa();
+  return isa;
+}
+
+template <class Signature>
+class SimdDispatch;
+
+/// Table of per-ISA variants of one kernel, resolved at runtime.
+/**
+ * \tparam R Kernel return type.
+ * \tparam Args Kernel argument types.
+ *
+ * Construction takes the scalar fallback, so a table can never resolve to
+ * nothing; variants for other tiers are registered through `with_variant`.
+ * Typical use selects once and caches the resolved pointer:
+ *
+ * ```cpp
+ * static const auto kKernel = beluga::SimdDispatch<double(const float*, std::size_t)>{scalar_sum}
+ *                                 .with_variant(beluga::SimdIsa::kAvx2, avx2_sum)
+ *                                 .select();
+ * ```
+ */
+template <class R, class... Args>
+class SimdDispatch<R(Args...)> {
+ public:
+  /// Plain function pointer type of the kernel variants.
+  using function_type = R (*)(Args...);
+
+  /// Constructs a dispatch table from the scalar fallback variant.
+  /**
+   * \param scalar Portable kernel implementation; used whenever no better variant applies.
+   */
+  explicit constexpr SimdDispatch(function_type scalar) noexcept { variants_[index(SimdIsa::kScalar)] = scalar; }
+
+  /// Registers a kernel variant for an instruction set tier.
+  /**
+   * \param isa Tier the variant requires.
+   * \param variant Kernel implementation compiled for that tier.
+   * \return This table, for chaining.
+   */
+  constexpr SimdDispatch& with_variant(SimdIsa isa, function_type variant) noexcept {
+    variants_[index(isa)] = variant;
+    return *this;
+  }
+
+  /// Resolves the best registered variant for a given instruction set tier.
+  /**
+   * \param isa Tier to resolve against.
+   * \return The variant registered for `isa`, or the nearest less capable
+   * variant of the same architecture, down to the scalar fallback.
+   */
+  [[nodiscard]] constexpr function_type resolve(SimdIsa isa) const noexcept {
+    if (isa == SimdIsa::kAvx512 && variants_[index(SimdIsa::kAvx512)] != nullptr) {
+      return variants_[index(SimdIsa::kAvx512)];
+    }
+    if ((isa == SimdIsa::kAvx512 || isa == SimdIsa::kAvx2) && variants_[index(SimdIsa::kAvx2)] != nullptr) {
+      return variants_[index(SimdIsa::kAvx2)];
+    }
+    if (isa == SimdIsa::kNeon && variants_[index(SimdIsa::kNeon)] != nullptr) {
+      return variants_[index(SimdIsa::kNeon)];
+    }
+    return variants_[index(SimdIsa::kScalar)];
+  }
+
+  /// Resolves the best registered variant for the running machine.
+  [[nodiscard]] function_type select() const noexcept { return resolve(detected_simd_isa()); }
+
+  /// Invokes the best registered variant for the running machine.
+  /**
+   * Resolution costs a few compares per call; hot paths should cache the
+   * pointer returned by `select()` instead.
+   */
+  R operator()(Args... args) const { return select()(args...); }
+
+ private:
+  /// Maps a tier to its slot in the variant table.
+  [[nodiscard]] static constexpr std::size_t index(SimdIsa isa) noexcept { return static_cast<std::size_t>(isa); }
+
+  std::array<function_type, 4> variants_{};
+};
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,336 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_UTILITY_THREAD_POOL_EXECUTOR_HPP
+#define BELUGA_UTILITY_THREAD_POOL_EXECUTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \brief Implementation of a thread pool based bulk executor.
+ */
+
+namespace beluga {
+
+/// Bulk executor backed by a dedicated pool of worker threads.
+/**
+ * Alternative to `std::execution` policies for the particle range actions,
+ * useful when the filter must run on a bounded set of cores instead of the
+ * global arena the standard parallel algorithms use. Satisfies
+ * `beluga::is_bulk_executor`.
+ *
+ * Instances are cheap copyable handles that share the same underlying pool,
+ * which is joined when the last handle is destroyed.
+ */
+class ThreadPoolExecutor {
+ public:
+  /// Strategies for partitioning bulk work across the pool.
+  enum class Scheduling {
+    /// One contiguous chunk per thread, assigned upfront. Lowest overhead, but threads
+    /// finishing a cheap chunk idle at the join while expensive chunks are still running.
+    kStatic,
+    /// Many small chunks claimed dynamically, so idle threads steal the remaining chunks
+    /// of the work queue instead of waiting at the join. Preferred when per-element cost
+    /// is skewed, like sensor models whose evaluation cost depends on the particle pose.
+    kWorkStealing,
+  };
+
+  /// Construct an executor with a dedicated pool of `thread_count` worker threads.
+  /**
+   * \param thread_count Number of worker threads in the pool.
+   * \param scheduling Partitioning strategy used by the bulk execution member functions.
+   */
+  explicit ThreadPoolExecutor(
+      std::size_t thread_count = std::thread::hardware_concurrency(),
+      Scheduling scheduling = Scheduling::kStatic)
+      : impl_{std::make_shared<Impl>(std::max<std::size_t>(thread_count, 1U))}, scheduling_{scheduling} {}
+
+  /// Returns the number of worker threads in the pool.
+  [[nodiscard]] std::size_t thread_count() const { return impl_->thread_count(); }
+
+  /// Returns the partitioning strategy used by the bulk execution member functions.
+  [[nodiscard]] Scheduling scheduling() const { return scheduling_; }
+
+  /// Invoke `fn` once per element of `range`, partitioned across the pool.
+  /**
+   * \tparam Range A [forward range](https://en.cppreference.com/w/cpp/ranges/forward_range).
+   * \tparam Fn A callable invocable with a reference to a range element.
+   * \param range An existing range of elements to iterate over.
+   * \param fn A callable instance, invoked in unspecified order and possibly concurrently.
+   *
+   * The caller thread processes one of the chunks itself and the call
+   * returns once all invocations have completed.
+   */
+  template <class Range, class Fn>
+  void bulk_execute(Range& range, Fn fn) const {
+    if (scheduling_ == Scheduling::kWorkStealing) {
+      run_stealing(range, [&fn](auto first, auto last, std::size_t) {
+        for (; first != last; ++first) {
+          fn(*first);
+        }
+      });
+      return;
+    }
+    auto first = std::begin(range);
+    const auto last = std::end(range);
+    const auto size = static_cast<std::size_t>(std::distance(first, last));
+    if (size == 0U) {
+      return;
+    }
+
+    const std::size_t chunks = std::min(impl_->thread_count(), size);
+    const std::size_t chunk_size = size / chunks;
+    const std::size_t remainder = size % chunks;
+
+    auto process = [&fn](auto begin, auto end) {
+      for (; begin != end; ++begin) {
+        fn(*begin);
+      }
+    };
+
+    CompletionLatch latch{chunks - 1U};
+    for (std::size_t index = 0U; index + 1U < chunks; ++index) {
+      auto next = std::next(first, static_cast<std::ptrdiff_t>(chunk_size + (index < remainder ? 1U : 0U)));
+      impl_->submit([&process, &latch, first, next]() {
+        process(first, next);
+        latch.count_down();
+      });
+      first = next;
+    }
+
+    process(first, last);  // The caller thread takes the last chunk.
+    latch.wait();
+  }
+
+  /// Invoke `fn` once per contiguous chunk of `range`, partitioned across the pool.
+  /**
+   * \tparam Range A [forward range](https://en.cppreference.com/w/cpp/ranges/forward_range).
+   * \tparam Fn A callable invocable as `fn(first, last, index)` with the chunk iterators
+   * and the chunk index.
+   * \param range An existing range of elements to partition.
+   * \param fn A callable instance, invoked once per chunk, possibly concurrently.
+   *
+   * Chunk indices are in `[0, thread_count())`, and invocations sharing an index never
+   * run concurrently, so callers can give each index a dedicated accumulator slot to
+   * combine into and reduce once the call returns, without synchronizing inside `fn`.
+   * With static scheduling at most `thread_count()` chunks are created and each index is
+   * used once; with work stealing an index is reused for every chunk the corresponding
+   * thread claims. The caller thread processes chunks itself and the call returns once
+   * all invocations have completed.
+   */
+  template <class Range, class Fn>
+  void bulk_execute_chunks(Range& range, Fn fn) const {
+    if (scheduling_ == Scheduling::kWorkStealing) {
+      run_stealing(range, fn);
+      return;
+    }
+    auto first = std::begin(range);
+    const auto last = std::end(range);
+    const auto size = static_cast<std::size_t>(std::distance(first, last));
+    if (size == 0U) {
+      return;
+    }
+
+    const std::size_t chunks = std::min(impl_->thread_count(), size);
+    const std::size_t chunk_size = size / chunks;
+    const std::size_t remainder = size % chunks;
+
+    CompletionLatch latch{chunks - 1U};
+    for (std::size_t index = 0U; index + 1U < chunks; ++index) {
+      auto next = std::next(first, static_cast<std::ptrdiff_t>(chunk_size + (index < remainder ? 1U : 0U)));
+      impl_->submit([&fn, &latch, first, next, index]() {
+        fn(first, next, index);
+        latch.count_down();
+      });
+      first = next;
+    }
+
+    fn(first, last, chunks - 1U);  // The caller thread takes the last chunk.
+    latch.wait();
+  }
+
+ private:
+  /// Number of chunks targeted per thread under work stealing.
+  /**
+   * Oversubscribing gives threads that finish cheap chunks a queue of remaining work to
+   * steal from, at the price of one atomic claim per chunk.
+   */
+  static constexpr std::size_t kStealingChunksPerThread = 8U;
+
+  /// Minimum chunk size under work stealing.
+  /**
+   * Keeps chunks spanning whole cache lines of each column of the particle storage
+   * (states, weights), so the claim overhead stays amortized and chunk traversals stay
+   * as prefetch friendly as the static split.
+   */
+  static constexpr std::size_t kStealingMinChunkSize = 64U;
+
+  /// Partition `range` into small chunks claimed dynamically by the pool.
+  /**
+   * `fn` is invoked as `fn(first, last, index)` once per chunk, where `index` identifies
+   * the claiming thread and is in `[0, thread_count())`. Chunk boundaries are computed
+   * upfront, then the caller and up to `thread_count() - 1` workers drain a shared
+   * atomic chunk counter until no chunks remain.
+   */
+  template <class Range, class Fn>
+  void run_stealing(Range& range, Fn fn) const {
+    auto first = std::begin(range);
+    const auto last = std::end(range);
+    const auto size = static_cast<std::size_t>(std::distance(first, last));
+    if (size == 0U) {
+      return;
+    }
+
+    const std::size_t threads = impl_->thread_count();
+    const std::size_t target_chunks = std::max<std::size_t>(threads * kStealingChunksPerThread, 1U);
+    const std::size_t chunk_size = std::max(kStealingMinChunkSize, (size + target_chunks - 1U) / target_chunks);
+    const std::size_t chunks = (size + chunk_size - 1U) / chunk_size;
+
+    using Iterator = decltype(first);
+    std::vector<Iterator> boundaries;
+    boundaries.reserve(chunks + 1U);
+    boundaries.push_back(first);
+    for (std::size_t remaining = size; remaining > chunk_size; remaining -= chunk_size) {
+      first = std::next(first, static_cast<std::ptrdiff_t>(chunk_size));
+      boundaries.push_back(first);
+    }
+    boundaries.push_back(last);
+
+    std::atomic<std::size_t> next_chunk{0U};
+    auto drain = [&fn, &boundaries, &next_chunk, chunks](std::size_t index) {
+      for (;;) {
+        const std::size_t chunk = next_chunk.fetch_add(1U, std::memory_order_relaxed);
+        if (chunk >= chunks) {
+          return;
+        }
+        fn(boundaries[chunk], boundaries[chunk + 1U], index);
+      }
+    };
+
+    const std::size_t helpers = std::min(threads, chunks) - 1U;
+    CompletionLatch latch{helpers};
+    for (std::size_t index = 0U; index < helpers; ++index) {
+      impl_->submit([&drain, &latch, index]() {
+        drain(index);
+        latch.count_down();
+      });
+    }
+    drain(helpers);  // The caller thread drains chunks alongside the workers.
+    latch.wait();
+  }
+
+  /// Synchronization primitive to wait for a fixed number of submitted chunks.
+  struct CompletionLatch {
+    /// Construct a latch waiting on `count` calls to `count_down()`.
+    explicit CompletionLatch(std::size_t count) : pending{count} {}
+
+    /// Signal the completion of one chunk.
+    void count_down() {
+      const std::lock_guard<std::mutex> lock{mutex};
+      if (--pending == 0U) {
+        done.notify_one();
+      }
+    }
+
+    /// Block until all chunks have completed.
+    void wait() {
+      std::unique_lock<std::mutex> lock{mutex};
+      done.wait(lock, [this]() { return pending == 0U; });
+    }
+
+    std::mutex mutex;              ///< Mutex protecting the pending count.
+    std::condition_variable done;  ///< Condition notified when the count reaches zero.
+    std::size_t pending;           ///< Number of chunks still running.
+  };
+
+  /// Shared pool state, joined when the last handle is destroyed.
+  class Impl {
+   public:
+    /// Spawn `thread_count` worker threads.
+    explicit Impl(std::size_t thread_count) {
+      workers_.reserve(thread_count);
+      for (std::size_t index = 0U; index < thread_count; ++index) {
+        workers_.emplace_back([this]() { work(); });
+      }
+    }
+
+    ~Impl() {
+      {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        stopped_ = true;
+      }
+      available_.notify_all();
+      for (auto& worker : workers_) {
+        worker.join();
+      }
+    }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    /// Returns the number of worker threads in the pool.
+    [[nodiscard]] std::size_t thread_count() const { return workers_.size(); }
+
+    /// Enqueue a task for execution by the pool.
+    void submit(std::function<void()> task) {
+      {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        tasks_.push_back(std::move(task));
+      }
+      available_.notify_one();
+    }
+
+   private:
+    /// Worker thread loop, running tasks until the pool is stopped.
+    void work() {
+      for (;;) {
+        std::function<void()> task;
+        {
+          std::unique_lock<std::mutex> lock{mutex_};
+          available_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+          if (tasks_.empty()) {
+            return;  // Stopped and drained.
+          }
+          task = std::move(tasks_.front());
+          tasks_.erase(tasks_.begin());
+        }
+        task();
+      }
+    }
+
+    std::vector<std::thread> workers_;
+    std::vector<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable available_;
+    bool stopped_{false};
+  };
+
+  std::shared_ptr<Impl> impl_;
+  Scheduling scheduling_{Scheduling::kStatic};
+};
+
+}  // namespace beluga
+
+#endif
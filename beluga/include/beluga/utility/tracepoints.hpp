@@ -0,0 +1,59 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_UTILITY_TRACEPOINTS_HPP
+#define BELUGA_UTILITY_TRACEPOINTS_HPP
+
+/**
+ * \file
+ * \brief Compiled-out tracepoint macros for the particle filter hot path.
+ *
+ * The `BELUGA_TRACEPOINT` family of macros marks stable points in the filter
+ * pipeline (state propagation, importance weighting, resampling setup, KLD
+ * convergence and pose estimation) so external tracers can observe a running
+ * process without a bench harness or code changes.
+ *
+ * The macros expand to nothing unless `BELUGA_ENABLE_TRACEPOINTS` is defined
+ * (see the CMake option of the same name), in which case they emit USDT probes
+ * through `<sys/sdt.h>` under the `beluga` provider. Each probe compiles to a
+ * single `nop` instruction plus an ELF note, so enabled-but-unattached probes
+ * are effectively free, and tools like `perf probe`, `bpftrace` or SystemTap
+ * can attach to them at runtime:
+ *
+ * ```
+ * bpftrace -e 'usdt:./amcl_node:beluga:propagate_begin { @start = nsecs; }'
+ * ```
+ */
+
+#if defined(BELUGA_ENABLE_TRACEPOINTS)
+#if defined(__has_include) && __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+/// Emits a USDT probe with no arguments under the `beluga` provider.
+#define BELUGA_TRACEPOINT(name) DTRACE_PROBE(beluga, name)
+/// Emits a USDT probe with one integral argument under the `beluga` provider.
+#define BELUGA_TRACEPOINT1(name, arg0) DTRACE_PROBE1(beluga, name, arg0)
+/// Emits a USDT probe with two integral arguments under the `beluga` provider.
+#define BELUGA_TRACEPOINT2(name, arg0, arg1) DTRACE_PROBE2(beluga, name, arg0, arg1)
+#else
+#error "BELUGA_ENABLE_TRACEPOINTS requires <sys/sdt.h> (available from the systemtap-sdt-dev package)"
+#endif
+#else
+// Arguments are still evaluated when disabled, matching the semantics of the
+// enabled probes and keeping variables that only feed tracepoints referenced.
+#define BELUGA_TRACEPOINT(name) static_cast<void>(0)
+#define BELUGA_TRACEPOINT1(name, arg0) static_cast<void>(arg0)
+#define BELUGA_TRACEPOINT2(name, arg0, arg1) (static_cast<void>(arg0), static_cast<void>(arg1))
+#endif
+
+#endif
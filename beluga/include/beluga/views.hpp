@@ -15,10 +15,14 @@
 #ifndef BELUGA_VIEWS_HPP
 #define BELUGA_VIEWS_HPP
 
+#include <beluga/views/assert_partitionable.hpp>
+#include <beluga/views/cluster_stratified_sample.hpp>
 #include <beluga/views/elements.hpp>
+#include <beluga/views/low_variance_sample.hpp>
 #include <beluga/views/particles.hpp>
 #include <beluga/views/random_intersperse.hpp>
 #include <beluga/views/sample.hpp>
+#include <beluga/views/sample_alias.hpp>
 #include <beluga/views/take_evenly.hpp>
 #include <beluga/views/take_while_kld.hpp>
 #include <beluga/views/zip.hpp>
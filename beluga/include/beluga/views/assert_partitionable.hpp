@@ -0,0 +1,80 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_VIEWS_ASSERT_PARTITIONABLE_HPP
+#define BELUGA_VIEWS_ASSERT_PARTITIONABLE_HPP
+
+#include <type_traits>
+
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/view/all.hpp>
+
+/**
+ * \file
+ * \brief Implementation of an assert_partitionable range adaptor object.
+ */
+
+namespace beluga::views {
+
+/// Meta-function that returns true if parallel stages can partition work over `Range`.
+/**
+ * A range is partitionable when it is random access and sized and its iterator
+ * difference is O(1), so N-way work splitting costs O(1) per partition instead of
+ * an O(N) walk.
+ */
+template <class Range>
+inline constexpr bool is_partitionable_range_v =
+    ranges::random_access_range<Range> && ranges::sized_range<Range> &&
+    ranges::sized_sentinel_for<ranges::iterator_t<Range>, ranges::iterator_t<Range>>;
+
+namespace detail {
+
+/// Implementation detail for an assert_partitionable range adaptor object.
+struct assert_partitionable_fn {
+  /// Overload that statically asserts partitionability and forwards the range unchanged.
+  template <class Range>
+  constexpr auto operator()(Range&& range) const {
+    using range_type = std::remove_reference_t<Range>;
+    static_assert(
+        ranges::random_access_range<range_type>,
+        "range must be random access for parallel stages to partition it; "
+        "a view adaptor upstream downgraded the iterator category");
+    static_assert(
+        ranges::sized_range<range_type>,
+        "range must be sized for parallel stages to partition it; "
+        "a view adaptor upstream dropped the size");
+    static_assert(
+        ranges::sized_sentinel_for<ranges::iterator_t<range_type>, ranges::iterator_t<range_type>>,
+        "range iterator difference must be O(1) for parallel stages to partition it");
+    return ranges::views::all(std::forward<Range>(range));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// passes a range through unchanged while statically asserting it can be partitioned.
+/**
+ * Insert it into a pipeline ahead of a parallel stage to turn an accidental range
+ * category downgrade — a composition that loses random access, size, or O(1)
+ * iterator difference — into a compile-time diagnostic at the point of loss,
+ * instead of a silent serialization of the stage.
+ */
+inline constexpr ranges::views::view_closure<detail::assert_partitionable_fn> assert_partitionable;
+
+}  // namespace beluga::views
+
+#endif
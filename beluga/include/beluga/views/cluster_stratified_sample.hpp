@@ -0,0 +1,195 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_VIEWS_CLUSTER_STRATIFIED_SAMPLE_HPP
+#define BELUGA_VIEWS_CLUSTER_STRATIFIED_SAMPLE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/view/common.hpp>
+#include <range/v3/view/transform.hpp>
+
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+#include <beluga/views/sample.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a cluster-stratified sample (with replacement) range adaptor object.
+ */
+
+namespace beluga::views {
+
+namespace detail {
+
+/// Computes per-particle sampling weights that enforce a minimum share per cluster.
+/**
+ * Each cluster's total sampling probability is floored at `min_cluster_share`: clusters
+ * below the floor get their weights scaled up to exactly meet it, clusters above it are
+ * scaled down by a common factor so the shares still sum to one, and relative weights
+ * within a cluster are preserved. The factor is found with a water-filling pass over the
+ * per-cluster totals in ascending order, so the guarantee is exact rather than
+ * approximate. Clusters with zero total weight cannot be boosted by scaling and keep
+ * zero share.
+ *
+ * \tparam Weights The range type for particle weights.
+ * \tparam Clusters The range type for particle cluster ids; ids must be dense, as
+ *  produced by beluga::ParticleClusterizer.
+ * \param weights A range of particle weights.
+ * \param clusters A range of particle cluster ids, one per particle.
+ * \param min_cluster_share Minimum share of the sampling distribution per cluster,
+ *  clamped to the uniform share when the cluster count makes it infeasible.
+ * \return The adjusted per-particle sampling weights.
+ */
+template <class Weights, class Clusters>
+[[nodiscard]] std::vector<double> stratify_cluster_weights(  //
+    Weights&& weights,
+    Clusters&& clusters,
+    double min_cluster_share) {
+  std::vector<double> stratified;
+  for (const double weight : weights | ranges::views::common) {
+    stratified.push_back(weight);
+  }
+
+  std::vector<double> totals;
+  {
+    std::size_t index = 0;
+    for (const std::size_t cluster : clusters | ranges::views::common) {
+      if (cluster >= totals.size()) {
+        totals.resize(cluster + 1, 0.0);
+      }
+      totals[cluster] += stratified[index++];
+    }
+    assert(index == stratified.size());
+  }
+
+  const double total = std::accumulate(totals.begin(), totals.end(), 0.0);
+  const auto num_weighted =
+      static_cast<std::size_t>(std::count_if(totals.begin(), totals.end(), [](double value) { return value > 0.0; }));
+  if (total <= 0.0 || num_weighted < 2 || min_cluster_share <= 0.0) {
+    return stratified;  // nothing to stratify
+  }
+
+  // Asking for more than the uniform share is infeasible; clamp to an even split.
+  min_cluster_share = std::min(min_cluster_share, 1.0 / static_cast<double>(num_weighted));
+
+  // Water-filling: boost the k clusters with the smallest shares to exactly the floor,
+  // scaling the rest by a common factor alpha so the shares still sum to one, with k
+  // the smallest count for which no unboosted cluster falls below the floor.
+  std::vector<std::size_t> order;
+  order.reserve(num_weighted);
+  for (std::size_t cluster = 0; cluster < totals.size(); ++cluster) {
+    if (totals[cluster] > 0.0) {
+      order.push_back(cluster);
+    }
+  }
+  std::sort(order.begin(), order.end(), [&totals](std::size_t lhs, std::size_t rhs) {
+    return totals[lhs] < totals[rhs];
+  });
+
+  std::size_t num_boosted = 0;
+  double alpha = 1.0;
+  double unboosted_share = 1.0;
+  while (num_boosted < order.size()) {
+    alpha = (1.0 - static_cast<double>(num_boosted) * min_cluster_share) / unboosted_share;
+    const double next_share = totals[order[num_boosted]] / total;
+    if (alpha * next_share >= min_cluster_share) {
+      break;
+    }
+    unboosted_share -= next_share;
+    ++num_boosted;
+  }
+
+  std::vector<double> multipliers(totals.size(), alpha);
+  for (std::size_t i = 0; i < num_boosted; ++i) {
+    multipliers[order[i]] = min_cluster_share * total / totals[order[i]];
+  }
+
+  {
+    std::size_t index = 0;
+    for (const std::size_t cluster : clusters | ranges::views::common) {
+      stratified[index++] *= multipliers[cluster];
+    }
+  }
+  return stratified;
+}
+
+/// Implementation detail for a cluster-stratified sample range adaptor object.
+struct cluster_stratified_sample_fn : public sample_base_fn {
+  /// Overload that samples from a particle range with per-cluster survival quotas.
+  template <class Range, class Clusters, class URNG>
+  constexpr auto operator()(Range&& range, Clusters&& clusters, double min_cluster_share, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    static_assert(beluga::is_particle_range_v<Range>);
+    auto weights = stratify_cluster_weights(beluga::views::weights(range), clusters, min_cluster_share);
+    return sample_from_range(beluga::views::states(range), weights, engine) |
+           ranges::views::transform(beluga::make_from_state<ranges::range_value_t<Range>>);
+  }
+
+  /// Overload that uses a default random engine.
+  template <class Range, class Clusters>
+  constexpr auto operator()(Range&& range, Clusters&& clusters, double min_cluster_share) const {
+    return (*this)(
+        std::forward<Range>(range), std::forward<Clusters>(clusters), min_cluster_share,
+        ranges::detail::get_random_engine());
+  }
+
+  /// Overload that returns a view closure to be piped from a particle range.
+  /**
+   * The cluster ids are captured by reference; they must outlive the returned closure.
+   */
+  template <class Clusters>
+  constexpr auto operator()(const Clusters& clusters, double min_cluster_share) const {
+    return ranges::make_view_closure(
+        ranges::bind_back(cluster_stratified_sample_fn{}, std::cref(clusters), min_cluster_share));
+  }
+
+  /// Overload that unwraps the cluster id reference from a view closure.
+  template <class Range, class Clusters>
+  constexpr auto operator()(Range&& range, std::reference_wrapper<const Clusters> clusters, double min_cluster_share)
+      const {
+    return (*this)(std::forward<Range>(range), clusters.get(), min_cluster_share);
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// will randomly sample with replacement from a particle range with per-cluster quotas.
+/**
+ * A drop-in alternative to `beluga::views::sample` in the resample pipeline for symmetric
+ * or ambiguous environments, where plain weighted resampling starves minority modes and
+ * keeping second hypotheses alive otherwise requires inflating the particle count.
+ * Given per-particle cluster ids (as produced by beluga::ParticleClusterizer), the
+ * sampling distribution is adjusted so every cluster with nonzero weight retains at
+ * least `min_cluster_share` of the expected survivors, while relative weights within a
+ * cluster are preserved. Everything else matches `beluga::views::sample`: samples are
+ * drawn with replacement, the view is infinite so it composes with `take_while_kld`,
+ * and new particles come out with unit weight.
+ */
+inline constexpr detail::cluster_stratified_sample_fn cluster_stratified_sample;
+
+}  // namespace beluga::views
+
+#endif
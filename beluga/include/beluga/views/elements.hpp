@@ -15,7 +15,10 @@
 #ifndef BELUGA_VIEWS_ELEMENTS_HPP
 #define BELUGA_VIEWS_ELEMENTS_HPP
 
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include <range/v3/view/transform.hpp>
 
@@ -26,15 +29,70 @@
 
 namespace beluga::views {
 
+namespace detail {
+
+/// Detects containers that expose their element columns as contiguous ranges.
+/**
+ * Satisfied by structure-of-arrays containers such as beluga::TupleVector, whose
+ * `column<I>()` accessors return a span over the underlying storage of the I-th
+ * element column.
+ */
+template <class T, class = void>
+struct has_contiguous_columns : std::false_type {};
+
+/// Specialization for containers with `column()` span accessors.
+template <class T>
+struct has_contiguous_columns<T, std::void_t<decltype(std::declval<T&>().template column<0>())>> : std::true_type {};
+
+/// Whether the N-th element column of `T` can be accessed as a contiguous span.
+template <std::size_t N, class T, class = void>
+struct has_nth_column : std::false_type {};
+
+/// Specialization for containers with contiguous columns and at least `N + 1` of them.
+template <std::size_t N, class T>
+struct has_nth_column<N, T, std::enable_if_t<has_contiguous_columns<T>::value>>
+    : std::bool_constant<(N < std::tuple_size_v<typename T::value_type>)> {};
+
+/// Implementation detail for an elements range adaptor object.
+template <std::size_t N>
+struct elements_fn {
+  /// Overload that returns the contiguous N-th element column of a structure-of-arrays container.
+  /**
+   * Restricted to lvalue containers, since the returned span aliases storage owned by the input.
+   */
+  template <class Range, std::enable_if_t<has_nth_column<N, Range>::value, int> = 0>
+  constexpr auto operator()(Range& range) const noexcept {
+    return range.template column<N>();
+  }
+
+  /// Overload that applies `std::get<N>` to each value in the range lazily.
+  template <class Range, std::enable_if_t<!has_nth_column<N, std::remove_reference_t<Range>>::value, int> = 0>
+  constexpr auto operator()(Range&& range) const {
+    return ranges::views::transform(
+        std::forward<Range>(range),
+        [](auto&& tuple) -> decltype(auto) { return std::get<N>(std::forward<decltype(tuple)>(tuple)); });
+  }
+
+  /// Pipe operator overload, for range adaptor object compliance.
+  template <class Range>
+  friend constexpr auto operator|(Range&& range, const elements_fn& fn) {
+    return fn(std::forward<Range>(range));
+  }
+};
+
+}  // namespace detail
+
 /// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
 /// will apply `std::get<N>` to each value in the range lazily.
 /**
+ * For structure-of-arrays containers with contiguous columns (e.g. beluga::TupleVector) the
+ * adaptor returns a span over the N-th column instead, so iteration runs over a plain array
+ * with no per-element proxy tuples involved.
+ *
  * \tparam N Element to get from the array or tuple.
- * \param tuple Tuple or array instance, with at least `N + 1` elements.
  */
 template <std::size_t N>
-inline constexpr auto elements = ranges::views::transform(
-    [](auto&& tuple) -> decltype(auto) { return std::get<N>(std::forward<decltype(tuple)>(tuple)); });
+inline constexpr detail::elements_fn<N> elements;
 
 }  // namespace beluga::views
 
@@ -0,0 +1,247 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_VIEWS_LOW_VARIANCE_SAMPLE_HPP
+#define BELUGA_VIEWS_LOW_VARIANCE_SAMPLE_HPP
+
+#include <cassert>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <range/v3/utility/random.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/common.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/transform.hpp>
+
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of systematic and stratified sample range adaptor objects.
+ */
+
+namespace beluga::views {
+
+namespace detail {
+
+/// Implementation of the systematic / stratified sample view.
+/**
+ * Unlike `sample_view`, which draws each element independently from the weight
+ * distribution, this view performs the classical low-variance cumulative-sum sweep:
+ * the k-th draw targets position `(k + u) * W / N` in the cumulative weight profile,
+ * where `W` is the total weight and `N` the population size. Since targets are
+ * monotonically increasing, each full sweep of `N` draws costs O(N) with purely
+ * sequential memory access. The sweep restarts with a fresh random offset every
+ * `N` draws, making the view infinite so it composes with `take_while_kld`.
+ *
+ * \tparam Range A [random access](https://en.cppreference.com/w/cpp/ranges/random_access_range) and
+ *  [sized](https://en.cppreference.com/w/cpp/ranges/sized_range) range.
+ * \tparam URNG A random number generator that satisfies the
+ *  [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
+ *  requirements.
+ */
+template <class Range, class URNG = typename ranges::detail::default_random_engine>
+struct low_variance_sample_view
+    : public ranges::view_facade<low_variance_sample_view<Range, URNG>, ranges::infinite> {
+ public:
+  /// Default constructor.
+  low_variance_sample_view() = default;
+
+  /// Construct the view from an existing range.
+  /**
+   * \param range The range to be adapted.
+   * \param cumulative Cumulative sums of the element weights, one per range element.
+   * \param stratified Whether to jitter each draw independently within its stratum
+   *  (stratified resampling) or use a single offset per sweep (systematic resampling).
+   * \param engine The random number generator object.
+   */
+  constexpr low_variance_sample_view(
+      Range range,
+      std::vector<double> cumulative,
+      bool stratified,
+      URNG& engine = ranges::detail::get_random_engine())
+      : range_{std::move(range)},
+        cumulative_{std::move(cumulative)},
+        stratified_{stratified},
+        engine_{std::addressof(engine)} {
+    assert(!cumulative_.empty());
+    assert(cumulative_.back() > 0.0);
+    assert(cumulative_.size() == static_cast<std::size_t>(ranges::size(range_)));
+    step_ = cumulative_.back() / static_cast<double>(cumulative_.size());
+  }
+
+ private:
+  // `ranges::range_access` needs access to the cursor members.
+  friend ranges::range_access;
+
+  static_assert(ranges::sized_range<Range>);
+  static_assert(ranges::random_access_range<Range>);
+
+  /// Cursor class that handles the iteration logic.
+  struct cursor {
+   public:
+    /// Default constructor.
+    cursor() = default;
+
+    /// Construct a cursor from the parent view elements.
+    constexpr explicit cursor(low_variance_sample_view* view) : view_(view), first_{ranges::begin(view_->range_)} {
+      view_->start_sweep();
+    }
+
+    /// Access the current iterator.
+    [[nodiscard]] constexpr decltype(auto) read() const {
+      return *(first_ + static_cast<difference_type>(view_->index_));
+    }
+
+    /// Position the current iterator.
+    constexpr void next() { view_->advance(); }
+
+   private:
+    using difference_type = ranges::range_difference_t<Range>;
+
+    low_variance_sample_view* view_;
+    ranges::iterator_t<Range> first_;
+  };
+
+  /// Return the cursor for the begin iterator.
+  [[nodiscard]] constexpr auto begin_cursor() { return cursor{this}; }
+
+  /// Return an unreachable sentinel since this is an infinite range.
+  [[nodiscard]] constexpr auto end_cursor() const noexcept { return ranges::unreachable_sentinel_t{}; }
+
+  /// Start a new sweep over the cumulative weight profile with a fresh random offset.
+  constexpr void start_sweep() {
+    offset_ = uniform_(*engine_);
+    draw_ = 0;
+    index_ = 0;
+    position_ = offset_ * step_;
+    locate();
+  }
+
+  /// Move to the target position of the next draw, restarting the sweep if it is over.
+  constexpr void advance() {
+    ++draw_;
+    if (draw_ == cumulative_.size()) {
+      start_sweep();
+      return;
+    }
+    const double jitter = stratified_ ? uniform_(*engine_) : offset_;
+    position_ = (static_cast<double>(draw_) + jitter) * step_;
+    locate();
+  }
+
+  /// Advance the element index until the cumulative weight reaches the target position.
+  /**
+   * Target positions are monotonically increasing within a sweep, so the index only
+   * ever moves forward and a full sweep costs O(N) overall.
+   */
+  constexpr void locate() {
+    while (cumulative_[index_] < position_ && index_ + 1U < cumulative_.size()) {
+      ++index_;
+    }
+  }
+
+  Range range_;
+  std::vector<double> cumulative_;
+  bool stratified_{false};
+  URNG* engine_;
+  std::uniform_real_distribution<double> uniform_{0.0, 1.0};
+  double step_{0.0};
+  double offset_{0.0};
+  double position_{0.0};
+  std::size_t draw_{0};
+  std::size_t index_{0};
+};
+
+/// Implementation detail for systematic / stratified sample range adaptor objects.
+template <bool Stratified>
+struct low_variance_sample_fn {
+  /// Overload that samples from weighted ranges.
+  template <
+      class Range,
+      class Weights,
+      class URNG,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<ranges::range<Weights>, int> = 0>
+  constexpr auto operator()(Range&& range, Weights&& weights, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    static_assert(ranges::input_range<Weights>);
+    auto cumulative = std::vector<double>{};
+    cumulative.reserve(static_cast<std::size_t>(ranges::size(range)));
+    double accumulated = 0.0;
+    for (const double weight : weights | ranges::views::common) {
+      accumulated += weight;
+      cumulative.push_back(accumulated);
+    }
+    return low_variance_sample_view{
+        ranges::views::all(std::forward<Range>(range)), std::move(cumulative), Stratified, engine};
+  }
+
+  /// Overload that samples from any range.
+  /**
+   * If the input range is a particle range, it will extract the weights and treat it as
+   * a weighted range. As with `beluga::views::sample`, the new particles will all have a
+   * weight equal to 1, since after resampling the probability is represented by the
+   * number of particles rather than their individual weight.
+   *
+   * If the input range is not a particle range, it will assume a uniform distribution.
+   */
+  template <class Range, class URNG, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    if constexpr (beluga::is_particle_range_v<Range>) {
+      return (*this)(beluga::views::states(range), beluga::views::weights(range), engine) |
+             ranges::views::transform(beluga::make_from_state<ranges::range_value_t<Range>>);
+    } else {
+      auto cumulative = std::vector<double>(static_cast<std::size_t>(ranges::size(range)));
+      std::iota(cumulative.begin(), cumulative.end(), 1.0);
+      return low_variance_sample_view{
+          ranges::views::all(std::forward<Range>(range)), std::move(cumulative), Stratified, engine};
+    }
+  }
+
+  /// Overload that uses a default random engine.
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range) const {
+    return (*this)(std::forward<Range>(range), ranges::detail::get_random_engine());
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// implements O(N) systematic resampling over an input particle range.
+/**
+ * A drop-in alternative to `beluga::views::sample` in the resample pipeline, trading
+ * the per-draw binary search of multinomial resampling for a single-pass cumulative-sum
+ * sweep with one uniform draw per sweep and sequential memory access.
+ */
+inline constexpr ranges::views::view_closure<detail::low_variance_sample_fn<false>> systematic_sample;
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// implements O(N) stratified resampling over an input particle range.
+/**
+ * Like `beluga::views::systematic_sample`, but each draw is jittered independently
+ * within its stratum instead of reusing a single sweep offset.
+ */
+inline constexpr ranges::views::view_closure<detail::low_variance_sample_fn<true>> stratified_sample;
+
+}  // namespace beluga::views
+
+#endif
@@ -15,7 +15,13 @@
 #ifndef BELUGA_VIEWS_PARTICLES_HPP
 #define BELUGA_VIEWS_PARTICLES_HPP
 
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 #include <beluga/primitives.hpp>
+#include <beluga/type_traits/tuple_traits.hpp>
+#include <beluga/views/elements.hpp>
 #include <range/v3/view/transform.hpp>
 
 /**
@@ -25,13 +31,166 @@
 
 namespace beluga::views {
 
+namespace detail {
+
+/// Whether the states of `T` can be accessed as a contiguous span of its first element column.
+template <class T, class = void>
+struct has_state_column : std::false_type {};
+
+/// Specialization for containers with contiguous columns storing tuples of two or more elements.
+template <class T>
+struct has_state_column<T, std::enable_if_t<has_contiguous_columns<T>::value>>
+    : std::bool_constant<(std::tuple_size_v<typename T::value_type> > 1)> {};
+
+/// Whether `T` stores a single `Element` instance per particle in a contiguous column of its own.
+template <class Element, class T, class = void>
+struct has_element_column : std::false_type {};
+
+/// Specialization for containers with contiguous columns.
+template <class Element, class T>
+struct has_element_column<Element, T, std::enable_if_t<has_contiguous_columns<T>::value>>
+    : beluga::has_single_element<Element, typename T::value_type> {};
+
+/// Implementation detail for a particle range adaptor object.
+/**
+ * \tparam Element Tagged element type to extract from each particle (e.g. beluga::Weight).
+ * \tparam Projection Callable used to project each particle in the fallback path.
+ */
+template <class Element, class Projection>
+struct tagged_element_view_fn {
+  /// Overload that returns the contiguous element column of a structure-of-arrays container.
+  /**
+   * Restricted to lvalue containers, since the returned span aliases storage owned by the input.
+   */
+  template <class Range, std::enable_if_t<has_element_column<Element, Range>::value, int> = 0>
+  constexpr auto operator()(Range& range) const noexcept {
+    return range.template column<tuple_index_v<Element, typename Range::value_type>>();
+  }
+
+  /// Overload that obtains a reference to the element of each particle in the range lazily.
+  template <
+      class Range,
+      std::enable_if_t<!has_element_column<Element, std::remove_reference_t<Range>>::value, int> = 0>
+  constexpr auto operator()(Range&& range) const {
+    return ranges::views::transform(std::forward<Range>(range), Projection{});
+  }
+
+  /// Pipe operator overload, for range adaptor object compliance.
+  template <class Range>
+  friend constexpr auto operator|(Range&& range, const tagged_element_view_fn& fn) {
+    return fn(std::forward<Range>(range));
+  }
+};
+
+/// Implementation detail for a states range adaptor object.
+struct states_fn {
+  /// Overload that returns the contiguous state column of a structure-of-arrays container.
+  /**
+   * Restricted to lvalue containers, since the returned span aliases storage owned by the input.
+   */
+  template <class Range, std::enable_if_t<has_state_column<Range>::value, int> = 0>
+  constexpr auto operator()(Range& range) const noexcept {
+    return range.template column<0>();
+  }
+
+  /// Overload that obtains a reference to the state of each particle in the range lazily.
+  template <class Range, std::enable_if_t<!has_state_column<std::remove_reference_t<Range>>::value, int> = 0>
+  constexpr auto operator()(Range&& range) const {
+    return ranges::views::transform(std::forward<Range>(range), beluga::state);
+  }
+
+  /// Pipe operator overload, for range adaptor object compliance.
+  template <class Range>
+  friend constexpr auto operator|(Range&& range, const states_fn& fn) {
+    return fn(std::forward<Range>(range));
+  }
+};
+
+/// Implementation detail for a weights range adaptor object.
+/**
+ * Unlike the other tagged adaptors, weights may be stored either as `beluga::Weight` or
+ * as its single-precision counterpart `beluga::WeightF`, so both column layouts get the
+ * contiguous fast path.
+ */
+struct weights_fn {
+  /// Overload that returns the contiguous weight column of a structure-of-arrays container.
+  /**
+   * Restricted to lvalue containers, since the returned span aliases storage owned by the input.
+   */
+  template <class Range, std::enable_if_t<has_element_column<beluga::Weight, Range>::value, int> = 0>
+  constexpr auto operator()(Range& range) const noexcept {
+    return range.template column<tuple_index_v<beluga::Weight, typename Range::value_type>>();
+  }
+
+  /// Overload that returns the contiguous single-precision weight column of a structure-of-arrays container.
+  template <
+      class Range,
+      std::enable_if_t<
+          !has_element_column<beluga::Weight, Range>::value &&  //
+              has_element_column<beluga::WeightF, Range>::value,
+          int> = 0>
+  constexpr auto operator()(Range& range) const noexcept {
+    return range.template column<tuple_index_v<beluga::WeightF, typename Range::value_type>>();
+  }
+
+  /// Overload that obtains a reference to the weight of each particle in the range lazily.
+  template <
+      class Range,
+      std::enable_if_t<
+          !has_element_column<beluga::Weight, std::remove_reference_t<Range>>::value &&
+              !has_element_column<beluga::WeightF, std::remove_reference_t<Range>>::value,
+          int> = 0>
+  constexpr auto operator()(Range&& range) const {
+    return ranges::views::transform(std::forward<Range>(range), beluga::weight);
+  }
+
+  /// Pipe operator overload, for range adaptor object compliance.
+  template <class Range>
+  friend constexpr auto operator|(Range&& range, const weights_fn& fn) {
+    return fn(std::forward<Range>(range));
+  }
+};
+
+/// Implementation detail for a log-weights range adaptor object.
+using log_weights_fn = tagged_element_view_fn<beluga::LogWeight, std::decay_t<decltype(beluga::log_weight)>>;
+
+/// Implementation detail for a multiplicities range adaptor object.
+using multiplicities_fn = tagged_element_view_fn<beluga::Multiplicity, std::decay_t<decltype(beluga::multiplicity)>>;
+
+}  // namespace detail
+
 /// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
 /// will obtain a reference to the state of each particle in the input range lazily.
-inline constexpr auto states = ranges::views::transform(beluga::state);
+/**
+ * For structure-of-arrays containers with contiguous columns (e.g. beluga::TupleVector) the
+ * adaptor returns a span over the state column instead, so consumers like beluga::estimate
+ * iterate a plain state array with no per-particle proxy tuples involved.
+ */
+inline constexpr detail::states_fn states;
 
 /// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
 /// will obtain a reference to the weight of each particle in the input range lazily.
-inline constexpr auto weights = ranges::views::transform(beluga::weight);
+/**
+ * For structure-of-arrays containers with contiguous columns (e.g. beluga::TupleVector) the
+ * adaptor returns a span over the weight column instead.
+ */
+inline constexpr detail::weights_fn weights;
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// will obtain a reference to the log-domain weight of each particle in the input range lazily.
+/**
+ * For structure-of-arrays containers with contiguous columns (e.g. beluga::TupleVector) the
+ * adaptor returns a span over the log-weight column instead.
+ */
+inline constexpr detail::log_weights_fn log_weights;
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// will obtain a reference to the multiplicity of each particle in the input range lazily.
+/**
+ * For structure-of-arrays containers with contiguous columns (e.g. beluga::TupleVector) the
+ * adaptor returns a span over the multiplicity column instead.
+ */
+inline constexpr detail::multiplicities_fn multiplicities;
 
 }  // namespace beluga::views
 
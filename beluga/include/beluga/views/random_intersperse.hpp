@@ -68,7 +68,7 @@ struct random_intersperse_view
       URNG& engine = ranges::detail::get_random_engine())
       : random_intersperse_view::view_adaptor{std::move(range)},
         fn_{std::move(fn)},
-        distribution_{probability},
+        probability_{probability},
         engine_{std::addressof(engine)} {}
 
  private:
@@ -112,11 +112,35 @@ struct random_intersperse_view
   [[nodiscard]] constexpr auto begin_adaptor() { return adaptor{this}; }
 
   /// Return whether we should intersperse a value or increment the input iterator.
-  [[nodiscard]] constexpr bool should_intersperse() { return distribution_(*engine_); }
+  /**
+   * Equivalent to an independent Bernoulli trial per iteration, but implemented by
+   * drawing geometric skip-lengths: a single RNG call yields the number of source
+   * elements to pass through before the next insertion, so low probabilities cost
+   * roughly one RNG call per 1/p elements instead of one per element.
+   */
+  [[nodiscard]] constexpr bool should_intersperse() {
+    if (!(probability_ > 0.0)) {
+      return false;
+    }
+    if (skip_ < 0) {
+      skip_ = probability_ < 1.0
+                  ? distribution_(*engine_, typename std::geometric_distribution<long>::param_type{probability_})
+                  : 0;
+    }
+    if (skip_ == 0) {
+      skip_ = -1;
+      return true;
+    }
+    --skip_;
+    return false;
+  }
 
   ranges::semiregular_box_t<Fn> fn_;
-  std::bernoulli_distribution distribution_;
+  double probability_{0.0};
+  std::geometric_distribution<long> distribution_;
   URNG* engine_;
+  /// Remaining source elements before the next insertion, -1 if not drawn yet.
+  long skip_{-1};
 };
 
 /// Implementation detail for a random_intersperse range adaptor object.
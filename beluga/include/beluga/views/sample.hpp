@@ -15,13 +15,19 @@
 #ifndef BELUGA_VIEWS_SAMPLE_HPP
 #define BELUGA_VIEWS_SAMPLE_HPP
 
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
 #include <random>
 
+#include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/utility/random.hpp>
 #include <range/v3/view/common.hpp>
 #include <range/v3/view/generate.hpp>
 
 #include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/tracepoints.hpp>
 #include <beluga/views/particles.hpp>
 
 /**
@@ -106,6 +112,50 @@ struct sample_view : public ranges::view_facade<sample_view<Range, Distribution,
   URNG* engine_;
 };
 
+/// Distribution adaptor that draws from a caller-owned distribution by reference.
+/**
+ * `sample_view` stores its distribution by value, which makes every view construction
+ * copy (or rebuild) the cumulative weight machinery. Wrapping a caller-owned
+ * distribution in this adaptor lets the caller keep the distribution storage alive
+ * across view constructions and rebuild it in place between resamples, e.g. with
+ * `beluga::DiscreteAliasDistribution::assign()`. The referenced distribution must
+ * outlive the view.
+ *
+ * \tparam Distribution A random number distribution that satisfies the
+ *  [RandomNumberDistribution](https://en.cppreference.com/w/cpp/named_req/RandomNumberDistribution).
+ */
+template <class Distribution>
+class borrowed_distribution {
+ public:
+  /// The result type generated by the distribution.
+  using result_type = typename Distribution::result_type;
+
+  /// Default constructor.
+  borrowed_distribution() = default;
+
+  /// Construct the adaptor over an existing distribution.
+  /**
+   * \param distribution The distribution to draw from.
+   */
+  constexpr explicit borrowed_distribution(Distribution& distribution)
+      : distribution_{std::addressof(distribution)} {}
+
+  /// Generate a random sample from the referenced distribution.
+  template <class URNG>
+  [[nodiscard]] result_type operator()(URNG& engine) {
+    return (*distribution_)(engine);
+  }
+
+  /// Returns the minimum value potentially generated by the referenced distribution.
+  [[nodiscard]] result_type min() const { return distribution_->min(); }
+
+  /// Returns the maximum value potentially generated by the referenced distribution.
+  [[nodiscard]] result_type max() const { return distribution_->max(); }
+
+ private:
+  Distribution* distribution_ = nullptr;
+};
+
 /// \cond
 
 template <class T, class Enable = void>
@@ -131,7 +181,11 @@ struct sample_base_fn {
     static_assert(ranges::input_range<Weights>);
     using result_type = ranges::range_difference_t<Range>;
     auto w = ranges::views::common(weights);
+    // The distribution constructor builds the cumulative weight table eagerly,
+    // which is the only O(n) part of the resampling setup.
+    BELUGA_TRACEPOINT(sample_setup_begin);
     auto distribution = std::discrete_distribution<result_type>{ranges::begin(w), ranges::end(w)};
+    BELUGA_TRACEPOINT(sample_setup_end);
     return sample_view{ranges::views::all(std::forward<Range>(range)), std::move(distribution), engine};
   }
 
@@ -150,6 +204,17 @@ struct sample_base_fn {
     if constexpr (beluga::is_particle_range_v<Range>) {
       return sample_from_range(beluga::views::states(range), beluga::views::weights(range), engine) |
              ranges::views::transform(beluga::make_from_state<ranges::range_value_t<Range>>);
+    } else if constexpr (beluga::is_log_weight_particle_range_v<Range>) {
+      // Map log-domain weights back to the linear domain, shifting by the maximum
+      // for numerical stability. The shift cancels out in the weight distribution.
+      auto log_weights = range | beluga::views::log_weights | ranges::views::common;
+      const double max = ranges::accumulate(
+          log_weights, std::numeric_limits<double>::lowest(),
+          [](double lhs, double rhs) { return std::max(lhs, rhs); });
+      auto weights =
+          log_weights | ranges::views::transform([max](double log_weight) { return std::exp(log_weight - max); });
+      return sample_from_range(beluga::views::states(range), std::move(weights), engine) |
+             ranges::views::transform(beluga::make_from_state<ranges::range_value_t<Range>>);
     } else {
       using result_type = ranges::range_difference_t<Range>;
       auto distribution =
@@ -213,6 +278,22 @@ struct sample_fn : public sample_base_fn {
     static_assert(ranges::range<Range>);
     return sample_from_range(std::forward<Range>(range), engine.get());
   }
+
+  /// Overload that samples from a range through a caller-owned distribution.
+  /**
+   * The distribution is held by reference instead of being copied into the view, so its
+   * weight tables can be rebuilt in place by the caller across resamples (e.g. with
+   * `beluga::DiscreteAliasDistribution::assign()`) without reallocating. The referenced
+   * distribution must already span `[0, size)` for the given range and outlive the view.
+   */
+  template <class Range, class Distribution, class URNG>
+  constexpr auto operator()(Range&& range, std::reference_wrapper<Distribution> distribution, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    return sample_view{
+        ranges::views::all(std::forward<Range>(range)), borrowed_distribution<Distribution>{distribution.get()},
+        engine};
+  }
 };
 
 }  // namespace detail
@@ -0,0 +1,91 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_VIEWS_SAMPLE_ALIAS_HPP
+#define BELUGA_VIEWS_SAMPLE_ALIAS_HPP
+
+#include <random>
+
+#include <range/v3/utility/random.hpp>
+#include <range/v3/view/transform.hpp>
+
+#include <beluga/random/discrete_alias_distribution.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+#include <beluga/views/sample.hpp>
+
+/**
+ * \file
+ * \brief Implementation of an alias-table sample (with replacement) range adaptor object.
+ */
+
+namespace beluga::views {
+
+namespace detail {
+
+/// Implementation detail for a sample_alias range adaptor object.
+struct sample_alias_fn {
+  /// Overload that samples from weighted ranges.
+  template <
+      class Range,
+      class Weights,
+      class URNG,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<ranges::range<Weights>, int> = 0>
+  constexpr auto operator()(Range&& range, Weights&& weights, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    static_assert(ranges::input_range<Weights>);
+    using result_type = ranges::range_difference_t<Range>;
+    auto distribution = beluga::DiscreteAliasDistribution<result_type>{std::forward<Weights>(weights)};
+    return sample_view{ranges::views::all(std::forward<Range>(range)), std::move(distribution), engine};
+  }
+
+  /// Overload that samples from particle ranges.
+  /**
+   * The weights are extracted from the particles and the alias table is built once from
+   * them, after which each draw costs O(1) with two array reads. As with
+   * `beluga::views::sample`, the new particles will all have a weight equal to 1.
+   */
+  template <class Range, class URNG, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    static_assert(beluga::is_particle_range_v<Range>);
+    return (*this)(beluga::views::states(range), beluga::views::weights(range), engine) |
+           ranges::views::transform(beluga::make_from_state<ranges::range_value_t<Range>>);
+  }
+
+  /// Overload that uses a default random engine.
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range) const {
+    return (*this)(std::forward<Range>(range), ranges::detail::get_random_engine());
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// will randomly sample with replacement using a Walker alias table.
+/**
+ * Semantically equivalent to `beluga::views::sample` over a particle range, but the
+ * weight distribution is precomputed into an alias table in O(N), turning the per-draw
+ * binary search into two array reads. Best suited for repeated large batches of draws
+ * from the same static weight vector, e.g. global relocalization flows.
+ */
+inline constexpr ranges::views::view_closure<detail::sample_alias_fn> sample_alias;
+
+}  // namespace beluga::views
+
+#endif
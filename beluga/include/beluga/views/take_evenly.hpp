@@ -109,7 +109,7 @@ struct take_evenly_view : public ranges::view_facade<take_evenly_view<Range>, ra
         class T = Range,
         std::enable_if_t<std::is_same_v<T, Range> && ranges::random_access_range<Range>, int> = 0>
     [[nodiscard]] constexpr std::ptrdiff_t distance_to(const ranges::default_sentinel_t&) const {
-      return static_cast<std::ptrdiff_t>(view_->count_) - static_cast<std::ptrdiff_t>(pos_);
+      return static_cast<std::ptrdiff_t>(view_->size()) - static_cast<std::ptrdiff_t>(pos_);
     }
 
    private:
@@ -16,12 +16,15 @@
 #define BELUGA_VIEWS_TAKE_WHILE_KLD_HPP
 
 #include <cmath>
-#include <unordered_set>
+#include <memory_resource>
+#include <vector>
 
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/take_while.hpp>
 
+#include <beluga/containers/spatial_hash_set.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/tracepoints.hpp>
 
 /**
  * \file
@@ -61,6 +64,8 @@ constexpr double kDefaultKldZ = 3.;
  *  distrubution.
  * \param z Upper standard normal quantile for the probability that the error in the
  *  estimated distribution is less than epsilon.
+ * \param resource Memory resource the bucket set draws from. Pass a monotonic or pooled
+ *  resource to keep bucket tracking from hitting the global allocator on every resample.
  * \return A callable object with prototype `(std::size_t hash) -> bool`.
  *  `hash` is the spatial hash of the particle being added. \n
  *  The returned callable object is stateful, tracking the total number of particles and
@@ -69,21 +74,37 @@ constexpr double kDefaultKldZ = 3.;
  *  and the KLD condition is satisfied, if not it will be true. \n
  *  i.e. A return value of true means that you need to keep sampling to satisfy the condition.
  */
-inline auto kld_condition(std::size_t min, double epsilon, double z = beluga::detail::kDefaultKldZ) {
-  auto target_size = [two_epsilon = 2 * epsilon, z](std::size_t k) {
+inline auto kld_condition(
+    std::size_t min,
+    double epsilon,
+    double z = beluga::detail::kDefaultKldZ,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+  // The Wilson-Hilferty approximation below only depends on the bucket count, a small
+  // integer that grows by at most one per inserted particle, so thresholds are cached
+  // in a lazily grown lookup table and the per-particle check in the steady state is
+  // a table read and a comparison instead of a std::pow-grade evaluation.
+  auto target_size = [two_epsilon = 2 * epsilon, z, table = std::vector<std::size_t>{}](std::size_t k) mutable {
     if (k <= 2U) {
       return std::numeric_limits<std::size_t>::max();
     }
-    const double common = 2. / static_cast<double>(9 * (k - 1));
-    const double base = 1. - common + std::sqrt(common) * z;
-    const double result = (static_cast<double>(k - 1) / two_epsilon) * base * base * base;
-    return static_cast<std::size_t>(std::ceil(result));
+    while (table.size() <= k - 3U) {
+      const std::size_t next = table.size() + 3U;
+      const double common = 2. / static_cast<double>(9 * (next - 1));
+      const double base = 1. - common + std::sqrt(common) * z;
+      const double result = (static_cast<double>(next - 1) / two_epsilon) * base * base * base;
+      table.push_back(static_cast<std::size_t>(std::ceil(result)));
+    }
+    return table[k - 3U];
   };
 
-  return [=, count = 0ULL, buckets = std::unordered_set<std::size_t>{}](std::size_t hash) mutable {
+  return [=, count = 0ULL, buckets = beluga::SpatialHashSet{min, resource}](std::size_t hash) mutable {
     count++;
     buckets.insert(hash);
-    return count <= min || count <= target_size(buckets.size());
+    const bool keep_sampling = count <= min || count <= target_size(buckets.size());
+    if (!keep_sampling) {
+      BELUGA_TRACEPOINT2(kld_condition_met, count, buckets.size());
+    }
+    return keep_sampling;
   };
 }
 
@@ -103,6 +124,7 @@ struct take_while_kld_fn {
    * \param max Maximum samples to take.
    * \param epsilon See beluga::kld_condition() for details.
    * \param z See beluga::kld_condition() for details.
+   * \param resource See beluga::kld_condition() for details.
    *
    * The hasher will be called with range elements by default. If that is not possible,
    * it will assume that the range contains particles and invoke the hasher with the
@@ -115,7 +137,8 @@ struct take_while_kld_fn {
       std::size_t min,
       std::size_t max,
       double epsilon,
-      double z = beluga::detail::kDefaultKldZ) const {
+      double z = beluga::detail::kDefaultKldZ,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const {
     static_assert(ranges::input_range<Range>);
 
     auto proj = [&hasher]() {
@@ -131,8 +154,8 @@ struct take_while_kld_fn {
       }
     }();
 
-    return ranges::views::all(std::forward<Range>(range)) |                                      //
-           ranges::views::take_while(beluga::kld_condition(min, epsilon, z), std::move(proj)) |  //
+    return ranges::views::all(std::forward<Range>(range)) |                                                //
+           ranges::views::take_while(beluga::kld_condition(min, epsilon, z, resource), std::move(proj)) |  //
            ranges::views::take(max);
   }
 
@@ -144,6 +167,7 @@ struct take_while_kld_fn {
    * \param max Maximum samples to take.
    * \param epsilon See beluga::kld_condition() for details.
    * \param z See beluga::kld_condition() for details.
+   * \param resource See beluga::kld_condition() for details.
    */
   template <class Hasher>
   constexpr auto operator()(
@@ -151,8 +175,10 @@ struct take_while_kld_fn {
       std::size_t min,
       std::size_t max,
       double epsilon,
-      double z = beluga::detail::kDefaultKldZ) const {
-    return ranges::make_view_closure(ranges::bind_back(take_while_kld_fn{}, std::move(hasher), min, max, epsilon, z));
+      double z = beluga::detail::kDefaultKldZ,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const {
+    return ranges::make_view_closure(
+        ranges::bind_back(take_while_kld_fn{}, std::move(hasher), min, max, epsilon, z, resource));
   }
 };
 
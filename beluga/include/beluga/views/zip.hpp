@@ -16,7 +16,11 @@
 #define BELUGA_VIEWS_ZIP_HPP
 
 #include <tuple>
+#include <type_traits>
 
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
 #include <range/v3/view/zip.hpp>
 
 /**
@@ -58,9 +62,30 @@ struct as_common_tuple_indirect_fn {
 /// Implementation detail for a zip range adaptor object.
 struct zip_fn {
   /// Overload that implements the zip_view algorithm.
+  /**
+   * Zipping must not downgrade the common range category of its inputs: downstream
+   * parallel algorithms partition work through O(1) iterator difference, and a
+   * silent loss of random access or size (e.g. from a change in the view adaptors
+   * this is composed from) would serialize them. The static assertions turn such
+   * a regression into a compile-time diagnostic at the call site.
+   */
   template <class... Ranges>
   constexpr auto operator()(Ranges&&... ranges) const {
-    return ranges::views::iter_zip_with(as_common_tuple_indirect_fn{}, std::forward<Ranges>(ranges)...);
+    auto zipped = ranges::views::iter_zip_with(as_common_tuple_indirect_fn{}, std::forward<Ranges>(ranges)...);
+    using zipped_type = decltype(zipped);
+    if constexpr ((ranges::random_access_range<std::remove_reference_t<Ranges>> && ...)) {
+      static_assert(
+          ranges::random_access_range<zipped_type>,
+          "beluga::views::zip must preserve random access when every input range provides it");
+      static_assert(
+          ranges::sized_sentinel_for<ranges::iterator_t<zipped_type>, ranges::iterator_t<zipped_type>>,
+          "beluga::views::zip iterators must support O(1) difference when every input range is random access");
+    }
+    if constexpr ((ranges::sized_range<std::remove_reference_t<Ranges>> && ...)) {
+      static_assert(
+          ranges::sized_range<zipped_type>, "beluga::views::zip must stay sized when every input range is sized");
+    }
+    return zipped;
   }
 };
 
@@ -70,6 +95,13 @@ struct zip_fn {
 /**
  * Unlike `ranges::views::zip`, iterators always dereference into tuples, not pairs.
  * Other than that, they are both equivalent views.
+ *
+ * When every input range is random access and sized — as the contiguous columns of
+ * a `beluga::TupleContainer` are — the zipped range is statically guaranteed to be
+ * random access and sized with O(1) iterator difference, the properties parallel
+ * stages rely on to partition work. Compositions that lose these properties fail
+ * to compile instead of degrading quietly; see also
+ * \ref beluga::views::assert_partitionable.
  */
 inline constexpr detail::zip_fn zip;
 
@@ -0,0 +1,94 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * Offline map compiler. Converts NDT map sources (HDF5) into the flat binary
+ * map format (see beluga::io::NDTBinaryMapHeader), which loaders memory map
+ * and read in place without parsing. Running this once when a map is released
+ * moves the HDF5 parsing cost out of every robot boot.
+ */
+
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+#include <Eigen/Core>
+
+#include <beluga/sensor/data/ndt_cell.hpp>
+#include <beluga/sensor/data/sparse_value_grid.hpp>
+#include <beluga/sensor/ndt_sensor_model.hpp>
+
+namespace {
+
+using SparseGrid2D =
+    beluga::SparseValueGrid2<std::unordered_map<Eigen::Vector2i, beluga::NDTCell2d, beluga::detail::CellHasher<2>>>;
+using SparseGrid3D =
+    beluga::SparseValueGrid3<std::unordered_map<Eigen::Vector3i, beluga::NDTCell3d, beluga::detail::CellHasher<3>>>;
+
+void print_usage(std::ostream& stream) {
+  stream << "Usage: beluga_map_compiler <input.hdf5> <output.bin> [--dimensions 2|3]\n"
+         << "\n"
+         << "Compiles an NDT map from HDF5 into the flat binary format that\n"
+         << "beluga loads through a read-only memory mapping, with no parsing\n"
+         << "step at startup. Defaults to a 2D map.\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string input;
+  std::string output;
+  int dimensions = 2;
+
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--help") == 0 || std::strcmp(argv[i], "-h") == 0) {
+      print_usage(std::cout);
+      return 0;
+    }
+    if (std::strcmp(argv[i], "--dimensions") == 0) {
+      if (i + 1 >= argc || (std::strcmp(argv[i + 1], "2") != 0 && std::strcmp(argv[i + 1], "3") != 0)) {
+        std::cerr << "error: --dimensions takes a value of 2 or 3\n";
+        return 1;
+      }
+      dimensions = argv[++i][0] - '0';
+    } else if (input.empty()) {
+      input = argv[i];
+    } else if (output.empty()) {
+      output = argv[i];
+    } else {
+      std::cerr << "error: unexpected argument '" << argv[i] << "'\n";
+      print_usage(std::cerr);
+      return 1;
+    }
+  }
+
+  if (input.empty() || output.empty()) {
+    print_usage(std::cerr);
+    return 1;
+  }
+
+  try {
+    if (dimensions == 2) {
+      beluga::io::convert_hdf5_to_binary<SparseGrid2D>(input, output);
+    } else {
+      beluga::io::convert_hdf5_to_binary<SparseGrid3D>(input, output);
+    }
+  } catch (const std::exception& error) {
+    std::cerr << "error: " << error.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
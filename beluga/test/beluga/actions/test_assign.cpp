@@ -14,15 +14,18 @@
 
 #include <list>
 #include <memory>
+#include <tuple>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include <beluga/actions/assign.hpp>
+#include <beluga/containers/tuple_vector.hpp>
 
 #include <range/v3/action/drop.hpp>
 #include <range/v3/action/remove.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/view/filter.hpp>
 #include <range/v3/view/indirect.hpp>
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/reverse.hpp>
@@ -81,6 +84,18 @@ TEST(AssignAction, ActionViewActionComposition) {
   ASSERT_TRUE(ranges::equal(input, std::vector{12}));
 }
 
+TEST(AssignAction, TupleVectorPreservesCapacity) {
+  auto input = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}, {3, 3.0}, {4, 4.0}};
+  input.reserve(100);
+  const auto capacity = input.capacity();
+  input |= ranges::views::filter([](const auto& tuple) { return std::get<0>(tuple) % 2 == 0; }) |
+           beluga::actions::assign;
+  ASSERT_EQ(input.size(), 2);
+  EXPECT_GE(input.capacity(), capacity);
+  const auto expected = beluga::TupleVector<std::tuple<int, double>>{{2, 2.0}, {4, 4.0}};
+  ASSERT_TRUE(ranges::equal(input, expected));
+}
+
 TEST(AssignAction, List) {
   auto input = std::list{1, 2, 3};
   input |= ranges::actions::remove(2) | ranges::views::reverse | beluga::actions::assign;
@@ -0,0 +1,88 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/actions/expand.hpp"
+#include "beluga/actions/propagate.hpp"
+#include "beluga/actions/resample.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(ExpandAction, MaterializesDuplicates) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(1.0), beluga::Multiplicity(3)),  //
+      std::make_tuple(2, beluga::Weight(1.0), beluga::Multiplicity(1)),
+  };
+  input |= beluga::actions::expand;
+  ASSERT_EQ(input.size(), 4);
+  EXPECT_THAT(input | beluga::views::states | ranges::to<std::vector>, testing::UnorderedElementsAre(1, 1, 1, 2));
+  EXPECT_THAT(
+      input | beluga::views::multiplicities | ranges::to<std::vector>,  //
+      testing::Each(beluga::Multiplicity(1)));
+}
+
+TEST(ExpandAction, NoOpWhenAlreadyExpanded) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(1.0), beluga::Multiplicity(1)),  //
+      std::make_tuple(2, beluga::Weight(1.0), beluga::Multiplicity(1)),
+  };
+  input |= beluga::actions::expand;
+  ASSERT_EQ(input.size(), 2);
+  EXPECT_THAT(input | beluga::views::states | ranges::to<std::vector>, testing::ElementsAre(1, 2));
+}
+
+TEST(ExpandAction, EmptyRange) {
+  auto input = std::vector<std::tuple<int, beluga::Weight, beluga::Multiplicity>>{};
+  input |= beluga::actions::expand;
+  ASSERT_EQ(input.size(), 0);
+}
+
+TEST(ExpandAction, TupleVector) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight, beluga::Multiplicity>>{};
+  input.push_back({1, beluga::Weight(1.0), beluga::Multiplicity(2)});
+  input.push_back({2, beluga::Weight(1.0), beluga::Multiplicity(2)});
+  input |= beluga::actions::expand;
+  ASSERT_EQ(input.size(), 4);
+  EXPECT_THAT(input | beluga::views::states | ranges::to<std::vector>, testing::UnorderedElementsAre(1, 1, 2, 2));
+}
+
+TEST(ExpandAction, ComposesWithCompressedResampleAndPropagate) {
+  auto engine = std::mt19937{42};
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.0), beluga::Multiplicity(1)),  //
+      std::make_tuple(2, beluga::Weight(10.0), beluga::Multiplicity(1)),
+      std::make_tuple(3, beluga::Weight(0.0), beluga::Multiplicity(1)),
+  };
+  beluga::actions::detail::resample_fn{}(input, engine);
+  ASSERT_EQ(input.size(), 1);  // compressed: one survivor with multiplicity three
+  input |= beluga::actions::expand;
+  ASSERT_EQ(input.size(), 3);
+  // Each expanded copy goes through the propagate stage as a plain particle,
+  // where a noisy motion model would re-diversify the duplicates.
+  input |= beluga::actions::propagate([](int state) { return state * 100; });
+  EXPECT_THAT(input | beluga::views::states | ranges::to<std::vector>, testing::Each(200));
+}
+
+}  // namespace
@@ -42,6 +42,12 @@ TEST(NormalizeAction, ParallelExecutionPolicy) {
   ASSERT_EQ(input.front(), std::make_tuple(5, 2.0));
 }
 
+TEST(NormalizeAction, ParallelUnsequencedExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(4.0))};
+  input |= beluga::actions::normalize(std::execution::par_unseq, 2.0);
+  ASSERT_EQ(input.front(), std::make_tuple(5, 2.0));
+}
+
 TEST(NormalizeAction, DefaultFactor) {
   auto input = std::vector{std::make_tuple(5, beluga::Weight(4.0))};
   input |= beluga::actions::normalize(std::execution::seq);
@@ -99,4 +105,49 @@ TEST(NormalizeAction, NegativeFactor) {
   ASSERT_EQ(input.front(), std::make_tuple(5, beluga::Weight(-2.0)));
 }
 
+TEST(NormalizeAction, AccumulatesWeightStatistics) {
+  auto input = std::vector{
+      std::make_tuple(5, beluga::Weight(1.0)),  //
+      std::make_tuple(8, beluga::Weight(3.0))};
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::normalize(&statistics);
+  ASSERT_NEAR(statistics.total_weight, 1.0, 1e-12);
+  ASSERT_NEAR(statistics.squared_total_weight, 0.25 * 0.25 + 0.75 * 0.75, 1e-12);
+  ASSERT_NEAR(statistics.effective_sample_size(), 1.0 / (0.25 * 0.25 + 0.75 * 0.75), 1e-12);
+  ASSERT_EQ(statistics.sample_count, 2U);
+  ASSERT_NEAR(statistics.average_weight(), 0.5, 1e-12);
+}
+
+TEST(NormalizeAction, LogWeightsSumToOne) {
+  auto input = std::vector{
+      std::make_tuple(5, beluga::LogWeight(std::log(4.0))),  //
+      std::make_tuple(8, beluga::LogWeight(std::log(2.0))),  //
+      std::make_tuple(3, beluga::LogWeight(std::log(2.0)))};
+  input |= beluga::actions::normalize;
+  double sum = 0.0;
+  for (const auto& [state, log_weight] : input) {
+    sum += std::exp(log_weight);
+  }
+  ASSERT_NEAR(sum, 1.0, 1e-12);
+  ASSERT_NEAR(std::exp(beluga::log_weight(input.front())), 0.5, 1e-12);
+}
+
+TEST(NormalizeAction, LogWeightsUnderflowResilience) {
+  // Linear-domain weights here would all round to zero.
+  auto input = std::vector{
+      std::make_tuple(5, beluga::LogWeight(-1200.0)),  //
+      std::make_tuple(8, beluga::LogWeight(-1201.0))};
+  input |= beluga::actions::normalize;
+  const double first = std::exp(beluga::log_weight(input[0]));
+  const double second = std::exp(beluga::log_weight(input[1]));
+  ASSERT_NEAR(first + second, 1.0, 1e-12);
+  ASSERT_GT(first, second);
+}
+
+TEST(NormalizeAction, LogWeightsCustomFactor) {
+  auto input = std::vector{std::make_tuple(5, beluga::LogWeight(3.0))};
+  input |= beluga::actions::normalize(2.0);
+  ASSERT_EQ(beluga::log_weight(input.front()), 1.0);
+}
+
 }  // namespace
@@ -17,7 +17,9 @@
 
 #include <execution>
 #include <functional>
+#include <iterator>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <range/v3/range/conversion.hpp>
@@ -26,6 +28,7 @@
 #include "beluga/actions/assign.hpp"
 #include "beluga/actions/propagate.hpp"
 #include "beluga/primitives.hpp"
+#include "beluga/utility/thread_pool_executor.hpp"
 #include "beluga/views/particles.hpp"
 #include "beluga/views/sample.hpp"
 
@@ -49,6 +52,25 @@ TEST(PropagateAction, ParallelExecutionPolicy) {
   ASSERT_EQ(input.front(), std::make_tuple(6, 1.0));
 }
 
+TEST(PropagateAction, ParallelUnsequencedExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate(std::execution::par_unseq, [](int value) { return ++value; });
+  ASSERT_EQ(input.front(), std::make_tuple(6, 1.0));
+}
+
+TEST(PropagateAction, UnsequencedExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate(std::execution::unseq, [](int value) { return ++value; });
+  ASSERT_EQ(input.front(), std::make_tuple(6, 1.0));
+}
+
+TEST(PropagateAction, ThreadPoolExecutor) {
+  const auto executor = beluga::ThreadPoolExecutor{2};
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate(executor, [](int value) { return ++value; });
+  ASSERT_EQ(input.front(), std::make_tuple(6, 1.0));
+}
+
 TEST(PropagateAction, Composition) {
   auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0))};
   input |= beluga::actions::propagate([](int value) { return --value; }) |  //
@@ -59,6 +81,29 @@ TEST(PropagateAction, Composition) {
   ASSERT_THAT(states, testing::ElementsAre(4, 4, 4, 4, 4));
 }
 
+struct BatchModel {
+  template <class Range, class Generator, class = decltype(std::begin(std::declval<Range&>()))>
+  void operator()(Range& states, Generator&) const {
+    for (auto&& state : states) {
+      state = state + 10;
+    }
+  }
+};
+
+TEST(PropagateAction, BatchModel) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0)), std::make_tuple(7, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate(BatchModel{});
+  auto states = input | beluga::views::states | ranges::to<std::vector>;
+  ASSERT_THAT(states, testing::ElementsAre(15, 17));
+}
+
+TEST(PropagateAction, BatchModelWithExecutor) {
+  const auto executor = beluga::ThreadPoolExecutor{2};
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate(executor, BatchModel{});
+  ASSERT_EQ(input.front(), std::make_tuple(15, 1.0));
+}
+
 TEST(PropagateAction, StatefulModel) {
   auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0))};
   auto model = [value = 0](int) mutable { return value++; };
@@ -0,0 +1,127 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <execution>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/actions/propagate.hpp"
+#include "beluga/actions/propagate_reweight_normalized.hpp"
+#include "beluga/actions/reweight_normalized.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/utility/thread_pool_executor.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(PropagateReweightNormalizedAction, DefaultExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate_reweight_normalized(
+      [](int value) { return value + 1; }, [](int value) { return value; });
+  auto states = input | beluga::views::states | ranges::to<std::vector>;
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(states, testing::ElementsAre(2, 4));
+  // Weights are computed from the propagated states.
+  ASSERT_THAT(weights, testing::ElementsAre(testing::DoubleEq(2.0 / 6.0), testing::DoubleEq(4.0 / 6.0)));
+}
+
+TEST(PropagateReweightNormalizedAction, MatchesComposedPipeline) {
+  const auto make_input = [] {
+    return std::vector{
+        std::make_tuple(2, beluga::Weight(0.5)),  //
+        std::make_tuple(4, beluga::Weight(1.0)),  //
+        std::make_tuple(8, beluga::Weight(2.0))};
+  };
+  const auto propagate_fn = [](int value) { return value * 2; };
+  const auto model = [](int value) { return value + 1; };
+
+  auto fused = make_input();
+  fused |= beluga::actions::propagate_reweight_normalized(propagate_fn, model);
+
+  auto composed = make_input();
+  composed |= beluga::actions::propagate(propagate_fn) |  //
+              beluga::actions::reweight_normalized(model);
+
+  ASSERT_EQ(fused, composed);
+}
+
+TEST(PropagateReweightNormalizedAction, ParallelExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate_reweight_normalized(
+      std::execution::par, [](int value) { return value; }, [](int value) { return value; });
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0.25, 0.75));
+}
+
+TEST(PropagateReweightNormalizedAction, StochasticStateSamplingFunction) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate_reweight_normalized(
+      [](int value, auto& gen) {
+        auto distribution = std::uniform_int_distribution<>{value + 1, value + 1};
+        return distribution(gen);
+      },
+      [](int value) { return value; });
+  ASSERT_EQ(input.front(), std::make_tuple(6, 1.0));
+}
+
+TEST(PropagateReweightNormalizedAction, ThreadPoolExecutor) {
+  const auto executor = beluga::ThreadPoolExecutor{2};
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate_reweight_normalized(
+      executor, [](int value) { return value + 1; }, [](int value) { return value; });
+  auto states = input | beluga::views::states | ranges::to<std::vector>;
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(states, testing::ElementsAre(2, 4));
+  ASSERT_THAT(weights, testing::ElementsAre(testing::DoubleEq(2.0 / 6.0), testing::DoubleEq(4.0 / 6.0)));
+}
+
+TEST(PropagateReweightNormalizedAction, BatchWeightingBackendRunsComposed) {
+  // Batch weighting backends own their iteration, so the stages run composed
+  // instead of fused; the result must not differ.
+  const auto backend = [](auto& states, auto& weights) {
+    auto weight_it = std::begin(weights);
+    for (const auto& state : states) {
+      *weight_it = *weight_it * static_cast<double>(state);
+      ++weight_it;
+    }
+  };
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate_reweight_normalized([](int value) { return value + 1; }, backend);
+  auto states = input | beluga::views::states | ranges::to<std::vector>;
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(states, testing::ElementsAre(2, 4));
+  ASSERT_THAT(weights, testing::ElementsAre(testing::DoubleEq(2.0 / 6.0), testing::DoubleEq(4.0 / 6.0)));
+}
+
+TEST(PropagateReweightNormalizedAction, AccumulatesWeightStatistics) {
+  auto input = std::vector{
+      std::make_tuple(0, beluga::Weight(1.0)),  //
+      std::make_tuple(2, beluga::Weight(1.0))};
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::propagate_reweight_normalized(
+      [](int value) { return value + 1; }, [](int value) { return value; }, &statistics);
+  // Propagated states are 1 and 3, so normalized weights are 0.25 and 0.75.
+  ASSERT_NEAR(statistics.total_weight, 1.0, 1e-12);
+  ASSERT_NEAR(statistics.squared_total_weight, 0.25 * 0.25 + 0.75 * 0.75, 1e-12);
+  ASSERT_NEAR(statistics.effective_sample_size(), 1.0 / (0.25 * 0.25 + 0.75 * 0.75), 1e-12);
+  ASSERT_EQ(statistics.sample_count, 2U);
+}
+
+}  // namespace
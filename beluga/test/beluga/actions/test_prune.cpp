@@ -0,0 +1,106 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <execution>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/actions/prune.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(PruneAction, DefaultExecutionPolicy) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.5)),  //
+      std::make_tuple(2, beluga::Weight(0.001)),
+      std::make_tuple(3, beluga::Weight(0.499))};
+  input |= beluga::actions::prune(0.01);
+  ASSERT_EQ(input.size(), 2UL);
+}
+
+TEST(PruneAction, SequencedExecutionPolicy) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.5)),  //
+      std::make_tuple(2, beluga::Weight(0.001)),
+      std::make_tuple(3, beluga::Weight(0.499))};
+  input |= beluga::actions::prune(std::execution::seq, 0.01);
+  ASSERT_EQ(input.size(), 2UL);
+}
+
+TEST(PruneAction, KeepsColumnsPaired) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  input.push_back(std::make_tuple(1, beluga::Weight(0.001)));
+  input.push_back(std::make_tuple(2, beluga::Weight(0.599)));
+  input.push_back(std::make_tuple(3, beluga::Weight(0.4)));
+  input |= beluga::actions::prune(0.01);
+  ASSERT_EQ(input.size(), 2UL);
+  // The last particle is moved into the freed slot, states staying paired with weights.
+  ASSERT_THAT(input | beluga::views::states | ranges::to<std::vector>, testing::UnorderedElementsAre(2, 3));
+}
+
+TEST(PruneAction, RenormalizesSurvivors) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.6)),  //
+      std::make_tuple(2, beluga::Weight(0.005)),
+      std::make_tuple(3, beluga::Weight(0.395))};
+  input |= beluga::actions::prune(0.01);
+  ASSERT_EQ(input.size(), 2UL);
+  const double total = ranges::accumulate(input | beluga::views::weights, 0.0);
+  ASSERT_DOUBLE_EQ(total, 1.0);
+}
+
+TEST(PruneAction, NoOpWhenAllAboveThreshold) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.5)),  //
+      std::make_tuple(2, beluga::Weight(0.5))};
+  input |= beluga::actions::prune(0.01);
+  ASSERT_EQ(input.size(), 2UL);
+  ASSERT_DOUBLE_EQ(static_cast<double>(beluga::weight(input.front())), 0.5);
+}
+
+TEST(PruneAction, DegenerateThresholdLeavesRangeUntouched) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.5)),  //
+      std::make_tuple(2, beluga::Weight(0.5))};
+  input |= beluga::actions::prune(2.0);  // would remove every particle
+  ASSERT_EQ(input.size(), 2UL);
+}
+
+TEST(PruneAction, PrunesMovedInParticles) {
+  // The particle moved into a freed slot must itself be pruned in the same sweep.
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.001)),
+      std::make_tuple(2, beluga::Weight(0.997)),
+      std::make_tuple(3, beluga::Weight(0.002))};
+  input |= beluga::actions::prune(0.01);
+  ASSERT_EQ(input.size(), 1UL);
+  ASSERT_EQ(beluga::state(input.front()), 2);
+}
+
+TEST(PruneAction, EmptyRange) {
+  auto input = std::vector<std::tuple<int, beluga::Weight>>{};
+  input |= beluga::actions::prune(0.01);
+  ASSERT_EQ(input.size(), 0UL);
+}
+
+}  // namespace
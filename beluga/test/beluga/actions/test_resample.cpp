@@ -0,0 +1,149 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/actions/resample.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(ResampleAction, KeepsSizeAndResetsWeights) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(1.0)),  //
+      std::make_tuple(2, beluga::Weight(2.0)),  //
+      std::make_tuple(3, beluga::Weight(3.0)),  //
+      std::make_tuple(4, beluga::Weight(4.0)),
+  };
+  input |= beluga::actions::resample;
+  ASSERT_EQ(input.size(), 4);
+  for (const auto& [state, weight] : input) {
+    EXPECT_EQ(weight, 1.0);
+  }
+}
+
+TEST(ResampleAction, DominantParticleTakesOver) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.0)),    //
+      std::make_tuple(2, beluga::Weight(100.0)),  //
+      std::make_tuple(3, beluga::Weight(0.0)),
+  };
+  input |= beluga::actions::resample;
+  const auto states = input | beluga::views::states | ranges::to<std::vector>;
+  EXPECT_THAT(states, testing::Each(2));
+}
+
+TEST(ResampleAction, UniformWeightsPreserveStates) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(1.0)),  //
+      std::make_tuple(2, beluga::Weight(1.0)),  //
+      std::make_tuple(3, beluga::Weight(1.0)),
+  };
+  // With uniform weights, systematic resampling draws each particle exactly once.
+  input |= beluga::actions::resample;
+  const auto states = input | beluga::views::states | ranges::to<std::vector>;
+  EXPECT_THAT(states, testing::ElementsAre(1, 2, 3));
+}
+
+TEST(ResampleAction, ZeroWeightParticlesAreNeverDrawn) {
+  auto engine = std::mt19937{42};
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(1.0)),  //
+      std::make_tuple(2, beluga::Weight(0.0)),  //
+      std::make_tuple(3, beluga::Weight(1.0)),  //
+      std::make_tuple(4, beluga::Weight(0.0)),  //
+      std::make_tuple(5, beluga::Weight(1.0)),
+  };
+  beluga::actions::detail::resample_fn{}(input, engine);
+  const auto states = input | beluga::views::states | ranges::to<std::vector>;
+  EXPECT_EQ(ranges::count(states, 2), 0);
+  EXPECT_EQ(ranges::count(states, 4), 0);
+}
+
+TEST(ResampleAction, TupleVectorWithColdColumns) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>, std::tuple<int>>{};
+  input.push_back({1, beluga::Weight(0.0)});
+  input.push_back({2, beluga::Weight(10.0)});
+  input.push_back({3, beluga::Weight(0.0)});
+  auto clusters = input.cold_column<0>();
+  clusters[0] = 10;
+  clusters[1] = 20;
+  clusters[2] = 30;
+  input |= beluga::actions::resample;
+  const auto states = input | beluga::views::states | ranges::to<std::vector>;
+  EXPECT_THAT(states, testing::Each(2));
+  // Cold columns are permuted alongside the hot ones.
+  EXPECT_THAT(input.cold_column<0>(), testing::Each(20));
+}
+
+TEST(ResampleAction, EmptyRange) {
+  auto input = std::vector<std::tuple<int, beluga::Weight>>{};
+  input |= beluga::actions::resample;
+  ASSERT_EQ(input.size(), 0);
+}
+
+TEST(ResampleAction, CompressesMultiplicityRanges) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.0), beluga::Multiplicity(1)),    //
+      std::make_tuple(2, beluga::Weight(100.0), beluga::Multiplicity(1)),  //
+      std::make_tuple(3, beluga::Weight(0.0), beluga::Multiplicity(1)),
+  };
+  input |= beluga::actions::resample;
+  // The dominant particle takes every draw, stored once with its draw count.
+  ASSERT_EQ(input.size(), 1);
+  ASSERT_EQ(input.front(), std::make_tuple(2, 1.0, std::size_t{3}));
+}
+
+TEST(ResampleAction, UniformWeightsStayUncompressed) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(1.0), beluga::Multiplicity(1)),  //
+      std::make_tuple(2, beluga::Weight(1.0), beluga::Multiplicity(1)),  //
+      std::make_tuple(3, beluga::Weight(1.0), beluga::Multiplicity(1)),
+  };
+  input |= beluga::actions::resample;
+  // With uniform weights, systematic resampling draws each particle exactly once.
+  ASSERT_EQ(input.size(), 3);
+  EXPECT_THAT(
+      input | beluga::views::multiplicities | ranges::to<std::vector>,
+      testing::Each(beluga::Multiplicity(1)));
+}
+
+TEST(ResampleAction, ConservesPopulationAcrossCompressedResamples) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(1.0), beluga::Multiplicity(1)),  //
+      std::make_tuple(2, beluga::Weight(3.0), beluga::Multiplicity(1)),
+  };
+  input |= beluga::actions::resample;
+  // Incoming multiplicities scale the weight profile and the number of draws,
+  // so the represented population size stays at two.
+  input |= beluga::actions::resample;
+  std::size_t population = 0;
+  for (const auto multiplicity : input | beluga::views::multiplicities) {
+    population += static_cast<std::size_t>(multiplicity);
+  }
+  ASSERT_EQ(population, 2);
+}
+
+}  // namespace
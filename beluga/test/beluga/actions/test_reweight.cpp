@@ -24,8 +24,10 @@
 #include <range/v3/view/intersperse.hpp>
 
 #include "beluga/actions/assign.hpp"
+#include "beluga/actions/normalize.hpp"
 #include "beluga/actions/reweight.hpp"
 #include "beluga/primitives.hpp"
+#include "beluga/utility/thread_pool_executor.hpp"
 #include "beluga/views/particles.hpp"
 
 namespace {
@@ -48,6 +50,83 @@ TEST(ReweightAction, ParallelExecutionPolicy) {
   ASSERT_EQ(input.front(), std::make_tuple(5, 10.0));
 }
 
+TEST(ReweightAction, ParallelUnsequencedExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(2.0))};
+  input |= beluga::actions::reweight(std::execution::par_unseq, [](int value) { return value; });
+  ASSERT_EQ(input.front(), std::make_tuple(5, 10.0));
+}
+
+TEST(ReweightAction, ThreadPoolExecutor) {
+  const auto executor = beluga::ThreadPoolExecutor{2};
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(2.0))};
+  input |= beluga::actions::reweight(executor, [](int value) { return value; });
+  ASSERT_EQ(input.front(), std::make_tuple(5, 10.0));
+}
+
+TEST(ReweightAction, ThreadPoolExecutorWithStatistics) {
+  const auto executor = beluga::ThreadPoolExecutor{4};
+  auto input = std::vector<std::tuple<int, beluga::Weight>>{};
+  for (int value = 1; value <= 100; ++value) {
+    input.emplace_back(value, beluga::Weight(1.0));
+  }
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::reweight(executor, [](int value) { return static_cast<double>(value); }, &statistics);
+  // The totals are published, but the weights themselves are left unnormalized.
+  ASSERT_EQ(std::get<1>(input.front()), 1.0);
+  EXPECT_DOUBLE_EQ(statistics.total_weight, 5050.0);
+  EXPECT_DOUBLE_EQ(statistics.squared_total_weight, 338350.0);
+  EXPECT_EQ(statistics.sample_count, 100U);
+  // Deferred normalization through the published factor, with no extra reduction sweep.
+  input |= beluga::actions::normalize(statistics.total_weight);
+  EXPECT_DOUBLE_EQ(std::get<1>(input.back()), 100.0 / 5050.0);
+}
+
+TEST(ReweightAction, WorkStealingThreadPoolExecutorWithStatistics) {
+  const auto executor = beluga::ThreadPoolExecutor{4, beluga::ThreadPoolExecutor::Scheduling::kWorkStealing};
+  auto input = std::vector<std::tuple<int, beluga::Weight>>{};
+  for (int value = 1; value <= 1000; ++value) {
+    input.emplace_back(value, beluga::Weight(1.0));
+  }
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::reweight(executor, [](int value) { return static_cast<double>(value); }, &statistics);
+  // Accumulator slots are shared by every chunk a thread steals; the integer sums below are
+  // exactly representable, so the totals must not depend on the chunk assignment.
+  EXPECT_DOUBLE_EQ(statistics.total_weight, 500500.0);
+  EXPECT_DOUBLE_EQ(statistics.squared_total_weight, 333833500.0);
+  EXPECT_EQ(statistics.sample_count, 1000U);
+}
+
+/// Minimal stand-in for an offload backend: it is handed the whole states and
+/// weights ranges and owns its iteration, as a device backend streaming state
+/// batches through a resident map would.
+struct BatchWeightingBackend {
+  template <class States, class Weights>
+  void operator()(States& states, Weights& weights) const {
+    auto weight_it = std::begin(weights);
+    for (const auto& state : states) {
+      *weight_it = *weight_it * static_cast<double>(state);
+      ++weight_it;
+    }
+  }
+};
+
+TEST(ReweightAction, BatchWeightingBackend) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(2.0))};
+  input |= beluga::actions::reweight(BatchWeightingBackend{});
+  ASSERT_EQ(input.front(), std::make_tuple(5, 10.0));
+}
+
+TEST(ReweightAction, BatchWeightingBackendWithStatistics) {
+  const auto executor = beluga::ThreadPoolExecutor{2};
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::reweight(executor, BatchWeightingBackend{}, &statistics);
+  // The backend bypasses the executor; the statistics are reduced on the caller thread.
+  EXPECT_DOUBLE_EQ(statistics.total_weight, 4.0);
+  EXPECT_DOUBLE_EQ(statistics.squared_total_weight, 10.0);
+  EXPECT_EQ(statistics.sample_count, 2U);
+}
+
 TEST(ReweightAction, Composition) {
   auto input = std::vector{std::make_tuple(4, beluga::Weight(0.5)), std::make_tuple(4, beluga::Weight(1.0))};
   input |= beluga::actions::reweight([](int value) { return value; }) |           //
@@ -0,0 +1,121 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <execution>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/actions/reweight_normalized.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/utility/thread_pool_executor.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(ReweightNormalizedAction, DefaultExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  input |= beluga::actions::reweight_normalized([](int value) { return value; });
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0.25, 0.75));
+}
+
+TEST(ReweightNormalizedAction, SequencedExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(2.0))};
+  input |= beluga::actions::reweight_normalized(std::execution::seq, [](int value) { return value; });
+  ASSERT_EQ(input.front(), std::make_tuple(5, 1.0));
+}
+
+TEST(ReweightNormalizedAction, ParallelExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  input |= beluga::actions::reweight_normalized(std::execution::par, [](int value) { return value; });
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0.25, 0.75));
+}
+
+TEST(ReweightNormalizedAction, MatchesReweightThenNormalize) {
+  auto input = std::vector{
+      std::make_tuple(2, beluga::Weight(0.5)),  //
+      std::make_tuple(4, beluga::Weight(1.0)),  //
+      std::make_tuple(8, beluga::Weight(2.0))};
+  input |= beluga::actions::reweight_normalized([](int value) { return value; });
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  const double total = 2 * 0.5 + 4 * 1.0 + 8 * 2.0;
+  ASSERT_THAT(
+      weights, testing::ElementsAre(
+                   testing::DoubleEq(1.0 / total),  //
+                   testing::DoubleEq(4.0 / total),  //
+                   testing::DoubleEq(16.0 / total)));
+}
+
+TEST(ReweightNormalizedAction, ThreadPoolExecutor) {
+  const auto executor = beluga::ThreadPoolExecutor{2};
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  input |= beluga::actions::reweight_normalized(executor, [](int value) { return value; });
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0.25, 0.75));
+}
+
+TEST(ReweightNormalizedAction, AccumulatesWeightStatistics) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(1.0)),  //
+      std::make_tuple(3, beluga::Weight(1.0))};
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::reweight_normalized([](int value) { return value; }, &statistics);
+  // Normalized weights are 0.25 and 0.75.
+  ASSERT_NEAR(statistics.total_weight, 1.0, 1e-12);
+  ASSERT_NEAR(statistics.squared_total_weight, 0.25 * 0.25 + 0.75 * 0.75, 1e-12);
+  ASSERT_NEAR(statistics.effective_sample_size(), 1.0 / (0.25 * 0.25 + 0.75 * 0.75), 1e-12);
+  ASSERT_EQ(statistics.sample_count, 2U);
+}
+
+TEST(ReweightNormalizedAction, AccumulatesWeightStatisticsInParallel) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(1.0)),  //
+      std::make_tuple(3, beluga::Weight(1.0))};
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::reweight_normalized(std::execution::par, [](int value) { return value; }, &statistics);
+  ASSERT_NEAR(statistics.effective_sample_size(), 1.0 / (0.25 * 0.25 + 0.75 * 0.75), 1e-12);
+  ASSERT_EQ(statistics.sample_count, 2U);
+}
+
+TEST(ReweightNormalizedAction, BatchWeightingBackend) {
+  // Backends taking the whole states and weights ranges reweight in one call;
+  // only the normalization runs as a separate pass.
+  const auto backend = [](auto& states, auto& weights) {
+    auto weight_it = std::begin(weights);
+    for (const auto& state : states) {
+      *weight_it = *weight_it * static_cast<double>(state);
+      ++weight_it;
+    }
+  };
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::reweight_normalized(backend, &statistics);
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0.25, 0.75));
+  ASSERT_EQ(statistics.sample_count, 2U);
+}
+
+TEST(ReweightNormalizedAction, AlreadyNormalized) {
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0))};
+  input |= beluga::actions::reweight_normalized([](int) { return 1.0; });
+  ASSERT_EQ(input.front(), std::make_tuple(1, 1.0));
+}
+
+}  // namespace
@@ -0,0 +1,98 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <execution>
+#include <functional>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/actions/reweight_truncated.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+auto make_input() {
+  auto input = std::vector<std::tuple<int, beluga::Weight>>{};
+  for (int value = 0; value < 10; ++value) {
+    input.emplace_back(value, beluga::Weight(1.0));
+  }
+  return input;
+}
+
+TEST(ReweightTruncatedAction, FullFractionMatchesReweight) {
+  auto input = make_input();
+  input |= beluga::actions::reweight_truncated(
+      [](int) { return 1.0; }, [](int value) { return static_cast<double>(value); }, 1.0);
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+}
+
+TEST(ReweightTruncatedAction, ExpensiveModelOnlyOnTopFraction) {
+  auto input = make_input();
+  auto evaluations = 0;
+  auto model = [&evaluations](int value) {
+    ++evaluations;
+    return static_cast<double>(value);
+  };
+  input |=
+      beluga::actions::reweight_truncated([](int value) { return static_cast<double>(value); }, std::ref(model), 0.2);
+  ASSERT_EQ(evaluations, 2);
+}
+
+TEST(ReweightTruncatedAction, ProportionalProxyMatchesFullEvaluation) {
+  auto input = make_input();
+  // A proxy proportional to the expensive model makes the calibrated tail exact.
+  input |= beluga::actions::reweight_truncated(
+      [](int value) { return static_cast<double>(value); }, [](int value) { return 2.0 * value; }, 0.2);
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0, 2, 4, 6, 8, 10, 12, 14, 16, 18));
+}
+
+TEST(ReweightTruncatedAction, SequencedExecutionPolicy) {
+  auto input = make_input();
+  input |= beluga::actions::reweight_truncated(
+      std::execution::seq, [](int value) { return static_cast<double>(value); }, [](int value) { return 2.0 * value; },
+      0.5);
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0, 2, 4, 6, 8, 10, 12, 14, 16, 18));
+}
+
+TEST(ReweightTruncatedAction, ParallelExecutionPolicy) {
+  auto input = make_input();
+  input |= beluga::actions::reweight_truncated(
+      std::execution::par, [](int value) { return static_cast<double>(value); }, [](int value) { return 2.0 * value; },
+      0.5);
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0, 2, 4, 6, 8, 10, 12, 14, 16, 18));
+}
+
+TEST(ReweightTruncatedAction, SmallFractionEvaluatesAtLeastOneParticle) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(2.0))};
+  auto evaluations = 0;
+  auto model = [&evaluations](int value) {
+    ++evaluations;
+    return static_cast<double>(value);
+  };
+  input |= beluga::actions::reweight_truncated([](int) { return 1.0; }, std::ref(model), 0.01);
+  ASSERT_EQ(evaluations, 1);
+  ASSERT_EQ(input.front(), std::make_tuple(5, 10.0));
+}
+
+}  // namespace
@@ -15,13 +15,18 @@
 #include <gtest/gtest.h>
 
 #include <execution>
+#include <future>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <Eigen/Core>
+#include <range/v3/view/zip.hpp>
 #include <sophus/se2.hpp>
 
 #include "beluga/algorithm/amcl_core.hpp"
+#include "beluga/algorithm/estimation.hpp"
 #include "beluga/algorithm/spatial_hash.hpp"
 #include "beluga/containers/tuple_vector.hpp"
 #include "beluga/motion/differential_drive_model.hpp"
@@ -66,6 +71,66 @@ auto make_amcl(const beluga::AmclParams& params = {}) {
   };
   return amcl;
 }
+
+auto make_fused_amcl(const beluga::AmclParams& params = {}) {
+  constexpr double kResolution = 1.0;
+  // clang-format off
+  const auto map = beluga::testing::StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false ,
+    false, false, false, false , false,
+    false, false, true , false, false,
+    false, false , false, false, false,
+    false , false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto random_state_maker = []() { return Sophus::SE2d{}; };
+
+  beluga::spatial_hash<Sophus::SE2d> hasher{0.1, 0.1, 0.1};
+
+  // One filter fed by two sensors, e.g. a front and a rear lidar.
+  beluga::Amcl amcl{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},
+      std::make_tuple(
+          beluga::BeamSensorModel{beluga::BeamModelParam{}, map},
+          beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map}),
+      std::move(random_state_maker),
+      std::move(hasher),
+      std::move(params),  //
+      std::execution::seq,
+  };
+  return amcl;
+}
+
+auto make_amcl_with_static_policies(const beluga::AmclParams& params = {}) {
+  constexpr double kResolution = 1.0;
+  // clang-format off
+  const auto map = beluga::testing::StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false ,
+    false, false, false, false , false,
+    false, false, true , false, false,
+    false, false , false, false, false,
+    false , false, false, false, false},
+    kResolution};
+  // clang-format on
+  const beluga::BeamModelParam param{};
+
+  auto random_state_maker = []() { return Sophus::SE2d{}; };
+
+  beluga::spatial_hash<Sophus::SE2d> hasher{0.1, 0.1, 0.1};
+
+  beluga::Amcl amcl{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},  //
+      beluga::BeamSensorModel{param, map},                                    //
+      std::move(random_state_maker),
+      std::move(hasher),
+      beluga::policies::on_motion<Sophus::SE2d>(params.update_min_d, params.update_min_a),
+      beluga::policies::every_n(params.resample_interval) && beluga::policies::on_effective_size_drop,
+      params,
+      std::execution::seq,
+  };
+  return amcl;
+}
 }  // namespace
 
 namespace beluga {
@@ -88,8 +153,7 @@ TEST(TestAmclCore, InitializeFromPose) {
 TEST(TestAmclCore, UpdateWithNoParticles) {
   auto amcl = make_amcl();
   ASSERT_EQ(amcl.particles().size(), 0);
-  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
-  ASSERT_FALSE(estimate.has_value());
+  ASSERT_FALSE(amcl.update(kDummyControl, kDummyMeasurement));
 }
 
 TEST(TestAmclCore, UpdateWithParticles) {
@@ -97,8 +161,7 @@ TEST(TestAmclCore, UpdateWithParticles) {
   ASSERT_EQ(amcl.particles().size(), 0);
   amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
   ASSERT_EQ(amcl.particles().size(), AmclParams{}.max_particles);
-  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
-  ASSERT_TRUE(estimate.has_value());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
 }
 
 TEST(TestAmclCore, UpdateWithParticlesNoMotion) {
@@ -106,10 +169,17 @@ TEST(TestAmclCore, UpdateWithParticlesNoMotion) {
   ASSERT_EQ(amcl.particles().size(), 0);
   amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
   ASSERT_EQ(amcl.particles().size(), AmclParams{}.max_particles);
-  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
-  ASSERT_TRUE(estimate.has_value());
-  estimate = amcl.update(kDummyControl, kDummyMeasurement);
-  ASSERT_FALSE(estimate.has_value());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  ASSERT_FALSE(amcl.update(kDummyControl, kDummyMeasurement));
+}
+
+TEST(TestAmclCore, UpdateWithStaticallyComposedPolicies) {
+  auto amcl = make_amcl_with_static_policies();
+  ASSERT_EQ(amcl.particles().size(), 0);
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_EQ(amcl.particles().size(), AmclParams{}.max_particles);
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  ASSERT_FALSE(amcl.update(kDummyControl, kDummyMeasurement));
 }
 
 TEST(TestAmclCore, UpdateWithParticlesForced) {
@@ -117,11 +187,75 @@ TEST(TestAmclCore, UpdateWithParticlesForced) {
   ASSERT_EQ(amcl.particles().size(), 0);
   amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
   ASSERT_EQ(amcl.particles().size(), AmclParams{}.max_particles);
-  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
-  ASSERT_TRUE(estimate.has_value());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  amcl.force_update();
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+}
+
+TEST(TestAmclCore, FusedUpdateWithTwoSensorModels) {
+  auto amcl = make_fused_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_EQ(amcl.particles().size(), AmclParams{}.max_particles);
+  ASSERT_TRUE(amcl.update(kDummyControl, std::make_tuple(kDummyMeasurement, kDummyMeasurement)));
+  ASSERT_FALSE(amcl.update(kDummyControl, std::make_tuple(kDummyMeasurement, kDummyMeasurement)));
   amcl.force_update();
-  estimate = amcl.update(kDummyControl, kDummyMeasurement);
-  ASSERT_TRUE(estimate.has_value());
+  ASSERT_TRUE(amcl.update(kDummyControl, std::make_tuple(kDummyMeasurement, kDummyMeasurement)));
+}
+
+TEST(TestAmclCore, FusedUpdateMap) {
+  auto amcl = make_fused_amcl();
+  constexpr double kResolution = 1.0;
+  const auto map =
+      beluga::testing::StaticOccupancyGrid<5, 5>{{
+                                                     false, false, false, false, false,  //
+                                                     false, false, false, false, false,  //
+                                                     false, false, true, false, false,   //
+                                                     false, false, false, false, false,  //
+                                                     false, false, false, false, false,  //
+                                                 },
+                                                 kResolution};
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  amcl.update_map(std::make_tuple(map, map));
+  ASSERT_TRUE(amcl.update(kDummyControl, std::make_tuple(kDummyMeasurement, kDummyMeasurement)));
+}
+
+TEST(TestAmclCore, AccumulatedControlTriggersUpdate) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  ASSERT_FALSE(amcl.update(kDummyControl, kDummyMeasurement));
+  // Back-and-forth odometry with no endpoint displacement is invisible to the
+  // control window, but the accumulated path length still triggers an update.
+  amcl.accumulate_control(Sophus::SE2d{});
+  amcl.accumulate_control(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{0.3, 0.0}});
+  amcl.accumulate_control(Sophus::SE2d{});
+  ASSERT_EQ(amcl.control_accumulation().sample_count, 3);
+  ASSERT_DOUBLE_EQ(amcl.control_accumulation().distance_traveled, 0.6);
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  // A performed update consumes the accumulated statistics.
+  ASSERT_EQ(amcl.control_accumulation().sample_count, 0);
+  ASSERT_FALSE(amcl.update(kDummyControl, kDummyMeasurement));
+}
+
+TEST(TestAmclCore, EstimateMatchesParticleSet) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  const auto [pose, covariance] = amcl.estimate();
+  const auto [expected_pose, expected_covariance] =
+      beluga::estimate(beluga::views::states(amcl.particles()), beluga::views::weights(amcl.particles()));
+  ASSERT_TRUE(pose.matrix().isApprox(expected_pose.matrix()));
+  ASSERT_TRUE(covariance.isApprox(expected_covariance));
+}
+
+TEST(TestAmclCore, EstimateIsCachedBetweenUpdates) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  const auto first = amcl.estimate();
+  const auto second = amcl.estimate();
+  ASSERT_TRUE(first.first.matrix().isApprox(second.first.matrix()));
+  ASSERT_TRUE(first.second.isApprox(second.second));
 }
 
 TEST(TestAmclCore, ParticlesDependentRandomStateGenerator) {
@@ -157,8 +291,42 @@ TEST(TestAmclCore, ParticlesDependentRandomStateGenerator) {
   };
   amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
   ASSERT_EQ(amcl.particles().size(), AmclParams{}.max_particles);
-  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
-  ASSERT_TRUE(estimate.has_value());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+}
+
+TEST(TestAmclCore, PreprocessedMeasurementSharedAcrossFilters) {
+  constexpr double kResolution = 1.0;
+  // clang-format off
+  const auto map = beluga::testing::StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false ,
+    false, false, false, false , false,
+    false, false, true , false, false,
+    false, false , false, false, false,
+    false , false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto make_filter = [&map]() {
+    return beluga::Amcl{
+        beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},   //
+        beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map},  //
+        []() { return Sophus::SE2d{}; },
+        beluga::spatial_hash<Sophus::SE2d>{0.1, 0.1, 0.1},
+        beluga::AmclParams{},
+        std::execution::seq,
+    };
+  };
+  auto first_filter = make_filter();
+  auto second_filter = make_filter();
+  first_filter.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  second_filter.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+
+  // Preprocess the measurement once and hand the shared handle to both filters.
+  const auto model = beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map};
+  const auto scan = model.preprocess_measurement(std::vector<std::pair<double, double>>{kDummyMeasurement});
+  ASSERT_TRUE(first_filter.update(kDummyControl, scan));
+  ASSERT_TRUE(second_filter.update(kDummyControl, scan));
+  ASSERT_EQ(first_filter.particles().size(), second_filter.particles().size());
 }
 
 TEST(TestAmclCore, SelectiveResampleCanBeConstructed) {
@@ -167,8 +335,139 @@ TEST(TestAmclCore, SelectiveResampleCanBeConstructed) {
   auto amcl = make_amcl(params);
   amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
   ASSERT_EQ(amcl.particles().size(), AmclParams{}.max_particles);
-  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
-  ASSERT_TRUE(estimate.has_value());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+}
+
+TEST(TestAmclCore, OverlappedPreprocessingUpdate) {
+  auto params = beluga::AmclParams{};
+  params.overlap_measurement_preprocessing = true;
+  auto amcl = make_amcl(params);
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  ASSERT_GT(amcl.particles().size(), 0);
+  // Update gating is unaffected by the overlap: no motion still skips the update.
+  ASSERT_FALSE(amcl.update(kDummyControl, kDummyMeasurement));
+  amcl.force_update();
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+}
+
+TEST(TestAmclCore, SnapshotRestoreRoundTrip) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  const auto blob = amcl.snapshot();
+
+  auto restored = make_amcl();
+  ASSERT_TRUE(restored.restore(blob));
+  ASSERT_EQ(restored.particles().size(), amcl.particles().size());
+  for (const auto& [expected, actual] :
+       ranges::views::zip(beluga::views::states(amcl.particles()), beluga::views::states(restored.particles()))) {
+    ASSERT_TRUE(expected.matrix().isApprox(actual.matrix()));
+  }
+  for (const auto& [expected, actual] :
+       ranges::views::zip(beluga::views::weights(amcl.particles()), beluga::views::weights(restored.particles()))) {
+    ASSERT_EQ(static_cast<double>(expected), static_cast<double>(actual));
+  }
+}
+
+TEST(TestAmclCore, RestoreRejectsTruncatedBlob) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  auto blob = amcl.snapshot();
+  blob.pop_back();
+
+  auto restored = make_amcl();
+  ASSERT_FALSE(restored.restore(blob));
+  ASSERT_EQ(restored.particles().size(), 0);
+}
+
+TEST(TestAmclCore, LatencyBudgetShrinksParticleSet) {
+  auto params = beluga::AmclParams{};
+  params.min_particles = 50;
+  params.max_particles = 2000;
+  params.update_latency_budget = 1e-9;  // Impossibly tight budget; every update runs over it.
+  auto amcl = make_amcl(params);
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  for (int i = 0; i < 10; ++i) {
+    amcl.force_update();
+    ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  }
+  // The controller must have collapsed the effective maximum down to the configured minimum.
+  ASSERT_EQ(amcl.particles().size(), params.min_particles);
+}
+
+TEST(TestAmclCore, PropagateOnlyWithNoParticles) {
+  auto amcl = make_amcl();
+  ASSERT_FALSE(amcl.propagate_only(kDummyControl));
+}
+
+TEST(TestAmclCore, PropagateOnlyExtrapolatesEstimate) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  const auto [pose, covariance] = amcl.estimate();
+
+  const auto motion = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.0, 0.0}};
+  ASSERT_TRUE(amcl.propagate_only(motion));
+
+  const auto [extrapolated_pose, extrapolated_covariance] = amcl.estimate();
+  const auto expected_pose = pose * (kDummyControl.inverse() * motion);
+  ASSERT_TRUE(extrapolated_pose.matrix().isApprox(expected_pose.matrix()));
+  ASSERT_TRUE(extrapolated_covariance.isApprox(covariance));
+}
+
+TEST(TestAmclCore, AsyncUpdateMatchesSynchronousBehavior) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  auto first = amcl.update_async(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(first.get());
+  ASSERT_GT(amcl.particles().size(), 0);
+  // Without motion the update policy skips the second update, just like update().
+  auto second = amcl.update_async(kDummyControl, kDummyMeasurement);
+  ASSERT_FALSE(second.get());
+  amcl.force_update();
+  auto third = amcl.update_async(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(third.get());
+}
+
+TEST(TestAmclCore, BatchUpdateRunsLogBackToBack) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  auto log = std::vector<std::pair<Sophus::SE2d, std::vector<std::pair<double, double>>>>{};
+  log.emplace_back(kDummyControl, kDummyMeasurement);  // performed, first update is forced
+  log.emplace_back(kDummyControl, kDummyMeasurement);  // skipped, no motion
+  log.emplace_back(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.0, 0.0}}, kDummyMeasurement);  // performed
+  ASSERT_EQ(amcl.update_batch(std::move(log)), 2U);
+  ASSERT_GT(amcl.particles().size(), 0);
+}
+
+TEST(TestAmclCore, ParallelReplaysAreReproducible) {
+  constexpr std::size_t kNumReplays = 3;
+  const auto run_replays = [] {
+    auto logs = std::vector<std::vector<std::pair<Sophus::SE2d, std::vector<std::pair<double, double>>>>>{};
+    for (std::size_t i = 0; i < kNumReplays; ++i) {
+      auto& log = logs.emplace_back();
+      log.emplace_back(kDummyControl, kDummyMeasurement);
+      log.emplace_back(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.0, 0.0}}, kDummyMeasurement);
+    }
+    auto poses = std::vector<Sophus::SE2d>(kNumReplays);
+    beluga::replay_in_parallel(
+        [](std::size_t) {
+          auto filter = make_amcl();
+          filter.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+          return filter;
+        },
+        std::move(logs),
+        [&poses](std::size_t index, auto& filter) { poses[index] = filter.estimate().first; },  //
+        2, 42U);
+    return poses;
+  };
+  const auto first = run_replays();
+  const auto second = run_replays();
+  for (std::size_t i = 0; i < kNumReplays; ++i) {
+    ASSERT_TRUE(first[i].matrix().isApprox(second[i].matrix()));
+  }
 }
 
 TEST(TestAmclCore, TestRandomParticlesInserting) {
@@ -185,4 +484,129 @@ TEST(TestAmclCore, TestRandomParticlesInserting) {
   }
 }
 
+namespace {
+
+struct IdentityStateMaker {
+  auto operator()() const { return Sophus::SE2d{}; }
+};
+
+struct RecordingInstrumentation {
+  std::vector<beluga::AmclUpdateInstrumentation>* records = nullptr;
+  void operator()(const beluga::AmclUpdateInstrumentation& stats) const { records->push_back(stats); }
+};
+
+}  // namespace
+
+TEST(TestAmclCore, InstrumentationHookReceivesUpdateStats) {
+  constexpr double kResolution = 1.0;
+  // clang-format off
+  const auto map = beluga::testing::StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false ,
+    false, false, false, false , false,
+    false, false, true , false, false,
+    false, false , false, false, false,
+    false , false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  using ParticleType = std::tuple<Sophus::SE2d, beluga::Weight>;
+  using AmclWithHooks = beluga::Amcl<
+      beluga::DifferentialDriveModel2d,
+      beluga::BeamSensorModel<beluga::testing::StaticOccupancyGrid<5, 5>>,
+      IdentityStateMaker,
+      beluga::Weight,
+      ParticleType,
+      std::execution::sequenced_policy,
+      beluga::any_policy<Sophus::SE2d>,
+      beluga::any_policy<beluga::TupleVector<ParticleType>>,
+      RecordingInstrumentation>;
+
+  AmclWithHooks amcl{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},  //
+      beluga::BeamSensorModel{beluga::BeamModelParam{}, map},                 //
+      IdentityStateMaker{},
+      beluga::spatial_hash<Sophus::SE2d>{0.1, 0.1, 0.1},
+      beluga::AmclParams{},
+      std::execution::seq,
+  };
+
+  std::vector<beluga::AmclUpdateInstrumentation> records;
+  amcl.instrumentation().records = &records;
+
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement));
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records.front().particle_count, amcl.particles().size());
+  EXPECT_TRUE(records.front().resampled);
+  EXPECT_GT(records.front().effective_sample_size, 0.0);
+
+  // Skipped updates don't report.
+  ASSERT_FALSE(amcl.update(kDummyControl, kDummyMeasurement));
+  ASSERT_EQ(records.size(), 1);
+}
+
+struct SinglePrecisionMotionModel {
+  template <class ControlWindow>
+  [[nodiscard]] auto operator()(ControlWindow&&) const {
+    return [](const Sophus::SE2f& state, auto& /*gen*/) { return state; };
+  }
+};
+
+struct SinglePrecisionSensorModel {
+  using state_type = Sophus::SE2f;
+  using weight_type = float;
+  using measurement_type = std::vector<std::pair<double, double>>;
+  using map_type = int;
+
+  void update_map(map_type) {}
+
+  [[nodiscard]] auto operator()(measurement_type&&) const {
+    return [](const state_type&) -> weight_type { return 1.0F; };
+  }
+};
+
+struct SinglePrecisionStateMaker {
+  [[nodiscard]] Sophus::SE2f operator()() const { return Sophus::SE2f{}; }
+};
+
+TEST(TestAmclCore, SinglePrecisionParticlePipeline) {
+  auto params = beluga::AmclParams{};
+  params.min_particles = 10UL;
+  params.max_particles = 50UL;
+  params.resample_interval = 2UL;
+
+  auto amcl = beluga::Amcl<
+      SinglePrecisionMotionModel, SinglePrecisionSensorModel, SinglePrecisionStateMaker, beluga::WeightF>{
+      SinglePrecisionMotionModel{},
+      SinglePrecisionSensorModel{},
+      SinglePrecisionStateMaker{},
+      beluga::spatial_hash<Sophus::SE2f>{0.1, 0.1, 0.1},
+      params,
+      std::execution::seq,
+  };
+
+  amcl.initialize(Sophus::SE2f{}, (0.01F * Eigen::Vector3f::Ones()).asDiagonal());
+  ASSERT_EQ(amcl.particles().size(), params.max_particles);
+
+  // The first update reweights and normalizes without resampling; the stored
+  // single-precision weights sum to one through double-precision accumulation.
+  ASSERT_TRUE(amcl.update(Sophus::SE2f{}, kDummyMeasurement));
+  double total_weight = 0.0;
+  for (const double weight : beluga::views::weights(amcl.particles())) {
+    total_weight += weight;
+  }
+  EXPECT_NEAR(total_weight, 1.0, 1e-4);
+
+  const auto& [pose, covariance] = amcl.estimate();
+  static_assert(std::is_same_v<std::decay_t<decltype(pose)>, Sophus::SE2f>);
+  static_assert(std::is_same_v<std::decay_t<decltype(covariance)>, Eigen::Matrix3f>);
+  EXPECT_NEAR(static_cast<double>(pose.translation().norm()), 0.0, 0.2);
+
+  // The second update resamples, exercising the single-precision spatial hasher.
+  const auto moved = Sophus::SE2f{Sophus::SO2f{}, Eigen::Vector2f{1.0F, 0.0F}};
+  ASSERT_TRUE(amcl.update(moved, kDummyMeasurement));
+  EXPECT_GE(amcl.particles().size(), params.min_particles);
+  EXPECT_LE(amcl.particles().size(), params.max_particles);
+}
+
 }  // namespace beluga
@@ -0,0 +1,105 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <execution>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+#include <sophus/se2.hpp>
+
+#include "beluga/algorithm/amcl_core.hpp"
+#include "beluga/algorithm/amcl_ensemble.hpp"
+#include "beluga/algorithm/spatial_hash.hpp"
+#include "beluga/motion/differential_drive_model.hpp"
+#include "beluga/sensor/likelihood_field_model.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+const auto kDummyControl = Sophus::SE2d{};
+const std::vector kDummyMeasurement = {
+    std::make_pair(0.0, 0.0),
+    std::make_pair(0.0, 0.0),
+    std::make_pair(0.0, 0.0),
+};
+
+auto make_filter_factory(const beluga::AmclParams& params) {
+  constexpr double kResolution = 1.0;
+  // clang-format off
+  const auto map = beluga::testing::StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false ,
+    false, false, false, false , false,
+    false, false, true , false, false,
+    false, false , false, false, false,
+    false , false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  // All members share the same immutable likelihood field through the copied model.
+  const auto sensor_model = beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map};
+
+  return [sensor_model, params]() {
+    auto random_state_maker = []() { return Sophus::SE2d{}; };
+    beluga::spatial_hash<Sophus::SE2d> hasher{0.1, 0.1, 0.1};
+    return beluga::Amcl{
+        beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},  //
+        sensor_model,                                                           //
+        std::move(random_state_maker),
+        std::move(hasher),
+        params,
+        std::execution::seq,
+    };
+  };
+}
+
+}  // namespace
+
+namespace beluga {
+
+TEST(TestAmclEnsemble, ConstructsRequestedNumberOfFilters) {
+  auto ensemble = beluga::AmclEnsemble<decltype(make_filter_factory({})())>{3, make_filter_factory({})};
+  ASSERT_EQ(ensemble.filters().size(), 3);
+}
+
+TEST(TestAmclEnsemble, UpdateRunsAllMembers) {
+  auto params = beluga::AmclParams{};
+  params.max_particles = 200;
+  auto ensemble = beluga::AmclEnsemble<decltype(make_filter_factory(params)())>{3, make_filter_factory(params)};
+  ensemble.initialize(Sophus::SE2d{}, Eigen::Matrix3d{Eigen::Vector3d::Ones().asDiagonal()});
+  ASSERT_TRUE(ensemble.update(kDummyControl, kDummyMeasurement));
+  for (const auto& filter : ensemble.filters()) {
+    ASSERT_GT(filter.particles().size(), 0);
+  }
+  // Without motion every member skips the next update, mirroring a single filter.
+  ASSERT_FALSE(ensemble.update(kDummyControl, kDummyMeasurement));
+}
+
+TEST(TestAmclEnsemble, EstimateComesFromBestHypothesis) {
+  auto params = beluga::AmclParams{};
+  params.max_particles = 200;
+  auto ensemble = beluga::AmclEnsemble<decltype(make_filter_factory(params)())>{3, make_filter_factory(params)};
+  ensemble.initialize(Sophus::SE2d{}, Eigen::Matrix3d{Eigen::Vector3d::Ones().asDiagonal()});
+  ASSERT_TRUE(ensemble.update(kDummyControl, kDummyMeasurement));
+  const auto index = ensemble.best_hypothesis();
+  ASSERT_LT(index, ensemble.filters().size());
+  const auto [pose, covariance] = ensemble.estimate();
+  const auto [expected_pose, expected_covariance] = ensemble.filters()[index].estimate();
+  ASSERT_TRUE(pose.matrix().isApprox(expected_pose.matrix()));
+  ASSERT_TRUE(covariance.isApprox(expected_covariance));
+}
+
+}  // namespace beluga
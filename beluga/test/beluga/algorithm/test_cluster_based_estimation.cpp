@@ -157,6 +157,67 @@ TEST_F(ClusterBasedEstimationDetailTesting, GridCellDataMapGenerationStep) {
   ASSERT_FALSE(test_data[hash20].cluster_id.has_value());
 }
 
+TEST_F(ClusterBasedEstimationDetailTesting, RadixSortByHash) {
+  auto items = std::vector<std::pair<std::size_t, std::size_t>>{
+      {501, 0}, {3, 1}, {501, 2}, {0xFFFFFFFFFFFFFFFFUL, 3}, {0, 4}, {3, 5},
+  };
+
+  clusterizer_detail::radix_sort_by_hash(items);
+
+  // items end up in ascending hash order, preserving the relative order of equal hashes
+  const auto expected = std::vector<std::pair<std::size_t, std::size_t>>{
+      {0, 4}, {3, 1}, {3, 5}, {501, 0}, {501, 2}, {0xFFFFFFFFFFFFFFFFUL, 3},
+  };
+  ASSERT_EQ(items, expected);
+}
+
+TEST_F(ClusterBasedEstimationDetailTesting, GridCellArrayGenerationStep) {
+  const auto s00 = SE2d{SO2d{0.0}, Vector2d{0.25, 0.25}};  // bin 1
+  const auto s01 = SE2d{SO2d{0.0}, Vector2d{0.75, 0.75}};  // bin 1
+  const auto s10 = SE2d{SO2d{2.0}, Vector2d{0.00, 0.00}};  // bin 2
+  const auto s20 = SE2d{SO2d{2.0}, Vector2d{2.00, 0.00}};  // bin 3
+
+  const auto particles = std::vector<std::pair<SE2d, beluga::Weight>>{
+      std::make_pair(s00, 1.5),
+      std::make_pair(s01, 0.5),
+      std::make_pair(s10, 1.0),
+      std::make_pair(s20, 1.0),
+  };
+
+  auto states = beluga::views::states(particles);
+  auto weights = beluga::views::weights(particles);
+  auto hashes = states | ranges::views::transform(spatial_hash_function) | ranges::to<std::vector>;
+
+  auto cells = clusterizer_detail::make_cluster_cell_array(states, weights, hashes);
+
+  ASSERT_EQ(cells.hashes.size(), 3);
+  ASSERT_TRUE(std::is_sorted(cells.hashes.begin(), cells.hashes.end()));
+
+  const auto index_of = [&cells](std::size_t hash) {
+    const auto it = std::lower_bound(cells.hashes.begin(), cells.hashes.end(), hash);
+    return static_cast<std::size_t>(std::distance(cells.hashes.begin(), it));
+  };
+
+  const auto i00 = index_of(spatial_hash_function(s00));
+  const auto i10 = index_of(spatial_hash_function(s10));
+  const auto i20 = index_of(spatial_hash_function(s20));
+
+  EXPECT_EQ(cells.weights[i00], 2.0);
+  EXPECT_EQ(cells.weights[i10], 1.0);
+  EXPECT_EQ(cells.weights[i20], 1.0);
+
+  EXPECT_EQ(cells.num_particles[i00], 2);
+  EXPECT_EQ(cells.num_particles[i10], 1);
+  EXPECT_EQ(cells.num_particles[i20], 1);
+
+  ASSERT_THAT(cells.states[i00], SE2Near(s00.so2(), s00.translation(), kTolerance));
+  ASSERT_THAT(cells.states[i10], SE2Near(s10.so2(), s10.translation(), kTolerance));
+  ASSERT_THAT(cells.states[i20], SE2Near(s20.so2(), s20.translation(), kTolerance));
+
+  // cluster ids are only populated by a subsequent assign_clusters call
+  ASSERT_TRUE(cells.cluster_ids.empty());
+}
+
 TEST_F(ClusterBasedEstimationDetailTesting, MakePriorityQueue) {
   // data preparation
   auto data = generate_test_grid_cell_data_map();
@@ -385,6 +446,24 @@ TEST_F(ClusterBasedEstimationDetailTesting, HeaviestClusterSelectionTest) {
   ASSERT_NEAR(covariance(2, 2), expected_covariance(2, 2), 0.001);
 }
 
+TEST_F(ClusterBasedEstimationDetailTesting, StatefulEstimatorMatchesFreeFunction) {
+  const auto particles = make_particle_multicluster_dataset(-2.0, +2.0, -2.0, +2.0, 0.025);
+
+  const auto [expected_pose, expected_covariance] =
+      beluga::cluster_based_estimate(beluga::views::states(particles), beluga::views::weights(particles));
+
+  auto estimator = ClusterBasedEstimator{};
+
+  // repeated calls reuse the internal buffers and yield the same estimate every time
+  for (int repetition = 0; repetition < 3; ++repetition) {
+    const auto [pose, covariance] = estimator(particles);
+    ASSERT_THAT(pose, SE2Near(expected_pose.so2(), expected_pose.translation(), kTolerance));
+    ASSERT_THAT(covariance.col(0).eval(), Vector3Near(expected_covariance.col(0).eval(), kTolerance));
+    ASSERT_THAT(covariance.col(1).eval(), Vector3Near(expected_covariance.col(1).eval(), kTolerance));
+    ASSERT_THAT(covariance.col(2).eval(), Vector3Near(expected_covariance.col(2).eval(), kTolerance));
+  }
+}
+
 TEST_F(ClusterBasedEstimationDetailTesting, NightmareDistributionTest) {
   // particles so far away that they are isolated and will therefore form four separate single
   // particle clusters
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <execution>
 #include <vector>
 
 #include "beluga/algorithm/distance_map.hpp"
@@ -84,4 +85,68 @@ TEST(DistanceMap, MapWithTruncatedDistances) {
   ASSERT_THAT(distance_map, testing::ElementsAre(3, 3, 3, 2, 1, 0));
 }
 
+TEST(DistanceMap2d, Empty) {
+  auto map = std::vector<bool>{};
+  auto distance_map = beluga::nearest_obstacle_distance_map_2d(map, 1, 1.0F, 100.0F);
+  ASSERT_EQ(distance_map.size(), 0);
+}
+
+TEST(DistanceMap2d, NoObstacles) {
+  auto map = std::vector<bool>(9, false);
+  auto distance_map = beluga::nearest_obstacle_distance_map_2d(map, 3, 1.0F, 100.0F);
+  ASSERT_THAT(distance_map, testing::Each(100.0F));
+}
+
+TEST(DistanceMap2d, AllObstacles) {
+  auto map = std::vector<bool>(9, true);
+  auto distance_map = beluga::nearest_obstacle_distance_map_2d(map, 3, 1.0F, 100.0F);
+  ASSERT_THAT(distance_map, testing::Each(0.0F));
+}
+
+TEST(DistanceMap2d, CenterObstacle) {
+  // clang-format off
+  auto map = std::vector<bool>{
+    false, false, false,
+    false, true , false,
+    false, false, false};
+  // clang-format on
+  auto distance_map = beluga::nearest_obstacle_distance_map_2d(map, 3, 1.0F, 100.0F);
+  ASSERT_THAT(
+      distance_map, testing::ElementsAre(
+                        2.0F, 1.0F, 2.0F,  //
+                        1.0F, 0.0F, 1.0F,  //
+                        2.0F, 1.0F, 2.0F));
+}
+
+TEST(DistanceMap2d, ExactDiagonalDistances) {
+  // clang-format off
+  auto map = std::vector<bool>{
+    true , false, false,
+    false, false, false,
+    false, false, false};
+  // clang-format on
+  auto distance_map = beluga::nearest_obstacle_distance_map_2d(map, 3, 1.0F, 100.0F);
+  ASSERT_THAT(
+      distance_map, testing::ElementsAre(
+                        0.0F, 1.0F, 4.0F,  //
+                        1.0F, 2.0F, 5.0F,  //
+                        4.0F, 5.0F, 8.0F));
+}
+
+TEST(DistanceMap2d, ParallelMatchesSequential) {
+  auto map = std::vector<bool>(64, false);
+  map[9] = true;
+  map[38] = true;
+  map[60] = true;
+  auto sequential = beluga::nearest_obstacle_distance_map_2d(map, 8, 1.0F, 100.0F);
+  auto parallel = beluga::nearest_obstacle_distance_map_2d(std::execution::par, map, 8, 1.0F, 100.0F);
+  ASSERT_EQ(parallel, sequential);
+}
+
+TEST(DistanceMap2d, ScaledResolutionAndTruncation) {
+  auto map = std::vector<bool>{true, false, false, false};
+  auto distance_map = beluga::nearest_obstacle_distance_map_2d(map, 4, 0.25F, 1.0F);
+  ASSERT_THAT(distance_map, testing::ElementsAre(0.0F, 0.25F, 1.0F, 1.0F));
+}
+
 }  // namespace
@@ -79,4 +79,12 @@ TEST(EffectiveSampleSize, Particles) {
   ASSERT_NEAR(beluga::effective_sample_size(particles), 2.66, 0.01);
 }
 
+TEST(WeightStatistics, AverageWeight) {
+  auto statistics = beluga::WeightStatistics{};
+  ASSERT_EQ(statistics.average_weight(), 0.0);  // no samples accumulated yet
+  statistics.total_weight = 6.0;
+  statistics.sample_count = 4;
+  ASSERT_NEAR(statistics.average_weight(), 1.5, 1e-12);
+}
+
 }  // namespace
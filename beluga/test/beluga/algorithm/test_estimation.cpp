@@ -18,6 +18,7 @@
 #include <gtest/gtest-death-test.h>
 #include <algorithm>
 #include <array>
+#include <execution>
 #include <ios>
 #include <limits>
 #include <numeric>
@@ -344,6 +345,65 @@ TEST_F(PoseCovarianceEstimation, SE3EquallyWeighted) {
   }
 }
 
+struct ExecutionPolicyEstimation : public testing::Test {};
+
+TEST_F(ExecutionPolicyEstimation, SE2MatchesSequentialOverload) {
+  // The parallel overload reduces partial moments in an unspecified order, so results
+  // are only expected to match up to floating point round-off.
+  const auto states = std::vector{
+      SE2d{SO2d{Constants::pi() * 0.1}, Vector2d{0.0, -2.0}},  //
+      SE2d{SO2d{Constants::pi() * 0.2}, Vector2d{1.0, -1.0}},  //
+      SE2d{SO2d{Constants::pi() * 0.3}, Vector2d{2.0, 1.0}},   //
+      SE2d{SO2d{Constants::pi() * 0.2}, Vector2d{3.0, 2.0}},   //
+      SE2d{SO2d{Constants::pi() * 0.2}, Vector2d{2.0, 1.0}},   //
+      SE2d{SO2d{Constants::pi() * 0.4}, Vector2d{1.0, 2.0}},   //
+  };
+  const auto weights = std::vector{0.1, 0.4, 0.7, 0.1, 0.9, 0.4};
+  constexpr double kTolerance = 1e-9;
+  const auto [expected_pose, expected_covariance] = beluga::estimate(states, weights);
+  const auto [pose, covariance] = beluga::estimate(std::execution::par, states, weights);
+  ASSERT_THAT(pose, SE2Near(expected_pose.so2(), expected_pose.translation(), kTolerance));
+  ASSERT_TRUE(covariance.isApprox(expected_covariance, kTolerance));
+}
+
+TEST_F(ExecutionPolicyEstimation, SE3MatchesSequentialOverload) {
+  constexpr double kTolerance = 1e-9;
+  const auto states = std::vector{
+      Sophus::SE3d{Sophus::SO3d::rotZ(0.5), Eigen::Vector3d{1.0, 2.0, 3.0}},
+      Sophus::SE3d{Sophus::SO3d::rotX(0.2), Eigen::Vector3d{0.0, -1.0, 2.0}},
+      Sophus::SE3d{Sophus::SO3d::rotY(-.3), Eigen::Vector3d{2.0, 0.0, -1.0}},
+      Sophus::SE3d{Sophus::SO3d::rotZ(-.5), Eigen::Vector3d{1.0, 1.0, 1.0}},
+  };
+  const auto weights = std::vector{0.2, 0.5, 0.8, 0.3};
+  const auto [expected_pose, expected_covariance] = beluga::estimate(states, weights);
+  const auto [pose, covariance] = beluga::estimate(std::execution::par, states, weights);
+  ASSERT_TRUE(pose.matrix().isApprox(expected_pose.matrix(), kTolerance));
+  ASSERT_TRUE(covariance.isApprox(expected_covariance, kTolerance));
+}
+
+TEST_F(ExecutionPolicyEstimation, VectorMatchesSequentialOverload) {
+  constexpr double kTolerance = 1e-9;
+  const auto states = std::vector{
+      Vector2d{0.0, -2.0}, Vector2d{1.0, -1.0}, Vector2d{2.0, 1.0},
+      Vector2d{3.0, 2.0},  Vector2d{2.0, 1.0},  Vector2d{1.0, 2.0},
+  };
+  const auto weights = std::vector{0.1, 0.4, 0.7, 0.1, 0.9, 0.4};
+  const auto [expected_mean, expected_covariance] = beluga::estimate(states, weights);
+  const auto [mean, covariance] = beluga::estimate(std::execution::par, states, weights);
+  ASSERT_TRUE(mean.isApprox(expected_mean, kTolerance));
+  ASSERT_TRUE(covariance.isApprox(expected_covariance, kTolerance));
+}
+
+TEST_F(ExecutionPolicyEstimation, ScalarMatchesSequentialOverload) {
+  constexpr double kTolerance = 1e-9;
+  const auto states = std::vector{0.0, 1.0, 1.0, 2.0, 2.0, 3.0, 4.0, 4.0, 5.0, 5.0, 6.0, 7.0, 7.0, 8.0, 9.0};
+  const auto weights = std::vector{0.1, 0.15, 0.15, 0.3, 0.3, 0.4, 0.8, 0.8, 0.4, 0.4, 0.35, 0.3, 0.3, 0.15, 0.1};
+  const auto [expected_mean, expected_variance] = beluga::estimate(states, weights);
+  const auto [mean, variance] = beluga::estimate(std::execution::par, states, weights);
+  ASSERT_NEAR(mean, expected_mean, kTolerance);
+  ASSERT_NEAR(variance, expected_variance, kTolerance);
+}
+
 TEST_F(PoseCovarianceEstimation, SE3BadArguments) {
   ASSERT_DEBUG_DEATH(beluga::estimate(std::array{Sophus::SE3d{}}, std::array{1., 1., 1.}), ".*");
   ASSERT_DEBUG_DEATH(beluga::estimate(std::array{Sophus::SE3d{}, Sophus::SE3d{}}, std::array{1., 1., 1.}), ".*");
@@ -14,13 +14,17 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <optional>
+#include <vector>
 
 #include <sophus/common.hpp>
 #include <sophus/se2.hpp>
 
 #include "beluga/algorithm/raycasting.hpp"
+#include "beluga/sensor/data/packed_occupancy_grid.hpp"
 #include "beluga/test/raycasting.hpp"
 #include "beluga/test/static_occupancy_grid.hpp"
 
@@ -130,6 +134,141 @@ TEST(Raycasting, NonIdentityGridOrigin) {
   }
 }
 
+TEST(Raycasting, AmanatidesWooTraversal) {
+  constexpr double kResolution = 0.5;
+  // Note that axes are:
+  // Positive X -> Right
+  // Positive Y -> Down
+
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  constexpr double kMaxRange = 5.;
+
+  {
+    // Horizontal ray that hits the occupied cell.
+    const auto pose = Sophus::SE2d{0., Eigen::Vector2d{0., 1.}};
+    const auto ray = Ray2d{grid, AmanatidesWoo2i{}, pose, kMaxRange};
+    EXPECT_EQ(ray.cast(Sophus::SO2d{0.}), 1.);
+  }
+
+  {
+    // Downwards ray that hits the map boundary.
+    const auto pose = Sophus::SE2d{0., Eigen::Vector2d{0., 1.}};
+    const auto ray = Ray2d{grid, AmanatidesWoo2i{}, pose, kMaxRange};
+    const auto distance = ray.cast(Sophus::SO2d{Sophus::Constants<double>::pi() / 2.});
+    EXPECT_EQ(distance, std::nullopt);
+  }
+
+  {
+    // Diagonal ray that hits the occupied cell.
+    const auto pose = Sophus::SE2d{0., Eigen::Vector2d{0., 0.}};
+    const auto ray = Ray2d{grid, AmanatidesWoo2i{}, pose, kMaxRange};
+    const auto distance = ray.cast(Sophus::SO2d{Sophus::Constants<double>::pi() / 4.});
+    EXPECT_EQ(distance, std::sqrt(2));
+  }
+}
+
+TEST(Raycasting, CastManyMatchesCast) {
+  constexpr double kResolution = 0.5;
+  constexpr double kMaxRange = 5.;
+
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto pose = Sophus::SE2d{0., Eigen::Vector2d{0., 1.}};
+  const auto ray = Ray2d{grid, pose, kMaxRange};
+
+  auto bearings = std::vector<Sophus::SO2d>{};
+  constexpr int kBearingCount = 16;
+  for (int i = 0; i < kBearingCount; ++i) {
+    bearings.emplace_back(2. * Sophus::Constants<double>::pi() * i / kBearingCount);
+  }
+
+  auto ranges = std::vector<double>{};
+  ray.cast_many(bearings, ranges, kMaxRange);
+
+  ASSERT_EQ(ranges.size(), bearings.size());
+  for (std::size_t i = 0; i < bearings.size(); ++i) {
+    EXPECT_EQ(ranges[i], ray.cast(bearings[i]).value_or(kMaxRange)) << "bearing index: " << i;
+  }
+}
+
+TEST(Raycasting, CachedCastManyMatchesCastMany) {
+  constexpr double kResolution = 0.5;
+  constexpr double kMaxRange = 5.;
+
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto pose = Sophus::SE2d{0., Eigen::Vector2d{0., 1.}};
+  const auto ray = Ray2d{grid, pose, kMaxRange};
+
+  auto bearings = std::vector<Sophus::SO2d>{};
+  constexpr int kBearingCount = 16;
+  for (int i = 0; i < kBearingCount; ++i) {
+    bearings.emplace_back(2. * Sophus::Constants<double>::pi() * i / kBearingCount);
+  }
+
+  auto ranges = std::vector<double>{};
+  ray.cast_many(bearings, ranges, kMaxRange);
+
+  auto cache = RaycastCache{};
+  cache.reset();
+  auto cold_ranges = std::vector<double>{};
+  ray.cast_many(bearings, cold_ranges, kMaxRange, cache);
+  auto warm_ranges = std::vector<double>{};
+  ray.cast_many(bearings, warm_ranges, kMaxRange, cache);
+
+  EXPECT_EQ(cold_ranges, ranges);
+  EXPECT_EQ(warm_ranges, ranges);
+}
+
+TEST(Raycasting, HierarchicalGridMatchesFlatGrid) {
+  constexpr double kResolution = 0.5;
+  constexpr double kMaxRange = 10.;
+
+  auto array = std::array<bool, 16 * 16>{};
+  array[4 * 16 + 11] = true;
+  array[9 * 16 + 2] = true;
+  array[14 * 16 + 14] = true;
+  const auto grid = StaticOccupancyGrid<16, 16>{array, kResolution};
+  const auto packed_grid = PackedOccupancyGrid2{grid};
+
+  static_assert(detail::has_free_block_index_v<PackedOccupancyGrid2>);
+  static_assert(!detail::has_free_block_index_v<StaticOccupancyGrid<16, 16>>);
+
+  const auto pose = Sophus::SE2d{0., Eigen::Vector2d{1.25, 1.25}};
+  const auto ray = Ray2d{grid, pose, kMaxRange};
+  const auto accelerated_ray = Ray2d{packed_grid, pose, kMaxRange};
+  constexpr int kBearingCount = 32;
+  for (int i = 0; i < kBearingCount; ++i) {
+    const auto bearing = Sophus::SO2d{2. * Sophus::Constants<double>::pi() * i / kBearingCount};
+    EXPECT_EQ(accelerated_ray.cast(bearing), ray.cast(bearing)) << "bearing index: " << i;
+  }
+}
+
 TEST(BaselineRaycasting, Nominal) {
   constexpr double kResolution = 0.5;
   // Note that axes are:
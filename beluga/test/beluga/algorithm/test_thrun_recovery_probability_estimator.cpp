@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "beluga/algorithm/thrun_recovery_probability_estimator.hpp"
@@ -69,6 +70,48 @@ TEST(ThrunRecoveryProbabilityEstimator, ProbabilityAfterUpdateAndReset) {
   ASSERT_EQ(estimator(input), 0.0);  // Test the probability after resetting the estimator.
 }
 
+TEST(ThrunRecoveryProbabilityEstimator, ProbabilityFromWeightStatistics) {
+  // The statistics overload must track the range overload exactly, update after update.
+  const double alpha_slow = 0.5;
+  const double alpha_fast = 1.0;
+  auto range_estimator = beluga::ThrunRecoveryProbabilityEstimator{alpha_slow, alpha_fast};
+  auto statistics_estimator = beluga::ThrunRecoveryProbabilityEstimator{alpha_slow, alpha_fast};
+
+  const auto make_statistics = [](const auto& particles) {
+    auto statistics = beluga::WeightStatistics{};
+    for (const auto& [state, weight] : particles) {
+      statistics.total_weight += weight;
+      statistics.squared_total_weight += weight * weight;
+      ++statistics.sample_count;
+    }
+    return statistics;
+  };
+
+  const auto inputs = std::vector<std::vector<std::tuple<int, beluga::Weight>>>{
+      {{5, 1.0}, {6, 2.0}, {7, 3.0}},
+      {{5, 0.5}, {6, 1.0}, {7, 1.5}},
+      {{5, 0.5}, {6, 1.0}, {7, 1.5}},
+  };
+  for (const auto& input : inputs) {
+    ASSERT_DOUBLE_EQ(statistics_estimator(make_statistics(input)), range_estimator(input));
+  }
+}
+
+TEST(ThrunRecoveryProbabilityEstimator, ResetOnEmptyWeightStatistics) {
+  // Empty statistics reset the estimator, same as an empty particle range.
+  const double alpha_slow = 0.5;
+  const double alpha_fast = 1.0;
+  auto estimator = beluga::ThrunRecoveryProbabilityEstimator{alpha_slow, alpha_fast};
+
+  auto statistics = beluga::WeightStatistics{};
+  statistics.total_weight = 3.0;
+  statistics.sample_count = 2;
+  ASSERT_EQ(estimator(statistics), 0.0);
+
+  ASSERT_EQ(estimator(beluga::WeightStatistics{}), 0.0);
+  ASSERT_EQ(estimator.filter_outputs(), std::make_pair(0.0, 0.0));
+}
+
 class ThrunRecoveryProbabilityWithParam : public ::testing::TestWithParam<std::tuple<double, double, double>> {};
 
 TEST_P(ThrunRecoveryProbabilityWithParam, Probabilities) {
@@ -0,0 +1,73 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <execution>
+#include <vector>
+
+#include "beluga/algorithm/top_k.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+
+namespace {
+
+TEST(TopK, SelectsBestWeightsFirst) {
+  const auto weights = std::vector<double>{0.1, 0.9, 0.3, 0.7, 0.5, 0.2, 0.8, 0.4, 0.6, 0.05};
+  const auto indices = beluga::top_k(weights, 3);
+  ASSERT_EQ(indices, (std::vector<std::size_t>{1, 6, 3}));
+}
+
+TEST(TopK, KLargerThanSizeIsCapped) {
+  const auto weights = std::vector<double>{0.2, 0.1, 0.3};
+  const auto indices = beluga::top_k(weights, 100);
+  ASSERT_EQ(indices, (std::vector<std::size_t>{2, 0, 1}));
+}
+
+TEST(TopK, ZeroAndEmpty) {
+  const auto weights = std::vector<double>{0.2, 0.1};
+  ASSERT_TRUE(beluga::top_k(weights, 0).empty());
+  ASSERT_TRUE(beluga::top_k(std::vector<double>{}, 3).empty());
+}
+
+TEST(TopK, ParticleRangeSelectsOverWeightColumn) {
+  auto particles = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  particles.push_back({10, beluga::Weight(0.1)});
+  particles.push_back({20, beluga::Weight(0.8)});
+  particles.push_back({30, beluga::Weight(0.4)});
+  particles.push_back({40, beluga::Weight(0.6)});
+
+  const auto indices = beluga::top_k(particles, 2);
+  ASSERT_EQ(indices, (std::vector<std::size_t>{1, 3}));
+  // The set itself is untouched; indices address its columns directly.
+  const auto states = particles.data<0>();
+  EXPECT_EQ(states[indices[0]], 20);
+  EXPECT_EQ(states[indices[1]], 40);
+  EXPECT_EQ(particles.data<0>()[0], 10);
+}
+
+TEST(TopK, ExecutionPolicyOverloadAgrees) {
+  auto particles = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  for (int i = 0; i < 100; ++i) {
+    particles.push_back({i, beluga::Weight((i * 37) % 100)});
+  }
+  const auto sequential = beluga::top_k(particles, 10);
+  const auto parallel = beluga::top_k(std::execution::par, particles, 10);
+  ASSERT_EQ(sequential.size(), 10UL);
+  // Weights here are unique, so both policies must agree exactly.
+  ASSERT_EQ(sequential, parallel);
+}
+
+}  // namespace
@@ -15,6 +15,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
 #include <cmath>
 
 #include <Eigen/Core>
@@ -162,7 +163,7 @@ TEST_F(UnscentedTransformTests, DifferentMeanFn) {
           return Eigen::Vector2d{std::hypot(in.x(), in.y()), std::atan2(in.y(), in.x())};
         },
         std::nullopt,
-        [](const std::vector<Eigen::Vector2d>& samples, const std::vector<double>& weights) -> Eigen::Vector2d {
+        [](const std::array<Eigen::Vector2d, 5>& samples, const std::array<double, 5>& weights) -> Eigen::Vector2d {
           Eigen::Vector3d aux = Eigen::Vector3d::Zero();
           for (const auto& [s, w] : ranges::views::zip(samples, weights)) {
             aux.x() += s.x() * w;
@@ -0,0 +1,134 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <range/v3/range/traits.hpp>
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/containers/decomposed_se2_vector.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/elements.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+[[nodiscard]] Sophus::SE2d make_pose(double x, double y, double theta) {
+  return Sophus::SE2d{Sophus::SO2d{theta}, Eigen::Vector2d{x, y}};
+}
+
+TEST(DecomposedSe2Vector, ResizeFillsIdentity) {
+  auto container = beluga::DecomposedSe2Vector<>{};
+  container.resize(3);
+  ASSERT_EQ(container.size(), 3);
+  for (auto&& [state, weight] : container) {
+    const Sophus::SE2d value = state;
+    ASSERT_TRUE(value.matrix().isApprox(Sophus::SE2d{}.matrix()));
+    ASSERT_EQ(weight, 0.0);
+  }
+}
+
+TEST(DecomposedSe2Vector, PushBackRoundTrip) {
+  auto container = beluga::DecomposedSe2Vector<>{};
+  const auto pose = make_pose(1.0, 2.0, 0.5);
+  container.push_back({pose, beluga::Weight{0.25}});
+  ASSERT_EQ(container.size(), 1);
+  auto&& [state, weight] = *container.begin();
+  const Sophus::SE2d value = state;
+  EXPECT_TRUE(value.matrix().isApprox(pose.matrix()));
+  EXPECT_EQ(weight, 0.25);
+}
+
+TEST(DecomposedSe2Vector, ScalarColumnsMatchStates) {
+  auto container = beluga::DecomposedSe2Vector<>{};
+  container.push_back({make_pose(1.0, 2.0, 0.0), beluga::Weight{1.0}});
+  container.push_back({make_pose(3.0, 4.0, Sophus::Constants<double>::pi() / 2), beluga::Weight{1.0}});
+  EXPECT_DOUBLE_EQ(container.x()[0], 1.0);
+  EXPECT_DOUBLE_EQ(container.y()[0], 2.0);
+  EXPECT_DOUBLE_EQ(container.cos_theta()[0], 1.0);
+  EXPECT_DOUBLE_EQ(container.sin_theta()[0], 0.0);
+  EXPECT_DOUBLE_EQ(container.x()[1], 3.0);
+  EXPECT_DOUBLE_EQ(container.y()[1], 4.0);
+  EXPECT_NEAR(container.cos_theta()[1], 0.0, 1e-15);
+  EXPECT_DOUBLE_EQ(container.sin_theta()[1], 1.0);
+}
+
+TEST(DecomposedSe2Vector, StatesViewWritesThrough) {
+  auto container = beluga::DecomposedSe2Vector<>{};
+  container.resize(2);
+  auto states = beluga::views::states(container);
+  static_assert(std::is_same_v<ranges::range_value_t<decltype(states)>, Sophus::SE2d>);
+  *states.begin() = make_pose(5.0, 6.0, 0.0);
+  EXPECT_DOUBLE_EQ(container.x()[0], 5.0);
+  EXPECT_DOUBLE_EQ(container.y()[0], 6.0);
+  EXPECT_DOUBLE_EQ(container.x()[1], 0.0);  // The second state is untouched.
+}
+
+TEST(DecomposedSe2Vector, WeightsColumnFastPath) {
+  auto container = beluga::DecomposedSe2Vector<>{};
+  static_assert(beluga::views::detail::has_contiguous_columns<decltype(container)>::value);
+  container.resize(2);
+  auto weights = beluga::views::weights(container);
+  weights[1] = 0.5;
+  auto&& [state, weight] = *std::next(container.begin());
+  EXPECT_EQ(weight, 0.5);
+}
+
+TEST(DecomposedSe2Vector, ApplyAncestry) {
+  auto container = beluga::DecomposedSe2Vector<>{};
+  container.push_back({make_pose(1.0, 0.0, 0.0), beluga::Weight{0.1}});
+  container.push_back({make_pose(2.0, 0.0, 0.0), beluga::Weight{0.2}});
+  container.push_back({make_pose(3.0, 0.0, 0.0), beluga::Weight{0.3}});
+  container.apply_ancestry(std::vector<std::size_t>{1, 1, 1});
+  EXPECT_DOUBLE_EQ(container.x()[0], 2.0);
+  EXPECT_DOUBLE_EQ(container.x()[1], 2.0);
+  EXPECT_DOUBLE_EQ(container.x()[2], 2.0);
+  auto weights = beluga::views::weights(container);
+  EXPECT_DOUBLE_EQ(weights[0], 0.2);
+  EXPECT_DOUBLE_EQ(weights[2], 0.2);
+}
+
+TEST(DecomposedSe2Vector, AssignFromInterleavedStorage) {
+  auto interleaved = beluga::TupleVector<std::tuple<Sophus::SE2d, beluga::Weight>>{};
+  interleaved.push_back({make_pose(1.0, 2.0, 0.5), beluga::Weight{0.75}});
+  interleaved.push_back({make_pose(-1.0, -2.0, -0.5), beluga::Weight{0.25}});
+  auto container = beluga::DecomposedSe2Vector<>{};
+  container.assign_range(interleaved);
+  ASSERT_EQ(container.size(), 2);
+  auto states = beluga::views::states(container);
+  EXPECT_TRUE(Sophus::SE2d{states[0]}.matrix().isApprox(make_pose(1.0, 2.0, 0.5).matrix()));
+  EXPECT_TRUE(Sophus::SE2d{states[1]}.matrix().isApprox(make_pose(-1.0, -2.0, -0.5).matrix()));
+  auto weights = beluga::views::weights(container);
+  EXPECT_DOUBLE_EQ(weights[0], 0.75);
+  EXPECT_DOUBLE_EQ(weights[1], 0.25);
+}
+
+TEST(DecomposedSe2Vector, SinglePrecisionColumns) {
+  auto container = beluga::DecomposedSe2Vector<float, beluga::WeightF>{};
+  container.push_back({Sophus::SE2f{Sophus::SO2f{0.5F}, Eigen::Vector2f{1.0F, 2.0F}}, beluga::WeightF{0.5F}});
+  static_assert(std::is_same_v<ranges::range_value_t<decltype(container.x())>, float>);
+  EXPECT_FLOAT_EQ(container.x()[0], 1.0F);
+  auto weights = beluga::views::weights(container);
+  EXPECT_FLOAT_EQ(weights[0], 0.5F);
+}
+
+}  // namespace
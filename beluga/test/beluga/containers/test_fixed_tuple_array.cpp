@@ -0,0 +1,93 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/actions/normalize.hpp"
+#include "beluga/actions/reweight.hpp"
+#include "beluga/containers/fixed_tuple_array.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+using Particle = std::tuple<int, beluga::Weight>;
+
+TEST(FixedTupleArray, DefaultConstructed) {
+  auto container = beluga::FixedTupleArray<Particle, 8>{};
+  ASSERT_TRUE(container.empty());
+  ASSERT_EQ(container.size(), 0);
+  ASSERT_EQ(container.capacity(), 8);
+}
+
+TEST(FixedTupleArray, SizeConstructed) {
+  auto container = beluga::FixedTupleArray<Particle, 8>{5};
+  ASSERT_EQ(container.size(), 5);
+  for (auto&& [state, weight] : container) {
+    ASSERT_EQ(state, int{});
+    ASSERT_EQ(weight, double{});
+  }
+}
+
+TEST(FixedTupleArray, PushBackAndClear) {
+  auto container = beluga::FixedTupleArray<Particle, 4>{};
+  container.push_back({1, beluga::Weight(0.5)});
+  container.push_back({2, beluga::Weight(1.5)});
+  ASSERT_EQ(container.size(), 2);
+  auto states = container | beluga::views::states | ranges::to<std::vector>;
+  ASSERT_THAT(states, testing::ElementsAre(1, 2));
+  container.clear();
+  ASSERT_TRUE(container.empty());
+}
+
+TEST(FixedTupleArray, OverflowThrows) {
+  auto container = beluga::FixedTupleArray<Particle, 2>{2};
+  ASSERT_THROW(container.push_back({1, beluga::Weight(1.0)}), std::length_error);
+  ASSERT_THROW(container.resize(3), std::length_error);
+  ASSERT_THROW(container.reserve(3), std::length_error);
+}
+
+TEST(FixedTupleArray, ResizeWithinCapacity) {
+  auto container = beluga::FixedTupleArray<Particle, 8>{};
+  container.resize(6);
+  ASSERT_EQ(container.size(), 6);
+  container.resize(2);
+  ASSERT_EQ(container.size(), 2);
+}
+
+TEST(FixedTupleArray, ColumnAccess) {
+  auto container = beluga::FixedTupleArray<Particle, 4>{};
+  container.push_back({3, beluga::Weight(0.25)});
+  ASSERT_EQ(*container.template data<0>(), 3);
+  ASSERT_EQ(*container.template data<1>(), 0.25);
+}
+
+TEST(FixedTupleArray, AllocationFreePipeline) {
+  auto container = beluga::FixedTupleArray<Particle, 4>{};
+  container.push_back({1, beluga::Weight(1.0)});
+  container.push_back({2, beluga::Weight(1.0)});
+  container |= beluga::actions::reweight([](int state) { return static_cast<double>(state); }) |  //
+               beluga::actions::normalize;
+  auto weights = container | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(testing::DoubleEq(1.0 / 3.0), testing::DoubleEq(2.0 / 3.0)));
+}
+
+}  // namespace
@@ -0,0 +1,121 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "beluga/containers/flat_hash_map.hpp"
+
+namespace {
+
+TEST(FlatHashMap, InsertAndFind) {
+  auto map = beluga::FlatHashMap<int, int>{};
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert({42, 1}).second);
+  EXPECT_FALSE(map.insert({42, 2}).second);
+  EXPECT_TRUE(map.insert({43, 3}).second);
+  EXPECT_EQ(map.size(), 2U);
+  ASSERT_NE(map.find(42), map.end());
+  EXPECT_EQ(map.find(42)->second, 1);
+  EXPECT_EQ(map.find(44), map.end());
+}
+
+TEST(FlatHashMap, AtThrowsIfNotFound) {
+  auto map = beluga::FlatHashMap<int, int>{{{1, 10}, {2, 20}}};
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_EQ(map.at(2), 20);
+  EXPECT_THROW([[maybe_unused]] auto value = map.at(3), std::out_of_range);
+}
+
+TEST(FlatHashMap, SubscriptInsertsDefault) {
+  auto map = beluga::FlatHashMap<int, int>{};
+  EXPECT_EQ(map[5], 0);
+  map[5] = 50;
+  EXPECT_EQ(map[5], 50);
+  EXPECT_EQ(map.size(), 1U);
+}
+
+TEST(FlatHashMap, EraseShiftsBackward) {
+  auto map = beluga::FlatHashMap<int, int>{};
+  for (int i = 0; i < 100; ++i) {
+    map.insert({i, i});
+  }
+  for (int i = 0; i < 100; i += 2) {
+    EXPECT_EQ(map.erase(i), 1U);
+  }
+  EXPECT_EQ(map.erase(0), 0U);
+  EXPECT_EQ(map.size(), 50U);
+  for (int i = 1; i < 100; i += 2) {
+    ASSERT_NE(map.find(i), map.end());
+    EXPECT_EQ(map.find(i)->second, i);
+  }
+}
+
+TEST(FlatHashMap, ClearIsReusable) {
+  auto map = beluga::FlatHashMap<int, int>{};
+  for (int i = 0; i < 100; ++i) {
+    map.insert({i, i});
+  }
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(50), map.end());
+  EXPECT_TRUE(map.insert({50, 50}).second);
+  EXPECT_EQ(map.size(), 1U);
+}
+
+TEST(FlatHashMap, IterationVisitsAllEntries) {
+  auto map = beluga::FlatHashMap<int, int>{};
+  for (int i = 0; i < 256; ++i) {
+    map.insert({i, 2 * i});
+  }
+  auto visited = std::unordered_map<int, int>{};
+  for (const auto& [key, value] : map) {
+    visited[key] = value;
+  }
+  EXPECT_EQ(visited.size(), 256U);
+  for (int i = 0; i < 256; ++i) {
+    EXPECT_EQ(visited.at(i), 2 * i);
+  }
+}
+
+TEST(FlatHashMap, SurvivesDegenerateHash) {
+  struct ConstantHash {
+    std::size_t operator()(int) const { return 1U; }
+  };
+  auto map = beluga::FlatHashMap<int, int, ConstantHash>{};
+  for (int i = 0; i < 64; ++i) {
+    EXPECT_TRUE(map.insert({i, i}).second);
+  }
+  for (int i = 0; i < 64; ++i) {
+    ASSERT_NE(map.find(i), map.end());
+    EXPECT_EQ(map.at(i), i);
+  }
+}
+
+TEST(FlatHashMap, ReserveAvoidsRehash) {
+  auto map = beluga::FlatHashMap<int, int>{};
+  map.reserve(1000);
+  for (int i = 0; i < 1000; ++i) {
+    map.insert({i, i});
+  }
+  EXPECT_EQ(map.size(), 1000U);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(map.at(i), i);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,67 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "beluga/containers/spatial_hash_set.hpp"
+
+namespace {
+
+TEST(SpatialHashSet, InsertAndContains) {
+  auto set = beluga::SpatialHashSet{};
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.insert(42));
+  EXPECT_FALSE(set.insert(42));
+  EXPECT_TRUE(set.insert(43));
+  EXPECT_EQ(set.size(), 2U);
+  EXPECT_TRUE(set.contains(42));
+  EXPECT_FALSE(set.contains(44));
+}
+
+TEST(SpatialHashSet, ClearIsReusable) {
+  auto set = beluga::SpatialHashSet{};
+  for (std::size_t i = 0; i < 100; ++i) {
+    set.insert(i);
+  }
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_FALSE(set.contains(50));
+  EXPECT_TRUE(set.insert(50));
+  EXPECT_EQ(set.size(), 1U);
+}
+
+TEST(SpatialHashSet, GrowsPastCapacityHint) {
+  auto set = beluga::SpatialHashSet{4};
+  for (std::size_t i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(set.insert(i * 0x51D7348DULL));
+  }
+  EXPECT_EQ(set.size(), 1000U);
+  for (std::size_t i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(set.contains(i * 0x51D7348DULL));
+  }
+}
+
+TEST(SpatialHashSet, UsesGivenMemoryResource) {
+  auto buffer = std::pmr::monotonic_buffer_resource{};
+  auto set = beluga::SpatialHashSet{128, &buffer};
+  for (std::size_t i = 0; i < 100; ++i) {
+    set.insert(i);
+  }
+  EXPECT_EQ(set.size(), 100U);
+}
+
+}  // namespace
@@ -17,6 +17,7 @@
 
 #include <array>
 #include <cstddef>
+#include <iterator>
 #include <ostream>
 #include <tuple>
 #include <type_traits>
@@ -35,6 +36,7 @@
 
 #include "beluga/containers/tuple_vector.hpp"
 #include "beluga/primitives.hpp"
+#include "beluga/views/elements.hpp"
 #include "beluga/views/particles.hpp"
 
 namespace {
@@ -267,4 +269,198 @@ TEST(TupleVectorTest, AssignFromNonSizedRangeReserved) {
   ASSERT_TRUE(ranges::equal(input, output));
 }
 
+TEST(TupleVectorTest, AssignFromSameContainerType) {
+  auto input = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}, {3, 3.0}};
+  auto output = beluga::TupleVector<std::tuple<int, double>>{};
+  output.reserve(2);
+  output.assign_range(input);
+  ASSERT_TRUE(ranges::equal(input, output));
+}
+
+TEST(TupleVectorTest, AssignFromSameContainerTypeCopiesColdColumns) {
+  auto input = beluga::TupleVector<std::tuple<int, double>, std::tuple<int>>{};
+  input.push_back({1, 1.0});
+  input.push_back({2, 2.0});
+  input.cold_column<0>()[1] = 42;
+  auto output = beluga::TupleVector<std::tuple<int, double>, std::tuple<int>>{};
+  output.resize(1);
+  output.cold_column<0>()[0] = 7;
+  output.assign_range(input);
+  ASSERT_TRUE(ranges::equal(input, output));
+  ASSERT_EQ(output.cold_column<0>().size(), 2);
+  EXPECT_EQ(output.cold_column<0>()[1], 42);
+}
+
+TEST(TupleVectorTest, ColdColumnsTrackSize) {
+  auto container = beluga::TupleVector<std::tuple<int, double>, std::tuple<int>>{};
+  static_assert(std::is_same_v<decltype(container)::value_type, std::tuple<int, double>>);
+  container.push_back({1, 1.0});
+  container.push_back({2, 2.0});
+  auto clusters = container.cold_column<0>();
+  ASSERT_EQ(clusters.size(), 2);
+  EXPECT_EQ(clusters[0], 0);
+  clusters[1] = 42;
+  container.resize(4);
+  ASSERT_EQ(container.cold_column<0>().size(), 4);
+  EXPECT_EQ(container.cold_column<0>()[1], 42);
+  EXPECT_EQ(container.cold_column<0>()[3], 0);
+  container.clear();
+  EXPECT_EQ(container.cold_column<0>().size(), 0);
+}
+
+TEST(TupleVectorTest, ColdColumnsNotVisitedByIteration) {
+  auto container = beluga::TupleVector<std::tuple<int, double>, std::tuple<int>>{};
+  container.push_back({1, 1.0});
+  container.cold_column<0>()[0] = 7;
+  for (auto&& [value, weight] : container) {
+    value = 5;
+    weight = 5.0;
+  }
+  EXPECT_EQ(container.cold_column<0>()[0], 7);
+}
+
+TEST(TupleVectorTest, ColdColumnsFollowAssign) {
+  auto container = beluga::TupleVector<std::tuple<int, double>, std::tuple<int>>{};
+  container.resize(3);
+  container.cold_column<0>()[0] = 7;
+  auto input = std::array{std::make_tuple(1, 1.0), std::make_tuple(2, 2.0)};
+  container.assign_range(input);
+  ASSERT_EQ(container.size(), 2);
+  ASSERT_EQ(container.cold_column<0>().size(), 2);
+  EXPECT_EQ(container.cold_column<0>()[0], 7);
+}
+
+TEST(TupleVectorTest, CapacityRetainedWhenShrinking) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{};
+  container.reserve(100);
+  ASSERT_GE(container.capacity(), 100);
+  container.resize(100);
+  container.resize(10);
+  EXPECT_GE(container.capacity(), 100);
+  container.clear();
+  EXPECT_GE(container.capacity(), 100);
+}
+
+TEST(TupleVectorTest, ShrinkToFit) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{};
+  container.reserve(100);
+  container.resize(10);
+  container.shrink_to_fit();
+  EXPECT_LT(container.capacity(), 100);
+  EXPECT_EQ(container.size(), 10);
+}
+
+TEST(TupleVectorTest, ColumnAccess) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}, {3, 3.0}};
+  auto weights = container.column<1>();
+  ASSERT_EQ(weights.size(), 3);
+  EXPECT_EQ(weights[0], 1.0);
+  EXPECT_EQ(container.data<1>(), weights.data());
+  for (auto& weight : weights) {
+    weight *= 2.0;
+  }
+  EXPECT_EQ(std::get<1>(*container.begin()), 2.0);
+}
+
+TEST(TupleVectorTest, ConstColumnAccess) {
+  const auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}};
+  auto states = container.column<0>();
+  static_assert(std::is_same_v<decltype(states.data()), const int*>);
+  ASSERT_EQ(states.size(), 2);
+  EXPECT_EQ(states[1], 2);
+}
+
+TEST(TupleVectorTest, ParticleViewsUseColumns) {
+  auto container = beluga::TupleVector<std::tuple<int, beluga::Weight>>{{1, 1.0}, {2, 2.0}, {3, 3.0}};
+  auto states = beluga::views::states(container);
+  static_assert(std::is_same_v<decltype(states), decltype(container.column<0>())>);
+  EXPECT_EQ(states.data(), container.data<0>());
+  auto weights = container | beluga::views::weights;
+  static_assert(std::is_same_v<decltype(weights), decltype(container.column<1>())>);
+  EXPECT_EQ(weights.data(), container.data<1>());
+  for (auto& weight : weights) {
+    weight = 2.0 * weight;
+  }
+  EXPECT_EQ(beluga::weight(*container.begin()), 2.0);
+}
+
+TEST(TupleVectorTest, ElementsViewUsesColumns) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}};
+  auto values = container | beluga::views::elements<0>;
+  static_assert(std::is_same_v<decltype(values), decltype(container.column<0>())>);
+  EXPECT_EQ(values.data(), container.data<0>());
+  const auto& const_container = container;
+  auto const_values = beluga::views::elements<1>(const_container);
+  static_assert(std::is_same_v<decltype(const_values.data()), const double*>);
+  EXPECT_EQ(const_values[1], 2.0);
+}
+
+TEST(TupleVectorTest, FillColumnMaterializesOnAccess) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}, {3, 3.0}};
+  container.fill_column<1>(5.0);
+  ASSERT_TRUE(container.pending_fill<1>().has_value());
+  EXPECT_EQ(container.pending_fill<1>().value(), 5.0);
+  EXPECT_EQ(container.size(), 3);  // size queries do not materialize
+  ASSERT_TRUE(container.pending_fill<1>().has_value());
+  auto weights = container.column<1>();
+  EXPECT_FALSE(container.pending_fill<1>().has_value());
+  EXPECT_THAT(weights, testing::ElementsAre(5.0, 5.0, 5.0));
+  auto states = container.column<0>();
+  EXPECT_THAT(states, testing::ElementsAre(1, 2, 3));  // other columns are untouched
+}
+
+TEST(TupleVectorTest, FillColumnVisibleThroughIteration) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}};
+  container.fill_column<1>(1.0);
+  EXPECT_EQ(std::get<1>(*std::next(container.begin())), 1.0);
+  EXPECT_FALSE(container.pending_fill<1>().has_value());
+}
+
+TEST(TupleVectorTest, FillColumnVisibleThroughConstAccess) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}};
+  container.fill_column<1>(3.0);
+  const auto& const_container = container;
+  EXPECT_EQ(const_container.column<1>()[0], 3.0);
+  EXPECT_FALSE(const_container.pending_fill<1>().has_value());
+}
+
+TEST(TupleVectorTest, FillColumnTravelsWithCopies) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}};
+  container.fill_column<1>(7.0);
+  auto copy = container;
+  copy.resize(1);
+  EXPECT_EQ(copy.column<1>()[0], 7.0);
+  EXPECT_TRUE(container.pending_fill<1>().has_value());  // original is still lazy
+  EXPECT_EQ(container.column<1>()[1], 7.0);
+}
+
+TEST(TupleVectorTest, FillColumnDiscardedByAssign) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}};
+  container.fill_column<1>(9.0);
+  const auto values = std::array{std::make_tuple(4, 4.0), std::make_tuple(5, 5.0)};
+  container.assign(values.begin(), values.end());
+  EXPECT_FALSE(container.pending_fill<1>().has_value());
+  EXPECT_THAT(container.column<1>(), testing::ElementsAre(4.0, 5.0));
+}
+
+TEST(TupleVectorTest, FillColumnPrecedesGrowth) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}};
+  container.fill_column<1>(2.0);
+  container.resize(3);  // growth extends with default initialized values
+  EXPECT_THAT(container.column<1>(), testing::ElementsAre(2.0, 2.0, 0.0));
+  container.fill_column<1>(4.0);
+  container.push_back({6, 6.0});
+  EXPECT_THAT(container.column<1>(), testing::ElementsAre(4.0, 4.0, 4.0, 6.0));
+}
+
+TEST(TupleVectorTest, ParticleViewsFallBackToTransform) {
+  // Array-of-structs containers have no columns, so the views stay lazy projections.
+  auto container = beluga::Vector<std::tuple<int, beluga::Weight>>{{1, 1.0}, {2, 2.0}};
+  static_assert(!beluga::views::detail::has_contiguous_columns<decltype(container)>::value);
+  auto states = container | beluga::views::states;
+  EXPECT_EQ(states.back(), 2);
+  auto values = container | beluga::views::elements<1> | ranges::to<std::vector>;
+  EXPECT_EQ(values.back(), 2.0);
+}
+
 }  // namespace
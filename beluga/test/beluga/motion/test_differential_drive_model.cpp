@@ -22,6 +22,7 @@
 #include <sophus/se3.hpp>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <Eigen/Core>
 #include <sophus/common.hpp>
@@ -105,6 +106,23 @@ TEST_F(DifferentialDriveModelTest, RotateTranslateRotate) {
   ASSERT_THAT(result, SE2Near(SO2d{Constants::pi() / 2}, Vector2d{2.0, 2.0}, kTolerance));
 }
 
+TEST_F(DifferentialDriveModelTest, BatchPropagation) {
+  constexpr double kTolerance = 0.001;
+  const auto control_action =
+      std::make_tuple(SE2d{SO2d{-Constants::pi() / 2}, Vector2d{1.0, 2.0}}, SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}});
+  const auto state_sampling_function = motion_model_(control_action);
+  auto states = std::vector{
+      SE2d{SO2d{Constants::pi()}, Vector2d{3.0, 4.0}},
+      SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}},
+  };
+  // With no variance both interfaces are deterministic and must agree.
+  const auto expected_first = state_sampling_function(states[0], generator_);
+  const auto expected_second = state_sampling_function(states[1], generator_);
+  state_sampling_function(states, generator_);
+  ASSERT_THAT(states[0], SE2Near(expected_first, kTolerance));
+  ASSERT_THAT(states[1], SE2Near(expected_second, kTolerance));
+}
+
 template <class Range>
 auto get_statistics(Range&& range) {
   const auto size = static_cast<double>(std::distance(std::begin(range), std::end(range)));
@@ -134,4 +134,48 @@ TEST(Policy, AnyComposition) {
   ASSERT_FALSE(policy(-1.0));
 }
 
+auto expensive_policy(MockPredicate& predicate) {
+  return beluga::make_policy(beluga::with_evaluation_cost<beluga::evaluation_cost::kLinear>(std::ref(predicate)));
+}
+
+TEST(Policy, AndEvaluatesCheapOperandFirst) {
+  MockPredicate expensive;
+  MockPredicate cheap;
+  auto combined = expensive_policy(expensive) && cheap.policy();
+  EXPECT_CALL(cheap, eval()).WillOnce(Return(false));
+  EXPECT_CALL(expensive, eval()).Times(0);
+  ASSERT_FALSE(combined());
+}
+
+TEST(Policy, OrEvaluatesCheapOperandFirst) {
+  MockPredicate expensive;
+  MockPredicate cheap;
+  auto combined = expensive_policy(expensive) || cheap.policy();
+  EXPECT_CALL(cheap, eval()).WillOnce(Return(true));
+  EXPECT_CALL(expensive, eval()).Times(0);
+  ASSERT_TRUE(combined());
+}
+
+TEST(Policy, AndKeepsWrittenOrderForEqualCosts) {
+  MockPredicate condition1;
+  MockPredicate condition2;
+  auto combined = expensive_policy(condition1) && expensive_policy(condition2);
+  EXPECT_CALL(condition1, eval()).WillOnce(Return(false));
+  EXPECT_CALL(condition2, eval()).Times(0);
+  ASSERT_FALSE(combined());
+}
+
+TEST(Policy, CompositionPropagatesEvaluationCost) {
+  MockPredicate expensive;
+  MockPredicate cheap;
+  auto combined = expensive_policy(expensive) && cheap.policy();
+  static_assert(beluga::policy_evaluation_cost_v<decltype(combined)> == beluga::evaluation_cost::kLinear);
+  auto negated = !cheap.policy();
+  static_assert(beluga::policy_evaluation_cost_v<decltype(negated)> == beluga::evaluation_cost::kConstant);
+  EXPECT_CALL(cheap, eval()).WillOnce(Return(true)).WillOnce(Return(true));
+  EXPECT_CALL(expensive, eval()).WillOnce(Return(true));
+  ASSERT_TRUE(combined());
+  ASSERT_FALSE(negated());
+}
+
 }  // namespace
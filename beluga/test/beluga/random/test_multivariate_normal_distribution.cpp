@@ -15,6 +15,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <numeric>
 #include <stdexcept>
 #include <utility>
@@ -98,6 +99,53 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_pair(Eigen::Vector2d{3.0, 4.0}, testing::as<Eigen::Matrix2d>({{1.5, -0.3}, {-0.3, 1.5}})),
         std::make_pair(Eigen::Vector2d{5.0, 6.0}, testing::as<Eigen::Matrix2d>({{2.0, 0.7}, {0.7, 2.0}}))));
 
+TEST(MultivariateNormalDistribution, BatchedSampleCount) {
+  auto generator = std::mt19937{std::random_device()()};
+  auto distribution = beluga::MultivariateNormalDistribution{
+      Eigen::Vector2d{1.0, 2.0}, testing::as<Eigen::Matrix2d>({{1.0, 0.0}, {0.0, 1.0}})};
+  auto samples = std::vector<Eigen::Vector2d>{};
+  const auto out = distribution.sample_n(generator, std::back_inserter(samples), 100);
+  ASSERT_EQ(samples.size(), 100);
+  *out = Eigen::Vector2d::Zero();
+  ASSERT_EQ(samples.size(), 101);
+}
+
+TEST(MultivariateNormalDistribution, BatchedCovarianceAndMean) {
+  constexpr double kTolerance = 0.01;
+  const auto expected_mean = Eigen::Vector2d{3.0, 4.0};
+  const auto expected_covariance = testing::as<Eigen::Matrix2d>({{1.5, -0.3}, {-0.3, 1.5}});
+  auto generator = std::mt19937{std::random_device()()};
+  auto distribution = beluga::MultivariateNormalDistribution{expected_mean, expected_covariance};
+  auto sequence = std::vector<Eigen::Vector2d>{};
+  sequence.reserve(1'000'000);
+  distribution.sample_n(generator, std::back_inserter(sequence), 1'000'000);
+
+  const auto sum = std::accumulate(sequence.begin(), sequence.end(), Eigen::Vector2d{0, 0});
+  const auto mean = Eigen::Vector2d{sum / sequence.size()};
+  ASSERT_NEAR(mean(0), expected_mean(0), kTolerance);
+  ASSERT_NEAR(mean(1), expected_mean(1), kTolerance);
+  const auto covariance = beluga::covariance(sequence, mean);
+  ASSERT_NEAR(covariance(0, 0), expected_covariance(0, 0), kTolerance);
+  ASSERT_NEAR(covariance(0, 1), expected_covariance(0, 1), kTolerance);
+  ASSERT_NEAR(covariance(1, 0), expected_covariance(1, 0), kTolerance);
+  ASSERT_NEAR(covariance(1, 1), expected_covariance(1, 1), kTolerance);
+}
+
+TEST(MultivariateNormalDistribution, BatchedSE2Element) {
+  constexpr double kTolerance = 0.001;
+  auto generator = std::mt19937{std::random_device()()};
+  auto expected_mean = Sophus::SE2d{Sophus::SO2d{1.57}, Eigen::Vector2d{1.0, 2.0}};
+  auto distribution = beluga::MultivariateNormalDistribution{expected_mean, Eigen::Matrix3d::Zero()};
+  auto samples = std::vector<Sophus::SE2d>{};
+  distribution.sample_n(generator, std::back_inserter(samples), 10);
+  ASSERT_EQ(samples.size(), 10);
+  for (const auto& sample : samples) {
+    ASSERT_NEAR(sample.so2().log(), expected_mean.so2().log(), kTolerance);
+    ASSERT_NEAR(sample.translation()(0), expected_mean.translation()(0), kTolerance);
+    ASSERT_NEAR(sample.translation()(1), expected_mean.translation()(1), kTolerance);
+  }
+}
+
 TEST(MultivariateNormalDistribution, RowVector) {
   constexpr double kTolerance = 0.001;
   auto generator = std::mt19937{std::random_device()()};
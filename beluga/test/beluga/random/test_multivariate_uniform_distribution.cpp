@@ -81,6 +81,24 @@ TEST(MultivariateUniformDistribution, GridSingleFreeSlot) {
   ASSERT_THAT(pose.translation(), Vector2Near({2.5, 2.5}, kTolerance));
 }
 
+TEST(MultivariateUniformDistribution, GridCopiesSampleFromSharedFreeStates) {
+  constexpr double kTolerance = 0.001;
+  constexpr double kResolution = 1.0;
+  const auto grid = beluga::testing::StaticOccupancyGrid<5, 5>{
+      {true, true, true,  true, true,  //
+       true, true, true,  true, true,  //
+       true, true, false, true, true,  //
+       true, true, true,  true, true,  //
+       true, true, true,  true, true},
+      kResolution,
+  };
+  auto distribution = beluga::MultivariateUniformDistribution{grid};
+  auto copy = distribution;
+  auto engine = std::mt19937{std::random_device()()};
+  ASSERT_THAT(distribution(engine).translation(), Vector2Near({2.5, 2.5}, kTolerance));
+  ASSERT_THAT(copy(engine).translation(), Vector2Near({2.5, 2.5}, kTolerance));
+}
+
 TEST(MultivariateUniformDistribution, GridSomeFreeSlots) {
   constexpr std::size_t kSize = 100'000;
   constexpr double kResolution = 1.0;
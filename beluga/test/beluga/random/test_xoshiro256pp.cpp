@@ -0,0 +1,71 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "beluga/random/xoshiro256pp.hpp"
+
+namespace {
+
+TEST(Xoshiro256PlusPlus, DeterministicForEqualSeeds) {
+  auto first = beluga::Xoshiro256PlusPlus{42};
+  auto second = beluga::Xoshiro256PlusPlus{42};
+  ASSERT_EQ(first, second);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(first(), second());
+  }
+}
+
+TEST(Xoshiro256PlusPlus, DifferentSeedsDiffer) {
+  auto first = beluga::Xoshiro256PlusPlus{42};
+  auto second = beluga::Xoshiro256PlusPlus{43};
+  EXPECT_NE(first(), second());
+}
+
+TEST(Xoshiro256PlusPlus, JumpChangesState) {
+  auto engine = beluga::Xoshiro256PlusPlus{42};
+  auto jumped = engine;
+  jumped.jump();
+  EXPECT_NE(engine, jumped);
+  jumped.long_jump();
+  EXPECT_NE(engine, jumped);
+}
+
+TEST(Xoshiro256PlusPlus, StreamsAreDeterministicAndDistinct) {
+  const auto base = beluga::Xoshiro256PlusPlus{42};
+  auto first = base.stream(1);
+  auto second = base.stream(2);
+  EXPECT_EQ(base.stream(1), first);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(base.stream(0), base);
+}
+
+TEST(Xoshiro256PlusPlus, DrivesStandardDistributions) {
+  auto engine = beluga::Xoshiro256PlusPlus{42};
+  auto distribution = std::uniform_real_distribution<double>{0.0, 1.0};
+  double sum = 0.0;
+  constexpr int kSamples = 10'000;
+  for (int i = 0; i < kSamples; ++i) {
+    const double value = distribution(engine);
+    ASSERT_GE(value, 0.0);
+    ASSERT_LT(value, 1.0);
+    sum += value;
+  }
+  EXPECT_NEAR(sum / kSamples, 0.5, 0.02);
+}
+
+}  // namespace
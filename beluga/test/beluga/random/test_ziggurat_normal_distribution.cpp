@@ -0,0 +1,100 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "beluga/random/xoshiro256pp.hpp"
+#include "beluga/random/ziggurat_normal_distribution.hpp"
+
+namespace {
+
+TEST(ZigguratNormalDistribution, CopyAndCompare) {
+  auto distribution = beluga::ZigguratNormalDistribution<double>{1.0, 2.0};
+  auto other_distribution = distribution;
+  ASSERT_EQ(distribution, other_distribution);
+  auto generator = std::mt19937{std::random_device()()};
+  auto other_generator = generator;
+  // Testing twice to assert that they generate the same sequence.
+  ASSERT_EQ(distribution(generator), other_distribution(other_generator));
+  ASSERT_EQ(distribution(generator), other_distribution(other_generator));
+}
+
+TEST(ZigguratNormalDistribution, ParamAccessors) {
+  const auto params = beluga::ZigguratNormalDistribution<double>::param_type{3.0, 0.5};
+  ASSERT_EQ(params.mean(), 3.0);
+  ASSERT_EQ(params.stddev(), 0.5);
+  auto distribution = beluga::ZigguratNormalDistribution<double>{params};
+  ASSERT_EQ(distribution.param(), params);
+  distribution.param(beluga::ZigguratNormalDistribution<double>::param_type{});
+  ASSERT_EQ(distribution.mean(), 0.0);
+  ASSERT_EQ(distribution.stddev(), 1.0);
+}
+
+TEST(ZigguratNormalDistribution, StandardMoments) {
+  constexpr int kSampleCount = 1'000'000;
+  constexpr double kTolerance = 0.01;
+  auto generator = std::mt19937{42};
+  auto distribution = beluga::ZigguratNormalDistribution<double>{};
+  double sum = 0.0;
+  double squared_sum = 0.0;
+  double cubed_sum = 0.0;
+  for (int i = 0; i < kSampleCount; ++i) {
+    const double value = distribution(generator);
+    sum += value;
+    squared_sum += value * value;
+    cubed_sum += value * value * value;
+  }
+  const double mean = sum / kSampleCount;
+  ASSERT_NEAR(mean, 0.0, kTolerance);
+  ASSERT_NEAR(squared_sum / kSampleCount - mean * mean, 1.0, kTolerance);
+  ASSERT_NEAR(cubed_sum / kSampleCount, 0.0, 3 * kTolerance);
+}
+
+TEST(ZigguratNormalDistribution, TailProbability) {
+  constexpr int kSampleCount = 1'000'000;
+  auto generator = std::mt19937{42};
+  auto distribution = beluga::ZigguratNormalDistribution<double>{};
+  int count = 0;
+  for (int i = 0; i < kSampleCount; ++i) {
+    if (std::abs(distribution(generator)) > 3.0) {
+      ++count;
+    }
+  }
+  // P(|X| > 3) for a standard normal is approximately 0.0027, and the tail
+  // beyond the last ziggurat layer (|x| > 3.44) exercises the rejection sampler.
+  ASSERT_NEAR(static_cast<double>(count) / kSampleCount, 0.0027, 0.0005);
+}
+
+TEST(ZigguratNormalDistribution, MeanAndStddevFromParams) {
+  constexpr int kSampleCount = 1'000'000;
+  constexpr double kTolerance = 0.01;
+  auto generator = beluga::Xoshiro256PlusPlus{42};  // exercises the full 64-bit generator path
+  auto distribution = beluga::ZigguratNormalDistribution<double>{};
+  const auto params = beluga::ZigguratNormalDistribution<double>::param_type{5.0, 2.0};
+  double sum = 0.0;
+  double squared_sum = 0.0;
+  for (int i = 0; i < kSampleCount; ++i) {
+    const double value = distribution(generator, params);
+    sum += value;
+    squared_sum += value * value;
+  }
+  const double mean = sum / kSampleCount;
+  ASSERT_NEAR(mean, 5.0, 10 * kTolerance);
+  ASSERT_NEAR(std::sqrt(squared_sum / kSampleCount - mean * mean), 2.0, 10 * kTolerance);
+}
+
+}  // namespace
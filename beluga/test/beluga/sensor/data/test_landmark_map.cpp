@@ -15,7 +15,9 @@
 #include <gtest/gtest.h>
 
 // standard library
+#include <algorithm>
 #include <optional>
+#include <vector>
 
 // external
 #include <sophus/se3.hpp>
@@ -76,6 +78,51 @@ TEST_F(LandmarkMapCartesianTest, ImplicitMapLimits) {
   ASSERT_DOUBLE_EQ(uut.map_limits().max().z(), +7.0);
 }
 
+TEST_F(LandmarkMapCartesianTest, SingleLandmarkMap) {
+  const auto landmark = beluga::LandmarkPosition3{+5.0, +5.0, +5.0};
+  auto uut = beluga::LandmarkMap({{landmark, 0}});
+  const auto nearest = uut.find_nearest_landmark({-100.0, +40.0, +7.0}, 0);
+  ASSERT_TRUE(nearest.has_value());
+  EXPECT_NEAR(0.0, (landmark - *nearest).norm(), 1e-6);
+}
+
+TEST_F(LandmarkMapCartesianTest, FarOffMapQuery) {
+  const auto landmark_0 = beluga::LandmarkPosition3{+1.0, +2.0, +3.0};
+  const auto landmark_1 = beluga::LandmarkPosition3{+9.0, +10.0, +11.0};
+
+  auto uut = beluga::LandmarkMap(default_map_boundaries, {{landmark_0, 0}, {landmark_1, 0}});
+
+  const auto nearest = uut.find_nearest_landmark({+1000.0, +1000.0, +1000.0}, 0);
+  ASSERT_TRUE(nearest.has_value());
+  EXPECT_NEAR(0.0, (landmark_1 - *nearest).norm(), 1e-6);
+}
+
+TEST_F(LandmarkMapCartesianTest, DenseMapMatchesLinearScan) {
+  auto landmarks = beluga::LandmarkMap::landmarks_set_position_data{};
+  for (int x = 0; x < 5; ++x) {
+    for (int y = 0; y < 5; ++y) {
+      for (int z = 0; z < 5; ++z) {
+        landmarks.push_back({{static_cast<double>(x), static_cast<double>(y), static_cast<double>(z)}, 0});
+      }
+    }
+  }
+
+  auto uut = beluga::LandmarkMap(landmarks);
+
+  const auto queries = std::vector<beluga::LandmarkPosition3>{
+      {+0.4, +0.4, +0.4}, {+2.6, +1.2, +3.9}, {-1.0, -1.0, -1.0}, {+7.0, +2.0, +0.1}};
+
+  for (const auto& query : queries) {
+    const auto expected = std::min_element(
+        landmarks.begin(), landmarks.end(), [&query](const auto& lhs, const auto& rhs) {
+          return (lhs.detection_position_in_robot - query).norm() < (rhs.detection_position_in_robot - query).norm();
+        });
+    const auto nearest = uut.find_nearest_landmark(query, 0);
+    ASSERT_TRUE(nearest.has_value());
+    EXPECT_NEAR(0.0, (expected->detection_position_in_robot - *nearest).norm(), 1e-6);
+  }
+}
+
 TEST_F(LandmarkMapCartesianTest, EmptyMap) {
   auto uut = beluga::LandmarkMap(default_map_boundaries, beluga::LandmarkMap::landmarks_set_position_data{});
   const auto nearest = uut.find_nearest_landmark({1.0, 2.0, 3.0}, 0);
@@ -135,6 +182,24 @@ TEST_F(LandmarkMapBearingTest, FeatureInTotallyDifferentDirection) {
   EXPECT_NEAR(0.0, (*nearest - expected_bearing).norm(), 1e-6);
 }
 
+TEST_F(LandmarkMapBearingTest, BatchedQueryMatchesOneShotQueries) {
+  const auto bearing_query = uut.make_bearing_query(sensor_pose_in_world);
+  const auto detection_bearing = beluga::LandmarkBearing3{1.0, 0.0, 0.0};
+  for (const auto category : {beluga::LandmarkCategory{0}, beluga::LandmarkCategory{1}, beluga::LandmarkCategory{2}}) {
+    const auto batched = bearing_query.find_closest_bearing_landmark(detection_bearing, category);
+    const auto one_shot = uut.find_closest_bearing_landmark(detection_bearing, category, sensor_pose_in_world);
+    ASSERT_TRUE(batched.has_value());
+    ASSERT_TRUE(one_shot.has_value());
+    EXPECT_NEAR(0.0, (*batched - *one_shot).norm(), 1e-6);
+  }
+}
+
+TEST_F(LandmarkMapBearingTest, BatchedQueryNoSuchFeature) {
+  const auto bearing_query = uut.make_bearing_query(sensor_pose_in_world);
+  const auto nearest = bearing_query.find_closest_bearing_landmark(beluga::LandmarkBearing3{1.0, 0.0, 0.0}, 99);
+  ASSERT_FALSE(nearest.has_value());
+}
+
 TEST_F(LandmarkMapBearingTest, NoSuchFeature) {
   const auto nearest =
       uut.find_closest_bearing_landmark(beluga::LandmarkBearing3{1.0, 0.0, 0.0}, 99, sensor_pose_in_world);
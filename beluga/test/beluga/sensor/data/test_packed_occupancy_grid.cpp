@@ -0,0 +1,124 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include <sophus/common.hpp>
+#include <sophus/se2.hpp>
+
+#include "beluga/sensor/data/packed_occupancy_grid.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+using beluga::testing::StaticOccupancyGrid;
+
+TEST(PackedOccupancyGrid2, FreeAtCell) {
+  constexpr double kResolution = 1.;
+
+  const auto grid = StaticOccupancyGrid<5, 5>{
+      {false, false, false, false, true,  false, false, false, true,  false, false, false, true,
+       false, false, false, true,  false, false, false, true,  false, false, false, false},
+      kResolution};
+  const auto packed_grid = beluga::PackedOccupancyGrid2{grid};
+
+  EXPECT_TRUE(packed_grid.free_at(0));
+  EXPECT_FALSE(packed_grid.free_at(8));
+  EXPECT_FALSE(packed_grid.free_at(2, 2));
+  EXPECT_TRUE(packed_grid.free_at(3, 2));
+  EXPECT_FALSE(packed_grid.free_at(Eigen::Vector2i(0, 4)));
+  EXPECT_TRUE(packed_grid.free_at(Eigen::Vector2i(1, 4)));
+  EXPECT_FALSE(packed_grid.free_at(packed_grid.size()));
+}
+
+TEST(PackedOccupancyGrid2, PreservesSourceGridGeometry) {
+  constexpr double kResolution = 0.5;
+  const auto origin = Sophus::SE2d{Sophus::SO2d{Sophus::Constants<double>::pi() / 2.}, Eigen::Vector2d{1., 1.}};
+  const auto grid = StaticOccupancyGrid<5, 5>{
+      {false, false, false, false, true,  false, false, false, true,  false, false, false, true,
+       false, false, false, true,  false, false, false, true,  false, false, false, false},
+      kResolution,
+      origin};
+  const auto packed_grid = beluga::PackedOccupancyGrid2{grid};
+
+  EXPECT_EQ(packed_grid.size(), grid.size());
+  EXPECT_EQ(packed_grid.width(), grid.width());
+  EXPECT_EQ(packed_grid.height(), grid.height());
+  EXPECT_EQ(packed_grid.resolution(), grid.resolution());
+  EXPECT_EQ(packed_grid.origin().matrix(), grid.origin().matrix());
+  constexpr auto kFrame = beluga::PackedOccupancyGrid2::Frame::kGlobal;
+  EXPECT_TRUE(packed_grid.coordinates_at(packed_grid.index_at(2, 2), kFrame)
+                  .isApprox(grid.coordinates_at(grid.index_at(2, 2), StaticOccupancyGrid<5, 5>::Frame::kGlobal)));
+}
+
+TEST(PackedOccupancyGrid2, MatchesSourceGridAcrossWordBoundaries) {
+  auto array = std::array<bool, 12 * 12>{};
+  for (std::size_t index = 0; index < array.size(); ++index) {
+    array[index] = index % 3 == 0;
+  }
+  const auto grid = StaticOccupancyGrid<12, 12>{array};
+  const auto packed_grid = beluga::PackedOccupancyGrid2{grid};
+
+  for (std::size_t index = 0; index < grid.size(); ++index) {
+    ASSERT_EQ(packed_grid.free_at(index), grid.free_at(index)) << "index: " << index;
+  }
+}
+
+TEST(PackedOccupancyGrid2, AllFreeCells) {
+  const auto grid = StaticOccupancyGrid<2, 5>{{false, false, false, false, true, false, false, false, true, false}};
+  const auto packed_grid = beluga::PackedOccupancyGrid2{grid};
+
+  const auto expected_free_cells = std::vector<std::size_t>{0, 1, 2, 3, 5, 6, 7, 9};
+  ASSERT_THAT(
+      packed_grid.free_cells() | ranges::to<std::vector>, testing::Pointwise(testing::Eq(), expected_free_cells));
+}
+
+TEST(PackedOccupancyGrid2, FreeBlockLog2Size) {
+  {
+    const auto grid = StaticOccupancyGrid<8, 8>{std::array<bool, 8 * 8>{}};  // All cells free.
+    const auto packed_grid = beluga::PackedOccupancyGrid2{grid};
+    EXPECT_EQ(packed_grid.free_block_log2_size_at(0, 0), 3);
+    EXPECT_EQ(packed_grid.free_block_log2_size_at(7, 7), 3);
+  }
+
+  {
+    auto array = std::array<bool, 8 * 8>{};
+    array[0] = true;  // Obstacle at (0, 0).
+    const auto grid = StaticOccupancyGrid<8, 8>{array};
+    const auto packed_grid = beluga::PackedOccupancyGrid2{grid};
+    EXPECT_EQ(packed_grid.free_block_log2_size_at(0, 0), 0);
+    EXPECT_EQ(packed_grid.free_block_log2_size_at(1, 1), 0);
+    EXPECT_EQ(packed_grid.free_block_log2_size_at(2, 2), 1);
+    EXPECT_EQ(packed_grid.free_block_log2_size_at(5, 1), 2);
+    EXPECT_EQ(packed_grid.free_block_log2_size_at(7, 7), 2);
+  }
+}
+
+TEST(PackedOccupancyGrid2, DataAtCell) {
+  const auto grid = StaticOccupancyGrid<2, 5>{{false, false, false, false, true, false, false, false, true, false}};
+  const auto packed_grid = beluga::PackedOccupancyGrid2{grid};
+
+  EXPECT_EQ(packed_grid.data_at(0), std::make_optional(true));
+  EXPECT_EQ(packed_grid.data_at(4), std::make_optional(false));
+  EXPECT_EQ(packed_grid.data_at(packed_grid.size()), std::nullopt);
+}
+
+}  // namespace
@@ -0,0 +1,94 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "beluga/sensor/data/sparse_tiled_value_grid.hpp"
+#include "beluga/sensor/data/value_grid.hpp"
+
+namespace {
+
+constexpr float kBackground = 0.1F;
+
+std::vector<float> make_sparse_data(std::size_t width, std::size_t height) {
+  auto data = std::vector<float>(width * height, kBackground);
+  data[5 * width + 12] = 0.9F;
+  data[5 * width + 13] = 0.8F;
+  data[17 * width + 2] = 0.7F;
+  return data;
+}
+
+TEST(SparseTiledValueGrid2, Dimensions) {
+  const auto grid = beluga::SparseTiledValueGrid2<float>{make_sparse_data(30, 20), 30, 0.5, kBackground};
+  EXPECT_EQ(grid.width(), 30);
+  EXPECT_EQ(grid.height(), 20);
+  EXPECT_EQ(grid.resolution(), 0.5);
+  EXPECT_EQ(grid.size(), 30 * 20);
+  EXPECT_EQ(grid.background(), kBackground);
+}
+
+TEST(SparseTiledValueGrid2, AllocatesOnlyFeatureTiles) {
+  const auto grid = beluga::SparseTiledValueGrid2<float>{make_sparse_data(30, 20), 30, 0.5, kBackground};
+  // 30x20 cells span 4x3 tiles of 8x8; only the two tiles holding features materialize.
+  EXPECT_EQ(grid.tile_count(), 4 * 3);
+  EXPECT_EQ(grid.allocated_tiles(), 2);
+  EXPECT_EQ(grid.pages().size(), 2 * 8 * 8);
+}
+
+TEST(SparseTiledValueGrid2, MatchesRowMajorGrid) {
+  const auto data = make_sparse_data(30, 20);
+  const auto sparse = beluga::SparseTiledValueGrid2<float>{data, 30, 0.5, kBackground};
+  const auto row_major = beluga::ValueGrid2<float>{data, 30, 0.5};
+  for (int yi = 0; yi < 20; ++yi) {
+    for (int xi = 0; xi < 30; ++xi) {
+      ASSERT_EQ(sparse.data_at(xi, yi), row_major.data_at(xi, yi));
+      ASSERT_EQ(sparse.value_at(xi, yi), *row_major.data_at(xi, yi));
+    }
+  }
+  ASSERT_EQ(sparse.data_at(30, 0), std::nullopt);
+  ASSERT_EQ(sparse.data_at(0, 20), std::nullopt);
+  ASSERT_EQ(sparse.data_near(6.25, 2.75), row_major.data_near(6.25, 2.75));
+  ASSERT_EQ(sparse.data_near(-0.25, 0.25), std::nullopt);
+}
+
+TEST(SparseTiledValueGrid2, UniformGridAllocatesNothing) {
+  const auto grid = beluga::SparseTiledValueGrid2<float>{std::vector<float>(64 * 64, 2.0F), 64, 1.0, 2.0F};
+  EXPECT_EQ(grid.allocated_tiles(), 0);
+  EXPECT_EQ(grid.pages().size(), 0);
+  EXPECT_EQ(grid.value_at(63, 63), 2.0F);
+  EXPECT_EQ(grid.data_at(0, 0), 2.0F);
+}
+
+TEST(SparseTiledValueGrid2, PrefetchIsSafeEverywhere) {
+  const auto grid = beluga::SparseTiledValueGrid2<float>{make_sparse_data(30, 20), 30, 0.5, kBackground};
+  for (int yi = 0; yi < 20; ++yi) {
+    for (int xi = 0; xi < 30; ++xi) {
+      grid.prefetch_at(xi, yi);  // advisory only, must not crash on unallocated tiles
+    }
+  }
+  SUCCEED();
+}
+
+TEST(SparseTiledValueGrid2, Empty) {
+  const auto grid = beluga::SparseTiledValueGrid2<float>{std::vector<float>{}, 1};
+  EXPECT_EQ(grid.size(), 0);
+  EXPECT_EQ(grid.allocated_tiles(), 0);
+  EXPECT_EQ(grid.data_at(0, 0), std::nullopt);
+}
+
+}  // namespace
@@ -21,6 +21,7 @@
 
 #include <Eigen/Core>
 
+#include "beluga/containers/flat_hash_map.hpp"
 #include "beluga/sensor/data/sparse_value_grid.hpp"
 
 namespace beluga {
@@ -38,8 +39,10 @@ struct Hasher {
   std::size_t operator()(const Eigen::Vector2i&) const { return 1; }
 };
 
-using SparseGridTestCases =
-    testing::Types<std::unordered_map<Eigen::Vector2i, int, Hasher>, std::map<Eigen::Vector2i, int, Less>>;
+using SparseGridTestCases = testing::Types<
+    std::unordered_map<Eigen::Vector2i, int, Hasher>,
+    std::map<Eigen::Vector2i, int, Less>,
+    beluga::FlatHashMap<Eigen::Vector2i, int, Hasher>>;
 
 TYPED_TEST_SUITE(SparseGridTests, SparseGridTestCases, );
 
@@ -0,0 +1,101 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "beluga/sensor/data/static_value_grid.hpp"
+#include "beluga/sensor/data/value_grid.hpp"
+
+namespace {
+
+std::vector<float> make_row_major_data(std::size_t width, std::size_t height) {
+  auto data = std::vector<float>(width * height);
+  for (std::size_t index = 0U; index < data.size(); ++index) {
+    data[index] = static_cast<float>(index);
+  }
+  return data;
+}
+
+TEST(StaticValueGrid2, Dimensions) {
+  const auto grid = beluga::StaticValueGrid2<float, 16, 5>{make_row_major_data(16, 5), 0.5};
+  EXPECT_EQ(grid.width(), 16);
+  EXPECT_EQ(grid.height(), 5);
+  EXPECT_EQ(grid.size(), 80);
+  EXPECT_EQ(grid.resolution(), 0.5);
+  // Extents are compile-time constants.
+  static_assert(decltype(grid)::width() == 16);
+  static_assert(decltype(grid)::height() == 5);
+  static_assert(decltype(grid)::size() == 80);
+}
+
+TEST(StaticValueGrid2, ShiftOrIndexing) {
+  using GridType = beluga::StaticValueGrid2<float, 16, 8>;
+  static_assert(GridType::kHasPowerOfTwoWidth);
+  const auto grid = GridType{make_row_major_data(16, 8)};
+  for (int yi = 0; yi < 8; ++yi) {
+    for (int xi = 0; xi < 16; ++xi) {
+      ASSERT_EQ(grid.index_at(xi, yi), static_cast<std::size_t>(yi) * 16 + static_cast<std::size_t>(xi));
+    }
+  }
+}
+
+TEST(StaticValueGrid2, MatchesRuntimeExtentGrid) {
+  const auto data = make_row_major_data(13, 17);
+  const auto static_grid = beluga::StaticValueGrid2<float, 13, 17>{data, 0.5};
+  static_assert(!decltype(static_grid)::kHasPowerOfTwoWidth);
+  const auto runtime_grid = beluga::ValueGrid2<float>{data, 13, 0.5};
+  for (int yi = 0; yi < 17; ++yi) {
+    for (int xi = 0; xi < 13; ++xi) {
+      ASSERT_EQ(static_grid.index_at(xi, yi), runtime_grid.index_at(xi, yi));
+      ASSERT_EQ(static_grid.data_at(xi, yi), runtime_grid.data_at(xi, yi));
+    }
+  }
+  ASSERT_EQ(static_grid.data_at(13, 0), std::nullopt);
+  ASSERT_EQ(static_grid.data_at(0, 17), std::nullopt);
+  ASSERT_EQ(static_grid.data_near(0.25, 8.25), runtime_grid.data_near(0.25, 8.25));
+  ASSERT_EQ(static_grid.data_near(-0.25, 0.25), std::nullopt);
+}
+
+TEST(StaticValueGrid2, IndexRoundTrip) {
+  const auto grid = beluga::StaticValueGrid2<float, 16, 8>{make_row_major_data(16, 8)};
+  for (int yi = 0; yi < 8; ++yi) {
+    for (int xi = 0; xi < 16; ++xi) {
+      const auto index = grid.index_at(Eigen::Vector2i{xi, yi});
+      ASSERT_LT(index, grid.size());
+      ASSERT_EQ(grid.coordinates_at(index), (Eigen::Vector2d{xi + 0.5, yi + 0.5}));
+    }
+  }
+}
+
+TEST(StaticValueGrid2, Neighborhood4) {
+  const auto grid = beluga::StaticValueGrid2<float, 16, 8>{make_row_major_data(16, 8)};
+  {
+    const auto neighbors = grid.neighborhood4(grid.index_at(4, 3));
+    ASSERT_EQ(neighbors.size(), 4);
+  }
+  {
+    const auto neighbors = grid.neighborhood4(grid.index_at(0, 0));
+    ASSERT_EQ(neighbors.size(), 2);
+  }
+  {
+    const auto neighbors = grid.neighborhood4(grid.index_at(15, 7));
+    ASSERT_EQ(neighbors.size(), 2);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,87 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "beluga/sensor/data/tiled_value_grid.hpp"
+#include "beluga/sensor/data/value_grid.hpp"
+
+namespace {
+
+std::vector<float> make_row_major_data(std::size_t width, std::size_t height) {
+  auto data = std::vector<float>(width * height);
+  for (std::size_t index = 0U; index < data.size(); ++index) {
+    data[index] = static_cast<float>(index);
+  }
+  return data;
+}
+
+TEST(TiledValueGrid2, Dimensions) {
+  const auto grid = beluga::TiledValueGrid2<float>{make_row_major_data(13, 5), 13, 0.5};
+  EXPECT_EQ(grid.width(), 13);
+  EXPECT_EQ(grid.height(), 5);
+  EXPECT_EQ(grid.resolution(), 0.5);
+  // Storage is padded up to whole 8x8 tiles.
+  EXPECT_EQ(grid.size(), 2 * 8 * 8);
+}
+
+TEST(TiledValueGrid2, MatchesRowMajorGrid) {
+  const auto data = make_row_major_data(13, 17);
+  const auto tiled = beluga::TiledValueGrid2<float>{data, 13, 0.5};
+  const auto row_major = beluga::ValueGrid2<float>{data, 13, 0.5};
+  for (int yi = 0; yi < 17; ++yi) {
+    for (int xi = 0; xi < 13; ++xi) {
+      ASSERT_EQ(tiled.data_at(xi, yi), row_major.data_at(xi, yi));
+    }
+  }
+  ASSERT_EQ(tiled.data_at(13, 0), std::nullopt);
+  ASSERT_EQ(tiled.data_at(0, 17), std::nullopt);
+  ASSERT_EQ(tiled.data_near(0.25, 8.25), row_major.data_near(0.25, 8.25));
+  ASSERT_EQ(tiled.data_near(-0.25, 0.25), std::nullopt);
+}
+
+TEST(TiledValueGrid2, IndexRoundTrip) {
+  const auto grid = beluga::TiledValueGrid2<float>{make_row_major_data(13, 17), 13};
+  for (int yi = 0; yi < 17; ++yi) {
+    for (int xi = 0; xi < 13; ++xi) {
+      const auto index = grid.index_at(xi, yi);
+      ASSERT_LT(index, grid.size());
+      ASSERT_EQ(grid.coordinates_at(index), (Eigen::Vector2d{xi + 0.5, yi + 0.5}));
+    }
+  }
+}
+
+TEST(TiledValueGrid2, Neighborhood4) {
+  const auto grid = beluga::TiledValueGrid2<float>{make_row_major_data(13, 17), 13};
+  const auto neighbors = grid.neighborhood4(grid.index_at(7, 7));  // on a tile boundary
+  ASSERT_EQ(neighbors.size(), 4);
+  EXPECT_EQ(neighbors[0], grid.index_at(8, 7));
+  EXPECT_EQ(neighbors[1], grid.index_at(7, 8));
+  EXPECT_EQ(neighbors[2], grid.index_at(6, 7));
+  EXPECT_EQ(neighbors[3], grid.index_at(7, 6));
+}
+
+TEST(TiledValueGrid2, Empty) {
+  const auto grid = beluga::TiledValueGrid2<float>{std::vector<float>{}, 1};
+  EXPECT_EQ(grid.width(), 1);
+  EXPECT_EQ(grid.height(), 0);
+  EXPECT_EQ(grid.size(), 0);
+  EXPECT_EQ(grid.data_near(0.5, 0.5), std::nullopt);
+}
+
+}  // namespace
@@ -81,6 +81,149 @@ TEST(BeamSensorModel, ImportanceWeight) {
   }
 }
 
+TEST(BeamSensorModel, MaxRangeBeamCountAddsScanConstantTerm) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = GetParams();
+  auto sensor_model = UUT{params, grid};
+
+  // Each max-range miss adds the cubed max-range density to every particle weight,
+  // independently of the hit points and the particle state.
+  auto without_misses = sensor_model(std::vector<std::pair<double, double>>{{1., 1.}});
+  auto with_misses = sensor_model(std::vector<std::pair<double, double>>{{1., 1.}}, 3);
+  const double expected_constant = 3. * params.z_max * params.z_max * params.z_max;
+  EXPECT_NEAR(without_misses(grid.origin()) + expected_constant, with_misses(grid.origin()), 1e-12);
+}
+
+TEST(BeamSensorModel, RaycastCacheMatchesUncached) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = GetParams();
+  auto cached_params = params;
+  cached_params.use_raycast_cache = true;
+  auto sensor_model = UUT{params, grid};
+  auto cached_sensor_model = UUT{cached_params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1., 1.}, {0.75, 0.75}, {1., 0.5}};
+  auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{measurement});
+  auto cached_state_weighting_function = cached_sensor_model(std::vector<std::pair<double, double>>{measurement});
+
+  const auto pose = Sophus::SE2d{0.05, Eigen::Vector2d{0.1, 0.2}};
+  // First evaluation fills the cache, second one is answered from it.
+  EXPECT_NEAR(state_weighting_function(pose), cached_state_weighting_function(pose), 1e-6);
+  EXPECT_NEAR(state_weighting_function(pose), cached_state_weighting_function(pose), 1e-6);
+}
+
+TEST(BeamSensorModel, VectorizedMixtureMatchesScalar) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = GetParams();
+  auto vectorized_params = params;
+  vectorized_params.use_vectorized_mixture_evaluation = true;
+  auto sensor_model = UUT{params, grid};
+  auto vectorized_sensor_model = UUT{vectorized_params, grid};
+
+  // Mix of a perfect hit, a short return, a long return and a max range return.
+  const auto measurement = std::vector<std::pair<double, double>>{
+      {1., 1.}, {0.75, 0.75}, {2.25, 2.25}, {params.beam_max_range, params.beam_max_range}};
+  auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{measurement});
+  auto vectorized_state_weighting_function =
+      vectorized_sensor_model(std::vector<std::pair<double, double>>{measurement});
+
+  for (const auto& pose : {grid.origin(), Sophus::SE2d{0.05, Eigen::Vector2d{0.1, 0.2}}}) {
+    EXPECT_NEAR(state_weighting_function(pose), vectorized_state_weighting_function(pose), 1e-12);
+  }
+}
+
+TEST(BeamSensorModel, MixtureLookupTableApproximatesScalar) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = GetParams();
+  auto tabulated_params = params;
+  tabulated_params.use_mixture_lookup_table = true;
+  auto sensor_model = UUT{params, grid};
+  auto tabulated_sensor_model = UUT{tabulated_params, grid};
+
+  // Mix of a perfect hit, a short return, a long return and a max range return.
+  const auto measurement = std::vector<std::pair<double, double>>{
+      {1., 1.}, {0.75, 0.75}, {2.25, 2.25}, {params.beam_max_range, params.beam_max_range}};
+  auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{measurement});
+  auto tabulated_state_weighting_function =
+      tabulated_sensor_model(std::vector<std::pair<double, double>>{measurement});
+
+  // The table samples the mixture at bin centers, so agreement is only up to the
+  // quantization error of the range discretization.
+  EXPECT_NEAR(tabulated_state_weighting_function(grid.origin()) / state_weighting_function(grid.origin()), 1.0, 0.3);
+
+  // Both evaluations must still rank a well-aligned pose above a misplaced one.
+  const auto misplaced = Sophus::SE2d{0.3, Eigen::Vector2d{0.75, 0.6}};
+  EXPECT_GT(state_weighting_function(grid.origin()), state_weighting_function(misplaced));
+  EXPECT_GT(tabulated_state_weighting_function(grid.origin()), tabulated_state_weighting_function(misplaced));
+}
+
+TEST(BeamSensorModel, MixtureLookupTableTakesPrecedence) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = GetParams();
+  params.use_mixture_lookup_table = true;
+  auto both_params = params;
+  both_params.use_vectorized_mixture_evaluation = true;
+  auto tabulated_sensor_model = UUT{params, grid};
+  auto both_sensor_model = UUT{both_params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1., 1.}, {2.25, 2.25}};
+  auto tabulated_state_weighting_function =
+      tabulated_sensor_model(std::vector<std::pair<double, double>>{measurement});
+  auto both_state_weighting_function = both_sensor_model(std::vector<std::pair<double, double>>{measurement});
+
+  EXPECT_DOUBLE_EQ(tabulated_state_weighting_function(grid.origin()), both_state_weighting_function(grid.origin()));
+}
+
 TEST(BeamSensorModel, GridUpdates) {
   const auto origin = Sophus::SE2d{};
 
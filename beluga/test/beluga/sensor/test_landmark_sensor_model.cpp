@@ -162,6 +162,38 @@ TYPED_TEST(LandmarkSensorModelTests, OneStdInBearing) {
   }
 }
 
+TYPED_TEST(LandmarkSensorModelTests, BatchedEvaluationMatchesScalar) {
+  const auto pose = get_robot_pose_in_world<typename TypeParam::state_type>();
+  const auto landmarks = std::vector<LandmarkPositionDetection>{
+      {{1.0, -2.0, 0.0}, 0},
+      {{1.0, -0.0, 0.0}, 1},
+      {{2.0, -1.0, 0.0}, 2},
+  };
+  const auto detections = typename TypeParam::measurement_type{
+      {{+1.1, +0.2, 0.0}, 0},
+      {{-0.9, +0.1, 0.0}, 1},
+      {{+0.1, +1.2, 0.0}, 2},
+  };
+  auto params = get_default_model_params();
+  const auto scalar_model = TypeParam{params, LandmarkMap(default_map_boundaries, landmarks)};
+  params.use_batched_evaluation = true;
+  const auto batched_model = TypeParam{params, LandmarkMap(default_map_boundaries, landmarks)};
+  const auto scalar_weight = scalar_model(typename TypeParam::measurement_type{detections})(pose);
+  const auto batched_weight = batched_model(typename TypeParam::measurement_type{detections})(pose);
+  EXPECT_GT(scalar_weight, 0.0);
+  EXPECT_NEAR(scalar_weight, batched_weight, 1e-12);
+}
+
+TYPED_TEST(LandmarkSensorModelTests, BatchedEvaluationNoSuchLandmark) {
+  const auto pose = get_robot_pose_in_world<typename TypeParam::state_type>();
+  auto params = get_default_model_params();
+  params.use_batched_evaluation = true;
+  auto map = LandmarkMap(default_map_boundaries, {{{0.0, 1.0, 0.0}, 99}});
+  const auto sensor_model = TypeParam{params, std::move(map)};
+  const auto state_weighting_function = sensor_model({{{0.0, 2.0, 0.0}, 88}});
+  EXPECT_NEAR(expected_aggregate_probability({0.0}), state_weighting_function(pose), 1e-02);
+}
+
 TYPED_TEST(LandmarkSensorModelTests, NoSuchLandmark) {
   const auto pose = get_robot_pose_in_world<typename TypeParam::state_type>();
   // test case where there is not landmark in the map of the detected id
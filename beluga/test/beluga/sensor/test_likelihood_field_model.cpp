@@ -15,6 +15,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -24,6 +26,7 @@
 
 #include "beluga/sensor/likelihood_field_model.hpp"
 #include "beluga/test/static_occupancy_grid.hpp"
+#include "beluga/utility/shared_memory_region.hpp"
 
 namespace {
 
@@ -157,6 +160,435 @@ TEST(LikelihoodFieldModel, GridWithRotationAndOffset) {
   }
 }
 
+TEST(LikelihoodFieldModel, BatchedEvaluationMatchesScalar) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto batched_params = params;
+  batched_params.use_batched_evaluation = true;
+  auto scalar_model = UUT{params, grid};
+  auto batched_model = UUT{batched_params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}};
+  auto scalar_weighting_function = scalar_model(std::vector<std::pair<double, double>>{measurement});
+  auto batched_weighting_function = batched_model(std::vector<std::pair<double, double>>{measurement});
+
+  const auto pose = Sophus::SE2d{Sophus::SO2d{0.1}, Eigen::Vector2d{0.2, 0.3}};
+  ASSERT_NEAR(scalar_weighting_function(grid.origin()), batched_weighting_function(grid.origin()), 1e-4);
+  ASSERT_NEAR(scalar_weighting_function(pose), batched_weighting_function(pose), 1e-4);
+}
+
+TEST(LikelihoodFieldModel, PrefetchingEvaluationMatchesPlain) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  params.use_batched_evaluation = true;
+  auto prefetching_params = params;
+  prefetching_params.evaluation_prefetch_lookahead = 2;  // Larger than some scans, smaller than others.
+  auto plain_model = UUT{params, grid};
+  auto prefetching_model = UUT{prefetching_params, grid};
+
+  const auto measurement =
+      std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}, {25.0, 25.0}};
+  auto plain_weighting_function = plain_model(std::vector<std::pair<double, double>>{measurement});
+  auto prefetching_weighting_function = prefetching_model(std::vector<std::pair<double, double>>{measurement});
+
+  const auto pose = Sophus::SE2d{Sophus::SO2d{0.1}, Eigen::Vector2d{0.2, 0.3}};
+  ASSERT_NEAR(plain_weighting_function(grid.origin()), prefetching_weighting_function(grid.origin()), 1e-4);
+  ASSERT_NEAR(plain_weighting_function(pose), prefetching_weighting_function(pose), 1e-4);
+
+  const auto short_measurement = std::vector<std::pair<double, double>>{{1.20, 1.20}};
+  auto short_weighting_function = prefetching_model(std::vector<std::pair<double, double>>{short_measurement});
+  ASSERT_GT(short_weighting_function(grid.origin()), 1.0);
+}
+
+TEST(LikelihoodFieldModel, PreprocessedScanSharedAcrossModels) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto batched_params = params;
+  batched_params.use_batched_evaluation = true;
+  auto scalar_model = UUT{params, grid};
+  auto batched_model = UUT{batched_params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}};
+  const auto scan = batched_model.preprocess_measurement(std::vector<std::pair<double, double>>{measurement});
+
+  // Both models conditioned on the same preprocessed scan match their own single-use paths.
+  auto shared_scalar_function = scalar_model(scan);
+  auto shared_batched_function = batched_model(scan);
+  auto reference_function = scalar_model(std::vector<std::pair<double, double>>{measurement});
+
+  const auto pose = Sophus::SE2d{Sophus::SO2d{0.1}, Eigen::Vector2d{0.2, 0.3}};
+  ASSERT_EQ(shared_scalar_function(pose), reference_function(pose));
+  ASSERT_NEAR(shared_batched_function(pose), reference_function(pose), 1e-4);
+}
+
+TEST(LikelihoodFieldModel, BatchedModelDegradesOnUnbatchedScan) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto batched_params = params;
+  batched_params.use_batched_evaluation = true;
+  auto scalar_model = UUT{params, grid};
+  auto batched_model = UUT{batched_params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}};
+
+  // A scan preprocessed without the batched matrix sends the batched model down the
+  // scalar path, matching the scalar model bit for bit.
+  const auto scan = scalar_model.preprocess_measurement(std::vector<std::pair<double, double>>{measurement});
+  auto batched_weighting_function = batched_model(scan);
+  auto scalar_weighting_function = scalar_model(scan);
+
+  const auto pose = Sophus::SE2d{Sophus::SO2d{0.1}, Eigen::Vector2d{0.2, 0.3}};
+  ASSERT_EQ(batched_weighting_function(pose), scalar_weighting_function(pose));
+}
+
+TEST(LikelihoodFieldModel, CachedFieldMatchesComputed) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  const auto reference_model = UUT{params, grid};
+
+  params.likelihood_field_cache_directory = testing::TempDir();
+  const auto cold_model = UUT{params, grid};  // Computes the field and populates the cache.
+  const auto warm_model = UUT{params, grid};  // Loads the field back from the cache.
+
+  ASSERT_EQ(warm_model.likelihood_field().width(), reference_model.likelihood_field().width());
+  ASSERT_EQ(warm_model.likelihood_field().resolution(), reference_model.likelihood_field().resolution());
+  ASSERT_EQ(warm_model.likelihood_field().data(), reference_model.likelihood_field().data());
+  ASSERT_EQ(cold_model.likelihood_field().data(), reference_model.likelihood_field().data());
+}
+
+TEST(LikelihoodFieldModel, QuantizedStorageMatchesFloat) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto quantized_params = params;
+  quantized_params.use_quantized_storage = true;
+  auto float_model = UUT{params, grid};
+  auto quantized_model = UUT{quantized_params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}};
+  auto float_weighting_function = float_model(std::vector<std::pair<double, double>>{measurement});
+  auto quantized_weighting_function = quantized_model(std::vector<std::pair<double, double>>{measurement});
+
+  // The field spans 16 bits of dynamic range, so weights agree up to quantization error.
+  ASSERT_NEAR(float_weighting_function(grid.origin()), quantized_weighting_function(grid.origin()), 1e-3);
+}
+
+TEST(LikelihoodFieldModel, TiledStorageMatchesRowMajor) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto tiled_params = params;
+  tiled_params.use_tiled_field_storage = true;
+  auto row_major_model = UUT{params, grid};
+  auto tiled_model = UUT{tiled_params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}};
+  auto row_major_weighting_function = row_major_model(std::vector<std::pair<double, double>>{measurement});
+  auto tiled_weighting_function = tiled_model(std::vector<std::pair<double, double>>{measurement});
+
+  // Tiling only re-lays the same float values, so weights agree exactly.
+  ASSERT_DOUBLE_EQ(row_major_weighting_function(grid.origin()), tiled_weighting_function(grid.origin()));
+}
+
+TEST(LikelihoodFieldModel, SparseStorageMatchesRowMajor) {
+  constexpr double kResolution = 0.5;
+  // A single obstacle with a short decay radius leaves most of the field at the
+  // background likelihood, which is what the sparse backend is meant for.
+  auto array = std::array<bool, 16 * 16>{};
+  array[8 * 16 + 8] = true;
+  const auto grid = StaticOccupancyGrid<16, 16>{array, kResolution};
+
+  auto params = beluga::LikelihoodFieldModelParam{1.0, 20.0, 0.5, 0.5, 0.2};
+  auto sparse_params = params;
+  sparse_params.use_sparse_field_storage = true;
+  auto row_major_model = beluga::LikelihoodFieldModel<StaticOccupancyGrid<16, 16>>{params, grid};
+  auto sparse_model = beluga::LikelihoodFieldModel<StaticOccupancyGrid<16, 16>>{sparse_params, grid};
+
+  // The backend engaged and released the row-major field.
+  ASSERT_EQ(sparse_model.likelihood_field().size(), 0UL);
+
+  const auto measurement = std::vector<std::pair<double, double>>{{4.25, 4.25}, {4.30, 4.30}, {1.25, 1.25}};
+  auto row_major_weighting_function = row_major_model(std::vector<std::pair<double, double>>{measurement});
+  auto sparse_weighting_function = sparse_model(std::vector<std::pair<double, double>>{measurement});
+
+  // Sparse pages hold the same float values, so weights agree exactly.
+  ASSERT_DOUBLE_EQ(row_major_weighting_function(grid.origin()), sparse_weighting_function(grid.origin()));
+}
+
+TEST(LikelihoodFieldModel, SparseStorageFallsBackOnDenseFields) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  // Nearly every cell of this small field differs from the background, so the
+  // sparsity threshold is not met and the row-major field stays in place.
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  params.use_sparse_field_storage = true;
+  auto sensor_model = UUT{params, grid};
+  ASSERT_GT(sensor_model.likelihood_field().size(), 0UL);
+
+  auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{{1.25, 1.25}});
+  ASSERT_NEAR(2.068, state_weighting_function(grid.origin()), 0.003);
+}
+
+TEST(LikelihoodFieldModel, PaddedFieldMatchesUnpadded) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto padded_params = params;
+  padded_params.use_padded_field = true;
+  auto checked_model = UUT{params, grid};
+  auto padded_model = UUT{padded_params, grid};
+
+  // One cell of halo all around, with the origin shifted to compensate.
+  ASSERT_EQ(padded_model.likelihood_field().width(), checked_model.likelihood_field().width() + 2UL);
+  ASSERT_EQ(padded_model.likelihood_field().height(), checked_model.likelihood_field().height() + 2UL);
+  ASSERT_DOUBLE_EQ(padded_model.likelihood_field_origin().translation().x(), -kResolution);
+  ASSERT_DOUBLE_EQ(padded_model.likelihood_field_origin().translation().y(), -kResolution);
+
+  // In-field, out-of-field and far out-of-range hits all clamp onto cells holding the
+  // same value the checked path substitutes, so weights agree bit for bit.
+  const auto measurement = std::vector<std::pair<double, double>>{{1.25, 1.25}, {2.25, 2.25}, {-50.0, 50.0}};
+  auto checked_weighting_function = checked_model(std::vector<std::pair<double, double>>{measurement});
+  auto padded_weighting_function = padded_model(std::vector<std::pair<double, double>>{measurement});
+
+  ASSERT_DOUBLE_EQ(checked_weighting_function(grid.origin()), padded_weighting_function(grid.origin()));
+  const auto far_pose = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{100.0, 100.0}};
+  ASSERT_DOUBLE_EQ(checked_weighting_function(far_pose), padded_weighting_function(far_pose));
+}
+
+TEST(LikelihoodFieldModel, PaddedFieldMatchesUnpaddedWhenBatched) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  params.use_batched_evaluation = true;
+  auto padded_params = params;
+  padded_params.use_padded_field = true;
+  auto checked_model = UUT{params, grid};
+  auto padded_model = UUT{padded_params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {25.0, 25.0}};
+  auto checked_weighting_function = checked_model(std::vector<std::pair<double, double>>{measurement});
+  auto padded_weighting_function = padded_model(std::vector<std::pair<double, double>>{measurement});
+
+  const auto pose = Sophus::SE2d{Sophus::SO2d{0.1}, Eigen::Vector2d{0.2, 0.3}};
+  ASSERT_DOUBLE_EQ(checked_weighting_function(grid.origin()), padded_weighting_function(grid.origin()));
+  ASSERT_DOUBLE_EQ(checked_weighting_function(pose), padded_weighting_function(pose));
+}
+
+TEST(LikelihoodFieldModel, BilinearInterpolationMatchesNearestAtCentroids) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto interpolated_params = params;
+  interpolated_params.use_bilinear_interpolation = true;
+  auto nearest_model = UUT{params, grid};
+  auto interpolated_model = UUT{interpolated_params, grid};
+
+  // Hits at cell centroids, where the bilinear blend collapses to the cell value.
+  const auto measurement = std::vector<std::pair<double, double>>{{1.25, 1.25}, {0.75, 0.75}, {1.75, 2.25}};
+  auto nearest_weighting_function = nearest_model(std::vector<std::pair<double, double>>{measurement});
+  auto interpolated_weighting_function = interpolated_model(std::vector<std::pair<double, double>>{measurement});
+
+  ASSERT_NEAR(nearest_weighting_function(grid.origin()), interpolated_weighting_function(grid.origin()), 1e-6);
+}
+
+TEST(LikelihoodFieldModel, BilinearInterpolationBlendsBetweenCells) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  params.use_bilinear_interpolation = true;
+  auto model = UUT{params, grid};
+
+  // A hit midway between the obstacle cell centroid and a neighbor centroid weighs
+  // strictly between hits at either centroid.
+  const auto weight_at = [&model, &grid](double x, double y) {
+    auto weighting_function = model(std::vector<std::pair<double, double>>{{x, y}});
+    return weighting_function(grid.origin());
+  };
+  const auto at_obstacle = weight_at(1.25, 1.25);
+  const auto at_neighbor = weight_at(1.75, 1.25);
+  const auto in_between = weight_at(1.50, 1.25);
+  ASSERT_LT(in_between, at_obstacle);
+  ASSERT_GT(in_between, at_neighbor);
+}
+
+TEST(LikelihoodFieldModel, PyramidStoresUpperBounds) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  params.use_pyramid_evaluation = true;
+  const auto sensor_model = UUT{params, grid};
+
+  const auto& pyramid = sensor_model.likelihood_field_pyramid();
+  ASSERT_EQ(pyramid.size(), 3UL);  // 5x5 -> 3x3 -> 2x2 -> 1x1
+  ASSERT_EQ(pyramid.back().size(), 1UL);
+  ASSERT_DOUBLE_EQ(pyramid.back().resolution(), kResolution * 8.0);
+
+  // Max-downsampling preserves the field maximum at every level.
+  const auto& field_values = sensor_model.likelihood_field().data();
+  const float field_max = *std::max_element(field_values.begin(), field_values.end());
+  for (const auto& level : pyramid) {
+    const float level_max = *std::max_element(level.data().begin(), level.data().end());
+    ASSERT_FLOAT_EQ(level_max, field_max);
+  }
+}
+
+TEST(LikelihoodFieldModel, PyramidEvaluationPrunesHopelessStates) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto pyramid_params = params;
+  pyramid_params.use_pyramid_evaluation = true;
+  pyramid_params.pyramid_prune_ratio = 0.5;
+  auto exact_model = UUT{params, grid};
+  auto pyramid_model = UUT{pyramid_params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}};
+  auto exact_weighting_function = exact_model(std::vector<std::pair<double, double>>{measurement});
+  auto pyramid_weighting_function = pyramid_model(std::vector<std::pair<double, double>>{measurement});
+
+  // The best state passes the bound check and is evaluated exactly, raising the pruning floor.
+  const auto best_weight = pyramid_weighting_function(grid.origin());
+  ASSERT_NEAR(exact_weighting_function(grid.origin()), best_weight, 1e-6);
+
+  // A hopeless state is pruned against the floor; its stand-in weight is an upper
+  // bound on the exact weight and sits below the floor by construction.
+  const auto far_pose = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{100.0, 100.0}};
+  const auto pruned_weight = pyramid_weighting_function(far_pose);
+  ASSERT_GE(pruned_weight + 1e-9, exact_weighting_function(far_pose));
+  ASSERT_LT(pruned_weight, pyramid_params.pyramid_prune_ratio * best_weight);
+}
+
 TEST(LikelihoodFieldModel, GridUpdates) {
   const auto origin = Sophus::SE2d{};
 
@@ -196,4 +628,138 @@ TEST(LikelihoodFieldModel, GridUpdates) {
   }
 }
 
+TEST(LikelihoodFieldModel, IncrementalUpdateMatchesFullRebuild) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  const auto updated_grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, false, false, true},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  params.use_incremental_map_updates = true;
+  auto sensor_model = UUT{params, grid};
+  sensor_model.update_map(updated_grid);
+
+  // The patched field matches a model built from scratch on the new grid bit for bit.
+  const auto reference_model = UUT{params, updated_grid};
+  ASSERT_EQ(sensor_model.likelihood_field().data(), reference_model.likelihood_field().data());
+}
+
+TEST(LikelihoodFieldModel, AdoptedFieldIsShared) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  const auto updated_grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, false, false, true},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto leader_model = UUT{params, grid};
+  auto follower_model = UUT{params, grid};
+
+  leader_model.update_map(updated_grid);
+  follower_model.adopt_field_from(leader_model);
+
+  // The follower shares the recomputed field instead of holding its own copy.
+  ASSERT_EQ(&follower_model.likelihood_field(), &leader_model.likelihood_field());
+}
+
+TEST(LikelihoodFieldModel, IncrementalUpdateWithIdenticalGrid) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  params.use_incremental_map_updates = true;
+  auto sensor_model = UUT{params, grid};
+  const auto expected = sensor_model.likelihood_field().data();
+  sensor_model.update_map(grid);
+  ASSERT_EQ(sensor_model.likelihood_field().data(), expected);
+}
+
+TEST(LikelihoodFieldModel, IncrementalUpdateFallsBackOnOriginChange) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto cells = std::array<bool, 25>{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false};
+  // clang-format on
+  const auto grid = StaticOccupancyGrid<5, 5>{cells, kResolution};
+  const auto moved_origin = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.0, 0.0}};
+  const auto moved_grid = StaticOccupancyGrid<5, 5>{cells, kResolution, moved_origin};
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  params.use_incremental_map_updates = true;
+  auto sensor_model = UUT{params, grid};
+  sensor_model.update_map(moved_grid);
+
+  // An origin change forces the full rebuild path, which also refreshes the transform.
+  const auto expected_translation = sensor_model.likelihood_field_origin().translation();
+  ASSERT_DOUBLE_EQ(expected_translation.x(), moved_origin.translation().x());
+  ASSERT_DOUBLE_EQ(expected_translation.y(), moved_origin.translation().y());
+}
+
+TEST(LikelihoodFieldModel, SharedMemoryFieldAttach) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  const auto publisher = UUT{params, grid};
+  const auto region = publisher.share_likelihood_field("/beluga_test_likelihood_field");
+
+  // The attached model views the published field in place and needs no occupancy grid.
+  const auto attached = UUT{params, beluga::SharedMemoryRegion::open(region.name())};
+
+  {
+    auto state_weighting_function = attached(std::vector<std::pair<double, double>>{{1.25, 1.25}});
+    ASSERT_NEAR(2.068, state_weighting_function(grid.origin()), 0.003);
+  }
+
+  {
+    auto state_weighting_function = attached(std::vector<std::pair<double, double>>{{2.25, 2.25}});
+    ASSERT_NEAR(1.000, state_weighting_function(grid.origin()), 0.003);
+  }
+}
+
 }  // namespace
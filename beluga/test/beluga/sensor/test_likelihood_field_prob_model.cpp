@@ -73,6 +73,29 @@ TEST(LikelihoodFieldProbModel, ImportanceWeight) {
   }
 }
 
+TEST(LikelihoodFieldProbModel, PreprocessedScanMatchesSingleUsePath) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldProbModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = UUT{params, grid};
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}};
+  const auto scan = sensor_model.preprocess_measurement(std::vector<std::pair<double, double>>{measurement});
+
+  auto shared_weighting_function = sensor_model(scan);
+  auto reference_weighting_function = sensor_model(std::vector<std::pair<double, double>>{measurement});
+  ASSERT_EQ(shared_weighting_function(grid.origin()), reference_weighting_function(grid.origin()));
+}
+
 TEST(LikelihoodFieldProbModel, GridWithOffset) {
   constexpr double kResolution = 2.0;
   // clang-format off
@@ -0,0 +1,121 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+#include "beluga/sensor/map_registry.hpp"
+
+namespace {
+
+struct FakeModel {
+  int floor = 0;
+};
+
+auto make_registry(std::atomic<int>& loads, std::size_t capacity = 2) {
+  auto registry = beluga::MapRegistry<FakeModel>{capacity};
+  registry.register_map("floor_1", [&loads] {
+    ++loads;
+    return FakeModel{1};
+  });
+  registry.register_map("floor_2", [&loads] {
+    ++loads;
+    return FakeModel{2};
+  });
+  registry.register_map("floor_3", [&loads] {
+    ++loads;
+    return FakeModel{3};
+  });
+  return registry;
+}
+
+TEST(MapRegistry, RegistrationCompilesNothing) {
+  std::atomic<int> loads{0};
+  auto registry = make_registry(loads);
+  EXPECT_EQ(loads, 0);
+  EXPECT_EQ(registry.resident_count(), 0UL);
+  EXPECT_EQ(registry.active(), nullptr);
+}
+
+TEST(MapRegistry, ActivationCompilesOnceWhileResident) {
+  std::atomic<int> loads{0};
+  auto registry = make_registry(loads);
+  const auto first = registry.activate("floor_1");
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->floor, 1);
+  EXPECT_EQ(loads, 1);
+  EXPECT_EQ(registry.activate("floor_1"), first);
+  EXPECT_EQ(loads, 1);
+}
+
+TEST(MapRegistry, LeastRecentlyUsedBundleIsEvicted) {
+  std::atomic<int> loads{0};
+  auto registry = make_registry(loads);
+  (void)registry.activate("floor_1");
+  (void)registry.activate("floor_2");
+  (void)registry.activate("floor_3");
+  EXPECT_EQ(registry.resident_count(), registry.capacity());
+  EXPECT_FALSE(registry.is_resident("floor_1"));
+  EXPECT_TRUE(registry.is_resident("floor_2"));
+  EXPECT_TRUE(registry.is_resident("floor_3"));
+  EXPECT_EQ(registry.active()->floor, 3);
+}
+
+TEST(MapRegistry, HeldHandlesOutliveEviction) {
+  std::atomic<int> loads{0};
+  auto registry = make_registry(loads);
+  const auto first = registry.activate("floor_1");
+  (void)registry.activate("floor_2");
+  (void)registry.activate("floor_3");
+  ASSERT_FALSE(registry.is_resident("floor_1"));
+  EXPECT_EQ(first->floor, 1);  // still valid after eviction
+  (void)registry.activate("floor_1");
+  EXPECT_EQ(loads, 4);  // evicted bundles recompile on demand
+}
+
+TEST(MapRegistry, PrefetchedBundleIsCollectedByActivation) {
+  std::atomic<int> loads{0};
+  auto registry = make_registry(loads);
+  registry.prefetch("floor_2");
+  const auto handle = registry.activate("floor_2");  // joins the in-flight prefetch
+  ASSERT_NE(handle, nullptr);
+  EXPECT_EQ(handle->floor, 2);
+  EXPECT_EQ(loads, 1);
+  registry.prefetch("floor_2");  // resident, so this is a no-op
+  EXPECT_EQ(loads, 1);
+}
+
+TEST(MapRegistry, UnknownKeyThrows) {
+  std::atomic<int> loads{0};
+  auto registry = make_registry(loads);
+  EXPECT_THROW((void)registry.activate("basement"), std::out_of_range);
+  EXPECT_THROW(registry.prefetch("basement"), std::out_of_range);
+}
+
+TEST(MapRegistry, ReRegistrationDropsResidentBundle) {
+  std::atomic<int> loads{0};
+  auto registry = make_registry(loads);
+  (void)registry.activate("floor_2");
+  registry.register_map("floor_2", [&loads] {
+    ++loads;
+    return FakeModel{22};
+  });
+  EXPECT_FALSE(registry.is_resident("floor_2"));
+  EXPECT_EQ(registry.activate("floor_2")->floor, 22);
+}
+
+}  // namespace
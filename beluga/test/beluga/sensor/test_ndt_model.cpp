@@ -14,6 +14,10 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
@@ -235,6 +239,165 @@ TEST(NDTSensorModel2DTests, SensorModel) {
   ASSERT_DOUBLE_EQ(state_weighing_fn(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{-10, -10}}), 1.0);
 }
 
+TEST(NDTSensorModel2DTests, MortonCode) {
+  // One bit per axis, interleaved as (y, x) from the least significant bit, with a bias on each axis
+  // so that negative coordinates sort before positive ones.
+  ASSERT_EQ(detail::morton_code<2>({0, 0}), 0xC000000000000000ULL);
+  ASSERT_EQ(detail::morton_code<2>({1, 0}), 0xC000000000000001ULL);
+  ASSERT_EQ(detail::morton_code<2>({0, 1}), 0xC000000000000002ULL);
+  ASSERT_EQ(detail::morton_code<2>({1, 1}), 0xC000000000000003ULL);
+  ASSERT_LT(detail::morton_code<2>({-1, 0}), detail::morton_code<2>({0, 0}));
+  ASSERT_LT(detail::morton_code<2>({0, -1}), detail::morton_code<2>({0, 0}));
+}
+
+TEST(NDTSensorModel3DTests, MortonCode) {
+  ASSERT_EQ(detail::morton_code<3>({0, 0, 0}), 0x7000000000000000ULL);
+  ASSERT_EQ(detail::morton_code<3>({1, 0, 0}), 0x7000000000000001ULL);
+  ASSERT_EQ(detail::morton_code<3>({0, 1, 0}), 0x7000000000000002ULL);
+  ASSERT_EQ(detail::morton_code<3>({0, 0, 1}), 0x7000000000000004ULL);
+  ASSERT_LT(detail::morton_code<3>({-1, 0, 0}), detail::morton_code<3>({0, 0, 0}));
+}
+
+TEST(NDTSensorModel2DTests, CellIndexPool) {
+  typename sparse_grid_2d_t::map_type map;
+  map[Eigen::Vector2i(0, 0)] = NDTCell2d{Eigen::Vector2d{0.5, 0.5}, get_diagonal_covariance_2d()};
+  map[Eigen::Vector2i(1, 1)] = NDTCell2d{Eigen::Vector2d{1.5, 1.5}, get_diagonal_covariance_2d(0.3, 0.7)};
+  map[Eigen::Vector2i(-2, 3)] = NDTCell2d{Eigen::Vector2d{-0.7, 1.6}, get_diagonal_covariance_2d(0.2, 0.1)};
+  const sparse_grid_2d_t grid{std::move(map), 1.0};
+
+  const detail::NDTCellIndexPool<sparse_grid_2d_t> pool{grid};
+  ASSERT_EQ(pool.size(), grid.size());
+  for (const auto& [cell, ndt_cell] : grid.data()) {
+    const auto maybe_index = pool.index_at(cell);
+    ASSERT_TRUE(maybe_index.has_value());
+    ASSERT_TRUE(pool.mean_at(*maybe_index).isApprox(ndt_cell.mean));
+    ASSERT_TRUE(pool.covariance_at(*maybe_index).isApprox(ndt_cell.covariance));
+  }
+  ASSERT_EQ(pool.index_at(Eigen::Vector2i(5, 5)), std::nullopt);
+  // Pool order follows the Morton code of the cells, not the map iteration order.
+  ASSERT_LT(*pool.index_at(Eigen::Vector2i(-2, 3)), *pool.index_at(Eigen::Vector2i(0, 0)));
+  ASSERT_LT(*pool.index_at(Eigen::Vector2i(0, 0)), *pool.index_at(Eigen::Vector2i(1, 1)));
+}
+
+TEST(NDTSensorModel2DTests, LikelihoodSumAfterMapUpdate) {
+  typename sparse_grid_2d_t::map_type map;
+  map[Eigen::Vector2i(0, 0)] = NDTCell2d{Eigen::Vector2d{0.5, 0.5}, get_diagonal_covariance_2d()};
+
+  constexpr double kMinimumLikelihood = 1e-6;
+  NDTSensorModel model{NDTModelParam2d{kMinimumLikelihood}, sparse_grid_2d_t{std::move(map), 1.0}};
+
+  typename sparse_grid_2d_t::map_type updated_map;
+  updated_map[Eigen::Vector2i(1, 1)] = NDTCell2d{Eigen::Vector2d{1.5, 1.5}, get_diagonal_covariance_2d()};
+  model.update_map(sparse_grid_2d_t{std::move(updated_map), 1.0});
+
+  const std::vector<NDTCell2d> measurements{
+      NDTCell2d{{0.5, 0.5}, get_diagonal_covariance_2d()},
+      NDTCell2d{{1.8, 1.5}, get_diagonal_covariance_2d()},
+  };
+  // The pooled cell storage is rebuilt along with the map, so the batched path keeps
+  // matching the scalar path after an update.
+  double expected = 0.0;
+  for (const auto& measurement : measurements) {
+    expected += model.likelihood_at(measurement);
+  }
+  ASSERT_NEAR(model.likelihood_sum_at(measurements), expected, 1e-12 * expected);
+}
+
+TEST(NDTSensorModel2DTests, LikelihoodSumMatchesPerMeasurementLikelihoods) {
+  typename sparse_grid_2d_t::map_type map;
+  map[Eigen::Vector2i(0, 0)] = NDTCell2d{Eigen::Vector2d{0.5, 0.5}, get_diagonal_covariance_2d()};
+  map[Eigen::Vector2i(1, 1)] = NDTCell2d{Eigen::Vector2d{1.5, 1.5}, get_diagonal_covariance_2d()};
+
+  constexpr double kMinimumLikelihood = 1e-6;
+  const NDTModelParam2d param{kMinimumLikelihood};
+  const NDTSensorModel model{param, sparse_grid_2d_t{std::move(map), 1.0}};
+
+  const std::vector<NDTCell2d> measurements{
+      NDTCell2d{{0.5, 0.5}, get_diagonal_covariance_2d()},
+      NDTCell2d{{1.8, 1.5}, get_diagonal_covariance_2d()},
+      NDTCell2d{{5.0, 5.0}, get_diagonal_covariance_2d()},
+  };
+
+  double expected = 0.0;
+  for (const auto& measurement : measurements) {
+    expected += model.likelihood_at(measurement);
+  }
+  // The batched path evaluates the exponentials through a vectorized kernel, so it is only
+  // required to match the scalar path up to floating point rounding.
+  ASSERT_NEAR(model.likelihood_sum_at(measurements), expected, 1e-12 * expected);
+}
+
+TEST(NDTSensorModel2DTests, CoarseMapMergesNeighboringCells) {
+  typename sparse_grid_2d_t::map_type map;
+  map[Eigen::Vector2i(0, 0)] = NDTCell2d{Eigen::Vector2d{0.25, 0.25}, get_diagonal_covariance_2d()};
+  map[Eigen::Vector2i(1, 0)] = NDTCell2d{Eigen::Vector2d{0.75, 0.25}, get_diagonal_covariance_2d()};
+  map[Eigen::Vector2i(0, 1)] = NDTCell2d{Eigen::Vector2d{0.25, 0.75}, get_diagonal_covariance_2d()};
+  map[Eigen::Vector2i(1, 1)] = NDTCell2d{Eigen::Vector2d{0.75, 0.75}, get_diagonal_covariance_2d()};
+
+  constexpr double kMinimumLikelihood = 1e-6;
+  NDTModelParam2d param{kMinimumLikelihood};
+  param.build_coarse_map = true;
+  const NDTSensorModel model{param, sparse_grid_2d_t{std::move(map), 0.5}};
+
+  ASSERT_TRUE(model.has_coarse_map());
+  // The four fine cells merge into one coarse gaussian centered on their mean average.
+  EXPECT_GT(model.coarse_likelihood_at({{0.5, 0.5}, get_diagonal_covariance_2d()}), kMinimumLikelihood);
+  // Far away from any coarse cell, the coarse score falls back to the likelihood floor.
+  EXPECT_DOUBLE_EQ(model.coarse_likelihood_at({{50.0, 50.0}, get_diagonal_covariance_2d()}), kMinimumLikelihood);
+}
+
+TEST(NDTSensorModel2DTests, CoarseMapDisabledByDefault) {
+  typename sparse_grid_2d_t::map_type map;
+  map[Eigen::Vector2i(0, 0)] = NDTCell2d{Eigen::Vector2d{0.5, 0.5}, get_diagonal_covariance_2d()};
+  const NDTSensorModel model{NDTModelParam2d{}, sparse_grid_2d_t{std::move(map), 1.0}};
+  ASSERT_FALSE(model.has_coarse_map());
+}
+
+TEST(NDTSensorModel2DTests, ScoreCandidatesRefinesOnlySurvivors) {
+  typename sparse_grid_2d_t::map_type map;
+  map[Eigen::Vector2i(0, 0)] = NDTCell2d{Eigen::Vector2d{0.5, 0.5}, get_diagonal_covariance_2d()};
+  map[Eigen::Vector2i(1, 1)] = NDTCell2d{Eigen::Vector2d{1.5, 1.5}, get_diagonal_covariance_2d()};
+
+  constexpr double kMinimumLikelihood = 1e-6;
+  NDTModelParam2d param{kMinimumLikelihood};
+  param.build_coarse_map = true;
+  const NDTSensorModel model{param, sparse_grid_2d_t{std::move(map), 1.0}};
+
+  std::vector<Eigen::Vector2d> points;
+  for (int i = 0; i < 5; ++i) {
+    points.emplace_back(0.5 + 0.01 * i, 0.5 + 0.01 * i);
+  }
+  const std::vector<Sophus::SE2d> candidates{
+      Sophus::SE2d{},                                             // on the mapped cells
+      Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{100., 100.}},  // far off the map
+  };
+  const auto weights = model.score_candidates(points, candidates, 0.5);
+  ASSERT_EQ(weights.size(), 2UL);
+  // The aligned candidate survives the coarse pass and gets a full-resolution weight;
+  // the far-off candidate is pruned and reports zero.
+  EXPECT_GT(weights[0], 1.0);
+  EXPECT_DOUBLE_EQ(weights[1], 0.0);
+}
+
+TEST(NDTSensorModel2DTests, SharedMapHandle) {
+  typename sparse_grid_2d_t::map_type map;
+  map[Eigen::Vector2i(0, 0)] = NDTCell2d{Eigen::Vector2d{0.5, 0.5}, get_diagonal_covariance_2d()};
+
+  const auto cells_data = std::make_shared<const sparse_grid_2d_t>(std::move(map), 1.0);
+  NDTSensorModel first_model{NDTModelParam2d{}, cells_data};
+  const NDTSensorModel second_model{NDTModelParam2d{}, cells_data};
+  // Both instances share one map instead of holding duplicates.
+  ASSERT_EQ(first_model.cells_data().get(), second_model.cells_data().get());
+
+  typename sparse_grid_2d_t::map_type updated_map;
+  updated_map[Eigen::Vector2i(1, 1)] = NDTCell2d{Eigen::Vector2d{1.5, 1.5}, get_diagonal_covariance_2d()};
+  const auto updated_cells_data = std::make_shared<const sparse_grid_2d_t>(std::move(updated_map), 1.0);
+  first_model.update_map(updated_cells_data);
+  // The update swaps the handle of the target instance only.
+  ASSERT_EQ(first_model.cells_data().get(), updated_cells_data.get());
+  ASSERT_EQ(second_model.cells_data().get(), cells_data.get());
+}
+
 TEST(NDTSensorModel2DTests, LoadFromHDF5HappyPath) {
   const auto ndt_map_representation = io::load_from_hdf5<sparse_grid_2d_t>("./test_data/turtlebot3_world.hdf5");
   ASSERT_EQ(ndt_map_representation.size(), 30UL);
@@ -248,9 +411,111 @@ TEST(NDTSensorModel3DTests, LoadFromHDF5NonExistingFile) {
   ASSERT_THROW(io::load_from_hdf5<sparse_grid_3d_t>("bad_file.hdf5"), std::invalid_argument);
 }
 
+TEST(NDTSensorModel2DTests, LoadFromHDF5Async) {
+  auto future = io::load_from_hdf5_async<sparse_grid_2d_t>("./test_data/turtlebot3_world.hdf5");
+  const auto ndt_map_representation = future.get();
+  ASSERT_EQ(ndt_map_representation.size(), 30UL);
+}
+
+TEST(NDTSensorModel2DTests, LoadFromHDF5AsyncNonExistingFile) {
+  auto future = io::load_from_hdf5_async<sparse_grid_2d_t>("bad_file.hdf5");
+  // Errors surface when the future is retrieved.
+  ASSERT_THROW(future.get(), std::invalid_argument);
+}
+
 TEST(NDTSensorModel3DTests, LoadFromHDF5HappyPath) {
   const auto ndt_map_representation = io::load_from_hdf5<sparse_grid_3d_t>("./test_data/sample_3d_ndt_map.hdf5");
   ASSERT_EQ(ndt_map_representation.size(), 398);
 }
 
+TEST(NDTSensorModel2DTests, BinaryMapRoundTrip) {
+  typename sparse_grid_2d_t::map_type map;
+  map[Eigen::Vector2i(0, 0)] = NDTCell2d{Eigen::Vector2d{0.5, 0.5}, get_diagonal_covariance_2d()};
+  map[Eigen::Vector2i(1, 1)] = NDTCell2d{Eigen::Vector2d{1.5, 1.5}, get_diagonal_covariance_2d(0.3, 0.7)};
+  map[Eigen::Vector2i(-2, 3)] = NDTCell2d{Eigen::Vector2d{-0.7, 1.6}, get_diagonal_covariance_2d(0.2, 0.1)};
+  const sparse_grid_2d_t grid{std::move(map), 0.5};
+
+  const auto path = std::filesystem::temp_directory_path() / "beluga_test_ndt_map_2d.bin";
+  io::save_to_binary(grid, path);
+  const auto loaded = io::load_from_binary<sparse_grid_2d_t>(path);
+
+  ASSERT_EQ(loaded.size(), grid.size());
+  ASSERT_DOUBLE_EQ(loaded.resolution(), grid.resolution());
+  for (const auto& [cell, ndt_cell] : grid.data()) {
+    const auto maybe_ndt = loaded.data_at(cell);
+    ASSERT_TRUE(maybe_ndt.has_value());
+    ASSERT_TRUE(maybe_ndt->mean.isApprox(ndt_cell.mean));
+    ASSERT_TRUE(maybe_ndt->covariance.isApprox(ndt_cell.covariance));
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(NDTSensorModel2DTests, SharedMemoryMapAttach) {
+  typename sparse_grid_2d_t::map_type map;
+  map[Eigen::Vector2i(0, 0)] = NDTCell2d{Eigen::Vector2d{0.5, 0.5}, get_diagonal_covariance_2d()};
+  map[Eigen::Vector2i(1, 1)] = NDTCell2d{Eigen::Vector2d{1.5, 1.5}, get_diagonal_covariance_2d(0.3, 0.7)};
+  map[Eigen::Vector2i(-2, 3)] = NDTCell2d{Eigen::Vector2d{-0.7, 1.6}, get_diagonal_covariance_2d(0.2, 0.1)};
+  const sparse_grid_2d_t grid{std::move(map), 0.5};
+
+  const auto region = io::save_to_shared_memory(grid, "/beluga_test_ndt_map_2d");
+  const NDTSensorModel reference{NDTModelParam2d{}, grid};
+  // The attached model reads the gaussians in place from the mapped segment.
+  const NDTSensorModel<sparse_grid_2d_t> attached{NDTModelParam2d{}, SharedMemoryRegion::open(region.name())};
+
+  ASSERT_DOUBLE_EQ(attached.cells_data()->resolution(), grid.resolution());
+  for (const auto& [cell, ndt_cell] : grid.data()) {
+    ASSERT_DOUBLE_EQ(attached.likelihood_at(ndt_cell), reference.likelihood_at(ndt_cell));
+  }
+}
+
+TEST(NDTSensorModel2DTests, SharedMemoryMapMalformedSegment) {
+  const auto region = SharedMemoryRegion::create("/beluga_test_bad_ndt_map", 16);
+  ASSERT_THROW(
+      (NDTSensorModel<sparse_grid_2d_t>{NDTModelParam2d{}, SharedMemoryRegion::open(region.name())}),
+      std::invalid_argument);
+}
+
+TEST(NDTSensorModel2DTests, ConvertHDF5ToBinary) {
+  const auto path = std::filesystem::temp_directory_path() / "beluga_test_turtlebot3_world.bin";
+  io::convert_hdf5_to_binary<sparse_grid_2d_t>("./test_data/turtlebot3_world.hdf5", path);
+
+  const auto from_hdf5 = io::load_from_hdf5<sparse_grid_2d_t>("./test_data/turtlebot3_world.hdf5");
+  const auto from_binary = io::load_from_binary<sparse_grid_2d_t>(path);
+
+  ASSERT_EQ(from_binary.size(), from_hdf5.size());
+  for (const auto& [cell, ndt_cell] : from_hdf5.data()) {
+    const auto maybe_ndt = from_binary.data_at(cell);
+    ASSERT_TRUE(maybe_ndt.has_value());
+    ASSERT_TRUE(maybe_ndt->mean.isApprox(ndt_cell.mean));
+    ASSERT_TRUE(maybe_ndt->covariance.isApprox(ndt_cell.covariance));
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(NDTSensorModel2DTests, LoadFromFileDispatchesByExtension) {
+  const auto path = std::filesystem::temp_directory_path() / "beluga_test_compiled_ndt_map.bin";
+  io::convert_hdf5_to_binary<sparse_grid_2d_t>("./test_data/turtlebot3_world.hdf5", path);
+
+  const auto from_hdf5 = io::load_from_file<sparse_grid_2d_t>("./test_data/turtlebot3_world.hdf5");
+  const auto from_binary = io::load_from_file<sparse_grid_2d_t>(path);
+
+  ASSERT_EQ(from_hdf5.size(), 30UL);
+  ASSERT_EQ(from_binary.size(), 30UL);
+  std::filesystem::remove(path);
+}
+
+TEST(NDTSensorModel3DTests, LoadFromBinaryNonExistingFile) {
+  ASSERT_THROW(io::load_from_binary<sparse_grid_3d_t>("bad_file.bin"), std::invalid_argument);
+}
+
+TEST(NDTSensorModel2DTests, LoadFromBinaryMalformedFile) {
+  const auto path = std::filesystem::temp_directory_path() / "beluga_test_malformed_ndt_map.bin";
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << "not an NDT binary map";
+  }
+  ASSERT_THROW(io::load_from_binary<sparse_grid_2d_t>(path), std::invalid_argument);
+  std::filesystem::remove(path);
+}
+
 }  // namespace beluga
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+
+#include <vector>
+
 #include <beluga/3d_embedding.hpp>
 #include <sophus/se2.hpp>
 #include <sophus/se3.hpp>
@@ -67,4 +70,57 @@ TEST(Embed3DTests, Se2ToSe3) {
   }
 }
 
+TEST(Embed3DTests, Se2ToSe3RoundTripSweep) {
+  for (double angle = -3.1; angle <= 3.1; angle += 0.05) {
+    const auto pose_2d = SE2d{angle, Eigen::Vector2d{1.0, -2.0}};
+    const auto pose_3d = To3d(pose_2d);
+    // The yaw-only quaternion is assembled from half-angle identities without a
+    // normalization pass, so it must come out unit by construction.
+    ASSERT_NEAR(pose_3d.unit_quaternion().norm(), 1.0, 1e-14);
+    ASSERT_TRUE(To2d(pose_3d).matrix().isApprox(pose_2d.matrix()));
+  }
+}
+
+TEST(Embed3DTests, Se2ToSe3HalfTurn) {
+  const auto pose_2d = SE2d{Sophus::Constants<double>::pi(), Eigen::Vector2d{0.5, 0.5}};
+  const auto pose_3d = To3d(pose_2d);
+  ASSERT_NEAR(pose_3d.unit_quaternion().norm(), 1.0, 1e-14);
+  ASSERT_TRUE(To2d(pose_3d).matrix().isApprox(pose_2d.matrix()));
+}
+
+TEST(Embed3DTests, Se3PointingAlongZFlattensToIdentity) {
+  const auto pose_3d = SE3d::rotY(Sophus::Constants<double>::pi() / 2);
+  ASSERT_TRUE(To2d(pose_3d).so2().matrix().isApprox(SO2d{}.matrix()));
+}
+
+TEST(Embed3DTests, BatchSe2ToSe3MatchesElementWise) {
+  auto poses = std::vector<SE2d>{};
+  for (double angle = -3.0; angle <= 3.0; angle += 0.5) {
+    poses.emplace_back(angle, Eigen::Vector2d{angle, -angle});
+  }
+  auto embedded = std::vector<SE3d>{};
+  To3d(poses, embedded);
+  ASSERT_EQ(embedded.size(), poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    ASSERT_TRUE(embedded[i].matrix().isApprox(To3d(poses[i]).matrix()));
+  }
+  // Refills without shrinking capacity, so steady-state conversions do not allocate.
+  const auto capacity = embedded.capacity();
+  To3d(poses, embedded);
+  ASSERT_EQ(embedded.capacity(), capacity);
+}
+
+TEST(Embed3DTests, BatchSe3ToSe2MatchesElementWise) {
+  auto poses = std::vector<SE3d>{};
+  for (double angle = -3.0; angle <= 3.0; angle += 0.5) {
+    poses.push_back(SE3d::rotZ(angle) * SE3d::trans(angle, -angle, 1.0));
+  }
+  auto flattened = std::vector<SE2d>{};
+  To2d(poses, flattened);
+  ASSERT_EQ(flattened.size(), poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    ASSERT_TRUE(flattened[i].matrix().isApprox(To2d(poses[i]).matrix()));
+  }
+}
+
 }  // namespace beluga
@@ -69,7 +69,9 @@ class PrimitivesTest : public testing::Test {};
 
 using PrimitivesTestCases = testing::Types<
     std::tuple<int, beluga::Weight>,
+    std::tuple<int, beluga::WeightF>,
     ranges::common_tuple<int, beluga::Weight>,
+    ranges::common_tuple<int, beluga::WeightF>,
     user::SimplestPossibleParticle,
     user::ParticleWithMemberExtensions,
     user::ParticleWithNonMemberExtensions>;
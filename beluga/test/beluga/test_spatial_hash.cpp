@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <array>
 #include <iterator>
+#include <ratio>
+#include <sophus/se2.hpp>
 #include <sophus/se3.hpp>
 #include <tuple>
 #include <vector>
@@ -153,6 +155,213 @@ TEST(SpatialHash, NonPeriodicityCheck2) {
   }
 }
 
+TEST(StaticSpatialHash, MatchesRuntimeHasherForTuples) {
+  using Tuple = std::tuple<double, double, double>;
+  // Power-of-two resolutions make the constant reciprocal exact, so both hashers must agree bit for bit.
+  auto runtime_hasher = beluga::spatial_hash<Tuple>{{0.25, 0.25, 0.5}};
+  auto static_hasher = beluga::static_spatial_hash<Tuple, std::ratio<1, 4>, std::ratio<1, 4>, std::ratio<1, 2>>{};
+
+  for (double x = -5.0; x <= 5.0; x += 0.13) {
+    const auto value = std::make_tuple(x, -1.7 * x, 0.7 * x - 0.3);
+    EXPECT_EQ(runtime_hasher(value), static_hasher(value));
+  }
+}
+
+TEST(StaticSpatialHash, MatchesRuntimeHasherForArrays) {
+  using Array = std::array<double, 2>;
+  auto runtime_hasher = beluga::spatial_hash<Array>{{1., 2.}};
+  auto static_hasher = beluga::static_spatial_hash<Array, std::ratio<1>, std::ratio<2>>{};
+
+  for (double x = -10.0; x <= 10.0; x += 0.37) {
+    const auto value = Array{x, -1.7 * x};
+    EXPECT_EQ(runtime_hasher(value), static_hasher(value));
+  }
+}
+
+TEST(StaticSpatialHash, Round) {
+  using Tuple = std::tuple<double, double>;
+  auto hasher = beluga::static_spatial_hash<Tuple, std::ratio<1>, std::ratio<1>>{};
+  auto hash1 = hasher(std::make_tuple(10.3, 5.0));
+  auto hash2 = hasher(std::make_tuple(10.0, 5.0));
+  auto hash3 = hasher(std::make_tuple(10.0, 5.3));
+  EXPECT_EQ(hash1, hash2);
+  EXPECT_EQ(hash2, hash3);
+  auto hash4 = hasher(std::make_tuple(9.1, 5.1));
+  auto hash5 = hasher(std::make_tuple(10.1, 4.1));
+  EXPECT_NE(hash1, hash4);
+  EXPECT_NE(hash1, hash5);
+}
+
+TEST(StaticSpatialHash, SE2) {
+  auto runtime_hasher = beluga::spatial_hash<Sophus::SE2d>{0.25, 0.25, 0.125};
+  auto static_hasher =
+      beluga::static_spatial_hash<Sophus::SE2d, std::ratio<1, 4>, std::ratio<1, 4>, std::ratio<1, 8>>{};
+
+  for (double t = -2.0; t <= 2.0; t += 0.17) {
+    const auto state = Sophus::SE2d{Sophus::SO2d{t}, Eigen::Vector2d{t, -0.3 * t}};
+    EXPECT_EQ(runtime_hasher(state), static_hasher(state));
+  }
+}
+
+TEST(StaticSpatialHash, SE3) {
+  auto runtime_hasher = beluga::spatial_hash<Sophus::SE3d>{0.25, 0.125};
+  auto static_hasher = beluga::static_spatial_hash<
+      Sophus::SE3d, std::ratio<1, 4>, std::ratio<1, 4>, std::ratio<1, 4>, std::ratio<1, 8>, std::ratio<1, 8>,
+      std::ratio<1, 8>>{};
+
+  for (double t = -2.0; t <= 2.0; t += 0.17) {
+    const auto state = Sophus::SE3d{Sophus::SO3d::rotZ(t), Eigen::Vector3d{t, -0.3 * t, 0.5 * t}};
+    EXPECT_EQ(runtime_hasher(state), static_hasher(state));
+  }
+}
+
+TEST(MortonSpatialHash, Round) {
+  using Tuple = std::tuple<double, double>;
+  constexpr std::array kClusteringResolution{1., 1.};
+  auto hasher = beluga::morton_spatial_hash<Tuple>{kClusteringResolution};
+  auto hash1 = hasher(std::make_tuple(10.3, 5.0));
+  auto hash2 = hasher(std::make_tuple(10.0, 5.0));
+  auto hash3 = hasher(std::make_tuple(10.0, 5.3));
+  auto hash4 = hasher(std::make_tuple(10.1, 5.1));
+  EXPECT_EQ(hash1, hash2);
+  EXPECT_EQ(hash2, hash3);
+  EXPECT_EQ(hash3, hash4);
+  auto hash5 = hasher(std::make_tuple(9.1, 5.1));
+  auto hash6 = hasher(std::make_tuple(10.1, 4.1));
+  EXPECT_NE(hash1, hash5);
+  EXPECT_NE(hash1, hash6);
+}
+
+TEST(MortonSpatialHash, NoCollisionsWithinBudget) {
+  using Tuple = std::tuple<double, double, double>;
+  constexpr int kLimit = 100;
+  constexpr std::array kClusteringResolution{1., 1., 1.};
+  auto hasher = beluga::morton_spatial_hash<Tuple>{kClusteringResolution};
+
+  // The per-dimension budget defaults to 21 bits for three dimensions, so all
+  // cells within +-2^20 of the origin must hash to distinct values.
+  auto hashes = ranges::views::cartesian_product(
+                    ranges::views::closed_iota(-kLimit, kLimit), ranges::views::closed_iota(-kLimit, kLimit),
+                    ranges::views::closed_iota(-kLimit, kLimit)) |
+                ranges::views::transform([hasher](const auto& tuple) {
+                  return hasher(std::make_tuple(
+                      static_cast<double>(std::get<0>(tuple)), static_cast<double>(std::get<1>(tuple)),
+                      static_cast<double>(std::get<2>(tuple))));
+                }) |
+                ranges::to<std::vector>;
+
+  std::sort(std::begin(hashes), std::end(hashes));
+  auto it = std::adjacent_find(std::begin(hashes), std::end(hashes));
+  const bool has_duplicates = it != std::end(hashes);
+  ASSERT_FALSE(has_duplicates);
+}
+
+TEST(MortonSpatialHash, AdjacentCellsAreClose) {
+  using Tuple = std::tuple<double, double>;
+  constexpr std::array kClusteringResolution{1., 1.};
+  auto hasher = beluga::morton_spatial_hash<Tuple>{kClusteringResolution};
+
+  // Cells within an aligned 2x2 block occupy four consecutive hash values.
+  for (double x = -8.0; x < 8.0; x += 2.0) {
+    for (double y = -8.0; y < 8.0; y += 2.0) {
+      const auto hashes = std::array{
+          hasher(std::make_tuple(x, y)),
+          hasher(std::make_tuple(x + 1.0, y)),
+          hasher(std::make_tuple(x, y + 1.0)),
+          hasher(std::make_tuple(x + 1.0, y + 1.0)),
+      };
+      const auto [min, max] = std::minmax_element(std::begin(hashes), std::end(hashes));
+      ASSERT_EQ(*max - *min, 3);
+    }
+  }
+}
+
+TEST(MortonSpatialHash, CustomBitBudget) {
+  using Tuple = std::tuple<double, double>;
+  constexpr std::array kClusteringResolution{1., 1.};
+  auto hasher = beluga::morton_spatial_hash<Tuple, 4>{kClusteringResolution};
+
+  // With 4 bits per dimension the hash is confined to 8 bits and cells 16 apart alias.
+  for (double x = -8.0; x < 8.0; x += 1.0) {
+    for (double y = -8.0; y < 8.0; y += 1.0) {
+      const auto hash = hasher(std::make_tuple(x, y));
+      ASSERT_LT(hash, 256);
+      ASSERT_EQ(hash, hasher(std::make_tuple(x + 16.0, y)));
+      ASSERT_EQ(hash, hasher(std::make_tuple(x, y + 16.0)));
+    }
+  }
+}
+
+TEST(MortonSpatialHash, Array) {
+  using Array = std::array<double, 3>;
+  using Tuple = std::tuple<double, double, double>;
+  constexpr std::array kClusteringResolution{1., 1., 1.};
+  auto array_hasher = beluga::morton_spatial_hash<Array>{kClusteringResolution};
+  auto tuple_hasher = beluga::morton_spatial_hash<Tuple>{kClusteringResolution};
+
+  auto hash1 = array_hasher({1., 2., 3.});
+  auto hash2 = tuple_hasher({1., 2., 3.});
+  EXPECT_EQ(hash1, hash2);
+}
+
+TEST(MortonSpatialHash, SE2) {
+  constexpr double kLinearResolution = 0.5;
+  constexpr double kAngularResolution = 0.2;
+  auto uut = beluga::morton_spatial_hash<Sophus::SE2d>{kLinearResolution, kAngularResolution};
+  {
+    const auto h1 = uut(Sophus::SE2d{});
+    const auto h2 = uut(Sophus::SE2d::transX(kLinearResolution - 1e-6));
+    ASSERT_EQ(h1, h2);
+    const auto h3 = uut(Sophus::SE2d::transX(kLinearResolution));
+    ASSERT_NE(h1, h3);
+  }
+  {
+    const auto h1 = uut(Sophus::SE2d{});
+    const auto h2 = uut(Sophus::SE2d::transY(kLinearResolution - 1e-6));
+    ASSERT_EQ(h1, h2);
+    const auto h3 = uut(Sophus::SE2d::transY(kLinearResolution));
+    ASSERT_NE(h1, h3);
+  }
+  {
+    const auto h1 = uut(Sophus::SE2d{});
+    const auto h2 = uut(Sophus::SE2d::rot(kAngularResolution - 1e-6));
+    ASSERT_EQ(h1, h2);
+    const auto h3 = uut(Sophus::SE2d::rot(kAngularResolution));
+    ASSERT_NE(h1, h3);
+  }
+}
+
+TEST(MortonSpatialHash, SE3) {
+  constexpr double kLinearResolution = 0.5;
+  constexpr double kAngularResolution = 0.2;
+  auto uut = beluga::morton_spatial_hash<Sophus::SE3d>{kLinearResolution, kAngularResolution};
+  {
+    const auto h1 = uut(Sophus::SE3d{});
+    const auto h2 = uut(Sophus::SE3d::transX(kLinearResolution - 1e-6));
+    ASSERT_EQ(h1, h2);
+    const auto h3 = uut(Sophus::SE3d::transX(kLinearResolution));
+    ASSERT_NE(h1, h3);
+  }
+  {
+    const auto h1 = uut(Sophus::SE3d{});
+    const auto h2 = uut(Sophus::SE3d::rotZ(kAngularResolution - 1e-6));
+    ASSERT_EQ(h1, h2);
+    const auto h3 = uut(Sophus::SE3d::rotZ(kAngularResolution));
+    ASSERT_NE(h1, h3);
+  }
+}
+
+TEST(SpatialHash, SE2SingleAndDoublePrecisionAgree) {
+  auto double_hasher = beluga::spatial_hash<Sophus::SE2d>{0.25, 0.25, 0.125};
+  auto float_hasher = beluga::spatial_hash<Sophus::SE2f>{0.25, 0.25, 0.125};
+  // Single-precision states hash through the same double-precision pipeline, so
+  // exactly representable poses produce identical hashes in both precisions.
+  for (double t = -2.0; t < 2.0; t += 0.25) {
+    const auto state = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{t, -0.5 * t}};
+    ASSERT_EQ(double_hasher(state), float_hasher(state.cast<float>()));
+  }
+}
+
 TEST(SpatialHash, SE3) {
   constexpr double kLinearResolution = 0.5;
   constexpr double kAngularResolution = 0.2;
@@ -0,0 +1,128 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <sophus/se2.hpp>
+
+#include "beluga/testing/synthetic_environment.hpp"
+
+namespace {
+
+using beluga::testing::SyntheticGridParams;
+using beluga::testing::SyntheticScanParams;
+
+TEST(SyntheticEnvironment, GridsAreDeterministic) {
+  auto params = SyntheticGridParams{};
+  params.width = 200;
+  params.height = 200;
+  params.clutter_density = 0.01;
+  const auto first = beluga::testing::generate_corridor_grid(params);
+  const auto second = beluga::testing::generate_corridor_grid(params);
+  ASSERT_EQ(first.size(), second.size());
+  EXPECT_EQ(first.data(), second.data());
+}
+
+TEST(SyntheticEnvironment, CorridorGridHasDoorways) {
+  auto params = SyntheticGridParams{};
+  params.width = 200;
+  params.height = 200;
+  params.structure_size = 20;
+  const auto grid = beluga::testing::generate_corridor_grid(params);
+  // The first wall sits one pitch up and must have at least one free doorway cell.
+  const auto wall_row = static_cast<int>(params.structure_size) + 1;
+  bool has_doorway = false;
+  for (int xi = 1; xi < static_cast<int>(params.width) - 1; ++xi) {
+    has_doorway = has_doorway || grid.free_at(xi, wall_row);
+  }
+  EXPECT_TRUE(has_doorway);
+  EXPECT_FALSE(grid.free_at(0, wall_row));
+}
+
+TEST(SyntheticEnvironment, WarehouseGridHasRacksAndAisles) {
+  auto params = SyntheticGridParams{};
+  params.width = 400;
+  params.height = 400;
+  params.structure_size = 40;
+  const auto grid = beluga::testing::generate_warehouse_grid(params);
+  const auto size = static_cast<int>(params.structure_size);
+  EXPECT_FALSE(grid.free_at(size + size / 2, size + size / 2));  // inside the first rack
+  EXPECT_TRUE(grid.free_at(size / 2, size / 2));                 // inside the first aisle
+  EXPECT_FALSE(grid.free_at(0, 0));                              // on the border
+}
+
+TEST(SyntheticEnvironment, OpenFieldClutterMatchesDensity) {
+  auto params = SyntheticGridParams{};
+  params.width = 500;
+  params.height = 500;
+  params.clutter_density = 0.05;
+  const auto grid = beluga::testing::generate_open_field_grid(params);
+  const auto occupied = static_cast<double>(std::count(grid.data().begin(), grid.data().end(), true));
+  const auto density = occupied / static_cast<double>(grid.size());
+  EXPECT_NEAR(density, params.clutter_density, 0.01);
+}
+
+TEST(SyntheticEnvironment, SimulatedScanHitsBorder) {
+  auto params = SyntheticGridParams{};
+  params.width = 100;
+  params.height = 100;
+  params.resolution = 1.0;
+  const auto grid = beluga::testing::generate_open_field_grid(params);
+  auto scan_params = SyntheticScanParams{};
+  scan_params.beam_count = 8;
+  scan_params.max_range = 200.0;
+  const auto pose = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{50.0, 50.0}};
+  const auto points = beluga::testing::simulate_scan(grid, pose, scan_params);
+  ASSERT_EQ(points.size(), scan_params.beam_count);
+  for (const auto& [x, y] : points) {
+    const auto range = std::sqrt(x * x + y * y);
+    EXPECT_GE(range, 45.0);
+    EXPECT_LE(range, 75.0);  // diagonal beams travel up to sqrt(2) times farther
+  }
+}
+
+TEST(SyntheticEnvironment, SimulatedScanNoiseIsDeterministic) {
+  auto params = SyntheticGridParams{};
+  params.width = 100;
+  params.height = 100;
+  params.resolution = 1.0;
+  const auto grid = beluga::testing::generate_open_field_grid(params);
+  auto scan_params = SyntheticScanParams{};
+  scan_params.beam_count = 90;
+  scan_params.range_noise_std = 0.1;
+  const auto pose = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{50.0, 50.0}};
+  const auto first = beluga::testing::simulate_scan(grid, pose, scan_params);
+  const auto second = beluga::testing::simulate_scan(grid, pose, scan_params);
+  EXPECT_EQ(first, second);
+}
+
+TEST(SyntheticEnvironment, BeamsBeyondMaxRangeAreDropped) {
+  auto params = SyntheticGridParams{};
+  params.width = 100;
+  params.height = 100;
+  params.resolution = 1.0;
+  const auto grid = beluga::testing::generate_open_field_grid(params);
+  auto scan_params = SyntheticScanParams{};
+  scan_params.beam_count = 8;
+  scan_params.max_range = 10.0;  // shorter than the distance to any wall
+  const auto pose = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{50.0, 50.0}};
+  const auto points = beluga::testing::simulate_scan(grid, pose, scan_params);
+  EXPECT_TRUE(points.empty());
+}
+
+}  // namespace
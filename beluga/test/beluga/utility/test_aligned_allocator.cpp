@@ -0,0 +1,49 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "beluga/utility/aligned_allocator.hpp"
+
+namespace {
+
+TEST(AlignedAllocator, AllocationsAreAligned) {
+  beluga::AlignedAllocator<double, 64> allocator;
+  double* pointer = allocator.allocate(13);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pointer) % 64, 0U);
+  allocator.deallocate(pointer, 13);
+}
+
+TEST(AlignedAllocator, WorksWithStandardContainers) {
+  std::vector<double, beluga::AlignedAllocator<double, 64>> vector(100, 1.0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vector.data()) % 64, 0U);
+}
+
+TEST(AlignedAllocator, ReboundCopiesCompareEqual) {
+  beluga::AlignedAllocator<double, 64> allocator;
+  beluga::AlignedAllocator<int, 64> other{allocator};
+  EXPECT_TRUE(allocator == other);
+  EXPECT_FALSE(allocator != other);
+}
+
+TEST(AlignedAllocator, ThrowsOnOverflow) {
+  beluga::AlignedAllocator<double, 64> allocator;
+  EXPECT_THROW(allocator.allocate(std::numeric_limits<std::size_t>::max()), std::bad_alloc);
+}
+
+}  // namespace
@@ -49,6 +49,32 @@ TEST(IndexingIterator, ConstIteratorTraits) {
   static_assert(std::is_same_v<typename Iterator::difference_type, ssize_type>);
 }
 
+TEST(IndexingIterator, ContiguousOverFlatLayouts) {
+  using Iterator = beluga::IndexingIterator<std::vector<int>>;
+  using ConstIterator = beluga::IndexingIterator<const std::vector<int>>;
+  static_assert(beluga::has_contiguous_layout_v<std::vector<int>>);
+  static_assert(ranges::contiguous_iterator<Iterator>);
+  static_assert(ranges::contiguous_iterator<ConstIterator>);
+}
+
+TEST(IndexingIterator, RandomAccessOverOpaqueLayouts) {
+  struct Lookup {
+    using size_type = std::size_t;
+    int& operator[](size_type index) { return values[index % values.size()]; }
+    std::vector<int> values;
+  };
+  using Iterator = beluga::IndexingIterator<Lookup>;
+  static_assert(!beluga::has_contiguous_layout_v<Lookup>);
+  static_assert(ranges::random_access_iterator<Iterator>);
+  static_assert(!ranges::contiguous_iterator<Iterator>);
+}
+
+TEST(IndexingIterator, PointsIntoUnderlyingStorage) {
+  const auto sequence = std::vector{1, 2, 3};
+  auto iterator = beluga::IndexingIterator(sequence, 1UL);
+  EXPECT_EQ(iterator.operator->(), sequence.data() + 1);
+}
+
 TEST(IndexingIterator, Arithmetic) {
   const auto sequence = std::vector{0, 1};
   auto begin = beluga::IndexingIterator(sequence);
@@ -0,0 +1,107 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/utility/memory_hints.hpp"
+
+namespace {
+
+TEST(MemoryHints, DefaultHintsRequestNothing) {
+  const auto hints = beluga::MemoryHints{};
+  EXPECT_FALSE(hints.any());
+  auto buffer = std::vector<float>(1024);
+  EXPECT_FALSE(beluga::apply_memory_hints(buffer, hints));
+}
+
+TEST(MemoryHints, HugePageAdviceDoesNotModifyContents) {
+  auto buffer = std::vector<float>(1 << 20);
+  std::iota(buffer.begin(), buffer.end(), 0.0F);
+  auto hints = beluga::MemoryHints{};
+  hints.use_transparent_huge_pages = true;
+  EXPECT_TRUE(hints.any());
+  beluga::apply_memory_hints(buffer, hints);  // Best-effort, result is platform dependent.
+  EXPECT_EQ(buffer.front(), 0.0F);
+  EXPECT_EQ(buffer[12345], 12345.0F);
+}
+
+TEST(MemoryHints, BufferSpanningNoWholePage) {
+  auto buffer = std::vector<float>(4);
+  EXPECT_FALSE(beluga::advise_transparent_huge_pages(buffer.data(), buffer.size() * sizeof(float)));
+}
+
+TEST(MemoryHints, NumaPoliciesAreBestEffort) {
+  auto buffer = std::vector<float>(1 << 20);
+  const std::size_t size_bytes = buffer.size() * sizeof(float);
+  // Results depend on kernel support; only invalid requests are guaranteed to fail.
+  beluga::bind_to_numa_nodes(buffer.data(), size_bytes, beluga::NumaPolicy::kInterleave);
+  EXPECT_FALSE(beluga::bind_to_numa_nodes(buffer.data(), size_bytes, beluga::NumaPolicy::kDefault));
+  EXPECT_FALSE(beluga::bind_to_numa_nodes(buffer.data(), size_bytes, beluga::NumaPolicy::kBindToNode, -1));
+}
+
+TEST(MemoryHints, PrefaultKeepsContents) {
+  auto buffer = std::vector<float>(1 << 20);
+  std::iota(buffer.begin(), buffer.end(), 0.0F);
+  auto hints = beluga::MemoryHints{};
+  hints.prefault = true;
+  EXPECT_TRUE(hints.any());
+  EXPECT_TRUE(beluga::apply_memory_hints(buffer, hints));
+  EXPECT_EQ(buffer.front(), 0.0F);
+  EXPECT_EQ(buffer[54321], 54321.0F);
+}
+
+TEST(MemoryHints, PrefaultEmptyBuffer) {
+  EXPECT_FALSE(beluga::prefault_pages(nullptr, 0));
+}
+
+TEST(MemoryHints, LockingIsBestEffort) {
+  auto buffer = std::vector<float>(1024);
+  // Locking may fail under a tight RLIMIT_MEMLOCK; only empty requests are guaranteed to.
+  beluga::lock_pages(buffer.data(), buffer.size() * sizeof(float));
+  EXPECT_FALSE(beluga::lock_pages(buffer.data(), 0));
+}
+
+TEST(MemoryHints, FaultCountersGrowMonotonically) {
+  const auto before = beluga::current_page_fault_counts();
+  auto buffer = std::vector<float>(1 << 22);  // large enough to fault fresh pages in
+  buffer.back() = 1.0F;
+  const auto after = beluga::current_page_fault_counts();
+  EXPECT_GE(after.minor, before.minor);
+  EXPECT_GE(after.major, before.major);
+}
+
+TEST(MemoryHints, TupleVectorColumnsKeepContents) {
+  auto container = beluga::TupleVector<std::tuple<double, beluga::Weight>>{};
+  container.reserve(100'000);
+  for (int i = 0; i < 1000; ++i) {
+    container.push_back({static_cast<double>(i), beluga::Weight{1.0}});
+  }
+  auto hints = beluga::MemoryHints{};
+  hints.use_transparent_huge_pages = true;
+  container.apply_memory_hints(hints);  // Best-effort, result is platform dependent.
+  EXPECT_EQ(container.size(), 1000);
+  auto&& [state, weight] = *std::next(container.begin(), 42);
+  EXPECT_EQ(state, 42.0);
+  EXPECT_EQ(weight, 1.0);
+}
+
+}  // namespace
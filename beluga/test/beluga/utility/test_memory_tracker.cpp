@@ -0,0 +1,89 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "beluga/algorithm/distance_map.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/utility/memory_tracker.hpp"
+
+namespace {
+
+using beluga::MemorySubsystem;
+using beluga::MemoryTracker;
+
+TEST(MemoryTracker, RecordsAllocationsAndDeallocations) {
+  MemoryTracker::reset();
+  {
+    auto vector = std::vector<double, beluga::TrackingAllocator<double, MemorySubsystem::kDistanceMap>>{};
+    vector.resize(100);
+    const auto stats = MemoryTracker::stats(MemorySubsystem::kDistanceMap);
+    EXPECT_GE(stats.live_bytes, 100 * sizeof(double));
+    EXPECT_GE(stats.allocation_count, 1U);
+  }
+  const auto stats = MemoryTracker::stats(MemorySubsystem::kDistanceMap);
+  EXPECT_EQ(stats.live_bytes, 0U);
+  EXPECT_EQ(stats.allocation_count, stats.deallocation_count);
+}
+
+TEST(MemoryTracker, TracksPeakAcrossGrowth) {
+  MemoryTracker::reset();
+  {
+    auto vector = std::vector<int, beluga::TrackingAllocator<int, MemorySubsystem::kNdtMap>>{};
+    vector.resize(1'000);
+    vector.resize(10'000);
+    vector.clear();
+    vector.shrink_to_fit();
+  }
+  const auto stats = MemoryTracker::stats(MemorySubsystem::kNdtMap);
+  EXPECT_EQ(stats.live_bytes, 0U);
+  EXPECT_GE(stats.peak_bytes, 10'000 * sizeof(int));
+}
+
+TEST(MemoryTracker, ResetClearsAllSubsystems) {
+  {
+    auto vector = std::vector<int, beluga::TrackingAllocator<int, MemorySubsystem::kNdtMap>>(100);
+  }
+  MemoryTracker::reset();
+  const auto stats = MemoryTracker::stats(MemorySubsystem::kNdtMap);
+  EXPECT_EQ(stats.live_bytes, 0U);
+  EXPECT_EQ(stats.peak_bytes, 0U);
+  EXPECT_EQ(stats.allocation_count, 0U);
+  EXPECT_EQ(stats.deallocation_count, 0U);
+}
+
+TEST(MemoryTracker, TrackedTupleVectorAttributesToParticles) {
+  MemoryTracker::reset();
+  auto particles = beluga::TrackedTupleVector<std::tuple<double, float>>{};
+  particles.resize(1'000);
+  const auto stats = MemoryTracker::stats(MemorySubsystem::kParticles);
+  EXPECT_GE(stats.live_bytes, 1'000 * (sizeof(double) + sizeof(float)));
+  EXPECT_GE(stats.allocation_count, 2U);  // one per column
+}
+
+TEST(MemoryTracker, DistanceMapWithTrackingAllocator) {
+  MemoryTracker::reset();
+  const auto obstacle_mask = std::vector<bool>{false, true, false, false};
+  const auto distance_map = beluga::nearest_obstacle_distance_map_2d(
+      obstacle_mask, 2, 1.0, 100.0, beluga::TrackingAllocator<double, MemorySubsystem::kDistanceMap>{});
+  ASSERT_EQ(distance_map.size(), 4U);
+  const auto stats = MemoryTracker::stats(MemorySubsystem::kDistanceMap);
+  EXPECT_GE(stats.live_bytes, 4 * sizeof(double));
+}
+
+}  // namespace
@@ -0,0 +1,105 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <tuple>
+
+#include <sophus/se2.hpp>
+
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/utility/particle_history_logger.hpp"
+
+namespace {
+
+using Particle = std::tuple<Sophus::SE2d, beluga::Weight>;
+
+constexpr std::size_t kParticleCount = 10;
+// Pose columns serialize their parameter scalars, not whole (non-trivially-copyable) objects.
+constexpr std::size_t kBytesPerPose = static_cast<std::size_t>(Sophus::SE2d::num_parameters) * sizeof(double);
+constexpr std::size_t kRecordSize =
+    2 * sizeof(std::uint64_t) + kParticleCount * (kBytesPerPose + sizeof(beluga::Weight));
+
+auto make_particles() {
+  beluga::TupleVector<Particle> particles;
+  for (std::size_t i = 0; i < kParticleCount; ++i) {
+    particles.push_back(std::make_tuple(Sophus::SE2d{}, beluga::Weight{1.0}));
+  }
+  return particles;
+}
+
+TEST(ParticleHistoryLogger, WritesAppendedSnapshots) {
+  const auto base = std::filesystem::temp_directory_path() / "beluga_history_append.bin";
+  const auto segment = std::filesystem::path{base}.concat(".0");
+  std::filesystem::remove(segment);
+
+  const auto particles = make_particles();
+  {
+    beluga::ParticleHistoryLoggerParams params;
+    params.path = base;
+    beluga::ParticleHistoryLogger<Particle> logger{params};
+    logger.append(particles);
+    logger.append(particles);
+    logger.append(particles);
+    logger.flush();
+    ASSERT_EQ(logger.records_written(), 3UL);
+    ASSERT_EQ(logger.records_dropped(), 0UL);
+  }
+
+  ASSERT_TRUE(std::filesystem::exists(segment));
+  ASSERT_EQ(std::filesystem::file_size(segment), 3 * kRecordSize);
+
+  std::ifstream stream{segment, std::ios::binary};
+  std::uint64_t sequence = 42;
+  std::uint64_t particle_count = 0;
+  stream.read(reinterpret_cast<char*>(&sequence), sizeof(sequence));
+  stream.read(reinterpret_cast<char*>(&particle_count), sizeof(particle_count));
+  ASSERT_EQ(sequence, 0UL);
+  ASSERT_EQ(particle_count, kParticleCount);
+  std::filesystem::remove(segment);
+}
+
+TEST(ParticleHistoryLogger, RotatesSegmentsBoundingDiskUsage) {
+  const auto base = std::filesystem::temp_directory_path() / "beluga_history_rotate.bin";
+  const auto first_segment = std::filesystem::path{base}.concat(".0");
+  const auto second_segment = std::filesystem::path{base}.concat(".1");
+  std::filesystem::remove(first_segment);
+  std::filesystem::remove(second_segment);
+
+  const auto particles = make_particles();
+  {
+    beluga::ParticleHistoryLoggerParams params;
+    params.path = base;
+    params.max_segment_bytes = 2 * kRecordSize;
+    beluga::ParticleHistoryLogger<Particle> logger{params};
+    for (int i = 0; i < 5; ++i) {
+      logger.append(particles);
+    }
+    logger.flush();
+    ASSERT_EQ(logger.records_written(), 5UL);
+    // Two records per segment: the fifth record lands back on a truncated first segment.
+    ASSERT_EQ(logger.active_segment_path(), first_segment);
+  }
+
+  ASSERT_EQ(std::filesystem::file_size(first_segment), 1 * kRecordSize);
+  ASSERT_EQ(std::filesystem::file_size(second_segment), 2 * kRecordSize);
+  std::filesystem::remove(first_segment);
+  std::filesystem::remove(second_segment);
+}
+
+}  // namespace
@@ -0,0 +1,64 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "beluga/utility/shared_memory_region.hpp"
+
+namespace {
+
+TEST(SharedMemoryRegion, CreateAndOpenRoundTrip) {
+  auto owner = beluga::SharedMemoryRegion::create("/beluga_test_region", 64);
+  ASSERT_EQ(owner.size(), 64);
+  ASSERT_EQ(owner.name(), "/beluga_test_region");
+  std::memcpy(owner.data(), "hello", 6);
+  const auto reader = beluga::SharedMemoryRegion::open("/beluga_test_region");
+  ASSERT_EQ(reader.size(), 64);
+  ASSERT_STREQ(static_cast<const char*>(reader.data()), "hello");
+}
+
+TEST(SharedMemoryRegion, OpenMissingSegmentThrows) {
+  ASSERT_THROW(beluga::SharedMemoryRegion::open("/beluga_test_missing_region"), std::invalid_argument);
+}
+
+TEST(SharedMemoryRegion, OwnerUnlinksOnDestruction) {
+  {
+    const auto owner = beluga::SharedMemoryRegion::create("/beluga_test_unlinked_region", 16);
+  }
+  ASSERT_THROW(beluga::SharedMemoryRegion::open("/beluga_test_unlinked_region"), std::invalid_argument);
+}
+
+TEST(SharedMemoryRegion, AttachedMappingOutlivesOwner) {
+  auto owner = beluga::SharedMemoryRegion::create("/beluga_test_outliving_region", 16);
+  std::memcpy(owner.data(), "data", 5);
+  const auto reader = beluga::SharedMemoryRegion::open("/beluga_test_outliving_region");
+  {
+    const auto destroyed = std::move(owner);
+  }
+  ASSERT_STREQ(static_cast<const char*>(reader.data()), "data");
+}
+
+TEST(SharedMemoryRegion, MoveTransfersOwnership) {
+  auto owner = beluga::SharedMemoryRegion::create("/beluga_test_moved_region", 16);
+  const auto moved = std::move(owner);
+  ASSERT_EQ(moved.size(), 16);
+  ASSERT_EQ(moved.name(), "/beluga_test_moved_region");
+  ASSERT_NE(moved.data(), nullptr);
+}
+
+}  // namespace
@@ -0,0 +1,79 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "beluga/utility/simd_dispatch.hpp"
+
+namespace {
+
+int scalar_kernel(int value) {
+  return value;
+}
+
+int neon_kernel(int value) {
+  return value + 10;
+}
+
+int avx2_kernel(int value) {
+  return value + 20;
+}
+
+int avx512_kernel(int value) {
+  return value + 30;
+}
+
+TEST(SimdDispatch, DetectionIsStable) {
+  const auto isa = beluga::detected_simd_isa();
+  EXPECT_EQ(isa, beluga::detected_simd_isa());
+  EXPECT_EQ(isa, beluga::detect_simd_isa());
+}
+
+TEST(SimdDispatch, ScalarFallbackAlwaysResolves) {
+  const auto table = beluga::SimdDispatch<int(int)>{scalar_kernel};
+  EXPECT_EQ(table.resolve(beluga::SimdIsa::kScalar), scalar_kernel);
+  EXPECT_EQ(table.resolve(beluga::SimdIsa::kNeon), scalar_kernel);
+  EXPECT_EQ(table.resolve(beluga::SimdIsa::kAvx2), scalar_kernel);
+  EXPECT_EQ(table.resolve(beluga::SimdIsa::kAvx512), scalar_kernel);
+  EXPECT_EQ(table(5), 5);
+}
+
+TEST(SimdDispatch, ResolvesExactTier) {
+  const auto table = beluga::SimdDispatch<int(int)>{scalar_kernel}
+                         .with_variant(beluga::SimdIsa::kNeon, neon_kernel)
+                         .with_variant(beluga::SimdIsa::kAvx2, avx2_kernel)
+                         .with_variant(beluga::SimdIsa::kAvx512, avx512_kernel);
+  EXPECT_EQ(table.resolve(beluga::SimdIsa::kNeon), neon_kernel);
+  EXPECT_EQ(table.resolve(beluga::SimdIsa::kAvx2), avx2_kernel);
+  EXPECT_EQ(table.resolve(beluga::SimdIsa::kAvx512), avx512_kernel);
+}
+
+TEST(SimdDispatch, FallsBackWithinArchitecture) {
+  const auto table =
+      beluga::SimdDispatch<int(int)>{scalar_kernel}.with_variant(beluga::SimdIsa::kAvx2, avx2_kernel);
+  // An AVX-512 machine runs the AVX2 variant when no AVX-512 one is registered.
+  EXPECT_EQ(table.resolve(beluga::SimdIsa::kAvx512), avx2_kernel);
+  // NEON never falls back across architectures.
+  EXPECT_EQ(table.resolve(beluga::SimdIsa::kNeon), scalar_kernel);
+}
+
+TEST(SimdDispatch, SelectMatchesDetectedIsa) {
+  const auto table = beluga::SimdDispatch<int(int)>{scalar_kernel}
+                         .with_variant(beluga::SimdIsa::kNeon, neon_kernel)
+                         .with_variant(beluga::SimdIsa::kAvx2, avx2_kernel)
+                         .with_variant(beluga::SimdIsa::kAvx512, avx512_kernel);
+  EXPECT_EQ(table.select(), table.resolve(beluga::detected_simd_isa()));
+}
+
+}  // namespace
@@ -0,0 +1,107 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+#include "beluga/type_traits/executor_traits.hpp"
+#include "beluga/utility/thread_pool_executor.hpp"
+
+namespace {
+
+static_assert(beluga::is_bulk_executor_v<beluga::ThreadPoolExecutor>);
+static_assert(!beluga::is_bulk_executor_v<int>);
+static_assert(!beluga::is_bulk_executor_v<std::vector<int>>);
+
+TEST(ThreadPoolExecutor, ThreadCount) {
+  const auto executor = beluga::ThreadPoolExecutor{3};
+  ASSERT_EQ(executor.thread_count(), 3);
+}
+
+TEST(ThreadPoolExecutor, AtLeastOneThread) {
+  const auto executor = beluga::ThreadPoolExecutor{0};
+  ASSERT_EQ(executor.thread_count(), 1);
+}
+
+TEST(ThreadPoolExecutor, VisitsEveryElementOnce) {
+  const auto executor = beluga::ThreadPoolExecutor{4};
+  auto input = std::vector<int>(1000, 0);
+  executor.bulk_execute(input, [](int& value) { ++value; });
+  ASSERT_EQ(std::accumulate(input.begin(), input.end(), 0), 1000);
+}
+
+TEST(ThreadPoolExecutor, FewerElementsThanThreads) {
+  const auto executor = beluga::ThreadPoolExecutor{8};
+  auto input = std::vector<int>{1, 2, 3};
+  executor.bulk_execute(input, [](int& value) { value *= 2; });
+  ASSERT_EQ(input, (std::vector<int>{2, 4, 6}));
+}
+
+TEST(ThreadPoolExecutor, EmptyRange) {
+  const auto executor = beluga::ThreadPoolExecutor{2};
+  auto input = std::vector<int>{};
+  executor.bulk_execute(input, [](int&) { FAIL(); });
+}
+
+TEST(ThreadPoolExecutor, CopiesShareThePool) {
+  const auto executor = beluga::ThreadPoolExecutor{2};
+  const auto copy = executor;  // NOLINT(performance-unnecessary-copy-initialization)
+  auto count = std::atomic<int>{0};
+  auto input = std::vector<int>(100, 0);
+  copy.bulk_execute(input, [&count](int&) { ++count; });
+  ASSERT_EQ(count.load(), 100);
+}
+
+TEST(ThreadPoolExecutor, WorkStealingVisitsEveryElementOnce) {
+  const auto executor = beluga::ThreadPoolExecutor{4, beluga::ThreadPoolExecutor::Scheduling::kWorkStealing};
+  ASSERT_EQ(executor.scheduling(), beluga::ThreadPoolExecutor::Scheduling::kWorkStealing);
+  auto input = std::vector<int>(1000, 0);
+  executor.bulk_execute(input, [](int& value) { ++value; });
+  ASSERT_EQ(std::accumulate(input.begin(), input.end(), 0), 1000);
+}
+
+TEST(ThreadPoolExecutor, WorkStealingFewerElementsThanThreads) {
+  const auto executor = beluga::ThreadPoolExecutor{8, beluga::ThreadPoolExecutor::Scheduling::kWorkStealing};
+  auto input = std::vector<int>{1, 2, 3};
+  executor.bulk_execute(input, [](int& value) { value *= 2; });
+  ASSERT_EQ(input, (std::vector<int>{2, 4, 6}));
+}
+
+TEST(ThreadPoolExecutor, WorkStealingChunkIndicesArePerThreadSlots) {
+  const auto executor = beluga::ThreadPoolExecutor{3, beluga::ThreadPoolExecutor::Scheduling::kWorkStealing};
+  auto input = std::vector<int>(1000, 0);
+  // Chunk invocations sharing a slot index never run concurrently, so plain slots suffice.
+  auto counts = std::array<int, 3>{};
+  executor.bulk_execute_chunks(input, [&counts](auto first, auto last, std::size_t index) {
+    EXPECT_LT(index, 3U);
+    counts[index] += static_cast<int>(std::distance(first, last));
+  });
+  ASSERT_EQ(counts[0] + counts[1] + counts[2], 1000);
+}
+
+TEST(ThreadPoolExecutor, ReusableAcrossCalls) {
+  const auto executor = beluga::ThreadPoolExecutor{2};
+  auto input = std::vector<int>(10, 0);
+  for (int i = 0; i < 5; ++i) {
+    executor.bulk_execute(input, [](int& value) { ++value; });
+  }
+  ASSERT_EQ(std::accumulate(input.begin(), input.end(), 0), 50);
+}
+
+}  // namespace
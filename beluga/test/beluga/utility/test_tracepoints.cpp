@@ -0,0 +1,40 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+#include "beluga/utility/tracepoints.hpp"
+
+namespace {
+
+TEST(Tracepoints, CompileToValidStatements) {
+  // The macros must expand to valid statements in every arity,
+  // whether or not tracepoint support is compiled in.
+  const std::size_t count = 100;
+  const std::size_t buckets = 10;
+  BELUGA_TRACEPOINT(test_probe);
+  BELUGA_TRACEPOINT1(test_probe_one, count);
+  BELUGA_TRACEPOINT2(test_probe_two, count, buckets);
+}
+
+TEST(Tracepoints, UsableInExpressionContexts) {
+  const bool condition = true;
+  if (condition) {
+    BELUGA_TRACEPOINT(test_branch_probe);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,106 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/take_exactly.hpp>
+
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/cluster_stratified_sample.hpp"
+
+namespace {
+
+TEST(ClusterStratifiedSampleView, StratifiedWeightsFloorMinorityCluster) {
+  const auto weights = std::vector{0.8, 0.1, 0.05, 0.05};
+  const auto clusters = std::vector<std::size_t>{0, 0, 1, 1};
+  const auto stratified = beluga::views::detail::stratify_cluster_weights(weights, clusters, 0.25);
+  const double total = std::accumulate(stratified.begin(), stratified.end(), 0.0);
+  ASSERT_NEAR(total, 1.0, 1e-12);  // the total weight is preserved
+  ASSERT_NEAR(stratified[2] + stratified[3], 0.25, 1e-12);  // the minority cluster meets the floor exactly
+  ASSERT_NEAR(stratified[0] / stratified[1], 8.0, 1e-9);    // relative weights within a cluster are preserved
+  ASSERT_NEAR(stratified[2], stratified[3], 1e-12);
+}
+
+TEST(ClusterStratifiedSampleView, StratifiedWeightsAboveFloorUnchanged) {
+  const auto weights = std::vector{0.6, 0.4};
+  const auto clusters = std::vector<std::size_t>{0, 1};
+  const auto stratified = beluga::views::detail::stratify_cluster_weights(weights, clusters, 0.25);
+  ASSERT_EQ(stratified, weights);
+}
+
+TEST(ClusterStratifiedSampleView, StratifiedWeightsClampedToUniformShare) {
+  // A floor above the uniform share is infeasible; expect an even split across clusters.
+  const auto weights = std::vector{0.7, 0.2, 0.1};
+  const auto clusters = std::vector<std::size_t>{0, 1, 2};
+  const auto stratified = beluga::views::detail::stratify_cluster_weights(weights, clusters, 0.9);
+  ASSERT_NEAR(stratified[0], stratified[1], 1e-12);
+  ASSERT_NEAR(stratified[1], stratified[2], 1e-12);
+}
+
+TEST(ClusterStratifiedSampleView, StratifiedWeightsZeroWeightClusterKeepsZero) {
+  const auto weights = std::vector{0.9, 0.1, 0.0};
+  const auto clusters = std::vector<std::size_t>{0, 1, 2};
+  const auto stratified = beluga::views::detail::stratify_cluster_weights(weights, clusters, 0.3);
+  ASSERT_EQ(stratified[2], 0.0);
+  ASSERT_NEAR(stratified[1] / std::accumulate(stratified.begin(), stratified.end(), 0.0), 0.3, 1e-12);
+}
+
+TEST(ClusterStratifiedSampleView, MinorityClusterSurvivalShare) {
+  const auto size = 100'000;
+
+  // Without stratification the second mode would receive ~10% of the survivors.
+  const auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{
+      std::make_tuple(1, beluga::Weight(0.8)),  //
+      std::make_tuple(2, beluga::Weight(0.1)),  //
+      std::make_tuple(3, beluga::Weight(0.06)),  //
+      std::make_tuple(4, beluga::Weight(0.04))};
+  const auto clusters = std::vector<std::size_t>{0, 0, 1, 1};
+
+  auto engine = std::mt19937{42};
+  auto output = beluga::views::cluster_stratified_sample(input, clusters, 0.25, engine) |  //
+                ranges::views::take_exactly(size);
+
+  std::unordered_map<int, std::size_t> buckets;
+  for (auto [value, weight] : output) {
+    ++buckets[value];
+    ASSERT_EQ(weight, 1.0);  // resampled particles come out with unit weight
+  }
+
+  const auto share = [&buckets, size](int value) { return static_cast<double>(buckets[value]) / size; };
+  ASSERT_NEAR(share(3) + share(4), 0.25, 0.01);  // the minority cluster meets the floor
+  ASSERT_NEAR(share(1) / share(2), 8.0, 0.5);    // proportions within the majority cluster are kept
+}
+
+TEST(ClusterStratifiedSampleView, Composition) {
+  const auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{
+      std::make_tuple(1, beluga::Weight(0.9)),  //
+      std::make_tuple(2, beluga::Weight(0.1))};
+  const auto clusters = std::vector<std::size_t>{0, 1};
+  const auto output = input |                                                        //
+                      beluga::views::cluster_stratified_sample(clusters, 0.25) |     //
+                      ranges::views::take_exactly(20) |                              //
+                      ranges::to<std::vector>;
+  ASSERT_EQ(output.size(), 20);
+}
+
+}  // namespace
@@ -0,0 +1,87 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/take_exactly.hpp>
+
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/low_variance_sample.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(LowVarianceSampleView, ConceptChecks) {
+  auto input = std::array{1, 2, 3, 4, 5};
+  auto output = beluga::views::systematic_sample(input);
+  static_assert(ranges::viewable_range<decltype(output)>);
+  static_assert(ranges::input_range<decltype(output)>);
+  static_assert(!ranges::sized_range<decltype(output)>);
+}
+
+TEST(LowVarianceSampleView, DominantWeightTakesAll) {
+  auto input = std::array{1, 2, 3, 4};
+  auto weights = std::array{0.0, 1.0, 0.0, 0.0};
+  auto engine = std::mt19937{42};
+  auto output = beluga::views::systematic_sample(input, weights, engine) |  //
+                ranges::views::take_exactly(20) |                           //
+                ranges::to<std::vector>;
+  ASSERT_EQ(output.size(), 20U);
+  ASSERT_EQ(static_cast<std::size_t>(ranges::count(output, 2)), 20U);
+}
+
+TEST(LowVarianceSampleView, UniformWeightsCoverPopulationEachSweep) {
+  auto input = std::array{1, 2, 3, 4, 5};
+  auto engine = std::mt19937{42};
+  auto output = beluga::views::systematic_sample(input, engine) |  //
+                ranges::views::take_exactly(5) |                   //
+                ranges::to<std::vector>;
+  for (const int value : input) {
+    ASSERT_EQ(ranges::count(output, value), 1);
+  }
+}
+
+TEST(LowVarianceSampleView, StratifiedProportions) {
+  auto input = std::array{1, 2};
+  auto weights = std::array{0.25, 0.75};
+  auto engine = std::mt19937{42};
+  auto output = beluga::views::stratified_sample(input, weights, engine) |  //
+                ranges::views::take_exactly(4000) |                         //
+                ranges::to<std::vector>;
+  const auto ones = static_cast<double>(ranges::count(output, 1));
+  ASSERT_NEAR(ones / 4000.0, 0.25, 0.05);
+}
+
+TEST(LowVarianceSampleView, FromParticleRange) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{{1, 0.0}, {2, 1.0}, {3, 0.0}};
+  auto output = input |                              //
+                beluga::views::systematic_sample |   //
+                ranges::views::take_exactly(10) |    //
+                ranges::to<beluga::TupleVector>;
+  ASSERT_EQ(output.size(), 10U);
+  for (auto&& [state, weight] : output) {
+    ASSERT_EQ(state, 2);
+    ASSERT_EQ(weight, 1.0);
+  }
+}
+
+}  // namespace
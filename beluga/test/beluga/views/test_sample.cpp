@@ -16,6 +16,8 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
+#include <random>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -102,6 +104,18 @@ TEST(SampleView, DiscreteDistributionWeightZero) {
   ASSERT_EQ(ranges::count(output, 5), 20);
 }
 
+TEST(SampleView, BorrowedDistribution) {
+  auto engine = std::mt19937{42};
+  auto input = std::array{42, 5};
+  auto distribution = std::discrete_distribution<std::ptrdiff_t>{{0.0, 1.0}};
+  auto output = beluga::views::sample(input, std::ref(distribution), engine) | ranges::views::take_exactly(20);
+  ASSERT_EQ(ranges::count(output, 5), 20);
+  // Rebuilding the caller-owned distribution in place is reflected by later views.
+  distribution = std::discrete_distribution<std::ptrdiff_t>{{1.0, 0.0}};
+  auto other = beluga::views::sample(input, std::ref(distribution), engine) | ranges::views::take_exactly(20);
+  ASSERT_EQ(ranges::count(other, 42), 20);
+}
+
 TEST(SampleView, DoubleDereference) {
   auto engine = std::mt19937{std::random_device()()};
   auto input = std::array{10, 42, 39, 20, 50};
@@ -174,4 +188,22 @@ TEST(SampleView, FromRandomDistributionTrue) {
   ASSERT_EQ(ranges::count(output, true), 10);
 }
 
+TEST(SampleView, FromLogWeightParticleRange) {
+  // All log-weights are far below linear-domain representability; only their
+  // differences matter, and the second particle dominates overwhelmingly.
+  auto input = beluga::TupleVector<std::tuple<int, beluga::LogWeight>>{
+      {1, -2000.0},  //
+      {2, -1900.0},  //
+      {3, -2000.0}};
+  auto output = input |                            //
+                beluga::views::sample |            //
+                ranges::views::take_exactly(20) |  //
+                ranges::to<beluga::TupleVector>;
+  ASSERT_EQ(output.size(), 20);
+  for (auto&& [state, log_weight] : output) {
+    ASSERT_EQ(state, 2);
+    ASSERT_EQ(log_weight, 0.0);
+  }
+}
+
 }  // namespace
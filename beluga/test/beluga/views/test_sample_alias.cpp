@@ -0,0 +1,89 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/take_exactly.hpp>
+
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/random/discrete_alias_distribution.hpp"
+#include "beluga/views/sample_alias.hpp"
+
+namespace {
+
+TEST(DiscreteAliasDistribution, DefaultConstructed) {
+  auto distribution = beluga::DiscreteAliasDistribution<int>{};
+  auto engine = std::mt19937{42};
+  ASSERT_EQ(distribution.min(), 0);
+  ASSERT_EQ(distribution.max(), 0);
+  ASSERT_EQ(distribution(engine), 0);
+}
+
+TEST(DiscreteAliasDistribution, MatchesWeightProportions) {
+  auto weights = std::array{1.0, 3.0, 6.0};
+  auto distribution = beluga::DiscreteAliasDistribution<std::size_t>{weights};
+  auto engine = std::mt19937{42};
+  auto counts = std::array<std::size_t, 3>{};
+  constexpr std::size_t kSamples = 100'000;
+  for (std::size_t i = 0; i < kSamples; ++i) {
+    ++counts[distribution(engine)];
+  }
+  ASSERT_NEAR(static_cast<double>(counts[0]) / kSamples, 0.1, 0.01);
+  ASSERT_NEAR(static_cast<double>(counts[1]) / kSamples, 0.3, 0.01);
+  ASSERT_NEAR(static_cast<double>(counts[2]) / kSamples, 0.6, 0.01);
+}
+
+TEST(DiscreteAliasDistribution, AssignRebuildsInPlace) {
+  auto distribution = beluga::DiscreteAliasDistribution<std::size_t>{std::array{1.0, 1.0, 1.0, 1.0}};
+  ASSERT_EQ(distribution.max(), 3U);
+  distribution.assign(std::array{0.0, 0.0, 1.0});
+  ASSERT_EQ(distribution.max(), 2U);
+  auto engine = std::mt19937{42};
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(distribution(engine), 2U);
+  }
+}
+
+TEST(SampleAliasView, DominantWeightTakesAll) {
+  auto input = std::array{1, 2, 3, 4};
+  auto weights = std::array{0.0, 1.0, 0.0, 0.0};
+  auto engine = std::mt19937{42};
+  auto output = beluga::views::sample_alias(input, weights, engine) |  //
+                ranges::views::take_exactly(50) |                      //
+                ranges::to<std::vector>;
+  ASSERT_EQ(static_cast<std::size_t>(ranges::count(output, 2)), 50U);
+}
+
+TEST(SampleAliasView, FromParticleRange) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{{1, 0.0}, {2, 1.0}, {3, 0.0}};
+  auto output = input |                            //
+                beluga::views::sample_alias |      //
+                ranges::views::take_exactly(10) |  //
+                ranges::to<beluga::TupleVector>;
+  ASSERT_EQ(output.size(), 10U);
+  for (auto&& [state, weight] : output) {
+    ASSERT_EQ(state, 2);
+    ASSERT_EQ(weight, 1.0);
+  }
+}
+
+}  // namespace
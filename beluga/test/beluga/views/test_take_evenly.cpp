@@ -161,6 +161,17 @@ TEST(TakeEvenlyView, RandomAccess) {
   ASSERT_EQ(output[2], 9);
 }
 
+TEST(TakeEvenlyView, SentinelDistanceWhenCountExceedsSize) {
+  const auto input = std::vector<int>{1, 2, 3, 4};
+  auto output = input | beluga::views::take_evenly(10);
+  ASSERT_EQ(output.size(), 4);
+  ASSERT_EQ(ranges::distance(output), 4);
+  auto it = ranges::begin(output);
+  it += 3;
+  ASSERT_EQ(*it, 4);
+  ASSERT_EQ(ranges::end(output) - it, 1);
+}
+
 TEST(TakeEvenlyView, RandomAccessReverse) {
   const auto input = std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9};
   auto output = input | beluga::views::take_evenly(3) | ranges::views::reverse;
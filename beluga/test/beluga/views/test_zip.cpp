@@ -0,0 +1,76 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <list>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/view/filter.hpp>
+
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/views/assert_partitionable.hpp"
+#include "beluga/views/zip.hpp"
+
+namespace {
+
+TEST(ZipView, PartitionableOverTupleVectorColumns) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}, {3, 3.0}};
+  auto zipped = beluga::views::zip(container.column<0>(), container.column<1>());
+
+  // Contiguous columns zip into a range parallel stages can partition: random
+  // access, sized, and with O(1) iterator difference.
+  static_assert(beluga::views::is_partitionable_range_v<decltype(zipped)>);
+  static_assert(ranges::random_access_range<decltype(zipped)>);
+  static_assert(ranges::sized_range<decltype(zipped)>);
+  static_assert(ranges::sized_sentinel_for<ranges::iterator_t<decltype(zipped)>, ranges::iterator_t<decltype(zipped)>>);
+
+  ASSERT_EQ(ranges::size(zipped), 3);
+  EXPECT_EQ(zipped.end() - zipped.begin(), 3);
+  EXPECT_EQ(std::get<1>(zipped.begin()[2]), 3.0);
+}
+
+TEST(ZipView, PartitionableOverVectors) {
+  auto states = std::vector<int>{1, 2, 3};
+  auto weights = std::vector<double>{1.0, 2.0, 3.0};
+  auto zipped = beluga::views::zip(states, weights);
+  static_assert(beluga::views::is_partitionable_range_v<decltype(zipped)>);
+  std::get<1>(*zipped.begin()) = 5.0;
+  EXPECT_EQ(weights.front(), 5.0);
+}
+
+TEST(ZipView, FilteredCompositionIsNotPartitionable) {
+  // A filter downgrades the category; the trait reports it so pipelines can
+  // diagnose the loss instead of serializing a parallel stage quietly.
+  auto states = std::vector<int>{1, 2, 3};
+  auto filtered = states | ranges::views::filter([](int value) { return value > 1; });
+  static_assert(!beluga::views::is_partitionable_range_v<decltype(filtered)>);
+  const auto not_partitionable = std::list<int>{1, 2, 3};
+  static_assert(!beluga::views::is_partitionable_range_v<decltype(not_partitionable)>);
+}
+
+TEST(AssertPartitionableView, PassesRangeThroughUnchanged) {
+  auto container = beluga::TupleVector<std::tuple<int, double>>{{1, 1.0}, {2, 2.0}};
+  auto checked = container | beluga::views::assert_partitionable;
+  static_assert(beluga::views::is_partitionable_range_v<decltype(checked)>);
+  ASSERT_EQ(ranges::size(checked), 2);
+  EXPECT_EQ(std::get<0>(*checked.begin()), 1);
+  auto checked_column = container.column<1>() | beluga::views::assert_partitionable;
+  EXPECT_EQ(checked_column[1], 2.0);
+}
+
+}  // namespace
@@ -0,0 +1,138 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <sophus/common.hpp>
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/algorithm/amcl_core.hpp"
+#include "beluga/algorithm/spatial_hash.hpp"
+#include "beluga/motion/differential_drive_model.hpp"
+#include "beluga/sensor/likelihood_field_model.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+#include "perf_event_counters.hpp"
+
+namespace {
+
+// End-to-end benchmark of the full beluga::Amcl::update loop (propagate, reweight,
+// normalize, resample) over the stock differential drive plus likelihood field
+// configuration, meant to catch pipeline-level regressions that the stage-focused
+// benchmarks in this directory cannot see.
+
+constexpr std::size_t kGridSize = 64;
+constexpr double kGridResolution = 0.5;
+
+auto make_synthetic_grid() {
+  auto array = std::array<bool, kGridSize * kGridSize>{};
+  // Walls around the border and a sparse lattice of interior obstacles.
+  for (std::size_t i = 0; i < kGridSize; ++i) {
+    array[i] = true;
+    array[(kGridSize - 1) * kGridSize + i] = true;
+    array[i * kGridSize] = true;
+    array[i * kGridSize + kGridSize - 1] = true;
+  }
+  for (std::size_t row = 16; row < kGridSize - 16; row += 8) {
+    for (std::size_t col = 16; col < kGridSize - 16; col += 8) {
+      array[row * kGridSize + col] = true;
+    }
+  }
+  return beluga::testing::StaticOccupancyGrid<kGridSize, kGridSize>{array, kGridResolution};
+}
+
+auto make_scripted_trajectory() {
+  // A loop around the middle of the map, with steps large enough to
+  // trip the update policy on every single iteration.
+  constexpr std::size_t kSteps = 64;
+  constexpr double kRadius = 8.0;
+  const double center = static_cast<double>(kGridSize) * kGridResolution / 2.0;
+  auto trajectory = std::vector<Sophus::SE2d>{};
+  trajectory.reserve(kSteps);
+  for (std::size_t i = 0; i < kSteps; ++i) {
+    const double angle = 2.0 * Sophus::Constants<double>::pi() * static_cast<double>(i) / kSteps;
+    trajectory.emplace_back(
+        Sophus::SO2d{angle}, Eigen::Vector2d{center + kRadius * std::cos(angle), center + kRadius * std::sin(angle)});
+  }
+  return trajectory;
+}
+
+auto make_synthetic_scan() {
+  constexpr std::size_t kNumBeams = 100;
+  auto scan = std::vector<std::pair<double, double>>{};
+  scan.reserve(kNumBeams);
+  for (std::size_t i = 0; i < kNumBeams; ++i) {
+    const double bearing = 2.0 * Sophus::Constants<double>::pi() * static_cast<double>(i) / kNumBeams;
+    const double range = 4.0 + 2.0 * std::cos(3.0 * bearing);
+    scan.emplace_back(range * std::cos(bearing), range * std::sin(bearing));
+  }
+  return scan;
+}
+
+template <class ExecutionPolicy>
+void run_amcl_update(benchmark::State& state, ExecutionPolicy execution_policy) {
+  const auto num_particles = static_cast<std::size_t>(state.range(0));
+
+  auto params = beluga::AmclParams{};
+  params.update_min_d = 0.01;
+  params.update_min_a = 0.01;
+  params.min_particles = num_particles;
+  params.max_particles = num_particles;
+
+  auto amcl = beluga::Amcl{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},             //
+      beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, make_synthetic_grid()},  //
+      []() { return Sophus::SE2d{}; },
+      beluga::spatial_hash<Sophus::SE2d>{0.5, 0.5, 0.2},
+      params,
+      execution_policy,
+  };
+
+  const auto trajectory = make_scripted_trajectory();
+  const auto scan = make_synthetic_scan();
+
+  amcl.initialize(trajectory.front(), Eigen::Vector3d{0.5, 0.5, 0.1}.asDiagonal());
+
+  std::size_t step = 0;
+  for (auto _ : state) {
+    amcl.update(trajectory[step++ % trajectory.size()], scan);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_particles));
+}
+
+void BM_AmclUpdate_Seq(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  run_amcl_update(state, std::execution::seq);
+}
+
+void BM_AmclUpdate_Par(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  run_amcl_update(state, std::execution::par);
+}
+
+BENCHMARK(BM_AmclUpdate_Seq)->RangeMultiplier(8)->Range(1'000, 200'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AmclUpdate_Par)->RangeMultiplier(8)->Range(1'000, 200'000)->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,158 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/algorithm/cluster_based_estimation.hpp"
+#include "beluga/algorithm/spatial_hash.hpp"
+
+#include "perf_event_counters.hpp"
+
+namespace {
+
+// Particle states drawn around one or more hypothesis poses 5 meters apart, with
+// normalized weights. One mode approximates a converged filter, while many modes
+// approximate an ambiguous population right after a global relocalization, which
+// is where cluster-based estimation earns its keep (and its cost).
+auto make_particles(std::size_t count, std::size_t num_modes) {
+  auto generator = std::mt19937{42};
+  auto position_noise = std::normal_distribution<double>{0.0, 0.25};
+  auto angle_noise = std::normal_distribution<double>{0.0, 0.1};
+  auto weight_noise = std::uniform_real_distribution<double>{0.5, 1.5};
+
+  auto states = std::vector<Sophus::SE2d>{};
+  auto weights = std::vector<double>{};
+  states.reserve(count);
+  weights.reserve(count);
+
+  double total_weight = 0.0;
+  for (std::size_t i = 0; i < count; ++i) {
+    const double mode_offset = static_cast<double>(i % num_modes) * 5.0;
+    states.emplace_back(
+        Sophus::SO2d{angle_noise(generator)},
+        Eigen::Vector2d{mode_offset + position_noise(generator), position_noise(generator)});
+    weights.push_back(weight_noise(generator));
+    total_weight += weights.back();
+  }
+  for (auto& weight : weights) {
+    weight /= total_weight;
+  }
+  return std::make_pair(std::move(states), std::move(weights));
+}
+
+void BM_ClusterBasedEstimator_EndToEnd(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto num_modes = static_cast<std::size_t>(state.range(1));
+  const auto [states, weights] = make_particles(count, num_modes);
+  auto estimator = beluga::ClusterBasedEstimator{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(estimator(states, weights));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+// Same pipeline as beluga::ClusterBasedEstimator, unrolled into its phases so that
+// each one can be timed separately. Reported counters are nanoseconds per iteration:
+// - hashing_ns: per-particle spatial hash computation;
+// - grouping_ns: grouping hashed particles into cells, including weight capping;
+// - growth_ns: growing clusters around local peaks and mapping particles to them;
+// - statistics_ns: per-cluster mean and covariance estimation.
+void BM_ClusterBasedEstimate_Phases(benchmark::State& state) {
+  using std::chrono::nanoseconds;
+  using std::chrono::steady_clock;
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto num_modes = static_cast<std::size_t>(state.range(1));
+  const auto [states, weights] = make_particles(count, num_modes);
+
+  const auto parameters = beluga::ParticleClusterizerParam{};
+  auto clusterizer = beluga::ParticleClusterizer{parameters};
+  const auto spatial_hash_function = beluga::spatial_hash<Sophus::SE2d>{
+      parameters.linear_hash_resolution,   // x
+      parameters.linear_hash_resolution,   // y
+      parameters.angular_hash_resolution,  // theta
+  };
+
+  auto hashes = std::vector<std::size_t>{};
+  auto clusters = std::vector<std::size_t>{};
+  auto cells = beluga::clusterizer_detail::ClusterCellArray<Sophus::SE2d>{};
+  auto scratch = beluga::clusterizer_detail::ClusterizerScratch{};
+
+  auto hashing_time = nanoseconds{0};
+  auto grouping_time = nanoseconds{0};
+  auto growth_time = nanoseconds{0};
+  auto statistics_time = nanoseconds{0};
+
+  for (auto _ : state) {
+    const auto hashing_start = steady_clock::now();
+    hashes.clear();
+    for (const auto& particle_state : states) {
+      hashes.push_back(spatial_hash_function(particle_state));
+    }
+
+    const auto grouping_start = steady_clock::now();
+    beluga::clusterizer_detail::populate_cluster_cell_array(states, weights, hashes, cells, scratch);
+    beluga::clusterizer_detail::normalize_and_cap_weights(cells, parameters.weight_cap_percentile, scratch);
+
+    const auto growth_start = steady_clock::now();
+    beluga::clusterizer_detail::assign_clusters(
+        cells, [&clusterizer](const auto& cell_state) { return clusterizer.neighbors(cell_state); }, scratch);
+    clusters.clear();
+    for (const std::size_t hash : hashes) {
+      const auto it = std::lower_bound(cells.hashes.begin(), cells.hashes.end(), hash);
+      clusters.push_back(cells.cluster_ids[static_cast<std::size_t>(std::distance(cells.hashes.begin(), it))]);
+    }
+
+    const auto statistics_start = steady_clock::now();
+    benchmark::DoNotOptimize(beluga::estimate_clusters(states, weights, clusters));
+    const auto statistics_stop = steady_clock::now();
+
+    hashing_time += grouping_start - hashing_start;
+    grouping_time += growth_start - grouping_start;
+    growth_time += statistics_start - growth_start;
+    statistics_time += statistics_stop - statistics_start;
+  }
+
+  state.counters["hashing_ns"] =
+      benchmark::Counter(static_cast<double>(hashing_time.count()), benchmark::Counter::kAvgIterations);
+  state.counters["grouping_ns"] =
+      benchmark::Counter(static_cast<double>(grouping_time.count()), benchmark::Counter::kAvgIterations);
+  state.counters["growth_ns"] =
+      benchmark::Counter(static_cast<double>(growth_time.count()), benchmark::Counter::kAvgIterations);
+  state.counters["statistics_ns"] =
+      benchmark::Counter(static_cast<double>(statistics_time.count()), benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK(BM_ClusterBasedEstimator_EndToEnd)
+    ->ArgsProduct({{10'000, 100'000, 500'000}, {1, 4, 16}})
+    ->ArgNames({"particles", "modes"});
+BENCHMARK(BM_ClusterBasedEstimate_Phases)
+    ->ArgsProduct({{10'000, 100'000, 500'000}, {1, 4, 16}})
+    ->ArgNames({"particles", "modes"});
+
+}  // namespace
@@ -0,0 +1,99 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/algorithm/cluster_based_estimation.hpp"
+#include "beluga/algorithm/estimation.hpp"
+
+#include "perf_event_counters.hpp"
+
+namespace {
+
+// Particle states drawn around one or more hypothesis poses 5 meters apart, with
+// normalized weights, approximating converged (unimodal) and ambiguous (multimodal)
+// filter populations.
+auto make_particles(std::size_t count, std::size_t num_modes) {
+  auto generator = std::mt19937{42};
+  auto position_noise = std::normal_distribution<double>{0.0, 0.25};
+  auto angle_noise = std::normal_distribution<double>{0.0, 0.1};
+  auto weight_noise = std::uniform_real_distribution<double>{0.5, 1.5};
+
+  auto states = std::vector<Sophus::SE2d>{};
+  auto weights = std::vector<double>{};
+  states.reserve(count);
+  weights.reserve(count);
+
+  double total_weight = 0.0;
+  for (std::size_t i = 0; i < count; ++i) {
+    const double mode_offset = static_cast<double>(i % num_modes) * 5.0;
+    states.emplace_back(
+        Sophus::SO2d{angle_noise(generator)},
+        Eigen::Vector2d{mode_offset + position_noise(generator), position_noise(generator)});
+    weights.push_back(weight_noise(generator));
+    total_weight += weights.back();
+  }
+  for (auto& weight : weights) {
+    weight /= total_weight;
+  }
+  return std::make_pair(std::move(states), std::move(weights));
+}
+
+void BM_Estimate(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto [states, weights] = make_particles(count, 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(beluga::estimate(states, weights));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+void BM_ClusterBasedEstimate(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto [states, weights] = make_particles(count, 2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(beluga::cluster_based_estimate(states, weights));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+void BM_ClusterBasedEstimator_Reused(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto [states, weights] = make_particles(count, 2);
+  auto estimator = beluga::ClusterBasedEstimator{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(estimator(states, weights));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK(BM_Estimate)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_ClusterBasedEstimate)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_ClusterBasedEstimator_Reused)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+}  // namespace
@@ -23,11 +23,14 @@
 #include <sophus/se2.hpp>
 #include <sophus/so2.hpp>
 
+#include "perf_event_counters.hpp"
+
 namespace {
 
 constexpr std::size_t kNumParticles = 2'000;
 
 void BM_PointTransform_Baseline(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   const auto count = state.range(0);
   state.SetComplexityN(count);
   auto size = static_cast<size_t>(count);
@@ -51,6 +54,7 @@ void BM_PointTransform_Baseline(benchmark::State& state) {
 }
 
 void BM_PointTransform_EigenSophus(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   const auto count = state.range(0);
   state.SetComplexityN(count);
   auto size = static_cast<size_t>(count);
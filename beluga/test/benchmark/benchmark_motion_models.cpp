@@ -0,0 +1,106 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/motion/differential_drive_model.hpp"
+#include "beluga/motion/omnidirectional_drive_model.hpp"
+
+#include "perf_event_counters.hpp"
+
+namespace {
+
+// Particle states scattered around the origin, standing in for a filter population
+// about to be propagated through a motion model.
+auto make_states(std::size_t count) {
+  auto generator = std::mt19937{42};
+  auto position_noise = std::normal_distribution<double>{0.0, 1.0};
+  auto angle_noise = std::normal_distribution<double>{0.0, 0.5};
+  auto states = std::vector<Sophus::SE2d>{};
+  states.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    states.emplace_back(
+        Sophus::SO2d{angle_noise(generator)}, Eigen::Vector2d{position_noise(generator), position_noise(generator)});
+  }
+  return states;
+}
+
+// A forward step with a slight turn, enough to put every noise term in play.
+auto make_control_action() {
+  return std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.05}, Eigen::Vector2d{0.1, 0.0}}, Sophus::SE2d{});
+}
+
+void BM_DifferentialDriveModel_Propagate(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto model = beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}};
+  const auto sample = model(make_control_action());
+  auto states = make_states(count);
+  auto generator = std::mt19937{1234};
+  for (auto _ : state) {
+    // Batch overload, as picked up by beluga::actions::propagate.
+    sample(states, generator);
+    benchmark::DoNotOptimize(states.front());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+void BM_DifferentialDriveModel_SamplePerState(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto model = beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}};
+  const auto sample = model(make_control_action());
+  auto states = make_states(count);
+  auto generator = std::mt19937{1234};
+  for (auto _ : state) {
+    for (auto& particle_state : states) {
+      particle_state = sample(particle_state, generator);
+    }
+    benchmark::DoNotOptimize(states.front());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+void BM_OmnidirectionalDriveModel_SamplePerState(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto model = beluga::OmnidirectionalDriveModel{beluga::OmnidirectionalDriveModelParam{}};
+  const auto sample = model(make_control_action());
+  auto states = make_states(count);
+  auto generator = std::mt19937{1234};
+  for (auto _ : state) {
+    for (auto& particle_state : states) {
+      particle_state = sample(particle_state, generator);
+    }
+    benchmark::DoNotOptimize(states.front());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK(BM_DifferentialDriveModel_Propagate)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_DifferentialDriveModel_SamplePerState)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_OmnidirectionalDriveModel_SamplePerState)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+}  // namespace
@@ -29,10 +29,14 @@
 #include "beluga/sensor/data/occupancy_grid.hpp"
 #include "beluga/test/raycasting.hpp"
 #include "beluga/test/static_occupancy_grid.hpp"
+#include "beluga/testing/synthetic_environment.hpp"
+
+#include "perf_event_counters.hpp"
 
 namespace {
 
 void BM_Bresenham2i(benchmark::State& state, beluga::Bresenham2i::Variant variant) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   const auto n = state.range(0);
   const auto algorithm = beluga::Bresenham2i{variant};
   for (auto _ : state) {
@@ -97,6 +101,7 @@ const auto kBearingLabels = std::array{
 
 template <template <std::size_t, std::size_t, class T = bool> class Grid>
 void BM_RayCasting2d_BaselineRaycast(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   constexpr double kMaxRange = 100.0;
   constexpr double kResolution = 0.05;
 
@@ -152,6 +157,7 @@ BENCHMARK_TEMPLATE(BM_RayCasting2d_BaselineRaycast, StaticOccupancyGrid)
 
 template <template <std::size_t, std::size_t, class T = bool> class Grid>
 void BM_RayCasting2d(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   constexpr double kMaxRange = 100.0;
   constexpr double kResolution = 0.05;
 
@@ -202,4 +208,41 @@ BENCHMARK_TEMPLATE(BM_RayCasting2d, StaticOccupancyGrid)
     ->Args({2, 1024})
     ->Complexity();
 
+using SyntheticGridGenerator = beluga::testing::SyntheticOccupancyGrid (*)(const beluga::testing::SyntheticGridParams&);
+
+void BM_RayCasting2d_SyntheticScan(benchmark::State& state, SyntheticGridGenerator generate) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto n = static_cast<std::size_t>(state.range(0));
+
+  auto grid_params = beluga::testing::SyntheticGridParams{};
+  grid_params.width = n;
+  grid_params.height = n;
+  const auto grid = generate(grid_params);
+
+  auto scan_params = beluga::testing::SyntheticScanParams{};
+  scan_params.max_range = static_cast<double>(n) * grid_params.resolution;
+  const auto center = static_cast<double>(n) * grid_params.resolution / 2.;
+  const auto source_pose = Sophus::SE2d{0., Eigen::Vector2d{center, center}};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(beluga::testing::simulate_scan(grid, source_pose, scan_params));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK_CAPTURE(BM_RayCasting2d_SyntheticScan, Corridor, beluga::testing::generate_corridor_grid)
+    ->RangeMultiplier(2)
+    ->Range(1024, 8192)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_RayCasting2d_SyntheticScan, Warehouse, beluga::testing::generate_warehouse_grid)
+    ->RangeMultiplier(2)
+    ->Range(1024, 8192)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_RayCasting2d_SyntheticScan, OpenField, beluga::testing::generate_open_field_grid)
+    ->RangeMultiplier(2)
+    ->Range(1024, 8192)
+    ->Complexity();
+
 }  // namespace
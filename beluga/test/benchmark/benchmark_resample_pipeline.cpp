@@ -0,0 +1,220 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/view/all.hpp>
+
+#include "beluga/actions/assign.hpp"
+#include "beluga/algorithm/spatial_hash.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+#include "beluga/views/random_intersperse.hpp"
+#include "beluga/views/sample.hpp"
+#include "beluga/views/take_while_kld.hpp"
+
+#include "perf_event_counters.hpp"
+
+// The production resample path in `Amcl::update` is the composition
+// `views::sample | random_intersperse | take_while_kld` drained into a particle
+// container, where inter-stage effects (RNG pressure, bucket hashing, iterator
+// layering, allocation churn in the drain) dominate over any stage in isolation.
+// `benchmark_take_while_kld.cpp` measures the limiter alone; the benchmarks here
+// measure the whole composition over realistic weight distributions, plus one
+// benchmark per stage so regressions in the composite can be attributed to
+// sampling RNG, bucket hashing, or the container copy.
+
+namespace {
+
+struct State {
+  double x = 0.;
+  double y = 0.;
+  double theta = 0.;
+};
+
+}  // namespace
+
+template <>
+struct beluga::spatial_hash<State> {
+  std::size_t operator()(const State& state) const {
+    const auto tuple = std::make_tuple(state.x, state.y);
+    return beluga::spatial_hash<std::decay_t<decltype(tuple)>>{std::array{1., 1.}}(tuple);
+  }
+};
+
+namespace {
+
+using Container = beluga::TupleVector<std::tuple<State, beluga::Weight>>;
+using Particle = typename Container::value_type;
+
+constexpr double kRandomStateProbability = 0.05;
+constexpr double kKldEpsilon = 0.05;
+constexpr double kKldZ = 3.;
+
+/// Fills states over a spread of KLD buckets and weights following the requested profile.
+/**
+ * The uniform profile models a freshly resampled filter; the peaked profile models a
+ * converged one, where roughly 1% of the particles carry almost all of the weight and
+ * sampling keeps revisiting the same alias table entries.
+ */
+void fill_container(Container& container, bool peaked_weights) {
+  double step = 0;
+  int i = 0;
+  for (auto&& [state, weight] : container) {
+    state.x = step;
+    weight = peaked_weights ? (i % 100 == 0 ? 99.0 : 0.01) : 1.0;
+    if (i++ % 2 == 0) {
+      step += 0.05;
+    }
+  }
+}
+
+[[nodiscard]] auto make_random_state_generator() {
+  return [i = 0]() mutable {
+    i = (i + 1) % 1000;
+    return Particle{State{static_cast<double>(i) * 0.05, 0., 0.}, beluga::Weight(1.)};
+  };
+}
+
+void BM_ResamplePipeline(benchmark::State& state, bool peaked_weights) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto particle_count = state.range(0);
+  state.SetComplexityN(particle_count);
+  const auto container_size = static_cast<std::size_t>(particle_count);
+
+  auto container = Container{container_size};
+  auto scratch = Container{container_size};
+  fill_container(container, peaked_weights);
+
+  for (auto _ : state) {
+    // Same composition `Amcl::update` drains into its scratch particle set.
+    scratch.assign_range(
+        container |                                                                            //
+        beluga::views::sample |                                                                //
+        beluga::views::random_intersperse(make_random_state_generator(), kRandomStateProbability) |
+        beluga::views::take_while_kld(beluga::spatial_hash<State>{}, 0, container_size, kKldEpsilon, kKldZ));
+    state.counters["SampleSize"] = static_cast<double>(scratch.size());
+  }
+}
+
+BENCHMARK_CAPTURE(BM_ResamplePipeline, UniformWeights, false)
+    ->RangeMultiplier(4)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_ResamplePipeline, PeakedWeights, true)
+    ->RangeMultiplier(4)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+
+void BM_ResamplePipeline_SelfAssign(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto particle_count = state.range(0);
+  state.SetComplexityN(particle_count);
+  const auto container_size = static_cast<std::size_t>(particle_count);
+
+  auto container = Container{container_size};
+  fill_container(container, false);  // uniform weights keep self-assignment stationary
+
+  for (auto _ : state) {
+    container |=                                                                               //
+        beluga::views::sample |                                                                //
+        beluga::views::random_intersperse(make_random_state_generator(), kRandomStateProbability) |
+        beluga::views::take_while_kld(beluga::spatial_hash<State>{}, 0, container_size, kKldEpsilon, kKldZ) |
+        beluga::actions::assign;
+    state.counters["SampleSize"] = static_cast<double>(container.size());
+  }
+}
+
+BENCHMARK(BM_ResamplePipeline_SelfAssign)->RangeMultiplier(4)->Range(1'000, 1'000'000)->Complexity();
+
+// Per-stage baselines: each isolates one ingredient of the composite, so a
+// regression in the pipeline numbers above can be attributed by comparison.
+
+void BM_ResampleStage_SamplingRng(benchmark::State& state, bool peaked_weights) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto particle_count = state.range(0);
+  state.SetComplexityN(particle_count);
+  const auto container_size = static_cast<std::size_t>(particle_count);
+
+  auto container = Container{container_size};
+  fill_container(container, peaked_weights);
+
+  for (auto _ : state) {
+    auto samples = container | beluga::views::sample;
+    auto it = ranges::begin(samples);
+    for (std::size_t i = 0; i < container_size; ++i, ++it) {
+      benchmark::DoNotOptimize(beluga::state(*it).x);
+    }
+  }
+}
+
+BENCHMARK_CAPTURE(BM_ResampleStage_SamplingRng, UniformWeights, false)
+    ->RangeMultiplier(4)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_ResampleStage_SamplingRng, PeakedWeights, true)
+    ->RangeMultiplier(4)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+
+void BM_ResampleStage_BucketHashing(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto particle_count = state.range(0);
+  state.SetComplexityN(particle_count);
+  const auto container_size = static_cast<std::size_t>(particle_count);
+
+  auto container = Container{container_size};
+  fill_container(container, false);
+  const auto hasher = beluga::spatial_hash<State>{};
+
+  for (auto _ : state) {
+    std::size_t accumulated = 0;
+    for (auto&& particle_state : beluga::views::states(container)) {
+      accumulated ^= hasher(particle_state);
+    }
+    benchmark::DoNotOptimize(accumulated);
+  }
+}
+
+BENCHMARK(BM_ResampleStage_BucketHashing)->RangeMultiplier(4)->Range(1'000, 1'000'000)->Complexity();
+
+void BM_ResampleStage_ContainerCopy(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  const auto particle_count = state.range(0);
+  state.SetComplexityN(particle_count);
+  const auto container_size = static_cast<std::size_t>(particle_count);
+
+  auto container = Container{container_size};
+  auto scratch = Container{container_size};
+  fill_container(container, false);
+
+  for (auto _ : state) {
+    scratch.assign_range(ranges::views::all(container));
+    benchmark::DoNotOptimize(scratch.size());
+  }
+}
+
+BENCHMARK(BM_ResampleStage_ContainerCopy)->RangeMultiplier(4)->Range(1'000, 1'000'000)->Complexity();
+
+}  // namespace
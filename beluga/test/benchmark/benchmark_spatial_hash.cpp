@@ -25,9 +25,12 @@
 
 #include "beluga/algorithm/spatial_hash.hpp"
 
+#include "perf_event_counters.hpp"
+
 namespace {
 
 void BM_Hashing(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   using Tuple = std::tuple<double, double, double>;
   constexpr std::array kClusteringResolution{1., 1., 1.};
   auto hasher = beluga::spatial_hash<Tuple>{kClusteringResolution};
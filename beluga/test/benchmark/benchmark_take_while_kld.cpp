@@ -31,6 +31,8 @@
 #include "beluga/views/sample.hpp"
 #include "beluga/views/take_while_kld.hpp"
 
+#include "perf_event_counters.hpp"
+
 namespace {
 
 struct State {
@@ -55,6 +57,7 @@ using Container = beluga::TupleVector<std::tuple<State, beluga::Weight>>;
 using Particle = typename Container::value_type;
 
 void BM_FixedResample(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   const auto particle_count = state.range(0);
   state.SetComplexityN(particle_count);
   const auto container_size = static_cast<std::size_t>(particle_count);
@@ -80,6 +83,7 @@ void BM_FixedResample(benchmark::State& state) {
 BENCHMARK(BM_FixedResample)->RangeMultiplier(2)->Range(128, 1'000'000)->Complexity();
 
 void BM_AdaptiveResample(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   const auto particle_count = state.range(0);
   state.SetComplexityN(particle_count);
   const auto container_size = static_cast<std::size_t>(particle_count);
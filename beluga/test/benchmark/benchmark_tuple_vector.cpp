@@ -28,6 +28,8 @@
 #include "beluga/primitives.hpp"
 #include "beluga/views/particles.hpp"
 
+#include "perf_event_counters.hpp"
+
 namespace {
 
 constexpr std::size_t kParticleCount = 1'000'000;
@@ -73,6 +75,7 @@ double update_weight(const State& state) {
 }
 
 void BM_Update_Baseline_StructureOfArrays(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   Arrays arrays;
   arrays.resize(kParticleCount);
   for (auto _ : state) {
@@ -83,6 +86,7 @@ void BM_Update_Baseline_StructureOfArrays(benchmark::State& state) {
 }
 
 void BM_Update_Baseline_ArrayOfStructures(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   std::vector<Particle> particles;
   particles.resize(kParticleCount);
   for (auto _ : state) {
@@ -95,6 +99,7 @@ void BM_Update_Baseline_ArrayOfStructures(benchmark::State& state) {
 
 template <class Container>
 void BM_Update(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   auto container = Container{};
   container.resize(kParticleCount);
   for (auto _ : state) {
@@ -109,6 +114,7 @@ BENCHMARK(BM_Update_Baseline_ArrayOfStructures);
 BENCHMARK_TEMPLATE(BM_Update, ArrayOfStructures);
 
 void BM_PushBack_Baseline_StructureOfArrays(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   Arrays arrays;
   arrays.resize(kParticleCount);
   Arrays new_arrays;
@@ -124,6 +130,7 @@ void BM_PushBack_Baseline_StructureOfArrays(benchmark::State& state) {
 }
 
 void BM_PushBack_Baseline_ArrayOfStructures(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   std::vector<Particle> particles;
   particles.resize(kParticleCount);
   std::vector<Particle> new_particles;
@@ -138,6 +145,7 @@ void BM_PushBack_Baseline_ArrayOfStructures(benchmark::State& state) {
 
 template <class Container>
 void BM_PushBack(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   auto container = Container{};
   container.resize(kParticleCount);
   auto new_container = Container{};
@@ -156,6 +164,7 @@ BENCHMARK(BM_PushBack_Baseline_ArrayOfStructures);
 BENCHMARK_TEMPLATE(BM_PushBack, ArrayOfStructures);
 
 void BM_Assign_Baseline_ArrayOfStructures(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   std::vector<Particle> particles;
   particles.resize(kParticleCount);
   std::vector<Particle> new_particles;
@@ -168,6 +177,7 @@ void BM_Assign_Baseline_ArrayOfStructures(benchmark::State& state) {
 }
 
 void BM_Assign_Baseline_StructureOfArrays(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   Arrays arrays;
   arrays.resize(kParticleCount);
   Arrays new_arrays;
@@ -183,6 +193,7 @@ void BM_Assign_Baseline_StructureOfArrays(benchmark::State& state) {
 
 template <class Container>
 void BM_Transform(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   auto container = Container{};
   container.resize(kParticleCount);
   auto new_container = Container{};
@@ -196,6 +207,7 @@ void BM_Transform(benchmark::State& state) {
 
 template <class Container>
 void BM_AssignFromSized(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   auto container = Container{};
   container.resize(kParticleCount);
   auto new_container = Container{};
@@ -208,6 +220,7 @@ void BM_AssignFromSized(benchmark::State& state) {
 
 template <class Container>
 void BM_AssignFromNonSized(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   auto container = Container{};
   container.resize(kParticleCount);
   auto new_container = Container{};
@@ -221,6 +234,7 @@ void BM_AssignFromNonSized(benchmark::State& state) {
 
 template <class Container>
 void BM_AssignFromNonSizedReserved(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
   auto container = Container{};
   container.resize(kParticleCount);
   auto new_container = Container{};
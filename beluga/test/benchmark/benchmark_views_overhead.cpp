@@ -0,0 +1,179 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the overhead of the range abstractions (views pipelines and action
+// closures) against raw pointer loops over the same TupleVector columns, for
+// the workloads the filter update is made of. Each workload comes in a raw
+// baseline and one or more composed variants, so the ratio between them acts
+// as a fusion-regression canary across compiler and flag changes.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <tuple>
+
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/range/access.hpp>
+
+#include "beluga/actions/propagate.hpp"
+#include "beluga/actions/reweight.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+#include "beluga/views/zip.hpp"
+
+#include "perf_event_counters.hpp"
+
+namespace {
+
+constexpr std::size_t kParticleCount = 1'000'000;
+
+struct State {
+  double x = 0.;
+  double y = 0.;
+  double theta = 0.;
+};
+
+using Container = beluga::TupleVector<std::tuple<State, beluga::Weight>>;
+
+double importance(const State& state) {
+  return state.x * state.y + state.theta;
+}
+
+State advance(const State& state) {
+  return State{state.x + 0.1, state.y + 0.2, state.theta + 0.3};
+}
+
+void BM_WeightSweep_RawPointers(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  auto container = Container{};
+  container.resize(kParticleCount);
+  for (auto _ : state) {
+    const State* states = container.data<0>();
+    beluga::Weight* weights = container.data<1>();
+    for (std::size_t i = 0; i < kParticleCount; ++i) {
+      weights[i] = weights[i] * importance(states[i]);
+    }
+  }
+}
+
+void BM_WeightSweep_Views(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  auto container = Container{};
+  container.resize(kParticleCount);
+  for (auto _ : state) {
+    for (auto&& [particle_state, weight] : beluga::views::zip(  //
+             beluga::views::states(container),                  //
+             beluga::views::weights(container))) {
+      weight = weight * importance(particle_state);
+    }
+  }
+}
+
+void BM_WeightSweep_Action(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  auto container = Container{};
+  container.resize(kParticleCount);
+  for (auto _ : state) {
+    container |= beluga::actions::reweight(importance);
+  }
+}
+
+BENCHMARK(BM_WeightSweep_RawPointers);
+BENCHMARK(BM_WeightSweep_Views);
+BENCHMARK(BM_WeightSweep_Action);
+
+void BM_StateTransform_RawPointers(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  auto container = Container{};
+  container.resize(kParticleCount);
+  for (auto _ : state) {
+    State* states = container.data<0>();
+    for (std::size_t i = 0; i < kParticleCount; ++i) {
+      states[i] = advance(states[i]);
+    }
+  }
+}
+
+void BM_StateTransform_Views(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  auto container = Container{};
+  container.resize(kParticleCount);
+  for (auto _ : state) {
+    auto states = beluga::views::states(container);
+    ranges::transform(states, ranges::begin(states), advance);
+  }
+}
+
+void BM_StateTransform_Action(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  auto container = Container{};
+  container.resize(kParticleCount);
+  for (auto _ : state) {
+    container |= beluga::actions::propagate(advance);
+  }
+}
+
+BENCHMARK(BM_StateTransform_RawPointers);
+BENCHMARK(BM_StateTransform_Views);
+BENCHMARK(BM_StateTransform_Action);
+
+void BM_ZipReduce_RawPointers(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  auto container = Container{};
+  container.resize(kParticleCount);
+  for (auto _ : state) {
+    const State* states = container.data<0>();
+    const beluga::Weight* weights = container.data<1>();
+    double accumulator = 0.;
+    for (std::size_t i = 0; i < kParticleCount; ++i) {
+      accumulator += static_cast<double>(weights[i]) * states[i].x;
+    }
+    benchmark::DoNotOptimize(accumulator);
+  }
+}
+
+void BM_ZipReduce_Views(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  auto container = Container{};
+  container.resize(kParticleCount);
+  for (auto _ : state) {
+    double accumulator = 0.;
+    for (auto&& [particle_state, weight] : beluga::views::zip(  //
+             beluga::views::states(container),                  //
+             beluga::views::weights(container))) {
+      accumulator += static_cast<double>(weight) * particle_state.x;
+    }
+    benchmark::DoNotOptimize(accumulator);
+  }
+}
+
+void BM_ZipReduce_Elements(benchmark::State& state) {
+  const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+  auto container = Container{};
+  container.resize(kParticleCount);
+  for (auto _ : state) {
+    double accumulator = 0.;
+    for (auto&& particle : container) {
+      accumulator += static_cast<double>(beluga::weight(particle)) * beluga::state(particle).x;
+    }
+    benchmark::DoNotOptimize(accumulator);
+  }
+}
+
+BENCHMARK(BM_ZipReduce_RawPointers);
+BENCHMARK(BM_ZipReduce_Views);
+BENCHMARK(BM_ZipReduce_Elements);
+
+}  // namespace
@@ -0,0 +1,148 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_BENCHMARK_PERF_EVENT_COUNTERS_HPP
+#define BELUGA_BENCHMARK_PERF_EVENT_COUNTERS_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+/**
+ * \file
+ * \brief Opt-in hardware performance counter collection for the benchmark suites.
+ */
+
+namespace beluga::benchmarking {
+
+/// Collects hardware performance counters over the lifetime of the instance.
+/**
+ * When the `BELUGA_PERF_COUNTERS` environment variable is set to a non-empty value,
+ * construction opens a perf_event group counting CPU cycles, retired instructions,
+ * last-level cache misses and branch misses for the calling thread, and destruction
+ * surfaces the per-iteration averages as google-benchmark user counters (`cycles`,
+ * `instructions`, `llc_misses`, `branch_misses`). Declare an instance at the top of
+ * a benchmark function so the counters bracket the whole timed loop:
+ *
+ * ```cpp
+ * void BM_Something(benchmark::State& state) {
+ *   const auto perf_counters = beluga::benchmarking::ScopedPerfCounters{state};
+ *   for (auto _ : state) {
+ *     // ...
+ *   }
+ * }
+ * ```
+ *
+ * Collection silently degrades to a no-op when the environment variable is unset,
+ * on non-Linux hosts, or when `perf_event_open` is unavailable (for instance under
+ * a restrictive `kernel.perf_event_paranoid` setting or inside containers).
+ */
+class ScopedPerfCounters {
+ public:
+  /// Constructor. Starts counting if collection is enabled and supported.
+  explicit ScopedPerfCounters(benchmark::State& state) : state_{state} {
+#ifdef __linux__
+    if (!enabled()) {
+      return;
+    }
+    for (std::size_t i = 0; i < kEvents.size(); ++i) {
+      fds_[i] = open_counter(kEvents[i], i > 0 ? fds_[0] : -1);
+    }
+    if (fds_[0] >= 0) {
+      ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+  }
+
+  /// Destructor. Stops counting and reports user counters to the benchmark state.
+  ~ScopedPerfCounters() {
+#ifdef __linux__
+    if (fds_[0] >= 0) {
+      ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+      for (std::size_t i = 0; i < kEvents.size(); ++i) {
+        if (fds_[i] < 0) {
+          continue;
+        }
+        std::uint64_t value = 0;
+        if (read(fds_[i], &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+          state_.counters[kCounterNames[i]] =
+              benchmark::Counter(static_cast<double>(value), benchmark::Counter::kAvgIterations);
+        }
+      }
+    }
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+#endif
+  }
+
+  ScopedPerfCounters(const ScopedPerfCounters&) = delete;
+  ScopedPerfCounters& operator=(const ScopedPerfCounters&) = delete;
+
+ private:
+  /// Whether collection was requested through the environment.
+  [[nodiscard]] static bool enabled() {
+    const char* value = std::getenv("BELUGA_PERF_COUNTERS");
+    return value != nullptr && value[0] != '\0';
+  }
+
+#ifdef __linux__
+  /// Hardware events collected, group leader first.
+  static constexpr std::array<std::uint64_t, 4> kEvents = {
+      PERF_COUNT_HW_CPU_CYCLES,      //
+      PERF_COUNT_HW_INSTRUCTIONS,    //
+      PERF_COUNT_HW_CACHE_MISSES,    //
+      PERF_COUNT_HW_BRANCH_MISSES};  //
+
+  /// Opens one hardware counter for the calling thread, grouped under `group_fd`.
+  [[nodiscard]] static int open_counter(std::uint64_t config, int group_fd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = group_fd < 0 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+  }
+#endif
+
+  /// User counter names, index-matched to the collected events.
+  static constexpr std::array<const char*, 4> kCounterNames = {
+      "cycles",          //
+      "instructions",    //
+      "llc_misses",      //
+      "branch_misses"};  //
+
+  benchmark::State& state_;
+  std::array<int, 4> fds_{{-1, -1, -1, -1}};
+};
+
+}  // namespace beluga::benchmarking
+
+#endif  // BELUGA_BENCHMARK_PERF_EVENT_COUNTERS_HPP
@@ -15,10 +15,17 @@
 #ifndef BELUGA_AMCL_AMCL_NODE_HPP
 #define BELUGA_AMCL_AMCL_NODE_HPP
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <variant>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcpp"
@@ -29,6 +36,7 @@
 #include <tf2_ros/message_filter.h>
 #include <tf2_ros/transform_broadcaster.h>
 #include <tf2_ros/transform_listener.h>
+#include <rclcpp/version.h>
 #include <bondcpp/bond.hpp>
 #include <rclcpp_lifecycle/lifecycle_node.hpp>
 
@@ -36,11 +44,13 @@
 #include <geometry_msgs/msg/pose_with_covariance_stamped.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <sensor_msgs/msg/laser_scan.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
 #include <std_srvs/srv/empty.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
 #include <beluga/beluga.hpp>
 #include <beluga_ros/amcl.hpp>
+#include <beluga_ros/message_pool.hpp>
 #include "beluga_amcl/message_filters.hpp"
 #include "beluga_amcl/ros2_common.hpp"
 
@@ -61,6 +71,9 @@ class AmclNode : public BaseAMCLNode {
   ~AmclNode() override;
 
  protected:
+  /// Callback for lifecycle transitions from the UNCONFIGURED state to the INACTIVE state.
+  void do_configure(const rclcpp_lifecycle::State&) override;
+
   /// Callback for lifecycle transitions from the INACTIVE state to the ACTIVE state.
   void do_activate(const rclcpp_lifecycle::State&) override;
 
@@ -83,28 +96,124 @@ class AmclNode : public BaseAMCLNode {
   /// Instantiate particle filter given an initial occupancy grid map and the current parametrization.
   auto make_particle_filter(nav_msgs::msg::OccupancyGrid::SharedPtr) const -> std::unique_ptr<beluga_ros::Amcl>;
 
+  /// Assemble the filter parameter set from the current parametrization.
+  auto make_filter_params() const -> beluga_ros::AmclParams;
+
+  /// Pending differentiated parameter update paths, guarded by the filter thread mutex.
+  struct PendingParameterUpdates {
+    /// Whether parameters mapping to beluga_ros::AmclParams changed.
+    bool filter_params = false;
+    /// Whether parameters feeding the motion model changed.
+    bool motion_model = false;
+    /// Whether parameters feeding the sensor model changed.
+    bool sensor_model = false;
+    /// Whether parameters baked into the filter instance itself changed.
+    bool filter_structure = false;
+    /// Returns true if any update path is pending.
+    [[nodiscard]] bool any() const { return filter_params || motion_model || sensor_model || filter_structure; }
+  };
+
+  /// Callback for parameter changes, run after new values are committed.
+  /**
+   * Only classifies the changed parameters into their update paths and wakes up the
+   * filter thread, which applies them through apply_pending_parameter_updates();
+   * rclcpp holds its parameter mutex while notifying, so doing any filter work here
+   * would invert the lock order process_measurement() establishes. On rclcpp versions
+   * without post-set parameter callback support this is never registered, and
+   * parameter changes keep taking effect at the next filter reconstruction.
+   */
+  void parameters_update_callback(const std::vector<rclcpp::Parameter>& parameters);
+
+  /// Apply parameter changes to the live filter, preserving the particle population.
+  /**
+   * Runs on the filter thread. Parameter changes take differentiated update paths so
+   * that retuning the filter does not restart localization: filter and motion model
+   * parameters apply in place, sensor model parameters rebuild the model against the
+   * last known map on a worker thread and swap it in between updates — as a map
+   * change does — and only structural changes (execution policy) rebuild the filter
+   * instance itself, carrying the current particle population over through staging.
+   */
+  void apply_pending_parameter_updates(const PendingParameterUpdates& updates);
+
+  /// Creates the occupancy grid map subscription if it does not exist yet.
+  void subscribe_to_map();
+
   /// Callback for occupancy grid map updates.
+  /**
+   * All construction work runs on a background thread so this callback returns
+   * immediately and the executor stays responsive. The first map builds the particle
+   * filter (and its likelihood field) on that thread, with readiness reported when the
+   * build completes. Later maps rebuild the sensor model there and swap it into the
+   * filter between updates, so localization keeps running on the old map meanwhile.
+   */
   void map_callback(nav_msgs::msg::OccupancyGrid::SharedPtr);
 
+  /// Publish the current likelihood field for debugging, if enabled.
+  void publish_likelihood_field();
+
+  /// Reinitialize the filter after a map change, from the last known estimate if possible.
+  void reinitialize_with_new_map(bool should_reset_initial_pose);
+
   /// Callback for periodic particle cloud updates.
   void do_periodic_timer_callback() override;
 
+  /// Fill in filter performance diagnostics from the last update.
+  bool do_collect_diagnostics(diagnostic_msgs::msg::DiagnosticStatus& status) override;
+
   /// Try to look up a tf transform immediately.
   template <typename TransformT>
   std::optional<TransformT>
   lookup_transform(const std::string& target_frame_id, const std::string& source_frame_id, const tf2::TimePoint& stamp);
 
+  /// Get the sensor-to-base extrinsic transform, resolving it through tf at most once.
+  /**
+   * The extrinsic is static on virtually all robots, so it is cached after the first
+   * successful lookup and the cache is reused as long as the sensor and base frame ids
+   * stay the same. This leaves the odometry lookup as the only tf buffer query per scan.
+   *
+   * \param sensor_frame_id Frame id of the incoming sensor message.
+   * \param stamp Message stamp, used only when the transform must be (re)resolved.
+   * \return The sensor pose in the base frame, or std::nullopt if the lookup failed.
+   */
+  std::optional<Sophus::SE3d> get_sensor_pose_in_base(const std::string& sensor_frame_id, const tf2::TimePoint& stamp);
+
   /// Try to wrap a laser scan message.
   std::optional<beluga_ros::LaserScan> wrap_sensor_data(const sensor_msgs::msg::LaserScan::ConstSharedPtr& sensor_msg);
 
+  /// Feed the odometry motion over the scan sweep to a wrapped scan, enabling deskew.
+  /**
+   * Looks up the base pose in the odometry frame at the first and last beam times and
+   * hands their relative motion, conjugated into the sensor frame, to the scan wrapper.
+   * If the sweep duration is unknown or either lookup fails, the scan is left as-is.
+   *
+   * \param sensor_msg Laser scan message being wrapped.
+   * \param sensor_pose_in_base Sensor-to-base extrinsic resolved for this scan.
+   * \param laser_scan Scan wrapper to deskew; its points must not have been accessed yet.
+   */
+  void deskew_scan(
+      const sensor_msgs::msg::LaserScan& sensor_msg,
+      const Sophus::SE3d& sensor_pose_in_base,
+      beluga_ros::LaserScan& laser_scan);
+
   /// Try to wrap a pointcloud message.
   std::optional<beluga_ros::SparsePointCloud3f> wrap_sensor_data(
       const sensor_msgs::msg::PointCloud2::ConstSharedPtr& sensor_msg);
 
   /// Callback for sensor updates.
+  /**
+   * Only deposits the message in the measurement mailbox and wakes up the filter
+   * thread, so executor callbacks stay responsive no matter how long an update takes.
+   */
   template <typename MessageT>
   void sensor_callback(const std::shared_ptr<const MessageT>& sensor_msg);
 
+  /// Run a measurement through the particle filter and publish the results.
+  template <typename MessageT>
+  void process_measurement(const std::shared_ptr<const MessageT>& sensor_msg);
+
+  /// Filter thread loop, draining the measurement mailbox until asked to stop.
+  void filter_thread_loop();
+
   /// Callback for pose (re)initialization.
   void do_initial_pose_callback(geometry_msgs::msg::PoseWithCovarianceStamped::SharedPtr) override;
 
@@ -169,8 +278,57 @@ class AmclNode : public BaseAMCLNode {
   /// Connection for point cloud updates filter and callback.
   ::message_filters::Connection point_cloud_connection_;
 
+  /// Reusable particle cloud messages for periodic publishing.
+  beluga_ros::MessagePool<geometry_msgs::msg::PoseArray> particle_cloud_pool_;
+  /// Reusable particle marker messages for periodic publishing.
+  beluga_ros::MessagePool<visualization_msgs::msg::MarkerArray> particle_markers_pool_;
+
+  /// Measurement type fed to the filter thread.
+  using measurement_variant =
+      std::variant<sensor_msgs::msg::LaserScan::ConstSharedPtr, sensor_msgs::msg::PointCloud2::ConstSharedPtr>;
+
+  /// Dedicated thread running filter updates off the executor.
+  std::thread filter_thread_;
+  /// Mutex protecting the measurement mailbox and the stop flag.
+  std::mutex filter_thread_mutex_;
+  /// Condition variable to wake up the filter thread.
+  std::condition_variable filter_thread_condition_;
+  /// Single-slot latest-wins measurement mailbox; bursts coalesce by overwriting.
+  std::optional<measurement_variant> pending_measurement_;
+  /// Parameter update paths waiting for the filter thread; bursts of changes coalesce.
+  PendingParameterUpdates pending_parameter_updates_;
+  /// Latest sensor message seen, kept (not consumed) to seed global localization candidates.
+  std::optional<measurement_variant> latest_measurement_;
+  /// Whether the filter thread was asked to stop.
+  bool filter_thread_stop_{false};
+  /// Cached sensor-to-base extrinsic transform; guarded by the particle filter mutex.
+  std::optional<Sophus::SE3d> cached_sensor_pose_in_base_;
+  /// Sensor frame id the cached extrinsic was resolved for.
+  std::string cached_sensor_frame_id_;
+  /// Base frame id the cached extrinsic was resolved for.
+  std::string cached_base_frame_id_;
+  /// Mutex serializing particle filter access between the filter thread and executor callbacks.
+  std::mutex particle_filter_mutex_;
+  /// Background thread rebuilding the sensor model against a new map; at most one in flight.
+  std::thread map_update_thread_;
+  /// Background thread rebuilding filter state after a parameter change; at most one in
+  /// flight, spawned and joined by the filter thread only.
+  std::thread parameter_update_thread_;
+  /// Background thread preparing global localization candidates; at most one in flight.
+  std::thread global_localization_thread_;
+
+#if RCLCPP_VERSION_GTE(17, 0, 0)
+  /// Handle keeping the parameter update callback registered.
+  rclcpp::node_interfaces::PostSetParametersCallbackHandle::SharedPtr post_set_parameters_handle_;
+#endif
+
   /// Particle filter instance.
   std::unique_ptr<beluga_ros::Amcl> particle_filter_;
+  /// Last received occupancy grid map, retained to rebuild sensor models on parameter
+  /// changes; guarded by the particle filter mutex.
+  nav_msgs::msg::OccupancyGrid::SharedPtr last_known_map_;
+  /// Wall time taken by the last filter update that produced an estimate, if any.
+  std::optional<std::chrono::high_resolution_clock::duration> last_update_duration_;
   /// Last known pose estimate, if any.
   std::optional<std::pair<Sophus::SE2d, Eigen::Matrix3d>> last_known_estimate_;
   /// Last known map to odom correction estimate, if any.
@@ -29,8 +29,10 @@
 #include <beluga/sensor/data/sparse_value_grid.hpp>
 #include <beluga/sensor/ndt_sensor_model.hpp>
 
+#include <chrono>
 #include <execution>
 #include <functional>
+#include <future>
 #include <optional>
 #include <rclcpp/callback_group.hpp>
 #include <rclcpp/subscription_options.hpp>
@@ -73,15 +75,24 @@ using NDTMapRepresentation =
 using RandomStateGenerator = std::function<std::function<beluga::NDTSensorModel<NDTMapRepresentation>::state_type()>(
     const beluga::TupleVector<std::tuple<beluga::NDTSensorModel<NDTMapRepresentation>::state_type, beluga::Weight>>)>;
 
+/// Weighted state particle type for the NDT AMCL pipeline.
+using NdtParticleType = std::tuple<typename beluga::NDTSensorModel<NDTMapRepresentation>::state_type, beluga::Weight>;
+
 /// Partial specialization of the core AMCL pipeline for convinience.
+/**
+ * Instrumentation is enabled so per-update stage timings can be surfaced as diagnostics.
+ */
 template <class MotionModel, class ExecutionPolicy>
 using NdtAmcl = beluga::Amcl<
     MotionModel,
     beluga::NDTSensorModel<NDTMapRepresentation>,
     RandomStateGenerator,
     beluga::Weight,
-    std::tuple<typename beluga::NDTSensorModel<NDTMapRepresentation>::state_type, beluga::Weight>,
-    ExecutionPolicy>;
+    NdtParticleType,
+    ExecutionPolicy,
+    beluga::any_policy<typename beluga::NDTSensorModel<NDTMapRepresentation>::state_type>,
+    beluga::any_policy<beluga::TupleVector<NdtParticleType>>,
+    std::function<void(const beluga::AmclUpdateInstrumentation&)>>;
 
 /// All combinations of supported NDT AMCL variants.
 using NdtAmclVariant = std::variant<
@@ -107,6 +118,14 @@ class NdtAmclNode : public BaseAMCLNode {
   explicit NdtAmclNode(const rclcpp::NodeOptions& options = rclcpp::NodeOptions{});
 
  protected:
+  /// Callback for lifecycle transitions from the UNCONFIGURED state to the INACTIVE state.
+  /**
+   * Kicks off the HDF5 map load in a background thread, overlapping it with the rest
+   * of the configuration. Activation blocks on the pending load only if it has not
+   * finished by the time the sensor model is built.
+   */
+  void do_configure(const rclcpp_lifecycle::State&) override;
+
   /// Callback for lifecycle transitions from the INACTIVE state to the ACTIVE state.
   void do_activate(const rclcpp_lifecycle::State&) override;
 
@@ -131,6 +150,9 @@ class NdtAmclNode : public BaseAMCLNode {
   /// Callback for periodic particle cloud updates.
   void do_periodic_timer_callback() override;
 
+  /// Fill in filter performance diagnostics from the last update.
+  bool do_collect_diagnostics(diagnostic_msgs::msg::DiagnosticStatus& status) override;
+
   /// Callback for laser scan updates.
   void laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr);
 
@@ -156,8 +178,19 @@ class NdtAmclNode : public BaseAMCLNode {
   /// Connection for laser scan updates filter and callback.
   ::message_filters::Connection laser_scan_connection_;
 
+  /// Pending background map load started at configuration time, if any.
+  /**
+   * Consumed by get_sensor_model(), which falls back to a synchronous load when no
+   * load is pending (e.g. on reactivation without an intervening configuration).
+   */
+  mutable std::future<NDTMapRepresentation> map_future_;
+
   /// Particle filter instance.
   std::unique_ptr<NdtAmclVariant> particle_filter_ = nullptr;
+  /// Per-stage statistics for the last update that ran the filter pipeline, if any.
+  std::optional<beluga::AmclUpdateInstrumentation> last_update_stats_;
+  /// Wall time taken by the last filter update that produced an estimate, if any.
+  std::optional<std::chrono::high_resolution_clock::duration> last_update_duration_;
   /// Last known pose estimate, if any.
   std::optional<std::pair<Sophus::SE2d, Eigen::Matrix3d>> last_known_estimate_ = std::nullopt;
   /// Last known map to odom correction estimate, if any.
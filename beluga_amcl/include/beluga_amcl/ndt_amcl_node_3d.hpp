@@ -23,12 +23,17 @@
 #include <beluga/algorithm/amcl_core.hpp>
 #include <beluga/beluga.hpp>
 
+#include <chrono>
+#include <condition_variable>
 #include <execution>
 #include <functional>
+#include <mutex>
 #include <optional>
 #include <sophus/types.hpp>
+#include <thread>
 #include <tuple>
 #include <variant>
+#include <vector>
 
 #include <geometry_msgs/msg/pose_array.hpp>
 #include <geometry_msgs/msg/pose_with_covariance_stamped.hpp>
@@ -38,6 +43,7 @@
 #include <std_srvs/srv/empty.hpp>
 
 #include <beluga_ros/laser_scan.hpp>
+#include <beluga_ros/point_cloud_voxel_filter.hpp>
 #include "beluga_amcl/message_filters.hpp"
 #include "beluga_amcl/ros2_common.hpp"
 
@@ -64,6 +70,9 @@ using StateType = typename beluga::NDTSensorModel<NDTMapRepresentation>::state_t
 using RandomStateGenerator = std::function<StateType()>;
 
 /// Partial specialization of the core AMCL pipeline for convinience.
+/**
+ * Instrumentation is enabled so per-update stage timings can be surfaced as diagnostics.
+ */
 template <class MotionModel, class ExecutionPolicy>
 using NdtAmcl = beluga::Amcl<
     MotionModel,
@@ -71,7 +80,10 @@ using NdtAmcl = beluga::Amcl<
     RandomStateGenerator,
     beluga::Weight,
     std::tuple<StateType, beluga::Weight>,
-    ExecutionPolicy>;
+    ExecutionPolicy,
+    beluga::any_policy<StateType>,
+    beluga::any_policy<beluga::TupleVector<std::tuple<StateType, beluga::Weight>>>,
+    std::function<void(const beluga::AmclUpdateInstrumentation&)>>;
 
 /// All combinations of supported 3D NDT AMCL variants.
 using NdtAmclVariant = std::variant<
@@ -115,9 +127,33 @@ class NdtAmclNode3D : public BaseAMCLNode {
   /// Callback for periodic particle cloud updates.
   void do_periodic_timer_callback() override;
 
+  /// Fill in filter performance diagnostics from the last update.
+  bool do_collect_diagnostics(diagnostic_msgs::msg::DiagnosticStatus& status) override;
+
+  /// Point cloud converted into the base frame, plus the context needed to publish results.
+  struct PreparedMeasurement {
+    /// Pose of the robot base in the odom frame at the scan timestamp.
+    Sophus::SE3d base_pose_in_odom;
+    /// Scan points in the base frame, already voxel-downsampled when enabled.
+    std::vector<Eigen::Vector3d> points;
+    /// Timestamp of the originating scan, used to stamp published results.
+    builtin_interfaces::msg::Time stamp;
+  };
+
   /// Callback for laser scan updates.
+  /**
+   * Runs the conversion stage only: TF lookups, point cloud conversion, and voxel
+   * downsampling. The result is deposited in the measurement mailbox for the filter
+   * thread, so converting the next cloud overlaps the update over the previous one.
+   */
   void laser_callback(sensor_msgs::msg::PointCloud2::ConstSharedPtr);
 
+  /// Run a prepared measurement through the particle filter and publish the results.
+  void process_measurement(PreparedMeasurement measurement);
+
+  /// Filter thread loop, draining the measurement mailbox until asked to stop.
+  void filter_thread_loop();
+
   /// Callback for pose (re) initialization.
   void do_initial_pose_callback(geometry_msgs::msg::PoseWithCovarianceStamped::SharedPtr message) override;
 
@@ -127,6 +163,8 @@ class NdtAmclNode3D : public BaseAMCLNode {
    * process is also aborted, returning false. If the initialization is successful, the TF broadcast is
    * enabled.
    *
+   * Callers must hold the particle filter mutex whenever the filter thread may be running.
+   *
    * \param estimate A pair representing the estimated pose and covariance for initialization.
    * \return True if the initialization is successful, false otherwise.
    */
@@ -140,11 +178,32 @@ class NdtAmclNode3D : public BaseAMCLNode {
   /// Connection for laser scan updates filter and callback.
   ::message_filters::Connection laser_scan_connection_;
 
+  /// Dedicated thread running filter updates off the executor.
+  std::thread filter_thread_;
+  /// Mutex protecting the measurement mailbox and the stop flag.
+  std::mutex filter_thread_mutex_;
+  /// Condition variable to wake up the filter thread.
+  std::condition_variable filter_thread_condition_;
+  /// Single-slot latest-wins measurement mailbox; bursts coalesce by overwriting.
+  std::optional<PreparedMeasurement> pending_measurement_;
+  /// Whether the filter thread was asked to stop.
+  bool filter_thread_stop_{false};
+  /// Mutex serializing particle filter and estimate access between the filter thread and executor callbacks.
+  std::mutex particle_filter_mutex_;
+
   /// NDT map representation
   beluga_amcl::NDTMapRepresentation map_;
 
   /// Particle filter instance.
   std::unique_ptr<NdtAmclVariant> particle_filter_;
+  /// Reusable measurement buffer, refilled on every scan to avoid per-scan allocations.
+  std::vector<Eigen::Vector3d> measurement_buffer_;
+  /// Reusable voxel deduplication filter applied to the measurement buffer when enabled.
+  beluga_ros::PointCloudVoxelFilter voxel_filter_;
+  /// Per-stage statistics for the last update that ran the filter pipeline, if any.
+  std::optional<beluga::AmclUpdateInstrumentation> last_update_stats_;
+  /// Wall time taken by the last filter update that produced an estimate, if any.
+  std::optional<std::chrono::high_resolution_clock::duration> last_update_duration_;
   /// Last known pose estimate, if any.
   std::optional<std::pair<Sophus::SE3d, Sophus::Matrix6d>> last_known_estimate_;
   /// Last known map to odom correction estimate, if any.
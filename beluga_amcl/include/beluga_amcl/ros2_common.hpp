@@ -15,16 +15,29 @@
 #ifndef BELUGA_AMCL_ROS2_COMMON_HPP
 #define BELUGA_AMCL_ROS2_COMMON_HPP
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <execution>
+#include <optional>
 #include <rclcpp/node_options.hpp>
 #include <rclcpp_lifecycle/lifecycle_node.hpp>
 #include <rclcpp_lifecycle/state.hpp>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 
 #include <bondcpp/bond.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <diagnostic_msgs/msg/diagnostic_status.hpp>
 #include <geometry_msgs/msg/pose_array.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
+#include <geometry_msgs/msg/pose_with_covariance_stamped.hpp>
+#include <geometry_msgs/msg/transform_stamped.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
@@ -54,6 +67,131 @@ constexpr std::string_view kNav2OmnidirectionalModelName = "nav2_amcl::OmniMotio
 /// Supported execution policies.
 using ExecutionPolicyVariant = std::variant<std::execution::sequenced_policy, std::execution::parallel_policy>;
 
+/// Lock-free single-producer single-consumer triple buffer.
+/**
+ * The writer always owns a private back slot to write into and publishes it with a
+ * single atomic exchange; the reader grabs the freshest published slot with another.
+ * Neither side ever waits, so estimate production (e.g. on the filter thread) is
+ * never blocked by a slow consumer (e.g. a publisher timer stalled on the middleware),
+ * and the consumer always sees the latest complete value.
+ */
+template <class T>
+class TripleBuffer {
+ public:
+  /// Publishes a new value, overwriting any previously unread one.
+  void write(T value) {
+    slots_[back_] = std::move(value);
+    back_ = middle_.exchange(back_ | kDirtyBit, std::memory_order_acq_rel) & kIndexMask;
+  }
+
+  /// Takes the freshest unread value, if any.
+  [[nodiscard]] std::optional<T> take() {
+    if ((middle_.load(std::memory_order_relaxed) & kDirtyBit) == 0U) {
+      return std::nullopt;
+    }
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndexMask;
+    return std::move(slots_[front_]);
+  }
+
+ private:
+  static constexpr std::uint32_t kDirtyBit = 4U;    ///< Set on the published index until it is read.
+  static constexpr std::uint32_t kIndexMask = 3U;   ///< Mask extracting the slot index.
+
+  std::array<T, 3> slots_{};                        ///< Value slots, one per role.
+  std::uint32_t back_{0U};                          ///< Writer-owned slot index.
+  std::uint32_t front_{1U};                         ///< Reader-owned slot index.
+  std::atomic<std::uint32_t> middle_{2U};           ///< Published slot index, tagged with kDirtyBit when unread.
+};
+
+/// Latest estimate outputs produced by a filter update, staged for publication.
+struct EstimateOutput {
+  /// Map-to-odom transform to broadcast, if TF broadcasting is enabled.
+  std::optional<geometry_msgs::msg::TransformStamped> transform;
+  /// Estimated pose message to publish, if the filter produced a new estimate.
+  std::optional<geometry_msgs::msg::PoseWithCovarianceStamped> pose;
+};
+
+/// Deterministic measurement admission policy for overload protection.
+/**
+ * Tracks exponential averages of the measurement arrival period and of the filter update
+ * duration. While updates take longer than the configured fraction of the sensor period,
+ * only every Nth measurement is admitted, with N sized so the admitted rate matches what
+ * the host can sustain. Stride changes require a sustained streak in either direction, and
+ * recovery steps the stride down one notch at a time, so marginal load does not oscillate.
+ */
+class MeasurementAdmissionPolicy {
+ public:
+  /// Constructor.
+  /**
+   * \param busy_fraction Fraction of the sensor period an update may take before the host
+   *   is considered overloaded. Must be in (0, 1].
+   * \param patience Number of consecutive over (or under) budget updates required before
+   *   the admission stride grows (or shrinks).
+   */
+  explicit MeasurementAdmissionPolicy(double busy_fraction = 0.9, std::size_t patience = 5)
+      : busy_fraction_(busy_fraction), patience_(patience) {}
+
+  /// Record a measurement arrival and decide whether to admit it.
+  /**
+   * \param arrival_time Monotonic time at which the measurement was taken off the queue.
+   * \return True if the measurement should be processed, false if it should be skipped.
+   */
+  [[nodiscard]] bool admit(std::chrono::steady_clock::time_point arrival_time) {
+    if (last_arrival_time_.has_value()) {
+      const double period = std::chrono::duration<double>(arrival_time - *last_arrival_time_).count();
+      mean_period_ = mean_period_ > 0. ? kSmoothing * period + (1. - kSmoothing) * mean_period_ : period;
+    }
+    last_arrival_time_ = arrival_time;
+    return (arrival_count_++ % stride_) == 0U;
+  }
+
+  /// Record the duration of a processed update and adapt the admission stride.
+  /**
+   * \param duration Wall time the particle filter update took.
+   */
+  void report_update_duration(std::chrono::nanoseconds duration) {
+    const double seconds = std::chrono::duration<double>(duration).count();
+    mean_duration_ = mean_duration_ > 0. ? kSmoothing * seconds + (1. - kSmoothing) * mean_duration_ : seconds;
+    if (mean_period_ <= 0.) {
+      return;  // need at least two arrivals to know the sensor period
+    }
+    const auto target = static_cast<std::size_t>(std::ceil(mean_duration_ / (busy_fraction_ * mean_period_)));
+    if (target > stride_) {
+      recovery_streak_ = 0U;
+      if (++overload_streak_ >= patience_) {
+        stride_ = target;
+        overload_streak_ = 0U;
+      }
+    } else if (target < stride_) {
+      overload_streak_ = 0U;
+      if (++recovery_streak_ >= patience_) {
+        --stride_;
+        recovery_streak_ = 0U;
+      }
+    } else {
+      overload_streak_ = 0U;
+      recovery_streak_ = 0U;
+    }
+  }
+
+  /// Current admission stride; one means every measurement is processed.
+  [[nodiscard]] std::size_t stride() const { return stride_; }
+
+ private:
+  /// Exponential smoothing factor for the period and duration averages.
+  static constexpr double kSmoothing = 0.1;
+
+  double busy_fraction_;                                                  ///< Update time budget per sensor period.
+  std::size_t patience_;                                                  ///< Streak length gating stride changes.
+  std::optional<std::chrono::steady_clock::time_point> last_arrival_time_;  ///< Previous measurement arrival.
+  double mean_period_{0.};                                                ///< Smoothed measurement period, in seconds.
+  double mean_duration_{0.};                                              ///< Smoothed update duration, in seconds.
+  std::size_t arrival_count_{0U};                                         ///< Measurements seen so far.
+  std::size_t stride_{1U};                                                ///< Only every stride-th arrival is admitted.
+  std::size_t overload_streak_{0U};                                       ///< Consecutive over-budget updates.
+  std::size_t recovery_streak_{0U};                                       ///< Consecutive under-budget updates.
+};
+
 /// Base AMCL lifecycle node, with some basic common functionalities, such as transform tree utilities, common
 /// publishers, subscribers, lifecycle related callbacks and configuration points, enabling extension by inheritance.
 class BaseAMCLNode : public rclcpp_lifecycle::LifecycleNode {
@@ -112,20 +250,59 @@ class BaseAMCLNode : public rclcpp_lifecycle::LifecycleNode {
   /// Extra steps for (re)initialization messages.
   virtual void do_initial_pose_callback(
       [[maybe_unused]] geometry_msgs::msg::PoseWithCovarianceStamped::SharedPtr message) {}
+  /// Fill in filter performance diagnostics for the periodic diagnostics publisher.
+  /**
+   * \param status Diagnostic status to append key-value pairs to.
+   * \return True if there are diagnostics worth publishing, false otherwise (nothing is published then).
+   */
+  virtual bool do_collect_diagnostics([[maybe_unused]] diagnostic_msgs::msg::DiagnosticStatus& status) { return false; }
 
   /// Callback for (re)initialization messages.
   void initial_pose_callback(geometry_msgs::msg::PoseWithCovarianceStamped::SharedPtr message);
 
+  /// Callback for the periodic filter diagnostics updates.
+  void diagnostics_timer_callback();
+
+  /// Callback for the estimate output timer, publishing the freshest staged estimate.
+  void estimate_output_timer_callback();
+
+  /// Callback for the fixed-rate TF broadcast timer, re-stamping and re-broadcasting the last known transform.
+  void tf_broadcast_timer_callback();
+
+  /// Append a key-value pair to a diagnostic status message.
+  template <class ValueT>
+  static void add_diagnostic(diagnostic_msgs::msg::DiagnosticStatus& status, std::string key, const ValueT& value) {
+    auto& key_value = status.values.emplace_back();
+    key_value.key = std::move(key);
+    if constexpr (std::is_arithmetic_v<ValueT>) {
+      key_value.value = std::to_string(value);
+    } else {
+      key_value.value = value;
+    }
+  }
+
   /// Particle cloud publisher.
   rclcpp_lifecycle::LifecyclePublisher<geometry_msgs::msg::PoseArray>::SharedPtr particle_cloud_pub_;
   /// Particle markers publisher.
   rclcpp_lifecycle::LifecyclePublisher<visualization_msgs::msg::MarkerArray>::SharedPtr particle_markers_pub_;
   /// Estimated pose publisher.
   rclcpp_lifecycle::LifecyclePublisher<geometry_msgs::msg::PoseWithCovarianceStamped>::SharedPtr pose_pub_;
+  /// Filter performance diagnostics publisher.
+  rclcpp_lifecycle::LifecyclePublisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr diagnostics_pub_;
   /// Node bond with the lifecycle manager.
   std::unique_ptr<bond::Bond> bond_;
   /// Timer for periodic particle cloud updates.
   rclcpp::TimerBase::SharedPtr timer_;
+  /// Timer for periodic filter diagnostics updates.
+  rclcpp::TimerBase::SharedPtr diagnostics_timer_;
+  /// Staged estimate outputs, written by the filter execution context and drained by the estimate output timer.
+  TripleBuffer<EstimateOutput> estimate_output_buffer_;
+  /// Timer publishing staged estimate outputs.
+  rclcpp::TimerBase::SharedPtr estimate_output_timer_;
+  /// Timer re-broadcasting the last known map-to-odom transform at a fixed rate.
+  rclcpp::TimerBase::SharedPtr tf_broadcast_timer_;
+  /// Last broadcast map-to-odom transform, re-stamped by the TF broadcast timer in between updates.
+  std::optional<geometry_msgs::msg::TransformStamped> last_broadcast_transform_;
   /// Transforms buffer.
   std::unique_ptr<tf2_ros::Buffer> tf_buffer_;
   /// Transforms broadcaster.
@@ -140,6 +317,8 @@ class BaseAMCLNode : public rclcpp_lifecycle::LifecycleNode {
   rclcpp::SubscriptionOptions common_subscription_options_;
   /// Pose (re)initialization subscription.
   rclcpp::Subscription<geometry_msgs::msg::PoseWithCovarianceStamped>::SharedPtr initial_pose_sub_;
+  /// Measurement admission policy for overload protection; disengaged unless enabled by parameter.
+  std::optional<MeasurementAdmissionPolicy> measurement_admission_;
 };
 }  // namespace beluga_amcl
 #endif
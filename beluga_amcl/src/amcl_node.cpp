@@ -12,19 +12,25 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <execution>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ratio>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <utility>
+#include <variant>
 
 #include <tf2/convert.hpp>
 #include <tf2/exceptions.hpp>
@@ -39,6 +45,7 @@
 
 #include <Eigen/Core>
 #include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcpp"
@@ -179,6 +186,27 @@ AmclNode::AmclNode(const rclcpp::NodeOptions& options) : BaseAMCLNode{"amcl", ""
     declare_parameter("always_reset_initial_pose", false, descriptor);
   }
 
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Whether to correct each laser scan for the robot motion over the scan sweep, "
+        "using odometry at the first and last beam times.";
+    declare_parameter("deskew_scans", false, descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Particle count at or above which updates run in parallel when execution_policy is auto.";
+    descriptor.integer_range.resize(1);
+    descriptor.integer_range[0].from_value = 1;
+    descriptor.integer_range[0].to_value = std::numeric_limits<int64_t>::max();
+    descriptor.integer_range[0].step = 0;
+    declare_parameter(
+        "parallel_execution_threshold", static_cast<int64_t>(beluga_ros::AutoExecutionPolicy{}.parallel_threshold),
+        descriptor);
+  }
+
   {
     auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
     descriptor.description =
@@ -194,6 +222,42 @@ AmclNode::AmclNode(const rclcpp::NodeOptions& options) : BaseAMCLNode{"amcl", ""
         "increase resource usage and potentially degrade performance.";
     declare_parameter("debug", false, descriptor);
   }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Maximum number of particles published for visualization. Above this size the "
+        "particle cloud is decimated by weight-proportional sampling and the particle "
+        "markers are reduced to cluster centroids. Set to zero to always publish the "
+        "full particle set.";
+    descriptor.integer_range.resize(1);
+    descriptor.integer_range[0].from_value = 0;
+    descriptor.integer_range[0].to_value = std::numeric_limits<int>::max();
+    descriptor.integer_range[0].step = 1;
+    declare_parameter("max_particle_cloud_size", 2000, descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Side, in meters, of a square region of interest centered on the last "
+        "known pose estimate. Published likelihood fields and particle clouds "
+        "are cropped to it before message assembly. Set to zero to always "
+        "publish over the full map extent.";
+    descriptor.floating_point_range.resize(1);
+    descriptor.floating_point_range[0].from_value = 0;
+    descriptor.floating_point_range[0].to_value = std::numeric_limits<double>::max();
+    descriptor.floating_point_range[0].step = 0;
+    declare_parameter("visualization_roi_size", 0.0, descriptor);
+  }
+
+#if RCLCPP_VERSION_GTE(17, 0, 0)
+  // Registered through the interface directly, which predates the lifecycle node facade
+  // for post-set callbacks. Committed values are visible inside the callback, so the
+  // model and filter builders can read them through get_parameter() as usual.
+  post_set_parameters_handle_ = get_node_parameters_interface()->add_post_set_parameters_callback(
+      std::bind(&AmclNode::parameters_update_callback, this, std::placeholders::_1));
+#endif
 }
 
 AmclNode::~AmclNode() {
@@ -202,18 +266,32 @@ AmclNode::~AmclNode() {
   on_shutdown(get_current_state());
 }
 
+void AmclNode::subscribe_to_map() {
+  if (map_sub_) {
+    return;
+  }
+  map_sub_ = create_subscription<nav_msgs::msg::OccupancyGrid>(
+      get_parameter("map_topic").as_string(), rclcpp::QoS(rclcpp::KeepLast(1)).transient_local().reliable(),
+      std::bind(&AmclNode::map_callback, this, std::placeholders::_1), common_subscription_options_);
+  RCLCPP_INFO(get_logger(), "Subscribed to map_topic: %s", map_sub_->get_topic_name());
+}
+
+void AmclNode::do_configure(const rclcpp_lifecycle::State&) {
+  // Subscribing at configure time lets a transient-local map server deliver the map
+  // as soon as this transition returns, so the particle filter and its likelihood
+  // field are built on the map worker thread while the remaining ROS entities are
+  // set up, instead of only after the activate transition.
+  subscribe_to_map();
+}
+
 void AmclNode::do_activate(const rclcpp_lifecycle::State&) {
   // Ensure likelihood field publisher is (re)activated early enough.
   if (likelihood_field_pub_) {
     likelihood_field_pub_->on_activate();
   }
 
-  {
-    map_sub_ = create_subscription<nav_msgs::msg::OccupancyGrid>(
-        get_parameter("map_topic").as_string(), rclcpp::QoS(rclcpp::KeepLast(1)).transient_local().reliable(),
-        std::bind(&AmclNode::map_callback, this, std::placeholders::_1), common_subscription_options_);
-    RCLCPP_INFO(get_logger(), "Subscribed to map_topic: %s", map_sub_->get_topic_name());
-  }
+  // Re-create the map subscription when reactivating after a deactivation.
+  subscribe_to_map();
 
   const auto sensor_qos = [] {
     if constexpr (BELUGA_AMCL_MESSAGE_FILTERS_VERSION_GTE(7, 2, 1)) {
@@ -223,6 +301,13 @@ void AmclNode::do_activate(const rclcpp_lifecycle::State&) {
     }
   }();
 
+  // Request intra-process zero-copy transport for sensor data, so same-process
+  // publishers (composed drivers, rosbag playback) hand messages over without
+  // serialization. The common options are left untouched because intra-process
+  // delivery is incompatible with the map subscription's transient-local durability.
+  auto sensor_subscription_options = common_subscription_options_;
+  sensor_subscription_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+
   const auto scan_topic = get_parameter("scan_topic").as_string();
   const auto point_cloud_topic = get_parameter("point_cloud_topic").as_string();
 
@@ -233,7 +318,7 @@ void AmclNode::do_activate(const rclcpp_lifecycle::State&) {
 
   if (!point_cloud_topic.empty()) {
     point_cloud_sub_ = std::make_unique<message_filters::Subscriber<sensor_msgs::msg::PointCloud2>>(
-        shared_from_this(), point_cloud_topic, sensor_qos, common_subscription_options_);
+        shared_from_this(), point_cloud_topic, sensor_qos, sensor_subscription_options);
 
     point_cloud_filter_ = std::make_unique<tf2_ros::MessageFilter<sensor_msgs::msg::PointCloud2>>(
         *point_cloud_sub_, *tf_buffer_, get_parameter("odom_frame_id").as_string(), 10, get_node_logging_interface(),
@@ -248,7 +333,7 @@ void AmclNode::do_activate(const rclcpp_lifecycle::State&) {
       RCLCPP_INFO(get_logger(), "No scan_topic specified, defaulting to: %s", effective_scan_topic.c_str());
     }
     laser_scan_sub_ = std::make_unique<message_filters::Subscriber<sensor_msgs::msg::LaserScan>>(
-        shared_from_this(), effective_scan_topic, sensor_qos, common_subscription_options_);
+        shared_from_this(), effective_scan_topic, sensor_qos, sensor_subscription_options);
 
     laser_scan_filter_ = std::make_unique<tf2_ros::MessageFilter<sensor_msgs::msg::LaserScan>>(
         *laser_scan_sub_, *tf_buffer_, get_parameter("odom_frame_id").as_string(), 10, get_node_logging_interface(),
@@ -282,6 +367,12 @@ void AmclNode::do_activate(const rclcpp_lifecycle::State&) {
           std::placeholders::_3),
       common_service_qos, common_callback_group_);
   RCLCPP_INFO(get_logger(), "Created request_nomotion_update service");
+
+  // Run filter updates on a dedicated thread, fed by the measurement mailbox. Started
+  // last so that nothing is left running if activation fails partway. Any measurement
+  // deposited in the meantime is simply picked up on the first loop iteration.
+  filter_thread_stop_ = false;
+  filter_thread_ = std::thread(&AmclNode::filter_thread_loop, this);
 }
 
 void AmclNode::do_deactivate(const rclcpp_lifecycle::State&) {
@@ -301,14 +392,48 @@ void AmclNode::do_deactivate(const rclcpp_lifecycle::State&) {
     point_cloud_filter_.reset();
     point_cloud_sub_.reset();
   }
+  // Stop the filter thread once no more sensor data can be enqueued.
+  if (filter_thread_.joinable()) {
+    {
+      const std::lock_guard<std::mutex> lock{filter_thread_mutex_};
+      filter_thread_stop_ = true;
+      pending_measurement_.reset();
+      latest_measurement_.reset();
+    }
+    filter_thread_condition_.notify_one();
+    filter_thread_.join();
+  }
+  // Drop the cached extrinsic so a reactivation re-resolves it, picking up any
+  // static transform or frame parameter changes made while inactive.
+  cached_sensor_pose_in_base_.reset();
+  // Wait for any in-flight map rebuild; the filter it updates must outlive it.
+  if (map_update_thread_.joinable()) {
+    map_update_thread_.join();
+  }
+  // Likewise for any in-flight parameter-driven rebuild; it can no longer be
+  // respawned once the filter thread has stopped.
+  if (parameter_update_thread_.joinable()) {
+    parameter_update_thread_.join();
+  }
+  // Likewise for any in-flight global localization preparation.
+  if (global_localization_thread_.joinable()) {
+    global_localization_thread_.join();
+  }
   if (likelihood_field_pub_) {
     likelihood_field_pub_->on_deactivate();
   }
 }
 
 void AmclNode::do_cleanup(const rclcpp_lifecycle::State&) {
+  // A map received while merely configured may still have a filter build in flight;
+  // it must finish before the filter handle is released.
+  if (map_update_thread_.joinable()) {
+    map_update_thread_.join();
+  }
   // Release all resources.
+  map_sub_.reset();
   particle_filter_.reset();
+  last_known_map_.reset();
   enable_tf_broadcast_ = false;
   likelihood_field_pub_.reset();
 }
@@ -399,8 +524,7 @@ auto AmclNode::get_sensor_model(std::string_view name, nav_msgs::msg::OccupancyG
   throw std::invalid_argument(std::string("Invalid sensor model: ") + std::string(name));
 }
 
-auto AmclNode::make_particle_filter(nav_msgs::msg::OccupancyGrid::SharedPtr map) const
-    -> std::unique_ptr<beluga_ros::Amcl> {
+auto AmclNode::make_filter_params() const -> beluga_ros::AmclParams {
   auto params = beluga_ros::AmclParams{};
   params.update_min_d = get_parameter("update_min_d").as_double();
   params.update_min_a = get_parameter("update_min_a").as_double();
@@ -415,18 +539,153 @@ auto AmclNode::make_particle_filter(nav_msgs::msg::OccupancyGrid::SharedPtr map)
   params.spatial_resolution_x = get_parameter("spatial_resolution_x").as_double();
   params.spatial_resolution_y = get_parameter("spatial_resolution_y").as_double();
   params.spatial_resolution_theta = get_parameter("spatial_resolution_theta").as_double();
+  return params;
+}
+
+auto AmclNode::make_particle_filter(nav_msgs::msg::OccupancyGrid::SharedPtr map) const
+    -> std::unique_ptr<beluga_ros::Amcl> {
+  // The auto mode picks seq or par per update from the particle count; it only exists
+  // for this filter, so it is resolved here instead of in the common policy getter.
+  auto execution_policy = [this]() -> beluga_ros::Amcl::execution_policy_variant {
+    if (get_parameter("execution_policy").as_string() == "auto") {
+      auto policy = beluga_ros::AutoExecutionPolicy{};
+      policy.parallel_threshold = static_cast<std::size_t>(get_parameter("parallel_execution_threshold").as_int());
+      return policy;
+    }
+    return std::visit(
+        [](auto policy) -> beluga_ros::Amcl::execution_policy_variant { return policy; }, get_execution_policy());
+  }();
 
   return std::make_unique<beluga_ros::Amcl>(
       beluga_ros::OccupancyGrid{map},                                        //
       get_motion_model(get_parameter("robot_model_type").as_string()),       //
       get_sensor_model(get_parameter("laser_model_type").as_string(), map),  //
-      params,                                                                //
-      get_execution_policy());
+      make_filter_params(),                                                  //
+      std::move(execution_policy));
+}
+
+void AmclNode::parameters_update_callback(const std::vector<rclcpp::Parameter>& parameters) {
+  // Parameters feeding beluga_ros::AmclParams, applied in place through update_params().
+  static constexpr auto kFilterParamNames = std::array<std::string_view, 12>{
+      "update_min_d",        "update_min_a",         "resample_interval",    "min_particles",
+      "max_particles",       "recovery_alpha_slow",  "recovery_alpha_fast",  "pf_err",
+      "pf_z",                "spatial_resolution_x", "spatial_resolution_y", "spatial_resolution_theta"};
+  // Parameters feeding the motion model, which is cheap to rebuild and swap in place.
+  static constexpr auto kMotionModelParamNames =
+      std::array<std::string_view, 6>{"robot_model_type", "alpha1", "alpha2", "alpha3", "alpha4", "alpha5"};
+  // Parameters feeding the sensor model, which is rebuilt against the last known map
+  // on a worker thread and swapped in between updates.
+  static constexpr auto kSensorModelParamNames = std::array<std::string_view, 10>{
+      "laser_model_type", "laser_likelihood_max_dist", "laser_max_range", "z_hit",     "z_rand",
+      "z_max",            "z_short",                   "lambda_short",    "sigma_hit", "model_unknown_space"};
+  // Parameters baked into the filter instance itself, requiring a full reconstruction.
+  static constexpr auto kStructuralParamNames =
+      std::array<std::string_view, 2>{"execution_policy", "parallel_execution_threshold"};
+
+  auto updates = PendingParameterUpdates{};
+  for (const auto& parameter : parameters) {
+    const auto matches = [&parameter](const auto& names) {
+      return std::find(names.begin(), names.end(), parameter.get_name()) != names.end();
+    };
+    updates.filter_params |= matches(kFilterParamNames);
+    updates.motion_model |= matches(kMotionModelParamNames);
+    updates.sensor_model |= matches(kSensorModelParamNames);
+    updates.filter_structure |= matches(kStructuralParamNames);
+  }
+  if (!updates.any()) {
+    return;
+  }
+  {
+    const std::lock_guard<std::mutex> lock{filter_thread_mutex_};
+    pending_parameter_updates_.filter_params |= updates.filter_params;
+    pending_parameter_updates_.motion_model |= updates.motion_model;
+    pending_parameter_updates_.sensor_model |= updates.sensor_model;
+    pending_parameter_updates_.filter_structure |= updates.filter_structure;
+  }
+  filter_thread_condition_.notify_one();
+}
+
+void AmclNode::apply_pending_parameter_updates(const PendingParameterUpdates& updates) {
+  // At most one parameter-driven rebuild may be in flight; waiting for it also
+  // guarantees the changes below never hit a model about to be replaced. No locks
+  // are held here, so the worker is free to finish its own locked swap.
+  if (parameter_update_thread_.joinable()) {
+    parameter_update_thread_.join();
+  }
+
+  auto map = nav_msgs::msg::OccupancyGrid::SharedPtr{};
+  {
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    if (!particle_filter_) {
+      return;  // parameters are read when the filter is first built
+    }
+    map = last_known_map_;
+    // A full reconstruction below re-reads every parameter, so the cheap in-place
+    // paths only run when the filter instance itself survives the change.
+    if (updates.filter_params && !updates.filter_structure) {
+      particle_filter_->update_params(make_filter_params());
+      RCLCPP_INFO(get_logger(), "Filter parameters updated in place");
+    }
+    if (updates.motion_model && !updates.filter_structure) {
+      try {
+        particle_filter_->update_motion_model(get_motion_model(get_parameter("robot_model_type").as_string()));
+        RCLCPP_INFO(get_logger(), "Motion model updated in place");
+      } catch (const std::invalid_argument& error) {
+        RCLCPP_ERROR(get_logger(), "Could not update the motion model: %s", error.what());
+      }
+    }
+  }
+
+  if ((!updates.sensor_model && !updates.filter_structure) || !map) {
+    return;
+  }
+
+  if (updates.filter_structure) {
+    // The execution policy is baked into the filter instance, so changing it pays a
+    // full reconstruction on the worker thread — but the current particle population
+    // is carried over through the staging mechanism, so localization is preserved.
+    parameter_update_thread_ = std::thread([this, map = std::move(map)]() mutable {
+      RCLCPP_INFO(get_logger(), "Rebuilding the particle filter after a structural parameter change");
+      try {
+        auto particle_filter = make_particle_filter(std::move(map));
+        const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+        auto particles = particle_filter_->particles();
+        particle_filter->stage_particles(std::move(particles));
+        particle_filter_ = std::move(particle_filter);
+      } catch (const std::invalid_argument& error) {
+        RCLCPP_ERROR(get_logger(), "Could not rebuild the particle filter: %s", error.what());
+        return;
+      }
+      publish_likelihood_field();
+    });
+    return;
+  }
+
+  // Rebuild the sensor model (and potentially its likelihood field) against the
+  // current map on the worker thread and swap it into the filter between updates,
+  // exactly as a map change does, preserving the particle population.
+  parameter_update_thread_ = std::thread([this, map = std::move(map)]() mutable {
+    try {
+      auto sensor_model = get_sensor_model(get_parameter("laser_model_type").as_string(), std::move(map));
+      const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+      particle_filter_->update_sensor_model(std::move(sensor_model));
+    } catch (const std::invalid_argument& error) {
+      RCLCPP_ERROR(get_logger(), "Could not update the sensor model: %s", error.what());
+      return;
+    }
+    RCLCPP_INFO(get_logger(), "Sensor model rebuilt with the new parameters");
+    publish_likelihood_field();
+  });
 }
 
 void AmclNode::map_callback(nav_msgs::msg::OccupancyGrid::SharedPtr map) {
   RCLCPP_INFO(get_logger(), "A new map was received");
 
+  // At most one build or rebuild in flight; newer maps wait for the current one.
+  if (map_update_thread_.joinable()) {
+    map_update_thread_.join();
+  }
+
   if (particle_filter_ && get_parameter("first_map_only").as_bool()) {
     RCLCPP_WARN(get_logger(), "Ignoring new map because the particle filter has already been initialized");
     return;
@@ -439,46 +698,100 @@ void AmclNode::map_callback(nav_msgs::msg::OccupancyGrid::SharedPtr map) {
         map->header.frame_id.c_str(), global_frame_id.c_str());
   }
 
+  {
+    // Retained so sensor models can be rebuilt against it when their parameters change.
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    last_known_map_ = map;
+  }
+
   const bool should_reset_initial_pose = get_parameter("always_reset_initial_pose").as_bool() ||  //
                                          (!particle_filter_ && !last_known_estimate_.has_value());
 
   if (!particle_filter_) {
-    try {
+    // Build the first filter (and its likelihood field) on a worker thread as well,
+    // so this callback returns immediately and the executor keeps serving bond
+    // heartbeats and lifecycle transitions while a large field is under
+    // construction; readiness is reported when the build completes.
+    map_update_thread_ = std::thread([this, map = std::move(map), should_reset_initial_pose]() mutable {
       RCLCPP_INFO(get_logger(), "Initializing particle filter instance");
-      particle_filter_ = make_particle_filter(std::move(map));
+      try {
+        auto particle_filter = make_particle_filter(std::move(map));
+        const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+        particle_filter_ = std::move(particle_filter);
+      } catch (const std::invalid_argument& error) {
+        RCLCPP_ERROR(get_logger(), "Could not initialize particle filter: %s", error.what());
+        return;
+      }
+      if (get_parameter("debug").as_bool() && particle_filter_->has_likelihood_field()) {
+        auto qos = rclcpp::SystemDefaultsQoS();
+        qos.reliable().transient_local();
+        likelihood_field_pub_ = create_publisher<nav_msgs::msg::OccupancyGrid>("likelihood_field", qos);
+        // Activate publisher immediately, we are likely past the activation phase.
+        likelihood_field_pub_->on_activate();
+      }
       RCLCPP_INFO(get_logger(), "Particle filter initialization completed");
+      publish_likelihood_field();
+      reinitialize_with_new_map(should_reset_initial_pose);
+    });
+    return;
+  }
+
+  // Rebuild the sensor model against the new map on a background thread and swap
+  // it into the filter between updates, so localization keeps running on the old
+  // map while the replacement (and its likelihood field) is under construction.
+  map_update_thread_ = std::thread([this, map = std::move(map), should_reset_initial_pose]() mutable {
+    try {
+      auto sensor_model = get_sensor_model(get_parameter("laser_model_type").as_string(), map);
+      const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+      particle_filter_->update_map(beluga_ros::OccupancyGrid{std::move(map)}, std::move(sensor_model));
     } catch (const std::invalid_argument& error) {
-      RCLCPP_ERROR(get_logger(), "Could not initialize particle filter: %s", error.what());
+      RCLCPP_ERROR(get_logger(), "Could not update the map: %s", error.what());
       return;
     }
-    if (get_parameter("debug").as_bool() && particle_filter_->has_likelihood_field()) {
-      auto qos = rclcpp::SystemDefaultsQoS();
-      qos.reliable().transient_local();
-      likelihood_field_pub_ = create_publisher<nav_msgs::msg::OccupancyGrid>("likelihood_field", qos);
-      // Activate publisher immediately, we are likely past the activation phase.
-      likelihood_field_pub_->on_activate();
+    RCLCPP_INFO(get_logger(), "Sensor model rebuilt against the new map");
+    publish_likelihood_field();
+    reinitialize_with_new_map(should_reset_initial_pose);
+  });
+}
+
+void AmclNode::publish_likelihood_field() {
+  if (!likelihood_field_pub_) {
+    return;
+  }
+  const auto roi_size = get_parameter("visualization_roi_size").as_double();
+  auto message = nav_msgs::msg::OccupancyGrid{};
+  {
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    if (roi_size > 0.0 && last_known_estimate_.has_value()) {
+      // Crop to the configured window around the estimate. Serializing an entire
+      // large field can take on the order of a second and this runs with the
+      // filter mutex held.
+      beluga_ros::assign_likelihood_field(
+          particle_filter_->likelihood_field(), particle_filter_->likelihood_field_origin(),
+          last_known_estimate_->first.translation(), roi_size, message);
+    } else {
+      beluga_ros::assign_likelihood_field(
+          particle_filter_->likelihood_field(), particle_filter_->likelihood_field_origin(), message);
     }
-  } else {
-    particle_filter_->update_map(beluga_ros::OccupancyGrid{std::move(map)});
   }
+  beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), message);
+  likelihood_field_pub_->publish(message);
+}
 
-  if (likelihood_field_pub_) {
-    auto message = nav_msgs::msg::OccupancyGrid{};
-    beluga_ros::assign_likelihood_field(
-        particle_filter_->likelihood_field(), particle_filter_->likelihood_field_origin(), message);
-    beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), message);
-    likelihood_field_pub_->publish(message);
-  }
-
-  if (should_reset_initial_pose) {
-    const auto initial_estimate = get_initial_estimate();
-    if (initial_estimate.has_value()) {
-      last_known_estimate_ = initial_estimate;
-      last_known_odom_transform_in_map_.reset();
+void AmclNode::reinitialize_with_new_map(bool should_reset_initial_pose) {
+  const auto last_known_estimate = [this, should_reset_initial_pose] {
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    if (should_reset_initial_pose) {
+      const auto initial_estimate = get_initial_estimate();
+      if (initial_estimate.has_value()) {
+        last_known_estimate_ = initial_estimate;
+        last_known_odom_transform_in_map_.reset();
+      }
     }
-  }
+    return last_known_estimate_;
+  }();
 
-  if (last_known_estimate_.has_value() && initialize_from_estimate(last_known_estimate_.value())) {
+  if (last_known_estimate.has_value() && initialize_from_estimate(last_known_estimate.value())) {
     return;  // Success!
   }
 
@@ -486,27 +799,102 @@ void AmclNode::map_callback(nav_msgs::msg::OccupancyGrid::SharedPtr map) {
 
   // TF broadcasting should be enabled only if we initialize from an estimate or in response
   // to external global localization requests, and not during the initial setup of the filter.
-  enable_tf_broadcast_ = false;
+  {
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    enable_tf_broadcast_ = false;
+  }
 }
 
 void AmclNode::do_periodic_timer_callback() {
-  if (!particle_filter_) {
+  const bool publish_cloud = particle_cloud_pub_->get_subscription_count() > 0;
+  const bool publish_markers = particle_markers_pub_->get_subscription_count() > 0;
+  if (!publish_cloud && !publish_markers) {
     return;
   }
 
-  if (particle_cloud_pub_->get_subscription_count() > 0) {
-    auto message = geometry_msgs::msg::PoseArray{};
-    beluga_ros::assign_particle_cloud(particle_filter_->particles(), message);
-    beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), message);
-    particle_cloud_pub_->publish(message);
+  // The snapshot decouples message assembly from the filter: the mutex is only
+  // held to grab a shared pointer, not for the whole serialization work below.
+  beluga_ros::Amcl::ParticleSnapshot snapshot;
+  std::optional<std::pair<Sophus::SE2d, Eigen::Matrix3d>> last_known_estimate;
+  {
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    if (!particle_filter_) {
+      return;
+    }
+    snapshot = particle_filter_->particles_snapshot();
+    last_known_estimate = last_known_estimate_;
+  }
+
+  // Visualization rarely needs the full particle set. Past the configured size
+  // the pose array is decimated by weight-proportional sampling and the marker
+  // array is reduced to cluster centroids.
+  const auto max_cloud_size = static_cast<std::size_t>(get_parameter("max_particle_cloud_size").as_int());
+  const auto roi_size = get_parameter("visualization_roi_size").as_double();
+
+  // Messages come from reuse pools so their buffers keep their capacity from
+  // one period to the next instead of being reallocated on every publish.
+  const auto publish = [this, publish_cloud, publish_markers, max_cloud_size](const auto& particles) {
+    const bool reduce = max_cloud_size > 0 && particles.size() > max_cloud_size;
+    if (publish_cloud) {
+      const auto message = particle_cloud_pool_.acquire();
+      if (reduce) {
+        beluga_ros::assign_particle_cloud(particles, max_cloud_size, *message);
+      } else {
+        beluga_ros::assign_particle_cloud(particles, *message);
+      }
+      beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), *message);
+      particle_cloud_pub_->publish(*message);
+    }
+    if (publish_markers) {
+      const auto message = particle_markers_pool_.acquire();
+      if (reduce) {
+        beluga_ros::assign_particle_cloud(beluga_ros::particle_cloud_centroids(particles), *message);
+      } else {
+        beluga_ros::assign_particle_cloud(particles, *message);
+      }
+      beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), *message);
+      particle_markers_pub_->publish(*message);
+    }
+  };
+
+  if (roi_size > 0.0 && last_known_estimate.has_value()) {
+    // Crop to the configured window around the estimate before any decimation.
+    publish(beluga_ros::particle_cloud_region_of_interest(
+        *snapshot.particles, last_known_estimate->first, roi_size));
+  } else {
+    publish(*snapshot.particles);
+  }
+}
+
+bool AmclNode::do_collect_diagnostics(diagnostic_msgs::msg::DiagnosticStatus& status) {
+  bool measurement_pending = false;
+  {
+    const std::lock_guard<std::mutex> lock{filter_thread_mutex_};
+    measurement_pending = pending_measurement_.has_value();
   }
 
-  if (particle_markers_pub_->get_subscription_count() > 0) {
-    auto message = visualization_msgs::msg::MarkerArray{};
-    beluga_ros::assign_particle_cloud(particle_filter_->particles(), message);
-    beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), message);
-    particle_markers_pub_->publish(message);
+  const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+  if (!particle_filter_ || !last_update_duration_.has_value()) {
+    return false;
   }
+
+  using std::chrono::duration;
+  add_diagnostic(status, "update_time_ms", duration<double, std::milli>(*last_update_duration_).count());
+  if (const auto& stats = particle_filter_->last_update_stats(); stats.has_value()) {
+    add_diagnostic(status, "pipeline_time_ms", duration<double, std::milli>(stats->pipeline_duration).count());
+    add_diagnostic(status, "resample_time_ms", duration<double, std::milli>(stats->resample_duration).count());
+    add_diagnostic(status, "particle_count", stats->particle_count);
+    add_diagnostic(status, "effective_sample_size", stats->effective_sample_size);
+    add_diagnostic(status, "random_state_probability", stats->random_state_probability);
+    add_diagnostic(status, "recovery_slow_average", stats->recovery_slow_average);
+    add_diagnostic(status, "recovery_fast_average", stats->recovery_fast_average);
+    add_diagnostic(status, "resampled", stats->resampled ? "true" : "false");
+  }
+  add_diagnostic(status, "measurement_queue_depth", measurement_pending ? 1 : 0);
+  if (measurement_admission_.has_value()) {
+    add_diagnostic(status, "measurement_admission_stride", measurement_admission_->stride());
+  }
+  return true;
 }
 
 template <typename TransformT>
@@ -526,11 +914,28 @@ std::optional<TransformT> AmclNode::lookup_transform(
   }
 }
 
+std::optional<Sophus::SE3d> AmclNode::get_sensor_pose_in_base(
+    const std::string& sensor_frame_id,
+    const tf2::TimePoint& stamp) {
+  auto base_frame_id = get_parameter("base_frame_id").as_string();
+  if (cached_sensor_pose_in_base_.has_value() &&  //
+      cached_sensor_frame_id_ == sensor_frame_id && cached_base_frame_id_ == base_frame_id) {
+    return cached_sensor_pose_in_base_;
+  }
+  auto sensor_pose_in_base = lookup_transform<Sophus::SE3d>(base_frame_id, sensor_frame_id, stamp);
+  if (sensor_pose_in_base.has_value()) {
+    // Only successful resolutions are cached, so transient tf outages keep retrying.
+    cached_sensor_pose_in_base_ = sensor_pose_in_base;
+    cached_sensor_frame_id_ = sensor_frame_id;
+    cached_base_frame_id_ = std::move(base_frame_id);
+  }
+  return sensor_pose_in_base;
+}
+
 std::optional<beluga_ros::LaserScan> AmclNode::wrap_sensor_data(
     const sensor_msgs::msg::LaserScan::ConstSharedPtr& sensor_msg) {
-  auto sensor_pose_in_base = lookup_transform<Sophus::SE3d>(
-      get_parameter("base_frame_id").as_string(), sensor_msg->header.frame_id,
-      tf2_ros::fromMsg(sensor_msg->header.stamp));
+  auto sensor_pose_in_base =
+      get_sensor_pose_in_base(sensor_msg->header.frame_id, tf2_ros::fromMsg(sensor_msg->header.stamp));
   if (!sensor_pose_in_base.has_value()) {
     RCLCPP_ERROR(get_logger(), "Could not transform from base to sensor");
     return std::nullopt;
@@ -539,14 +944,49 @@ std::optional<beluga_ros::LaserScan> AmclNode::wrap_sensor_data(
   const auto max_beams = static_cast<std::size_t>(get_parameter("max_beams").as_int());
   const double min_range = get_parameter("laser_min_range").as_double();
   const double max_range = get_parameter("laser_max_range").as_double();
-  return beluga_ros::LaserScan{sensor_msg, sensor_pose_in_base.value(), max_beams, min_range, max_range};
+  auto laser_scan = beluga_ros::LaserScan{sensor_msg, sensor_pose_in_base.value(), max_beams, min_range, max_range};
+  if (get_parameter("deskew_scans").as_bool()) {
+    deskew_scan(*sensor_msg, sensor_pose_in_base.value(), laser_scan);
+  }
+  return laser_scan;
+}
+
+void AmclNode::deskew_scan(
+    const sensor_msgs::msg::LaserScan& sensor_msg,
+    const Sophus::SE3d& sensor_pose_in_base,
+    beluga_ros::LaserScan& laser_scan) {
+  const auto beam_count = sensor_msg.ranges.size();
+  auto sweep_duration =
+      static_cast<double>(sensor_msg.time_increment) * static_cast<double>(beam_count > 0 ? beam_count - 1 : 0);
+  if (sweep_duration <= 0.) {
+    sweep_duration = static_cast<double>(sensor_msg.scan_time);
+  }
+  if (sweep_duration <= 0.) {
+    return;  // the scan is effectively instantaneous as far as the driver can tell
+  }
+  const auto odom_frame_id = get_parameter("odom_frame_id").as_string();
+  const auto base_frame_id = get_parameter("base_frame_id").as_string();
+  const auto start_stamp = tf2_ros::fromMsg(sensor_msg.header.stamp);
+  const auto end_stamp = start_stamp + tf2::durationFromSec(sweep_duration);
+  const auto start_pose = lookup_transform<Sophus::SE2d>(odom_frame_id, base_frame_id, start_stamp);
+  const auto end_pose = lookup_transform<Sophus::SE2d>(odom_frame_id, base_frame_id, end_stamp);
+  if (!start_pose.has_value() || !end_pose.has_value()) {
+    return;  // lookup_transform already logged the failure; the scan is used as-is
+  }
+  const auto motion_in_base = start_pose->inverse() * end_pose.value();
+  // Conjugate the base motion into the sensor frame through the planar part of the
+  // extrinsic; its out-of-plane part is immaterial to 2D localization anyway.
+  const auto& rotation = sensor_pose_in_base.rotationMatrix();
+  const auto planar_extrinsic = Sophus::SE2d{
+      Sophus::SO2d{std::atan2(rotation(1, 0), rotation(0, 0))},
+      Eigen::Vector2d{sensor_pose_in_base.translation().x(), sensor_pose_in_base.translation().y()}};
+  laser_scan.set_motion_over_sweep(planar_extrinsic.inverse() * motion_in_base * planar_extrinsic);
 }
 
 std::optional<beluga_ros::SparsePointCloud3f> AmclNode::wrap_sensor_data(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr& sensor_msg) {
-  auto sensor_pose_in_base = lookup_transform<Sophus::SE3d>(
-      get_parameter("base_frame_id").as_string(), sensor_msg->header.frame_id,
-      tf2_ros::fromMsg(sensor_msg->header.stamp));
+  auto sensor_pose_in_base =
+      get_sensor_pose_in_base(sensor_msg->header.frame_id, tf2_ros::fromMsg(sensor_msg->header.stamp));
   if (!sensor_pose_in_base.has_value()) {
     RCLCPP_ERROR(get_logger(), "Could not transform from base to sensor");
     return std::nullopt;
@@ -571,12 +1011,59 @@ std::optional<beluga_ros::SparsePointCloud3f> AmclNode::wrap_sensor_data(
 
 template <typename MessageT>
 void AmclNode::sensor_callback(const std::shared_ptr<const MessageT>& sensor_msg) {
+  {
+    // Latest-wins: overwrite any measurement still waiting for the filter thread,
+    // so bursts and overruns coalesce into a single update over the newest data.
+    const std::lock_guard<std::mutex> lock{filter_thread_mutex_};
+    pending_measurement_ = sensor_msg;
+    latest_measurement_ = sensor_msg;  // never consumed; seeds global localization candidates
+  }
+  filter_thread_condition_.notify_one();
+}
+
+void AmclNode::filter_thread_loop() {
+  for (;;) {
+    auto measurement = std::optional<measurement_variant>{};
+    auto parameter_updates = PendingParameterUpdates{};
+    {
+      auto lock = std::unique_lock<std::mutex>{filter_thread_mutex_};
+      filter_thread_condition_.wait(lock, [this] {
+        return filter_thread_stop_ || pending_measurement_.has_value() || pending_parameter_updates_.any();
+      });
+      if (filter_thread_stop_) {
+        break;
+      }
+      measurement.swap(pending_measurement_);
+      std::swap(parameter_updates, pending_parameter_updates_);
+    }
+    if (parameter_updates.any()) {
+      apply_pending_parameter_updates(parameter_updates);
+    }
+    if (measurement.has_value()) {
+      std::visit([this](const auto& sensor_msg) { process_measurement(sensor_msg); }, measurement.value());
+    }
+  }
+}
+
+template <typename MessageT>
+void AmclNode::process_measurement(const std::shared_ptr<const MessageT>& sensor_msg) {
+  const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+
   if (!particle_filter_) {
     RCLCPP_WARN_THROTTLE(
         get_logger(), *get_clock(), 2000, "Ignoring sensor data because the particle filter has not been initialized");
     return;
   }
 
+  // Under sustained overload the admission policy sheds measurements deterministically,
+  // trading update rate for bounded latency. Motion gating still applies to admitted scans.
+  if (measurement_admission_.has_value() && !measurement_admission_->admit(std::chrono::steady_clock::now())) {
+    RCLCPP_WARN_THROTTLE(
+        get_logger(), *get_clock(), 2000, "Skipping measurements under sustained overload, processing 1 out of %zu",
+        measurement_admission_->stride());
+    return;
+  }
+
   auto base_pose_in_odom = lookup_transform<Sophus::SE2d>(
       get_parameter("odom_frame_id").as_string(), get_parameter("base_frame_id").as_string(),
       tf2_ros::fromMsg(sensor_msg->header.stamp));
@@ -596,10 +1083,15 @@ void AmclNode::sensor_callback(const std::shared_ptr<const MessageT>& sensor_msg
   const auto update_stop_time = std::chrono::high_resolution_clock::now();
   const auto update_duration = update_stop_time - update_start_time;
 
+  if (measurement_admission_.has_value()) {
+    measurement_admission_->report_update_duration(update_duration);
+  }
+
   if (new_estimate.has_value()) {
     const auto& [base_pose_in_map, _] = new_estimate.value();
     last_known_odom_transform_in_map_ = base_pose_in_map * base_pose_in_odom->inverse();
     last_known_estimate_ = new_estimate;
+    last_update_duration_ = update_duration;
 
     RCLCPP_INFO(
         get_logger(), "Particle filter update iteration stats: %ld particles %ld points - %.3fms",
@@ -612,7 +1104,11 @@ void AmclNode::sensor_callback(const std::shared_ptr<const MessageT>& sensor_msg
     return;
   }
 
-  // Transforms are always published to keep them current.
+  // Outputs are staged in the lock-free triple buffer and published by the estimate
+  // output timer, so publication latency never blocks the filter thread.
+  auto output = EstimateOutput{};
+
+  // Transforms are always staged to keep them current.
   if (enable_tf_broadcast_ && get_parameter("tf_broadcast").as_bool()) {
     if (last_known_odom_transform_in_map_.has_value()) {
       auto message = geometry_msgs::msg::TransformStamped{};
@@ -623,11 +1119,11 @@ void AmclNode::sensor_callback(const std::shared_ptr<const MessageT>& sensor_msg
       message.header.frame_id = get_parameter("global_frame_id").as_string();
       message.child_frame_id = get_parameter("odom_frame_id").as_string();
       message.transform = tf2::toMsg(*last_known_odom_transform_in_map_);
-      tf_broadcaster_->sendTransform(message);
+      output.transform = std::move(message);
     }
   }
 
-  // New pose messages are only published on updates to the filter.
+  // New pose messages are only staged on updates to the filter.
   if (new_estimate.has_value()) {
     auto message = geometry_msgs::msg::PoseWithCovarianceStamped{};
     message.header.stamp = sensor_msg->header.stamp;
@@ -635,7 +1131,11 @@ void AmclNode::sensor_callback(const std::shared_ptr<const MessageT>& sensor_msg
     const auto& [base_pose_in_map, base_pose_covariance] = new_estimate.value();
     tf2::toMsg(base_pose_in_map, message.pose.pose);
     tf2::covarianceEigenToRowMajor(base_pose_covariance, message.pose.covariance);
-    pose_pub_->publish(message);
+    output.pose = std::move(message);
+  }
+
+  if (output.transform.has_value() || output.pose.has_value()) {
+    estimate_output_buffer_.write(std::move(output));
   }
 }
 
@@ -646,22 +1146,72 @@ void AmclNode::do_initial_pose_callback(geometry_msgs::msg::PoseWithCovarianceSt
   auto covariance = Eigen::Matrix3d{};
   tf2::covarianceRowMajorToEigen(message->pose.covariance, covariance);
 
-  last_known_estimate_ = std::make_pair(pose, covariance);
-  last_known_odom_transform_in_map_.reset();
-  initialize_from_estimate(last_known_estimate_.value());
+  const auto estimate = std::make_pair(pose, covariance);
+  {
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    last_known_estimate_ = estimate;
+    last_known_odom_transform_in_map_.reset();
+  }
+  initialize_from_estimate(estimate);
 }
 
 void AmclNode::global_localization_callback(
     [[maybe_unused]] std::shared_ptr<rmw_request_id_t> request_header,
     [[maybe_unused]] std::shared_ptr<std_srvs::srv::Empty::Request> req,
     [[maybe_unused]] std::shared_ptr<std_srvs::srv::Empty::Response> res) {
-  initialize_from_map();
+  // Prepare the candidate set on a background thread so the filter keeps localizing
+  // on the current hypothesis instead of freezing while hundreds of thousands of
+  // poses are sampled; the candidates are installed at the next update boundary.
+  auto latest_measurement = std::optional<measurement_variant>{};
+  {
+    const std::lock_guard<std::mutex> lock{filter_thread_mutex_};
+    latest_measurement = latest_measurement_;
+  }
+  auto preparer = std::function<beluga::TupleVector<beluga_ros::Amcl::particle_type>()>{};
+  {
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    if (!particle_filter_) {
+      RCLCPP_ERROR(get_logger(), "Could not initialize particles: The particle filter has not been initialized");
+      return;
+    }
+    // Seed the candidates with the latest sensor data when there is any, so the
+    // initial distribution is biased toward poses that score well against it.
+    if (latest_measurement.has_value()) {
+      preparer = std::visit(
+          [this](const auto& sensor_msg) -> std::function<beluga::TupleVector<beluga_ros::Amcl::particle_type>()> {
+            auto sensor_data = wrap_sensor_data(sensor_msg);
+            if (sensor_data.has_value()) {
+              return particle_filter_->make_global_localization_preparer(std::move(sensor_data.value()));
+            }
+            return particle_filter_->make_global_localization_preparer();
+          },
+          latest_measurement.value());
+    } else {
+      preparer = particle_filter_->make_global_localization_preparer();
+    }
+  }
+  if (global_localization_thread_.joinable()) {
+    global_localization_thread_.join();  // at most one preparation in flight; newer requests wait for it
+  }
+  global_localization_thread_ = std::thread([this, preparer = std::move(preparer)]() {
+    auto candidates = preparer();
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    if (!particle_filter_) {
+      return;
+    }
+    particle_filter_->stage_particles(std::move(candidates));
+    enable_tf_broadcast_ = true;
+    RCLCPP_INFO(
+        get_logger(), "Global localization candidates staged; they will replace the particles on the next update");
+  });
 }
 
 void AmclNode::nomotion_update_callback(
     [[maybe_unused]] std::shared_ptr<rmw_request_id_t> request_header,
     [[maybe_unused]] std::shared_ptr<std_srvs::srv::Empty::Request> req,
     [[maybe_unused]] std::shared_ptr<std_srvs::srv::Empty::Response> res) {
+  const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+
   if (!particle_filter_) {
     RCLCPP_WARN(get_logger(), "Ignoring no-motion update request because the particle filter has not been initialized");
     return;
@@ -674,6 +1224,8 @@ void AmclNode::nomotion_update_callback(
 bool AmclNode::initialize_from_estimate(const std::pair<Sophus::SE2d, Eigen::Matrix3d>& estimate) {
   RCLCPP_INFO(get_logger(), "Initializing particles from estimated pose and covariance");
 
+  const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+
   if (!particle_filter_) {
     RCLCPP_ERROR(get_logger(), "Could not initialize particles: The particle filter has not been initialized");
     return false;
@@ -700,6 +1252,8 @@ bool AmclNode::initialize_from_estimate(const std::pair<Sophus::SE2d, Eigen::Mat
 bool AmclNode::initialize_from_map() {
   RCLCPP_INFO(get_logger(), "Initializing particles from map");
 
+  const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+
   if (!particle_filter_) {
     RCLCPP_ERROR(get_logger(), "Could not initialize particles: The particle filter has not been initialized");
     return false;
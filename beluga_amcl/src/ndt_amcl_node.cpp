@@ -108,9 +108,20 @@ NdtAmclNode::NdtAmclNode(const rclcpp::NodeOptions& options) : BaseAMCLNode{"ndt
   }
 }
 
+void NdtAmclNode::do_configure(const rclcpp_lifecycle::State&) {
+  const auto map_path = get_parameter("map_path").as_string();
+  RCLCPP_INFO(get_logger(), "Loading map from %s in the background.", map_path.c_str());
+  map_future_ = beluga::io::load_from_file_async<NDTMapRepresentation>(map_path);
+}
+
 void NdtAmclNode::do_activate(const rclcpp_lifecycle::State&) {
   RCLCPP_INFO(get_logger(), "Making particle filter");
   particle_filter_ = make_particle_filter();
+  std::visit(
+      [this](auto& particle_filter) {
+        particle_filter.instrumentation() = [this](const auto& stats) { last_update_stats_ = stats; };
+      },
+      *particle_filter_);
 
   {
     // Cope with variations in between message_filters versions.
@@ -123,10 +134,17 @@ void NdtAmclNode::do_activate(const rclcpp_lifecycle::State&) {
       }
     }();
 
+    // Request intra-process zero-copy transport for sensor data, so same-process
+    // publishers (composed drivers, rosbag playback) hand messages over without
+    // serialization when this node runs inside a component container.
+    auto laser_scan_subscription_options = common_subscription_options_;
+    laser_scan_subscription_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+
     const auto scan_topic = get_parameter("scan_topic").as_string();  // may default to the empty string
     // TODO(hidmic): rework parameter defaults after rehashing what constitutes common node code
     laser_scan_sub_ = std::make_unique<message_filters::Subscriber<sensor_msgs::msg::LaserScan>>(
-        shared_from_this(), !scan_topic.empty() ? scan_topic : "scan", laser_scan_qos, common_subscription_options_);
+        shared_from_this(), !scan_topic.empty() ? scan_topic : "scan", laser_scan_qos,
+        laser_scan_subscription_options);
 
     // Message filter that caches laser scan readings until it is possible to transform
     // from laser frame to odom frame and update the particle filter.
@@ -158,6 +176,7 @@ void NdtAmclNode::do_cleanup(const rclcpp_lifecycle::State&) {
   particle_cloud_pub_.reset();
   pose_pub_.reset();
   particle_filter_.reset();
+  map_future_ = {};  // waits for and discards any map load still pending
   enable_tf_broadcast_ = false;
 }
 
@@ -219,11 +238,16 @@ beluga::NDTSensorModel<NDTMapRepresentation> NdtAmclNode::get_sensor_model() con
   params.minimum_likelihood = get_parameter("minimum_likelihood").as_double();
   params.d1 = get_parameter("d1").as_double();
   params.d2 = get_parameter("d2").as_double();
+  if (map_future_.valid()) {
+    // Retrieve the map load started at configuration time, blocking only if it is
+    // still in flight.
+    return beluga::NDTSensorModel<NDTMapRepresentation>{params, map_future_.get()};
+  }
+  // No load is pending (e.g. reactivation without an intervening configuration).
   const auto map_path = get_parameter("map_path").as_string();
   RCLCPP_INFO(get_logger(), "Loading map from %s.", map_path.c_str());
-
   return beluga::NDTSensorModel<NDTMapRepresentation>{
-      params, beluga::io::load_from_hdf5<NDTMapRepresentation>(get_parameter("map_path").as_string())};
+      params, beluga::io::load_from_file<NDTMapRepresentation>(map_path)};
 }
 
 auto NdtAmclNode::make_particle_filter() const -> std::unique_ptr<NdtAmclVariant> {
@@ -283,6 +307,26 @@ void NdtAmclNode::do_periodic_timer_callback() {
       *particle_filter_);
 }
 
+bool NdtAmclNode::do_collect_diagnostics(diagnostic_msgs::msg::DiagnosticStatus& status) {
+  if (!particle_filter_ || !last_update_duration_.has_value() || !last_update_stats_.has_value()) {
+    return false;
+  }
+
+  using std::chrono::duration;
+  const auto& stats = *last_update_stats_;
+  add_diagnostic(status, "update_time_ms", duration<double, std::milli>(*last_update_duration_).count());
+  add_diagnostic(status, "propagate_time_ms", duration<double, std::milli>(stats.propagate_duration).count());
+  add_diagnostic(status, "reweight_time_ms", duration<double, std::milli>(stats.reweight_duration).count());
+  add_diagnostic(status, "resample_time_ms", duration<double, std::milli>(stats.resample_duration).count());
+  add_diagnostic(status, "particle_count", stats.particle_count);
+  add_diagnostic(status, "effective_sample_size", stats.effective_sample_size);
+  add_diagnostic(status, "random_state_probability", stats.random_state_probability);
+  add_diagnostic(status, "recovery_slow_average", stats.recovery_slow_average);
+  add_diagnostic(status, "recovery_fast_average", stats.recovery_fast_average);
+  add_diagnostic(status, "resampled", stats.resampled ? "true" : "false");
+  return true;
+}
+
 // TODO(alon): Wouldn't it be better in the callback of each message to simply receive
 // it and define another timer or thread to do the work of calculation and publication?
 void NdtAmclNode::laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr laser_scan) {
@@ -333,7 +377,7 @@ void NdtAmclNode::laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr las
                        return Eigen::Vector2d((scan.origin() * Sophus::Vector3d{p.x(), p.y(), 0}).head<2>());
                      }) |
                      ranges::to<std::vector>;
-  const auto new_estimate = std::visit(
+  const bool filter_updated = std::visit(
       [base_pose_in_odom, measurement = std::move(measurement)](auto& particle_filter) {
         return particle_filter.update(
             base_pose_in_odom,  //
@@ -344,10 +388,12 @@ void NdtAmclNode::laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr las
   const auto update_stop_time = std::chrono::high_resolution_clock::now();
   const auto update_duration = update_stop_time - update_start_time;
 
-  if (new_estimate.has_value()) {
-    const auto& [base_pose_in_map, _] = new_estimate.value();
+  if (filter_updated) {
+    last_update_duration_ = update_duration;
+    last_known_estimate_ =
+        std::visit([](const auto& particle_filter) { return particle_filter.estimate(); }, *particle_filter_);
+    const auto& [base_pose_in_map, _] = last_known_estimate_.value();
     last_known_odom_transform_in_map_ = base_pose_in_map * base_pose_in_odom.inverse();
-    last_known_estimate_ = new_estimate;
 
     const auto num_particles =
         std::visit([](const auto& particle_filter) { return particle_filter.particles().size(); }, *particle_filter_);
@@ -378,11 +424,11 @@ void NdtAmclNode::laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr las
   }
 
   // New pose messages are only published on updates to the filter.
-  if (new_estimate.has_value()) {
+  if (filter_updated) {
     auto message = geometry_msgs::msg::PoseWithCovarianceStamped{};
     message.header.stamp = laser_scan->header.stamp;
     message.header.frame_id = get_parameter("global_frame_id").as_string();
-    const auto& [base_pose_in_map, base_pose_covariance] = new_estimate.value();
+    const auto& [base_pose_in_map, base_pose_covariance] = last_known_estimate_.value();
     tf2::toMsg(base_pose_in_map, message.pose.pose);
     tf2::covarianceEigenToRowMajor(base_pose_covariance, message.pose.covariance);
     pose_pub_->publish(message);
@@ -16,10 +16,13 @@
 #include <sensor_msgs/msg/point_cloud2.h>
 #include <beluga/algorithm/unscented_transform.hpp>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <execution>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <range/v3/view/zip.hpp>
 #include <rclcpp/duration.hpp>
@@ -28,6 +31,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -75,6 +79,7 @@
 #include <beluga_ros/messages.hpp>
 #include <beluga_ros/ndt_ellipsoid.hpp>
 #include <beluga_ros/particle_cloud.hpp>
+#include <beluga_ros/sparse_point_cloud.hpp>
 #include <beluga_ros/tf2_sophus.hpp>
 #include "beluga_amcl/message_filters.hpp"
 #include "beluga_amcl/ndt_amcl_node_3d.hpp"
@@ -150,6 +155,48 @@ NdtAmclNode3D::NdtAmclNode3D(const rclcpp::NodeOptions& options) : BaseAMCLNode{
     descriptor.floating_point_range[0].step = 0;
     declare_parameter("d2", rclcpp::ParameterValue(0.6), descriptor);
   }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Maximum number of points kept per NDT-cell-sized voxel when downsampling "
+        "incoming point clouds. Zero disables downsampling.";
+    descriptor.integer_range.resize(1);
+    descriptor.integer_range[0].from_value = 0;
+    descriptor.integer_range[0].to_value = std::numeric_limits<int>::max();
+    descriptor.integer_range[0].step = 1;
+    declare_parameter("max_points_per_voxel", rclcpp::ParameterValue(0), descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Distance from the map frame origin within which obstacle cells keep one marker each. "
+        "Negative values disable the limit.";
+    declare_parameter("obstacle_markers.roi_radius", rclcpp::ParameterValue(-1.0), descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Distance from the map frame origin beyond which obstacle cells are not visualized. "
+        "Negative values disable the limit.";
+    declare_parameter("obstacle_markers.cull_distance", rclcpp::ParameterValue(-1.0), descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Edge length of the coarse cells distant obstacle cells are merged into, "
+        "as a multiple of the map resolution.";
+    declare_parameter("obstacle_markers.coarsening_factor", rclcpp::ParameterValue(4), descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description = "Hard cap on the number of obstacle markers. Negative values disable the limit.";
+    declare_parameter("obstacle_markers.max_markers", rclcpp::ParameterValue(-1), descriptor);
+  }
 }
 
 void NdtAmclNode3D::do_activate(const rclcpp_lifecycle::State&) {
@@ -158,9 +205,22 @@ void NdtAmclNode3D::do_activate(const rclcpp_lifecycle::State&) {
   map_visualization_pub_->on_activate();
 
   // Publish markers for map visualization
+  auto lod_options = beluga_ros::NdtEllipsoidLodOptions{};
+  if (const double roi_radius = get_parameter("obstacle_markers.roi_radius").as_double(); roi_radius >= 0.0) {
+    lod_options.roi_radius = roi_radius;
+  }
+  if (const double cull_distance = get_parameter("obstacle_markers.cull_distance").as_double(); cull_distance >= 0.0) {
+    lod_options.cull_distance = cull_distance;
+  }
+  lod_options.coarsening_factor = static_cast<int>(get_parameter("obstacle_markers.coarsening_factor").as_int());
+  if (const auto max_markers = get_parameter("obstacle_markers.max_markers").as_int(); max_markers >= 0) {
+    lod_options.max_markers = static_cast<std::size_t>(max_markers);
+  }
+
   visualization_msgs::msg::MarkerArray obstacle_markers{};
   bool visualization_error;
-  std::tie(obstacle_markers, visualization_error) = beluga_ros::assign_obstacle_map(map_, obstacle_markers);
+  std::tie(obstacle_markers, visualization_error) =
+      beluga_ros::assign_obstacle_map(map_, obstacle_markers, lod_options);
   if (visualization_error) {
     RCLCPP_WARN(
         get_logger(),
@@ -170,6 +230,11 @@ void NdtAmclNode3D::do_activate(const rclcpp_lifecycle::State&) {
   map_visualization_pub_->publish(obstacle_markers);
 
   particle_filter_ = make_particle_filter();
+  std::visit(
+      [this](auto& particle_filter) {
+        particle_filter.instrumentation() = [this](const auto& stats) { last_update_stats_ = stats; };
+      },
+      *particle_filter_);
   {
     // Cope with variations in between message_filters versions.
     // See beluga_amcl/message_filters.hpp for further reference.
@@ -180,8 +245,15 @@ void NdtAmclNode3D::do_activate(const rclcpp_lifecycle::State&) {
         return rmw_qos_profile_sensor_data;
       }
     }();
+    // Request intra-process zero-copy transport for sensor data, so same-process
+    // publishers (composed drivers, rosbag playback) hand messages over without
+    // serialization when this node runs inside a component container.
+    auto laser_scan_subscription_options = common_subscription_options_;
+    laser_scan_subscription_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+
     laser_scan_sub_ = std::make_unique<message_filters::Subscriber<sensor_msgs::msg::PointCloud2>>(
-        shared_from_this(), get_parameter("scan_topic").as_string(), laser_scan_qos, common_subscription_options_);
+        shared_from_this(), get_parameter("scan_topic").as_string(), laser_scan_qos,
+        laser_scan_subscription_options);
 
     // Message filter that caches laser scan readings until it is possible to transform
     // from laser frame to odom frame and update the particle filter.
@@ -200,6 +272,12 @@ void NdtAmclNode3D::do_activate(const rclcpp_lifecycle::State&) {
       initialize_from_estimate(initial_estimate.value());
     }
   }
+
+  // Run filter updates on a dedicated thread fed by the measurement mailbox, so the
+  // conversion stage for one cloud overlaps the filter update for the previous one.
+  // Started last so that nothing is left running if activation fails partway.
+  filter_thread_stop_ = false;
+  filter_thread_ = std::thread(&NdtAmclNode3D::filter_thread_loop, this);
 }
 
 void NdtAmclNode3D::do_configure(const rclcpp_lifecycle::State&) {
@@ -207,8 +285,8 @@ void NdtAmclNode3D::do_configure(const rclcpp_lifecycle::State&) {
   const auto map_path = get_parameter("map_path").as_string();
   RCLCPP_INFO(get_logger(), "Loading map from %s.", map_path.c_str());
 
-  // Load the map from hdf5 file
-  map_ = beluga::io::load_from_hdf5<NDTMapRepresentation>(get_parameter("map_path").as_string());
+  // Load the map, from an HDF5 source or a compiled binary map
+  map_ = beluga::io::load_from_file<NDTMapRepresentation>(get_parameter("map_path").as_string());
 
   // Map visualization publisher
   rclcpp::QoS qos_profile{rclcpp::KeepLast(1)};
@@ -224,6 +302,16 @@ void NdtAmclNode3D::do_deactivate(const rclcpp_lifecycle::State&) {
   laser_scan_connection_.disconnect();
   laser_scan_filter_.reset();
   laser_scan_sub_.reset();
+  // Stop the filter thread once no more point clouds can be enqueued.
+  if (filter_thread_.joinable()) {
+    {
+      const std::lock_guard<std::mutex> lock{filter_thread_mutex_};
+      filter_thread_stop_ = true;
+      pending_measurement_.reset();
+    }
+    filter_thread_condition_.notify_one();
+    filter_thread_.join();
+  }
   map_visualization_pub_.reset();
 }
 
@@ -324,12 +412,14 @@ void NdtAmclNode3D::do_initial_pose_callback(geometry_msgs::msg::PoseWithCovaria
   auto pose = Sophus::SE3d{};
   tf2::convert(message->pose.pose, pose);
   const Eigen::Map<const Sophus::Matrix6d> covariance(message->pose.covariance.data());
+  const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
   last_known_estimate_ = std::make_pair(pose, covariance);
   last_known_odom_transform_in_map_.reset();
   initialize_from_estimate(last_known_estimate_.value());
 }
 
 void NdtAmclNode3D::do_periodic_timer_callback() {
+  const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
   if (!particle_filter_) {
     return;
   }
@@ -347,13 +437,35 @@ void NdtAmclNode3D::do_periodic_timer_callback() {
       *particle_filter_);
 }
 
-// TODO(alon): Wouldn't it be better in the callback of each message to simply receive
-// it and define another timer or thread to do the work of calculation and publication?
+bool NdtAmclNode3D::do_collect_diagnostics(diagnostic_msgs::msg::DiagnosticStatus& status) {
+  const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+  if (!particle_filter_ || !last_update_duration_.has_value() || !last_update_stats_.has_value()) {
+    return false;
+  }
+
+  using std::chrono::duration;
+  const auto& stats = *last_update_stats_;
+  add_diagnostic(status, "update_time_ms", duration<double, std::milli>(*last_update_duration_).count());
+  add_diagnostic(status, "propagate_time_ms", duration<double, std::milli>(stats.propagate_duration).count());
+  add_diagnostic(status, "reweight_time_ms", duration<double, std::milli>(stats.reweight_duration).count());
+  add_diagnostic(status, "resample_time_ms", duration<double, std::milli>(stats.resample_duration).count());
+  add_diagnostic(status, "particle_count", stats.particle_count);
+  add_diagnostic(status, "effective_sample_size", stats.effective_sample_size);
+  add_diagnostic(status, "random_state_probability", stats.random_state_probability);
+  add_diagnostic(status, "recovery_slow_average", stats.recovery_slow_average);
+  add_diagnostic(status, "recovery_fast_average", stats.recovery_fast_average);
+  add_diagnostic(status, "resampled", stats.resampled ? "true" : "false");
+  return true;
+}
+
 void NdtAmclNode3D::laser_callback(sensor_msgs::msg::PointCloud2::ConstSharedPtr laser_scan) {
-  if (!particle_filter_ || !last_known_estimate_.has_value()) {
-    RCLCPP_WARN_THROTTLE(
-        get_logger(), *get_clock(), 2000, "Ignoring laser data because the particle filter has not been initialized");
-    return;
+  {
+    const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+    if (!particle_filter_ || !last_known_estimate_.has_value()) {
+      RCLCPP_WARN_THROTTLE(
+          get_logger(), *get_clock(), 2000, "Ignoring laser data because the particle filter has not been initialized");
+      return;
+    }
   }
 
   auto base_pose_in_odom = Sophus::SE3d{};
@@ -380,36 +492,92 @@ void NdtAmclNode3D::laser_callback(sensor_msgs::msg::PointCloud2::ConstSharedPtr
     return;
   }
 
-  const auto update_start_time = std::chrono::high_resolution_clock::now();
+  // Dense float32 xyz layouts (the common case) are bulk-converted in one matrix
+  // expression over the mapped message storage into the reusable measurement buffer,
+  // so steady-state scans pay neither allocations nor a per-point scattered copy.
+  // Anything else goes through the generic per-field iterators.
+  const auto cloud = [&]() -> std::optional<beluga_ros::SparsePointCloud3f> {
+    try {
+      return beluga_ros::SparsePointCloud3f{laser_scan};
+    } catch (const std::invalid_argument&) {
+      return std::nullopt;
+    }
+  }();
+
+  if (cloud.has_value()) {
+    beluga_ros::assign_transformed_points(*cloud, laser_pose_in_base, measurement_buffer_);
+  } else {
+    measurement_buffer_.clear();
+    measurement_buffer_.reserve(laser_scan->height * laser_scan->width);
+    // Accessing XYZ as suggested here:
+    // https://docs.ros.org/en/jade/api/sensor_msgs/html/classsensor__msgs_1_1PointCloud2Iterator.html
+    auto iter_x = sensor_msgs::PointCloud2ConstIterator<float>(*laser_scan, "x");
+    auto iter_y = sensor_msgs::PointCloud2ConstIterator<float>(*laser_scan, "y");
+    auto iter_z = sensor_msgs::PointCloud2ConstIterator<float>(*laser_scan, "z");
+    for (; iter_x != iter_x.end() && iter_y != iter_y.end() && iter_z != iter_z.end(); ++iter_x, ++iter_y, ++iter_z) {
+      measurement_buffer_.emplace_back(laser_pose_in_base * Eigen::Vector3d{*iter_x, *iter_y, *iter_z});
+    }
+  }
+
+  const auto max_points_per_voxel = static_cast<std::size_t>(get_parameter("max_points_per_voxel").as_int());
+  if (max_points_per_voxel > 0U) {
+    // Points sharing an NDT-cell-sized voxel contribute nearly redundant likelihood
+    // terms, so cap their number once per scan instead of paying for the redundancy
+    // in every per-particle likelihood evaluation.
+    voxel_filter_.filter(map_.resolution(), max_points_per_voxel, measurement_buffer_);
+  }
 
-  std::vector<Eigen::Vector3d> measurement;
-  measurement.reserve(laser_scan->height * laser_scan->width);
-
-  // Accessing XYZ as suggested here:
-  // https://docs.ros.org/en/jade/api/sensor_msgs/html/classsensor__msgs_1_1PointCloud2Iterator.html
-  auto iter_x = sensor_msgs::PointCloud2ConstIterator<float>(*laser_scan, "x");
-  auto iter_y = sensor_msgs::PointCloud2ConstIterator<float>(*laser_scan, "y");
-  auto iter_z = sensor_msgs::PointCloud2ConstIterator<float>(*laser_scan, "z");
-  for (; iter_x != iter_x.end() && iter_y != iter_y.end() && iter_z != iter_z.end(); ++iter_x, ++iter_y, ++iter_z) {
-    measurement.emplace_back(laser_pose_in_base * Eigen::Vector3d{*iter_x, *iter_y, *iter_z});
-  };
-
-  RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 2000, "Processing %ld points.", measurement.size());
-  const auto new_estimate = std::visit(
-      [base_pose_in_odom, measurement = measurement](auto& particle_filter) {
-        return particle_filter.update(
-            base_pose_in_odom,  //
-            std::move(measurement));
+  RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 2000, "Processing %ld points.", measurement_buffer_.size());
+
+  {
+    // Latest-wins: overwrite any measurement still waiting for the filter thread, so
+    // bursts and overruns coalesce into a single update over the newest data. The
+    // mailbox gets a bulk copy so the buffer (and its capacity) stays for the next scan.
+    const std::lock_guard<std::mutex> lock{filter_thread_mutex_};
+    pending_measurement_ = PreparedMeasurement{
+        base_pose_in_odom, std::vector<Eigen::Vector3d>{measurement_buffer_}, laser_scan->header.stamp};
+  }
+  filter_thread_condition_.notify_one();
+}
+
+void NdtAmclNode3D::filter_thread_loop() {
+  for (;;) {
+    auto measurement = std::optional<PreparedMeasurement>{};
+    {
+      auto lock = std::unique_lock<std::mutex>{filter_thread_mutex_};
+      filter_thread_condition_.wait(lock, [this] { return filter_thread_stop_ || pending_measurement_.has_value(); });
+      if (filter_thread_stop_) {
+        break;
+      }
+      measurement.swap(pending_measurement_);
+    }
+    process_measurement(std::move(measurement).value());
+  }
+}
+
+void NdtAmclNode3D::process_measurement(PreparedMeasurement measurement) {
+  const std::lock_guard<std::mutex> lock{particle_filter_mutex_};
+
+  if (!particle_filter_) {
+    return;  // the node was deactivated after the measurement was prepared
+  }
+
+  const auto update_start_time = std::chrono::high_resolution_clock::now();
+  const bool filter_updated = std::visit(
+      [&measurement](auto& particle_filter) {
+        return particle_filter.update(measurement.base_pose_in_odom, std::move(measurement.points));
       },
       *particle_filter_);
 
   const auto update_stop_time = std::chrono::high_resolution_clock::now();
   const auto update_duration = update_stop_time - update_start_time;
 
-  if (new_estimate.has_value()) {
-    const auto& [base_pose_in_map, _] = new_estimate.value();
-    last_known_odom_transform_in_map_ = base_pose_in_map * base_pose_in_odom.inverse();
-    last_known_estimate_ = new_estimate;
+  if (filter_updated) {
+    last_update_duration_ = update_duration;
+    last_known_estimate_ =
+        std::visit([](const auto& particle_filter) { return particle_filter.estimate(); }, *particle_filter_);
+    const auto& [base_pose_in_map, _] = last_known_estimate_.value();
+    last_known_odom_transform_in_map_ = base_pose_in_map * measurement.base_pose_in_odom.inverse();
 
     const auto num_particles =
         std::visit([](const auto& particle_filter) { return particle_filter.particles().size(); }, *particle_filter_);
@@ -424,13 +592,15 @@ void NdtAmclNode3D::laser_callback(sensor_msgs::msg::PointCloud2::ConstSharedPtr
     return;
   }
 
-  // Transforms are always published to keep them current.
+  // Transforms are always published to keep them current. This runs on the filter
+  // thread, which BaseAMCLNode::on_deactivate joins (via do_deactivate) before it
+  // resets the broadcaster, so the dereference below is safe during deactivation.
   if (enable_tf_broadcast_ && get_parameter("tf_broadcast").as_bool()) {
     if (last_known_odom_transform_in_map_.has_value()) {
       auto message = geometry_msgs::msg::TransformStamped{};
       // Sending a transform that is valid into the future so that odom can be used.
-      const auto expiration_stamp = tf2_ros::fromMsg(laser_scan->header.stamp) +
-                                    tf2::durationFromSec(get_parameter("transform_tolerance").as_double());
+      const auto expiration_stamp =
+          tf2_ros::fromMsg(measurement.stamp) + tf2::durationFromSec(get_parameter("transform_tolerance").as_double());
       message.header.stamp = tf2_ros::toMsg(expiration_stamp);
       message.header.frame_id = get_parameter("global_frame_id").as_string();
       message.child_frame_id = get_parameter("odom_frame_id").as_string();
@@ -440,14 +610,14 @@ void NdtAmclNode3D::laser_callback(sensor_msgs::msg::PointCloud2::ConstSharedPtr
   }
 
   // New pose messages are only published on updates to the filter.
-  if (new_estimate.has_value()) {
+  if (filter_updated) {
     auto message = geometry_msgs::msg::PoseWithCovarianceStamped{};
-    message.header.stamp = laser_scan->header.stamp;
+    message.header.stamp = measurement.stamp;
     message.header.frame_id = get_parameter("global_frame_id").as_string();
 
     static constexpr double kMinimumVariance =
         1e-6;  // Make sure we covariance is not singular so that UT doesn't fail.
-    auto [base_pose_in_map, base_pose_covariance] = new_estimate.value();
+    auto [base_pose_in_map, base_pose_covariance] = last_known_estimate_.value();
 
     for (auto index = Eigen::Index{0}; index <= base_pose_covariance.cols(); ++index) {
       base_pose_covariance.coeffRef(index, index) = std::max(base_pose_covariance(index, index), kMinimumVariance);
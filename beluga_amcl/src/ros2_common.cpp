@@ -201,6 +201,19 @@ BaseAMCLNode::BaseAMCLNode(
     this->declare_parameter("tf_broadcast", rclcpp::ParameterValue(true), descriptor);
   }
 
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Rate (Hz) at which the last known transform between the global frame and the "
+        "odometry frame is re-stamped and re-broadcast in between filter updates. "
+        "Zero disables the fixed-rate re-broadcast.";
+    descriptor.floating_point_range.resize(1);
+    descriptor.floating_point_range[0].from_value = 0;
+    descriptor.floating_point_range[0].to_value = std::numeric_limits<double>::max();
+    descriptor.floating_point_range[0].step = 0;
+    this->declare_parameter("tf_broadcast_rate", rclcpp::ParameterValue(20.0), descriptor);
+  }
+
   {
     auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
     descriptor.description =
@@ -382,7 +395,8 @@ BaseAMCLNode::BaseAMCLNode(
 
   {
     auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
-    descriptor.description = "Execution policy used to process particles [seq, par].";
+    descriptor.description =
+        "Execution policy used to process particles [seq, par]; the 2D AMCL node also accepts auto.";
     this->declare_parameter("execution_policy", "seq", descriptor);
   }
 
@@ -404,6 +418,38 @@ BaseAMCLNode::BaseAMCLNode(
     this->declare_parameter("bond_timeout", 4.0, descriptor);
   }
 
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Whether to shed measurements deterministically when filter updates cannot keep up "
+        "with the sensor rate, instead of processing every scan at increasing latency.";
+    this->declare_parameter("overload_protection.enable", false, descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Fraction of the sensor period a filter update may take before the host is "
+        "considered overloaded and measurements start being skipped.";
+    descriptor.floating_point_range.resize(1);
+    descriptor.floating_point_range[0].from_value = 0;
+    descriptor.floating_point_range[0].to_value = 1;
+    descriptor.floating_point_range[0].step = 0;
+    this->declare_parameter("overload_protection.busy_fraction", 0.9, descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Number of consecutive over (or under) budget updates required before the "
+        "measurement admission stride grows (or shrinks).";
+    descriptor.integer_range.resize(1);
+    descriptor.integer_range[0].from_value = 1;
+    descriptor.integer_range[0].to_value = std::numeric_limits<int>::max();
+    descriptor.integer_range[0].step = 1;
+    this->declare_parameter("overload_protection.patience", 5, descriptor);
+  }
+
   common_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
   common_subscription_options_ = rclcpp::SubscriptionOptions{};
   common_subscription_options_.callback_group = common_callback_group_;
@@ -427,6 +473,7 @@ BaseAMCLNode::CallbackReturn BaseAMCLNode::on_configure(const rclcpp_lifecycle::
   particle_markers_pub_ =
       create_publisher<visualization_msgs::msg::MarkerArray>("particle_markers", rclcpp::SystemDefaultsQoS());
   pose_pub_ = create_publisher<geometry_msgs::msg::PoseWithCovarianceStamped>("pose", rclcpp::SystemDefaultsQoS());
+  diagnostics_pub_ = create_publisher<diagnostic_msgs::msg::DiagnosticArray>("diagnostics", rclcpp::SystemDefaultsQoS());
 
   do_configure(state);
   return CallbackReturn::SUCCESS;
@@ -434,15 +481,23 @@ BaseAMCLNode::CallbackReturn BaseAMCLNode::on_configure(const rclcpp_lifecycle::
 
 BaseAMCLNode::CallbackReturn BaseAMCLNode::on_deactivate(const rclcpp_lifecycle::State& state) {
   RCLCPP_INFO(get_logger(), "Deactivating");
+  // Derived teardown runs first: it disconnects sensor callbacks and joins worker
+  // threads that may still be dereferencing the tf members (e.g. an in-flight filter
+  // update looking up the odom transform), so those members must outlive it.
+  do_deactivate(state);
   particle_cloud_pub_->on_deactivate();
   particle_markers_pub_->on_deactivate();
   pose_pub_->on_deactivate();
+  diagnostics_pub_->on_deactivate();
+  diagnostics_timer_.reset();
+  estimate_output_timer_.reset();
+  tf_broadcast_timer_.reset();
+  last_broadcast_transform_.reset();
   initial_pose_sub_.reset();
   tf_listener_.reset();
   tf_broadcaster_.reset();
   tf_buffer_.reset();
   bond_.reset();
-  do_deactivate(state);
   return CallbackReturn::SUCCESS;
 }
 
@@ -471,6 +526,14 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn BaseAM
   particle_cloud_pub_->on_activate();
   particle_markers_pub_->on_activate();
   pose_pub_->on_activate();
+  diagnostics_pub_->on_activate();
+  if (get_parameter("overload_protection.enable").as_bool()) {
+    measurement_admission_.emplace(
+        get_parameter("overload_protection.busy_fraction").as_double(),
+        static_cast<std::size_t>(get_parameter("overload_protection.patience").as_int()));
+  } else {
+    measurement_admission_.reset();
+  }
   {
     initial_pose_sub_ = create_subscription<geometry_msgs::msg::PoseWithCovarianceStamped>(
         get_parameter("initial_pose_topic").as_string(), rclcpp::SystemDefaultsQoS(),
@@ -482,6 +545,8 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn BaseAM
     using namespace std::chrono_literals;
     // TODO(alon): create a parameter for the timer rate?
     timer_ = create_wall_timer(200ms, std::bind(&BaseAMCLNode::periodic_timer_callback, this), common_callback_group_);
+    diagnostics_timer_ =
+        create_wall_timer(1s, std::bind(&BaseAMCLNode::diagnostics_timer_callback, this), common_callback_group_);
   }
 
   {
@@ -519,6 +584,25 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn BaseAM
         false);  // avoid using dedicated tf thread
   }
 
+  {
+    using namespace std::chrono_literals;
+    // Output publication is decoupled from estimate production: the filter execution
+    // context stages its outputs in the lock-free triple buffer and this timer drains
+    // it, so a slow publish (e.g. during DDS discovery storms) never blocks the filter.
+    estimate_output_timer_ = create_wall_timer(
+        10ms, std::bind(&BaseAMCLNode::estimate_output_timer_callback, this), common_callback_group_);
+
+    // TF consumers get transforms at a steady cadence even when update policies skip
+    // filter iterations: the last known map-to-odom transform is re-stamped and
+    // re-broadcast at a fixed rate, entirely off the filter execution context.
+    const auto tf_broadcast_rate = get_parameter("tf_broadcast_rate").as_double();
+    if (tf_broadcast_rate > 0.0) {
+      tf_broadcast_timer_ = create_wall_timer(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>{1.0 / tf_broadcast_rate}),
+          std::bind(&BaseAMCLNode::tf_broadcast_timer_callback, this), common_callback_group_);
+    }
+  }
+
   do_activate(state);
   return CallbackReturn::SUCCESS;
 }
@@ -538,6 +622,51 @@ void BaseAMCLNode::periodic_timer_callback() {
   do_periodic_timer_callback();
 };
 
+void BaseAMCLNode::diagnostics_timer_callback() {
+  if (diagnostics_pub_->get_subscription_count() == 0) {
+    return;
+  }
+  auto status = diagnostic_msgs::msg::DiagnosticStatus{};
+  if (!do_collect_diagnostics(status)) {
+    return;
+  }
+  status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+  status.name = std::string{get_name()} + ": particle filter";
+  status.hardware_id = get_name();
+  auto message = diagnostic_msgs::msg::DiagnosticArray{};
+  message.header.stamp = now();
+  message.status.push_back(std::move(status));
+  diagnostics_pub_->publish(message);
+};
+
+void BaseAMCLNode::estimate_output_timer_callback() {
+  auto output = estimate_output_buffer_.take();
+  if (!output.has_value()) {
+    return;
+  }
+  if (output->transform.has_value() && tf_broadcaster_) {
+    tf_broadcaster_->sendTransform(*output->transform);
+    last_broadcast_transform_ = std::move(output->transform);
+  }
+  if (output->pose.has_value()) {
+    pose_pub_->publish(*output->pose);
+  }
+}
+
+void BaseAMCLNode::tf_broadcast_timer_callback() {
+  if (!last_broadcast_transform_.has_value() || !tf_broadcaster_) {
+    return;
+  }
+  // In between filter updates the map-to-odom transform is constant by construction,
+  // with odometry extrapolating the base pose downstream, so re-broadcasting only
+  // requires re-stamping the last known transform to keep it valid into the future.
+  // No synchronization is needed with the estimate output timer because both run in
+  // the common mutually exclusive callback group.
+  auto message = *last_broadcast_transform_;
+  message.header.stamp = now() + rclcpp::Duration::from_seconds(get_parameter("transform_tolerance").as_double());
+  tf_broadcaster_->sendTransform(message);
+}
+
 void BaseAMCLNode::autostart_callback() {
   using lifecycle_msgs::msg::State;
   auto current_state = configure();
@@ -17,6 +17,7 @@
 #include <lifecycle_msgs/msg/state.hpp>
 #include <rclcpp/utilities.hpp>
 
+#include <atomic>
 #include <sophus/common.hpp>
 #include <thread>
 
@@ -43,6 +44,18 @@ class MockAMCL : public beluga_amcl::BaseAMCLNode {
       (override));
 };
 
+class DeactivationOrderAMCL : public beluga_amcl::BaseAMCLNode {
+ public:
+  using beluga_amcl::BaseAMCLNode::BaseAMCLNode;
+
+  /// Whether the tf members were still alive when derived teardown ran.
+  bool tf_members_were_alive = false;
+
+  void do_deactivate(const rclcpp_lifecycle::State&) override {
+    tf_members_were_alive = tf_buffer_ != nullptr && tf_listener_ != nullptr && tf_broadcaster_ != nullptr;
+  }
+};
+
 }  // namespace
 namespace beluga_amcl {
 
@@ -94,6 +107,18 @@ TEST_F(TestROS2Common, CleanupDeactivateShutdownUserProvided) {
   amcl->shutdown();
 }
 
+TEST_F(TestROS2Common, TfMembersOutliveDerivedDeactivation) {
+  // Derived do_deactivate implementations join worker threads that may still be using
+  // the tf members, so the base class must not reset them until derived teardown is done.
+  auto amcl = std::make_shared<DeactivationOrderAMCL>();
+  amcl->configure();
+  amcl->activate();
+  amcl->deactivate();
+  ASSERT_TRUE(amcl->tf_members_were_alive);
+  amcl->cleanup();
+  amcl->shutdown();
+}
+
 TEST_F(TestROS2Common, Autostart) {
   using namespace std::chrono_literals;
   auto amcl = std::make_shared<MockAMCL>(
@@ -166,4 +191,44 @@ TEST_F(TestROS2Common, InitialPoseCallbackDefault) {
   testing::spin_for(300ms, amcl, tester_node);
 }
 
+TEST(TripleBuffer, EmptyUntilWritten) {
+  TripleBuffer<int> buffer;
+  ASSERT_FALSE(buffer.take().has_value());
+}
+
+TEST(TripleBuffer, LatestWriteWins) {
+  TripleBuffer<int> buffer;
+  buffer.write(1);
+  buffer.write(2);
+  buffer.write(3);
+  const auto value = buffer.take();
+  ASSERT_TRUE(value.has_value());
+  ASSERT_EQ(value.value(), 3);
+  // A value is only taken once.
+  ASSERT_FALSE(buffer.take().has_value());
+}
+
+TEST(TripleBuffer, ConcurrentWriterNeverBlocksReader) {
+  TripleBuffer<int> buffer;
+  std::atomic<bool> done{false};
+  int last_value = 0;
+  auto reader = std::thread([&buffer, &done, &last_value]() {
+    while (!done.load()) {
+      const auto value = buffer.take();
+      if (value.has_value()) {
+        // Values are only ever observed fresher than the previous one.
+        ASSERT_GT(value.value(), last_value);
+        last_value = value.value();
+      }
+    }
+  });
+  for (int value = 1; value <= 100000; ++value) {
+    buffer.write(value);
+  }
+  done.store(true);
+  reader.join();
+  // The final write is always observable.
+  ASSERT_EQ(buffer.take().value_or(last_value), 100000);
+}
+
 }  // namespace beluga_amcl
@@ -15,6 +15,12 @@
 #ifndef BELUGA_ROS_AMCL_HPP
 #define BELUGA_ROS_AMCL_HPP
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <variant>
@@ -24,6 +30,8 @@
 
 #include <sophus/se2.hpp>
 
+#include <beluga/algorithm/cluster_based_estimation.hpp>
+#include <beluga/algorithm/effective_sample_size.hpp>
 #include <beluga/algorithm/spatial_hash.hpp>
 #include <beluga/algorithm/thrun_recovery_probability_estimator.hpp>
 #include <beluga/containers.hpp>
@@ -33,6 +41,7 @@
 #include <beluga/sensor.hpp>
 #include <beluga/sensor/data/value_grid.hpp>
 #include <beluga/sensor/primitives.hpp>
+#include <beluga/utility/memory_hints.hpp>
 #include <beluga/views/sample.hpp>
 
 #include <beluga_ros/laser_scan.hpp>
@@ -95,6 +104,86 @@ struct AmclParams {
 
   /// \brief Spatial resolution around the z-axis to create buckets for KLD resampling.
   double spatial_resolution_theta = 10 * Sophus::Constants<double>::pi() / 180;
+
+  /// \brief Minimum share of the resampling distribution guaranteed to each particle cluster.
+  /// When positive, particles are clustered before resampling and the sampling weights are
+  /// adjusted so every cluster with nonzero weight retains at least this fraction of the
+  /// expected survivors, keeping minority pose hypotheses alive in symmetric environments
+  /// without inflating the particle count. Zero disables cluster-aware resampling.
+  double min_cluster_weight_share = 0.0;
+
+  /// \brief Share of the particle population redrawn per resampling update when positive.
+  /// Instead of the occasional full resample — a latency spike proportional to the whole
+  /// population — a rotating window of this fraction of the slots is redrawn from the
+  /// current weighted population every time the resample policy fires, bounding the
+  /// per-update resampling cost. Untouched particles keep their weights, so heavy
+  /// hypotheses keep contributing until their slots rotate. The KLD criterion
+  /// \cite fox2001adaptivekldsampling is still evaluated over the composite population,
+  /// and the population grows or shrinks toward the size it implies by at most the same
+  /// share per update. Zero disables incremental resampling; cluster-aware resampling
+  /// (see min_cluster_weight_share) takes precedence when both are enabled.
+  double incremental_resample_fraction = 0.0;
+
+  /// \brief Candidate oversampling factor for seeded global localization. When a measurement
+  /// is handed to Amcl::make_global_localization_preparer(), this many times `max_particles`
+  /// candidate poses are drawn from the free space of the map, scored against it, and the
+  /// initial set is resampled from them in proportion to their scores — so particles start
+  /// out concentrated where the scan actually matches the map, instead of mostly dying off
+  /// in low-likelihood areas over the first updates. Values below two keep the scored
+  /// candidates as the initial set without resampling.
+  std::size_t seeded_candidate_factor = 4UL;
+
+  /// \brief Share of the seeded initial set still drawn uniformly over the free space of
+  /// the map. The floor of exploratory particles guards against a first scan that happens
+  /// to score well in the wrong region of an ambiguous map. Zero disables the floor; only
+  /// meaningful when seeding is in effect (see seeded_candidate_factor).
+  double seeded_uniform_floor = 0.1;
+};
+
+/// Execution policy mode that picks between sequential and parallel per update.
+/**
+ * Parallel execution amortizes its fork-join overhead only past a few thousand
+ * particles, and adaptive (KLD) resampling swings the particle count across that
+ * threshold within a single session. In this mode each update runs sequentially
+ * below the threshold and in parallel at or above it, so neither small-set
+ * latency nor large-set throughput is left to a static choice.
+ */
+struct AutoExecutionPolicy {
+  /// Particle count at or above which updates run with the parallel policy.
+  /**
+   * The default crossover was calibrated with the stock differential drive plus
+   * likelihood field pipeline; workloads with heavier per-particle models may
+   * profit from a lower value.
+   */
+  std::size_t parallel_threshold = 2048UL;
+};
+
+/// Per-update performance statistics for the \ref Amcl implementation.
+struct AmclUpdateStats {
+  /// Wall time spent in the fused propagate-reweight-normalize pipeline.
+  std::chrono::steady_clock::duration pipeline_duration{};
+  /// Wall time spent resampling; zero when the resample policy skipped resampling.
+  std::chrono::steady_clock::duration resample_duration{};
+  /// Number of particles after the update.
+  std::size_t particle_count = 0;
+  /// Effective sample size (\f$N_{eff} = 1/ {\sum w_i^2}\f$) of the normalized weights.
+  double effective_sample_size = 0.0;
+  /// Probability of inserting a random particle during resampling, as computed by the recovery estimator.
+  double random_state_probability = 0.0;
+  /// Smoothed long-term average weight tracked by the recovery estimator.
+  double recovery_slow_average = 0.0;
+  /// Smoothed short-term average weight tracked by the recovery estimator.
+  double recovery_fast_average = 0.0;
+  /// Minor (soft) page faults taken by the process over the update; nonzero counts
+  /// right after a map load mean map pages were faulted in on the hot path (see
+  /// beluga::MemoryHints::prefault).
+  std::int64_t minor_page_faults = 0;
+  /// Major (hard) page faults taken by the process over the update; nonzero counts
+  /// in steady state mean pages were evicted and re-read from the backing store (see
+  /// beluga::MemoryHints::lock_in_memory).
+  std::int64_t major_page_faults = 0;
+  /// Whether the resample stage ran.
+  bool resampled = false;
 };
 
 /// Implementation of the 2D Adaptive Monte Carlo Localization (AMCL) algorithm.
@@ -104,6 +193,9 @@ class Amcl {
   /// Weighted SE(2) state particle type.
   using particle_type = std::tuple<Sophus::SE2d, beluga::Weight>;
 
+  /// Measurement in the base frame, paired with the base pose in the odometry frame at measurement time.
+  using timed_measurement_type = std::pair<Sophus::SE2d, std::vector<std::pair<double, double>>>;
+
   /// Motion model variant type for runtime selection support.
   using motion_model_variant = std::variant<
       beluga::DifferentialDriveModel2d,   //
@@ -117,7 +209,12 @@ class Amcl {
       beluga::BeamSensorModel<beluga_ros::OccupancyGrid>>;
 
   /// Execution policy variant type for runtime selection support.
-  using execution_policy_variant = std::variant<std::execution::sequenced_policy, std::execution::parallel_policy>;
+  using execution_policy_variant =
+      std::variant<std::execution::sequenced_policy, std::execution::parallel_policy, AutoExecutionPolicy>;
+
+  /// Execution policy variant as resolved for a single update, never the auto mode.
+  using resolved_execution_policy_variant =
+      std::variant<std::execution::sequenced_policy, std::execution::parallel_policy>;
 
   /// Constructor.
   /**
@@ -134,9 +231,38 @@ class Amcl {
       const AmclParams& params,
       execution_policy_variant execution_policy);
 
+  /// Versioned immutable copy of the particle set for concurrent readers.
+  /**
+   * Published buffers are never mutated: each filter update swaps in a freshly
+   * copied buffer, so readers can hold on to `particles` for as long as needed
+   * without synchronizing against the filter thread. The version is bumped on
+   * every publication, letting readers skip work when nothing changed.
+   */
+  struct ParticleSnapshot {
+    /// Monotonic publication counter, starting at one for the initial (empty) snapshot.
+    std::uint64_t version = 0;
+    /// Shared ownership of the published particle set; never null.
+    std::shared_ptr<const beluga::TupleVector<particle_type>> particles;
+  };
+
   /// Returns a reference to the current set of particles.
+  /**
+   * The returned reference is only safe to use from the thread driving the filter;
+   * concurrent readers should use particles_snapshot() instead.
+   */
   [[nodiscard]] const auto& particles() const { return particles_; }
 
+  /// Returns a snapshot of the latest published particle set.
+  /**
+   * Thread-safe: may be called concurrently with update() and initialize(). The cost
+   * on the filter thread is one bulk copy of the particle set per update; the cost
+   * here is a mutex-protected shared pointer copy.
+   */
+  [[nodiscard]] ParticleSnapshot particles_snapshot() const {
+    const std::lock_guard lock{snapshot_mutex_};
+    return snapshot_;
+  }
+
   /// Returns a reference to the current likelihood field.
   [[nodiscard]] const auto& likelihood_field() const {
     std::optional<std::reference_wrapper<const beluga::ValueGrid2<float>>> result;
@@ -195,22 +321,118 @@ class Amcl {
                  ranges::views::take_exactly(params_.max_particles) |                //
                  ranges::to<beluga::TupleVector>;
     force_update_ = true;
+    publish_snapshot();
   }
 
   /// Initialize particles with a given pose and covariance.
   /**
+   * The distribution is clipped to the free space of the current map, so no particle
+   * of the fixed budget is wasted on occupied or unknown cells.
+   *
    * \throw std::runtime_error If the provided covariance is invalid.
    */
   void initialize(Sophus::SE2d pose, Sophus::Matrix3d covariance) {
-    initialize(beluga::MultivariateNormalDistribution{pose, covariance});
+    initialize(beluga::MapConstrainedNormalDistribution{pose, covariance, map_});
   }
 
   /// Initialize particles using the default map distribution.
   void initialize_from_map() { initialize(std::ref(map_distribution_)); }
 
+  /// Builds a self-contained candidate generator for background global localization.
+  /**
+   * The returned callable owns cheap shared handles to the current map distribution
+   * and sensor model, so it can run on a worker thread with read-only access while
+   * update() keeps localizing on the current hypothesis. It samples a full particle
+   * budget uniformly over the free space of the map — reusing the free-state table
+   * of the filter instead of scanning the grid again — and, when a measurement is provided,
+   * pre-scores the candidates against the sensor model (one reweight plus
+   * normalization, no resampling). Stage the result with stage_particles() to have
+   * it installed at the next update boundary.
+   *
+   * When a measurement is provided and \ref AmclParams::seeded_candidate_factor is at
+   * least two, the candidate pool is oversampled by that factor and the initial set is
+   * resampled from it in proportion to the scores, mixed with a uniform floor of
+   * exploratory particles (see \ref AmclParams::seeded_uniform_floor); with a smaller
+   * factor the scored candidates themselves make up the initial set.
+   *
+   * This method itself must not run concurrently with update_map() or the
+   * constructor; the returned callable has no such restriction.
+   *
+   * \param measurement Optional sensor measurement in the base frame used to
+   *        pre-score the candidates; left empty, candidates get uniform weights.
+   * \return A callable producing the candidate particle set.
+   */
+  [[nodiscard]] auto make_global_localization_preparer(std::vector<std::pair<double, double>>&& measurement = {}) const
+      -> std::function<beluga::TupleVector<particle_type>()>;
+
+  /// \overload That takes laser scan data and converts it to a measurement in the base frame.
+  [[nodiscard]] auto make_global_localization_preparer(beluga_ros::LaserScan laser_scan) const
+      -> std::function<beluga::TupleVector<particle_type>()>;
+
+  /// \overload That takes point cloud data, projected onto the z = 0 plane of the base frame.
+  [[nodiscard]] auto make_global_localization_preparer(beluga_ros::SparsePointCloud3f point_cloud) const
+      -> std::function<beluga::TupleVector<particle_type>()>;
+
+  /// Stages a particle set for installation at the next update boundary.
+  /**
+   * Thread-safe: may be called from a worker thread concurrently with update().
+   * The staged set atomically replaces the current particle population at the
+   * beginning of the next update, which then runs as a forced update. Staging
+   * again before that overwrites the previously staged set.
+   */
+  void stage_particles(beluga::TupleVector<particle_type>&& particles);
+
   /// Update the map used for localization.
+  /**
+   * The sensor model is rebuilt in place against the new map, which can take a while
+   * for likelihood-field-based models; the filter is unavailable in the meantime. See
+   * the two-argument overload for a swap-based alternative.
+   */
   void update_map(beluga_ros::OccupancyGrid map);
 
+  /// Update the map used for localization with a sensor model already built against it.
+  /**
+   * No in-place rebuild happens here: the given model — typically constructed on a
+   * background thread while the filter kept running on the old map — replaces the
+   * current one, making this overload cheap enough to call between filter updates.
+   *
+   * \param map Occupancy grid map.
+   * \param sensor_model Sensor model built against `map`.
+   */
+  void update_map(beluga_ros::OccupancyGrid map, sensor_model_variant sensor_model);
+
+  /// Apply a new parameter set to the running filter.
+  /**
+   * Re-derives everything the constructor derives from the parameters — the update
+   * and resampling policies, the spatial hasher and the recovery probability
+   * estimator — while leaving the particle population, the map and both models
+   * untouched, so a tuning change does not cost a reconvergence cycle. The motion
+   * tracked by the update policy restarts from the next pose it observes.
+   *
+   * \param params Parameters for AMCL implementation.
+   */
+  void update_params(const AmclParams& params);
+
+  /// Replace the motion model of the running filter.
+  /**
+   * The particle population is preserved; the new model applies from the next update.
+   *
+   * \param motion_model Motion model to use going forward.
+   */
+  void update_motion_model(motion_model_variant motion_model);
+
+  /// Replace the sensor model of the running filter, keeping the current map.
+  /**
+   * Counterpart of the two-argument update_map() for model parameter changes: the
+   * given model — typically built against the current map on a background thread,
+   * since likelihood field construction can take a while — replaces the current one
+   * between filter updates without touching the particles, so retuning the model
+   * does not restart localization from scratch.
+   *
+   * \param sensor_model Sensor model built against the current map.
+   */
+  void update_sensor_model(sensor_model_variant sensor_model);
+
   /// Update particles using laser scan data.
   /**
    * This method transforms laser scan data from polar to cartesian coordinates in the robot base frame. Then forwards
@@ -253,32 +475,138 @@ class Amcl {
    *
    * \param base_pose_in_odom Base pose in the odometry frame.
    * \param measurement A vector of 2D points representing the sensor measurement in the base frame.
+   * \param max_range_beam_count Number of max-range returns excluded from the measurement,
+   *        forwarded to sensor models that can account for them in closed form (see
+   *        beluga::BeamSensorModel); ignored by models that cannot.
    * \return An optional pair containing the estimated pose and covariance after the update,
    *         or std::nullopt if no update was performed.
    */
-  auto update(Sophus::SE2d base_pose_in_odom, std::vector<std::pair<double, double>>&& measurement)
+  auto update(
+      Sophus::SE2d base_pose_in_odom,
+      std::vector<std::pair<double, double>>&& measurement,
+      std::size_t max_range_beam_count = 0) -> std::optional<std::pair<Sophus::SE2d, Sophus::Matrix3d>>;
+
+  /// Update particles by coalescing several pending measurements into a single filter update.
+  /**
+   * Intended for catching up after the filter falls behind (e.g. after CPU throttling or a long
+   * stall left measurements queued): instead of paying the full pipeline once per measurement,
+   * particles are propagated once over the combined motion — given by the odometry pose of the
+   * newest measurement — and reweighted with the newest measurement only. When `chain_reweights`
+   * is set, the weights accumulate the likelihood of every pending measurement instead, still with
+   * a single normalization and at most one resample at the end. Chained reweights evaluate older
+   * measurements at the propagated states, an approximation that degrades with the amount of
+   * motion spanned by the batch; prefer the default when in doubt.
+   *
+   * Batches of one simply forward to the generic update() method.
+   *
+   * \param measurements Pending measurements in arrival order, each pairing the base pose in the
+   *        odometry frame at measurement time with the measured points in the base frame.
+   * \param chain_reweights Whether to reweight with every pending measurement instead of just the
+   *        newest one.
+   * \return An optional pair containing the estimated pose and covariance after the update,
+   *         or std::nullopt if no update was performed.
+   */
+  auto update_coalesced(std::vector<timed_measurement_type>&& measurements, bool chain_reweights = false)
       -> std::optional<std::pair<Sophus::SE2d, Sophus::Matrix3d>>;
 
   /// Force a manual update of the particles on the next iteration of the filter.
   void force_update() { force_update_ = true; }
 
+  /// Returns statistics for the last update that ran the filter pipeline, if any.
+  [[nodiscard]] const std::optional<AmclUpdateStats>& last_update_stats() const { return last_update_stats_; }
+
  private:
+  /// Runs the propagate-reweight-normalize pipeline with concrete model and policy types.
+  /**
+   * Keeping the pipeline in a single template instantiation lets the compiler inline
+   * across all three stages, which variant dispatch through nested `std::visit` prevents.
+   */
+  template <class ExecutionPolicy, class MotionModel, class SensorModel>
+  void run_pipeline(
+      ExecutionPolicy& policy,
+      MotionModel& motion_model,
+      SensorModel& sensor_model,
+      const Sophus::SE2d& base_pose_in_odom,
+      std::vector<std::pair<double, double>>&& measurement,
+      std::size_t max_range_beam_count);
+
+  /// Runs the propagate, chained reweight, and normalize stages for a coalesced measurement batch.
+  template <class ExecutionPolicy, class MotionModel, class SensorModel>
+  void run_coalesced_pipeline(
+      ExecutionPolicy& policy,
+      MotionModel& motion_model,
+      SensorModel& sensor_model,
+      const Sophus::SE2d& base_pose_in_odom,
+      std::vector<timed_measurement_type>& measurements,
+      bool chain_reweights);
+
+  /// Resolves the execution policy for the upcoming update.
+  /**
+   * Static policies pass through unchanged; the auto mode picks sequential or
+   * parallel from the current particle count (see \ref AutoExecutionPolicy).
+   */
+  [[nodiscard]] resolved_execution_policy_variant resolve_execution_policy() const;
+
+  /// Runs the post-pipeline stages shared by all update flavors: recovery probability
+  /// estimation, resampling, stats bookkeeping, snapshot publication, and estimation.
+  auto finish_update(AmclUpdateStats stats, beluga::PageFaultCounts fault_counts_at_start)
+      -> std::optional<std::pair<Sophus::SE2d, Sophus::Matrix3d>>;
+
+  /// Redraws a rotating fraction of the particle population against the current weights.
+  /**
+   * Bounded-cost alternative to the full resample, enabled through
+   * \ref AmclParams::incremental_resample_fraction. Replacement particles are drawn
+   * from the composite weighted population (with random states interspersed at the
+   * given probability, as in the full resample) and written over a rotating window
+   * of slots at the mean population weight; the KLD-adapted size is approached by
+   * at most the same per-update budget.
+   *
+   * \param random_state_probability Probability of drawing a random state per replacement.
+   */
+  void incremental_resample(double random_state_probability);
+
+  /// Replaces the particle population with the staged set, if any, forcing the next update.
+  void install_staged_particles();
+
+  /// Publishes a copy of the current particle set for concurrent readers.
+  void publish_snapshot();
+
   beluga::TupleVector<particle_type> particles_;
 
   AmclParams params_;
+  beluga_ros::OccupancyGrid map_;
   beluga::MultivariateUniformDistribution<Sophus::SE2d, beluga_ros::OccupancyGrid> map_distribution_;
   motion_model_variant motion_model_;
   sensor_model_variant sensor_model_;
   execution_policy_variant execution_policy_;
 
   beluga::spatial_hash<Sophus::SE2d> spatial_hasher_;
+  /// Weight statistics accumulated during the normalization sweep of the last pipeline
+  /// run, so the effective sample size and the recovery probability estimator update
+  /// cost no extra passes over the weight column.
+  beluga::WeightStatistics weight_statistics_;
   beluga::ThrunRecoveryProbabilityEstimator random_probability_estimator_;
   beluga::any_policy<Sophus::SE2d> update_policy_;
   beluga::any_policy<decltype(particles_)> resample_policy_;
+  /// Clusterizer driving cluster-aware resampling; reuses its buffers across updates.
+  beluga::ParticleClusterizer clusterizer_{beluga::ParticleClusterizerParam{}};
+  /// Reused per-particle cluster id buffer for cluster-aware resampling.
+  std::vector<std::size_t> clusters_;
+  /// Next slot to be replaced by the incremental resampler; wraps around the population.
+  std::size_t incremental_resample_cursor_ = 0;
+  /// Reused replacement particle buffer for incremental resampling.
+  beluga::TupleVector<particle_type> incremental_resample_scratch_;
 
   beluga::RollingWindow<Sophus::SE2d, 2> control_action_window_;
 
   bool force_update_{true};
+  std::optional<AmclUpdateStats> last_update_stats_;
+
+  mutable std::mutex snapshot_mutex_;
+  ParticleSnapshot snapshot_;
+
+  mutable std::mutex staged_particles_mutex_;
+  std::optional<beluga::TupleVector<particle_type>> staged_particles_;
 };
 
 }  // namespace beluga_ros
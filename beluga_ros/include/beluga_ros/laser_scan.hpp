@@ -15,12 +15,21 @@
 #ifndef BELUGA_ROS_LASER_SCAN_HPP
 #define BELUGA_ROS_LASER_SCAN_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/iota.hpp>
+#include <range/v3/view/zip.hpp>
 
 #include <beluga/sensor/data/laser_scan.hpp>
 #include <beluga/views/take_evenly.hpp>
 #include <beluga_ros/messages.hpp>
 
+#include <sophus/se2.hpp>
 #include <sophus/se3.hpp>
 
 #include <sensor_msgs/msg/laser_scan.hpp>
@@ -32,6 +41,22 @@
 
 namespace beluga_ros {
 
+/// Per-scan beam classification summary.
+/**
+ * Whether a beam is a valid hit, a max-range miss, or invalid depends only on the
+ * measurement, so it is decided once per scan and not once per particle. Hits are the
+ * beams materialized as cartesian points; the other groups are summarized by their
+ * counts, which is all a sensor model needs to account for them in closed form.
+ */
+struct BeamClassification {
+  /// Number of beams with a finite return within the configured range bounds.
+  std::size_t hits = 0;
+  /// Number of beams reporting a return beyond the maximum range.
+  std::size_t max_range_misses = 0;
+  /// Number of beams with no usable return (NaN or below the minimum range).
+  std::size_t invalid = 0;
+};
+
 /// Thin wrapper type for 2D `sensor_msgs/LaserScan` messages.
 class LaserScan : public beluga::BaseLaserScan<LaserScan> {
  public:
@@ -62,6 +87,31 @@ class LaserScan : public beluga::BaseLaserScan<LaserScan> {
     assert(scan_ != nullptr);
   }
 
+  /// Constructor for borrowed (non-owning) laser scan messages.
+  ///
+  /// Wraps the message without taking ownership or touching any reference count,
+  /// suitable for rclcpp loaned messages and other borrowed storage. The caller
+  /// must keep the message alive for as long as the wrapper (or any copy of it)
+  /// is in use.
+  ///
+  /// \param scan Laser scan message. Only a reference to it is held.
+  /// \param origin Laser scan frame origin in the filter frame.
+  /// \param max_beams Maximum number of beams to consider.
+  /// \param min_range Minimum allowed range value (in meters).
+  /// \param max_range Maximum allowed range value (in meters).
+  explicit LaserScan(
+      const sensor_msgs::msg::LaserScan& scan,
+      Sophus::SE3d origin = Sophus::SE3d(),
+      std::size_t max_beams = std::numeric_limits<std::size_t>::max(),
+      Scalar min_range = std::numeric_limits<Scalar>::min(),
+      Scalar max_range = std::numeric_limits<Scalar>::max())
+      : LaserScan(
+            sensor_msgs::msg::LaserScan::ConstSharedPtr(sensor_msgs::msg::LaserScan::ConstSharedPtr(), &scan),
+            std::move(origin),
+            max_beams,
+            min_range,
+            max_range) {}
+
   /// Get the laser scan frame origin in the filter frame.
   [[nodiscard]] const auto& origin() const { return origin_; }
 
@@ -79,6 +129,75 @@ class LaserScan : public beluga::BaseLaserScan<LaserScan> {
            ranges::views::transform([](auto value) { return static_cast<Scalar>(value); });
   }
 
+  /// Set the sensor motion over the scan sweep, enabling deskew.
+  /**
+   * Beams are measured sequentially while the robot moves, so treating a scan as
+   * instantaneous warps the points of a fast-turning robot. With the sweep motion set,
+   * the materialization pass unwarps each beam by the motion interpolated at its
+   * position in the sweep, at no extra traversal cost; without it scans are treated as
+   * instantaneous, as before. Must be called before the points are first accessed.
+   *
+   * \param motion_over_sweep Pose of the sensor frame at the last beam expressed in the
+   *  sensor frame at the first beam. Deskewed points are expressed in the first-beam
+   *  (message stamp) frame.
+   */
+  void set_motion_over_sweep(const Sophus::SE2d& motion_over_sweep) {
+    assert(!points_in_cartesian_coordinates_.has_value());
+    motion_over_sweep_ = motion_over_sweep.log();
+  }
+
+  /// Get scan points in cartesian coordinates, in sensor frame.
+  /**
+   * Shadows beluga::BaseLaserScan::points_in_cartesian_coordinates() with an eagerly
+   * materialized equivalent. The lazy view re-evaluates beam decimation, range
+   * filtering, and trigonometry on every traversal, and consumers may traverse the
+   * points many times (e.g. once per particle); here that work happens exactly once
+   * per scan, on first access, and a contiguous vector is served from then on. The
+   * same pass classifies every beam, see beam_classification(), and deskews hits when
+   * a sweep motion was set, see set_motion_over_sweep().
+   */
+  [[nodiscard]] const std::vector<Sophus::Vector2<Scalar>>& points_in_cartesian_coordinates() const {
+    if (!points_in_cartesian_coordinates_) {
+      auto& points = points_in_cartesian_coordinates_.emplace();
+      const auto beam_count = std::min(max_beams_, scan_->ranges.size());
+      const auto sweep_denominator = static_cast<Scalar>(std::max<std::size_t>(beam_count, 2) - 1);
+      std::size_t beam_index = 0;
+      for (const auto& [range, angle] : ranges::views::zip(ranges(), angles())) {
+        using std::isnan;
+        if (isnan(range) || range < min_range_) {
+          ++beam_classification_.invalid;
+        } else if (range > max_range_) {
+          ++beam_classification_.max_range_misses;
+        } else {
+          using std::cos, std::sin;
+          auto point = Sophus::Vector2<Scalar>{range * cos(angle), range * sin(angle)};
+          if (motion_over_sweep_.has_value()) {
+            // Decimation keeps beams evenly spaced over the sweep, so the decimated
+            // index fraction is also the beam's time fraction.
+            const auto fraction = static_cast<Scalar>(beam_index) / sweep_denominator;
+            point = Sophus::SE2<Scalar>::exp(fraction * (*motion_over_sweep_)) * point;
+          }
+          points.push_back(point);
+          ++beam_classification_.hits;
+        }
+        ++beam_index;
+      }
+    }
+    return *points_in_cartesian_coordinates_;
+  }
+
+  /// Get the per-scan beam classification.
+  /**
+   * Partitions the decimated beam set into hits, max-range misses, and invalid beams,
+   * as a by-product of the single materialization pass over the scan. Only hits become
+   * cartesian points; the remaining group counts let sensor models apply their
+   * scan-constant contribution in closed form instead of branching per particle.
+   */
+  [[nodiscard]] const BeamClassification& beam_classification() const {
+    points_in_cartesian_coordinates();
+    return beam_classification_;
+  }
+
   /// Get the number of beams in the scan.
   [[nodiscard]] std::size_t size() const { return scan_->ranges.size(); }
 
@@ -94,6 +213,83 @@ class LaserScan : public beluga::BaseLaserScan<LaserScan> {
   std::size_t max_beams_;
   Scalar min_range_;
   Scalar max_range_;
+  /// Cartesian point cache, filled on first access. Each copy of the wrapper owns its own cache.
+  mutable std::optional<std::vector<Sophus::Vector2<Scalar>>> points_in_cartesian_coordinates_;
+  /// Beam classification counts, valid once the cartesian point cache is filled.
+  mutable BeamClassification beam_classification_;
+  /// Sweep motion as a tangent vector, interpolated per beam during materialization.
+  std::optional<Sophus::SE2d::Tangent> motion_over_sweep_;
+};
+
+/// Parameters used to construct an AdaptiveBeamBudget instance.
+struct AdaptiveBeamBudgetParams {
+  /// Beam budget used when the filter is fully converged.
+  std::size_t min_beams = 20;
+  /// Beam budget used while the filter is recovering; also the initial budget.
+  std::size_t max_beams = 60;
+  /// Effective sample size fraction at or below which the full budget is demanded.
+  double low_ess_fraction = 0.2;
+  /// Effective sample size fraction at or above which the ESS metric demands no extra beams.
+  double high_ess_fraction = 0.5;
+  /// Estimate covariance trace at or below which the covariance metric demands no extra beams.
+  double low_covariance_trace = 0.05;
+  /// Estimate covariance trace at or above which the full budget is demanded.
+  double high_covariance_trace = 1.0;
+  /// Exponential smoothing factor applied to budget changes, in (0, 1]; 1 disables smoothing.
+  double smoothing_factor = 0.3;
+};
+
+/// Online controller adjusting the laser scan beam budget from filter health metrics.
+/**
+ * Sensor model cost scales linearly with the number of beams, but a converged filter
+ * sustains its estimate with far fewer beams than recovery needs. Instead of fixing
+ * `max_beams` conservatively for the worst case, feed this controller the effective
+ * sample size fraction and the estimate covariance trace after each update, and pass
+ * beams() as the beam budget when wrapping the next scan. Each metric demands a
+ * budget between the configured bounds — more beams when the weights degenerate or
+ * the estimate spreads out, fewer as the filter converges — and the most demanding
+ * metric wins. The output is smoothed exponentially so the budget does not chatter
+ * between consecutive updates.
+ */
+class AdaptiveBeamBudget {
+ public:
+  /// Constructor.
+  /**
+   * \param params Parameters to configure this instance.
+   */
+  explicit AdaptiveBeamBudget(const AdaptiveBeamBudgetParams& params = AdaptiveBeamBudgetParams{})
+      : params_{params}, budget_{static_cast<double>(params_.max_beams)} {}
+
+  /// Updates the budget from the latest filter health metrics.
+  /**
+   * \param effective_sample_size_fraction Effective sample size over particle count, in [0, 1].
+   * \param covariance_trace Trace of the translational block of the estimate covariance.
+   */
+  void update(double effective_sample_size_fraction, double covariance_trace) {
+    const double ess_demand =
+        1.0 - std::clamp(
+                  (effective_sample_size_fraction - params_.low_ess_fraction) /
+                      (params_.high_ess_fraction - params_.low_ess_fraction),
+                  0.0, 1.0);
+    const double covariance_demand = std::clamp(
+        (covariance_trace - params_.low_covariance_trace) /
+            (params_.high_covariance_trace - params_.low_covariance_trace),
+        0.0, 1.0);
+    const double demand = std::max(ess_demand, covariance_demand);
+    const double target = static_cast<double>(params_.min_beams) +
+                          demand * static_cast<double>(params_.max_beams - params_.min_beams);
+    budget_ += params_.smoothing_factor * (target - budget_);
+  }
+
+  /// Returns the current beam budget.
+  [[nodiscard]] std::size_t beams() const { return static_cast<std::size_t>(std::lround(budget_)); }
+
+  /// Resets the budget to the full beam count, e.g. after a filter (re)initialization.
+  void reset() { budget_ = static_cast<double>(params_.max_beams); }
+
+ private:
+  AdaptiveBeamBudgetParams params_;
+  double budget_;
 };
 
 }  // namespace beluga_ros
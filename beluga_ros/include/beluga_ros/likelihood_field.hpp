@@ -15,7 +15,10 @@
 #ifndef BELUGA_ROS_LIKELIHOOD_FIELD_HPP
 #define BELUGA_ROS_LIKELIHOOD_FIELD_HPP
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <limits>
 
 #include <beluga/sensor/data/value_grid.hpp>
 #include <beluga_ros/tf2_sophus.hpp>
@@ -65,6 +68,84 @@ inline void assign_likelihood_field(
   }
 }
 
+/// Convert a region of interest of likelihood data to ROS2 message.
+/**
+ * Crops the grid to a square window of side `roi_size` centered on `center`
+ * before message assembly, so publishing cost scales with the window rather
+ * than the full map extent. The message origin is shifted to the lower corner
+ * of the window, keeping the published cells registered with the full field.
+ *
+ * \param likelihood_field Likelihood data.
+ * \param origin Transform from the grid frame to the global frame.
+ * \param center Window center, in global frame coordinates.
+ * \param roi_size Window side length, in meters.
+ * \param[out] message Occupancy grid message to be assigned.
+ */
+template <typename T>
+inline void assign_likelihood_field(
+    const beluga::ValueGrid2<T>& likelihood_field,
+    const Sophus::SE2d& origin,
+    const Eigen::Vector2d& center,
+    double roi_size,
+    nav_msgs::msg::OccupancyGrid& message) {
+  const double resolution = likelihood_field.resolution();
+  const Eigen::Vector2d center_in_grid = origin.inverse() * center;
+  const double half_size = roi_size / 2.0;
+
+  // Clamp the window to the grid bounds, in cell coordinates.
+  const auto clamp_cell = [resolution](double coordinate, std::size_t limit) {
+    return static_cast<std::size_t>(std::clamp(std::floor(coordinate / resolution), 0.0, static_cast<double>(limit)));
+  };
+  const std::size_t begin_x = clamp_cell(center_in_grid.x() - half_size, likelihood_field.width());
+  const std::size_t end_x = clamp_cell(center_in_grid.x() + half_size + resolution, likelihood_field.width());
+  const std::size_t begin_y = clamp_cell(center_in_grid.y() - half_size, likelihood_field.height());
+  const std::size_t end_y = clamp_cell(center_in_grid.y() + half_size + resolution, likelihood_field.height());
+  const std::size_t roi_width = end_x - begin_x;
+  const std::size_t roi_height = end_y - begin_y;
+
+  // Set metadata, with the origin shifted to the lower corner of the window
+  const auto roi_origin = origin * Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{
+                                                                    static_cast<double>(begin_x) * resolution,
+                                                                    static_cast<double>(begin_y) * resolution}};
+  message.info.width = static_cast<unsigned int>(roi_width);
+  message.info.height = static_cast<unsigned int>(roi_height);
+  message.info.resolution = static_cast<float>(resolution);
+  tf2::toMsg(roi_origin, message.info.origin);  // origin -> Pose: [x,y,z],[w,x,y,z]
+
+  message.data.resize(roi_width * roi_height);
+  if (roi_width == 0 || roi_height == 0) {
+    return;  // window falls entirely outside the grid
+  }
+
+  // Find min and max values over the window for normalization
+  const auto& grid_data = likelihood_field.data();
+  const std::size_t stride = likelihood_field.width();
+  float min_val = std::numeric_limits<float>::max();
+  float max_val = std::numeric_limits<float>::lowest();
+  for (std::size_t y = begin_y; y < end_y; ++y) {
+    const auto row_begin = grid_data.begin() + static_cast<std::ptrdiff_t>(y * stride + begin_x);
+    const auto [min_it, max_it] = std::minmax_element(row_begin, row_begin + static_cast<std::ptrdiff_t>(roi_width));
+    min_val = std::min(min_val, static_cast<float>(*min_it));
+    max_val = std::max(max_val, static_cast<float>(*max_it));
+  }
+  const float range = max_val - min_val;
+
+  // Handle degenerate case (flat window) by filling the occupancy grid with zeros
+  if (range <= std::numeric_limits<float>::epsilon()) {
+    std::fill(message.data.begin(), message.data.end(), 0);
+    return;
+  }
+
+  // Normalizing each cell to [0, 100] - To be consistent with nav2:
+  // navigation2/nav2_costmap_2d/src/costmap_2d_publisher.cpp
+  for (std::size_t y = 0; y < roi_height; ++y) {
+    for (std::size_t x = 0; x < roi_width; ++x) {
+      const float normalized = (grid_data[(begin_y + y) * stride + begin_x + x] - min_val) / range;
+      message.data[y * roi_width + x] = static_cast<int8_t>(normalized * 100.0f);  // Scale to [0, 100]
+    }
+  }
+}
+
 }  // namespace beluga_ros
 
 #endif  // BELUGA_ROS_LIKELIHOOD_FIELD_HPP
@@ -0,0 +1,81 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ROS_MESSAGE_POOL_HPP
+#define BELUGA_ROS_MESSAGE_POOL_HPP
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \brief Implementation of a reusable message pool for ROS publishing.
+ */
+
+namespace beluga_ros {
+
+/// Pool of reusable messages for periodic publishing.
+/**
+ * Messages handed out by the pool return to it when released, keeping whatever
+ * storage their fields accumulated. Publishing paths that fill large messages
+ * (e.g. particle clouds) at a fixed rate thus pay for their buffers once instead
+ * of reallocating them on every period.
+ *
+ * \tparam Message Default constructible message type.
+ */
+template <class Message>
+class MessagePool {
+ public:
+  /// Constructs an empty pool.
+  MessagePool() : state_(std::make_shared<State>()) {}
+
+  /// Acquire a message from the pool.
+  /**
+   * Returns a recycled message if one is available and allocates a new one
+   * otherwise. Recycled messages are not cleared; consumers are expected to
+   * overwrite their contents while reusing their capacity. The message goes
+   * back to the pool when the last reference to it is dropped, even if the
+   * pool itself is destroyed first.
+   */
+  [[nodiscard]] std::shared_ptr<Message> acquire() {
+    auto message = [this]() -> std::unique_ptr<Message> {
+      const std::lock_guard<std::mutex> lock{state_->mutex};
+      if (state_->free_list.empty()) {
+        return std::make_unique<Message>();
+      }
+      auto recycled = std::move(state_->free_list.back());
+      state_->free_list.pop_back();
+      return recycled;
+    }();
+    return std::shared_ptr<Message>{message.release(), [state = state_](Message* ptr) {
+                                      const std::lock_guard<std::mutex> lock{state->mutex};
+                                      state->free_list.emplace_back(ptr);
+                                    }};
+  }
+
+ private:
+  /// Shared pool state, kept alive by outstanding messages.
+  struct State {
+    std::mutex mutex;                                 ///< Protects the free list.
+    std::vector<std::unique_ptr<Message>> free_list;  ///< Messages available for reuse.
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace beluga_ros
+
+#endif  // BELUGA_ROS_MESSAGE_POOL_HPP
@@ -15,6 +15,14 @@
 #ifndef BELUGA_ROS_NDT_ELLIPSOID_HPP
 #define BELUGA_ROS_NDT_ELLIPSOID_HPP
 
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <utility>
+
 #include <Eigen/Core>
 #include <beluga/eigen_compatibility.hpp>
 
@@ -56,8 +64,35 @@ bool use_mean_covariance(
  */
 void use_cell_size(const Eigen::Vector<int, 3>& position, double size, visualization_msgs::msg::Marker& marker);
 
+/// Create a cube for a merged group of cells contained in the received marker.
+/**
+ * \param center Center of the cube, in map frame coordinates.
+ * \param size Size of the edges.
+ * \param marker Marker that will contain the message.
+ */
+void use_region_size(const Eigen::Vector3d& center, double size, visualization_msgs::msg::Marker& marker);
+
 }  // namespace detail
 
+/// Level-of-detail options for assign_obstacle_map().
+/**
+ * The defaults reproduce the full-detail assembly: every cell gets its own marker. Large maps should
+ * bound the region of interest and cap the marker count so visualization cost stays independent of
+ * map size and never competes with the filter update for its deadline.
+ */
+struct NdtEllipsoidLodOptions {
+  /// Center of the region of interest, in map frame coordinates.
+  Eigen::Vector3d roi_center = Eigen::Vector3d::Zero();
+  /// Cells within this distance of the center keep one marker per cell.
+  double roi_radius = std::numeric_limits<double>::infinity();
+  /// Cells beyond this distance of the center are not visualized at all.
+  double cull_distance = std::numeric_limits<double>::infinity();
+  /// Edge length of the coarse cells distant cells are merged into, as a multiple of the grid resolution.
+  int coarsening_factor = 4;
+  /// Hard cap on the number of shape markers, not counting the leading deletion marker.
+  std::size_t max_markers = std::numeric_limits<std::size_t>::max();
+};
+
 /// Assign an ellipsoid to each cell of a SparseValueGrid. A cube is used instead if the distribution of the
 /// cell is not suitable for the rotation matrix creation.
 /**
@@ -106,6 +141,123 @@ std::pair<visualization_msgs::msg::MarkerArray, bool> assign_obstacle_map(
   return {message, cubes_generated};
 }
 
+/// Assign shapes to the cells of a SparseValueGrid with a configurable level of detail.
+/**
+ * Cells within the region of interest get one ellipsoid (or cube) each, exactly as the full-detail
+ * overload produces. Cells between the region of interest and the cull distance are merged into
+ * coarse cells and rendered as one moment-matched ellipsoid per coarse cell, and cells beyond the
+ * cull distance are dropped. Assembly stops once the marker cap is reached, with close-by cells
+ * taking priority over merged ones.
+ *
+ * The message is cleared on entry but keeps its allocated storage, so callers can hold one message
+ * instance and reuse its buffers across publishes.
+ *
+ * \param grid A SparseValueGrid that contains cells representing obstacles.
+ * \param[out] message A MarkerArray that will contain the shapes.
+ * \param options Level-of-detail options bounding the assembly.
+ * \return A std::pair with the MarkerArray containing the shapes and a boolean indicating if at least one cube was
+ * generated.
+ * \tparam MapType Container that maps from Eigen::Vector<int, NDim> to the type of the cell.
+ * \tparam NDim Dimension of the grid.
+ */
+template <typename MapType, int NDim>
+std::pair<visualization_msgs::msg::MarkerArray, bool> assign_obstacle_map(
+    const beluga::SparseValueGrid<MapType, NDim>& grid,
+    visualization_msgs::msg::MarkerArray& message,
+    const NdtEllipsoidLodOptions& options) {
+  bool cubes_generated = false;
+  auto& map = grid.data();
+
+  // Drop the previous contents but keep the allocated storage.
+  message.markers.clear();
+
+  // Clean up the display
+  visualization_msgs::msg::Marker deletion_marker;
+  deletion_marker.ns = "obstacles";
+  deletion_marker.action = visualization_msgs::msg::Marker::DELETEALL;
+  message.markers.push_back(deletion_marker);
+
+  // Accumulated moments of the fine cells merged into one coarse cell.
+  struct CoarseCell {
+    std::size_t count = 0;
+    Eigen::Vector3d mean_sum = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d covariance_sum = Eigen::Matrix3d::Zero();
+    Eigen::Matrix3d scatter_sum = Eigen::Matrix3d::Zero();
+  };
+
+  const double coarse_size = grid.resolution() * options.coarsening_factor;
+  std::map<std::array<int, 3>, CoarseCell> coarse_cells;
+
+  Eigen::SelfAdjointEigenSolver<Eigen::Matrix<double, 3, 3>> eigen_solver;
+  std::int32_t next_id = 1;
+  for (const auto& [cell_center, cell] : map) {
+    const double distance = (cell.mean - options.roi_center).norm();
+    if (distance > options.cull_distance) {
+      continue;
+    }
+
+    if (distance > options.roi_radius) {
+      // Merge distant cells into their enclosing coarse cell; one moment-matched
+      // ellipsoid per coarse cell is emitted after the sweep.
+      auto& coarse_cell = coarse_cells[{
+          static_cast<int>(std::floor(cell.mean[0] / coarse_size)),
+          static_cast<int>(std::floor(cell.mean[1] / coarse_size)),
+          static_cast<int>(std::floor(cell.mean[2] / coarse_size))}];
+      ++coarse_cell.count;
+      coarse_cell.mean_sum += cell.mean;
+      coarse_cell.covariance_sum += cell.covariance;
+      coarse_cell.scatter_sum += cell.mean * cell.mean.transpose();
+      continue;
+    }
+
+    if (message.markers.size() - 1 >= options.max_markers) {
+      break;
+    }
+
+    visualization_msgs::msg::Marker marker;
+    marker.header.frame_id = "map";
+    marker.id = next_id++;
+    marker.ns = "obstacles";
+
+    // Try to create an ellipsoid with values of the cell
+    if (!beluga_ros::detail::use_mean_covariance(eigen_solver, cell, marker)) {
+      // Create a cube based on the resolution of the grid
+      cubes_generated = true;
+      beluga_ros::detail::use_cell_size(cell_center, grid.resolution(), marker);
+    }
+
+    message.markers.push_back(marker);
+  }
+
+  for (const auto& [coarse_center, coarse_cell] : coarse_cells) {
+    if (message.markers.size() - 1 >= options.max_markers) {
+      break;
+    }
+
+    // Match the first two moments of the merged distribution: the mean of the member means, and the
+    // mean of the member covariances plus the scatter of the member means around the merged mean.
+    const auto count = static_cast<double>(coarse_cell.count);
+    const Eigen::Vector3d merged_mean = coarse_cell.mean_sum / count;
+    const Eigen::Matrix3d merged_covariance =
+        coarse_cell.covariance_sum / count + coarse_cell.scatter_sum / count - merged_mean * merged_mean.transpose();
+
+    visualization_msgs::msg::Marker marker;
+    marker.header.frame_id = "map";
+    marker.id = next_id++;
+    marker.ns = "obstacles";
+
+    if (!beluga_ros::detail::use_mean_covariance(
+            eigen_solver, beluga::NDTCell<3>{merged_mean, merged_covariance}, marker)) {
+      cubes_generated = true;
+      beluga_ros::detail::use_region_size(merged_mean, coarse_size, marker);
+    }
+
+    message.markers.push_back(marker);
+  }
+
+  return {message, cubes_generated};
+}
+
 }  // namespace beluga_ros
 
 #endif  // BELUGA_ROS_NDT_ELLIPSOID_HPP
@@ -18,7 +18,9 @@
 #include <cmath>
 #include <map>
 #include <memory>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <range/v3/range/primitives.hpp>
 #include <range/v3/view/take_exactly.hpp>
@@ -27,8 +29,10 @@
 #include <sophus/se3.hpp>
 #include <sophus/types.hpp>
 
+#include <beluga/algorithm/cluster_based_estimation.hpp>
 #include <beluga/algorithm/spatial_hash.hpp>
 #include <beluga/primitives.hpp>
+#include <beluga/views/particles.hpp>
 #include <beluga/views/sample.hpp>
 #include <beluga/views/zip.hpp>
 
@@ -138,13 +142,12 @@ template <
 geometry_msgs::msg::PoseArray&
 assign_particle_cloud(Particles&& particles, std::size_t size, geometry_msgs::msg::PoseArray& message) {
   static_assert(ranges::sized_range<decltype(particles)>);
-  message.poses.clear();
   if (ranges::size(particles) > 0) {
-    message.poses.reserve(size);
-    for (const auto& particle : particles | beluga::views::sample | ranges::views::take_exactly(size)) {
-      auto& pose = message.poses.emplace_back();
-      tf2::toMsg(beluga::state(particle), pose);
-    }
+    assign_poses(
+        particles | beluga::views::sample | ranges::views::take_exactly(size) | beluga::views::states, size,
+        message.poses);
+  } else {
+    message.poses.clear();
   }
   return message;
 }
@@ -163,6 +166,74 @@ Message& assign_particle_cloud(Particles&& particles, Message& message) {
   return assign_particle_cloud(std::forward<Particles>(particles), ranges::size(particles), message);
 }
 
+/// Compute the cluster centroids of a pose distribution, as a particle cloud itself.
+/**
+ * A level-of-detail reduction for visualization: particles are grouped with
+ * beluga::ParticleClusterizer and each cluster is reduced to its mean pose,
+ * weighted by the total weight of the cluster. Publishers can thus emit a
+ * handful of centroids in place of an arbitrarily large particle cloud.
+ *
+ * Clusters holding a single particle are discarded, as are particles that
+ * could not be clustered at all.
+ *
+ * \param particles Pose distribution, as a particle cloud itself.
+ * \return Centroid particles, one per cluster.
+ * \tparam Particles A sized range type whose value type satisfies \ref ParticlePage "Particle" named requirements,
+ * with Sophus::SE2d states.
+ */
+template <
+    class Particles,
+    class Particle = ranges::range_value_t<Particles>,
+    class State = typename beluga::state_t<Particle>,
+    typename = std::enable_if_t<std::is_same_v<State, Sophus::SE2d>>>
+[[nodiscard]] auto particle_cloud_centroids(Particles&& particles) {
+  auto states = beluga::views::states(particles);
+  auto weights = beluga::views::weights(particles);
+  auto clusterizer = beluga::ParticleClusterizer{beluga::ParticleClusterizerParam{}};
+  const auto estimates = beluga::estimate_clusters(states, weights, clusterizer(states, weights));
+  auto centroids = std::vector<std::tuple<Sophus::SE2d, beluga::Weight>>{};
+  centroids.reserve(estimates.size());
+  for (const auto& estimate : estimates) {
+    centroids.emplace_back(estimate.mean, estimate.weight);
+  }
+  return centroids;
+}
+
+/// Select the particles within a region of interest, as a particle cloud itself.
+/**
+ * A level-of-detail reduction complementary to \ref particle_cloud_centroids:
+ * only the particles whose position falls within a square (or cubic, for
+ * SE(3) states) window of side `roi_size` centered on `center` are kept, so
+ * message assembly cost scales with the window rather than the full map.
+ *
+ * \param particles Pose distribution, as a particle cloud itself.
+ * \param center Pose at the center of the region of interest.
+ * \param roi_size Window side length, in meters.
+ * \return Particles within the region of interest.
+ * \tparam Particles A sized range type whose value type satisfies \ref ParticlePage "Particle" named requirements.
+ */
+template <
+    class Particles,
+    class Particle = ranges::range_value_t<Particles>,
+    class State = typename beluga::state_t<Particle>,
+    class Weight = typename beluga::weight_t<Particle>,
+    class Scalar = typename State::Scalar,
+    typename = std::enable_if_t<
+        std::is_same_v<State, typename Sophus::SE2<Scalar>> || std::is_same_v<State, typename Sophus::SE3<Scalar>>>>
+[[nodiscard]] auto particle_cloud_region_of_interest(Particles&& particles, const State& center, Scalar roi_size) {
+  const auto half_size = roi_size / Scalar{2};
+  auto states = beluga::views::states(particles);
+  auto weights = beluga::views::weights(particles);
+  auto selection = std::vector<std::tuple<State, Weight>>{};
+  for (const auto& [state, weight] : beluga::views::zip(states, weights)) {
+    const auto offset = state.translation() - center.translation();
+    if (offset.template lpNorm<Eigen::Infinity>() <= half_size) {
+      selection.emplace_back(state, weight);
+    }
+  }
+  return selection;
+}
+
 /// Assign a pose distribution to a markers message for visualization.
 /**
  * \param particles Pose distribution, as a particle cloud itself.
@@ -209,9 +280,8 @@ visualization_msgs::msg::MarkerArray& assign_particle_cloud(
     }
   }
 
-  message.markers.clear();
-
   if (histogram.empty()) {
+    message.markers.clear();
     return message;
   }
 
@@ -232,8 +302,10 @@ visualization_msgs::msg::MarkerArray& assign_particle_cloud(
   const auto arrow_head_left_corner =
       kArrowBodyLength * Translation::UnitX() + (kArrowHeadWidth / Scalar{2.0}) * Translation::UnitY();
 
-  message.markers.reserve(2);
-  auto& arrow_bodies = message.markers.emplace_back();
+  // Resize instead of clearing so reused messages keep whatever capacity
+  // their marker buffers accumulated on previous calls.
+  message.markers.resize(2);
+  auto& arrow_bodies = message.markers[0];
   arrow_bodies.id = 0;
   arrow_bodies.ns = "bodies";
   arrow_bodies.color.a = 1.0;
@@ -241,10 +313,12 @@ visualization_msgs::msg::MarkerArray& assign_particle_cloud(
   arrow_bodies.lifetime.sec = 1;
   arrow_bodies.type = visualization_msgs::msg::Marker::LINE_LIST;
   arrow_bodies.action = visualization_msgs::msg::Marker::ADD;
+  arrow_bodies.points.clear();
+  arrow_bodies.colors.clear();
   arrow_bodies.points.reserve(histogram.size() * 2);  // 2 vertices per arrow body
   arrow_bodies.colors.reserve(histogram.size() * 2);
 
-  auto& arrow_heads = message.markers.emplace_back();
+  auto& arrow_heads = message.markers[1];
   arrow_heads.id = 1;
   arrow_heads.ns = "heads";
   arrow_heads.scale.x = 1.0;
@@ -255,6 +329,8 @@ visualization_msgs::msg::MarkerArray& assign_particle_cloud(
   arrow_heads.lifetime.sec = 1;
   arrow_heads.type = visualization_msgs::msg::Marker::TRIANGLE_LIST;
   arrow_heads.action = visualization_msgs::msg::Marker::ADD;
+  arrow_heads.points.clear();
+  arrow_heads.colors.clear();
   arrow_heads.points.reserve(histogram.size() * 3);  // 3 vertices per arrow head
   arrow_heads.colors.reserve(histogram.size() * 3);
 
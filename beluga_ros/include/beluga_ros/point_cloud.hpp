@@ -103,6 +103,21 @@ class PointCloud3 : public beluga::BasePointCloud<PointCloud3<T>> {
     }
   }
 
+  /// Constructor for borrowed (non-owning) point cloud messages.
+  ///
+  /// Wraps the message without taking ownership or touching any reference count,
+  /// suitable for rclcpp loaned messages and other borrowed storage. The caller
+  /// must keep the message alive for as long as the wrapper (or any copy of it)
+  /// is in use.
+  ///
+  /// \param cloud Point cloud message. Only a reference to it is held.
+  /// \param origin Point cloud frame origin in the filter frame.
+  /// \throws std::invalid_argument if `cloud` does not meet expectations.
+  explicit PointCloud3(const sensor_msgs::msg::PointCloud2& cloud, Sophus::SE3d origin = Sophus::SE3d())
+      : PointCloud3(
+            sensor_msgs::msg::PointCloud2::ConstSharedPtr(sensor_msgs::msg::PointCloud2::ConstSharedPtr(), &cloud),
+            std::move(origin)) {}
+
   /// Get the point cloud frame origin in the filter frame.
   [[nodiscard]] const auto& origin() const { return origin_; }
 
@@ -0,0 +1,83 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ROS_POINT_CLOUD_VOXEL_FILTER_HPP
+#define BELUGA_ROS_POINT_CLOUD_VOXEL_FILTER_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <beluga/algorithm/spatial_hash.hpp>
+#include <beluga/containers/flat_hash_map.hpp>
+
+#include <Eigen/Core>
+
+/**
+ * \file
+ * \brief Implementation of a voxel deduplication filter for point cloud measurements.
+ */
+
+namespace beluga_ros {
+
+/// Deduplicates a point buffer by voxel, keeping at most a fixed number of points per voxel.
+/**
+ * Points falling in the same cell-sized voxel contribute nearly redundant likelihood terms
+ * to cell-based sensor models (e.g. `beluga::NDTSensorModel`), so capping the number of
+ * points per voxel compresses dense clouds ahead of the per-particle loop. The voxel
+ * occupancy map is owned by the filter and cleared without deallocating between calls, so
+ * steady-state scans perform no allocations once it has grown to the working cloud size.
+ */
+class PointCloudVoxelFilter {
+ public:
+  /// Filters a point buffer in place.
+  /**
+   * Points are kept in their original order; points beyond the per-voxel cap are dropped
+   * and the buffer is truncated to the surviving prefix. Voxel membership is decided by
+   * spatial hash, matching the bucketing used elsewhere for KLD resampling; hash
+   * collisions may rarely drop an extra point, which is harmless for deduplication.
+   *
+   * \param voxel_size Voxel edge length, typically the sensor model cell size. Must be positive.
+   * \param max_points_per_voxel Maximum number of points kept per voxel. Zero disables filtering.
+   * \param points Point buffer to filter in place.
+   */
+  void filter(double voxel_size, std::size_t max_points_per_voxel, std::vector<Eigen::Vector3d>& points) {
+    assert(voxel_size > 0.0);
+    if (max_points_per_voxel == 0U || points.empty()) {
+      return;
+    }
+    counts_.clear();
+    counts_.reserve(points.size());
+    const auto hasher = beluga::spatial_hash<std::array<double, 3>>{{voxel_size, voxel_size, voxel_size}};
+    std::size_t kept = 0U;
+    for (const auto& point : points) {
+      auto& count = counts_[hasher({point.x(), point.y(), point.z()})];
+      if (count < max_points_per_voxel) {
+        ++count;
+        points[kept++] = point;
+      }
+    }
+    points.resize(kept);
+  }
+
+ private:
+  /// Number of points already kept per voxel hash; reused across calls.
+  beluga::FlatHashMap<std::size_t, std::uint32_t> counts_;
+};
+
+}  // namespace beluga_ros
+
+#endif  // BELUGA_ROS_POINT_CLOUD_VOXEL_FILTER_HPP
@@ -15,6 +15,8 @@
 #ifndef BELUGA_ROS_SPARSE_POINT_CLOUD_HPP
 #define BELUGA_ROS_SPARSE_POINT_CLOUD_HPP
 
+#include <vector>
+
 #include <Eigen/Dense>
 #include <beluga/eigen_compatibility.hpp>
 #include <beluga/sensor/data/sparse_point_cloud.hpp>
@@ -90,14 +92,56 @@ class SparsePointCloud3 : public beluga::BaseSparsePointCloud<SparsePointCloud3<
         throw std::invalid_argument("xyz datatype is not floating point");
       }
     }
+    // Validate the common dense layout once, so points_matrix() can expose the
+    // message storage directly instead of going through per-field iterators.
+    strided_ = field_0.datatype == sensor_msgs::typeAsPointFieldType<Scalar>::value &&
+               field_1.offset == field_0.offset + sizeof(Scalar) &&  //
+               field_2.offset == field_1.offset + sizeof(Scalar) &&  //
+               cloud_->point_step % sizeof(Scalar) == 0 &&
+               (cloud_->height <= 1 || cloud_->row_step == cloud_->point_step * cloud_->width);
   }
 
+  /// Constructor for borrowed (non-owning) point cloud messages.
+  ///
+  /// Wraps the message without taking ownership or touching any reference count,
+  /// suitable for rclcpp loaned messages and other borrowed storage. The caller
+  /// must keep the message alive for as long as the wrapper (or any copy of it)
+  /// is in use.
+  ///
+  /// \param cloud Point cloud message. Only a reference to it is held.
+  /// \param origin Point cloud frame origin in the filter frame.
+  /// \throws std::invalid_argument if `cloud` does not meet expectations.
+  explicit SparsePointCloud3(const sensor_msgs::msg::PointCloud2& cloud, Sophus::SE3d origin = Sophus::SE3d())
+      : SparsePointCloud3(
+            sensor_msgs::msg::PointCloud2::ConstSharedPtr(sensor_msgs::msg::PointCloud2::ConstSharedPtr(), &cloud),
+            std::move(origin)) {}
+
   /// Get the point cloud size.
   [[nodiscard]] std::size_t size() const { return static_cast<std::size_t>(cloud_->width) * cloud_->height; }
 
   /// Get the point cloud frame origin in the filter frame.
   [[nodiscard]] const auto& origin() const { return origin_; }
 
+  /// Check whether the message layout supports strided matrix access through points_matrix().
+  [[nodiscard]] bool has_strided_layout() const { return strided_; }
+
+  /// Get cartesian points in the point cloud as a matrix.
+  /**
+   * Fast path over points() for messages whose xyz fields are consecutive, match the
+   * expected scalar type, and whose point step is a multiple of it. The whole cloud
+   * is exposed as a single strided Eigen map over the message storage, giving
+   * consumers contiguous, vectorizable access with no per-point iterator arithmetic.
+   *
+   * Only valid when has_strided_layout() is true.
+   */
+  [[nodiscard]] auto points_matrix() const {
+    assert(strided_);
+    const auto stride = static_cast<int>(cloud_->point_step / sizeof(Scalar));
+    const sensor_msgs::PointCloud2ConstIterator<Scalar> iter_points(*cloud_, "x");
+    return Eigen::Map<const Eigen::Matrix3X<Scalar>, 0, Eigen::OuterStride<>>(
+        &iter_points[0], 3, static_cast<Eigen::Index>(size()), stride);
+  }
+
   /// Get the range of cartesian points in the point cloud.
   [[nodiscard]] auto points() const {
     if constexpr (!Strict) {
@@ -131,8 +175,47 @@ class SparsePointCloud3 : public beluga::BaseSparsePointCloud<SparsePointCloud3<
 
   sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud_;
   Sophus::SE3d origin_;
+  bool strided_ = false;
 };
 
+/// Bulk-converts a point cloud into a reusable vector of transformed 3D points.
+/**
+ * Clears and refills `out` without shrinking its capacity, so callers that keep the
+ * vector across scans pay no allocation once it has grown to the steady-state cloud
+ * size. For strided layouts the whole xyz block is consumed through one matrix
+ * expression over the mapped message storage — a single vectorized copy-and-transform
+ * into the output block instead of a per-point scattered copy; other layouts fall
+ * back to the per-field iterators behind points().
+ *
+ * \param cloud Point cloud to convert.
+ * \param transform Transform applied to every point (e.g. sensor frame to filter frame).
+ * \param out Output vector of transformed points; cleared and refilled.
+ */
+template <typename T, bool Strict>
+void assign_transformed_points(
+    const SparsePointCloud3<T, Strict>& cloud,
+    const Sophus::SE3d& transform,
+    std::vector<Eigen::Vector3d>& out) {
+  const auto size = cloud.size();
+  out.clear();
+  if (size == 0) {
+    return;
+  }
+  if (cloud.has_strided_layout()) {
+    // std::vector<Eigen::Vector3d> is contiguous 3xN double storage, so the whole
+    // conversion collapses into one matrix product plus a columnwise add.
+    out.resize(size);
+    auto mapped = Eigen::Map<Eigen::Matrix3Xd>(out.data()->data(), 3, static_cast<Eigen::Index>(size));
+    mapped.noalias() = transform.so3().matrix() * cloud.points_matrix().template cast<double>();
+    mapped.colwise() += transform.translation();
+  } else {
+    out.reserve(size);
+    for (const auto& point : cloud.points()) {
+      out.emplace_back(transform * point.template cast<double>());
+    }
+  }
+}
+
 /// Non-strict alias for SparsePointCloud3 of `double` type.
 using SparsePointCloud3d = SparsePointCloud3<double, false>;
 
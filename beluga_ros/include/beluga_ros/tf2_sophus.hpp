@@ -17,10 +17,18 @@
 
 #include <beluga/algorithm/unscented_transform.hpp>
 #include <beluga/eigen_compatibility.hpp>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <sophus/common.hpp>
 #include <tf2/convert.hpp>
 #include <tf2/utils.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
 
 #include <tf2_eigen/tf2_eigen.hpp>
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
@@ -282,7 +290,7 @@ inline geometry_msgs::msg::PoseWithCovariance toMsg(
 
   const auto& [base_pose_in_map_xyz_rpy, base_pose_covariance_xyz_rpy] = beluga::unscented_transform(
       in.log(), covariance, detail::tangential_space_to_xyz_rpy<Scalar>, std::nullopt,
-      [](const std::vector<Eigen::Vector<Scalar, 6>>& samples, const std::vector<Scalar>& weights) {
+      [](const std::array<Eigen::Vector<Scalar, 6>, 13>& samples, const std::array<Scalar, 13>& weights) {
         Eigen::Vector<Scalar, 6> out = Eigen::Vector<Scalar, 6>::Zero();
         Eigen::Vector<Scalar, 2> roll_aux = Eigen::Vector<Scalar, 2>::Zero();
         Eigen::Vector<Scalar, 2> pitch_aux = Eigen::Vector<Scalar, 2>::Zero();
@@ -328,6 +336,103 @@ inline geometry_msgs::msg::PoseWithCovariance toMsg(
 
 }  // namespace tf2
 
+namespace beluga_ros {
+
+/// Converts a range of Sophus SE2 elements to Pose messages, in bulk.
+/**
+ * Batch counterpart of the element-wise `tf2::toMsg` overload, meant for hot publishing paths.
+ * The output vector is resized once and each pose is written in place. Each quaternion is
+ * computed from the unit complex of its rotation with half-angle identities, trading the
+ * per-element atan2/sin/cos round trip of the element-wise conversion for a single square root.
+ *
+ * \param poses Range of Sophus SE2 elements to convert.
+ * \param size Number of poses to convert. `out` is resized to match.
+ * \param[out] out Pose message storage to write to.
+ * \return a reference to `out`.
+ */
+template <
+    class Poses,
+    class Pose = ranges::range_value_t<Poses>,
+    class Scalar = typename Pose::Scalar,
+    typename = std::enable_if_t<std::is_same_v<Pose, Sophus::SE2<Scalar>>>>
+inline std::vector<geometry_msgs::msg::Pose>&
+assign_poses(Poses&& poses, std::size_t size, std::vector<geometry_msgs::msg::Pose>& out) {
+  out.resize(size);
+  auto it = out.begin();
+  for (auto&& pose : poses) {
+    if (it == out.end()) {
+      break;
+    }
+    auto& message = *it++;
+    const auto& unit_complex = pose.so2().unit_complex();
+    // Half-angle identities on the unit complex (cos θ, sin θ) yield the quaternion directly:
+    // θ/2 lies in (-π/2, π/2], so cos(θ/2) is never negative and sin(θ/2) keeps the sign of
+    // sin(θ). Computing the larger of the two components first keeps both branches
+    // well-conditioned; in particular, θ = π maps to the (z, w) = (1, 0) quaternion.
+    Scalar half_cos;
+    Scalar half_sin;
+    if (unit_complex.x() >= Scalar{0}) {
+      half_cos = std::sqrt((Scalar{1} + unit_complex.x()) / Scalar{2});
+      half_sin = unit_complex.y() / (Scalar{2} * half_cos);
+    } else {
+      half_sin = std::copysign(std::sqrt((Scalar{1} - unit_complex.x()) / Scalar{2}), unit_complex.y());
+      half_cos = unit_complex.y() / (Scalar{2} * half_sin);
+    }
+    message.position.x = pose.translation().x();
+    message.position.y = pose.translation().y();
+    message.position.z = 0;
+    message.orientation.w = half_cos;
+    message.orientation.x = 0;
+    message.orientation.y = 0;
+    message.orientation.z = half_sin;
+  }
+  return out;
+}
+
+/// Converts a range of Sophus SE3 elements to Pose messages, in bulk.
+/**
+ * Batch counterpart of the element-wise `tf2::toMsg` overload, meant for hot publishing paths.
+ * The output vector is resized once and each pose is written in place; the per-element
+ * conversion is a plain copy of the unit quaternion and translation.
+ *
+ * \param poses Range of Sophus SE3 elements to convert.
+ * \param size Number of poses to convert. `out` is resized to match.
+ * \param[out] out Pose message storage to write to.
+ * \return a reference to `out`.
+ */
+template <
+    class Poses,
+    class Pose = ranges::range_value_t<Poses>,
+    class Scalar = typename Pose::Scalar,
+    typename = std::enable_if_t<std::is_same_v<Pose, Sophus::SE3<Scalar>>>,
+    typename = void>
+inline std::vector<geometry_msgs::msg::Pose>&
+assign_poses(Poses&& poses, std::size_t size, std::vector<geometry_msgs::msg::Pose>& out) {
+  out.resize(size);
+  auto it = out.begin();
+  for (auto&& pose : poses) {
+    if (it == out.end()) {
+      break;
+    }
+    tf2::toMsg(pose, *it++);
+  }
+  return out;
+}
+
+/// Converts a sized range of Sophus SE2 or SE3 elements to Pose messages, in bulk.
+/**
+ * \param poses Sized range of Sophus SE2 or SE3 elements to convert.
+ * \param[out] out Pose message storage to write to. It is resized to match the input range.
+ * \return a reference to `out`.
+ */
+template <class Poses>
+inline std::vector<geometry_msgs::msg::Pose>& assign_poses(Poses&& poses, std::vector<geometry_msgs::msg::Pose>& out) {
+  static_assert(ranges::sized_range<decltype(poses)>);
+  return assign_poses(std::forward<Poses>(poses), ranges::size(poses), out);
+}
+
+}  // namespace beluga_ros
+
 /// `Sophus` namespace extension for message conversion function overload resolution (ADL enabled).
 namespace Sophus {  // NOLINT(readability-identifier-naming)
 
@@ -19,9 +19,15 @@
 #include <beluga/actions/propagate.hpp>
 #include <beluga/actions/reweight.hpp>
 #include <beluga/algorithm/cluster_based_estimation.hpp>
+#include <beluga/views/cluster_stratified_sample.hpp>
 #include <beluga/views/random_intersperse.hpp>
 #include <beluga/views/take_while_kld.hpp>
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
 
 namespace beluga_ros {
 
@@ -32,7 +38,8 @@ Amcl::Amcl(
     const AmclParams& params = AmclParams(),
     execution_policy_variant execution_policy = std::execution::seq)
     : params_{params},
-      map_distribution_{map},
+      map_{std::move(map)},
+      map_distribution_{map_},
       motion_model_{std::move(motion_model)},
       sensor_model_{std::move(sensor_model)},
       execution_policy_{std::move(execution_policy)},
@@ -43,11 +50,134 @@ Amcl::Amcl(
   if (params_.selective_resampling) {
     resample_policy_ = resample_policy_ && beluga::policies::on_effective_size_drop;
   }
+  publish_snapshot();  // so readers always see a valid (initially empty) buffer
+}
+
+void Amcl::publish_snapshot() {
+  // The copy happens outside the lock, so readers are only ever blocked for a pointer swap.
+  auto copy = std::make_shared<const beluga::TupleVector<particle_type>>(particles_);
+  const std::lock_guard lock{snapshot_mutex_};
+  snapshot_.particles = std::move(copy);
+  ++snapshot_.version;
 }
 
 void Amcl::update_map(beluga_ros::OccupancyGrid map) {
-  map_distribution_ = beluga::MultivariateUniformDistribution{map};
-  std::visit([&](auto& sensor_model) { sensor_model.update_map(std::move(map)); }, sensor_model_);
+  map_ = std::move(map);
+  map_distribution_ = beluga::MultivariateUniformDistribution{map_};
+  std::visit([&](auto& sensor_model) { sensor_model.update_map(map_); }, sensor_model_);
+}
+
+auto Amcl::make_global_localization_preparer(std::vector<std::pair<double, double>>&& measurement) const
+    -> std::function<beluga::TupleVector<particle_type>()> {
+  // The closure owns copies of the map distribution, the parameters, and the sensor
+  // model; all of them share their bulk data through immutable handles — including
+  // the free-state table of the distribution, which would otherwise cost another
+  // full grid scan — so the copies are cheap and the callable is fully detached
+  // from the filter state.
+  return [distribution = map_distribution_, params = params_, sensor_model = sensor_model_,
+          measurement = std::move(measurement)]() mutable -> beluga::TupleVector<particle_type> {
+    const bool seeded = !measurement.empty() && params.seeded_candidate_factor > 1UL;
+    const std::size_t candidate_count =
+        seeded ? params.seeded_candidate_factor * params.max_particles : params.max_particles;
+    auto candidates = beluga::views::sample(distribution) |                               //
+                      ranges::views::transform(beluga::make_from_state<particle_type>) |  //
+                      ranges::views::take_exactly(candidate_count) |                      //
+                      ranges::to<beluga::TupleVector>;
+    if (!measurement.empty()) {
+      std::visit(
+          [&candidates, &measurement](const auto& model) {
+            candidates |= beluga::actions::reweight(model(std::move(measurement))) | beluga::actions::normalize;
+          },
+          sensor_model);
+    }
+    if (!seeded) {
+      return candidates;
+    }
+    // Resample the initial set from the scored candidates, so its density follows the
+    // measurement likelihood over free space, and top it off with a floor of uniform
+    // draws that keeps exploring in case the scan matched the wrong region.
+    const auto floor_count = std::min(
+        static_cast<std::size_t>(params.seeded_uniform_floor * static_cast<double>(params.max_particles)),
+        params.max_particles);
+    auto seeds = candidates |                                             //
+                 beluga::views::sample |                                  //
+                 ranges::views::take_exactly(params.max_particles - floor_count) |  //
+                 ranges::to<beluga::TupleVector>;
+    auto uniform_draws = beluga::views::sample(std::move(distribution)) |                  //
+                         ranges::views::transform(beluga::make_from_state<particle_type>) |  //
+                         ranges::views::take_exactly(floor_count);
+    for (auto&& draw : uniform_draws) {
+      seeds.push_back(draw);
+    }
+    return seeds;
+  };
+}
+
+auto Amcl::make_global_localization_preparer(beluga_ros::LaserScan laser_scan) const
+    -> std::function<beluga::TupleVector<particle_type>()> {
+  auto measurement = laser_scan.points_in_cartesian_coordinates() |  //
+                     ranges::views::transform([&laser_scan](const auto& p) {
+                       const auto result = laser_scan.origin() * Sophus::Vector3d{p.x(), p.y(), 0};
+                       return std::make_pair(result.x(), result.y());
+                     }) |
+                     ranges::to<std::vector>;
+  return make_global_localization_preparer(std::move(measurement));
+}
+
+auto Amcl::make_global_localization_preparer(beluga_ros::SparsePointCloud3f point_cloud) const
+    -> std::function<beluga::TupleVector<particle_type>()> {
+  const auto project_to_base_xy_plane = [&point_cloud](const auto& p) {
+    const auto result = point_cloud.origin() * p.template cast<double>();
+    return std::pair{result.x(), result.y()};
+  };
+  auto measurement =
+      point_cloud.points() | ranges::views::transform(project_to_base_xy_plane) | ranges::to<std::vector>();
+  return make_global_localization_preparer(std::move(measurement));
+}
+
+void Amcl::stage_particles(beluga::TupleVector<particle_type>&& particles) {
+  const std::lock_guard lock{staged_particles_mutex_};
+  staged_particles_ = std::move(particles);
+}
+
+void Amcl::install_staged_particles() {
+  auto staged = std::optional<beluga::TupleVector<particle_type>>{};
+  {
+    const std::lock_guard lock{staged_particles_mutex_};
+    staged.swap(staged_particles_);
+  }
+  if (!staged.has_value()) {
+    return;
+  }
+  particles_ = std::move(*staged);
+  force_update_ = true;
+  publish_snapshot();
+}
+
+void Amcl::update_map(beluga_ros::OccupancyGrid map, sensor_model_variant sensor_model) {
+  map_ = std::move(map);
+  map_distribution_ = beluga::MultivariateUniformDistribution{map_};
+  sensor_model_ = std::move(sensor_model);
+}
+
+void Amcl::update_params(const AmclParams& params) {
+  params_ = params;
+  spatial_hasher_ = beluga::spatial_hash<Sophus::SE2d>{
+      params_.spatial_resolution_x, params_.spatial_resolution_y, params_.spatial_resolution_theta};
+  random_probability_estimator_ = beluga::ThrunRecoveryProbabilityEstimator{params_.alpha_slow, params_.alpha_fast};
+  update_policy_ = beluga::policies::on_motion<Sophus::SE2d>(params_.update_min_d, params_.update_min_a);
+  resample_policy_ = beluga::policies::every_n(params_.resample_interval);
+  if (params_.selective_resampling) {
+    resample_policy_ = resample_policy_ && beluga::policies::on_effective_size_drop;
+  }
+}
+
+void Amcl::update_motion_model(motion_model_variant motion_model) {
+  motion_model_ = std::move(motion_model);
+}
+
+void Amcl::update_sensor_model(sensor_model_variant sensor_model) {
+  sensor_model_ = std::move(sensor_model);
 }
 
 // Overloaded update method for LaserScan.
@@ -60,7 +190,9 @@ auto Amcl::update(Sophus::SE2d base_pose_in_odom, beluga_ros::LaserScan laser_sc
                        return std::make_pair(result.x(), result.y());
                      }) |
                      ranges::to<std::vector>;
-  return update(base_pose_in_odom, std::move(measurement));
+  // Max-range misses were excluded from the materialized points; their count lets
+  // sensor models fold their scan-constant contribution in without per-particle work.
+  return update(base_pose_in_odom, std::move(measurement), laser_scan.beam_classification().max_range_misses);
 }
 
 // Overloaded update method for SparsePointCloud3.
@@ -79,48 +211,280 @@ auto Amcl::update(Sophus::SE2d base_pose_in_odom, beluga_ros::SparsePointCloud3f
   return update(base_pose_in_odom, std::move(measurement));
 }
 
+auto Amcl::resolve_execution_policy() const -> resolved_execution_policy_variant {
+  return std::visit(
+      [this](const auto& policy) -> resolved_execution_policy_variant {
+        if constexpr (std::is_same_v<std::decay_t<decltype(policy)>, AutoExecutionPolicy>) {
+          if (particles_.size() >= policy.parallel_threshold) {
+            return std::execution::par;
+          }
+          return std::execution::seq;
+        } else {
+          return policy;
+        }
+      },
+      execution_policy_);
+}
+
+template <class ExecutionPolicy, class MotionModel, class SensorModel>
+void Amcl::run_pipeline(
+    ExecutionPolicy& policy,
+    MotionModel& motion_model,
+    SensorModel& sensor_model,
+    const Sophus::SE2d& base_pose_in_odom,
+    std::vector<std::pair<double, double>>&& measurement,
+    std::size_t max_range_beam_count) {
+  // Models that can account for max-range misses in closed form take their count
+  // alongside the hit points; for the rest the count is dropped here.
+  auto weighting_function = [&] {
+    if constexpr (std::is_invocable_v<SensorModel&, std::vector<std::pair<double, double>>&&, std::size_t>) {
+      return sensor_model(std::move(measurement), max_range_beam_count);
+    } else {
+      return sensor_model(std::move(measurement));
+    }
+  }();
+  particles_ |= beluga::actions::propagate(policy, motion_model(control_action_window_ << base_pose_in_odom)) |  //
+                beluga::actions::reweight(policy, std::move(weighting_function)) |                               //
+                beluga::actions::normalize(policy, &weight_statistics_);
+}
+
 // Overloaded update method for vector of double pairs.
 auto Amcl::update(
     Sophus::SE2d base_pose_in_odom,
-    std::vector<std::pair<double, double>>&& measurement)  // NOTE: Should be float?
+    std::vector<std::pair<double, double>>&& measurement,  // NOTE: Should be float?
+    std::size_t max_range_beam_count) -> std::optional<std::pair<Sophus::SE2d, Sophus::Matrix3d>> {
+  install_staged_particles();
+
+  if (particles_.empty()) {
+    return std::nullopt;
+  }
+
+  if (!update_policy_(base_pose_in_odom) && !force_update_) {
+    return std::nullopt;
+  }
+
+  auto stats = AmclUpdateStats{};
+  const auto fault_counts_at_start = beluga::current_page_fault_counts();
+  const auto pipeline_start_time = std::chrono::steady_clock::now();
+
+  // In auto mode the policy is picked here, from the particle count this update
+  // will actually process; static policies resolve to themselves.
+  auto execution_policy = resolve_execution_policy();
+
+  // The stock beluga_amcl configuration (differential drive, likelihood field) is
+  // dispatched statically so its pipeline instantiations inline straight into this
+  // function. Exotic configurations fall back to variant dispatch below.
+  auto* const differential_drive_model = std::get_if<beluga::DifferentialDriveModel2d>(&motion_model_);
+  auto* const likelihood_field_model = std::get_if<beluga::LikelihoodFieldModel<beluga_ros::OccupancyGrid>>(  //
+      &sensor_model_);
+
+  if (differential_drive_model != nullptr && likelihood_field_model != nullptr) {
+    if (auto* const policy = std::get_if<std::execution::parallel_policy>(&execution_policy); policy != nullptr) {
+      run_pipeline(
+          *policy, *differential_drive_model, *likelihood_field_model, base_pose_in_odom, std::move(measurement),
+          max_range_beam_count);
+    } else {
+      auto& policy = std::get<std::execution::sequenced_policy>(execution_policy);
+      run_pipeline(
+          policy, *differential_drive_model, *likelihood_field_model, base_pose_in_odom, std::move(measurement),
+          max_range_beam_count);
+    }
+  } else {
+    std::visit(
+        [&, this](auto& policy, auto& motion_model, auto& sensor_model) {
+          run_pipeline(
+              policy, motion_model, sensor_model, base_pose_in_odom, std::move(measurement), max_range_beam_count);
+        },
+        execution_policy, motion_model_, sensor_model_);
+  }
+
+  stats.pipeline_duration = std::chrono::steady_clock::now() - pipeline_start_time;
+  return finish_update(stats, fault_counts_at_start);
+}
+
+template <class ExecutionPolicy, class MotionModel, class SensorModel>
+void Amcl::run_coalesced_pipeline(
+    ExecutionPolicy& policy,
+    MotionModel& motion_model,
+    SensorModel& sensor_model,
+    const Sophus::SE2d& base_pose_in_odom,
+    std::vector<timed_measurement_type>& measurements,
+    bool chain_reweights) {
+  particles_ |= beluga::actions::propagate(policy, motion_model(control_action_window_ << base_pose_in_odom));
+  if (chain_reweights) {
+    for (auto& timed_measurement : measurements) {
+      particles_ |= beluga::actions::reweight(policy, sensor_model(std::move(timed_measurement.second)));
+    }
+  } else {
+    particles_ |= beluga::actions::reweight(policy, sensor_model(std::move(measurements.back().second)));
+  }
+  particles_ |= beluga::actions::normalize(policy, &weight_statistics_);
+}
+
+auto Amcl::update_coalesced(std::vector<timed_measurement_type>&& measurements, bool chain_reweights)
     -> std::optional<std::pair<Sophus::SE2d, Sophus::Matrix3d>> {
+  if (measurements.empty()) {
+    return std::nullopt;
+  }
+
+  if (measurements.size() == 1U) {
+    return update(measurements.front().first, std::move(measurements.front().second));
+  }
+
+  install_staged_particles();
+
   if (particles_.empty()) {
     return std::nullopt;
   }
 
+  // The newest odometry pose carries the combined motion of the whole batch; the
+  // rolling window consumes it the same way consecutive per-measurement updates would
+  // have consumed the intermediate poses, so propagation runs once for all of them.
+  const auto base_pose_in_odom = measurements.back().first;
   if (!update_policy_(base_pose_in_odom) && !force_update_) {
     return std::nullopt;
   }
 
+  auto stats = AmclUpdateStats{};
+  const auto fault_counts_at_start = beluga::current_page_fault_counts();
+  const auto pipeline_start_time = std::chrono::steady_clock::now();
+
+  // Coalesced catch-up updates are rare, so they skip the static fast path that the
+  // per-measurement update() has and always go through variant dispatch.
+  auto execution_policy = resolve_execution_policy();
   std::visit(
       [&, this](auto& policy, auto& motion_model, auto& sensor_model) {
-        particles_ |=
-            beluga::actions::propagate(policy, motion_model(control_action_window_ << base_pose_in_odom)) |  //
-            beluga::actions::reweight(policy, sensor_model(std::move(measurement))) |                        //
-            beluga::actions::normalize(policy);
+        run_coalesced_pipeline(policy, motion_model, sensor_model, base_pose_in_odom, measurements, chain_reweights);
       },
-      execution_policy_, motion_model_, sensor_model_);
+      execution_policy, motion_model_, sensor_model_);
+
+  stats.pipeline_duration = std::chrono::steady_clock::now() - pipeline_start_time;
+  return finish_update(stats, fault_counts_at_start);
+}
+
+void Amcl::incremental_resample(double random_state_probability) {
+  const std::size_t population_size = particles_.size();
+  const auto budget = std::max<std::size_t>(
+      1UL,
+      static_cast<std::size_t>(
+          std::ceil(params_.incremental_resample_fraction * static_cast<double>(population_size))));
+
+  // The KLD criterion is evaluated over the composite population — replaced and
+  // untouched slots alike — so the size keeps adapting even though no single update
+  // redraws everything. If the whole population is consumed without meeting the
+  // condition, it is under-dispersed for its spread and grows by the budget.
+  std::size_t target_size = population_size + budget;
+  {
+    auto condition = beluga::kld_condition(params_.min_particles, params_.kld_epsilon, params_.kld_z);
+    std::size_t count = 0;
+    for (const auto& state : beluga::views::states(particles_)) {
+      ++count;
+      if (!condition(spatial_hasher_(state))) {
+        target_size = count;
+        break;
+      }
+    }
+  }
 
-  const double random_state_probability = random_probability_estimator_(particles_);
+  // Approach the target by at most the per-update budget, within the configured bounds.
+  std::size_t new_size =
+      std::clamp(target_size, population_size - std::min(budget, population_size), population_size + budget);
+  new_size = std::clamp(new_size, params_.min_particles, params_.max_particles);
+  const std::size_t growth = new_size > population_size ? new_size - population_size : 0UL;
+
+  // Replacements are drawn from the full composite before any slot is touched, with
+  // random states interspersed at the recovery probability just like a full resample.
+  auto random_state = ranges::compose(beluga::make_from_state<particle_type>, std::ref(map_distribution_));
+  auto draws = particles_ |  //
+               beluga::views::sample |
+               beluga::views::random_intersperse(std::move(random_state), random_state_probability) |
+               ranges::views::take_exactly(budget + growth);
+  incremental_resample_scratch_.clear();
+  for (auto&& draw : draws) {
+    incremental_resample_scratch_.push_back(draw);
+  }
+
+  // Replaced slots take the mean population weight: resampling makes them typical by
+  // construction, and keeping the composite on a single scale preserves the relative
+  // weights of the untouched particles until their slots rotate.
+  const double average_weight = weight_statistics_.average_weight() > 0.0 ? weight_statistics_.average_weight() : 1.0;
+  particles_.resize(new_size);
+  auto* const states = particles_.data<0>();
+  auto* const weights = particles_.data<1>();
+  const auto* const replacement_states = incremental_resample_scratch_.data<0>();
+  for (std::size_t i = 0; i < growth; ++i) {
+    states[population_size + i] = replacement_states[budget + i];
+    weights[population_size + i] = average_weight;
+  }
+  for (std::size_t i = 0; i < budget; ++i) {
+    const std::size_t slot = (incremental_resample_cursor_ + i) % new_size;
+    states[slot] = replacement_states[i];
+    weights[slot] = average_weight;
+  }
+  incremental_resample_cursor_ = (incremental_resample_cursor_ + budget) % new_size;
+}
+
+auto Amcl::finish_update(AmclUpdateStats stats, beluga::PageFaultCounts fault_counts_at_start)
+    -> std::optional<std::pair<Sophus::SE2d, Sophus::Matrix3d>> {
+  // The statistics accumulated during the normalization sweep already carry the
+  // squared total and the mean weight, so neither the effective sample size nor
+  // the recovery estimator update revisits the weight column.
+  stats.effective_sample_size = weight_statistics_.effective_sample_size();
+
+  const double random_state_probability = random_probability_estimator_(weight_statistics_);
+  stats.random_state_probability = random_state_probability;
+  std::tie(stats.recovery_slow_average, stats.recovery_fast_average) = random_probability_estimator_.filter_outputs();
 
   if (resample_policy_(particles_)) {
+    const auto resample_start_time = std::chrono::steady_clock::now();
     auto random_state = ranges::compose(beluga::make_from_state<particle_type>, std::ref(map_distribution_));
 
     if (random_state_probability > 0.0) {
       random_probability_estimator_.reset();
     }
 
-    particles_ |= beluga::views::sample |
-                  beluga::views::random_intersperse(std::move(random_state), random_state_probability) |
-                  beluga::views::take_while_kld(
-                      spatial_hasher_,        //
-                      params_.min_particles,  //
-                      params_.max_particles,  //
-                      params_.kld_epsilon,    //
-                      params_.kld_z) |
-                  beluga::actions::assign;
+    if (params_.min_cluster_weight_share <= 0.0 && params_.incremental_resample_fraction > 0.0) {
+      // Bounded-cost alternative to the full resamples below: only a rotating fraction
+      // of the population is redrawn, trading the occasional optimal resample for a
+      // predictable per-update cost.
+      incremental_resample(random_state_probability);
+    } else if (params_.min_cluster_weight_share > 0.0) {
+      // Stratified-by-cluster resampling: cluster the current population and floor each
+      // cluster's share of the sampling distribution, so minority hypotheses survive
+      // symmetric environments without inflating the particle count.
+      clusterizer_.cluster_into(beluga::views::states(particles_), beluga::views::weights(particles_), clusters_);
+      particles_ |= beluga::views::cluster_stratified_sample(clusters_, params_.min_cluster_weight_share) |
+                    beluga::views::random_intersperse(std::move(random_state), random_state_probability) |
+                    beluga::views::take_while_kld(
+                        spatial_hasher_,        //
+                        params_.min_particles,  //
+                        params_.max_particles,  //
+                        params_.kld_epsilon,    //
+                        params_.kld_z) |
+                    beluga::actions::assign;
+    } else {
+      particles_ |= beluga::views::sample |
+                    beluga::views::random_intersperse(std::move(random_state), random_state_probability) |
+                    beluga::views::take_while_kld(
+                        spatial_hasher_,        //
+                        params_.min_particles,  //
+                        params_.max_particles,  //
+                        params_.kld_epsilon,    //
+                        params_.kld_z) |
+                    beluga::actions::assign;
+    }
+
+    stats.resampled = true;
+    stats.resample_duration = std::chrono::steady_clock::now() - resample_start_time;
   }
 
+  stats.particle_count = particles_.size();
+  const auto fault_counts = beluga::current_page_fault_counts();
+  stats.minor_page_faults = fault_counts.minor - fault_counts_at_start.minor;
+  stats.major_page_faults = fault_counts.major - fault_counts_at_start.major;
+  last_update_stats_ = stats;
+  publish_snapshot();
+
   force_update_ = false;
   return beluga::cluster_based_estimate(beluga::views::states(particles_), beluga::views::weights(particles_));
 }
@@ -86,6 +86,24 @@ bool use_mean_covariance(
   return true;
 }
 
+void use_region_size(const Eigen::Vector3d& center, double size, visualization_msgs::msg::Marker& marker) {
+  marker.type = visualization_msgs::msg::Marker::CUBE;
+  marker.action = visualization_msgs::msg::Marker::ADD;
+
+  marker.pose.position.x = center[0];
+  marker.pose.position.y = center[1];
+  marker.pose.position.z = center[2];
+
+  marker.scale.x = size;
+  marker.scale.y = size;
+  marker.scale.z = size;
+
+  marker.color.r = 1.0F;
+  marker.color.g = 0.0F;
+  marker.color.b = 0.0F;
+  marker.color.a = 1.0F;
+}
+
 void use_cell_size(const Eigen::Vector<int, 3>& position, double size, visualization_msgs::msg::Marker& marker) {
   marker.type = visualization_msgs::msg::Marker::CUBE;
   marker.action = visualization_msgs::msg::Marker::ADD;
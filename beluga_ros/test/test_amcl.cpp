@@ -18,11 +18,13 @@
 #include <cstdint>
 #include <execution>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
 
 #include <beluga/motion/differential_drive_model.hpp>
+#include <beluga/motion/stationary_model.hpp>
 #include <beluga/sensor/likelihood_field_model.hpp>
 
 #include "beluga_ros/amcl.hpp"
@@ -92,6 +94,47 @@ auto make_amcl() {
   };
 }
 
+TEST(TestAmcl, UpdateWithAutoExecutionPolicy) {
+  auto map = make_dummy_occupancy_grid();
+  auto params = beluga_ros::AmclParams{};
+  params.max_particles = 50UL;
+  auto amcl = beluga_ros::Amcl{
+      map,                                                                     //
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},   //
+      beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map},  //
+      params,                                                                  //
+      beluga_ros::AutoExecutionPolicy{},
+  };
+  amcl.initialize_from_map();
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, UpdateWithIncrementalResampling) {
+  auto map = make_dummy_occupancy_grid();
+  auto params = beluga_ros::AmclParams{};
+  params.min_particles = 20UL;
+  params.max_particles = 50UL;
+  params.incremental_resample_fraction = 0.25;
+  auto amcl = beluga_ros::Amcl{
+      map,                                                                     //
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},   //
+      beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map},  //
+      params,                                                                  //
+      std::execution::seq,
+  };
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  for (int i = 0; i < 5; ++i) {
+    const auto pose = Sophus::SE2d{0.0, {static_cast<double>(i), 0.0}};
+    auto estimate = amcl.update(pose, make_dummy_laser_scan());
+    ASSERT_TRUE(estimate.has_value());
+    ASSERT_TRUE(amcl.last_update_stats().value().resampled);
+    ASSERT_GE(amcl.particles().size(), params.min_particles);
+    ASSERT_LE(amcl.particles().size(), params.max_particles);
+  }
+}
+
 TEST(TestAmcl, InitializeWithNoParticles) {
   auto amcl = make_amcl();
   ASSERT_EQ(amcl.particles().size(), 0);
@@ -156,6 +199,201 @@ TEST(TestAmcl, UpdateWithParticlesNoMotion) {
   ASSERT_FALSE(estimate.has_value());
 }
 
+TEST(TestAmcl, UpdateMapWithPrebuiltSensorModel) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto map = make_dummy_occupancy_grid();
+  auto sensor_model = beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map};
+  amcl.update_map(map, std::move(sensor_model));
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, UpdateParamsInPlace) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto params = beluga_ros::AmclParams{};
+  params.max_particles = 50UL;
+  params.resample_interval = 2UL;
+  amcl.update_params(params);
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  // The new resampling interval applies from the next update, which no longer resamples.
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+  ASSERT_FALSE(amcl.last_update_stats().value().resampled);
+}
+
+TEST(TestAmcl, UpdateMotionModelInPlace) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  amcl.update_motion_model(beluga::StationaryModel{});
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, UpdateSensorModelPreservesParticles) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto params = beluga::LikelihoodFieldModelParam{};
+  params.sigma_hit = 0.4;
+  auto map = make_dummy_occupancy_grid();
+  amcl.update_sensor_model(beluga::LikelihoodFieldModel{params, map});
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, LastUpdateStats) {
+  auto amcl = make_amcl();
+  ASSERT_FALSE(amcl.last_update_stats().has_value());
+  amcl.initialize_from_map();
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+  ASSERT_TRUE(amcl.last_update_stats().has_value());
+  const auto& stats = amcl.last_update_stats().value();
+  EXPECT_EQ(stats.particle_count, amcl.particles().size());
+  EXPECT_GT(stats.effective_sample_size, 0.0);
+}
+
+TEST(TestAmcl, ParticleSnapshot) {
+  auto amcl = make_amcl();
+  const auto initial_snapshot = amcl.particles_snapshot();
+  ASSERT_NE(initial_snapshot.particles, nullptr);
+  ASSERT_EQ(initial_snapshot.particles->size(), 0);
+  amcl.initialize_from_map();
+  const auto snapshot = amcl.particles_snapshot();
+  ASSERT_GT(snapshot.version, initial_snapshot.version);
+  ASSERT_EQ(snapshot.particles->size(), 50UL);
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+  // Published buffers are immutable; the update swapped in a new one.
+  ASSERT_EQ(snapshot.particles->size(), 50UL);
+  ASSERT_GT(amcl.particles_snapshot().version, snapshot.version);
+}
+
+auto make_dummy_measurement() {
+  return std::vector<std::pair<double, double>>{{1., 0.}, {2., 0.}, {3., 0.}};
+}
+
+TEST(TestAmcl, UpdateCoalescedWithNoMeasurements) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  auto estimate = amcl.update_coalesced({});
+  ASSERT_FALSE(estimate.has_value());
+}
+
+TEST(TestAmcl, UpdateCoalescedWithSingleMeasurement) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  auto measurements = std::vector<beluga_ros::Amcl::timed_measurement_type>{};
+  measurements.emplace_back(Sophus::SE2d{}, make_dummy_measurement());
+  auto estimate = amcl.update_coalesced(std::move(measurements));
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, UpdateCoalescedWithPendingMeasurements) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  auto measurements = std::vector<beluga_ros::Amcl::timed_measurement_type>{};
+  measurements.emplace_back(Sophus::SE2d{}, make_dummy_measurement());
+  measurements.emplace_back(Sophus::SE2d{0.0, {0.5, 0.0}}, make_dummy_measurement());
+  measurements.emplace_back(Sophus::SE2d{0.0, {1.0, 0.0}}, make_dummy_measurement());
+  auto estimate = amcl.update_coalesced(std::move(measurements));
+  ASSERT_TRUE(estimate.has_value());
+  ASSERT_TRUE(amcl.last_update_stats().has_value());
+  EXPECT_EQ(amcl.last_update_stats()->particle_count, amcl.particles().size());
+}
+
+TEST(TestAmcl, UpdateCoalescedWithChainedReweights) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  auto measurements = std::vector<beluga_ros::Amcl::timed_measurement_type>{};
+  measurements.emplace_back(Sophus::SE2d{}, make_dummy_measurement());
+  measurements.emplace_back(Sophus::SE2d{0.0, {1.0, 0.0}}, make_dummy_measurement());
+  auto estimate = amcl.update_coalesced(std::move(measurements), true);
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, UpdateCoalescedNoMotion) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+  auto measurements = std::vector<beluga_ros::Amcl::timed_measurement_type>{};
+  measurements.emplace_back(Sophus::SE2d{}, make_dummy_measurement());
+  measurements.emplace_back(Sophus::SE2d{}, make_dummy_measurement());
+  estimate = amcl.update_coalesced(std::move(measurements));
+  ASSERT_FALSE(estimate.has_value());
+}
+
+TEST(TestAmcl, StagedParticlesInstallAtUpdateBoundary) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  const auto preparer = amcl.make_global_localization_preparer();
+  auto candidates = preparer();
+  ASSERT_EQ(candidates.size(), 50UL);
+  amcl.stage_particles(std::move(candidates));
+  // The staged set replaces the population at the next update, which runs as forced.
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, StagedParticlesInstallWithoutInitialization) {
+  auto amcl = make_amcl();
+  ASSERT_EQ(amcl.particles().size(), 0);
+  amcl.stage_particles(amcl.make_global_localization_preparer()());
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+  ASSERT_GT(amcl.particles().size(), 0);
+}
+
+TEST(TestAmcl, PreparerPreScoresCandidates) {
+  auto map = make_dummy_occupancy_grid();
+  auto params = beluga_ros::AmclParams{};
+  params.max_particles = 50UL;
+  params.seeded_candidate_factor = 1UL;  // no oversampling: scored candidates are the initial set
+  auto amcl = beluga_ros::Amcl{
+      map,                                                                     //
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},   //
+      beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map},  //
+      params,                                                                  //
+      std::execution::seq,
+  };
+  const auto preparer = amcl.make_global_localization_preparer(make_dummy_measurement());
+  const auto candidates = preparer();
+  ASSERT_EQ(candidates.size(), 50UL);
+  for (const auto& [state, weight] : candidates) {
+    ASSERT_GT(static_cast<double>(weight), 0.0);
+  }
+}
+
+TEST(TestAmcl, PreparerSeedsFromMeasurement) {
+  auto map = make_dummy_occupancy_grid();
+  auto params = beluga_ros::AmclParams{};
+  params.max_particles = 50UL;
+  params.seeded_candidate_factor = 4UL;
+  params.seeded_uniform_floor = 0.2;
+  auto amcl = beluga_ros::Amcl{
+      map,                                                                     //
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},   //
+      beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map},  //
+      params,                                                                  //
+      std::execution::seq,
+  };
+  const auto preparer = amcl.make_global_localization_preparer(make_dummy_measurement());
+  const auto candidates = preparer();
+  ASSERT_EQ(candidates.size(), 50UL);
+  for (const auto& [state, weight] : candidates) {
+    // Seeds are resampled from the scored candidates, so they start with uniform weights.
+    ASSERT_EQ(static_cast<double>(weight), 1.0);
+  }
+}
+
 TEST(TestAmcl, UpdateWithParticlesForced) {
   auto amcl = make_amcl();
   ASSERT_EQ(amcl.particles().size(), 0);
@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -78,4 +80,106 @@ TEST(TestLaserScan, AngleIncrements) {
   ASSERT_NEAR(angles[2], 0.2, 0.001);
 }
 
+TEST(TestLaserScan, BorrowedMessage) {
+  auto message = sensor_msgs::msg::LaserScan{};
+  message.ranges = std::vector<float>{1.F, 2.F, 3.F};
+  message.range_min = 10.F;
+  message.range_max = 100.F;
+  auto scan = beluga_ros::LaserScan(message);
+  ASSERT_EQ(scan.min_range(), 10.);
+  ASSERT_EQ(scan.max_range(), 100.);
+  ASSERT_EQ(scan.size(), 3UL);
+}
+
+TEST(TestLaserScan, CartesianPointsAreCached) {
+  auto message = make_message();
+  message->ranges = std::vector<float>{1.F, 2.F, 3.F};
+  message->range_min = 0.F;
+  message->range_max = 100.F;
+  message->angle_min = 0.F;
+  message->angle_increment = 0.1F;
+  auto scan = beluga_ros::LaserScan(message);
+  const auto& points = scan.points_in_cartesian_coordinates();
+  ASSERT_EQ(points.size(), 3UL);
+  ASSERT_NEAR(points[1].x(), 2.0 * std::cos(0.1), 0.001);
+  ASSERT_NEAR(points[1].y(), 2.0 * std::sin(0.1), 0.001);
+  ASSERT_EQ(&points, &scan.points_in_cartesian_coordinates());
+}
+
+TEST(TestLaserScan, DeskewInterpolatesSweepMotion) {
+  auto message = make_message();
+  message->ranges = std::vector<float>{1.F, 1.F, 1.F};
+  message->range_min = 0.F;
+  message->range_max = 100.F;
+  message->angle_min = 0.F;
+  message->angle_increment = 0.F;
+  auto scan = beluga_ros::LaserScan(message);
+  constexpr double kSweepRotation = 0.2;
+  scan.set_motion_over_sweep(Sophus::SE2d{Sophus::SO2d{kSweepRotation}, Eigen::Vector2d::Zero()});
+  const auto& points = scan.points_in_cartesian_coordinates();
+  ASSERT_EQ(points.size(), 3UL);
+  // The first beam is the reference frame; later beams are unwarped by their share of the motion.
+  ASSERT_NEAR(points[0].x(), 1.0, 0.001);
+  ASSERT_NEAR(points[0].y(), 0.0, 0.001);
+  ASSERT_NEAR(points[1].y(), std::sin(kSweepRotation / 2.), 0.001);
+  ASSERT_NEAR(points[2].y(), std::sin(kSweepRotation), 0.001);
+}
+
+TEST(TestLaserScan, BeamClassificationCounts) {
+  auto message = make_message();
+  message->ranges = std::vector<float>{1.F, std::numeric_limits<float>::quiet_NaN(), 0.5F, 150.F, 3.F};
+  message->range_min = 1.F;
+  message->range_max = 100.F;
+  auto scan = beluga_ros::LaserScan(message);
+  const auto& classification = scan.beam_classification();
+  ASSERT_EQ(classification.hits, 2UL);
+  ASSERT_EQ(classification.max_range_misses, 1UL);
+  ASSERT_EQ(classification.invalid, 2UL);
+  // Only hits are materialized as cartesian points.
+  ASSERT_EQ(scan.points_in_cartesian_coordinates().size(), 2UL);
+}
+
+TEST(TestAdaptiveBeamBudget, StartsAtFullBudget) {
+  const auto budget = beluga_ros::AdaptiveBeamBudget{};
+  ASSERT_EQ(budget.beams(), 60UL);
+}
+
+TEST(TestAdaptiveBeamBudget, ShrinksWhenConverged) {
+  auto params = beluga_ros::AdaptiveBeamBudgetParams{};
+  params.smoothing_factor = 1.0;
+  auto budget = beluga_ros::AdaptiveBeamBudget{params};
+  budget.update(0.8, 0.01);  // healthy weights, tight estimate
+  ASSERT_EQ(budget.beams(), params.min_beams);
+}
+
+TEST(TestAdaptiveBeamBudget, GrowsDuringRecovery) {
+  auto params = beluga_ros::AdaptiveBeamBudgetParams{};
+  params.smoothing_factor = 1.0;
+  auto budget = beluga_ros::AdaptiveBeamBudget{params};
+  budget.update(0.8, 0.01);
+  ASSERT_EQ(budget.beams(), params.min_beams);
+  budget.update(0.1, 0.01);  // degenerate weights demand the full budget
+  ASSERT_EQ(budget.beams(), params.max_beams);
+  budget.update(0.8, 2.0);  // so does a spread-out estimate
+  ASSERT_EQ(budget.beams(), params.max_beams);
+}
+
+TEST(TestAdaptiveBeamBudget, SmoothsBudgetChanges) {
+  auto budget = beluga_ros::AdaptiveBeamBudget{};
+  budget.update(0.8, 0.01);
+  // With smoothing, one converged update only moves the budget part of the way down.
+  ASSERT_LT(budget.beams(), 60UL);
+  ASSERT_GT(budget.beams(), 20UL);
+}
+
+TEST(TestAdaptiveBeamBudget, ResetRestoresFullBudget) {
+  auto params = beluga_ros::AdaptiveBeamBudgetParams{};
+  params.smoothing_factor = 1.0;
+  auto budget = beluga_ros::AdaptiveBeamBudget{params};
+  budget.update(0.8, 0.01);
+  ASSERT_EQ(budget.beams(), params.min_beams);
+  budget.reset();
+  ASSERT_EQ(budget.beams(), params.max_beams);
+}
+
 }  // namespace
@@ -0,0 +1,103 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <sophus/se2.hpp>
+
+#include "beluga/sensor/data/value_grid.hpp"
+#include "beluga_ros/likelihood_field.hpp"
+
+namespace {
+
+beluga::ValueGrid2<float> make_ramp_grid(std::size_t width, std::size_t height, double resolution) {
+  auto data = std::vector<float>(width * height);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<float>(i);
+  }
+  return beluga::ValueGrid2<float>{std::move(data), width, resolution};
+}
+
+TEST(TestLikelihoodField, Assign) {
+  const auto grid = make_ramp_grid(4, 4, 1.0);
+  auto message = nav_msgs::msg::OccupancyGrid{};
+  beluga_ros::assign_likelihood_field(grid, Sophus::SE2d{}, message);
+  ASSERT_EQ(message.info.width, 4U);
+  ASSERT_EQ(message.info.height, 4U);
+  ASSERT_EQ(message.data.size(), 16U);
+  EXPECT_EQ(message.data.front(), 0);
+  EXPECT_EQ(message.data.back(), 100);
+}
+
+TEST(TestLikelihoodField, AssignFlat) {
+  const auto grid = beluga::ValueGrid2<float>{std::vector<float>(16, 0.5F), 4, 1.0};
+  auto message = nav_msgs::msg::OccupancyGrid{};
+  beluga_ros::assign_likelihood_field(grid, Sophus::SE2d{}, message);
+  for (const auto value : message.data) {
+    EXPECT_EQ(value, 0);
+  }
+}
+
+TEST(TestLikelihoodField, AssignRegionOfInterest) {
+  const auto grid = make_ramp_grid(8, 8, 1.0);
+  auto message = nav_msgs::msg::OccupancyGrid{};
+  beluga_ros::assign_likelihood_field(grid, Sophus::SE2d{}, Eigen::Vector2d{4.0, 4.0}, 4.0, message);
+  // The window is clamped to whole cells, so a 4 m window at 1 m resolution
+  // spans 5 cells per axis.
+  ASSERT_EQ(message.info.width, 5U);
+  ASSERT_EQ(message.info.height, 5U);
+  ASSERT_EQ(message.data.size(), 25U);
+  // The origin shifts to the lower corner of the window.
+  EXPECT_DOUBLE_EQ(message.info.origin.position.x, 2.0);
+  EXPECT_DOUBLE_EQ(message.info.origin.position.y, 2.0);
+  // Normalization happens over the window, so its extrema hit the full scale.
+  EXPECT_EQ(message.data.front(), 0);
+  EXPECT_EQ(message.data.back(), 100);
+}
+
+TEST(TestLikelihoodField, AssignRegionOfInterestClampedToGrid) {
+  const auto grid = make_ramp_grid(8, 8, 1.0);
+  auto message = nav_msgs::msg::OccupancyGrid{};
+  beluga_ros::assign_likelihood_field(grid, Sophus::SE2d{}, Eigen::Vector2d{0.0, 0.0}, 4.0, message);
+  ASSERT_EQ(message.info.width, 3U);  // x in [0, 3), clamped at the grid edge
+  ASSERT_EQ(message.info.height, 3U);
+  EXPECT_DOUBLE_EQ(message.info.origin.position.x, 0.0);
+  EXPECT_DOUBLE_EQ(message.info.origin.position.y, 0.0);
+}
+
+TEST(TestLikelihoodField, AssignRegionOfInterestOutsideGrid) {
+  const auto grid = make_ramp_grid(8, 8, 1.0);
+  auto message = nav_msgs::msg::OccupancyGrid{};
+  beluga_ros::assign_likelihood_field(grid, Sophus::SE2d{}, Eigen::Vector2d{100.0, 100.0}, 4.0, message);
+  EXPECT_EQ(message.info.width, 0U);
+  EXPECT_EQ(message.info.height, 0U);
+  EXPECT_EQ(message.data.size(), 0U);
+}
+
+TEST(TestLikelihoodField, AssignRegionOfInterestWithOrigin) {
+  const auto grid = make_ramp_grid(8, 8, 1.0);
+  const auto origin = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{-4.0, -4.0}};
+  auto message = nav_msgs::msg::OccupancyGrid{};
+  // A window centered on the global frame origin maps to the middle of the grid.
+  beluga_ros::assign_likelihood_field(grid, origin, Eigen::Vector2d{0.0, 0.0}, 4.0, message);
+  ASSERT_EQ(message.info.width, 5U);
+  ASSERT_EQ(message.info.height, 5U);
+  EXPECT_DOUBLE_EQ(message.info.origin.position.x, -2.0);
+  EXPECT_DOUBLE_EQ(message.info.origin.position.y, -2.0);
+}
+
+}  // namespace
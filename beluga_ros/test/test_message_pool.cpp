@@ -0,0 +1,51 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <geometry_msgs/msg/pose_array.hpp>
+
+#include "beluga_ros/message_pool.hpp"
+
+namespace {
+
+TEST(TestMessagePool, RecyclesReleasedMessages) {
+  auto pool = beluga_ros::MessagePool<geometry_msgs::msg::PoseArray>{};
+  auto message = pool.acquire();
+  message->poses.resize(100);
+  const auto* address = message.get();
+  message.reset();  // return to the pool
+  auto recycled = pool.acquire();
+  ASSERT_EQ(recycled.get(), address);
+  ASSERT_GE(recycled->poses.capacity(), 100UL);
+}
+
+TEST(TestMessagePool, AllocatesWhileBusy) {
+  auto pool = beluga_ros::MessagePool<geometry_msgs::msg::PoseArray>{};
+  auto first = pool.acquire();
+  auto second = pool.acquire();
+  ASSERT_NE(first.get(), second.get());
+}
+
+TEST(TestMessagePool, OutlivedByMessages) {
+  auto pool = std::make_unique<beluga_ros::MessagePool<geometry_msgs::msg::PoseArray>>();
+  auto message = pool->acquire();
+  pool.reset();
+  message->poses.resize(10);  // must remain valid and safe to release
+  message.reset();
+}
+
+}  // namespace
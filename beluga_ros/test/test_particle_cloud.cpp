@@ -143,6 +143,58 @@ TEST(TestParticleCloud3, AssignMatchingEmpty) {
   EXPECT_EQ(message.poses.size(), 0U);
 }
 
+TEST(TestParticleCloud, Centroids) {
+  auto particles = std::vector<std::tuple<Sophus::SE2d, beluga::Weight>>{};
+  for (int i = 0; i < 10; ++i) {
+    const double offset = 0.01 * i;
+    particles.emplace_back(Sophus::SE2d{Sophus::SO2d{0.0}, Eigen::Vector2d{offset, 0.0}}, beluga::Weight(1.0));
+    particles.emplace_back(Sophus::SE2d{Sophus::SO2d{0.0}, Eigen::Vector2d{5.0 + offset, 5.0}}, beluga::Weight(1.0));
+  }
+  const auto centroids = beluga_ros::particle_cloud_centroids(particles);
+  ASSERT_EQ(centroids.size(), 2U);
+  for (const auto& [state, weight] : centroids) {
+    const auto& translation = state.translation();
+    const bool near_first_group = (translation - Eigen::Vector2d{0.045, 0.0}).norm() < 0.1;
+    const bool near_second_group = (translation - Eigen::Vector2d{5.045, 5.0}).norm() < 0.1;
+    EXPECT_TRUE(near_first_group || near_second_group);
+    EXPECT_DOUBLE_EQ(weight, 10.0);  // half the total weight per cluster
+  }
+}
+
+TEST(TestParticleCloud, RegionOfInterest) {
+  auto particles = std::vector<std::tuple<Sophus::SE2d, beluga::Weight>>{};
+  for (int i = -5; i <= 5; ++i) {
+    const double offset = static_cast<double>(i);
+    particles.emplace_back(Sophus::SE2d{Sophus::SO2d{0.0}, Eigen::Vector2d{offset, 0.0}}, beluga::Weight(1.0));
+  }
+  const auto center = Sophus::SE2d{Sophus::SO2d{0.0}, Eigen::Vector2d{1.0, 0.0}};
+  const auto selection = beluga_ros::particle_cloud_region_of_interest(particles, center, 4.0);
+  ASSERT_EQ(selection.size(), 5U);  // x in [-1, 3]
+  for (const auto& [state, weight] : selection) {
+    EXPECT_LE(std::abs(state.translation().x() - 1.0), 2.0);
+  }
+}
+
+TEST(TestParticleCloud, RegionOfInterestEmpty) {
+  const auto particles = std::vector{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.0}, Eigen::Vector2d{10.0, 10.0}}, beluga::Weight(1.0)),
+  };
+  const auto center = Sophus::SE2d{};
+  const auto selection = beluga_ros::particle_cloud_region_of_interest(particles, center, 4.0);
+  EXPECT_EQ(selection.size(), 0U);
+}
+
+TEST(TestParticleCloud3, RegionOfInterest) {
+  const auto particles = std::vector{
+      std::make_tuple(Sophus::SE3d{Sophus::SO3d{}, Eigen::Vector3d{0.0, 0.0, 1.0}}, beluga::Weight(1.0)),
+      std::make_tuple(Sophus::SE3d{Sophus::SO3d{}, Eigen::Vector3d{0.0, 0.0, 5.0}}, beluga::Weight(1.0)),
+  };
+  const auto center = Sophus::SE3d{};
+  const auto selection = beluga_ros::particle_cloud_region_of_interest(particles, center, 4.0);
+  ASSERT_EQ(selection.size(), 1U);  // the window is cubic for SE(3) states
+  EXPECT_DOUBLE_EQ(std::get<0>(selection.front()).translation().z(), 1.0);
+}
+
 TEST(TestParticleCloud, AssignMarkers) {
   using Constants = Sophus::Constants<double>;
   const auto particles = std::vector{
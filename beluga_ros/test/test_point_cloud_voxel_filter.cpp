@@ -0,0 +1,60 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "beluga_ros/point_cloud_voxel_filter.hpp"
+
+namespace {
+
+TEST(PointCloudVoxelFilter, KeepsAtMostOnePointPerVoxel) {
+  auto filter = beluga_ros::PointCloudVoxelFilter{};
+  auto points = std::vector<Eigen::Vector3d>{{0.1, 0.1, 0.1}, {0.2, 0.2, 0.2}, {1.5, 0.1, 0.1}, {0.3, 0.1, 0.2}};
+  filter.filter(1.0, 1U, points);
+  ASSERT_EQ(points.size(), 2U);
+  ASSERT_TRUE(points[0].isApprox(Eigen::Vector3d{0.1, 0.1, 0.1}));
+  ASSERT_TRUE(points[1].isApprox(Eigen::Vector3d{1.5, 0.1, 0.1}));
+}
+
+TEST(PointCloudVoxelFilter, RespectsPerVoxelCap) {
+  auto filter = beluga_ros::PointCloudVoxelFilter{};
+  auto points = std::vector<Eigen::Vector3d>{{0.1, 0.1, 0.1}, {0.2, 0.2, 0.2}, {0.3, 0.3, 0.3}, {1.5, 0.1, 0.1}};
+  filter.filter(1.0, 2U, points);
+  ASSERT_EQ(points.size(), 3U);
+  ASSERT_TRUE(points[2].isApprox(Eigen::Vector3d{1.5, 0.1, 0.1}));
+}
+
+TEST(PointCloudVoxelFilter, ZeroCapDisablesFiltering) {
+  auto filter = beluga_ros::PointCloudVoxelFilter{};
+  auto points = std::vector<Eigen::Vector3d>{{0.1, 0.1, 0.1}, {0.2, 0.2, 0.2}};
+  filter.filter(1.0, 0U, points);
+  ASSERT_EQ(points.size(), 2U);
+}
+
+TEST(PointCloudVoxelFilter, ReusableAcrossClouds) {
+  auto filter = beluga_ros::PointCloudVoxelFilter{};
+  auto points = std::vector<Eigen::Vector3d>{{0.1, 0.1, 0.1}, {0.2, 0.2, 0.2}};
+  filter.filter(1.0, 1U, points);
+  ASSERT_EQ(points.size(), 1U);
+  // Occupancy from the previous cloud must not leak into the next one.
+  points = {{0.1, 0.1, 0.1}, {1.5, 0.1, 0.1}};
+  filter.filter(1.0, 1U, points);
+  ASSERT_EQ(points.size(), 2U);
+}
+
+}  // namespace
@@ -93,6 +93,71 @@ TEST(TestSparsePointCloud, DoubleXYZIPoints) {
   }
 }
 
+TEST(TestSparsePointCloud, BorrowedMessage) {
+  const auto point_data = make_point_data<float>(kUnorderedWidth * kUnorderedHeight);
+  const auto message = make_xyz_pointcloud<float>(kUnorderedWidth, kUnorderedHeight, point_data);
+
+  const auto cloud_sparse = beluga_ros::SparsePointCloud3f(*message);
+  auto points = cloud_sparse.points() | ranges::to<std::vector>;
+  ASSERT_EQ(points.size(), point_data.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    ASSERT_EQ(point_data.at(i), points.at(i));
+  }
+}
+
+TEST(TestSparsePointCloud, StridedLayoutFastPath) {
+  const auto point_data = make_point_data<float>(kUnorderedWidth * kUnorderedHeight);
+  const auto message = make_xyzi_pointcloud<float>(kUnorderedWidth, kUnorderedHeight, point_data);
+
+  const auto cloud_sparse = beluga_ros::SparsePointCloud3f(message);
+  ASSERT_TRUE(cloud_sparse.has_strided_layout());
+  const auto points = cloud_sparse.points_matrix();
+  ASSERT_EQ(static_cast<std::size_t>(points.cols()), point_data.size());
+  for (size_t i = 0; i < point_data.size(); ++i) {
+    ASSERT_EQ(point_data.at(i), points.col(static_cast<Eigen::Index>(i)));
+  }
+}
+
+TEST(TestSparsePointCloud, BulkTransformedAssignMatchesPerPoint) {
+  const auto point_data = make_point_data<float>(kUnorderedWidth * kUnorderedHeight);
+  const auto message = make_xyzi_pointcloud<float>(kUnorderedWidth, kUnorderedHeight, point_data);
+
+  const auto cloud_sparse = beluga_ros::SparsePointCloud3f(message);
+  ASSERT_TRUE(cloud_sparse.has_strided_layout());
+  const auto transform = Sophus::SE3d{Sophus::SO3d::rotZ(0.5), Eigen::Vector3d{1., 2., 3.}};
+  auto points = std::vector<Eigen::Vector3d>{};
+  beluga_ros::assign_transformed_points(cloud_sparse, transform, points);
+  ASSERT_EQ(points.size(), point_data.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const Eigen::Vector3d expected = transform * point_data.at(i).cast<double>();
+    ASSERT_TRUE(points.at(i).isApprox(expected));
+  }
+}
+
+TEST(TestSparsePointCloud, BulkTransformedAssignReusesCapacity) {
+  const auto point_data = make_point_data<float>(kUnorderedWidth * kUnorderedHeight);
+  const auto message = make_xyz_pointcloud<float>(kUnorderedWidth, kUnorderedHeight, point_data);
+
+  const auto cloud_sparse = beluga_ros::SparsePointCloud3f(message);
+  auto points = std::vector<Eigen::Vector3d>{};
+  beluga_ros::assign_transformed_points(cloud_sparse, Sophus::SE3d{}, points);
+  ASSERT_EQ(points.size(), point_data.size());
+  const auto capacity = points.capacity();
+  const auto* const data = points.data();
+  // Refilling with the same cloud reuses the existing storage.
+  beluga_ros::assign_transformed_points(cloud_sparse, Sophus::SE3d{}, points);
+  ASSERT_EQ(points.capacity(), capacity);
+  ASSERT_EQ(points.data(), data);
+}
+
+TEST(TestSparsePointCloud, NoStridedLayoutOnDatatypeMismatch) {
+  const auto point_data = make_point_data<double>(kUnorderedWidth * kUnorderedHeight);
+  const auto message = make_xyz_pointcloud<double>(kUnorderedWidth, kUnorderedHeight, point_data);
+
+  const auto cloud_sparse = beluga_ros::SparsePointCloud3f(message);
+  ASSERT_FALSE(cloud_sparse.has_strided_layout());
+}
+
 TEST(TestSparsePointCloud, EmptyXYZPoints) {
   const auto message = make_xyz_pointcloud<float>(0);
 
@@ -14,6 +14,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <vector>
+
+#include <sophus/common.hpp>
 #include <sophus/se2.hpp>
 #include <sophus/se3.hpp>
 
@@ -98,4 +102,52 @@ TYPED_TEST(PoseWithCovarianceConvertTest, Basic) {
   ASSERT_EQ(message.covariance.size(), 36);
 }
 
+TEST(BatchPoseConvertTest, MatchesElementWiseConversionSE2) {
+  using Constants = Sophus::Constants<double>;
+  auto poses = std::vector<Sophus::SE2d>{};
+  for (int i = -8; i <= 8; ++i) {
+    const double theta = static_cast<double>(i) * Constants::pi() / 8.0;  // sweep (-π, π] inclusive
+    poses.emplace_back(Sophus::SO2d{theta}, Eigen::Vector2d{static_cast<double>(i), -static_cast<double>(i)});
+  }
+  auto messages = std::vector<geometry_msgs::msg::Pose>{};
+  beluga_ros::assign_poses(poses, messages);
+  ASSERT_EQ(messages.size(), poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    auto expected = geometry_msgs::msg::Pose{};
+    tf2::toMsg(poses[i], expected);
+    EXPECT_DOUBLE_EQ(messages[i].position.x, expected.position.x);
+    EXPECT_DOUBLE_EQ(messages[i].position.y, expected.position.y);
+    EXPECT_DOUBLE_EQ(messages[i].position.z, expected.position.z);
+    EXPECT_DOUBLE_EQ(messages[i].orientation.x, expected.orientation.x);
+    EXPECT_DOUBLE_EQ(messages[i].orientation.y, expected.orientation.y);
+    EXPECT_NEAR(messages[i].orientation.z, expected.orientation.z, 1e-12);
+    EXPECT_NEAR(messages[i].orientation.w, expected.orientation.w, 1e-12);
+  }
+}
+
+TEST(BatchPoseConvertTest, MatchesElementWiseConversionSE3) {
+  const auto poses = std::vector<Sophus::SE3d>{
+      Sophus::SE3d{},
+      Sophus::SE3d{Sophus::SO3d::rotZ(1.0), Eigen::Vector3d{1.0, 2.0, 3.0}},
+      Sophus::SE3d{Sophus::SO3d::rotX(-2.0), Eigen::Vector3d{-1.0, 0.0, 1.0}},
+  };
+  auto messages = std::vector<geometry_msgs::msg::Pose>{};
+  beluga_ros::assign_poses(poses, messages);
+  ASSERT_EQ(messages.size(), poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    auto expected = geometry_msgs::msg::Pose{};
+    tf2::toMsg(poses[i], expected);
+    EXPECT_EQ(messages[i], expected);
+  }
+}
+
+TEST(BatchPoseConvertTest, WritesOverExistingStorage) {
+  const auto poses = std::vector<Sophus::SE2d>{Sophus::SE2d{Sophus::SO2d{0.5}, Eigen::Vector2d{1.0, 2.0}}};
+  auto messages = std::vector<geometry_msgs::msg::Pose>(5);
+  beluga_ros::assign_poses(poses, messages);
+  ASSERT_EQ(messages.size(), 1U);
+  EXPECT_DOUBLE_EQ(messages.front().position.x, 1.0);
+  EXPECT_DOUBLE_EQ(messages.front().position.y, 2.0);
+}
+
 }  // namespace
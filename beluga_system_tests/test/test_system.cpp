@@ -12,17 +12,24 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <cstddef>
+#include <cstdlib>
 #include <execution>
 #include <filesystem>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <tuple>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
 #include <gtest/gtest.h>
 
 #include <tf2/convert.hpp>
@@ -90,6 +97,55 @@ auto odometry_to_sophus() {
   });
 }
 
+// ****************************************************************************
+// Performance budgets.
+// ****************************************************************************
+
+/// Performance budgets for one dataset replay.
+/**
+ * Budgets are read from the environment so each platform can pin its own recorded
+ * baseline; unset budgets disable the corresponding assertion, keeping the test
+ * purely a correctness check on machines without a baseline. The measured values
+ * are always recorded as test properties, which is how baselines get collected in
+ * the first place.
+ */
+struct PerformanceBudget {
+  /// Budget for the mean wall time of a performed filter update, in milliseconds.
+  std::optional<double> max_mean_update_latency_ms;
+  /// Budget for the process peak resident set size after the replay, in mebibytes.
+  std::optional<double> max_peak_rss_mib;
+};
+
+/// Reads a floating point budget from an environment variable, if set.
+std::optional<double> read_budget(const char* name) {
+  const char* value = std::getenv(name);
+  if (value == nullptr) {
+    return std::nullopt;
+  }
+  return std::stod(value);
+}
+
+/// Reads the performance budgets for this platform from the environment.
+PerformanceBudget get_performance_budget() {
+  return PerformanceBudget{
+      read_budget("BELUGA_SYSTEM_TEST_MAX_MEAN_UPDATE_LATENCY_MS"),
+      read_budget("BELUGA_SYSTEM_TEST_MAX_PEAK_RSS_MIB"),
+  };
+}
+
+/// Returns the process peak resident set size in mebibytes, if the platform exposes it.
+std::optional<double> peak_rss_mib() {
+#if defined(__linux__)
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return std::nullopt;
+  }
+  return static_cast<double>(usage.ru_maxrss) / 1024.0;  // ru_maxrss is in KiB on Linux
+#else
+  return std::nullopt;
+#endif
+}
+
 // ****************************************************************************
 // Particle filter implementation variants.
 // ****************************************************************************
@@ -134,14 +190,19 @@ void particle_filter_test(
   const double orientation_tolerance = 30.0 * Sophus::Constants<double>::pi() / 180.0;
 
   std::size_t update_count = 0;
+  std::chrono::steady_clock::duration update_latency_total{};
 
   for (auto [measurement, odom, ground_truth] : datapoints) {
+    const auto update_start = std::chrono::steady_clock::now();
     const auto estimate = filter.update(std::move(odom), std::move(measurement));
+    const auto update_latency = std::chrono::steady_clock::now() - update_start;
 
     if (!estimate.has_value()) {
       continue;
     }
 
+    update_latency_total += update_latency;
+
     const auto [mean, covariance] = estimate.value();
     const auto error = mean.inverse() * ground_truth;
 
@@ -152,6 +213,27 @@ void particle_filter_test(
   }
 
   ASSERT_GE(update_count, 2) << "There were less than 2 updates to the filter";
+
+  // Correctness alone lets a green but much slower release through; throughput
+  // regressions should fail here instead of surfacing through fleet telemetry.
+  const auto budget = get_performance_budget();
+
+  const double mean_update_latency_ms =
+      std::chrono::duration<double, std::milli>(update_latency_total).count() / static_cast<double>(update_count);
+  testing::Test::RecordProperty("mean_update_latency_ms", std::to_string(mean_update_latency_ms));
+  if (budget.max_mean_update_latency_ms.has_value()) {
+    EXPECT_LE(mean_update_latency_ms, *budget.max_mean_update_latency_ms)
+        << "Mean filter update latency exceeds the recorded baseline for this platform";
+  }
+
+  const auto rss = peak_rss_mib();
+  if (rss.has_value()) {
+    testing::Test::RecordProperty("peak_rss_mib", std::to_string(*rss));
+    if (budget.max_peak_rss_mib.has_value()) {
+      EXPECT_LE(*rss, *budget.max_peak_rss_mib)
+          << "Peak resident set size exceeds the recorded baseline for this platform";
+    }
+  }
 }
 
 // ****************************************************************************
@@ -17,7 +17,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include <openvdb/openvdb.h>
@@ -25,7 +27,6 @@
 
 #include <Eigen/Core>
 
-#include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/transform.hpp>
@@ -112,7 +113,6 @@ class VDBLikelihoodFieldModel {
   explicit VDBLikelihoodFieldModel(const param_type& params, const map_type& grid)
       : params_{params},
         grid_{openvdb::gridPtrCast<map_type>(grid.deepCopyGrid())},
-        accessor_{grid_->getConstAccessor()},
         transform_{grid_->transform()},
         background_{grid_->background()},
         two_squared_sigma_{2 * params.sigma_hit * params.sigma_hit},
@@ -137,23 +137,43 @@ class VDBLikelihoodFieldModel {
                               }) |
                               ranges::to<std::vector>();
     return [this, points = std::move(transformed_points)](const state_type& state) -> weight_type {
-      return ranges::accumulate(
-          points |  //
-              ranges::views::transform([this, state = beluga::To3d(state)](const auto& point) {
-                const Eigen::Vector3d point_in_state_frame = state * point;
-                const openvdb::math::Coord ijk = transform_.worldToIndexCellCentered(
-                    openvdb::math::Vec3d(point_in_state_frame.x(), point_in_state_frame.y(), point_in_state_frame.z()));
-                const auto distance = accessor_.isValueOn(ijk) ? accessor_.getValue(ijk) : background_;
-                return amplitude_ * std::exp(-(distance * distance) / two_squared_sigma_) + offset_;
-              }),
-          1.0, std::plus{});
+      static thread_local std::vector<std::pair<std::uint64_t, openvdb::math::Coord>> coords;
+      coords.clear();
+      coords.reserve(points.size());
+      const auto state_in_3d = beluga::To3d(state);
+      for (const auto& point : points) {
+        const Eigen::Vector3d point_in_state_frame = state_in_3d * point;
+        const openvdb::math::Coord ijk = transform_.worldToIndexCellCentered(
+            openvdb::math::Vec3d(point_in_state_frame.x(), point_in_state_frame.y(), point_in_state_frame.z()));
+        coords.emplace_back(leaf_key(ijk), ijk);
+      }
+      // Sort queries by the leaf node they fall in, so consecutive queries below hit the
+      // nodes the accessor already has cached instead of re-walking the tree from the root.
+      std::sort(coords.begin(), coords.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+      // Value accessors cache tree traversals and are not safe to share across threads, so
+      // each evaluation uses its own; particles are weighted in parallel.
+      typename map_type::ConstAccessor accessor = grid_->getConstAccessor();
+      double total = 1.0;
+      for (const auto& [key, ijk] : coords) {
+        const auto distance = accessor.isValueOn(ijk) ? accessor.getValue(ijk) : background_;
+        total += amplitude_ * std::exp(-(distance * distance) / two_squared_sigma_) + offset_;
+      }
+      return total;
     };
   }
 
  private:
+  /// Packs the leaf node origin of an index space coordinate into a sortable key.
+  [[nodiscard]] static std::uint64_t leaf_key(const openvdb::math::Coord& ijk) {
+    constexpr int kLeafLog2Dim = map_type::TreeType::LeafNodeType::LOG2DIM;
+    const auto component = [](openvdb::Int32 value) {
+      return static_cast<std::uint64_t>((static_cast<std::uint32_t>(value >> kLeafLog2Dim) + 0x100000U) & 0x1FFFFFU);
+    };
+    return (component(ijk.x()) << 42U) | (component(ijk.y()) << 21U) | component(ijk.z());
+  }
+
   param_type params_;
   const typename map_type::Ptr grid_;
-  const typename map_type::ConstAccessor accessor_;
   const openvdb::math::Transform transform_;
   const typename map_type::ValueType background_;
   double two_squared_sigma_;
@@ -0,0 +1,73 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+
+#include <openvdb/openvdb.h>
+
+#include <Eigen/Core>
+
+#include "beluga_vdb/io/vdb_map_io.hpp"
+
+namespace {
+
+TEST(TestVDBMapIO, BuildsLevelSetFromPoints) {
+  openvdb::initialize();
+  constexpr double kVoxelSize = 0.1;
+  const std::vector<Eigen::Vector3d> world_points{{1.0, 1.0, 1.0}, {2.0, 1.0, 1.0}};
+
+  const auto map = beluga_vdb::make_vdb_map(world_points, kVoxelSize);
+
+  ASSERT_NE(map, nullptr);
+  EXPECT_EQ(map->getGridClass(), openvdb::GRID_LEVEL_SET);
+  EXPECT_GT(map->activeVoxelCount(), 0UL);
+
+  // Map points sit inside their rasterized spheres, so the signed distance there is negative.
+  const auto accessor = map->getConstAccessor();
+  const openvdb::math::Coord ijk = map->transform().worldToIndexCellCentered(openvdb::math::Vec3d(1.0, 1.0, 1.0));
+  ASSERT_TRUE(accessor.isValueOn(ijk));
+  EXPECT_LT(accessor.getValue(ijk), 0.0F);
+}
+
+TEST(TestVDBMapIO, CachesAndReloads) {
+  openvdb::initialize();
+  constexpr double kVoxelSize = 0.1;
+  const std::vector<Eigen::Vector3d> world_points{{1.0, 1.0, 1.0}, {2.0, 1.0, 1.0}};
+  const auto cache_path = std::filesystem::temp_directory_path() / "beluga_vdb_test_map.vdb";
+  std::filesystem::remove(cache_path);
+
+  const auto built = beluga_vdb::load_or_make_vdb_map(
+      cache_path, [&world_points] { return world_points; }, kVoxelSize);
+  ASSERT_NE(built, nullptr);
+  ASSERT_TRUE(std::filesystem::exists(cache_path));
+
+  const auto cached = beluga_vdb::load_or_make_vdb_map(
+      cache_path,
+      []() -> std::vector<Eigen::Vector3d> {
+        ADD_FAILURE() << "Point source invoked despite a warm cache";
+        return {};
+      },
+      kVoxelSize);
+
+  ASSERT_NE(cached, nullptr);
+  EXPECT_EQ(cached->getGridClass(), openvdb::GRID_LEVEL_SET);
+  EXPECT_EQ(cached->activeVoxelCount(), built->activeVoxelCount());
+  EXPECT_EQ(cached->background(), built->background());
+  std::filesystem::remove(cache_path);
+}
+
+}  // namespace